@@ -26,6 +26,36 @@ balber::BerEncoder::MemOutStream::~MemOutStream()
 {
 }
 
+                // -------------------------------------------
+                // class balber::BerEncoder::CountingStreamBuf
+                // -------------------------------------------
+
+// CREATORS
+balber::BerEncoder::CountingStreamBuf::~CountingStreamBuf()
+{
+}
+
+// PROTECTED MANIPULATORS
+balber::BerEncoder::CountingStreamBuf::int_type
+balber::BerEncoder::CountingStreamBuf::overflow(int_type c)
+{
+    d_count += static_cast<int>(pptr() - pbase());
+    if (!traits_type::eq_int_type(c, traits_type::eof())) {
+        ++d_count;
+    }
+    setp(d_buffer, d_buffer + sizeof d_buffer);
+
+    return traits_type::not_eof(c);
+}
+
+bsl::streamsize balber::BerEncoder::CountingStreamBuf::xsputn(
+                                             const char_type * /* s */,
+                                             bsl::streamsize   numChars)
+{
+    d_count += static_cast<int>(numChars);
+    return numChars;
+}
+
 namespace balber {
 
                               // ----------------
@@ -41,6 +71,10 @@ BerEncoder::BerEncoder(const BerEncoderOptions *options,
 , d_severity     (e_BER_SUCCESS)
 , d_streamBuf    (0)
 , d_currentDepth (0)
+, d_lengthMode   (e_INDEFINITE_LENGTH)
+, d_lengths      (d_allocator)
+, d_openLengths  (d_allocator)
+, d_nextLength   (0)
 {
 }
 
@@ -52,6 +86,41 @@ BerEncoder::~BerEncoder()
 }
 
 // PRIVATE MANIPULATORS
+int BerEncoder::beginDefiniteLengthContents()
+{
+    if (e_SIZING_PASS == d_lengthMode) {
+        d_openLengths.push_back(static_cast<int>(d_lengths.size()));
+        d_lengths.push_back(d_countingStreamBuf.count());
+        return 0;                                                     // RETURN
+    }
+
+    BSLS_ASSERT(e_WRITING_PASS == d_lengthMode);
+    BSLS_ASSERT(d_nextLength < d_lengths.size());
+
+    return BerUtil::putLength(d_streamBuf, d_lengths[d_nextLength++]);
+}
+
+int BerEncoder::endDefiniteLengthContents()
+{
+    if (e_WRITING_PASS == d_lengthMode) {
+        return 0;                                                     // RETURN
+    }
+
+    BSLS_ASSERT(e_SIZING_PASS == d_lengthMode);
+    BSLS_ASSERT(!d_openLengths.empty());
+
+    int& length = d_lengths[d_openLengths.back()];
+    d_openLengths.pop_back();
+
+    length = d_countingStreamBuf.count() - length;
+
+    // The length octets precede the contents in the encoding, but counting
+    // them after the contents yields the same offsets for the enclosing
+    // elements.
+
+    return BerUtil::putLength(d_streamBuf, length);
+}
+
 BerEncoder::ErrorSeverity
 BerEncoder::logError(BerConstants::TagClass  tagClass,
                      int                     tagNumber,
@@ -31,6 +31,31 @@ BSLS_IDENT("$Id: $")
 // This component encodes objects based on the X.690 BER specification.  It can
 // only be used with types supported by the 'bdlat' framework.
 //
+///Definite Length Encoding
+///------------------------
+// By default, constructed elements (sequences, choices, arrays, and nillable
+// values) are encoded using the indefinite length form: the identifier octets
+// are followed by the single octet 0x80, then by the contents, and finally by
+// two end-of-contents octets.  This allows each element to be written as soon
+// as it is visited, without knowing the length of its contents in advance.
+//
+// If the 'EncodeDefiniteLength' option is set (see
+// 'balber_berencoderoptions'), constructed elements are instead encoded using
+// the definite length form, in which the length of the contents precedes the
+// contents.  Rather than encoding the contents of each constructed element
+// into a temporary buffer and copying it to the output once its length is
+// known, the encoder makes two passes over the value: the first pass writes
+// to a stream buffer that only counts the octets it is given, and records the
+// length of each constructed element in the order in which the elements are
+// visited; the second pass writes each octet to the output exactly once,
+// taking the lengths from the first pass.  The output can therefore be a
+// stream buffer that cannot be repositioned, such as a
+// 'bdlbb::OutBlobStreamBuf' or a 'bdlsb::FixedMemOutStreamBuf'.  Definite
+// length encoding is roughly twice as expensive in time as indefinite length
+// encoding, but is required by some consumers (e.g., those implementing DER,
+// or those that skip over elements without parsing them), and saves the two
+// end-of-contents octets of every constructed element.
+//
 ///Usage
 ///-----
 // This section illustrates intended use of this component.
@@ -192,7 +217,9 @@ BSLS_IDENT("$Id: $")
 
 #include <bsls_objectbuffer.h>
 
+#include <bsl_cstddef.h>
 #include <bsl_ostream.h>
+#include <bsl_streambuf.h>
 #include <bsl_vector.h>
 #include <bsl_typeinfo.h>
 
@@ -263,6 +290,63 @@ class BerEncoder {
             // characters appended to the stream, if any.
     };
 
+    class CountingStreamBuf : public bsl::streambuf {
+        // This class provides a stream buffer that discards the characters
+        // written to it, and counts them.  It is the output of the first pass
+        // of a definite length encoding.
+
+        // DATA
+        char d_buffer[256];  // put area, overwritten when full
+        int  d_count;        // characters written before the put area
+
+        // NOT IMPLEMENTED
+        CountingStreamBuf(const CountingStreamBuf&);             // = delete;
+        CountingStreamBuf& operator=(const CountingStreamBuf&);  // = delete;
+
+      protected:
+        // PROTECTED MANIPULATORS
+        virtual int_type overflow(int_type c);
+            // Count the characters in the put area and the specified 'c'
+            // (unless 'c' is end-of-file), and make the put area empty.
+            // Return a value other than end-of-file.
+
+        virtual bsl::streamsize xsputn(const char_type *s,
+                                       bsl::streamsize  numChars);
+            // Count the specified 'numChars' characters, ignoring the
+            // specified 's'.  Return 'numChars'.
+
+      public:
+        // CREATORS
+        CountingStreamBuf();
+            // Create a stream buffer that has counted no characters.
+
+        virtual ~CountingStreamBuf();
+            // Destroy this stream buffer.
+
+        // MANIPULATORS
+        void reset();
+            // Reset the count of characters written to this stream buffer to
+            // 0.
+
+        // ACCESSORS
+        int count() const;
+            // Return the number of characters written to this stream buffer
+            // since it was created or last reset.
+    };
+
+    enum LengthMode {
+        // Enumerates the ways in which the lengths of constructed elements
+        // are encoded.
+
+        e_INDEFINITE_LENGTH,  // indefinite length form
+
+        e_SIZING_PASS,        // first pass of definite length encoding:
+                              // record the contents lengths
+
+        e_WRITING_PASS        // second pass of definite length encoding:
+                              // write the recorded contents lengths
+    };
+
   public:
     // PUBLIC TYPES
     enum ErrorSeverity {
@@ -292,6 +376,26 @@ class BerEncoder {
     bsl::streambuf                   *d_streamBuf;      // held, not owned
     int                               d_currentDepth;   // current depth
 
+    LengthMode                        d_lengthMode;
+        // how the lengths of constructed elements are encoded
+
+    CountingStreamBuf                 d_countingStreamBuf;
+        // output of the first pass of a definite length encoding
+
+    bsl::vector<int>                  d_lengths;
+        // contents lengths of the constructed elements of the value being
+        // encoded with definite lengths, in the order in which they are
+        // visited (during the first pass, the offsets at which the contents
+        // of elements that are not yet complete begin)
+
+    bsl::vector<int>                  d_openLengths;
+        // indices in 'd_lengths' of the constructed elements whose contents
+        // are being sized
+
+    bsl::size_t                       d_nextLength;
+        // index in 'd_lengths' of the length of the next constructed element
+        // to be written
+
     // NOT IMPLEMENTED
     BerEncoder(const BerEncoder&);             // = delete;
     BerEncoder& operator=(const BerEncoder&);  // = delete;
@@ -315,6 +419,41 @@ class BerEncoder {
         // Return the stream for logging.  Note the if stream has not been
         // created yet, it will be created during this call.
 
+    int beginConstructedContents();
+        // Write the length octets of a constructed element whose identifier
+        // octets have just been written, in the form determined by the
+        // current length mode.  Return 0 on success, and a non-zero value
+        // otherwise.  The behavior is undefined unless each call to this
+        // method is matched by a call to 'endConstructedContents' after the
+        // contents of the element have been written.
+
+    int beginDefiniteLengthContents();
+        // Record the offset at which the contents of a constructed element
+        // begin if this is the first pass of a definite length encoding, and
+        // write the length of the contents of the element recorded during the
+        // first pass otherwise.  Return 0 on success, and a non-zero value
+        // otherwise.
+
+    int endConstructedContents();
+        // Complete the constructed element whose contents have just been
+        // written, by writing end-of-contents octets if it is encoded in the
+        // indefinite length form.  Return 0 on success, and a non-zero value
+        // otherwise.
+
+    int endDefiniteLengthContents();
+        // Record the length of the contents of the constructed element whose
+        // contents have just been written, and count its length octets, if
+        // this is the first pass of a definite length encoding, and do
+        // nothing otherwise.  Return 0 on success, and a non-zero value
+        // otherwise.
+
+    template <typename TYPE>
+    int encodeValue(bsl::streambuf *streamBuf, const TYPE& value);
+        // Encode the specified 'value' to the specified 'streamBuf', in one
+        // pass if 'd_options' specifies indefinite length encoding, and in
+        // two passes otherwise.  Return 0 on success, and a non-zero value
+        // otherwise.  The behavior is undefined unless 'd_options' is not 0.
+
     int encodeImpl(const bsl::vector<char>&  value,
                    BerConstants::TagClass    tagClass,
                    int                       tagNumber,
@@ -576,6 +715,33 @@ int balber::BerEncoder::MemOutStream::length() const
     return static_cast<int>(d_sb.length());
 }
 
+                // -------------------------------------------
+                // class balber::BerEncoder::CountingStreamBuf
+                // -------------------------------------------
+
+// CREATORS
+inline
+balber::BerEncoder::CountingStreamBuf::CountingStreamBuf()
+: d_count(0)
+{
+    setp(d_buffer, d_buffer + sizeof d_buffer);
+}
+
+// MANIPULATORS
+inline
+void balber::BerEncoder::CountingStreamBuf::reset()
+{
+    d_count = 0;
+    setp(d_buffer, d_buffer + sizeof d_buffer);
+}
+
+// ACCESSORS
+inline
+int balber::BerEncoder::CountingStreamBuf::count() const
+{
+    return d_count + static_cast<int>(pptr() - pbase());
+}
+
 namespace balber {
 
                         // ----------------------------
@@ -670,36 +836,24 @@ int BerEncoder::encode(bsl::streambuf *streamBuf, const TYPE& value)
 {
     BSLS_ASSERT(!d_streamBuf);
 
-    d_streamBuf = streamBuf;
     d_severity  = e_BER_SUCCESS;
 
     if (d_logStream != 0) {
         d_logStream->reset();
     }
 
-    d_currentDepth = 0;
-
     int rc;
 
     if (! d_options) {
         BerEncoderOptions options;  // temporary options object
         d_options = &options;
-        BerEncoder_UniversalElementVisitor visitor(
-                                              this,
-                                              bdlat_FormattingMode::e_DEFAULT);
-
-        rc = visitor(value);
+        rc = encodeValue(streamBuf, value);
         d_options = 0;
     }
     else {
-        BerEncoder_UniversalElementVisitor visitor(
-                                              this,
-                                              bdlat_FormattingMode::e_DEFAULT);
-        rc = visitor(value);
+        rc = encodeValue(streamBuf, value);
     }
 
-    d_streamBuf = 0;
-
     streamBuf->pubsync();
 
     return rc;
@@ -720,6 +874,75 @@ int BerEncoder::encode(bsl::ostream& stream, const TYPE& value)
 }
 
 // PRIVATE MANIPULATORS
+inline
+int BerEncoder::beginConstructedContents()
+{
+    if (e_INDEFINITE_LENGTH == d_lengthMode) {
+        return BerUtil::putIndefiniteLengthOctet(d_streamBuf);        // RETURN
+    }
+
+    return beginDefiniteLengthContents();
+}
+
+inline
+int BerEncoder::endConstructedContents()
+{
+    if (e_INDEFINITE_LENGTH == d_lengthMode) {
+        return BerUtil::putEndOfContentOctets(d_streamBuf);           // RETURN
+    }
+
+    return endDefiniteLengthContents();
+}
+
+template <typename TYPE>
+int BerEncoder::encodeValue(bsl::streambuf *streamBuf, const TYPE& value)
+{
+    BSLS_ASSERT(d_options);
+
+    d_currentDepth = 0;
+
+    // Note that 'visitor' increments the current depth, and can be used for
+    // both passes of a definite length encoding.
+
+    BerEncoder_UniversalElementVisitor visitor(
+                                              this,
+                                              bdlat_FormattingMode::e_DEFAULT);
+
+    if (!d_options->encodeDefiniteLength()) {
+        d_lengthMode = e_INDEFINITE_LENGTH;
+        d_streamBuf  = streamBuf;
+
+        const int rc = visitor(value);
+
+        d_streamBuf = 0;
+        return rc;                                                    // RETURN
+    }
+
+    d_lengths.clear();
+    d_openLengths.clear();
+    d_nextLength = 0;
+    d_countingStreamBuf.reset();
+
+    d_lengthMode = e_SIZING_PASS;
+    d_streamBuf  = &d_countingStreamBuf;
+
+    int rc = visitor(value);
+
+    if (0 == rc) {
+        BSLS_ASSERT(d_openLengths.empty());
+
+        d_lengthMode = e_WRITING_PASS;
+        d_streamBuf  = streamBuf;
+
+        rc = visitor(value);
+
+        BSLS_ASSERT(0 != rc || d_lengths.size() == d_nextLength);
+    }
+
+    d_streamBuf = 0;
+    return rc;
+}
+
 template <typename TYPE>
 int BerEncoder::encodeImpl(const TYPE&                value,
                            BerConstants::TagClass     tagClass,
@@ -735,7 +958,7 @@ int BerEncoder::encodeImpl(const TYPE&                value,
                                           tagClass,
                                           tagType,
                                           tagNumber);
-    if (rc | BerUtil::putIndefiniteLengthOctet(d_streamBuf)) {
+    if (rc | beginConstructedContents()) {
         return k_FAILURE;                                             // RETURN
     }
 
@@ -750,7 +973,7 @@ int BerEncoder::encodeImpl(const TYPE&                value,
                                           BerConstants::e_CONTEXT_SPECIFIC,
                                           tagType,
                                           0);
-        if (rc | BerUtil::putIndefiniteLengthOctet(d_streamBuf)) {
+        if (rc | beginConstructedContents()) {
             return k_FAILURE;
         }
     }
@@ -784,10 +1007,10 @@ int BerEncoder::encodeImpl(const TYPE&                value,
         // Don't waste time checking the result of this call -- the only thing
         // that can go wrong is eof, which will happen again when we call it
         // again below.
-        BerUtil::putEndOfContentOctets(d_streamBuf);
+        endConstructedContents();
     }
 
-    return BerUtil::putEndOfContentOctets(d_streamBuf);
+    return endConstructedContents();
 }
 
 template <typename TYPE>
@@ -809,7 +1032,7 @@ int BerEncoder::encodeImpl(const TYPE&                       value,
                                               tagClass,
                                               BerConstants::e_CONSTRUCTED,
                                               tagNumber);
-        if (rc | BerUtil::putIndefiniteLengthOctet(d_streamBuf)) {
+        if (rc | beginConstructedContents()) {
             return k_FAILURE;
         }
 
@@ -827,7 +1050,7 @@ int BerEncoder::encodeImpl(const TYPE&                       value,
             }
         } // end of bdlat_NullableValueFunctions::isNull(...)
 
-        return BerUtil::putEndOfContentOctets(d_streamBuf);
+        return endConstructedContents();
     } // end of isNillable
 
     if (!bdlat_NullableValueFunctions::isNull(value)) {
@@ -901,13 +1124,13 @@ int BerEncoder::encodeImpl(const TYPE&                  value,
                                           tagClass,
                                           BerConstants::e_CONSTRUCTED,
                                           tagNumber);
-    rc |= BerUtil::putIndefiniteLengthOctet(d_streamBuf);
+    rc |= beginConstructedContents();
     if (rc) {
         return rc;
     }
 
     rc = bdlat_SequenceFunctions::accessAttributes(value, visitor);
-    rc |= BerUtil::putEndOfContentOctets(d_streamBuf);
+    rc |= endConstructedContents();
 
     return rc;
 }
@@ -969,7 +1192,7 @@ BerEncoder::encodeArrayImpl(const TYPE&             value,
                                           tagClass,
                                           tagType,
                                           tagNumber);
-    rc |= BerUtil::putIndefiniteLengthOctet(d_streamBuf);
+    rc |= beginConstructedContents();
     if (rc) {
         return k_FAILURE;                                             // RETURN
     }
@@ -988,7 +1211,7 @@ BerEncoder::encodeArrayImpl(const TYPE&             value,
         }
     }
 
-    return BerUtil::putEndOfContentOctets(d_streamBuf);
+    return endConstructedContents();
 }
 
 template <typename TYPE>
@@ -11,8 +11,12 @@
 #include <balber_berencoder.h>
 
 #include <balber_berconstants.h>
+#include <balber_berdecoder.h>
+#include <balber_berdecoderoptions.h>
 #include <balber_berutil.h>
 
+#include <balb_testmessages.h>
+
 #include <bdlat_attributeinfo.h>
 #include <bdlat_selectioninfo.h>
 #include <bdlat_valuetypefunctions.h>
@@ -21,6 +25,11 @@
 #include <bdlsb_memoutstreambuf.h>
 #include <bdlsb_fixedmeminstreambuf.h>
 
+#include <bdlbb_blob.h>
+#include <bdlbb_blobstreambuf.h>
+#include <bdlbb_blobutil.h>
+#include <bdlbb_simpleblobbufferfactory.h>
+
 #include <bdlt_date.h>
 #include <bdlt_datetime.h>
 #include <bdlt_time.h>
@@ -55,7 +64,9 @@ using bsl::flush;
 // ============================================================================
 //                                 TEST PLAN
 // ----------------------------------------------------------------------------
-
+// [14] DEFINITE LENGTH ENCODING
+// [15] USAGE EXAMPLE
+// [-2] PERFORMANCE TEST: DEFINITE LENGTH ENCODING OF NESTED VALUES
 // ----------------------------------------------------------------------------
 
 // ============================================================================
@@ -207,6 +218,110 @@ void printDiagnostic(balber::BerEncoder & encoder)
     }
 }
 
+int checkDefiniteLengths(bsl::streambuf *streamBuf,
+                         int             length,
+                         int            *numConstructed,
+                         int            *numSavedOctets)
+    // Parse the BER elements in the next specified 'length' octets of the
+    // specified 'streamBuf', including the elements nested in constructed
+    // elements.  Increment the specified 'numConstructed' for each constructed
+    // element, and add to the specified 'numSavedOctets' the number of octets
+    // by which the indefinite length encoding of each constructed element is
+    // longer than its definite length encoding.  Return 0 if every element
+    // has a definite length, the contents of each constructed element consist
+    // of exactly the elements within its length, and the elements exactly
+    // fill 'length' octets, and a non-zero value otherwise.
+{
+    int numConsumed = 0;
+
+    while (numConsumed < length) {
+        balber::BerConstants::TagClass tagClass;
+        balber::BerConstants::TagType  tagType;
+        int                            tagNumber;
+        int                            contentsLength;
+        int                            numHeaderOctets = 0;
+
+        if (0 != balber::BerUtil::getIdentifierOctets(streamBuf,
+                                                      &tagClass,
+                                                      &tagType,
+                                                      &tagNumber,
+                                                      &numHeaderOctets)) {
+            return -1;                                                // RETURN
+        }
+
+        const int numIdentifierOctets = numHeaderOctets;
+
+        if (0 != balber::BerUtil::getLength(streamBuf,
+                                            &contentsLength,
+                                            &numHeaderOctets)
+         || contentsLength < 0) {
+            return -1;                                                // RETURN
+        }
+
+        if (balber::BerConstants::e_CONSTRUCTED == tagType) {
+            ++*numConstructed;
+
+            // The indefinite length form has one length octet, and two
+            // end-of-contents octets.
+
+            *numSavedOctets += 3 - (numHeaderOctets - numIdentifierOctets);
+
+            if (0 != checkDefiniteLengths(streamBuf,
+                                          contentsLength,
+                                          numConstructed,
+                                          numSavedOctets)) {
+                return -1;                                            // RETURN
+            }
+        }
+        else {
+            for (int i = 0; i < contentsLength; ++i) {
+                if (bsl::streambuf::traits_type::eof() ==
+                                                     streamBuf->sbumpc()) {
+                    return -1;                                        // RETURN
+                }
+            }
+        }
+
+        numConsumed += numHeaderOctets + contentsLength;
+    }
+
+    return numConsumed == length ? 0 : -1;
+}
+
+void makeNestedValue(balb::Sequence3 *value,
+                     int              depth,
+                     int              width,
+                     int              stringLength)
+    // Load into the specified 'value' a chain of 'balb::Sequence3' objects
+    // nested to the specified 'depth' (through 'balb::Sequence5' objects), in
+    // which each 'balb::Sequence5' object also holds the specified 'width'
+    // unnested 'balb::Sequence3' objects, and each 'balb::Sequence3' object
+    // holds a string of the specified 'stringLength'.
+{
+    value->element2().push_back(bsl::string(stringLength, 'x'));
+    value->element3().makeValue(0 == depth % 2);
+    value->element1().push_back(balb::Enumerated::NEW_YORK);
+
+    if (0 == depth) {
+        return;                                                       // RETURN
+    }
+
+    balb::Sequence5& next = value->element5().makeValue();
+
+    next.element5().push_back(bdlb::NullableValue<int>(depth));
+    next.element3().push_back(bdlb::NullableValue<double>(depth / 8.0));
+
+    for (int i = 0; i < width; ++i) {
+        next.element7().resize(next.element7().size() + 1);
+        makeNestedValue(&next.element7().back().makeValue(),
+                        0,
+                        0,
+                        stringLength);
+    }
+
+    makeNestedValue(&next.element1(), depth - 1, width, stringLength);
+}
+
 // ============================================================================
 //                     GLOBAL HELPER CLASSES FOR TESTING
 // ----------------------------------------------------------------------------
@@ -9349,7 +9464,7 @@ int main(int argc, char *argv[])
     bsl::cout << "TEST " << __FILE__ << " CASE " << test << bsl::endl;;
 
     switch (test) { case 0:  // Zero is always the leading case.
-      case 14: {
+      case 15: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //   Extracted from component header file.
@@ -9373,6 +9488,247 @@ int main(int argc, char *argv[])
         usageExample();
 
       } break;
+      case 14: {
+        // --------------------------------------------------------------------
+        // TESTING DEFINITE LENGTH ENCODING
+        //
+        // Concerns:
+        //: 1 If the 'EncodeDefiniteLength' option is set, every constructed
+        //:   element is encoded with a definite length that is exactly the
+        //:   length of its contents, using the short or long form as needed.
+        //:
+        //: 2 The definite length encoding of a value decodes to that value.
+        //:
+        //: 3 The definite length encoding differs from the indefinite length
+        //:   encoding only by the length and end-of-contents octets of the
+        //:   constructed elements.
+        //:
+        //: 4 Values nested to any depth are encoded correctly.
+        //:
+        //: 5 An encoder can encode any number of values, and encoders using
+        //:   the two forms can be used in any order.
+        //:
+        //: 6 If the value cannot be encoded, nothing is written to the
+        //:   output.
+        //:
+        //: 7 The encoding can be written to a 'bdlbb::Blob'.
+        //
+        // Plan:
+        //: 1 Encode values of sequence, choice, nillable, and array types,
+        //:   and 'balb::Sequence3' values nested to depths from 0 to 40 with
+        //:   strings of varying length, using the same pair of encoders for
+        //:   the definite and indefinite length forms.  Parse the definite
+        //:   length encoding using 'BerUtil', and verify that the lengths are
+        //:   consistent with the contents, and that the encoding is shorter
+        //:   than the indefinite length encoding by the expected number of
+        //:   octets.  Decode the definite length encoding, and verify that it
+        //:   has the original value.  (C-1..5)
+        //:
+        //: 2 Encode an unselected choice with the
+        //:   'DisableUnselectedChoiceEncoding' option set, and verify that
+        //:   the encoding fails without writing to the output.  (C-6)
+        //:
+        //: 3 Encode a nested value to a 'bdlbb::Blob' having small buffers
+        //:   and verify that the blob holds the same encoding as a contiguous
+        //:   buffer.  (C-7)
+        //
+        // Testing:
+        //   DEFINITE LENGTH ENCODING
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING DEFINITE LENGTH ENCODING" << endl
+                          << "================================" << endl;
+
+        balber::BerEncoderOptions definiteOptions;
+        definiteOptions.setEncodeDefiniteLength(true);
+
+        balber::BerEncoderOptions indefiniteOptions;
+
+        balber::BerEncoder definiteEncoder(&definiteOptions);
+        balber::BerEncoder indefiniteEncoder(&indefiniteOptions);
+
+        balber::BerDecoderOptions decoderOptions;
+        decoderOptions.setMaxDepth(1000);
+
+        if (verbose) cout << "\nTesting values of the test types." << endl;
+        {
+            test::MySequence sequence;
+            sequence.attribute1() = 34;
+            sequence.attribute2() = "Hello";
+
+            test::MyChoice choice;
+            choice.makeSelection2("World!");
+
+            test::MySequenceWithNillable nillable;
+            nillable.attribute1() = 7;
+            nillable.myNillable().makeValue("Nillable");
+            nillable.attribute2() = "Sequence";
+
+            test::MySequenceWithArray array;
+            array.attribute1() = 12;
+            array.attribute2().push_back("Hello");
+            array.attribute2().push_back("World!");
+
+            test::BasicRecord basicRecord;
+            basicRecord.i1() = 11;
+            basicRecord.i2() = 22;
+            basicRecord.s()  = bsl::string(200, 's');
+
+            test::BigRecord bigRecord;
+            bigRecord.name() = "Big";
+            for (int i = 0; i < 20; ++i) {
+                bigRecord.array().push_back(basicRecord);
+            }
+
+            test::TimingRequest request;
+            request.makeBig(bigRecord);
+
+#define ENCODE_BOTH_WAYS(VALUE, NUM_CONSTRUCTED) {                            \
+            bdlsb::MemOutStreamBuf definiteOsb;                               \
+            bdlsb::MemOutStreamBuf indefiniteOsb;                             \
+                                                                              \
+            ASSERT(0 == definiteEncoder.encode(&definiteOsb, VALUE));         \
+            ASSERT(0 == indefiniteEncoder.encode(&indefiniteOsb, VALUE));     \
+            printDiagnostic(definiteEncoder);                                 \
+                                                                              \
+            const int LENGTH = static_cast<int>(definiteOsb.length());        \
+                                                                              \
+            bdlsb::FixedMemInStreamBuf isb(definiteOsb.data(), LENGTH);       \
+                                                                              \
+            int numConstructed = 0;                                           \
+            int numSavedOctets = 0;                                           \
+                                                                              \
+            ASSERT(0 == checkDefiniteLengths(&isb,                            \
+                                             LENGTH,                          \
+                                             &numConstructed,                 \
+                                             &numSavedOctets));               \
+            ASSERTV(NUM_CONSTRUCTED, numConstructed,                          \
+                    NUM_CONSTRUCTED == numConstructed);                       \
+            ASSERTV(indefiniteOsb.length(), LENGTH, numSavedOctets,           \
+                    static_cast<int>(indefiniteOsb.length()) ==               \
+                                                  LENGTH + numSavedOctets);   \
+                                                                              \
+            if (veryVerbose) {                                                \
+                P(LENGTH)                                                     \
+                printBuffer(definiteOsb.data(), LENGTH);                      \
+            }                                                                 \
+        }
+
+            ENCODE_BOTH_WAYS(sequence,     1);
+            ENCODE_BOTH_WAYS(choice,       2);
+            ENCODE_BOTH_WAYS(nillable,     2);
+            ENCODE_BOTH_WAYS(array,        2);
+            ENCODE_BOTH_WAYS(basicRecord,  1);
+            ENCODE_BOTH_WAYS(request,     24);
+
+            {
+                bdlsb::MemOutStreamBuf osb;
+                ASSERT(0 == definiteEncoder.encode(&osb, request));
+
+                balber::BerDecoder   decoder(&decoderOptions);
+                test::TimingRequest  result;
+                bdlsb::FixedMemInStreamBuf isb(osb.data(), osb.length());
+
+                ASSERT(0       == decoder.decode(&isb, &result));
+                ASSERT(request == result);
+            }
+        }
+
+        if (verbose) cout << "\nTesting nested values." << endl;
+        {
+            static const int STRING_LENGTHS[] = { 0, 1, 127, 128, 300 };
+            enum { NUM_STRING_LENGTHS = sizeof  STRING_LENGTHS
+                                      / sizeof *STRING_LENGTHS };
+
+            for (int depth = 0; depth <= 40; ++depth) {
+                for (int i = 0; i < NUM_STRING_LENGTHS; ++i) {
+                    const int STRING_LENGTH = STRING_LENGTHS[i];
+                    const int WIDTH         = depth % 3;
+
+                    if (veryVerbose) {
+                        T_ P_(depth) P_(WIDTH) P(STRING_LENGTH)
+                    }
+
+                    balb::Sequence3 value;
+                    makeNestedValue(&value, depth, WIDTH, STRING_LENGTH);
+
+                    // Each 'Sequence3' is encoded with its 3 arrays, and each
+                    // level of nesting adds a 'Sequence5' with its 6 arrays
+                    // (holding 2 nillable elements), the nested 'Sequence3',
+                    // and 'WIDTH' unnested ones, which are also nillable.
+
+                    const int NUM_CONSTRUCTED = 4 + depth * (13 + 5 * WIDTH);
+
+                    ENCODE_BOTH_WAYS(value, NUM_CONSTRUCTED);
+
+                    bdlsb::MemOutStreamBuf osb;
+                    ASSERT(0 == definiteEncoder.encode(&osb, value));
+
+                    balber::BerDecoder         decoder(&decoderOptions);
+                    balb::Sequence3            result;
+                    bdlsb::FixedMemInStreamBuf isb(osb.data(), osb.length());
+
+                    ASSERTV(depth, STRING_LENGTH,
+                            0 == decoder.decode(&isb, &result));
+                    ASSERTV(depth, STRING_LENGTH, value == result);
+                }
+            }
+
+#undef ENCODE_BOTH_WAYS
+        }
+
+        if (verbose) cout << "\nTesting failure." << endl;
+        {
+            balber::BerEncoderOptions options;
+            options.setEncodeDefiniteLength(true);
+            options.setDisableUnselectedChoiceEncoding(true);
+
+            balber::BerEncoder encoder(&options);
+
+            test::MySequenceWithAnonymousChoice value;
+            value.attribute1() = 1;
+            value.attribute2() = "Unselected";
+
+            bdlsb::MemOutStreamBuf osb;
+            ASSERT(0 != encoder.encode(&osb, value));
+            ASSERT(0 == osb.length());
+
+            options.setDisableUnselectedChoiceEncoding(false);
+
+            ASSERT(0 == encoder.encode(&osb, value));
+            ASSERT(0 <  osb.length());
+        }
+
+        if (verbose) cout << "\nTesting encoding to a blob." << endl;
+        {
+            balb::Sequence3 value;
+            makeNestedValue(&value, 10, 2, 100);
+
+            bdlsb::MemOutStreamBuf osb;
+            ASSERT(0 == definiteEncoder.encode(&osb, value));
+
+            for (int bufferSize = 1; bufferSize <= 64; bufferSize *= 2) {
+                bdlbb::SimpleBlobBufferFactory factory(bufferSize);
+                bdlbb::Blob                    blob(&factory);
+                {
+                    bdlbb::OutBlobStreamBuf blobOsb(&blob);
+                    ASSERTV(bufferSize,
+                            0 == definiteEncoder.encode(&blobOsb, value));
+                }
+
+                ASSERTV(bufferSize, static_cast<int>(osb.length()) ==
+                                                                blob.length());
+
+                bsl::vector<char> data(blob.length());
+                bdlbb::BlobUtil::copy(data.data(), blob, 0, blob.length());
+
+                ASSERTV(bufferSize, 0 == bsl::memcmp(osb.data(),
+                                                     data.data(),
+                                                     data.size()));
+            }
+        }
+      } break;
       case 13: {
         // --------------------------------------------------------------------
         // TESTING 'encode' for date/time components
@@ -12425,6 +12781,74 @@ int main(int argc, char *argv[])
                   << (reps / elapsed) << " reps/sec, "
                   << osb.length()     << " bytes" << bsl::endl;
       } break;
+      case -2: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE TEST: DEFINITE LENGTH ENCODING OF NESTED VALUES
+        //   Compare the times taken to encode values nested to various depths
+        //   using the indefinite and definite length forms, to a contiguous
+        //   buffer and to a 'bdlbb::Blob'.  Optionally specify the number of
+        //   repetitions as the first argument.
+        // --------------------------------------------------------------------
+
+        const int reps = argc > 2 ? bsl::atoi(argv[2]) : 1000;
+
+        bsl::cout << "DEFINITE LENGTH ENCODING OF NESTED VALUES" << bsl::endl
+                  << "  " << reps << " repetitions..." << bsl::endl;
+
+        static const int DEPTHS[] = { 1, 4, 16, 64, 256 };
+        enum { NUM_DEPTHS = sizeof DEPTHS / sizeof *DEPTHS };
+
+        for (int i = 0; i < NUM_DEPTHS; ++i) {
+            const int DEPTH = DEPTHS[i];
+
+            balb::Sequence3 value;
+            makeNestedValue(&value, DEPTH, 2, 16);
+
+            bsl::cout << "  depth " << DEPTH << ":" << bsl::endl;
+
+            for (int definite = 0; definite < 2; ++definite) {
+                balber::BerEncoderOptions options;
+                options.setEncodeDefiniteLength(definite);
+
+                balber::BerEncoder encoder(&options);
+
+                bdlsb::MemOutStreamBuf osb;
+                ASSERT(0 == encoder.encode(&osb, value));
+
+                bsls::Stopwatch stopwatch;
+                stopwatch.start();
+                for (int j = 0; j < reps; ++j) {
+                    osb.pubseekpos(0);
+                    encoder.encode(&osb, value);
+                }
+                stopwatch.stop();
+
+                const double bufferTime = stopwatch.elapsedTime();
+
+                bdlbb::SimpleBlobBufferFactory factory(4096);
+                bdlbb::Blob                    blob(&factory);
+
+                stopwatch.reset();
+                stopwatch.start();
+                for (int j = 0; j < reps; ++j) {
+                    blob.removeAll();
+                    bdlbb::OutBlobStreamBuf blobOsb(&blob);
+                    encoder.encode(&blobOsb, value);
+                }
+                stopwatch.stop();
+
+                const double blobTime = stopwatch.elapsedTime();
+
+                ASSERT(static_cast<int>(osb.length()) == blob.length());
+
+                bsl::cout << "    "
+                          << (definite ? "definite:  " : "indefinite:")
+                          << " buffer " << bufferTime << " seconds,"
+                          << " blob "   << blobTime   << " seconds, "
+                          << osb.length() << " bytes" << bsl::endl;
+            }
+        }
+      } break;
       default: {
         bsl::cerr << "WARNING: CASE `" << test << "' NOT FOUND." << bsl::endl;
         testStatus = -1;
@@ -46,6 +46,8 @@ const int  balber::BerEncoderOptions::
               DEFAULT_INITIALIZER_DATETIME_FRACTIONAL_SECOND_PRECISION = 3;
 const bool balber::BerEncoderOptions::
               DEFAULT_INITIALIZER_DISABLE_UNSELECTED_CHOICE_ENCODING = false;
+const bool balber::BerEncoderOptions::
+              DEFAULT_INITIALIZER_ENCODE_DEFINITE_LENGTH = false;
 
 const bdlat_AttributeInfo balber::BerEncoderOptions::ATTRIBUTE_INFO_ARRAY[] = {
     {
@@ -89,6 +91,13 @@ const bdlat_AttributeInfo balber::BerEncoderOptions::ATTRIBUTE_INFO_ARRAY[] = {
         sizeof("DisableUnselectedChoiceEncoding") - 1,
         "",
         bdlat_FormattingMode::e_TEXT
+    },
+    {
+        e_ATTRIBUTE_ID_ENCODE_DEFINITE_LENGTH,
+        "EncodeDefiniteLength",
+        sizeof("EncodeDefiniteLength") - 1,
+        "",
+        bdlat_FormattingMode::e_TEXT
     }
 };
 
@@ -140,6 +149,33 @@ const bdlat_AttributeInfo *BerEncoderOptions::lookupAttributeInfo(
                                                                       // RETURN
             }
         } break;
+        case 20: {
+            if (name[0]=='E'
+             && name[1]=='n'
+             && name[2]=='c'
+             && name[3]=='o'
+             && name[4]=='d'
+             && name[5]=='e'
+             && name[6]=='D'
+             && name[7]=='e'
+             && name[8]=='f'
+             && name[9]=='i'
+             && name[10]=='n'
+             && name[11]=='i'
+             && name[12]=='t'
+             && name[13]=='e'
+             && name[14]=='L'
+             && name[15]=='e'
+             && name[16]=='n'
+             && name[17]=='g'
+             && name[18]=='t'
+             && name[19]=='h')
+            {
+                return &ATTRIBUTE_INFO_ARRAY[
+                                    e_ATTRIBUTE_INDEX_ENCODE_DEFINITE_LENGTH];
+                                                                      // RETURN
+            }
+        } break;
         case 21: {
             if (name[0]=='B'
              && name[1]=='d'
@@ -304,6 +340,8 @@ const bdlat_AttributeInfo *BerEncoderOptions::lookupAttributeInfo(int id)
       case e_ATTRIBUTE_ID_DISABLE_UNSELECTED_CHOICE_ENCODING:
         return &ATTRIBUTE_INFO_ARRAY[
                          e_ATTRIBUTE_INDEX_DISABLE_UNSELECTED_CHOICE_ENCODING];
+      case e_ATTRIBUTE_ID_ENCODE_DEFINITE_LENGTH:
+        return &ATTRIBUTE_INFO_ARRAY[e_ATTRIBUTE_INDEX_ENCODE_DEFINITE_LENGTH];
       default:
         return 0;
     }
@@ -321,6 +359,7 @@ BerEncoderOptions::BerEncoderOptions()
                       DEFAULT_INITIALIZER_ENCODE_DATE_AND_TIME_TYPES_AS_BINARY)
 , d_disableUnselectedChoiceEncoding(
                         DEFAULT_INITIALIZER_DISABLE_UNSELECTED_CHOICE_ENCODING)
+, d_encodeDefiniteLength(DEFAULT_INITIALIZER_ENCODE_DEFINITE_LENGTH)
 {
 }
 
@@ -332,6 +371,7 @@ BerEncoderOptions::BerEncoderOptions(const BerEncoderOptions& original)
 , d_encodeEmptyArrays(original.d_encodeEmptyArrays)
 , d_encodeDateAndTimeTypesAsBinary(original.d_encodeDateAndTimeTypesAsBinary)
 , d_disableUnselectedChoiceEncoding(original.d_disableUnselectedChoiceEncoding)
+, d_encodeDefiniteLength(original.d_encodeDefiniteLength)
 {
 }
 
@@ -354,6 +394,7 @@ BerEncoderOptions::operator=(const BerEncoderOptions& rhs)
                                        rhs.d_datetimeFractionalSecondPrecision;
         d_disableUnselectedChoiceEncoding =
                                          rhs.d_disableUnselectedChoiceEncoding;
+        d_encodeDefiniteLength = rhs.d_encodeDefiniteLength;
     }
     return *this;
 }
@@ -369,6 +410,7 @@ void BerEncoderOptions::reset()
                       DEFAULT_INITIALIZER_DATETIME_FRACTIONAL_SECOND_PRECISION;
     d_disableUnselectedChoiceEncoding =
                         DEFAULT_INITIALIZER_DISABLE_UNSELECTED_CHOICE_ENCODING;
+    d_encodeDefiniteLength = DEFAULT_INITIALIZER_ENCODE_DEFINITE_LENGTH;
 }
 
 // ACCESSORS
@@ -434,6 +476,13 @@ bsl::ostream& BerEncoderOptions::print(
                                  -levelPlus1,
                                   spacesPerLevel);
 
+        bdlb::Print::indent(stream, levelPlus1, spacesPerLevel);
+        stream << "EncodeDefiniteLength = ";
+        bdlb::PrintMethods::print(stream,
+                                  d_encodeDefiniteLength,
+                                  -levelPlus1,
+                                  spacesPerLevel);
+
         bdlb::Print::indent(stream, level, spacesPerLevel);
 
         stream << "]\n";
@@ -477,6 +526,12 @@ bsl::ostream& BerEncoderOptions::print(
         bdlb::PrintMethods::print(stream, d_disableUnselectedChoiceEncoding,
                                  -levelPlus1, spacesPerLevel);
 
+        stream << ' ';
+        stream << "EncodeDefiniteLength = ";
+        bdlb::PrintMethods::print(stream, d_encodeDefiniteLength,
+                                  -levelPlus1,
+                                  spacesPerLevel);
+
         stream << " ]";
     }
 
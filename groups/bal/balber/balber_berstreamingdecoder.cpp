@@ -0,0 +1,334 @@
+// balber_berstreamingdecoder.cpp                                     -*-C++-*-
+#include <balber_berstreamingdecoder.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(balber_berstreamingdecoder_cpp, "$Id$ $CSID$")
+
+#include <bdlbb_blobutil.h>
+
+#include <bsl_climits.h>
+
+namespace BloombergLP {
+namespace balber {
+
+namespace {
+
+enum {
+    k_CONSTRUCTED_BIT        = 0x20,  // identifier bit of constructed elements
+
+    k_TAG_NUMBER_MASK        = 0x1F,  // identifier bits of the tag number, all
+                                      // set if it is in subsequent octets
+
+    k_CONTINUATION_BIT       = 0x80,  // bit set in all but the last
+                                      // subsequent identifier octet
+
+    k_INDEFINITE_LENGTH      = 0x80,  // length octet of indefinite lengths
+
+    k_LONG_FORM_BIT          = 0x80,  // first length octet bit set if the
+                                      // number of length octets follows
+
+    k_MAX_TAG_NUMBER_OCTETS  = (sizeof(int) * CHAR_BIT) / 7 + 1,
+                                      // same limit as 'BerUtil'
+
+    k_MAX_LENGTH_OCTETS      = sizeof(int)
+};
+
+}  // close unnamed namespace
+
+                         // -------------------------
+                         // class BerStreamingDecoder
+                         // -------------------------
+
+// PRIVATE MANIPULATORS
+void BerStreamingDecoder::consumeMessage()
+{
+    BSLS_ASSERT(e_COMPLETE == d_state);
+
+    bdlbb::BlobUtil::erase(&d_data, 0, d_position);
+
+    d_state        = e_IDENTIFIER;
+    d_bufferIndex  = 0;
+    d_bufferOffset = 0;
+    d_position     = 0;
+
+    scan();
+}
+
+void BerStreamingDecoder::endHeader()
+{
+    const int limit = d_frames.empty() ? INT_MAX : d_frames.back().d_limit;
+
+    if (d_position > limit) {
+        // The identifier and length octets overrun the enclosing element.
+
+        d_state = e_ERROR;
+        return;                                                       // RETURN
+    }
+
+    if (d_isEndOfContents) {
+        if (0 != d_length
+         || d_frames.empty()
+         || !d_frames.back().d_indefinite) {
+            d_state = e_ERROR;
+            return;                                                   // RETURN
+        }
+        d_frames.pop_back();
+        popCompletedFrames();
+        return;                                                       // RETURN
+    }
+
+    if (d_length > limit - d_position) {
+        d_state = e_ERROR;
+        return;                                                       // RETURN
+    }
+
+    if (d_isConstructed) {
+        pushFrame(d_position + d_length, false);
+        if (e_ERROR != d_state) {
+            popCompletedFrames();
+        }
+    }
+    else if (0 == d_length) {
+        popCompletedFrames();
+    }
+    else {
+        d_contentsLeft = d_length;
+        d_state        = e_CONTENTS;
+    }
+}
+
+void BerStreamingDecoder::popCompletedFrames()
+{
+    while (!d_frames.empty()
+        && !d_frames.back().d_indefinite
+        && d_position == d_frames.back().d_limit) {
+        d_frames.pop_back();
+    }
+
+    d_state = d_frames.empty() ? e_COMPLETE : e_IDENTIFIER;
+}
+
+void BerStreamingDecoder::processOctet(unsigned char octet)
+{
+    switch (d_state) {
+      case e_IDENTIFIER: {
+        d_isEndOfContents = 0 == octet;
+        d_isConstructed   = 0 != (octet & k_CONSTRUCTED_BIT);
+
+        if (k_TAG_NUMBER_MASK == (octet & k_TAG_NUMBER_MASK)) {
+            d_numOctetsLeft = k_MAX_TAG_NUMBER_OCTETS;
+            d_state         = e_TAG_NUMBER;
+        }
+        else {
+            d_state = e_LENGTH;
+        }
+      } break;
+      case e_TAG_NUMBER: {
+        if (0 == (octet & k_CONTINUATION_BIT)) {
+            d_state = e_LENGTH;
+        }
+        else if (0 == --d_numOctetsLeft) {
+            d_state = e_ERROR;
+        }
+      } break;
+      case e_LENGTH: {
+        if (0 == (octet & k_LONG_FORM_BIT)) {
+            d_length = octet;
+            endHeader();
+        }
+        else if (k_INDEFINITE_LENGTH == octet) {
+            if (!d_isConstructed) {
+                d_state = e_ERROR;
+                break;
+            }
+            const int limit = d_frames.empty()
+                              ? INT_MAX
+                              : d_frames.back().d_limit;
+            if (d_position > limit) {
+                d_state = e_ERROR;
+                break;
+            }
+            pushFrame(limit, true);
+        }
+        else {
+            d_numOctetsLeft = octet & ~k_LONG_FORM_BIT;
+            d_length        = 0;
+            d_state         = d_numOctetsLeft <= k_MAX_LENGTH_OCTETS
+                              ? e_LENGTH_OCTETS
+                              : e_ERROR;
+        }
+      } break;
+      case e_LENGTH_OCTETS: {
+        if (d_length > (INT_MAX >> 8)) {
+            d_state = e_ERROR;
+            break;
+        }
+        d_length = (d_length << 8) | octet;
+        if (0 == --d_numOctetsLeft) {
+            endHeader();
+        }
+      } break;
+      default: {
+        BSLS_ASSERT(!"Unreachable by design");
+      }
+    }
+}
+
+void BerStreamingDecoder::pushFrame(int limit, bool indefinite)
+{
+    if (static_cast<int>(d_frames.size()) >= d_maxDepth) {
+        d_state = e_ERROR;
+        return;                                                       // RETURN
+    }
+
+    Frame frame;
+    frame.d_limit      = limit;
+    frame.d_indefinite = indefinite;
+    d_frames.push_back(frame);
+
+    d_state = e_IDENTIFIER;
+}
+
+void BerStreamingDecoder::scan()
+{
+    const int numDataBuffers = d_data.numDataBuffers();
+
+    while (e_COMPLETE != d_state
+        && e_ERROR    != d_state
+        && d_bufferIndex < numDataBuffers) {
+        const bool isLast = d_bufferIndex == numDataBuffers - 1;
+        const int  size   = isLast
+                          ? d_data.lastDataBufferLength()
+                          : d_data.buffer(d_bufferIndex).size();
+
+        if (d_bufferOffset == size) {
+            if (isLast) {
+                break;
+            }
+            ++d_bufferIndex;
+            d_bufferOffset = 0;
+            continue;
+        }
+
+        if (e_CONTENTS == d_state) {
+            // Skip as much of the contents as this buffer holds.
+
+            const int available = size - d_bufferOffset;
+            const int skipped   = d_contentsLeft < available
+                                  ? d_contentsLeft
+                                  : available;
+
+            d_bufferOffset += skipped;
+            d_position     += skipped;
+            d_contentsLeft -= skipped;
+            if (0 == d_contentsLeft) {
+                popCompletedFrames();
+            }
+            continue;
+        }
+
+        const char *data = d_data.buffer(d_bufferIndex).data();
+
+        const unsigned char octet =
+                          static_cast<unsigned char>(data[d_bufferOffset]);
+        ++d_bufferOffset;
+        ++d_position;
+        processOctet(octet);
+    }
+}
+
+// CREATORS
+BerStreamingDecoder::BerStreamingDecoder(bslma::Allocator *basicAllocator)
+: d_decoder(0, basicAllocator)
+, d_data(basicAllocator)
+, d_frames(basicAllocator)
+, d_maxDepth(BerDecoderOptions().maxDepth())
+, d_state(e_IDENTIFIER)
+, d_bufferIndex(0)
+, d_bufferOffset(0)
+, d_position(0)
+, d_numOctetsLeft(0)
+, d_length(0)
+, d_contentsLeft(0)
+, d_isConstructed(false)
+, d_isEndOfContents(false)
+{
+}
+
+BerStreamingDecoder::BerStreamingDecoder(
+                                      const BerDecoderOptions *options,
+                                      bslma::Allocator        *basicAllocator)
+: d_decoder(options, basicAllocator)
+, d_data(basicAllocator)
+, d_frames(basicAllocator)
+, d_maxDepth(options ? options->maxDepth() : BerDecoderOptions().maxDepth())
+, d_state(e_IDENTIFIER)
+, d_bufferIndex(0)
+, d_bufferOffset(0)
+, d_position(0)
+, d_numOctetsLeft(0)
+, d_length(0)
+, d_contentsLeft(0)
+, d_isConstructed(false)
+, d_isEndOfContents(false)
+{
+}
+
+// MANIPULATORS
+int BerStreamingDecoder::append(const bdlbb::Blob& data)
+{
+    if (e_ERROR == d_state || data.length() > INT_MAX - d_data.length()) {
+        d_state = e_ERROR;
+        return -1;                                                    // RETURN
+    }
+
+    bdlbb::BlobUtil::append(&d_data, data);
+
+    scan();
+    return e_ERROR == d_state ? -1 : 0;
+}
+
+int BerStreamingDecoder::append(const bdlbb::BlobBuffer& data)
+{
+    if (e_ERROR == d_state || data.size() > INT_MAX - d_data.length()) {
+        d_state = e_ERROR;
+        return -1;                                                    // RETURN
+    }
+
+    if (0 < data.size()) {
+        d_data.appendDataBuffer(data);
+    }
+
+    scan();
+    return e_ERROR == d_state ? -1 : 0;
+}
+
+void BerStreamingDecoder::reset()
+{
+    d_data.removeAll();
+    d_frames.clear();
+
+    d_state        = e_IDENTIFIER;
+    d_bufferIndex  = 0;
+    d_bufferOffset = 0;
+    d_position     = 0;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,405 @@
+// balber_berstreamingdecoder.h                                       -*-C++-*-
+#ifndef INCLUDED_BALBER_BERSTREAMINGDECODER
+#define INCLUDED_BALBER_BERSTREAMINGDECODER
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide a push-style BER decoder for incrementally arriving data.
+//
+//@CLASSES:
+//  balber::BerStreamingDecoder: incremental decoder of BER message streams
+//
+//@SEE_ALSO: balber_berdecoder, bdlbb_blob
+//
+//@DESCRIPTION: This component provides a class, 'balber::BerStreamingDecoder',
+// that decodes a stream of BER-encoded messages (each message being a single
+// top-level BER element) whose bytes arrive in arbitrary fragments, such as
+// the 'bdlbb::Blob' objects delivered by a network channel.  Each fragment is
+// pushed to the decoder with 'append' as it arrives.  The decoder tracks the
+// boundaries of the buffered messages, and as soon as a message is complete
+// ('hasMessage' returns 'true') it can be decoded into any type supported by
+// the 'bdlat' framework with the 'decode' method template.
+//
+// 'balber::BerDecoder' requires a complete message to be readable from a
+// 'bsl::streambuf', and reads it recursively to completion; it cannot be
+// suspended when the data runs out part way through a message.  A client that
+// receives a message in several fragments would therefore have to determine
+// for itself when the message is complete, typically by gathering the
+// fragments into one contiguous buffer, which costs a copy of every byte
+// received and delays the decoding of each message until that copy is made.
+//
+///Incremental Framing
+///-------------------
+// 'balber::BerStreamingDecoder' determines where each message ends using a
+// resumable state machine that inspects the identifier and length octets of
+// each BER element as they arrive, and that can be suspended at any byte
+// (including in the middle of a multi-octet tag number or length).  The
+// constructed elements that enclose the current position are recorded on an
+// explicit stack, rather than on the call stack, so that the state of the
+// framing survives between calls to 'append'.  Both the definite-length and
+// the indefinite-length (terminated by an end-of-contents element) forms of
+// constructed elements are supported, and the contents octets of primitive
+// elements are skipped without being examined.
+//
+// The framing rejects data that cannot be the encoding of a BER element: an
+// element that overruns the definite-length element enclosing it, an
+// end-of-contents element that does not terminate an indefinite-length
+// element, an indefinite-length primitive element, a tag number or length too
+// large to be represented by an 'int', and nesting deeper than the
+// 'maxDepth' attribute of the decoder options.  Once such data is seen, the
+// decoder is in an error state until 'reset' is called.
+//
+///Buffer Sharing
+///--------------
+// The fragments supplied to 'append' are never copied: the decoder holds a
+// 'bdlbb::Blob' that shares the blob buffers of each fragment (by sharing
+// ownership of the underlying memory, see 'bdlbb::BlobUtil::append'), and a
+// complete message is decoded in place by a 'balber::BerDecoder' reading
+// directly from those buffers (through a 'bdlbb::InBlobStreamBuf').  The
+// buffers of a message are released as soon as the message has been decoded.
+// Clients must therefore not modify the contents of a buffer after passing it
+// to 'append'.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Decoding Messages Received in Fragments
+/// - - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose that a network service receives a stream of BER-encoded requests,
+// and that the transport delivers the data in fragments whose boundaries are
+// unrelated to the boundaries of the requests.  The requests are of the type
+// 'balb::SimpleRequest', a 'bdlat' sequence type having a string 'data'
+// attribute and an integer 'responseLength' attribute.
+//
+// First, we encode two requests, one after the other, into a buffer that
+// stands in for the data sent by a peer:
+//..
+//  balb::SimpleRequest first;
+//  first.data()           = "hello, world";
+//  first.responseLength() = 12;
+//
+//  balb::SimpleRequest second;
+//  second.data()           = "goodbye";
+//  second.responseLength() = 7;
+//
+//  bdlsb::MemOutStreamBuf osb;
+//  balber::BerEncoder     encoder;
+//  assert(0 == encoder.encode(&osb, first));
+//  assert(0 == encoder.encode(&osb, second));
+//..
+// Then, we split the data into fragments of 5 bytes, each held in its own blob
+// buffer, as a channel might deliver them:
+//..
+//  bdlbb::SimpleBlobBufferFactory factory(5);
+//  bdlbb::Blob                    received(&factory);
+//  bdlbb::BlobUtil::append(&received,
+//                          osb.data(),
+//                          static_cast<int>(osb.length()));
+//..
+// Next, we create a streaming decoder and push the fragments to it one at a
+// time, decoding each request as soon as it is complete:
+//..
+//  balber::BerStreamingDecoder      decoder;
+//  bsl::vector<balb::SimpleRequest> requests;
+//
+//  for (int i = 0; i < received.numDataBuffers(); ++i) {
+//      bdlbb::BlobBuffer fragment = received.buffer(i);
+//      if (i == received.numDataBuffers() - 1) {
+//          fragment.setSize(received.lastDataBufferLength());
+//      }
+//
+//      int rc = decoder.append(fragment);
+//      assert(0 == rc);
+//
+//      while (decoder.hasMessage()) {
+//          requests.resize(requests.size() + 1);
+//
+//          rc = decoder.decode(&requests.back());
+//          assert(0 == rc);
+//      }
+//  }
+//..
+// Finally, we verify that both requests were decoded, and that no data
+// remains buffered:
+//..
+//  assert(2      == requests.size());
+//  assert(first  == requests[0]);
+//  assert(second == requests[1]);
+//  assert(0      == decoder.numBytesBuffered());
+//..
+
+#include <balscm_version.h>
+
+#include <balber_berdecoder.h>
+#include <balber_berdecoderoptions.h>
+
+#include <bdlbb_blob.h>
+#include <bdlbb_blobstreambuf.h>
+
+#include <bslma_allocator.h>
+#include <bslma_usesbslmaallocator.h>
+
+#include <bslmf_nestedtraitdeclaration.h>
+
+#include <bsls_assert.h>
+#include <bsls_review.h>
+
+#include <bsl_vector.h>
+
+namespace BloombergLP {
+namespace balber {
+
+                         // =========================
+                         // class BerStreamingDecoder
+                         // =========================
+
+class BerStreamingDecoder {
+    // This class provides a mechanism for decoding a stream of BER-encoded
+    // messages that is supplied incrementally, in fragments of any size, as
+    // 'bdlbb::Blob' or 'bdlbb::BlobBuffer' objects.  The supplied buffers are
+    // shared, not copied.  See {Incremental Framing}.
+
+    // PRIVATE TYPES
+    enum State {
+        e_IDENTIFIER,     // expecting the first identifier octet of an element
+        e_TAG_NUMBER,     // expecting a subsequent identifier octet
+        e_LENGTH,         // expecting the first length octet
+        e_LENGTH_OCTETS,  // expecting a subsequent length octet
+        e_CONTENTS,       // skipping the contents of a primitive element
+        e_COMPLETE,       // a complete message is buffered
+        e_ERROR           // the buffered data is not valid BER
+    };
+
+    struct Frame {
+        // This 'struct' describes a constructed element that encloses the
+        // current position of the framing.
+
+        int  d_limit;       // offset, from the start of the message, of the
+                            // end of the innermost enclosing element having
+                            // a definite length
+
+        bool d_indefinite;  // 'true' if the element has an indefinite length
+    };
+
+    // DATA
+    BerDecoder          d_decoder;         // decoder of complete messages
+    bdlbb::Blob         d_data;            // buffered data, starting at the
+                                           // first byte of the current
+                                           // message
+
+    bsl::vector<Frame>  d_frames;          // enclosing constructed elements
+    int                 d_maxDepth;        // maximum size of 'd_frames'
+    State               d_state;           // state of the framing
+    int                 d_bufferIndex;     // index, in 'd_data', of the
+                                           // buffer holding the next byte to
+                                           // be examined
+
+    int                 d_bufferOffset;    // offset of that byte within its
+                                           // buffer
+
+    int                 d_position;        // offset of that byte from the
+                                           // start of the message
+
+    int                 d_numOctetsLeft;   // remaining tag number or length
+                                           // octets of the current element
+
+    int                 d_length;          // length of the current element
+    int                 d_contentsLeft;    // remaining contents octets of
+                                           // the current primitive element
+
+    bool                d_isConstructed;   // 'true' if the current element
+                                           // is constructed
+
+    bool                d_isEndOfContents; // 'true' if the first identifier
+                                           // octet of the current element is
+                                           // 0
+
+    // NOT IMPLEMENTED
+    BerStreamingDecoder(const BerStreamingDecoder&);
+    BerStreamingDecoder& operator=(const BerStreamingDecoder&);
+
+    // PRIVATE MANIPULATORS
+    void consumeMessage();
+        // Discard the bytes of the complete message at the start of the
+        // buffered data, and examine the bytes that follow it.
+
+    void endHeader();
+        // Update the framing for the element whose identifier and length
+        // octets have just been read.
+
+    void popCompletedFrames();
+        // Remove from the stack of enclosing elements each definite-length
+        // element that ends at the current position, then enter the state
+        // expecting the next element, or the complete state if no enclosing
+        // element remains.
+
+    void processOctet(unsigned char octet);
+        // Update the framing for the specified identifier or length 'octet'.
+
+    void pushFrame(int limit, bool indefinite);
+        // Push onto the stack of enclosing elements a constructed element
+        // ending at the specified 'limit' (or enclosed in a definite-length
+        // element ending at 'limit' if the specified 'indefinite' is 'true'),
+        // or enter the error state if the maximum depth would be exceeded.
+
+    void scan();
+        // Examine the buffered bytes following the current position until a
+        // message is complete, an error is found, or the buffered data is
+        // exhausted.
+
+  public:
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(BerStreamingDecoder,
+                                   bslma::UsesBslmaAllocator);
+
+    // CREATORS
+    explicit BerStreamingDecoder(bslma::Allocator *basicAllocator = 0);
+    explicit BerStreamingDecoder(const BerDecoderOptions *options,
+                                 bslma::Allocator        *basicAllocator = 0);
+        // Create a streaming decoder having no buffered data.  Optionally
+        // specify decoder 'options' that are used to decode each message,
+        // and that determine the maximum nesting depth accepted by the
+        // framing.  If 'options' is 0 or not specified,
+        // 'BerDecoderOptions()' is used.  Optionally specify a
+        // 'basicAllocator' used to supply memory.  If 'basicAllocator' is 0,
+        // the currently installed default allocator is used.  The behavior is
+        // undefined unless 'options' (if not 0) remains valid for the
+        // lifetime of this object.
+
+    //! ~BerStreamingDecoder() = default;
+        // Destroy this object.
+
+    // MANIPULATORS
+    int append(const bdlbb::Blob& data);
+    int append(const bdlbb::BlobBuffer& data);
+        // Append the specified 'data' to the end of the buffered data, sharing
+        // (not copying) its buffers, and examine the appended bytes.  Return
+        // 0 on success, and a non-zero value if this decoder is in the error
+        // state after the call, in which case 'reset' must be called before
+        // this decoder can frame data again.  'data' is not buffered if this
+        // decoder was in the error state before the call, or if the number of
+        // buffered bytes would exceed 'INT_MAX'; otherwise, 'data' is
+        // buffered even if examining it enters the error state.  Note that
+        // 'hasMessage' may return 'true' after this call.
+
+    template <class TYPE>
+    int decode(TYPE *object);
+        // Decode the complete message at the start of the buffered data into
+        // the specified 'object' of the (template parameter) 'TYPE', then
+        // discard the bytes of the message and examine the buffered bytes
+        // that follow it.  Return 0 on success, and a non-zero value (with
+        // the value of 'object' unspecified) otherwise.  The behavior is
+        // undefined unless 'hasMessage()' is 'true'.  Note that 'hasMessage'
+        // may be 'true' again after this call.
+
+    void reset();
+        // Discard all buffered data and leave the error state, if this
+        // decoder is in it.
+
+    // ACCESSORS
+    bool hasError() const;
+        // Return 'true' if the buffered data is not the encoding of a
+        // sequence of BER elements, and 'false' otherwise.
+
+    bool hasMessage() const;
+        // Return 'true' if a complete message is buffered, and 'false'
+        // otherwise.
+
+    bslstl::StringRef loggedMessages() const;
+        // Return a string containing any error or trace messages that were
+        // logged during the last call to 'decode'.
+
+    int messageLength() const;
+        // Return the number of bytes of the complete message at the start of
+        // the buffered data.  The behavior is undefined unless
+        // 'hasMessage()' is 'true'.
+
+    int numBytesBuffered() const;
+        // Return the number of bytes buffered by this decoder, including
+        // those of any complete message not yet decoded.
+};
+
+// ============================================================================
+//                        INLINE FUNCTION DEFINITIONS
+// ============================================================================
+
+                         // -------------------------
+                         // class BerStreamingDecoder
+                         // -------------------------
+
+// MANIPULATORS
+template <class TYPE>
+int BerStreamingDecoder::decode(TYPE *object)
+{
+    BSLS_ASSERT(object);
+    BSLS_ASSERT(hasMessage());
+
+    // 'BerDecoder' reads exactly one element, so it can read the message
+    // directly from the buffered data without the data being trimmed first.
+
+    int rc;
+    {
+        bdlbb::InBlobStreamBuf streamBuf(&d_data);
+
+        rc = d_decoder.decode(&streamBuf, object);
+    }
+
+    consumeMessage();
+    return rc;
+}
+
+// ACCESSORS
+inline
+bool BerStreamingDecoder::hasError() const
+{
+    return e_ERROR == d_state;
+}
+
+inline
+bool BerStreamingDecoder::hasMessage() const
+{
+    return e_COMPLETE == d_state;
+}
+
+inline
+bslstl::StringRef BerStreamingDecoder::loggedMessages() const
+{
+    return d_decoder.loggedMessages();
+}
+
+inline
+int BerStreamingDecoder::messageLength() const
+{
+    BSLS_ASSERT(hasMessage());
+
+    return d_position;
+}
+
+inline
+int BerStreamingDecoder::numBytesBuffered() const
+{
+    return d_data.length();
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
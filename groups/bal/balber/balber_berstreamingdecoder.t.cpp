@@ -0,0 +1,855 @@
+// balber_berstreamingdecoder.t.cpp                                   -*-C++-*-
+#include <balber_berstreamingdecoder.h>
+
+#include <balber_berdecoderoptions.h>
+#include <balber_berencoder.h>
+
+#include <balb_testmessages.h>
+
+#include <bdlbb_blob.h>
+#include <bdlbb_blobutil.h>
+#include <bdlbb_simpleblobbufferfactory.h>
+
+#include <bdlsb_memoutstreambuf.h>
+
+#include <bslim_testutil.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+
+#include <bsls_asserttest.h>
+#include <bsls_review.h>
+
+#include <bsl_algorithm.h>
+#include <bsl_cstdlib.h>
+#include <bsl_cstring.h>
+#include <bsl_iostream.h>
+#include <bsl_memory.h>
+#include <bsl_string.h>
+#include <bsl_vector.h>
+
+using namespace BloombergLP;
+using namespace bsl;
+
+// ============================================================================
+//                             TEST PLAN
+// ----------------------------------------------------------------------------
+//                              Overview
+//                              --------
+// The component under test is a mechanism that finds the boundaries of BER
+// messages in incrementally supplied data, and decodes each complete message
+// with 'balber::BerDecoder'.  The framing is verified against a table of
+// valid, incomplete, and invalid encodings, each supplied in fragments of
+// every size, so that the state machine is suspended at every byte.  The
+// decoding is verified by round-tripping streams of encoded messages supplied
+// in fragments of various sizes.
+// ----------------------------------------------------------------------------
+// CREATORS
+// [2] BerStreamingDecoder(bslma::Allocator *basicAllocator = 0);
+// [4] BerStreamingDecoder(const BerDecoderOptions *, bslma::Allocator * = 0);
+//
+// MANIPULATORS
+// [2] int append(const bdlbb::Blob& data);
+// [2] int append(const bdlbb::BlobBuffer& data);
+// [3] int decode(TYPE *object);
+// [4] void reset();
+//
+// ACCESSORS
+// [2] bool hasError() const;
+// [2] bool hasMessage() const;
+// [3] bslstl::StringRef loggedMessages() const;
+// [2] int messageLength() const;
+// [2] int numBytesBuffered() const;
+// ----------------------------------------------------------------------------
+// [1] BREATHING TEST
+// [5] USAGE EXAMPLE
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLIM_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLIM_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLIM_TESTUTIL_LOOP6_ASSERT
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_SAFE_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_PASS(EXPR)
+#define ASSERT_SAFE_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_FAIL(EXPR)
+#define ASSERT_PASS(EXPR)      BSLS_ASSERTTEST_ASSERT_PASS(EXPR)
+#define ASSERT_FAIL(EXPR)      BSLS_ASSERTTEST_ASSERT_FAIL(EXPR)
+#define ASSERT_OPT_PASS(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_PASS(EXPR)
+#define ASSERT_OPT_FAIL(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_FAIL(EXPR)
+
+// ============================================================================
+//                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef balber::BerStreamingDecoder Obj;
+
+enum {
+    k_INCOMPLETE = 0,   // the data is a proper prefix of a message
+    k_ERROR      = -1   // the data is not a prefix of a message
+};
+
+// ============================================================================
+//                  GLOBAL HELPER FUNCTIONS FOR TESTING
+// ----------------------------------------------------------------------------
+
+static
+void loadHex(bsl::string *result, const char *hex)
+    // Load into the specified 'result' the bytes whose values are given, as
+    // pairs of hexadecimal digits optionally separated by spaces, in the
+    // specified 'hex'.
+{
+    result->clear();
+
+    int value  = 0;
+    int digits = 0;
+    for (; *hex; ++hex) {
+        const char c = *hex;
+        if (' ' == c) {
+            continue;
+        }
+        value = value * 16 + ('a' <= c ? c - 'a' + 10 : c - '0');
+        if (2 == ++digits) {
+            result->push_back(static_cast<char>(value));
+            value  = 0;
+            digits = 0;
+        }
+    }
+}
+
+static
+bdlbb::BlobBuffer makeBuffer(const char       *data,
+                             int               length,
+                             bslma::Allocator *allocator)
+    // Return a blob buffer holding a copy of the specified 'length' bytes at
+    // the specified 'data', using the specified 'allocator' to supply memory.
+{
+    bsl::shared_ptr<char> buffer(
+                   static_cast<char *>(allocator->allocate(length)),
+                   allocator);
+    bsl::memcpy(buffer.get(), data, length);
+
+    return bdlbb::BlobBuffer(buffer, length);
+}
+
+static
+void makeRequest(balb::SimpleRequest *result, int seed)
+    // Load into the specified 'result' a request whose value is determined by
+    // the specified 'seed'.  Request data lengths vary from 0 to 299 bytes, so
+    // that both short and long-form lengths are encoded.
+{
+    result->data().assign(static_cast<bsl::size_t>((seed * 37) % 300),
+                          static_cast<char>('a' + seed % 26));
+    result->responseLength() = seed * 1001 - 50000;
+}
+
+// ============================================================================
+//                               MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int  test            = argc > 1 ? bsl::atoi(argv[1]) : 0;
+    bool verbose         = argc > 2;
+    bool veryVerbose     = argc > 3;
+
+    // CONCERN: 'BSLS_REVIEW' failures should lead to test failures.
+    bsls::ReviewFailureHandlerGuard reviewGuard(&bsls::Review::failByAbort);
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+    switch (test)  { case 0:
+      case 5: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "USAGE EXAMPLE" << endl
+                          << "=============" << endl;
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Decoding Messages Received in Fragments
+/// - - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose that a network service receives a stream of BER-encoded requests,
+// and that the transport delivers the data in fragments whose boundaries are
+// unrelated to the boundaries of the requests.  The requests are of the type
+// 'balb::SimpleRequest', a 'bdlat' sequence type having a string 'data'
+// attribute and an integer 'responseLength' attribute.
+//
+// First, we encode two requests, one after the other, into a buffer that
+// stands in for the data sent by a peer:
+//..
+    balb::SimpleRequest first;
+    first.data()           = "hello, world";
+    first.responseLength() = 12;
+
+    balb::SimpleRequest second;
+    second.data()           = "goodbye";
+    second.responseLength() = 7;
+
+    bdlsb::MemOutStreamBuf osb;
+    balber::BerEncoder     encoder;
+    ASSERT(0 == encoder.encode(&osb, first));
+    ASSERT(0 == encoder.encode(&osb, second));
+//..
+// Then, we split the data into fragments of 5 bytes, each held in its own blob
+// buffer, as a channel might deliver them:
+//..
+    bdlbb::SimpleBlobBufferFactory factory(5);
+    bdlbb::Blob                    received(&factory);
+    bdlbb::BlobUtil::append(&received,
+                            osb.data(),
+                            static_cast<int>(osb.length()));
+//..
+// Next, we create a streaming decoder and push the fragments to it one at a
+// time, decoding each request as soon as it is complete:
+//..
+    balber::BerStreamingDecoder      decoder;
+    bsl::vector<balb::SimpleRequest> requests;
+
+    for (int i = 0; i < received.numDataBuffers(); ++i) {
+        bdlbb::BlobBuffer fragment = received.buffer(i);
+        if (i == received.numDataBuffers() - 1) {
+            fragment.setSize(received.lastDataBufferLength());
+        }
+
+        int rc = decoder.append(fragment);
+        ASSERT(0 == rc);
+
+        while (decoder.hasMessage()) {
+            requests.resize(requests.size() + 1);
+
+            rc = decoder.decode(&requests.back());
+            ASSERT(0 == rc);
+        }
+    }
+//..
+// Finally, we verify that both requests were decoded, and that no data
+// remains buffered:
+//..
+    ASSERT(2      == requests.size());
+    ASSERT(first  == requests[0]);
+    ASSERT(second == requests[1]);
+    ASSERT(0      == decoder.numBytesBuffered());
+//..
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // OPTIONS, ERROR STATE, AND 'reset'
+        //
+        // Concerns:
+        //: 1 The framing accepts nesting up to, and rejects nesting beyond,
+        //:   the 'maxDepth' of the supplied options.
+        //:
+        //: 2 The data whose examination enters the error state is buffered,
+        //:   and, once in the error state, 'append' fails without buffering
+        //:   data.
+        //:
+        //: 3 'reset' discards buffered data, including a partial or complete
+        //:   message, and leaves the error state.
+        //
+        // Plan:
+        //: 1 Supply nested encodings of increasing depth to decoders created
+        //:   with various 'maxDepth' values.  (C-1)
+        //:
+        //: 2 Supply invalid data, then valid data, and verify the results;
+        //:   call 'reset' and verify that valid data is then framed and
+        //:   decoded.  (C-2..3)
+        //
+        // Testing:
+        //   BerStreamingDecoder(const BerDecoderOptions *, bslma::Allocator*);
+        //   void reset();
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "OPTIONS, ERROR STATE, AND 'reset'" << endl
+                          << "=================================" << endl;
+
+        bslma::TestAllocator ta("test", veryVerbose);
+
+        if (verbose) cout << "\nTesting 'maxDepth'." << endl;
+
+        for (int maxDepth = 1; maxDepth <= 5; ++maxDepth) {
+            balber::BerDecoderOptions options;
+            options.setMaxDepth(maxDepth);
+
+            for (int depth = 1; depth <= 6; ++depth) {
+                for (int indefinite = 0; indefinite < 2; ++indefinite) {
+                    // Nest 'depth' empty constructed elements.
+
+                    bsl::string data(&ta);
+                    for (int i = 0; i < depth; ++i) {
+                        bsl::string element(&ta);
+                        element.push_back(0x30);
+                        if (indefinite) {
+                            element.push_back(static_cast<char>(0x80));
+                            element += data;
+                            element.append(2, '\0');
+                        }
+                        else {
+                            element.push_back(
+                                            static_cast<char>(data.size()));
+                            element += data;
+                        }
+                        data.swap(element);
+                    }
+
+                    Obj mX(&options, &ta);  const Obj& X = mX;
+
+                    const int rc = mX.append(
+                                 makeBuffer(data.data(),
+                                            static_cast<int>(data.size()),
+                                            &ta));
+
+                    const bool VALID = depth <= maxDepth;
+
+                    ASSERTV(maxDepth, depth, indefinite, VALID == (0 == rc));
+                    ASSERTV(maxDepth, depth, indefinite,
+                            VALID == X.hasMessage());
+                    ASSERTV(maxDepth, depth, indefinite,
+                            VALID != X.hasError());
+                }
+            }
+        }
+
+        if (verbose) cout << "\nTesting the error state and 'reset'." << endl;
+        {
+            Obj mX(&ta);  const Obj& X = mX;
+
+            bsl::string valid(&ta), invalid(&ta), partial(&ta);
+            loadHex(&valid,   "30 80 80 02 61 62 81 01 05 00 00");
+            loadHex(&invalid, "00 00");
+            loadHex(&partial, "30 80 80 02");
+
+            ASSERT(0 == mX.append(makeBuffer(partial.data(), 4, &ta)));
+            ASSERT(4 == X.numBytesBuffered());
+
+            mX.reset();
+            ASSERT(0 == X.numBytesBuffered());
+            ASSERT(!X.hasError());
+            ASSERT(!X.hasMessage());
+
+            ASSERT(0 != mX.append(makeBuffer(invalid.data(), 2, &ta)));
+            ASSERT(X.hasError());
+            ASSERT(2 == X.numBytesBuffered());
+            ASSERT(0 != mX.append(makeBuffer(valid.data(), 11, &ta)));
+            ASSERT(X.hasError());
+            ASSERT(2 == X.numBytesBuffered());
+            ASSERT(!X.hasMessage());
+
+            mX.reset();
+            ASSERT(!X.hasError());
+            ASSERT(0 == X.numBytesBuffered());
+
+            ASSERT(0 == mX.append(makeBuffer(valid.data(), 11, &ta)));
+            ASSERT(X.hasMessage());
+
+            mX.reset();
+            ASSERT(!X.hasMessage());
+            ASSERT(0 == X.numBytesBuffered());
+
+            ASSERT(0 == mX.append(makeBuffer(valid.data(), 11, &ta)));
+            ASSERT(X.hasMessage());
+
+            balb::SimpleRequest request;
+            ASSERT(0    == mX.decode(&request));
+            ASSERT("ab" == request.data());
+            ASSERT(5    == request.responseLength());
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // DECODING MESSAGES
+        //
+        // Concerns:
+        //: 1 Each complete message is decoded into the supplied object, and
+        //:   its bytes are discarded.
+        //:
+        //: 2 Messages are found and decoded regardless of how the stream is
+        //:   fragmented, including several messages within one fragment.
+        //:
+        //: 3 A message that cannot be decoded into the supplied object is
+        //:   reported as a failure of 'decode', and does not affect the
+        //:   decoding of the following messages.
+        //:
+        //: 4 The supplied buffers are shared, not copied.
+        //:
+        //: 5 All memory is supplied by the specified allocator.
+        //
+        // Plan:
+        //: 1 Encode a sequence of requests, split the encoding into fragments
+        //:   of several fixed sizes and of pseudo-random sizes, supply the
+        //:   fragments, and decode each message as it becomes complete.
+        //:   Verify that the decoded requests have the encoded values.
+        //:   (C-1..2)
+        //:
+        //: 2 Insert the encoding of an 'int' between two requests, and
+        //:   decode every message as a request.  (C-3)
+        //:
+        //: 3 Verify that the reference count of an appended buffer is
+        //:   incremented.  (C-4)
+        //:
+        //: 4 Use a test allocator as the default allocator and verify that no
+        //:   memory is allocated from it.  (C-5)
+        //
+        // Testing:
+        //   int decode(TYPE *object);
+        //   bslstl::StringRef loggedMessages() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "DECODING MESSAGES" << endl
+                          << "=================" << endl;
+
+        bslma::TestAllocator         da("default", veryVerbose);
+        bslma::DefaultAllocatorGuard dag(&da);
+        bslma::TestAllocator         ta("test", veryVerbose);
+
+        enum { k_NUM_REQUESTS = 40 };
+
+        bsl::vector<balb::SimpleRequest> expected(&ta);
+        bdlsb::MemOutStreamBuf           osb(&ta);
+        {
+            balber::BerEncoder encoder(0, &ta);
+            for (int i = 0; i < k_NUM_REQUESTS; ++i) {
+                balb::SimpleRequest request(&ta);
+                makeRequest(&request, i);
+                ASSERTV(i, 0 == encoder.encode(&osb, request));
+                expected.push_back(request);
+            }
+        }
+        const int LENGTH = static_cast<int>(osb.length());
+
+        static const int SIZES[] = { 1, 2, 3, 7, 64, 1000, 100000, 0 };
+        const int        NUM_SIZES = static_cast<int>(sizeof SIZES
+                                                      / sizeof *SIZES);
+
+        for (int ti = 0; ti < NUM_SIZES; ++ti) {
+            const int SIZE = SIZES[ti];  // 0 for pseudo-random sizes
+
+            if (veryVerbose) { T_ P(SIZE) }
+
+            Obj mX(&ta);  const Obj& X = mX;
+
+            int numDecoded = 0;
+            int offset     = 0;
+            int seed       = 12345;
+            while (offset < LENGTH) {
+                int size = SIZE;
+                if (0 == size) {
+                    seed = seed * 1103515245 + 12345;
+                    size = 1 + ((seed >> 8) & 0x3FF) % 200;
+                }
+                if (size > LENGTH - offset) {
+                    size = LENGTH - offset;
+                }
+
+                // Alternate between the two 'append' overloads.
+
+                int rc;
+                if (offset % 2) {
+                    rc = mX.append(makeBuffer(osb.data() + offset,
+                                              size,
+                                              &ta));
+                }
+                else {
+                    bdlbb::SimpleBlobBufferFactory factory(1 + offset % 7,
+                                                           &ta);
+                    bdlbb::Blob fragment(&factory, &ta);
+                    bdlbb::BlobUtil::append(&fragment,
+                                            osb.data() + offset,
+                                            size);
+                    rc = mX.append(fragment);
+                }
+                ASSERTV(SIZE, offset, 0 == rc);
+                offset += size;
+
+                while (X.hasMessage()) {
+                    balb::SimpleRequest request(&ta);
+
+                    rc = mX.decode(&request);
+                    ASSERTV(SIZE, numDecoded, X.loggedMessages(), 0 == rc);
+                    ASSERTV(SIZE, numDecoded, numDecoded < k_NUM_REQUESTS);
+                    if (numDecoded < k_NUM_REQUESTS) {
+                        ASSERTV(SIZE, numDecoded,
+                                expected[numDecoded] == request);
+                    }
+                    ++numDecoded;
+                }
+            }
+            ASSERTV(SIZE, numDecoded, k_NUM_REQUESTS == numDecoded);
+            ASSERTV(SIZE, 0 == X.numBytesBuffered());
+            ASSERTV(SIZE, !X.hasError());
+        }
+
+        if (verbose) cout << "\nTesting a message of the wrong type." << endl;
+        {
+            bsl::string data(&ta);
+            loadHex(&data, "30 80 80 02 61 62 81 01 05 00 00"
+                           "02 01 07"
+                           "30 80 80 01 63 81 01 06 00 00");
+
+            Obj mX(&ta);  const Obj& X = mX;
+
+            ASSERT(0 == mX.append(makeBuffer(data.data(),
+                                             static_cast<int>(data.size()),
+                                             &ta)));
+
+            balb::SimpleRequest request(&ta);
+
+            ASSERT(X.hasMessage());
+            ASSERT(11   == X.messageLength());
+            ASSERT(0    == mX.decode(&request));
+            ASSERT("ab" == request.data());
+
+            ASSERT(X.hasMessage());
+            ASSERT(3    == X.messageLength());
+            ASSERT(0    != mX.decode(&request));
+
+            ASSERT(X.hasMessage());
+            ASSERT(10   == X.messageLength());
+            ASSERT(0    == mX.decode(&request));
+            ASSERT("c"  == request.data());
+            ASSERT(6    == request.responseLength());
+
+            ASSERT(!X.hasMessage());
+            ASSERT(0    == X.numBytesBuffered());
+        }
+
+        if (verbose) cout << "\nTesting buffer sharing." << endl;
+        {
+            const char        DATA[] = { 0x02, 0x01, 0x07 };
+            bdlbb::BlobBuffer buffer = makeBuffer(DATA, 3, &ta);
+
+            const long count = buffer.buffer().use_count();
+
+            Obj mX(&ta);  const Obj& X = mX;
+
+            ASSERT(0 == mX.append(buffer));
+            ASSERT(count + 1 == buffer.buffer().use_count());
+
+            int value = 0;
+            ASSERT(0 == mX.decode(&value));
+            ASSERT(7 == value);
+            ASSERT(count == buffer.buffer().use_count());
+            ASSERT(0 == X.numBytesBuffered());
+        }
+
+        ASSERT(0 == da.numBlocksTotal());
+
+        if (verbose) cout << "\nNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            Obj mX(&ta);
+
+            int value;
+            ASSERT_FAIL(mX.decode(&value));
+        }
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // FRAMING
+        //
+        // Concerns:
+        //: 1 A message is reported as complete exactly when its last byte has
+        //:   been supplied, and its length is reported correctly.
+        //:
+        //: 2 The framing handles short and long-form lengths, multi-octet tag
+        //:   numbers, definite and indefinite-length constructed elements,
+        //:   and any nesting of these.
+        //:
+        //: 3 The framing can be suspended at any byte.
+        //:
+        //: 4 Invalid encodings are rejected as soon as they can be
+        //:   distinguished from valid ones, and bytes following a complete
+        //:   message are not examined until the message is decoded.
+        //
+        // Plan:
+        //: 1 For each encoding in a table of valid, incomplete, and invalid
+        //:   encodings, supply the encoding in fragments of every size from 1
+        //:   to the length of the encoding, and verify the state of the
+        //:   decoder after each fragment.  (C-1..4)
+        //
+        // Testing:
+        //   BerStreamingDecoder(bslma::Allocator *basicAllocator = 0);
+        //   int append(const bdlbb::Blob& data);
+        //   int append(const bdlbb::BlobBuffer& data);
+        //   bool hasError() const;
+        //   bool hasMessage() const;
+        //   int messageLength() const;
+        //   int numBytesBuffered() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "FRAMING" << endl
+                          << "=======" << endl;
+
+        static const struct {
+            int         d_line;
+            const char *d_hex;
+            int         d_expected;  // message length, 'k_INCOMPLETE', or
+                                     // 'k_ERROR'
+        } DATA[] = {
+            //LINE  ENCODING                               EXPECTED
+            //----  -------------------------------------  ------------
+            { L_,   "02 01 07",                            3            },
+            { L_,   "05 00",                               2            },
+            { L_,   "30 00",                               2            },
+            { L_,   "30 03 02 01 07",                      5            },
+            { L_,   "30 80 00 00",                         4            },
+            { L_,   "30 80 02 01 07 00 00",                7            },
+            { L_,   "30 80 30 80 00 00 00 00",             8            },
+            { L_,   "30 04 30 80 00 00",                   6            },
+            { L_,   "30 07 30 03 02 01 07 05 00",          9            },
+            { L_,   "30 80 30 03 02 01 07 00 00",          9            },
+            { L_,   "30 08 30 80 30 00 00 00 05 00",       10           },
+            { L_,   "04 81 03 61 62 63",                   6            },
+            { L_,   "04 82 00 02 61 62",                   6            },
+            { L_,   "04 84 00 00 00 01 61",                7            },
+            { L_,   "9f 81 00 01 2a",                      5            },
+            { L_,   "bf 1f 00",                            3            },
+            { L_,   "9f 81 81 81 81 01 00",                7            },
+            { L_,   "30 81 04 9f 20 01 2a",                7            },
+            { L_,   "02 01 07 02 01 08",                   3            },
+            { L_,   "02 01 07 00 00",                      3            },
+            { L_,   "30 80 00 00 30 80",                   4            },
+
+            { L_,   "30",                                  k_INCOMPLETE },
+            { L_,   "9f 81 81",                            k_INCOMPLETE },
+            { L_,   "04 82 01",                            k_INCOMPLETE },
+            { L_,   "04 05 61",                            k_INCOMPLETE },
+            { L_,   "30 80 02 01 07",                      k_INCOMPLETE },
+            { L_,   "30 80 30 80 00 00",                   k_INCOMPLETE },
+            { L_,   "30 05 30 80 00 00",                   k_INCOMPLETE },
+
+            { L_,   "00 00",                               k_ERROR      },
+            { L_,   "30 03 00 00 00",                      k_ERROR      },
+            { L_,   "30 80 00 01 00",                      k_ERROR      },
+            { L_,   "04 80",                               k_ERROR      },
+            { L_,   "30 02 02 01 07",                      k_ERROR      },
+            { L_,   "30 03 30 80 00 00",                   k_ERROR      },
+            { L_,   "30 03 30 03 02 01 07",                k_ERROR      },
+            { L_,   "30 01 30 80",                         k_ERROR      },
+            { L_,   "30 02 04 81 01",                      k_ERROR      },
+            { L_,   "04 85 00 00 00 00 01",                k_ERROR      },
+            { L_,   "04 ff",                               k_ERROR      },
+            { L_,   "04 84 80 00 00 00",                   k_ERROR      },
+            { L_,   "9f 81 81 81 81 81 01",                k_ERROR      },
+        };
+        const int NUM_DATA = static_cast<int>(sizeof DATA / sizeof *DATA);
+
+        bslma::TestAllocator ta("test", veryVerbose);
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int   LINE     = DATA[ti].d_line;
+            const int   EXPECTED = DATA[ti].d_expected;
+
+            bsl::string data(&ta);
+            loadHex(&data, DATA[ti].d_hex);
+
+            const int LENGTH = static_cast<int>(data.size());
+
+            if (veryVerbose) { T_ P_(LINE) P(DATA[ti].d_hex) }
+
+            for (int size = 1; size <= LENGTH; ++size) {
+                Obj mX(&ta);  const Obj& X = mX;
+
+                int  offset     = 0;
+                bool errorFound = false;
+                while (offset < LENGTH) {
+                    const int n = bsl::min(size, LENGTH - offset);
+
+                    const int rc = mX.append(makeBuffer(data.data() + offset,
+                                                        n, &ta));
+                    offset += n;
+
+                    if (k_ERROR == EXPECTED) {
+                        errorFound = errorFound || 0 != rc;
+                        ASSERTV(LINE, size, offset,
+                                errorFound == X.hasError());
+                        continue;
+                    }
+
+                    ASSERTV(LINE, size, offset, 0 == rc);
+                    ASSERTV(LINE, size, offset, !X.hasError());
+                    ASSERTV(LINE, size, offset, X.numBytesBuffered(),
+                            offset == X.numBytesBuffered());
+
+                    const bool complete = k_INCOMPLETE != EXPECTED
+                                       && offset >= EXPECTED;
+
+                    ASSERTV(LINE, size, offset,
+                            complete == X.hasMessage());
+                    if (X.hasMessage()) {
+                        ASSERTV(LINE, size, X.messageLength(),
+                                EXPECTED == X.messageLength());
+                    }
+                }
+
+                if (k_ERROR == EXPECTED) {
+                    ASSERTV(LINE, size, errorFound);
+                    ASSERTV(LINE, size, X.hasError());
+                    ASSERTV(LINE, size, !X.hasMessage());
+                }
+            }
+
+            // Supply the whole encoding as a single blob having buffers of
+            // every size.
+
+            for (int size = 1; size <= LENGTH; ++size) {
+                bdlbb::SimpleBlobBufferFactory factory(size, &ta);
+                bdlbb::Blob                    blob(&factory, &ta);
+                bdlbb::BlobUtil::append(&blob, data.data(), LENGTH);
+
+                Obj mX(&ta);  const Obj& X = mX;
+
+                const int rc = mX.append(blob);
+
+                ASSERTV(LINE, size, (k_ERROR == EXPECTED) == (0 != rc));
+                ASSERTV(LINE, size, (k_ERROR == EXPECTED) == X.hasError());
+                ASSERTV(LINE, size, (0 < EXPECTED) == X.hasMessage());
+                if (0 < EXPECTED) {
+                    ASSERTV(LINE, size, EXPECTED == X.messageLength());
+                }
+            }
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Supply an encoded request in two fragments and decode it.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        balb::SimpleRequest request;
+        request.data()           = "breathing";
+        request.responseLength() = 42;
+
+        bdlsb::MemOutStreamBuf osb;
+        balber::BerEncoder     encoder;
+        ASSERT(0 == encoder.encode(&osb, request));
+
+        const int LENGTH = static_cast<int>(osb.length());
+
+        bslma::Allocator *da = bslma::Default::defaultAllocator();
+
+        Obj mX;  const Obj& X = mX;
+
+        ASSERT(!X.hasMessage());
+        ASSERT(0 == mX.append(makeBuffer(osb.data(), 4, da)));
+        ASSERT(!X.hasMessage());
+        ASSERT(4 == X.numBytesBuffered());
+
+        ASSERT(0 == mX.append(makeBuffer(osb.data() + 4,
+                                         LENGTH - 4,
+                                         da)));
+        ASSERT(X.hasMessage());
+        ASSERT(LENGTH == X.messageLength());
+
+        balb::SimpleRequest result;
+        ASSERT(0 == mX.decode(&result));
+        ASSERT(request == result);
+        ASSERT(!X.hasMessage());
+        ASSERT(0 == X.numBytesBuffered());
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      } break;
+    }
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
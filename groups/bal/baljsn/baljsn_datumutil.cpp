@@ -4,24 +4,50 @@
 #include <bsls_ident.h>
 BSLS_IDENT("$Id$ $CSID$")
 
+#include <baljsn_encoderoptions.h>
+#include <baljsn_encodingstyle.h>
+#include <baljsn_printutil.h>
 #include <baljsn_simpleformatter.h>
 #include <baljsn_tokenizer.h>
 
+#include <bdlb_bitutil.h>
 #include <bdlb_chartype.h>
+#include <bdlb_float.h>
+#include <bdlb_numericformatutil.h>
 #include <bdlb_numericparseutil.h>
+#include <bdlbb_blob.h>
+#include <bdlbb_blobutil.h>
 #include <bdld_datum.h>
 #include <bdld_datumarraybuilder.h>
 #include <bdld_datummapowningkeysbuilder.h>
 #include <bdld_manageddatum.h>
 #include <bdlde_utf8util.h>
 #include <bdlma_bufferedsequentialallocator.h>
+#include <bdlsb_fixedmemoutstreambuf.h>
 #include <bdlsb_memoutstreambuf.h>
 
+#include <bsl_algorithm.h>
+#include <bsl_climits.h>
+#include <bsl_cstdint.h>
+#include <bsl_cstring.h>
 #include <bsl_iostream.h>
 #include <bsl_ostream.h>
 #include <bsl_string.h>
 #include <bsl_unordered_set.h>
+#include <bsl_utility.h>
+#include <bsl_vector.h>
+#include <bslma_allocator.h>
 #include <bsls_alignedbuffer.h>
+#include <bsls_assert.h>
+#include <bsls_platform.h>
+
+// SSE2 instructions, used to find the characters to escape in strings, are
+// supported by all x86-64 CPUs.
+
+#if defined(BSLS_PLATFORM_CPU_X86_64)
+#define BALJSN_DATUMUTIL_SSE2 1
+#include <emmintrin.h>
+#endif
 
 namespace BloombergLP {
 namespace baljsn {
@@ -477,6 +503,1178 @@ static int encodeValue(SimpleFormatter    *formatter,
     return result;
 }
 
+                             // ==================
+                             // class BufferParser
+                             // ==================
+
+class BufferParser {
+    // This class implements a recursive-descent parser of the JSON text in a
+    // contiguous buffer, creating 'bdld::Datum' objects directly from the
+    // characters in the buffer.  The elements of the arrays and objects being
+    // parsed are accumulated on a stack shared by all levels of nesting, so
+    // that each array and map can be allocated, with its exact size, when its
+    // closing bracket is reached.  Elements still on the stack when a parser
+    // is destroyed (i.e., when parsing fails) are destroyed.
+
+    // PRIVATE TYPES
+    typedef bsl::unordered_set<bslstl::StringRef> KeySet;
+
+    enum {
+        k_MAX_LINEAR_KEY_SEARCH = 16  // maximum number of members of an
+                                      // object searched linearly for
+                                      // duplicate keys
+    };
+
+    // DATA
+    const char                       *d_begin_p;     // start of input
+    const char                       *d_cursor_p;    // current position
+    const char                       *d_end_p;       // end of input
+    bool                              d_referenceStrings;
+                                                     // reference strings and
+                                                     // keys in the input
+    bsl::ostream                     *d_errorStream_p;
+                                                     // error stream (held,
+                                                     // not owned)
+    bsl::vector<bdld::DatumMapEntry>  d_stack;       // pending elements
+    bsl::string                       d_string;      // unescaped string
+    bslma::Allocator                 *d_allocator_p; // datum allocator (held,
+                                                     // not owned)
+
+    // PRIVATE MANIPULATORS
+    int error(const char *message);
+        // Write the specified 'message', and the offset of the current
+        // position in the input, to the error stream, if any.  Return a
+        // negative value.
+
+    int parseArray(bdld::Datum *result);
+        // Load into the specified 'result' the array starting at the current
+        // position, which is a '['.  Return 0 on success, and a negative
+        // value otherwise.
+
+    int parseObject(bdld::Datum *result);
+        // Load into the specified 'result' the map for the object starting at
+        // the current position, which is a '{'.  Return 0 on success, and a
+        // negative value otherwise.
+
+    int parseScalar(bdld::Datum *result);
+        // Load into the specified 'result' the number, 'bool', or 'null'
+        // value starting at the current position.  Return 0 on success, and a
+        // negative value otherwise.
+
+    int parseString(bdld::Datum *result);
+        // Load into the specified 'result' the string starting at the current
+        // position, which is a '"'.  Return 0 on success, and a negative
+        // value otherwise.
+
+    int scanString(bslstl::StringRef *contents, bool *isPlain);
+        // Load into the specified 'contents' the characters between the quote
+        // at the current position and the matching closing quote, and advance
+        // past the closing quote.  Load into the specified 'isPlain' 'false'
+        // if 'contents' contains escape sequences or control characters, and
+        // 'true' otherwise.  Return 0 on success, and a negative value if the
+        // string is not terminated.
+
+    void skipWhitespace();
+        // Advance the current position past any whitespace.
+
+  public:
+    // CREATORS
+    BufferParser(const bslstl::StringRef&  json,
+                 bool                      referenceStrings,
+                 bsl::ostream             *errorStream,
+                 bslma::Allocator         *datumAllocator,
+                 bslma::Allocator         *scratchAllocator);
+        // Create a parser of the specified 'json', creating datums using the
+        // specified 'datumAllocator', and referring to the strings in 'json'
+        // if the specified 'referenceStrings' is 'true' and copying them
+        // otherwise.  Write a description of any errors to the specified
+        // 'errorStream', unless it is 0.  Use the specified
+        // 'scratchAllocator' to supply temporary memory.
+
+    ~BufferParser();
+        // Destroy this object, destroying any datums not yet part of a parsed
+        // value.
+
+    // MANIPULATORS
+    int parse(bdld::Datum *result);
+        // Load into the specified 'result' the value of the JSON text of this
+        // parser.  Return 0 on success, and a negative value if the text is
+        // not a single, well-formed, JSON value.
+
+    int parseValue(bdld::Datum *result);
+        // Load into the specified 'result' the JSON value starting at the
+        // current position, which is not whitespace.  Return 0 on success,
+        // and a negative value otherwise.
+};
+
+                             // ------------------
+                             // class BufferParser
+                             // ------------------
+
+// PRIVATE MANIPULATORS
+int BufferParser::error(const char *message)
+{
+    if (d_errorStream_p) {
+        *d_errorStream_p << message << " at offset "
+                         << (d_cursor_p - d_begin_p) << '\n';
+    }
+    return -1;
+}
+
+int BufferParser::parseArray(bdld::Datum *result)
+{
+    const bsl::size_t base = d_stack.size();
+
+    ++d_cursor_p;
+    skipWhitespace();
+
+    if (d_cursor_p < d_end_p && ']' == *d_cursor_p) {
+        ++d_cursor_p;
+        *result = bdld::Datum::adoptArray(bdld::DatumMutableArrayRef());
+        return 0;                                                     // RETURN
+    }
+
+    while (true) {
+        bdld::Datum value;
+        if (0 != parseValue(&value)) {
+            return -1;                                                // RETURN
+        }
+        d_stack.push_back(bdld::DatumMapEntry(bslstl::StringRef(), value));
+
+        skipWhitespace();
+        if (d_cursor_p == d_end_p) {
+            return error("Unterminated array");                       // RETURN
+        }
+        if (']' == *d_cursor_p) {
+            ++d_cursor_p;
+            break;
+        }
+        if (',' != *d_cursor_p) {
+            return error("Expected ',' or ']'");                      // RETURN
+        }
+        ++d_cursor_p;
+        skipWhitespace();
+    }
+
+    const bsl::size_t length = d_stack.size() - base;
+
+    bdld::DatumMutableArrayRef array;
+    bdld::Datum::createUninitializedArray(&array, length, d_allocator_p);
+    for (bsl::size_t i = 0; i < length; ++i) {
+        array.data()[i] = d_stack[base + i].value();
+    }
+    *array.length() = length;
+
+    d_stack.erase(d_stack.begin() + base, d_stack.end());
+    *result = bdld::Datum::adoptArray(array);
+    return 0;
+}
+
+int BufferParser::parseObject(bdld::Datum *result)
+{
+    const bsl::size_t base = d_stack.size();
+
+    ++d_cursor_p;
+    skipWhitespace();
+
+    if (d_cursor_p < d_end_p && '}' == *d_cursor_p) {
+        ++d_cursor_p;
+        *result = d_referenceStrings
+                ? bdld::Datum::adoptMap(bdld::DatumMutableMapRef())
+                : bdld::Datum::adoptMap(bdld::DatumMutableMapOwningKeysRef());
+        return 0;                                                     // RETURN
+    }
+
+    // 'keys' is populated only for objects too large to search linearly for
+    // duplicate keys.
+
+    KeySet      keys(d_stack.get_allocator().mechanism());
+    bsl::size_t keysLength = 0;
+
+    while (true) {
+        if (d_cursor_p == d_end_p || '"' != *d_cursor_p) {
+            return error("Expected a member name");                   // RETURN
+        }
+
+        // As for 'decode', member names are not unescaped.
+
+        bslstl::StringRef key;
+        bool              isPlain;
+        if (0 != scanString(&key, &isPlain)) {
+            return -1;                                                // RETURN
+        }
+
+        skipWhitespace();
+        if (d_cursor_p == d_end_p || ':' != *d_cursor_p) {
+            return error("Expected ':'");                             // RETURN
+        }
+        ++d_cursor_p;
+        skipWhitespace();
+
+        bdld::Datum value;
+        if (0 != parseValue(&value)) {
+            return -1;                                                // RETURN
+        }
+
+        // Keep the FIRST instance of any duplicate keys.
+
+        const bsl::size_t numMembers = d_stack.size() - base;
+        bool              isDuplicate = false;
+        if (numMembers < k_MAX_LINEAR_KEY_SEARCH) {
+            for (bsl::size_t i = base; i < d_stack.size(); ++i) {
+                if (d_stack[i].key() == key) {
+                    isDuplicate = true;
+                    break;
+                }
+            }
+        }
+        else {
+            if (keys.empty()) {
+                for (bsl::size_t i = base; i < d_stack.size(); ++i) {
+                    keys.insert(d_stack[i].key());
+                }
+            }
+            isDuplicate = !keys.insert(key).second;
+        }
+
+        if (isDuplicate) {
+            bdld::Datum::destroy(value, d_allocator_p);
+        }
+        else {
+            d_stack.push_back(bdld::DatumMapEntry(key, value));
+            keysLength += key.length();
+        }
+
+        skipWhitespace();
+        if (d_cursor_p == d_end_p) {
+            return error("Unterminated object");                      // RETURN
+        }
+        if ('}' == *d_cursor_p) {
+            ++d_cursor_p;
+            break;
+        }
+        if (',' != *d_cursor_p) {
+            return error("Expected ',' or '}'");                      // RETURN
+        }
+        ++d_cursor_p;
+        skipWhitespace();
+    }
+
+    const bsl::size_t         size    = d_stack.size() - base;
+    const bdld::DatumMapEntry *members = d_stack.data() + base;
+
+    if (d_referenceStrings) {
+        bdld::DatumMutableMapRef map;
+        bdld::Datum::createUninitializedMap(&map, size, d_allocator_p);
+        bsl::copy(members, members + size, map.data());
+        *map.size()   = size;
+        *map.sorted() = false;
+
+        *result = bdld::Datum::adoptMap(map);
+    }
+    else {
+        bdld::DatumMutableMapOwningKeysRef map;
+        bdld::Datum::createUninitializedMap(&map,
+                                            size,
+                                            keysLength,
+                                            d_allocator_p);
+        char *key = map.keys();
+        for (bsl::size_t i = 0; i < size; ++i) {
+            const bslstl::StringRef& name = members[i].key();
+            bsl::memcpy(key, name.data(), name.length());
+            map.data()[i] = bdld::DatumMapEntry(
+                                     bslstl::StringRef(key, name.length()),
+                                     members[i].value());
+            key += name.length();
+        }
+        *map.size()   = size;
+        *map.sorted() = false;
+
+        *result = bdld::Datum::adoptMap(map);
+    }
+
+    d_stack.erase(d_stack.begin() + base, d_stack.end());
+    return 0;
+}
+
+int BufferParser::parseScalar(bdld::Datum *result)
+{
+    static const char *const k_DELIMITERS = "{}[]:,";
+
+    const char *begin = d_cursor_p;
+    while (d_cursor_p < d_end_p
+        && !bdlb::CharType::isSpace(*d_cursor_p)
+        && !bsl::strchr(k_DELIMITERS, *d_cursor_p)) {
+        ++d_cursor_p;
+    }
+
+    const bslstl::StringRef value(begin, d_cursor_p);
+
+    if (value.isEmpty()) {
+        return error("Expected a value");                             // RETURN
+    }
+
+    if ("true" == value || "false" == value) {
+        *result = bdld::Datum::createBoolean("true" == value);
+        return 0;                                                     // RETURN
+    }
+
+    if ("null" == value) {
+        *result = bdld::Datum::createNull();
+        return 0;                                                     // RETURN
+    }
+
+    double            d;
+    bslstl::StringRef remainder;
+    if (0 == bdlb::NumericParseUtil::parseDouble(&d, &remainder, value) &&
+        0 == remainder.length()) {
+        *result = bdld::Datum::createDouble(d);
+        return 0;                                                     // RETURN
+    }
+
+    d_cursor_p = begin;
+    return error("Invalid value");
+}
+
+int BufferParser::parseString(bdld::Datum *result)
+{
+    const char        *begin = d_cursor_p;
+    bslstl::StringRef  contents;
+    bool               isPlain;
+
+    if (0 != scanString(&contents, &isPlain)) {
+        return -1;                                                    // RETURN
+    }
+
+    if (isPlain) {
+        *result = d_referenceStrings
+                ? bdld::Datum::createStringRef(contents, d_allocator_p)
+                : bdld::Datum::copyString(contents, d_allocator_p);
+        return 0;                                                     // RETURN
+    }
+
+    d_string.clear();
+    if (0 != extractString(&d_string, bslstl::StringRef(begin, d_cursor_p))) {
+        d_cursor_p = begin;
+        return error("Invalid string");                               // RETURN
+    }
+
+    *result = bdld::Datum::copyString(d_string, d_allocator_p);
+    return 0;
+}
+
+int BufferParser::scanString(bslstl::StringRef *contents, bool *isPlain)
+{
+    const char *begin = d_cursor_p + 1;
+    const char *end   = begin;
+
+    *isPlain = true;
+
+    while (end < d_end_p && '"' != *end) {
+        if ('\\' == *end) {
+            *isPlain = false;
+            ++end;
+        }
+        else if (bdlb::CharType::isCntrl(*end)) {
+            *isPlain = false;
+        }
+        ++end;
+    }
+
+    if (end >= d_end_p) {
+        return error("Unterminated string");                          // RETURN
+    }
+
+    contents->assign(begin, end);
+    d_cursor_p = end + 1;
+    return 0;
+}
+
+void BufferParser::skipWhitespace()
+{
+    while (d_cursor_p < d_end_p && bdlb::CharType::isSpace(*d_cursor_p)) {
+        ++d_cursor_p;
+    }
+}
+
+// CREATORS
+BufferParser::BufferParser(const bslstl::StringRef&  json,
+                           bool                      referenceStrings,
+                           bsl::ostream             *errorStream,
+                           bslma::Allocator         *datumAllocator,
+                           bslma::Allocator         *scratchAllocator)
+: d_begin_p(json.data())
+, d_cursor_p(json.data())
+, d_end_p(json.data() + json.length())
+, d_referenceStrings(referenceStrings)
+, d_errorStream_p(errorStream)
+, d_stack(scratchAllocator)
+, d_string(scratchAllocator)
+, d_allocator_p(datumAllocator)
+{
+}
+
+BufferParser::~BufferParser()
+{
+    for (bsl::size_t i = 0; i < d_stack.size(); ++i) {
+        bdld::Datum::destroy(d_stack[i].value(), d_allocator_p);
+    }
+}
+
+// MANIPULATORS
+int BufferParser::parse(bdld::Datum *result)
+{
+    skipWhitespace();
+    if (d_cursor_p == d_end_p) {
+        return error("Expected a value");                             // RETURN
+    }
+
+    bdld::Datum value;
+    if (0 != parseValue(&value)) {
+        return -1;                                                    // RETURN
+    }
+
+    skipWhitespace();
+    if (d_cursor_p != d_end_p) {
+        bdld::Datum::destroy(value, d_allocator_p);
+        return error("Unexpected text after value");                  // RETURN
+    }
+
+    *result = value;
+    return 0;
+}
+
+int BufferParser::parseValue(bdld::Datum *result)
+{
+    if (d_cursor_p == d_end_p) {
+        return error("Expected a value");                             // RETURN
+    }
+
+    switch (*d_cursor_p) {
+      case '{': return parseObject(result);                           // RETURN
+      case '[': return parseArray(result);                            // RETURN
+      case '"': return parseString(result);                           // RETURN
+      default:  return parseScalar(result);                           // RETURN
+    }
+}
+
+inline
+bool isEscapedInString(char character)
+    // Return 'true' if the specified 'character' is escaped when written in a
+    // JSON string (as by 'baljsn::PrintUtil::printString'), and 'false'
+    // otherwise.
+{
+    return '"' == character
+        || '\\' == character
+        || '/' == character
+        || static_cast<unsigned char>(character) < 0x20;
+}
+
+inline
+bool hasShortEscape(char character)
+    // Return 'true' if the specified 'character', which is escaped in a JSON
+    // string, is escaped as a backslash followed by a single character, and
+    // 'false' if it is escaped as a "\u" sequence.
+{
+    switch (character) {
+      case '"':
+      case '\\':
+      case '/':
+      case '\b':
+      case '\f':
+      case '\n':
+      case '\r':
+      case '\t': return true;                                         // RETURN
+      default:   return false;                                        // RETURN
+    }
+}
+
+const char *findEscapedChar(const char *begin, const char *end)
+    // Return the address of the first character in the specified range
+    // '[begin, end)' that is escaped when written in a JSON string, or 'end'
+    // if there is no such character.
+{
+#ifdef BALJSN_DATUMUTIL_SSE2
+    // Compare 16 characters at a time; a character is a control character if
+    // its unsigned minimum with 0x1F is itself.
+
+    const __m128i quote      = _mm_set1_epi8('"');
+    const __m128i backslash  = _mm_set1_epi8('\\');
+    const __m128i slash      = _mm_set1_epi8('/');
+    const __m128i maxControl = _mm_set1_epi8(0x1F);
+
+    while (end - begin >= 16) {
+        const __m128i block = _mm_loadu_si128(
+                                     reinterpret_cast<const __m128i *>(begin));
+        const __m128i found = _mm_or_si128(
+                   _mm_or_si128(_mm_cmpeq_epi8(block, quote),
+                                _mm_cmpeq_epi8(block, backslash)),
+                   _mm_or_si128(_mm_cmpeq_epi8(block, slash),
+                                _mm_cmpeq_epi8(_mm_min_epu8(block, maxControl),
+                                               block)));
+        const bsl::uint32_t mask = _mm_movemask_epi8(found);
+        if (mask) {
+            return begin + bdlb::BitUtil::numTrailingUnsetBits(mask); // RETURN
+        }
+        begin += 16;
+    }
+#endif
+
+    for (; begin != end; ++begin) {
+        if (isEscapedInString(*begin)) {
+            return begin;                                             // RETURN
+        }
+    }
+    return end;
+}
+
+                             // =================
+                             // class OutputSizer
+                             // =================
+
+class OutputSizer {
+    // This class implements the output of the first pass of 'encodeBuffer',
+    // which computes the length of the encoded JSON text without writing it.
+    // The text of numbers, and of the other scalar values that are costly to
+    // format, is formatted once, by this class, into a side buffer from which
+    // it is copied by 'OutputWriter' in the second pass.  Each item in the
+    // side buffer is preceded by its length, as a single byte.
+
+    // DATA
+    bsl::size_t  d_length;        // length of the text so far
+    bsl::string *d_formatted_p;   // side buffer (held, not owned)
+
+  public:
+    // CREATORS
+    explicit OutputSizer(bsl::string *formatted);
+        // Create an object counting the length of output, and storing the
+        // text of formatted values in the specified 'formatted' buffer.
+
+    // MANIPULATORS
+    int putFormatted(const bdld::Datum& datum);
+        // Count, and store in the side buffer, the text of the specified
+        // 'datum', which is neither a string, 'bool', null, array, nor map.
+        // Return 0 on success, and a negative value if 'datum' cannot be
+        // encoded.
+
+    void put(char);
+        // Count one character.
+
+    void putSpaces(int count);
+        // Count the specified 'count' spaces.
+
+    int putString(const bslstl::StringRef& value);
+        // Count the characters of the specified 'value' written as a JSON
+        // string.  Return 0 on success, and a negative value if 'value' is
+        // not valid UTF-8.
+
+    void write(const char *, bsl::size_t length);
+        // Count the specified 'length' characters.
+
+    // ACCESSORS
+    bsl::size_t length() const;
+        // Return the number of characters counted.
+};
+
+                             // ==================
+                             // class OutputWriter
+                             // ==================
+
+class OutputWriter {
+    // This class implements the output of the second pass of 'encodeBuffer',
+    // writing the encoded JSON text into a contiguous buffer, or into the
+    // data buffers of a 'bdlbb::Blob', whose length has been set to hold
+    // exactly that text.
+
+    // DATA
+    char        *d_cursor_p;       // next character to write
+    char        *d_end_p;          // end of the current buffer
+    bdlbb::Blob *d_blob_p;         // blob, if any (held, not owned)
+    int          d_nextBuffer;     // index of the next blob buffer
+    const char  *d_formatted_p;    // next item in the side buffer
+
+    // PRIVATE MANIPULATORS
+    void nextBuffer();
+        // Make the next data buffer of the blob the current buffer.
+
+    void writeSlow(const char *data, bsl::size_t length);
+        // Write the specified 'length' characters at the specified 'data',
+        // spanning as many buffers as needed.
+
+  public:
+    // CREATORS
+    OutputWriter(char *buffer, bsl::size_t length, const char *formatted);
+        // Create an object writing to the specified 'buffer' of the specified
+        // 'length', and copying the text of formatted values from the
+        // specified 'formatted' buffer.  The behavior is undefined if more
+        // than 'length' characters are written.
+
+    OutputWriter(bdlbb::Blob *blob,
+                 int          bufferIndex,
+                 int          offset,
+                 const char  *formatted);
+        // Create an object writing to the data buffers of the specified
+        // 'blob', starting at the specified 'offset' in the buffer at the
+        // specified 'bufferIndex', and copying the text of formatted values
+        // from the specified 'formatted' buffer.
+
+    // MANIPULATORS
+    int putFormatted(const bdld::Datum&);
+        // Write the next item of the side buffer.  Return 0.
+
+    void put(char character);
+        // Write the specified 'character'.
+
+    void putSpaces(int count);
+        // Write the specified 'count' spaces.
+
+    int putString(const bslstl::StringRef& value);
+        // Write the specified 'value' as a JSON string.  Return 0.
+
+    void write(const char *data, bsl::size_t length);
+        // Write the specified 'length' characters at the specified 'data'.
+};
+
+                            // ===================
+                            // class DirectEncoder
+                            // ===================
+
+template <class OUTPUT>
+class DirectEncoder {
+    // This class template implements the traversal of a 'bdld::Datum' by
+    // 'encodeBuffer', producing the same JSON text as 'SimpleFormatter' (as
+    // used by 'encode') to the 'OUTPUT' type, which is either 'OutputSizer'
+    // or 'OutputWriter'.
+
+    // DATA
+    OUTPUT *d_output_p;            // output (held, not owned)
+    bool    d_pretty;              // 'true' for the pretty style
+    int     d_spacesPerLevel;      // spaces per level of indentation
+    bool    d_foundCheckFailures;  // 'true' if a non-JSON type was encoded
+
+    // PRIVATE MANIPULATORS
+    int encodeArray(const bdld::DatumArrayRef& array, int level);
+        // Encode the specified 'array' at the specified indentation 'level'.
+        // Return 0 on success, and a negative value otherwise.
+
+    int encodeObject(const bdld::DatumMapRef& map, int level);
+        // Encode the specified 'map' at the specified indentation 'level'.
+        // Return 0 on success, and a negative value otherwise.
+
+    int encodeValue(const bdld::Datum& datum, int level);
+        // Encode the specified 'datum', whose first character is already
+        // indented, at the specified indentation 'level'.  Return 0 on
+        // success, and a negative value otherwise.
+
+    void indent(int level);
+        // Write the indentation for the specified 'level' if the pretty style
+        // is used.
+
+    void separate(bsl::size_t index);
+        // Write the separator preceding the element at the specified 'index'
+        // of an array or object.
+
+  public:
+    // CREATORS
+    DirectEncoder(OUTPUT *output, const DatumEncoderOptions& options);
+        // Create an encoder writing to the specified 'output' in the style
+        // specified by 'options'.
+
+    // MANIPULATORS
+    int encode(const bdld::Datum& datum, int level);
+        // Encode the specified 'datum', indented at the specified 'level'.
+        // Return 0 on success, and a negative value otherwise.
+
+    // ACCESSORS
+    bool foundCheckFailures() const;
+        // Return 'true' if a value whose type is not natively supported by
+        // JSON was encoded, and 'false' otherwise.
+};
+
+                             // -----------------
+                             // class OutputSizer
+                             // -----------------
+
+// CREATORS
+OutputSizer::OutputSizer(bsl::string *formatted)
+: d_length(0)
+, d_formatted_p(formatted)
+{
+}
+
+// MANIPULATORS
+int OutputSizer::putFormatted(const bdld::Datum& datum)
+{
+    char        buffer[64];
+    const char *end = buffer;
+
+    switch (datum.type()) {
+      case bdld::Datum::e_REAL: {
+        if (!bdlb::Float::isFinite(datum.theDouble())) {
+            return -1;                                                // RETURN
+        }
+        end = bdlb::NumericFormatUtil::toChars(buffer + 1,
+                                               buffer + sizeof buffer,
+                                               datum.theDouble());
+      } break;
+      case bdld::Datum::e_INTEGER: {
+        end = bdlb::NumericFormatUtil::toChars(buffer + 1,
+                                               buffer + sizeof buffer,
+                                               datum.theInteger());
+      } break;
+      case bdld::Datum::e_INTEGER64: {
+        end = bdlb::NumericFormatUtil::toChars(
+                           buffer + 1,
+                           buffer + sizeof buffer,
+                           static_cast<double>(datum.theInteger64()));
+      } break;
+      default: {
+        // Dates, times, and decimals are formatted as by 'encode'.
+
+        bdlsb::FixedMemOutStreamBuf streamBuf(buffer + 1, sizeof buffer - 1);
+        bsl::ostream                stream(&streamBuf);
+        const EncoderOptions        options;
+        int                         rc = 0;
+
+        switch (datum.type()) {
+          case bdld::Datum::e_DATE: {
+            rc = PrintUtil::printValue(stream, datum.theDate(), &options);
+          } break;
+          case bdld::Datum::e_TIME: {
+            rc = PrintUtil::printValue(stream, datum.theTime(), &options);
+          } break;
+          case bdld::Datum::e_DATETIME: {
+            rc = PrintUtil::printValue(stream, datum.theDatetime(), &options);
+          } break;
+          case bdld::Datum::e_DATETIME_INTERVAL: {
+            rc = PrintUtil::printValue(stream,
+                                       datum.theDatetimeInterval(),
+                                       &options);
+          } break;
+          case bdld::Datum::e_DECIMAL64: {
+            rc = PrintUtil::printValue(stream, datum.theDecimal64(), &options);
+          } break;
+          default: {
+            rc = -1;
+          } break;
+        }
+        if (0 != rc || !stream) {
+            return -1;                                                // RETURN
+        }
+        end = buffer + 1 + streamBuf.length();
+      } break;
+    }
+
+    const bsl::size_t length = end - buffer - 1;
+    BSLS_ASSERT(length < 256);
+
+    buffer[0] = static_cast<char>(length);
+    d_formatted_p->append(buffer, length + 1);
+    d_length += length;
+    return 0;
+}
+
+inline
+void OutputSizer::put(char)
+{
+    ++d_length;
+}
+
+inline
+void OutputSizer::putSpaces(int count)
+{
+    d_length += count;
+}
+
+int OutputSizer::putString(const bslstl::StringRef& value)
+{
+    if (!bdlde::Utf8Util::isValid(value.data(),
+                                  static_cast<int>(value.length()))) {
+        return -1;                                                    // RETURN
+    }
+
+    const char *end = value.data() + value.length();
+    const char *escaped = findEscapedChar(value.data(), end);
+
+    d_length += value.length() + 2;
+    while (escaped != end) {
+        d_length += hasShortEscape(*escaped) ? 1 : 5;
+        escaped   = findEscapedChar(escaped + 1, end);
+    }
+    return 0;
+}
+
+inline
+void OutputSizer::write(const char *, bsl::size_t length)
+{
+    d_length += length;
+}
+
+// ACCESSORS
+inline
+bsl::size_t OutputSizer::length() const
+{
+    return d_length;
+}
+
+                             // ------------------
+                             // class OutputWriter
+                             // ------------------
+
+// PRIVATE MANIPULATORS
+void OutputWriter::nextBuffer()
+{
+    BSLS_ASSERT(d_blob_p);
+    BSLS_ASSERT(d_nextBuffer < d_blob_p->numDataBuffers());
+
+    const bdlbb::BlobBuffer& buffer = d_blob_p->buffer(d_nextBuffer);
+
+    d_cursor_p = buffer.data();
+    d_end_p    = buffer.data()
+               + (d_nextBuffer + 1 == d_blob_p->numDataBuffers()
+                  ? d_blob_p->lastDataBufferLength()
+                  : buffer.size());
+    ++d_nextBuffer;
+}
+
+void OutputWriter::writeSlow(const char *data, bsl::size_t length)
+{
+    while (length) {
+        if (d_cursor_p == d_end_p) {
+            nextBuffer();
+        }
+
+        const bsl::size_t available = d_end_p - d_cursor_p;
+        const bsl::size_t count     = length < available ? length : available;
+
+        bsl::memcpy(d_cursor_p, data, count);
+        d_cursor_p += count;
+        data       += count;
+        length     -= count;
+    }
+}
+
+// CREATORS
+OutputWriter::OutputWriter(char        *buffer,
+                           bsl::size_t  length,
+                           const char  *formatted)
+: d_cursor_p(buffer)
+, d_end_p(buffer + length)
+, d_blob_p(0)
+, d_nextBuffer(0)
+, d_formatted_p(formatted)
+{
+}
+
+OutputWriter::OutputWriter(bdlbb::Blob *blob,
+                           int          bufferIndex,
+                           int          offset,
+                           const char  *formatted)
+: d_cursor_p(0)
+, d_end_p(0)
+, d_blob_p(blob)
+, d_nextBuffer(bufferIndex)
+, d_formatted_p(formatted)
+{
+    nextBuffer();
+    d_cursor_p += offset;
+}
+
+// MANIPULATORS
+inline
+int OutputWriter::putFormatted(const bdld::Datum&)
+{
+    const bsl::size_t length = static_cast<unsigned char>(*d_formatted_p);
+
+    write(d_formatted_p + 1, length);
+    d_formatted_p += length + 1;
+    return 0;
+}
+
+inline
+void OutputWriter::put(char character)
+{
+    if (d_cursor_p == d_end_p) {
+        nextBuffer();
+    }
+    *d_cursor_p++ = character;
+}
+
+void OutputWriter::putSpaces(int count)
+{
+    static const char k_SPACES[] = "                                ";
+    const int         k_NUM_SPACES = sizeof k_SPACES - 1;
+
+    while (count > k_NUM_SPACES) {
+        write(k_SPACES, k_NUM_SPACES);
+        count -= k_NUM_SPACES;
+    }
+    write(k_SPACES, count);
+}
+
+int OutputWriter::putString(const bslstl::StringRef& value)
+{
+    static const char k_HEX_DIGITS[] = "0123456789abcdef";
+
+    const char *begin   = value.data();
+    const char *end     = value.data() + value.length();
+    const char *escaped = findEscapedChar(begin, end);
+
+    put('"');
+    while (escaped != end) {
+        write(begin, escaped - begin);
+
+        char escape[6] = { '\\', *escaped, '0', '0', '0', '0' };
+        int  length    = 2;
+        switch (*escaped) {
+          case '\b': escape[1] = 'b'; break;
+          case '\f': escape[1] = 'f'; break;
+          case '\n': escape[1] = 'n'; break;
+          case '\r': escape[1] = 'r'; break;
+          case '\t': escape[1] = 't'; break;
+          default: {
+            if (!hasShortEscape(*escaped)) {
+                escape[1] = 'u';
+                escape[4] = k_HEX_DIGITS[(*escaped & 0xF0) >> 4];
+                escape[5] = k_HEX_DIGITS[*escaped & 0x0F];
+                length    = 6;
+            }
+          } break;
+        }
+        write(escape, length);
+
+        begin   = escaped + 1;
+        escaped = findEscapedChar(begin, end);
+    }
+    write(begin, end - begin);
+    put('"');
+
+    return 0;
+}
+
+inline
+void OutputWriter::write(const char *data, bsl::size_t length)
+{
+    if (length <= static_cast<bsl::size_t>(d_end_p - d_cursor_p)) {
+        bsl::memcpy(d_cursor_p, data, length);
+        d_cursor_p += length;
+    }
+    else {
+        writeSlow(data, length);
+    }
+}
+
+                            // -------------------
+                            // class DirectEncoder
+                            // -------------------
+
+// PRIVATE MANIPULATORS
+template <class OUTPUT>
+int DirectEncoder<OUTPUT>::encodeArray(const bdld::DatumArrayRef& array,
+                                       int                        level)
+{
+    if (0 == array.length()) {
+        d_output_p->write("[]", 2);
+        return 0;                                                     // RETURN
+    }
+
+    d_output_p->put('[');
+    if (d_pretty) {
+        d_output_p->put('\n');
+    }
+
+    for (bsl::size_t i = 0; i < array.length(); ++i) {
+        separate(i);
+        indent(level + 1);
+
+        const int rc = encodeValue(array[i], level + 1);
+        if (0 != rc) {
+            return rc;                                                // RETURN
+        }
+    }
+
+    if (d_pretty) {
+        d_output_p->put('\n');
+        indent(level);
+    }
+    d_output_p->put(']');
+    return 0;
+}
+
+template <class OUTPUT>
+int DirectEncoder<OUTPUT>::encodeObject(const bdld::DatumMapRef& map,
+                                        int                      level)
+{
+    d_output_p->put('{');
+    if (d_pretty) {
+        d_output_p->put('\n');
+    }
+
+    for (bsl::size_t i = 0; i < map.size(); ++i) {
+        separate(i);
+        indent(level + 1);
+
+        int rc = d_output_p->putString(map[i].key());
+        if (0 != rc) {
+            return rc;                                                // RETURN
+        }
+
+        if (d_pretty) {
+            d_output_p->write(" : ", 3);
+        }
+        else {
+            d_output_p->put(':');
+        }
+
+        rc = encodeValue(map[i].value(), level + 1);
+        if (0 != rc) {
+            return rc;                                                // RETURN
+        }
+    }
+
+    if (d_pretty) {
+        if (0 != map.size()) {
+            d_output_p->put('\n');
+        }
+        indent(level);
+    }
+    d_output_p->put('}');
+    return 0;
+}
+
+template <class OUTPUT>
+int DirectEncoder<OUTPUT>::encodeValue(const bdld::Datum& datum, int level)
+{
+    switch (datum.type()) {
+      case bdld::Datum::e_MAP: {
+        return encodeObject(datum.theMap(), level);                   // RETURN
+      }
+      case bdld::Datum::e_ARRAY: {
+        return encodeArray(datum.theArray(), level);                  // RETURN
+      }
+      case bdld::Datum::e_STRING: {
+        return d_output_p->putString(datum.theString());              // RETURN
+      }
+      case bdld::Datum::e_BOOLEAN: {
+        if (datum.theBoolean()) {
+            d_output_p->write("true", 4);
+        }
+        else {
+            d_output_p->write("false", 5);
+        }
+        return 0;                                                     // RETURN
+      }
+      case bdld::Datum::e_NIL: {
+        d_output_p->write("null", 4);
+        return 0;                                                     // RETURN
+      }
+      case bdld::Datum::e_REAL: {
+        return d_output_p->putFormatted(datum);                       // RETURN
+      }
+      case bdld::Datum::e_INTEGER:
+      case bdld::Datum::e_DATE:
+      case bdld::Datum::e_TIME:
+      case bdld::Datum::e_DATETIME:
+      case bdld::Datum::e_DATETIME_INTERVAL:
+      case bdld::Datum::e_INTEGER64:
+      case bdld::Datum::e_DECIMAL64: {
+        d_foundCheckFailures = true;
+        return d_output_p->putFormatted(datum);                       // RETURN
+      }
+      default: {
+        d_foundCheckFailures = true;
+        return -1;                                                    // RETURN
+      }
+    }
+}
+
+template <class OUTPUT>
+inline
+void DirectEncoder<OUTPUT>::indent(int level)
+{
+    if (d_pretty && level > 0) {
+        d_output_p->putSpaces(level * d_spacesPerLevel);
+    }
+}
+
+template <class OUTPUT>
+inline
+void DirectEncoder<OUTPUT>::separate(bsl::size_t index)
+{
+    if (index) {
+        d_output_p->put(',');
+        if (d_pretty) {
+            d_output_p->put('\n');
+        }
+    }
+}
+
+// CREATORS
+template <class OUTPUT>
+DirectEncoder<OUTPUT>::DirectEncoder(OUTPUT                     *output,
+                                     const DatumEncoderOptions&  options)
+: d_output_p(output)
+, d_pretty(EncodingStyle::e_PRETTY == options.encodingStyle())
+, d_spacesPerLevel(options.spacesPerLevel())
+, d_foundCheckFailures(false)
+{
+}
+
+// MANIPULATORS
+template <class OUTPUT>
+inline
+int DirectEncoder<OUTPUT>::encode(const bdld::Datum& datum, int level)
+{
+    indent(level);
+    return encodeValue(datum, level);
+}
+
+// ACCESSORS
+template <class OUTPUT>
+inline
+bool DirectEncoder<OUTPUT>::foundCheckFailures() const
+{
+    return d_foundCheckFailures;
+}
+
+int measure(bsl::size_t                *length,
+            bool                       *foundCheckFailures,
+            bsl::string                *formatted,
+            const bdld::Datum&          datum,
+            const DatumEncoderOptions&  options)
+    // Load into the specified 'length' the length of the JSON text of the
+    // specified 'datum' in the style specified by 'options', load into the
+    // specified 'foundCheckFailures' whether 'datum' contains a type that is
+    // not natively supported by JSON, and store the text of its numbers and
+    // other formatted values in the specified 'formatted' buffer.  Return 0
+    // on success, and a negative value if 'datum' cannot be encoded.
+{
+    OutputSizer                sizer(formatted);
+    DirectEncoder<OutputSizer> encoder(&sizer, options);
+
+    const int rc = encoder.encode(datum, options.initialIndentLevel());
+    if (0 != rc) {
+        return rc;                                                    // RETURN
+    }
+
+    *length             = sizer.length();
+    *foundCheckFailures = encoder.foundCheckFailures();
+    return 0;
+}
+
+void writeText(OutputWriter               *writer,
+               const bdld::Datum&          datum,
+               const DatumEncoderOptions&  options)
+    // Write to the specified 'writer' the JSON text of the specified 'datum'
+    // in the style specified by 'options', which was measured by 'measure'.
+{
+    DirectEncoder<OutputWriter> encoder(writer, options);
+
+    const int rc = encoder.encode(datum, options.initialIndentLevel());
+    (void)rc;
+    BSLS_ASSERT(0 == rc);
+}
+
 }  // close unnamed namespace
 
                               // ----------------
@@ -526,6 +1724,92 @@ int DatumUtil::decode(bdld::ManagedDatum *result,
     return 0;
 }
 
+int DatumUtil::decodeBuffer(bdld::ManagedDatum       *result,
+                            bsl::ostream             *errorStream,
+                            const bslstl::StringRef&  json,
+                            StringMode                mode)
+{
+    bsls::AlignedBuffer<8 * 1024>      buffer;
+    bdlma::BufferedSequentialAllocator bsa(buffer.buffer(), sizeof(buffer));
+
+    BufferParser parser(json,
+                        e_REFERENCE_STRINGS == mode,
+                        errorStream,
+                        result->allocator(),
+                        &bsa);
+
+    bdld::Datum value;
+    if (0 != parser.parse(&value)) {
+        return -1;                                                    // RETURN
+    }
+
+    result->adopt(value);
+    return 0;
+}
+
+int DatumUtil::encodeBuffer(bsl::string                *result,
+                            const bdld::Datum&          datum,
+                            const DatumEncoderOptions&  options)
+{
+    bsls::AlignedBuffer<8 * 1024>      buffer;
+    bdlma::BufferedSequentialAllocator bsa(buffer.buffer(), sizeof(buffer));
+
+    bsl::string formatted(&bsa);
+    bsl::size_t length;
+    bool        foundCheckFailures;
+
+    const int rc = measure(&length,
+                           &foundCheckFailures,
+                           &formatted,
+                           datum,
+                           options);
+    if (0 != rc) {
+        return rc;                                                    // RETURN
+    }
+
+    result->resize(length);
+
+    OutputWriter writer(&(*result)[0], length, formatted.data());
+    writeText(&writer, datum, options);
+
+    return foundCheckFailures && options.strictTypes() ? 1 : 0;
+}
+
+int DatumUtil::encodeBuffer(bdlbb::Blob                *result,
+                            const bdld::Datum&          datum,
+                            const DatumEncoderOptions&  options)
+{
+    bsls::AlignedBuffer<8 * 1024>      buffer;
+    bdlma::BufferedSequentialAllocator bsa(buffer.buffer(), sizeof(buffer));
+
+    bsl::string formatted(&bsa);
+    bsl::size_t length;
+    bool        foundCheckFailures;
+
+    const int rc = measure(&length,
+                           &foundCheckFailures,
+                           &formatted,
+                           datum,
+                           options);
+    if (0 != rc) {
+        return rc;                                                    // RETURN
+    }
+
+    const int offset = result->length();
+    if (length > static_cast<bsl::size_t>(INT_MAX - offset)) {
+        return -1;                                                    // RETURN
+    }
+    result->setLength(offset + static_cast<int>(length));
+
+    const bsl::pair<int, int> start =
+                    bdlbb::BlobUtil::findBufferIndexAndOffset(*result, offset);
+
+    OutputWriter writer(result, start.first, start.second, formatted.data());
+    writeText(&writer, datum, options);
+
+    return foundCheckFailures && options.strictTypes() ? 1 : 0;
+}
+
 int DatumUtil::encode(bsl::string                *result,
                       const bdld::Datum&          datum,
                       const DatumEncoderOptions&  options)
@@ -38,6 +38,63 @@ BSLS_IDENT("$Id$ $CSID$")
 // is preserved in the decoded 'Datum'.  If multiple entries with the same
 // 'key' are present in an object, 'decode' will return the *first* such value.
 //
+///Encoding Directly into a Buffer
+///-------------------------------
+// 'encode' writes each value to a 'bsl::ostream' through a
+// 'baljsn::SimpleFormatter'.  'encodeBuffer' instead makes two passes over the
+// 'Datum': the first computes the exact length of the JSON text (formatting
+// each number once), and the second writes the text into a 'bsl::string',
+// resized once to that length, or appends it to a 'bdlbb::Blob', whose length
+// is set once.  The characters of strings that must be escaped are found 16 at
+// a time, using SSE2 instructions, on x86-64 platforms.
+//
+// 'encodeBuffer' writes the same JSON text as 'encode' for the same options,
+// except that:
+//
+//: o Numbers are written using the shortest text that converts back to
+//:   exactly the encoded value (see 'bdlb::NumericFormatUtil'), whereas
+//:   'encode' writes at most 15 significant digits (and so does not, in
+//:   general, round-trip 'double' values).
+//:
+//: o A string (or map key) that is not valid UTF-8, and a number that is
+//:   infinite or NaN, are errors for 'encodeBuffer', and the result is not
+//:   modified, whereas 'encode' returns success having written incomplete
+//:   (invalid) JSON.
+//
+///Decoding Directly from a Buffer
+///-------------------------------
+// 'decode' reads its input through a 'baljsn::Tokenizer', which copies the
+// characters of each token into an internal buffer, and builds arrays and maps
+// incrementally, growing them as elements are added.  When the JSON text is
+// held in a contiguous buffer, 'decodeBuffer' can be used instead: it parses
+// the buffer directly, allocates each array and map once, with its exact size,
+// after all of its elements have been parsed, and copies each string from the
+// buffer into the resulting 'Datum' exactly once.
+//
+// If 'decodeBuffer' is passed 'e_REFERENCE_STRINGS', strings that contain no
+// escape sequences, and the keys of all maps, are not copied at all, but refer
+// to the characters in the buffer, which must then outlive the resulting
+// 'Datum'.  Strings with escape sequences are always copied, as they are
+// stored unescaped.
+//
+// All memory for the resulting 'Datum' is obtained from the allocator of the
+// 'bdld::ManagedDatum' passed to 'decodeBuffer'; since that memory is
+// allocated in many small blocks and released all at once, an arena such as a
+// 'bdlma::SequentialAllocator' (that is released, or rewound, after the
+// 'Datum' is no longer needed) is the most efficient choice.
+//
+// 'decodeBuffer' produces the same 'Datum' as 'decode' for the same JSON text,
+// but is stricter about what it accepts:
+//
+//: o A string containing an invalid escape sequence or an unescaped control
+//:   character is an error for 'decodeBuffer', whereas 'decode' produces a
+//:   null 'Datum' for such a string.
+//:
+//: o Any text other than whitespace following the value is an error for
+//:   'decodeBuffer', whereas 'decode' ignores most such text.
+//
+// Note that neither function interprets escape sequences in the keys of maps.
+//
 ///Supported Types
 ///---------------
 // The table below describes the set of types that a 'Datum' may be, whether it
@@ -225,6 +282,52 @@ BSLS_IDENT("$Id$ $CSID$")
 // Notice that the 'type' of "age" is 'double', since "age" was encoded as a
 // number, and 'double' is the supported representation of a JSON number (see
 // {'Supported Types'}).
+//
+///Example 3: Decoding JSON Held in a Buffer into an Arena
+///- - - - - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose that we receive JSON messages in a buffer, and need to inspect each
+// message only while its buffer is available.
+//
+// First, we create an arena, and a 'bdld::ManagedDatum' that allocates from
+// it:
+//..
+//  bdlma::SequentialAllocator arena;
+//  bdld::ManagedDatum         message(&arena);
+//..
+// Then, we decode a message, referring to the strings in the buffer rather
+// than copying them:
+//..
+//  const bsl::string messageJSON = "{\"symbol\":\"IBM\",\"bid\":146.25}";
+//
+//  rc = baljsn::DatumUtil::decodeBuffer(
+//                                    &message,
+//                                    0,
+//                                    messageJSON,
+//                                    baljsn::DatumUtil::e_REFERENCE_STRINGS);
+//  if (0 != rc) {
+//      // handle error
+//  }
+//..
+// Next, we observe that the value is the same as the one produced by
+// 'decode', and that the string refers to the buffer:
+//..
+//  bdld::ManagedDatum expected;
+//  rc = baljsn::DatumUtil::decode(&expected, messageJSON);
+//  assert(0        == rc);
+//  assert(expected == message);
+//
+//  const bdld::Datum symbol = *message->theMap().find("symbol");
+//  assert("IBM" == symbol.theString());
+//  assert(messageJSON.data() < symbol.theString().data());
+//  assert(messageJSON.data() + messageJSON.length() >
+//                                                  symbol.theString().data());
+//..
+// Finally, once we are done with the message, we release the 'Datum' and all
+// of the memory allocated for it, before decoding the next message:
+//..
+//  message.release();
+//  arena.rewind();
+//..
 
 #include <balscm_version.h>
 
@@ -240,6 +343,8 @@ BSLS_IDENT("$Id$ $CSID$")
 
 namespace BloombergLP {
 
+namespace bdlbb { class Blob; }
+
 namespace baljsn {
 
 class SimpleFormatter;
@@ -252,6 +357,15 @@ struct DatumUtil {
     // This 'struct' provides a namespace for a suite of functions that convert
     // between a JSON formated string and a 'bdld::Datum'.
 
+    // TYPES
+    enum StringMode {
+        // Enumerate how 'decodeBuffer' stores the strings, and the keys of
+        // maps, that it decodes.
+
+        e_COPY_STRINGS,      // copy strings into the resulting 'Datum'
+        e_REFERENCE_STRINGS  // refer to strings, when possible, in the input
+    };
+
     // CLASS METHODS
     static int encode(bsl::string               *result,
                       const bdld::Datum&         datum);
@@ -289,6 +403,41 @@ struct DatumUtil {
         // positive status will be returned).  The mapping of types supported
         // by 'Datum' to JSON types is described in {Supported Types}.
 
+    static int encodeBuffer(bsl::string                *result,
+                            const bdld::Datum&          datum);
+    static int encodeBuffer(bsl::string                *result,
+                            const bdld::Datum&          datum,
+                            const DatumEncoderOptions&  options);
+        // Encode the specified 'datum' as a JSON string, and load the
+        // specified 'result' with the encoded JSON string, computing the
+        // length of the string before writing it.  Return 0 on success, and a
+        // negative value if 'datum' could not be encoded (with no effect on
+        // 'result').  If the optionally specified 'options' argument is not
+        // present, treat it as a default-constructed 'DatumEncoderOptions'.
+        // If 'options.strictTypes' is 'true' and a non-JSON type is encoded
+        // (see {Supported Types}) return a positive value, but also populate
+        // 'result'.  See {Encoding Directly into a Buffer} for the
+        // differences from 'encode'.
+
+    static int encodeBuffer(bdlbb::Blob                *result,
+                            const bdld::Datum&          datum);
+    static int encodeBuffer(bdlbb::Blob                *result,
+                            const bdld::Datum&          datum,
+                            const DatumEncoderOptions&  options);
+        // Encode the specified 'datum' as a JSON string, and append the
+        // encoded JSON string to the specified 'result', computing the length
+        // of the string before setting the length of 'result' (once) and
+        // writing the string into its data buffers.  Return 0 on success, and
+        // a negative value if 'datum' could not be encoded (with no effect on
+        // 'result').  If the optionally specified 'options' argument is not
+        // present, treat it as a default-constructed 'DatumEncoderOptions'.
+        // If 'options.strictTypes' is 'true' and a non-JSON type is encoded
+        // (see {Supported Types}) return a positive value, but also append to
+        // 'result'.  The behavior is undefined unless 'result' has a blob
+        // buffer factory, or enough capacity for the encoded string.  See
+        // {Encoding Directly into a Buffer} for the differences from
+        // 'encode'.
+
     static int decode(bdld::ManagedDatum       *result,
                       const bslstl::StringRef&  json);
     static int decode(bdld::ManagedDatum       *result,
@@ -313,6 +462,29 @@ struct DatumUtil {
         // value if the JSON string contained in 'jsonBuffer' could not be
         // decoded (if it is ill-formed).  The mapping of types in JSON to the
         // types supported by 'Datum' is described in {Supported Types}.
+
+    static int decodeBuffer(bdld::ManagedDatum       *result,
+                            const bslstl::StringRef&  json,
+                            StringMode                mode = e_COPY_STRINGS);
+    static int decodeBuffer(bdld::ManagedDatum       *result,
+                            bsl::ostream             *errorStream,
+                            const bslstl::StringRef&  json,
+                            StringMode                mode = e_COPY_STRINGS);
+        // Decode the specified 'json' into the specified 'result', parsing
+        // 'json' directly rather than through a 'baljsn::Tokenizer', and
+        // allocating each array, map, and string of 'result' exactly once
+        // from the allocator of 'result'.  If the optionally specified
+        // 'errorStream' is non-null, a description of any error that occurs
+        // during parsing, including its offset in 'json', will be output to
+        // this stream.  Optionally specify a string 'mode'; if 'mode' is
+        // 'e_REFERENCE_STRINGS', strings without escape sequences and the keys
+        // of maps refer to the characters of 'json' rather than being copied,
+        // and the behavior is undefined unless 'json' outlives the value of
+        // 'result'.  If 'mode' is not specified, 'e_COPY_STRINGS' is used.
+        // Return 0 on success, and a negative value, with no effect on
+        // 'result', if 'json' could not be decoded (if it is ill-formed).
+        // See {Decoding Directly from a Buffer} for the differences from
+        // 'decode'.
 };
 
 // ============================================================================
@@ -344,6 +516,30 @@ int DatumUtil::decode(bdld::ManagedDatum *result, bsl::streambuf *jsonBuffer)
     return decode(result, 0, jsonBuffer);
 }
 
+inline
+int DatumUtil::decodeBuffer(bdld::ManagedDatum       *result,
+                            const bslstl::StringRef&  json,
+                            StringMode                mode)
+{
+    return decodeBuffer(result, 0, json, mode);
+}
+
+inline
+int DatumUtil::encodeBuffer(bsl::string *result, const bdld::Datum& datum)
+{
+    const DatumEncoderOptions localOpts;
+
+    return encodeBuffer(result, datum, localOpts);
+}
+
+inline
+int DatumUtil::encodeBuffer(bdlbb::Blob *result, const bdld::Datum& datum)
+{
+    const DatumEncoderOptions localOpts;
+
+    return encodeBuffer(result, datum, localOpts);
+}
+
 inline
 int DatumUtil::encode(bsl::string *result, const bdld::Datum& datum)
 {
@@ -7,7 +7,10 @@
 #include <bsl_cstdlib.h>
 #include <bsl_cstring.h>
 #include <bsl_iostream.h>
+#include <bsl_limits.h>
 #include <bsl_ostream.h>
+#include <bsl_sstream.h>
+#include <bsl_string.h>
 
 #include <bslim_testutil.h>
 
@@ -19,18 +22,26 @@
 #include <bsls_alignedbuffer.h>
 #include <bsls_asserttest.h>
 #include <bsls_compilerfeatures.h>
+#include <bsls_stopwatch.h>
 #include <bsls_types.h>
 
+#include <bdlbb_blob.h>
+#include <bdlbb_blobutil.h>
+#include <bdlbb_pooledblobbufferfactory.h>
+#include <bdlbb_simpleblobbufferfactory.h>
+
 #include <bdld_datum.h>
 #include <bdld_datumarraybuilder.h>
 #include <bdld_datumerror.h>
 #include <bdld_datummaker.h>
 #include <bdld_datummapbuilder.h>
+#include <bdld_datumudt.h>
 #include <bdld_manageddatum.h>
 
 #include <bdldfp_decimal.h>
 
 #include <bdlma_bufferedsequentialallocator.h>
+#include <bdlma_sequentialallocator.h>
 
 #include <bdlsb_fixedmeminstreambuf.h>  // for testing only
 #include <bdlsb_memoutstreambuf.h>      // for testing only
@@ -65,16 +76,24 @@ using namespace bsl;
 // [ 6] int encode(string *, const Datum&, const DUOptions*, Allocator *);
 // [ 6] int encode(ostream&, const Datum&, const DUOptions&, Allocator *);
 // [ 6] int encode(ostream&, const Datum&, const DUOptions*, Allocator *);
+// [ 8] int encodeBuffer(string *, const Datum&);
+// [ 8] int encodeBuffer(string *, const Datum&, const DEOptions&);
+// [ 8] int encodeBuffer(Blob *, const Datum&);
+// [ 8] int encodeBuffer(Blob *, const Datum&, const DEOptions&);
 // [ 5] int decode(ManagedDatum*, const StringRef&, Allocator*);
 // [ 5] int decode(ManagedDatum*, ostream*, const StringRef&, Allocator*);
 // [ 5] int decode(ManagedDatum*, streamBuf*, Allocator*);
 // [ 5] int decode(ManagedDatum*, ostream*, streamBuf*, Allocator*);
+// [ 7] int decodeBuffer(MD *, const StringRef&, StringMode);
+// [ 7] int decodeBuffer(MD *, ostream *, const StringRef&, StringMode);
 // ----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
 // [ 2] BREATHING DECODE TEST
 // [ 3] BREATHING ENCODE TEST
 // [ 4] BREATHING ROUND-TRIP TEST
-// [ 7] USAGE EXAMPLE
+// [ 9] USAGE EXAMPLE
+// [-1] DECODE BENCHMARK
+// [-2] ENCODE BENCHMARK
 
 // ============================================================================
 //                     STANDARD BDE ASSERT TEST FUNCTION
@@ -213,7 +232,7 @@ int main(int argc, char *argv[])
     bslma::TestAllocatorMonitor gam(&ga);
 
     switch (test) { case 0:
-      case 7: {
+      case 9: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //   Extracted from component header file.
@@ -412,6 +431,630 @@ int main(int argc, char *argv[])
 // Notice that the 'type' of "age" is 'double', since "age" was encoded as a
 // number, and 'double' is the supported representation of a JSON number (see
 // {'Supported Types'}).
+//
+///Example 3: Decoding JSON Held in a Buffer into an Arena
+///- - - - - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose that we receive JSON messages in a buffer, and need to inspect each
+// message only while its buffer is available.
+//
+// First, we create an arena, and a 'bdld::ManagedDatum' that allocates from
+// it:
+//..
+    bdlma::SequentialAllocator arena;
+    bdld::ManagedDatum         message(&arena);
+//..
+// Then, we decode a message, referring to the strings in the buffer rather
+// than copying them:
+//..
+    const bsl::string messageJSON = "{\"symbol\":\"IBM\",\"bid\":146.25}";
+
+    rc = baljsn::DatumUtil::decodeBuffer(
+                                      &message,
+                                      0,
+                                      messageJSON,
+                                      baljsn::DatumUtil::e_REFERENCE_STRINGS);
+    if (0 != rc) {
+        // handle error
+    }
+//..
+// Next, we observe that the value is the same as the one produced by
+// 'decode', and that the string refers to the buffer:
+//..
+    bdld::ManagedDatum expected;
+    rc = baljsn::DatumUtil::decode(&expected, messageJSON);
+    ASSERT(0        == rc);
+    ASSERT(expected == message);
+
+    const bdld::Datum symbol = *message->theMap().find("symbol");
+    ASSERT("IBM" == symbol.theString());
+    ASSERT(messageJSON.data() < symbol.theString().data());
+    ASSERT(messageJSON.data() + messageJSON.length() >
+                                                    symbol.theString().data());
+//..
+// Finally, once we are done with the message, we release the 'Datum' and all
+// of the memory allocated for it, before decoding the next message:
+//..
+    message.release();
+    arena.rewind();
+//..
+      } break;
+      case 8: {
+        // --------------------------------------------------------------------
+        // ENCODE BUFFER TEST
+        //   This case tests the 'encodeBuffer' methods.
+        //
+        // Concerns:
+        //: 1 'encodeBuffer' writes the same JSON text as 'encode', in both
+        //:   encoding styles, for all indentation options, and returns the
+        //:   same status (including for 'strictTypes').
+        //:
+        //: 2 Every character that 'encode' escapes is escaped, wherever it
+        //:   appears in a string (in particular, in any position of a block
+        //:   of 16 characters).
+        //:
+        //: 3 'encodeBuffer' appends the text to a 'bdlbb::Blob', whatever the
+        //:   size of its buffers.
+        //:
+        //: 4 Numbers are written with the shortest text that round-trips.
+        //:
+        //: 5 Invalid UTF-8, non-finite numbers, and unsupported types are
+        //:   errors, with no effect on the result.
+        //
+        // Plan:
+        //: 1 Using a table of datums, compare the output and status of
+        //:   'encodeBuffer' to that of 'encode' for several sets of options.
+        //:   (C-1)
+        //:
+        //: 2 Compare the output of 'encodeBuffer' and 'encode' for strings of
+        //:   all lengths up to 40 having each escaped character at each
+        //:   position.  (C-2)
+        //:
+        //: 3 Encode the table of datums into blobs, having a prefix, whose
+        //:   buffer sizes range from 1 to 64 bytes, and compare the contents
+        //:   of the blobs with the expected text.  (C-3)
+        //:
+        //: 4 Verify that 'decode' of the output of 'encodeBuffer' reproduces
+        //:   'double' values exactly, and check the text of some values.
+        //:   (C-4)
+        //:
+        //: 5 Encode invalid values and verify the status and that the result
+        //:   is unchanged.  (C-5)
+        //
+        // Testing:
+        //   int encodeBuffer(string *, const Datum&);
+        //   int encodeBuffer(string *, const Datum&, const DEOptions&);
+        //   int encodeBuffer(Blob *, const Datum&);
+        //   int encodeBuffer(Blob *, const Datum&, const DEOptions&);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl << "ENCODE BUFFER TEST" << endl
+                                  << "==================" << endl;
+
+        bdlma::SequentialAllocator sa(&ta);
+        bdld::DatumMaker           m(&sa);
+
+        const D DATA[] = {
+            m(),
+            m(true),
+            m(false),
+            m(1.5),
+            m(-0.25),
+            m(34.0),
+            m(1e-7),
+            m(""),
+            m("abc"),
+            m("\"quoted\" \\back\\ /slash/ \b\f\n\r\t \x01\x1f"),
+            m("caf\xc3\xa9 \xe2\x82\xac"),
+            m(STR64),
+            m.a(),
+            m.m(),
+            m.a(1.0, "two", true, m(), m.a(), m.m()),
+            m.a(m.a(m.a(m.a(1.0)), m.a())),
+            m.m("a", 1.0, "b", "x", "c", m.a(1.0, m.m("d", m()))),
+            m.m("a", m.m("b", m.m()), "c", m.a()),
+            m.m("key \"with\" / escapes\n", "value"),
+            m.a(m.m("name", "Homer", "age", 34.0),
+                m.m("name", "Marge", "age", 34.0)),
+            m(17),
+            m.a(m(bdlt::Date(2026, 10, 19))),
+            m.m("time", bdlt::Time(12, 34, 56, 789)),
+            m(bdlt::Datetime(2026, 10, 19, 1, 2, 3)),
+            m(bdlt::DatetimeInterval(1, 2, 3, 4, 5)),
+            m(bsls::Types::Int64(1234567)),
+            m(bdldfp::Decimal64(BDLDFP_DECIMAL_DD(1.25))),
+        };
+        const int NUM_DATA = static_cast<int>(sizeof DATA / sizeof *DATA);
+
+        static const struct {
+            int  d_line;
+            bool d_pretty;
+            int  d_initialIndentLevel;
+            int  d_spacesPerLevel;
+            bool d_strictTypes;
+        } OPTIONS[] = {
+            //LINE  PRETTY  LEVEL  SPACES  STRICT
+            //----  ------  -----  ------  ------
+            { L_,   false,  0,     0,      false  },
+            { L_,   false,  2,     4,      true   },
+            { L_,   true,   0,     4,      false  },
+            { L_,   true,   0,     0,      false  },
+            { L_,   true,   1,     2,      true   },
+            { L_,   true,   3,     1,      false  },
+            { L_,   true,   2,     3,      true   },
+        };
+        const int NUM_OPTIONS = static_cast<int>(sizeof OPTIONS
+                                                 / sizeof *OPTIONS);
+
+        if (verbose) cout << "\nCompare with 'encode'." << endl;
+
+        for (int oi = 0; oi < NUM_OPTIONS; ++oi) {
+            const int LINE = OPTIONS[oi].d_line;
+
+            baljsn::DatumEncoderOptions options;
+            options.setEncodingStyle(OPTIONS[oi].d_pretty
+                                     ? baljsn::EncodingStyle::e_PRETTY
+                                     : baljsn::EncodingStyle::e_COMPACT);
+            options.setInitialIndentLevel(OPTIONS[oi].d_initialIndentLevel);
+            options.setSpacesPerLevel(OPTIONS[oi].d_spacesPerLevel);
+            options.setStrictTypes(OPTIONS[oi].d_strictTypes);
+
+            for (int ti = 0; ti < NUM_DATA; ++ti) {
+                const D& DATUM = DATA[ti];
+
+                bsl::string expected(&ta);
+                const int   expectedRc = Util::encode(&expected,
+                                                      DATUM,
+                                                      options);
+
+                bsl::string result("old value", &ta);
+                const int   rc = Util::encodeBuffer(&result, DATUM, options);
+
+                if (veryVerbose) { T_ P_(LINE) P_(ti) P(result) }
+
+                ASSERTV(LINE, ti, expectedRc, rc, expectedRc == rc);
+                ASSERTV(LINE, ti, expected, result, expected == result);
+
+                if (0 == oi) {
+                    bsl::string defaulted(&ta);
+                    ASSERTV(ti, rc == Util::encodeBuffer(&defaulted, DATUM));
+                    ASSERTV(ti, result == defaulted);
+                }
+            }
+        }
+
+        if (verbose) cout << "\nEscapes in all positions." << endl;
+        {
+            static const char ESCAPED[] = "\"\\/\b\f\n\r\t\x01\x1f";
+
+            bsl::string value(&ta);
+            bsl::string expected(&ta);
+            bsl::string result(&ta);
+
+            for (int length = 1; length <= 40; ++length) {
+                for (int ei = 0; ei < static_cast<int>(sizeof ESCAPED - 1);
+                                                                        ++ei) {
+                    for (int position = 0; position < length; ++position) {
+                        value.assign(length, 'x');
+                        value[position] = ESCAPED[ei];
+                        if (position + 3 < length) {
+                            value[position + 3] = '"';
+                        }
+
+                        const D DATUM = D::createStringRef(value, &ta);
+
+                        ASSERTV(0 == Util::encode(&expected, DATUM));
+                        ASSERTV(0 == Util::encodeBuffer(&result, DATUM));
+                        ASSERTV(length, ei, position, expected, result,
+                                expected == result);
+                    }
+                }
+            }
+        }
+
+        if (verbose) cout << "\nEncoding into blobs." << endl;
+        {
+            baljsn::DatumEncoderOptions options;
+            options.setEncodingStyle(baljsn::EncodingStyle::e_PRETTY);
+
+            for (int bufferSize = 1; bufferSize <= 64; bufferSize *= 2) {
+                for (int extra = 0; extra < 2; ++extra) {
+                    const int SIZE = bufferSize + extra;
+
+                    bdlbb::SimpleBlobBufferFactory factory(SIZE, &ta);
+
+                    for (int ti = 0; ti < NUM_DATA; ++ti) {
+                        const D& DATUM = DATA[ti];
+
+                        bsl::string expected("prefix", &ta);
+                        bsl::string text(&ta);
+                        ASSERTV(0 <= Util::encodeBuffer(&text,
+                                                        DATUM,
+                                                        options));
+                        expected += text;
+
+                        bdlbb::Blob blob(&factory, &ta);
+                        bdlbb::BlobUtil::append(&blob, "prefix", 6);
+
+                        const int rc = Util::encodeBuffer(&blob,
+                                                          DATUM,
+                                                          options);
+                        ASSERTV(SIZE, ti, rc, 0 <= rc);
+
+                        bsl::string result(blob.length(), '\0', &ta);
+                        bdlbb::BlobUtil::copy(&result[0],
+                                              blob,
+                                              0,
+                                              blob.length());
+                        ASSERTV(SIZE, ti, expected, result,
+                                expected == result);
+
+                        if (1 == SIZE) {
+                            bdlbb::Blob defaulted(&factory, &ta);
+                            ASSERTV(ti, rc == Util::encodeBuffer(&defaulted,
+                                                                 DATUM));
+                        }
+                    }
+                }
+            }
+        }
+
+        if (verbose) cout << "\nShortest round-trip numbers." << endl;
+        {
+            static const struct {
+                int         d_line;
+                double      d_value;
+                const char *d_text_p;
+            } NUMBERS[] = {
+                //LINE  VALUE                     TEXT
+                //----  -----                     ----
+                { L_,   0.1,                      "0.1"                  },
+                { L_,   1.0 / 3,                  "0.3333333333333333"   },
+                { L_,   -2.5e-300,                "-2.5e-300"            },
+                { L_,   123456789012345680.0,     "1.2345678901234568e+17"
+                                                                         },
+                { L_,   1e15,                     "1000000000000000"     },
+            };
+            const int NUM_NUMBERS = static_cast<int>(sizeof NUMBERS
+                                                     / sizeof *NUMBERS);
+
+            for (int ti = 0; ti < NUM_NUMBERS; ++ti) {
+                const int    LINE  = NUMBERS[ti].d_line;
+                const double VALUE = NUMBERS[ti].d_value;
+                const char  *TEXT  = NUMBERS[ti].d_text_p;
+
+                bsl::string result(&ta);
+                ASSERTV(LINE, 0 == Util::encodeBuffer(&result, m(VALUE)));
+                ASSERTV(LINE, TEXT, result, TEXT == result);
+
+                MD decoded(&ta);
+                ASSERTV(LINE, 0 == Util::decode(&decoded, result));
+                ASSERTV(LINE, decoded->isDouble());
+                ASSERTV(LINE, VALUE == decoded->theDouble());
+            }
+        }
+
+        if (verbose) cout << "\nErrors." << endl;
+        {
+            const D ERRORS[] = {
+                m("invalid \xc3 UTF-8"),
+                m.a(1.0, m("\xff")),
+                m.m("\xe2\x82", 1.0),
+                m(bsl::numeric_limits<double>::infinity()),
+                m.a(bsl::numeric_limits<double>::quiet_NaN()),
+                m(bdld::DatumError(1)),
+                m.m("udt", bdld::DatumUdt(0, 1)),
+            };
+            const int NUM_ERRORS = static_cast<int>(sizeof ERRORS
+                                                    / sizeof *ERRORS);
+
+            bdlbb::SimpleBlobBufferFactory factory(8, &ta);
+
+            for (int ti = 0; ti < NUM_ERRORS; ++ti) {
+                bsl::string result("unchanged", &ta);
+                ASSERTV(ti, 0 > Util::encodeBuffer(&result, ERRORS[ti]));
+                ASSERTV(ti, result, "unchanged" == result);
+
+                bdlbb::Blob blob(&factory, &ta);
+                bdlbb::BlobUtil::append(&blob, "unchanged", 9);
+                ASSERTV(ti, 0 > Util::encodeBuffer(&blob, ERRORS[ti]));
+                ASSERTV(ti, blob.length(), 9 == blob.length());
+            }
+        }
+      } break;
+      case 7: {
+        // --------------------------------------------------------------------
+        // DECODE BUFFER TEST
+        //   This case tests the 'decodeBuffer' methods.
+        //
+        // Concerns:
+        //: 1 'decodeBuffer' produces the same 'Datum', and fails for the same
+        //:   JSON text, as 'decode', in both string modes.
+        //:
+        //: 2 A string containing an invalid escape sequence or an unescaped
+        //:   control character, or text following the value, is an error for
+        //:   'decodeBuffer'.
+        //:
+        //: 3 The first of any duplicate keys is kept, in both small and large
+        //:   objects.
+        //:
+        //: 4 In 'e_REFERENCE_STRINGS' mode, strings without escape sequences,
+        //:   and keys, refer to the input; strings with escape sequences, and
+        //:   all strings in 'e_COPY_STRINGS' mode, do not.
+        //:
+        //: 5 All memory for the result is allocated from the allocator of the
+        //:   result, no memory is allocated from the default allocator for
+        //:   small inputs, and no memory is leaked when decoding fails.
+        //:
+        //: 6 Errors are reported, with their offset, to the error stream.
+        //
+        // Plan:
+        //: 1 Using a table of valid and invalid JSON text, compare the
+        //:   results of 'decodeBuffer', in both modes, to those of 'decode'.
+        //:   (C-1)
+        //:
+        //: 2 Decode strings with invalid escape sequences and control
+        //:   characters, and values followed by text, and verify that
+        //:   'decodeBuffer' fails.  (C-2)
+        //:
+        //: 3 Decode objects with duplicate keys, having fewer and more than
+        //:   16 members, and verify the values of the keys.  (C-3)
+        //:
+        //: 4 Compare the addresses of decoded strings and keys to the input.
+        //:   (C-4)
+        //:
+        //: 5 Use 'TestAllocator's to verify that memory is allocated as
+        //:   expected and is not leaked.  (C-5)
+        //:
+        //: 6 Verify the output written to an error stream.  (C-6)
+        //
+        // Testing:
+        //   int decodeBuffer(MD *, const StringRef&, StringMode);
+        //   int decodeBuffer(MD *, ostream *, const StringRef&, StringMode);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl << "DECODE BUFFER TEST" << endl
+                                  << "==================" << endl;
+
+        if (verbose) cout << "\nCompare with 'decode'." << endl;
+        {
+            static const struct {
+                int         d_line;
+                const char *d_json_p;
+            } DATA[] = {
+                //LINE  JSON
+                //----  ----
+                { L_,   ""                                                },
+                { L_,   "   "                                             },
+                { L_,   "null"                                            },
+                { L_,   " \t\n\v\f\rtrue \t\n\v\f\r"                      },
+                { L_,   "false"                                           },
+                { L_,   "-3.14159e-1"                                     },
+                { L_,   "3e15"                                            },
+                { L_,   "\"\""                                            },
+                { L_,   "\"abc\""                                         },
+                { L_,   "\"a\\\"b\\\\c\\/d\\be\\ff\\ng\\rh\\ti\""         },
+                { L_,   "\"\\u0041\\u00e9\\u20AC\""                       },
+                { L_,   "[]"                                              },
+                { L_,   "[ ]"                                             },
+                { L_,   "{}"                                              },
+                { L_,   "{ }"                                             },
+                { L_,   "[1,\"two\",true,false,null,[],{}]"               },
+                { L_,   "[ [ [ [ 1 ] ] , [ ] ] ]"                         },
+                { L_,   "{\"a\":1,\"b\":\"x\",\"c\":[1,{\"d\":null}]}"    },
+                { L_,   "{ \"a\" : 1 , \"b\" : { \"c\" : { } } }"         },
+                { L_,   "{\"a\":1,\"a\":2,\"b\":3,\"a\":4}"               },
+                { L_,   "{\"a\\\"b\":1,\"a\\u0041\":2}"                   },
+                { L_,   "[\"\\u0041\",\"plain\",{\"k\":\"\\n\"}]"         },
+                { L_,   "nul"                                             },
+                { L_,   "nulll"                                           },
+                { L_,   "1.2.3"                                           },
+                { L_,   "[1 2]"                                           },
+                { L_,   "[1,]"                                            },
+                { L_,   "[,1]"                                            },
+                { L_,   "[1"                                              },
+                { L_,   "[1,"                                             },
+                { L_,   "]"                                               },
+                { L_,   "{\"a\":1,}"                                      },
+                { L_,   "{\"a\" 1}"                                       },
+                { L_,   "{\"a\":}"                                        },
+                { L_,   "{\"a\":1"                                        },
+                { L_,   "{a:1}"                                           },
+                { L_,   "{1:1}"                                           },
+                { L_,   "{\"a\":1}}"                                      },
+                { L_,   "\"abc"                                           },
+                { L_,   "\"abc\\\""                                       },
+                { L_,   ":"                                               },
+                { L_,   ","                                               },
+            };
+            const int NUM_DATA = static_cast<int>(sizeof DATA / sizeof *DATA);
+
+            for (int ti = 0; ti < NUM_DATA; ++ti) {
+                const int   LINE = DATA[ti].d_line;
+                const char *JSON = DATA[ti].d_json_p;
+
+                if (veryVerbose) { T_ P_(LINE) P(JSON) }
+
+                MD  expected(&ta);
+                int expectedRc = Util::decode(&expected, JSON);
+
+                for (int mode = 0; mode < 2; ++mode) {
+                    const Util::StringMode MODE = mode
+                                                ? Util::e_REFERENCE_STRINGS
+                                                : Util::e_COPY_STRINGS;
+
+                    bslma::TestAllocator         sa("scratch",
+                                                    veryVeryVeryVerbose);
+                    bslma::DefaultAllocatorGuard dag(&sa);
+                    bslma::TestAllocator         oa("object",
+                                                    veryVeryVeryVerbose);
+                    {
+                        MD  result(D::createInteger(-1), &oa);
+                        int rc = Util::decodeBuffer(&result, JSON, MODE);
+
+                        ASSERTV(LINE, mode, rc, expectedRc,
+                                (0 == rc) == (0 == expectedRc));
+                        if (0 == rc) {
+                            ASSERTV(LINE, mode, expected, result,
+                                    expected == result);
+                        }
+                        else {
+                            ASSERTV(LINE, mode, rc, 0 > rc);
+                            ASSERTV(LINE, mode, result,
+                                    D::createInteger(-1) == *result);
+                        }
+                    }
+                    ASSERTV(LINE, mode, oa.numBytesInUse(),
+                            0 == oa.numBytesInUse());
+                    ASSERTV(LINE, mode, sa.numBlocksTotal(),
+                            0 == sa.numBlocksTotal());
+                }
+            }
+
+            // Large inputs.
+
+            const char *LONG_DATA[] = { LONG_JSON_ARRAY, LONG_JSON_OBJECT };
+
+            for (int ti = 0; ti < 2; ++ti) {
+                MD expected(&ta);
+                ASSERTV(ti, 0 == Util::decode(&expected, LONG_DATA[ti]));
+
+                MD result(&ta);
+                ASSERTV(ti, 0 == Util::decodeBuffer(&result, LONG_DATA[ti]));
+                ASSERTV(ti, expected == result);
+            }
+        }
+
+        if (verbose) cout << "\nInvalid strings and trailing text." << endl;
+        {
+            static const char *DATA[] = {
+                "1 2",
+                "1 x",
+                "[1] [2]",
+                "{\"a\":1} x",
+                "\"a\" 2",
+                "\"\\x\"",
+                "\"\\u004\"",
+                "\"\\u00G1\"",
+                "\"a\tb\"",
+                "[\"\\q\"]",
+                "{\"a\":\"\\q\"}",
+            };
+            const int NUM_DATA = static_cast<int>(sizeof DATA / sizeof *DATA);
+
+            for (int ti = 0; ti < NUM_DATA; ++ti) {
+                const char *JSON = DATA[ti];
+
+                MD result(&ta);
+                ASSERTV(JSON, 0 != Util::decodeBuffer(&result, JSON));
+                ASSERTV(JSON, result->isNull());
+            }
+            ASSERTV(ta.numBytesInUse(), 0 == ta.numBytesInUse());
+        }
+
+        if (verbose) cout << "\nDuplicate keys." << endl;
+        {
+            for (int numMembers = 1; numMembers <= 40; ++numMembers) {
+                // Create an object having 'numMembers' distinct keys, each of
+                // which is then repeated with a different value.
+
+                bsl::string json = "{";
+                for (int pass = 0; pass < 2; ++pass) {
+                    for (int i = 0; i < numMembers; ++i) {
+                        if (pass || i) {
+                            json += ',';
+                        }
+                        json += "\"k" + bsl::to_string(i) + "\":";
+                        json += pass ? "-1" : bsl::to_string(i);
+                    }
+                }
+                json += '}';
+
+                MD result(&ta);
+                ASSERTV(numMembers, 0 == Util::decodeBuffer(&result, json));
+
+                ASSERTV(numMembers, result->isMap());
+                const DMR map = result->theMap();
+                ASSERTV(numMembers, map.size(),
+                        static_cast<bsl::size_t>(numMembers) == map.size());
+                for (int i = 0; i < numMembers; ++i) {
+                    ASSERTV(numMembers, i, map[i].value().isDouble());
+                    ASSERTV(numMembers, i, map[i].value().theDouble(),
+                            i == map[i].value().theDouble());
+                }
+            }
+        }
+
+        if (verbose) cout << "\nReferenced strings." << endl;
+        {
+            const bsl::string JSON(
+                            "{\"plain\":\"abc\",\"esc\":\"a\\nc\",\"\":\"\"}",
+                            &ta);
+            const char *BEGIN = JSON.data();
+            const char *END   = JSON.data() + JSON.length();
+
+            for (int mode = 0; mode < 2; ++mode) {
+                const Util::StringMode MODE = mode
+                                            ? Util::e_REFERENCE_STRINGS
+                                            : Util::e_COPY_STRINGS;
+
+                MD result(&ta);
+                ASSERTV(mode, 0 == Util::decodeBuffer(&result, JSON, MODE));
+
+                const DMR map = result->theMap();
+                ASSERTV(mode, 3 == map.size());
+
+                const bslstl::StringRef key   = map[0].key();
+                const bslstl::StringRef plain = map[0].value().theString();
+                const bslstl::StringRef esc   = map[1].value().theString();
+
+                ASSERTV(mode, "plain" == key);
+                ASSERTV(mode, "abc"   == plain);
+                ASSERTV(mode, "a\nc"  == esc);
+                ASSERTV(mode, ""      == map[2].value().theString());
+
+                const bool isKeyInInput = BEGIN <= key.data()
+                                       && key.data() < END;
+                const bool isPlainInInput = BEGIN <= plain.data()
+                                         && plain.data() < END;
+                const bool isEscInInput = BEGIN <= esc.data()
+                                       && esc.data() < END;
+
+                ASSERTV(mode, isKeyInInput,   mode == isKeyInInput);
+                ASSERTV(mode, isPlainInInput, mode == isPlainInInput);
+                ASSERTV(mode, isEscInInput,   !isEscInInput);
+            }
+        }
+
+        if (verbose) cout << "\nError stream." << endl;
+        {
+            static const struct {
+                int         d_line;
+                const char *d_json_p;
+                const char *d_message_p;
+            } DATA[] = {
+                //LINE  JSON          MESSAGE
+                //----  ----          -------
+                { L_,   "",           "Expected a value at offset 0\n"     },
+                { L_,   "[1 2]",      "Expected ',' or ']' at offset 3\n"  },
+                { L_,   "{\"a\" 1}",  "Expected ':' at offset 5\n"         },
+                { L_,   "[1,nil]",    "Invalid value at offset 3\n"        },
+                { L_,   " \"\\q\"",   "Invalid string at offset 1\n"       },
+                { L_,   "1 2",        "Unexpected text after value at offset "
+                                      "2\n"                                },
+            };
+            const int NUM_DATA = static_cast<int>(sizeof DATA / sizeof *DATA);
+
+            for (int ti = 0; ti < NUM_DATA; ++ti) {
+                const int   LINE    = DATA[ti].d_line;
+                const char *JSON    = DATA[ti].d_json_p;
+                const char *MESSAGE = DATA[ti].d_message_p;
+
+                bsl::ostringstream errors;
+                MD                 result(&ta);
+                ASSERTV(LINE, 0 != Util::decodeBuffer(&result, &errors, JSON));
+                ASSERTV(LINE, errors.str(), MESSAGE == errors.str());
+            }
+        }
       } break;
       case 6: {
         //---------------------------------------------------------------------
@@ -2013,6 +2656,207 @@ int main(int argc, char *argv[])
         ASSERTV(datum, other, datum == other);
 
       } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // DECODE BENCHMARK
+        //   Compare the speed of 'decode' and 'decodeBuffer'.
+        //
+        // Concerns:
+        //: 1 'decodeBuffer' is faster than 'decode' for the same input.
+        //
+        // Plan:
+        //: 1 Decode a document of records, each having strings, numbers, and
+        //:   a nested array, repeatedly with 'decode' and with 'decodeBuffer'
+        //:   in both modes, allocating from an arena rewound after each
+        //:   iteration, and report the best time of several runs.  (C-1)
+        //
+        // Testing:
+        //   DECODE BENCHMARK
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl << "DECODE BENCHMARK" << endl
+                                  << "================" << endl;
+
+        const int NUM_RECORDS    = argc > 2 ? atoi(argv[2]) : 1000;
+        const int NUM_ITERATIONS = argc > 3 ? atoi(argv[3]) : 20;
+        const int NUM_RUNS       = 5;
+
+        bsl::string json("[");
+        for (int i = 0; i < NUM_RECORDS; ++i) {
+            if (i) {
+                json += ",";
+            }
+            json += "{\"id\":" + bsl::to_string(i) +
+                    ",\"name\":\"Employee number " + bsl::to_string(i) +
+                    "\",\"title\":\"Senior \\\"Software\\\" Engineer\""
+                    ",\"salary\":" + bsl::to_string(50000 + i) + ".25"
+                    ",\"active\":true,\"manager\":null"
+                    ",\"skills\":[\"C++\",\"JSON\",\"XML\"]}";
+        }
+        json += "]";
+
+        bdlma::SequentialAllocator arena;
+
+        for (int method = 0; method < 3; ++method) {
+            static const char *const NAMES[] = {
+                "decode", "decodeBuffer(copy)", "decodeBuffer(reference)"
+            };
+
+            double best = 0;
+            for (int run = 0; run < NUM_RUNS; ++run) {
+                bsls::Stopwatch timer;
+                timer.start();
+                for (int i = 0; i < NUM_ITERATIONS; ++i) {
+                    MD  result(&arena);
+                    int rc = 0 == method
+                           ? Util::decode(&result, json)
+                           : Util::decodeBuffer(
+                                           &result,
+                                           json,
+                                           1 == method
+                                           ? Util::e_COPY_STRINGS
+                                           : Util::e_REFERENCE_STRINGS);
+                    ASSERTV(method, rc, 0 == rc);
+                    result.release();
+                    arena.rewind();
+                }
+                timer.stop();
+
+                const double elapsed = timer.elapsedTime();
+                if (0 == run || elapsed < best) {
+                    best = elapsed;
+                }
+            }
+
+            const double mbPerSecond = static_cast<double>(json.length())
+                                     * NUM_ITERATIONS / best / 1.0e6;
+            cout << NAMES[method] << ": " << mbPerSecond << " MB/s" << endl;
+        }
+      } break;
+      case -2: {
+        // --------------------------------------------------------------------
+        // ENCODE BENCHMARK
+        //   Compare the speed of 'encode' and 'encodeBuffer'.
+        //
+        // Concerns:
+        //: 1 'encodeBuffer' is faster than 'encode' for wide and deep maps.
+        //
+        // Plan:
+        //: 1 Create a wide map, having many members with string and number
+        //:   values, and a deep map, having maps nested in maps, and encode
+        //:   each repeatedly with 'encode' and with 'encodeBuffer' into a
+        //:   'bsl::string' and into a 'bdlbb::Blob', reporting the best time
+        //:   of several runs.  (C-1)
+        //
+        // Testing:
+        //   ENCODE BENCHMARK
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl << "ENCODE BENCHMARK" << endl
+                                  << "================" << endl;
+
+        const int NUM_MEMBERS    = argc > 2 ? atoi(argv[2]) : 10000;
+        const int DEPTH          = argc > 3 ? atoi(argv[3]) : 200;
+        const int NUM_ITERATIONS = argc > 4 ? atoi(argv[4]) : 20;
+        const int NUM_RUNS       = 5;
+
+        bdlma::SequentialAllocator arena;
+
+        // A wide map, whose values are strings (some needing escapes) and
+        // numbers.
+
+        bdld::DatumMapBuilder wideBuilder(&arena);
+        for (int i = 0; i < NUM_MEMBERS; ++i) {
+            const bsl::string key = "member" + bsl::to_string(i);
+            const bsl::string value = i % 4
+                                    ? "a plain string value number "
+                                      + bsl::to_string(i)
+                                    : "an \"escaped\"\tvalue";
+            wideBuilder.pushBack(
+                         D::copyString(key, &arena).theString(),
+                         i % 2 ? D::copyString(value, &arena)
+                               : D::createDouble(i * 1.25));
+        }
+        const D wide = wideBuilder.commit();
+
+        // A deep map, each level of which has a few scalar members and a
+        // member holding the next level.
+
+        D deep = D::createNull();
+        for (int i = 0; i < DEPTH; ++i) {
+            DMB levelBuilder(&arena);
+            levelBuilder.pushBack("level", D::createDouble(i));
+            levelBuilder.pushBack("name", D::createStringRef("nested",
+                                                             &arena));
+            levelBuilder.pushBack("flag", D::createBoolean(i % 2));
+            levelBuilder.pushBack("next", deep);
+            deep = levelBuilder.commit();
+        }
+
+        const D     *DOCUMENTS[] = { &wide, &deep };
+        const char  *DOC_NAMES[] = { "wide", "deep" };
+
+        baljsn::DatumEncoderOptions options;
+        bdlbb::PooledBlobBufferFactory factory(4096);
+
+        for (int di = 0; di < 2; ++di) {
+            for (int pretty = 0; pretty < 2; ++pretty) {
+                options.setEncodingStyle(pretty
+                                         ? baljsn::EncodingStyle::e_PRETTY
+                                         : baljsn::EncodingStyle::e_COMPACT);
+                options.setSpacesPerLevel(pretty ? 2 : 0);
+
+                bsl::size_t length = 0;
+
+                for (int method = 0; method < 3; ++method) {
+                    static const char *const NAMES[] = {
+                        "encode", "encodeBuffer(string)", "encodeBuffer(blob)"
+                    };
+
+                    double best = 0;
+                    for (int run = 0; run < NUM_RUNS; ++run) {
+                        bsl::string     result;
+                        bsls::Stopwatch timer;
+                        timer.start();
+                        for (int i = 0; i < NUM_ITERATIONS; ++i) {
+                            int rc = 0;
+                            if (2 == method) {
+                                bdlbb::Blob blob(&factory);
+                                rc = Util::encodeBuffer(&blob,
+                                                        *DOCUMENTS[di],
+                                                        options);
+                                length = blob.length();
+                            }
+                            else {
+                                rc = 0 == method
+                                   ? Util::encode(&result,
+                                                  *DOCUMENTS[di],
+                                                  options)
+                                   : Util::encodeBuffer(&result,
+                                                        *DOCUMENTS[di],
+                                                        options);
+                                length = result.length();
+                            }
+                            ASSERTV(method, rc, 0 == rc);
+                        }
+                        timer.stop();
+
+                        const double elapsed = timer.elapsedTime();
+                        if (0 == run || elapsed < best) {
+                            best = elapsed;
+                        }
+                    }
+
+                    cout << DOC_NAMES[di]
+                         << (pretty ? " pretty " : " compact ")
+                         << NAMES[method] << ": "
+                         << static_cast<double>(length) * NUM_ITERATIONS
+                                                                 / best / 1e6
+                         << " MB/s" << endl;
+                }
+            }
+        }
+      } break;
       default: {
         cerr << "WARNING: CASE '" << test << "' NOT FOUND." << endl;
         testStatus = -1;
@@ -28,6 +28,10 @@
 
 #include <bslmt_threadutil.h>
 
+#include <bdlma_sequentialallocator.h>
+#include <bslma_testallocator.h>
+#include <bsls_stopwatch.h>
+
 // These header are for testing only and the hierarchy level of 'baljsn' was
 // increase because of them.  They should be remove when possible.
 #include <balb_testmessages.h>
@@ -75,9 +79,13 @@ using bsl::endl;
 //
 // ACCESSORS
 // [ 4] bsl::string loggedMessages() const;
+//
+// CLASS METHODS
+// [ 9] static bsl::size_t arenaSizeHint(bsl::size_t length);
 // ----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
-// [ 7] USAGE EXAMPLE
+// [10] USAGE EXAMPLE
+// [-1] ARENA DECODING PERFORMANCE TEST
 // [ 5] MULTI-THREADING TEST CASE
 // [ 6] DRQS 43702912
 
@@ -37678,7 +37686,7 @@ int main(int argc, char *argv[])
     cout << "TEST " << __FILE__ << " CASE " << test << endl;
 
     switch (test) { case 0:  // Zero is always the leading case.
-      case 9: {
+      case 10: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //   Extracted from component header file.
@@ -37784,6 +37792,182 @@ int main(int argc, char *argv[])
     ASSERT("New York"      == employee.homeAddress().state());
     ASSERT(21              == employee.age());
 //..
+//
+///Example 2: Decoding Request-Scoped Messages into an Arena
+///---------------------------------------------------------
+// Suppose that a service decodes a large number of 'test::Employee' messages,
+// each of which is processed and then discarded.
+//
+// First, we create, once, the decoder and its options, and an arena
+// allocator from which the decoded objects will be allocated:
+//..
+    {
+    baljsn::Decoder            decoder;
+    baljsn::DecoderOptions     options;
+    bdlma::SequentialAllocator arena;
+//..
+// Then, for each message, we reserve in the arena the memory the decoded
+// object is expected to use, estimated from the length of the message:
+//..
+    const char MESSAGE[] = "{\"name\":\"Alice\",\"homeAddress\":{\"street\":"
+                           "\"Fifth Ave\",\"city\":\"New York City\","
+                           "\"state\":\"New York\"},\"age\":34}";
+    const bsl::size_t LENGTH = sizeof MESSAGE - 1;
+
+    arena.reserveCapacity(baljsn::Decoder::arenaSizeHint(LENGTH));
+//..
+// Next, we decode the message into an object using the arena:
+//..
+    {
+        test::Employee             employee(&arena);
+        bdlsb::FixedMemInStreamBuf isb(MESSAGE, LENGTH);
+
+        const int rc = decoder.decode(&isb, &employee, options);
+        ASSERT(0                 == rc);
+        ASSERT("Alice"           == employee.name());
+        ASSERT("Fifth Ave"       == employee.homeAddress().street());
+        ASSERT(34                == employee.age());
+//..
+// Then, we process the message, and destroy the object at the end of its
+// scope (which returns no memory, as an arena does not reuse deallocated
+// memory):
+//..
+    }
+//..
+// Finally, we reclaim all the memory used by the message, keeping it in the
+// arena for the next message:
+//..
+    arena.rewind();
+//..
+    }
+      } break;
+      case 9: {
+        // --------------------------------------------------------------------
+        // TESTING ARENA DECODING
+        //
+        // Concerns:
+        //: 1 'arenaSizeHint' is at least the length of the input, and
+        //:   increases with it.
+        //:
+        //: 2 An object allocated from an arena allocator is decoded to the
+        //:   same value as an object using the default allocator.
+        //:
+        //: 3 For typical messages, reserving 'arenaSizeHint' bytes in a
+        //:   'bdlma::SequentialAllocator' before decoding suffices for the
+        //:   allocations of the decoded object.
+        //:
+        //: 4 A decoder that is reused allocates no memory to decode a message
+        //:   no larger than one it has already decoded.
+        //
+        // Plan:
+        //: 1 Check 'arenaSizeHint' for a set of lengths.  (C-1)
+        //:
+        //: 2 For each of the JSON messages of the 'balb::FeatureTestMessage'
+        //:   test data, in the compact and pretty formats, decode the message
+        //:   into an object allocated from a 'bdlma::SequentialAllocator'
+        //:   using a test allocator, after reserving 'arenaSizeHint' bytes,
+        //:   and check that the value is the expected one.  Count the
+        //:   messages for which the test allocator was used only for the
+        //:   reservation, and check that they are nearly all of them.
+        //:   (C-2..3)
+        //:
+        //: 3 Decode each message twice with a decoder using a test allocator,
+        //:   and check that the second call allocates no memory.  (C-4)
+        //
+        // Testing:
+        //   static bsl::size_t arenaSizeHint(bsl::size_t length);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING ARENA DECODING" << endl
+                          << "======================" << endl;
+
+        if (verbose) cout << "\nTesting 'arenaSizeHint'." << endl;
+        {
+            bsl::size_t prevHint = 0;
+            for (bsl::size_t length = 0; length < 100000; length += 997) {
+                const bsl::size_t HINT = Decoder::arenaSizeHint(length);
+
+                ASSERTV(length, HINT, length <= HINT);
+                ASSERTV(length, HINT, prevHint, 0 == length
+                                             || prevHint < HINT);
+                prevHint = HINT;
+            }
+        }
+
+        if (verbose) cout << "\nDecoding into an arena." << endl;
+
+        bsl::vector<balb::FeatureTestMessage> testObjects;
+        constructFeatureTestMessage(&testObjects);
+
+        int numMessages = 0;
+        int numCovered  = 0;
+
+        for (int ti = 0; ti < NUM_JSON_COMPACT_MESSAGES; ++ti) {
+            for (int pretty = 0; pretty < 2; ++pretty) {
+                const int          LINE  = pretty
+                                           ? JSON_PRETTY_MESSAGES[ti].d_line
+                                           : JSON_COMPACT_MESSAGES[ti].d_line;
+                const bsl::string& INPUT = pretty
+                                        ? JSON_PRETTY_MESSAGES[ti].d_input_p
+                                        : JSON_COMPACT_MESSAGES[ti].d_input_p;
+                const balb::FeatureTestMessage& EXP = testObjects[ti];
+
+                bslma::TestAllocator       ta("arena");
+                bdlma::SequentialAllocator arena(&ta);
+                DecoderOptions             options;
+                Decoder                    decoder;
+
+                arena.reserveCapacity(Decoder::arenaSizeHint(INPUT.length()));
+
+                const bsls::Types::Int64 NUM_BLOCKS = ta.numAllocations();
+                {
+                    balb::FeatureTestMessage   value(&arena);
+                    bdlsb::FixedMemInStreamBuf isb(INPUT.data(),
+                                                   INPUT.length());
+
+                    const int rc = decoder.decode(&isb, &value, options);
+                    ASSERTV(LINE, decoder.loggedMessages(), 0 == rc);
+                    ASSERTV(LINE, EXP, value, EXP == value);
+                }
+
+                ++numMessages;
+                if (NUM_BLOCKS == ta.numAllocations()) {
+                    ++numCovered;
+                }
+                else if (veryVerbose) {
+                    T_ P_(LINE) P(INPUT.length())
+                }
+            }
+        }
+
+        if (verbose) { P_(numMessages) P(numCovered) }
+        ASSERTV(numMessages, numCovered, numMessages * 9 <= numCovered * 10);
+
+        if (verbose) cout << "\nReusing a decoder." << endl;
+        {
+            bslma::TestAllocator ta("decoder");
+            Decoder              decoder(&ta);
+            DecoderOptions       options;
+
+            for (int ti = 0; ti < NUM_JSON_PRETTY_MESSAGES; ++ti) {
+                const int          LINE  = JSON_PRETTY_MESSAGES[ti].d_line;
+                const bsl::string& INPUT = JSON_PRETTY_MESSAGES[ti].d_input_p;
+
+                for (int i = 0; i < 2; ++i) {
+                    const bsls::Types::Int64 NUM_ALLOCS = ta.numAllocations();
+
+                    balb::FeatureTestMessage   value;
+                    bdlsb::FixedMemInStreamBuf isb(INPUT.data(),
+                                                   INPUT.length());
+
+                    ASSERTV(LINE, 0 == decoder.decode(&isb, &value, options));
+
+                    ASSERTV(LINE, i, NUM_ALLOCS, ta.numAllocations(),
+                            0 == i || NUM_ALLOCS == ta.numAllocations());
+                }
+            }
+        }
       } break;
       case 8: {
         // ------------------------------------------------------------------
@@ -40199,6 +40383,84 @@ int main(int argc, char *argv[])
             ASSERT(21            == bob.age());
         }
       } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // ARENA DECODING PERFORMANCE TEST
+        //
+        // Concerns:
+        //: 1 Decoding request-scoped messages into objects allocated from an
+        //:   arena, which is rewound after each message, is faster than
+        //:   decoding into objects using the default allocator.
+        //
+        // Plan:
+        //: 1 Decode each of the compact JSON messages of the
+        //:   'balb::FeatureTestMessage' test data a number of times
+        //:   (optionally specified on the command line) into a new object
+        //:   using the default allocator, and into a new object using a
+        //:   'bdlma::SequentialAllocator' sized by 'arenaSizeHint' and rewound
+        //:   after each message, and report the best time of several runs of
+        //:   each.  (C-1)
+        //
+        // Testing:
+        //   ARENA DECODING PERFORMANCE TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "ARENA DECODING PERFORMANCE TEST" << endl
+                          << "===============================" << endl;
+
+        const int NUM_ITERATIONS = argc > 2 ? atoi(argv[2]) : 200;
+        const int NUM_RUNS       = 5;
+
+        bsl::vector<balb::FeatureTestMessage> testObjects;
+        constructFeatureTestMessage(&testObjects);
+
+        Decoder        decoder;
+        DecoderOptions options;
+
+        for (int useArena = 0; useArena < 2; ++useArena) {
+            bdlma::SequentialAllocator arena;
+            bsls::Stopwatch            timer;
+            double                     bestTime = 0;
+
+            for (int run = 0; run < NUM_RUNS; ++run) {
+                timer.reset();
+                timer.start();
+
+                for (int i = 0; i < NUM_ITERATIONS; ++i) {
+                    for (int ti = 0; ti < NUM_JSON_COMPACT_MESSAGES; ++ti) {
+                        const bsl::string& INPUT =
+                                           JSON_COMPACT_MESSAGES[ti].d_input_p;
+
+                        if (useArena) {
+                            arena.rewind();
+                            arena.reserveCapacity(
+                                       Decoder::arenaSizeHint(INPUT.length()));
+                        }
+
+                        balb::FeatureTestMessage   value(useArena ? &arena
+                                                                  : 0);
+                        bdlsb::FixedMemInStreamBuf isb(INPUT.data(),
+                                                       INPUT.length());
+
+                        const int rc = decoder.decode(&isb, &value, options);
+                        ASSERTV(ti, 0 == rc);
+                    }
+                }
+
+                timer.stop();
+
+                if (0 == run || timer.elapsedTime() < bestTime) {
+                    bestTime = timer.elapsedTime();
+                }
+            }
+
+            cout << (useArena ? "arena:             " : "default allocator: ")
+                 << bestTime / NUM_ITERATIONS / NUM_JSON_COMPACT_MESSAGES
+                                                                     * 1000000
+                 << " us per message" << endl;
+        }
+      } break;
       default: {
         cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
         testStatus = -1;
@@ -0,0 +1,160 @@
+// baljsn_paralleldecoder.cpp                                         -*-C++-*-
+#include <baljsn_paralleldecoder.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(baljsn_paralleldecoder_cpp, "$Id$ $CSID$")
+
+namespace BloombergLP {
+namespace baljsn {
+
+namespace {
+
+bool isSpace(char c)
+    // Return 'true' if the specified 'c' is a JSON whitespace character, and
+    // 'false' otherwise.
+{
+    return ' ' == c || '\t' == c || '\n' == c || '\r' == c;
+}
+
+bsl::size_t skipSpace(const char *data, bsl::size_t offset, bsl::size_t end)
+    // Return the offset of the first non-whitespace character of the
+    // specified 'data' at or after the specified 'offset', or the specified
+    // 'end' if there is none before 'end'.
+{
+    while (offset < end && isSpace(data[offset])) {
+        ++offset;
+    }
+    return offset;
+}
+
+}  // close unnamed namespace
+
+                           // ---------------------
+                           // class ParallelDecoder
+                           // ---------------------
+
+// CLASS METHODS
+int ParallelDecoder::splitArray(bsl::vector<Range> *elements,
+                                bsl::size_t        *errorOffset,
+                                const char         *data,
+                                bsl::size_t         length)
+{
+    BSLS_ASSERT(elements);
+    BSLS_ASSERT(errorOffset);
+    BSLS_ASSERT(data || 0 == length);
+
+    elements->clear();
+
+    bsl::size_t offset = skipSpace(data, 0, length);
+
+    if (offset == length || '[' != data[offset]) {
+        *errorOffset = offset;
+        return -1;                                                    // RETURN
+    }
+
+    offset = skipSpace(data, offset + 1, length);
+
+    if (offset < length && ']' == data[offset]) {
+        offset = skipSpace(data, offset + 1, length);
+        if (offset != length) {
+            *errorOffset = offset;
+            return -1;                                                // RETURN
+        }
+        return 0;                                                     // RETURN
+    }
+
+    while (true) {
+        // 'offset' is at the first non-whitespace character of an element.
+
+        const bsl::size_t begin    = offset;
+        bsl::size_t       last     = offset;  // one past last non-whitespace
+        int               depth    = 0;
+        bool              isClosed = false;  // array closed by element's end
+
+        while (offset < length) {
+            const char c = data[offset];
+
+            if ('"' == c) {
+                for (++offset; offset < length && '"' != data[offset];
+                                                                  ++offset) {
+                    if ('\\' == data[offset]) {
+                        ++offset;
+                    }
+                }
+                if (offset >= length) {
+                    *errorOffset = begin;
+                    return -1;                                        // RETURN
+                }
+            }
+            else if ('{' == c || '[' == c) {
+                ++depth;
+            }
+            else if ('}' == c || ']' == c) {
+                if (0 == depth) {
+                    if (']' == c) {
+                        isClosed = true;
+                        break;
+                    }
+                    *errorOffset = offset;
+                    return -1;                                        // RETURN
+                }
+                --depth;
+            }
+            else if (',' == c && 0 == depth) {
+                break;
+            }
+            else if (isSpace(c)) {
+                ++offset;
+                continue;
+            }
+
+            ++offset;
+            last = offset;
+        }
+
+        if (offset == length) {
+            *errorOffset = length;
+            return -1;                                                // RETURN
+        }
+
+        if (last == begin) {
+            *errorOffset = offset;
+            return -1;                                                // RETURN
+        }
+
+        elements->push_back(Range(begin, last - begin));
+
+        ++offset;
+        if (isClosed) {
+            break;
+        }
+        offset = skipSpace(data, offset, length);
+    }
+
+    offset = skipSpace(data, offset, length);
+    if (offset != length) {
+        *errorOffset = offset;
+        return -1;                                                    // RETURN
+    }
+
+    return 0;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
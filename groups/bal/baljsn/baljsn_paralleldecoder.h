@@ -0,0 +1,471 @@
+// baljsn_paralleldecoder.h                                           -*-C++-*-
+#ifndef INCLUDED_BALJSN_PARALLELDECODER
+#define INCLUDED_BALJSN_PARALLELDECODER
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide a decoder of JSON arrays decoding elements in parallel.
+//
+//@CLASSES:
+//  baljsn::ParallelDecoder: decoder of JSON arrays using a thread pool
+//
+//@SEE_ALSO: baljsn_decoder, bdlmt_fixedthreadpool
+//
+//@DESCRIPTION: This component provides a class, 'baljsn::ParallelDecoder',
+// that decodes a JSON document consisting of a top-level array of sequence
+// (or choice) elements into a 'bsl::vector', decoding the elements in
+// parallel on the threads of a 'bdlmt::FixedThreadPool'.  'baljsn::Decoder'
+// decodes such a document serially, which, for the arrays of hundreds of
+// thousands of independent records received by bulk interfaces, leaves all
+// but one core idle.
+//
+// Decoding proceeds in two steps.  First, a structural scan of the document
+// (see 'splitArray') finds the boundaries of the elements of the array: it
+// tracks only string literals (and their escapes) and the nesting of objects
+// and arrays, which is much faster than tokenizing the document.  Then, the
+// vector is resized to the number of elements, the elements are divided into
+// contiguous ranges, and each range is decoded into its slots of the vector
+// by a 'baljsn::Decoder' in a job of the thread pool, while the calling
+// thread waits for all the jobs to complete.
+//
+// Each element is decoded exactly as 'baljsn::Decoder' decodes a top-level
+// object, with the same 'baljsn::DecoderOptions'.  Note that the nesting
+// depth of an element is the same as in the array, as arrays do not count
+// towards the maximum decoding depth.
+//
+///Error Reporting
+///---------------
+// Errors are reported deterministically, regardless of the number of threads
+// and of the order in which the jobs complete: if the structural scan fails,
+// the offset in the document at which it failed is reported; otherwise, if
+// the decoding of any element fails, the messages logged by the decoder of
+// the first (lowest-indexed) element that fails are reported, together with
+// its index and offset.  Each job stops at the first element of its range
+// that fails, and the jobs decode disjoint ascending ranges, so the first
+// element that fails in the first job reporting a failure is the first
+// element that fails in the array.
+//
+///Thread Safety
+///-------------
+// 'decodeArray' must not be called from a thread of the thread pool it uses,
+// as it blocks until the jobs it enqueues are complete.  The allocator of the
+// decoder, and the allocators of the elements of the vector, are used
+// concurrently by the threads of the pool, and therefore must be thread-safe
+// (as are the default and global allocators).
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Decoding a Bulk Request
+/// - - - - - - - - - - - - - - - - -
+// Suppose that we receive a bulk request consisting of an array of
+// 'balb::SimpleRequest' objects in JSON, and want to decode it using all the
+// cores of the machine.
+//
+// First, we create and start a thread pool:
+//..
+//  bdlmt::FixedThreadPool threadPool(4, 1024);
+//  int rc = threadPool.start();
+//  assert(0 == rc);
+//..
+// Then, we create a decoder using that thread pool:
+//..
+//  baljsn::ParallelDecoder decoder(&threadPool);
+//..
+// Next, we decode the request:
+//..
+//  const char INPUT[] = "[{\"data\":\"a\",\"responseLength\":1},"
+//                       " {\"data\":\"b\",\"responseLength\":2},"
+//                       " {\"data\":\"c\",\"responseLength\":3}]";
+//
+//  bsl::vector<balb::SimpleRequest> requests;
+//  baljsn::DecoderOptions           options;
+//
+//  rc = decoder.decodeArray(&requests,
+//                           INPUT,
+//                           sizeof INPUT - 1,
+//                           options);
+//  assert(0 == rc);
+//..
+// Now, we verify the decoded requests:
+//..
+//  assert(3   == requests.size());
+//  assert("a" == requests[0].data());
+//  assert(2   == requests[1].responseLength());
+//  assert("c" == requests[2].data());
+//..
+// Finally, we observe that the first element that fails to decode is reported,
+// even if the decoding of a later element failed first:
+//..
+//  const char BAD[] = "[{\"data\":\"a\"},{\"data\":1},{\"data\":[]}]";
+//
+//  rc = decoder.decodeArray(&requests, BAD, sizeof BAD - 1, options);
+//  assert(0 != rc);
+//  assert(bsl::string::npos !=
+//                       decoder.loggedMessages().find("element 1 "));
+//..
+
+#include <balscm_version.h>
+
+#include <baljsn_decoder.h>
+#include <baljsn_decoderoptions.h>
+
+#include <bdlmt_fixedthreadpool.h>
+
+#include <bdlsb_fixedmeminstreambuf.h>
+
+#include <bslma_allocator.h>
+#include <bslma_default.h>
+
+#include <bslmt_latch.h>
+
+#include <bsls_assert.h>
+#include <bsls_types.h>
+
+#include <bsl_cstddef.h>
+#include <bsl_string.h>
+#include <bsl_utility.h>
+#include <bsl_vector.h>
+
+namespace BloombergLP {
+namespace baljsn {
+
+                           // =====================
+                           // class ParallelDecoder
+                           // =====================
+
+class ParallelDecoder {
+    // This class provides a mechanism for decoding a JSON array of sequence
+    // or choice elements into a 'bsl::vector', decoding the elements in
+    // parallel on the threads of a 'bdlmt::FixedThreadPool'.
+
+  public:
+    // TYPES
+    typedef bsl::pair<bsl::size_t, bsl::size_t> Range;
+        // offset and length of an element in a document
+
+  private:
+    // DATA
+    bdlmt::FixedThreadPool *d_threadPool_p;    // thread pool (held, not
+                                               // owned), or 0
+
+    bsl::string             d_loggedMessages;  // messages of the last
+                                               // 'decodeArray'
+
+    bslma::Allocator       *d_allocator_p;     // memory allocator (held, not
+                                               // owned)
+
+    // NOT IMPLEMENTED
+    ParallelDecoder(const ParallelDecoder&);
+    ParallelDecoder& operator=(const ParallelDecoder&);
+
+  public:
+    // CLASS METHODS
+    static int splitArray(bsl::vector<Range> *elements,
+                          bsl::size_t        *errorOffset,
+                          const char         *data,
+                          bsl::size_t         length);
+        // Load into the specified 'elements' the offset and length of each
+        // element of the JSON array in the specified 'data' of the specified
+        // 'length', excluding the whitespace surrounding each element.  Return
+        // 0 on success, and a non-zero value, with the offset in 'data' at
+        // which the array is found to be invalid loaded into the specified
+        // 'errorOffset', otherwise.  The array is invalid if 'data' is not,
+        // apart from leading and trailing whitespace, a '[' followed by
+        // comma-separated non-empty elements and a ']', or if an element has
+        // an unterminated string literal or closes more objects or arrays than
+        // it opens.  Note that the elements are not otherwise validated.
+
+    // CREATORS
+    explicit ParallelDecoder(bdlmt::FixedThreadPool *threadPool,
+                             bslma::Allocator       *basicAllocator = 0);
+        // Create a decoder that decodes the elements of arrays on the threads
+        // of the specified 'threadPool', or in the calling thread if
+        // 'threadPool' is 0.  Optionally specify a 'basicAllocator' used to
+        // supply memory.  If 'basicAllocator' is 0, the currently installed
+        // default allocator is used.  The behavior is undefined unless
+        // 'basicAllocator' is thread-safe.
+
+    // MANIPULATORS
+    template <class TYPE>
+    int decodeArray(bsl::vector<TYPE>     *result,
+                    const char            *data,
+                    bsl::size_t            length,
+                    const DecoderOptions&  options);
+        // Decode into the specified 'result' the JSON array in the specified
+        // 'data' of the specified 'length', using the specified 'options', and
+        // decoding the elements of the array in parallel.  Return 0 on
+        // success, and a non-zero value, with the contents of 'result' valid
+        // but unspecified, otherwise.  'TYPE' shall be a 'bdeat'-compatible
+        // sequence or choice type.  The behavior is undefined unless this
+        // function is called from a thread that is not a thread of the thread
+        // pool of this decoder, and the allocator of 'result' is thread-safe.
+
+    // ACCESSORS
+    const bsl::string& loggedMessages() const;
+        // Return a reference providing non-modifiable access to the messages
+        // logged during the last call to 'decodeArray'.
+};
+
+                       // ==============================
+                       // struct ParallelDecoder_Context
+                       // ==============================
+
+template <class TYPE>
+struct ParallelDecoder_Context {
+    // This component-private 'struct' provides the state shared by the jobs
+    // of a call to 'ParallelDecoder::decodeArray'.
+
+    // PUBLIC DATA
+    TYPE                         *d_values_p;         // decoded elements
+    const ParallelDecoder::Range *d_ranges_p;         // element ranges
+    const char                   *d_data_p;           // document
+    const DecoderOptions         *d_options_p;        // decoding options
+    int                          *d_failedIndices_p;  // per job, first failed
+                                                      // element, or -1
+    bsl::string                  *d_messages_p;       // per job, messages of
+                                                      // the failed element
+    bslmt::Latch                 *d_latch_p;          // arrived at by each job
+    bslma::Allocator             *d_allocator_p;      // decoder allocator
+};
+
+                         // =========================
+                         // class ParallelDecoder_Job
+                         // =========================
+
+template <class TYPE>
+class ParallelDecoder_Job {
+    // This component-private class provides a functor decoding a range of
+    // the elements of a JSON array into the corresponding slots of a vector,
+    // and stopping at the first element that fails to decode.  Note that this
+    // class is small enough to be stored in a 'bsl::function' without
+    // allocating memory.
+
+    // DATA
+    const ParallelDecoder_Context<TYPE> *d_context_p;  // shared state
+    int                                  d_job;        // index of this job
+    int                                  d_begin;      // first element
+    int                                  d_end;        // one past last
+                                                       // element
+
+  public:
+    // CREATORS
+    ParallelDecoder_Job(const ParallelDecoder_Context<TYPE> *context,
+                        int                                  job,
+                        int                                  begin,
+                        int                                  end);
+        // Create a job, having the specified 'job' index, that decodes the
+        // elements having the indices in the specified range '[begin, end)'
+        // as described by the specified 'context'.
+
+    // MANIPULATORS
+    void operator()();
+        // Decode the elements of this job, load the index of the first
+        // element that fails to decode, if any, and the messages logged by
+        // its decoder, into the slots of this job in the context, and arrive
+        // at the latch of the context.
+};
+
+// ============================================================================
+//                        INLINE FUNCTION DEFINITIONS
+// ============================================================================
+
+                           // ---------------------
+                           // class ParallelDecoder
+                           // ---------------------
+
+// CREATORS
+inline
+ParallelDecoder::ParallelDecoder(bdlmt::FixedThreadPool *threadPool,
+                                 bslma::Allocator       *basicAllocator)
+: d_threadPool_p(threadPool)
+, d_loggedMessages(basicAllocator)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+}
+
+// MANIPULATORS
+template <class TYPE>
+int ParallelDecoder::decodeArray(bsl::vector<TYPE>     *result,
+                                 const char            *data,
+                                 bsl::size_t            length,
+                                 const DecoderOptions&  options)
+{
+    BSLS_ASSERT(result);
+    BSLS_ASSERT(data || 0 == length);
+
+    enum { k_JOBS_PER_THREAD = 4 };  // more jobs than threads, to balance
+                                     // ranges of unequal decoding cost
+
+    d_loggedMessages.clear();
+
+    bsl::vector<Range> elements(d_allocator_p);
+    bsl::size_t        errorOffset = 0;
+
+    if (0 != splitArray(&elements, &errorOffset, data, length)) {
+        d_loggedMessages  = "Invalid JSON array at offset ";
+        d_loggedMessages += bsl::to_string(
+                                static_cast<unsigned long long>(errorOffset));
+        d_loggedMessages += "\n";
+        return -1;                                                    // RETURN
+    }
+
+    const int numElements = static_cast<int>(elements.size());
+
+    result->clear();
+    result->resize(numElements);
+
+    if (0 == numElements) {
+        return 0;                                                     // RETURN
+    }
+
+    int numJobs = 1;
+    if (d_threadPool_p) {
+        numJobs = d_threadPool_p->numThreads() * k_JOBS_PER_THREAD;
+        if (numJobs > numElements) {
+            numJobs = numElements;
+        }
+    }
+
+    bsl::vector<int>         failedIndices(numJobs, -1, d_allocator_p);
+    bsl::vector<bsl::string> messages(numJobs, d_allocator_p);
+    bslmt::Latch             latch(numJobs);
+
+    const ParallelDecoder_Context<TYPE> context = { result->data(),
+                                                    elements.data(),
+                                                    data,
+                                                    &options,
+                                                    failedIndices.data(),
+                                                    messages.data(),
+                                                    &latch,
+                                                    d_allocator_p };
+
+    for (int i = 0; i < numJobs; ++i) {
+        const bsls::Types::Int64 n     = numElements;
+        const int                begin = static_cast<int>(n * i / numJobs);
+        const int                end   = static_cast<int>(n * (i + 1)
+                                                                 / numJobs);
+
+        ParallelDecoder_Job<TYPE> job(&context, i, begin, end);
+
+        if (1 == numJobs
+         || 0 != d_threadPool_p->enqueueJob(bdlmt::FixedThreadPool::Job(
+                                                         bsl::allocator_arg,
+                                                         d_allocator_p,
+                                                         job))) {
+            // Decode in the calling thread if the pool does not accept jobs.
+
+            job();
+        }
+    }
+
+    latch.wait();
+
+    for (int i = 0; i < numJobs; ++i) {
+        const int index = failedIndices[i];
+
+        if (0 <= index) {
+            d_loggedMessages  = "Error decoding element ";
+            d_loggedMessages += bsl::to_string(index);
+            d_loggedMessages += " at offset ";
+            d_loggedMessages += bsl::to_string(
+                      static_cast<unsigned long long>(elements[index].first));
+            d_loggedMessages += "\n";
+            d_loggedMessages += messages[i];
+            return -1;                                                // RETURN
+        }
+    }
+
+    return 0;
+}
+
+// ACCESSORS
+inline
+const bsl::string& ParallelDecoder::loggedMessages() const
+{
+    return d_loggedMessages;
+}
+
+                         // -------------------------
+                         // class ParallelDecoder_Job
+                         // -------------------------
+
+// CREATORS
+template <class TYPE>
+inline
+ParallelDecoder_Job<TYPE>::ParallelDecoder_Job(
+                                const ParallelDecoder_Context<TYPE> *context,
+                                int                                  job,
+                                int                                  begin,
+                                int                                  end)
+: d_context_p(context)
+, d_job(job)
+, d_begin(begin)
+, d_end(end)
+{
+}
+
+// MANIPULATORS
+template <class TYPE>
+void ParallelDecoder_Job<TYPE>::operator()()
+{
+    const ParallelDecoder_Context<TYPE>& context = *d_context_p;
+
+    Decoder decoder(context.d_allocator_p);
+
+    for (int i = d_begin; i < d_end; ++i) {
+        const ParallelDecoder::Range& range = context.d_ranges_p[i];
+
+        bdlsb::FixedMemInStreamBuf streamBuf(context.d_data_p + range.first,
+                                             range.second);
+
+        int rc = decoder.decode(&streamBuf,
+                                context.d_values_p + i,
+                                *context.d_options_p);
+
+        if (0 == rc && bsl::streambuf::traits_type::eof() !=
+                                                         streamBuf.sgetc()) {
+            // The element is followed by more data, e.g., another value
+            // separated from it by whitespace only.
+
+            rc = -1;
+        }
+
+        if (0 != rc) {
+            bsl::string& messages = context.d_messages_p[d_job];
+
+            context.d_failedIndices_p[d_job] = i;
+
+            messages = decoder.loggedMessages();
+            if (messages.empty()) {
+                messages = "Unexpected data after the element\n";
+            }
+            break;
+        }
+    }
+
+    context.d_latch_p->arrive();
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
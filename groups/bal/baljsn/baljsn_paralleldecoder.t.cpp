@@ -0,0 +1,749 @@
+// baljsn_paralleldecoder.t.cpp                                       -*-C++-*-
+#include <baljsn_paralleldecoder.h>
+
+#include <baljsn_decoder.h>
+#include <baljsn_decoderoptions.h>
+
+#include <balb_testmessages.h>
+
+#include <bdlmt_fixedthreadpool.h>
+
+#include <bdlsb_fixedmeminstreambuf.h>
+
+#include <bslim_testutil.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+
+#include <bsls_asserttest.h>
+#include <bsls_review.h>
+#include <bsls_stopwatch.h>
+#include <bsls_types.h>
+
+#include <bsl_cstdlib.h>
+#include <bsl_cstring.h>
+#include <bsl_iostream.h>
+#include <bsl_sstream.h>
+#include <bsl_string.h>
+#include <bsl_vector.h>
+
+using namespace BloombergLP;
+using namespace bsl;
+
+// ============================================================================
+//                             TEST PLAN
+// ----------------------------------------------------------------------------
+//                              Overview
+//                              --------
+// The component under test is a mechanism that splits a JSON array into its
+// elements with a structural scan, and decodes the elements in parallel with
+// 'baljsn::Decoder'.  The scan is verified against a table of valid and
+// invalid arrays.  The decoding is verified by comparing the result with that
+// of 'baljsn::Decoder' decoding the whole array, for arrays of various sizes
+// and thread pools of various sizes, and the error reporting is verified to
+// identify the first element that fails, whichever the number of threads.
+// ----------------------------------------------------------------------------
+// CLASS METHODS
+// [2] int splitArray(vector<Range> *, size_t *, const char *, size_t);
+//
+// CREATORS
+// [3] ParallelDecoder(bdlmt::FixedThreadPool *, bslma::Allocator * = 0);
+//
+// MANIPULATORS
+// [3] int decodeArray(vector<TYPE> *, const char *, size_t, const Options&);
+//
+// ACCESSORS
+// [3] const bsl::string& loggedMessages() const;
+// ----------------------------------------------------------------------------
+// [1] BREATHING TEST
+// [4] USAGE EXAMPLE
+// [-1] PERFORMANCE TEST
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLIM_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLIM_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLIM_TESTUTIL_LOOP6_ASSERT
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_SAFE_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_PASS(EXPR)
+#define ASSERT_SAFE_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_FAIL(EXPR)
+#define ASSERT_PASS(EXPR)      BSLS_ASSERTTEST_ASSERT_PASS(EXPR)
+#define ASSERT_FAIL(EXPR)      BSLS_ASSERTTEST_ASSERT_FAIL(EXPR)
+#define ASSERT_OPT_PASS(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_PASS(EXPR)
+#define ASSERT_OPT_FAIL(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_FAIL(EXPR)
+
+// ============================================================================
+//                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef baljsn::ParallelDecoder Obj;
+typedef Obj::Range              Range;
+
+// ============================================================================
+//                  GLOBAL HELPER FUNCTIONS FOR TESTING
+// ----------------------------------------------------------------------------
+
+static
+void appendRequest(bsl::string *result, int seed)
+    // Append to the specified 'result' the JSON encoding of a
+    // 'balb::SimpleRequest' whose value, and the whitespace and escapes of
+    // whose encoding, depend on the specified 'seed'.
+{
+    bsl::ostringstream oss;
+
+    oss << "{\"data\":\"req" << seed;
+    if (0 == seed % 3) {
+        oss << " \\\"[,]\\\" {";
+    }
+    oss << "\"," << (0 == seed % 5 ? "\n\t" : "")
+        << "\"responseLength\":" << seed * 7 - 100;
+    if (0 == seed % 4) {
+        oss << ",\"unknown\":[{\"a\":[1,2]},{}]";
+    }
+    oss << "}";
+
+    *result += oss.str();
+}
+
+static
+void makeArray(bsl::string *result, int numElements, int badElement = -1)
+    // Load into the specified 'result' a JSON array of the specified
+    // 'numElements' 'balb::SimpleRequest' objects, with whitespace between
+    // some elements.  Optionally specify a 'badElement' index of an element
+    // that fails to decode.
+{
+    result->assign("[");
+    for (int i = 0; i < numElements; ++i) {
+        if (i) {
+            *result += 0 == i % 7 ? " ,\n " : ",";
+        }
+        if (i == badElement) {
+            *result += "{\"responseLength\":\"bad\"}";
+        }
+        else {
+            appendRequest(result, i);
+        }
+    }
+    *result += "]";
+}
+
+// ============================================================================
+//                               MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int  test            = argc > 1 ? bsl::atoi(argv[1]) : 0;
+    bool verbose         = argc > 2;
+    bool veryVerbose     = argc > 3;
+
+    // CONCERN: 'BSLS_REVIEW' failures should lead to test failures.
+    bsls::ReviewFailureHandlerGuard reviewGuard(&bsls::Review::failByAbort);
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+    switch (test)  { case 0:
+      case 4: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "USAGE EXAMPLE" << endl
+                          << "=============" << endl;
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Decoding a Bulk Request
+/// - - - - - - - - - - - - - - - - -
+// Suppose that we receive a bulk request consisting of an array of
+// 'balb::SimpleRequest' objects in JSON, and want to decode it using all the
+// cores of the machine.
+//
+// First, we create and start a thread pool:
+//..
+    bdlmt::FixedThreadPool threadPool(4, 1024);
+    int rc = threadPool.start();
+    ASSERT(0 == rc);
+//..
+// Then, we create a decoder using that thread pool:
+//..
+    baljsn::ParallelDecoder decoder(&threadPool);
+//..
+// Next, we decode the request:
+//..
+    const char INPUT[] = "[{\"data\":\"a\",\"responseLength\":1},"
+                         " {\"data\":\"b\",\"responseLength\":2},"
+                         " {\"data\":\"c\",\"responseLength\":3}]";
+
+    bsl::vector<balb::SimpleRequest> requests;
+    baljsn::DecoderOptions           options;
+
+    rc = decoder.decodeArray(&requests,
+                             INPUT,
+                             sizeof INPUT - 1,
+                             options);
+    ASSERT(0 == rc);
+//..
+// Now, we verify the decoded requests:
+//..
+    ASSERT(3   == requests.size());
+    ASSERT("a" == requests[0].data());
+    ASSERT(2   == requests[1].responseLength());
+    ASSERT("c" == requests[2].data());
+//..
+// Finally, we observe that the first element that fails to decode is reported,
+// even if the decoding of a later element failed first:
+//..
+    const char BAD[] = "[{\"data\":\"a\"},{\"data\":1},{\"data\":[]}]";
+
+    rc = decoder.decodeArray(&requests, BAD, sizeof BAD - 1, options);
+    ASSERT(0 != rc);
+    ASSERT(bsl::string::npos !=
+                         decoder.loggedMessages().find("element 1 "));
+//..
+
+        threadPool.stop();
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // 'decodeArray'
+        //
+        // Concerns:
+        //: 1 'decodeArray' decodes an array to the same value as
+        //:   'baljsn::Decoder', for any number of elements and threads, and
+        //:   without a thread pool.
+        //:
+        //: 2 The vector is resized to the number of elements, discarding its
+        //:   previous contents.
+        //:
+        //: 3 If an element fails to decode, the first such element is
+        //:   reported, with the messages of its decoder, for any number of
+        //:   threads.
+        //:
+        //: 4 An element followed by additional data is rejected.
+        //:
+        //: 5 An invalid array is reported with the offset of the error.
+        //:
+        //: 6 The options are applied to the decoding of each element.
+        //:
+        //: 7 Memory is supplied by the allocator of the decoder and of the
+        //:   vector only.
+        //
+        // Plan:
+        //: 1 For thread pools of 1, 2, and 5 threads, and no thread pool,
+        //:   decode arrays of 0 to 120 elements, and compare the results with
+        //:   those of 'baljsn::Decoder'.  (C-1..2, 7)
+        //:
+        //: 2 Make each element of an array, in turn, fail to decode, also
+        //:   together with the last element, and verify the reported index.
+        //:   (C-3)
+        //:
+        //: 3 Decode arrays having elements followed by additional data, that
+        //:   are invalid, or that are nested beyond the maximum depth or have
+        //:   unknown attributes, with different options.  (C-4..6)
+        //
+        // Testing:
+        //   ParallelDecoder(bdlmt::FixedThreadPool *, bslma::Allocator * = 0);
+        //   int decodeArray(vector<TYPE> *, const char *, size_t, const Op&);
+        //   const bsl::string& loggedMessages() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "'decodeArray'" << endl
+                          << "=============" << endl;
+
+        bslma::TestAllocator da("default", veryVerbose);
+        bslma::TestAllocator oa("object",  veryVerbose);
+        bslma::TestAllocator va("vector",  veryVerbose);
+        bslma::TestAllocator sa("scratch", veryVerbose);
+
+        bslma::DefaultAllocatorGuard dag(&da);
+
+        const int NUM_THREADS[] = { 0, 1, 2, 5 };
+        const int NUM_POOLS     = sizeof NUM_THREADS / sizeof *NUM_THREADS;
+
+        const baljsn::DecoderOptions OPTIONS;
+
+        for (int ti = 0; ti < NUM_POOLS; ++ti) {
+            const int THREADS = NUM_THREADS[ti];
+
+            if (veryVerbose) { T_ P(THREADS) }
+
+            bdlmt::FixedThreadPool pool(THREADS ? THREADS : 1, 1024, &sa);
+            ASSERT(0 == pool.start());
+
+            Obj mX(THREADS ? &pool : 0, &oa);  const Obj& X = mX;
+
+            if (verbose) cout << "\tCompare with 'baljsn::Decoder'." << endl;
+
+            for (int n = 0; n <= 120; n += n < 10 ? 1 : 11) {
+                bsl::string input(&sa);
+                makeArray(&input, n);
+
+                bsl::vector<balb::SimpleRequest> expected(&sa);
+                {
+                    baljsn::Decoder            serial(&sa);
+                    bdlsb::FixedMemInStreamBuf isb(input.data(),
+                                                   input.length());
+
+                    ASSERTV(THREADS, n, serial.loggedMessages(),
+                            0 == serial.decode(&isb, &expected, OPTIONS));
+                    ASSERTV(n, expected.size(), n == (int)expected.size());
+                }
+
+                bsl::vector<balb::SimpleRequest> result(3, &va);
+
+                const bsls::Types::Int64 NUM_DEFAULT = da.numBlocksTotal();
+
+                ASSERTV(THREADS, n, X.loggedMessages(),
+                        0 == mX.decodeArray(&result,
+                                            input.data(),
+                                            input.length(),
+                                            OPTIONS));
+                ASSERTV(THREADS, n, expected == result);
+                ASSERTV(THREADS, n, X.loggedMessages().empty());
+                ASSERTV(THREADS, n, NUM_DEFAULT == da.numBlocksTotal());
+            }
+
+            if (verbose) cout << "\tReport the first failed element." << endl;
+
+            const int N = 40;
+
+            for (int bad = 0; bad < N; ++bad) {
+                for (int withLast = 0; withLast < 2; ++withLast) {
+                    bsl::string input(&sa);
+                    makeArray(&input, N, bad);
+                    if (withLast) {
+                        // Also break the last element, making it invalid.
+
+                        input.insert(input.length() - 2, ",\"data\":{}");
+                    }
+
+                    bsl::vector<balb::SimpleRequest> result(&va);
+
+                    ASSERTV(THREADS, bad, 0 != mX.decodeArray(&result,
+                                                             input.data(),
+                                                             input.length(),
+                                                             OPTIONS));
+
+                    bsl::ostringstream expected(&sa);
+                    expected << "Error decoding element " << bad << " ";
+
+                    ASSERTV(THREADS, bad, withLast, X.loggedMessages(),
+                            0 == X.loggedMessages().find(expected.str()));
+                    ASSERTV(THREADS, bad, X.loggedMessages(),
+                            bsl::string::npos !=
+                                   X.loggedMessages().find("responseLength"));
+                }
+            }
+
+            pool.stop();
+        }
+
+        if (verbose) cout << "\tInvalid arrays and options." << endl;
+        {
+            bdlmt::FixedThreadPool pool(2, 1024, &sa);
+            ASSERT(0 == pool.start());
+
+            Obj mX(&pool, &oa);  const Obj& X = mX;
+
+            bsl::vector<balb::SimpleRequest> result(&va);
+
+            const baljsn::DecoderOptions D;
+
+            baljsn::DecoderOptions strict;
+            strict.setSkipUnknownElements(false);
+
+            baljsn::DecoderOptions shallow;
+            shallow.setMaxDepth(1);
+
+            static const struct {
+                int                           d_line;
+                const char                   *d_input_p;
+                const baljsn::DecoderOptions *d_options_p;
+                int                           d_numElements;  // -1 if error
+                const char                   *d_message_p;    // prefix
+            } DATA[] = {
+                //LINE INPUT                            OPT       N  MESSAGE
+                //---- -------------------------------  --------  -- ---------
+                { L_,  "[]",                            &D,        0, ""     },
+                { L_,  "[{}]",                          &D,        1, ""     },
+                { L_,  "[{},{\"data\":\"x\"}]",         &D,        2, ""     },
+                { L_,  "[{} {}]",                       &D,       -1,
+                                                 "Error decoding element 0 " },
+                { L_,  "[{},{} {}]",                    &D,       -1,
+                                                 "Error decoding element 1 " },
+                { L_,  "[{},,{}]",                      &D,       -1,
+                                                  "Invalid JSON array at "
+                                                  "offset 4\n"               },
+                { L_,  "{}",                            &D,       -1,
+                                                  "Invalid JSON array at "
+                                                  "offset 0\n"               },
+                { L_,  "[{}",                           &D,       -1,
+                                                  "Invalid JSON array at "
+                                                  "offset 3\n"               },
+                { L_,  "[1]",                           &D,       -1,
+                                                 "Error decoding element 0 " },
+                { L_,  "[{\"x\":1}]",                   &D,        1, ""     },
+                { L_,  "[{\"x\":1}]",                   &strict,  -1,
+                                                 "Error decoding element 0 " },
+                { L_,  "[{\"data\":\"a\"}]",            &shallow,  1, ""     },
+                { L_,  "[{},{\"x\":{}}]",               &shallow, -1,
+                                                 "Error decoding element 1 " },
+            };
+            const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+            for (int ti = 0; ti < NUM_DATA; ++ti) {
+                const int   LINE    = DATA[ti].d_line;
+                const char *INPUT   = DATA[ti].d_input_p;
+                const int   N       = DATA[ti].d_numElements;
+                const char *MESSAGE = DATA[ti].d_message_p;
+
+                const int rc = mX.decodeArray(&result,
+                                              INPUT,
+                                              bsl::strlen(INPUT),
+                                              *DATA[ti].d_options_p);
+
+                ASSERTV(LINE, rc, X.loggedMessages(), (0 <= N) == (0 == rc));
+                if (0 <= N) {
+                    ASSERTV(LINE, result.size(), N == (int)result.size());
+                }
+                ASSERTV(LINE, X.loggedMessages(),
+                        0 == X.loggedMessages().find(MESSAGE));
+            }
+
+            pool.stop();
+        }
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // 'splitArray'
+        //
+        // Concerns:
+        //: 1 Each element of the array is identified, excluding the
+        //:   surrounding whitespace.
+        //:
+        //: 2 Commas and brackets within string literals, including after
+        //:   escaped quotes, and within nested objects and arrays, do not
+        //:   delimit elements.
+        //:
+        //: 3 Invalid arrays are rejected, with the offset of the error.
+        //:
+        //: 4 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 Using the table-driven technique, split arrays having elements of
+        //:   every kind, and invalid arrays, and verify the elements or the
+        //:   error offset.  (C-1..3)
+        //:
+        //: 2 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for invalid arguments.  (C-4)
+        //
+        // Testing:
+        //   int splitArray(vector<Range> *, size_t *, const char *, size_t);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "'splitArray'" << endl
+                          << "============" << endl;
+
+        static const struct {
+            int         d_line;
+            const char *d_input_p;
+            int         d_errorOffset;  // -1 if valid
+            const char *d_elements_p;   // elements separated by '|'
+        } DATA[] = {
+            //LINE INPUT                              ERROR  ELEMENTS
+            //---- ---------------------------------  -----  ----------------
+            { L_,  "[]",                                -1,  ""              },
+            { L_,  " \t\r\n[ \n ] \n",                  -1,  ""              },
+            { L_,  "[1]",                               -1,  "1"             },
+            { L_,  "[ 1 ]",                             -1,  "1"             },
+            { L_,  "[1,2,3]",                           -1,  "1|2|3"         },
+            { L_,  "[ {} , [] , \"\" ]",                -1,  "{}|[]|\"\""    },
+            { L_,  "[{\"a\":[1,2]},{\"b\":{}}]",        -1,
+                                                   "{\"a\":[1,2]}|"
+                                                   "{\"b\":{}}"             },
+            { L_,  "[\"a,b\",\"]\"]",                   -1,  "\"a,b\"|\"]\"" },
+            { L_,  "[\"\\\",]\",\"\\\\\"]",             -1,
+                                                     "\"\\\",]\"|\"\\\\\""   },
+            { L_,  "[{\"a\":\"}\"}]",                   -1,  "{\"a\":\"}\"}" },
+            { L_,  "[{} {}]",                           -1,  "{} {}"         },
+            { L_,  "[[[]]]",                            -1,  "[[]]"          },
+
+            { L_,  "",                                   0,  ""              },
+            { L_,  "   ",                                3,  ""              },
+            { L_,  "{}",                                 0,  ""              },
+            { L_,  "  x[]",                              2,  ""              },
+            { L_,  "[",                                  1,  ""              },
+            { L_,  "[ ",                                 2,  ""              },
+            { L_,  "[1",                                 2,  ""              },
+            { L_,  "[1,",                                3,  ""              },
+            { L_,  "[1,]",                               3,  ""              },
+            { L_,  "[,1]",                               1,  ""              },
+            { L_,  "[1,,2]",                             3,  ""              },
+            { L_,  "[1, ,2]",                            4,  ""              },
+            { L_,  "[}]",                                1,  ""              },
+            { L_,  "[{}}]",                              3,  ""              },
+            { L_,  "[{]",                                3,  ""              },
+            { L_,  "[\"a]",                              1,  ""              },
+            { L_,  "[\"a\\\"]",                          1,  ""              },
+            { L_,  "[1] x",                              4,  ""              },
+            { L_,  "[1]]",                               3,  ""              },
+            { L_,  "[] []",                              3,  ""              },
+        };
+        const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int   LINE     = DATA[ti].d_line;
+            const char *INPUT    = DATA[ti].d_input_p;
+            const int   ERROR    = DATA[ti].d_errorOffset;
+            const char *ELEMENTS = DATA[ti].d_elements_p;
+
+            const bsl::size_t LENGTH = bsl::strlen(INPUT);
+
+            if (veryVerbose) { T_ P_(LINE) P(INPUT) }
+
+            // Copy the input, so that reading past its end is detected.
+
+            bsl::vector<char> input(INPUT, INPUT + LENGTH);
+
+            bsl::vector<Range> elements;
+            bsl::size_t        errorOffset = 12345;
+
+            const int rc = Obj::splitArray(&elements,
+                                           &errorOffset,
+                                           input.data(),
+                                           LENGTH);
+
+            if (0 <= ERROR) {
+                ASSERTV(LINE, rc, 0 != rc);
+                ASSERTV(LINE, errorOffset, ERROR == (int)errorOffset);
+                continue;
+            }
+
+            ASSERTV(LINE, rc, 0 == rc);
+            ASSERTV(LINE, 12345 == errorOffset);
+
+            bsl::string actual;
+            for (bsl::size_t i = 0; i < elements.size(); ++i) {
+                if (i) {
+                    actual += '|';
+                }
+                actual.append(INPUT + elements[i].first, elements[i].second);
+            }
+            ASSERTV(LINE, actual, ELEMENTS == actual);
+        }
+
+        if (verbose) cout << "\tNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            bsl::vector<Range> elements;
+            bsl::size_t        errorOffset;
+
+            ASSERT_PASS(Obj::splitArray(&elements, &errorOffset, "[]", 2));
+            ASSERT_PASS(Obj::splitArray(&elements, &errorOffset, 0, 0));
+            ASSERT_FAIL(Obj::splitArray(0, &errorOffset, "[]", 2));
+            ASSERT_FAIL(Obj::splitArray(&elements, 0, "[]", 2));
+            ASSERT_FAIL(Obj::splitArray(&elements, &errorOffset, 0, 2));
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Decode a small array with and without a thread pool.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        const char INPUT[] = " [ {\"data\":\"x\",\"responseLength\":3} ,"
+                             "{\"data\":\"y\"} ] ";
+
+        const baljsn::DecoderOptions options;
+
+        bsl::vector<balb::SimpleRequest> result;
+
+        Obj mX(0);  const Obj& X = mX;
+
+        ASSERT(0 == mX.decodeArray(&result, INPUT, sizeof INPUT - 1, options));
+        ASSERT(2   == result.size());
+        ASSERT("x" == result[0].data());
+        ASSERT(3   == result[0].responseLength());
+        ASSERT("y" == result[1].data());
+        ASSERT(X.loggedMessages().empty());
+
+        bdlmt::FixedThreadPool pool(2, 16);
+        ASSERT(0 == pool.start());
+
+        Obj mY(&pool);  const Obj& Y = mY;
+
+        result.clear();
+        ASSERT(0 == mY.decodeArray(&result, INPUT, sizeof INPUT - 1, options));
+        ASSERT(2   == result.size());
+        ASSERT("y" == result[1].data());
+        ASSERT(Y.loggedMessages().empty());
+
+        pool.stop();
+      } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE TEST
+        //
+        // Concerns:
+        //: 1 Decoding a large array in parallel is faster than decoding it
+        //:   with 'baljsn::Decoder'.
+        //
+        // Plan:
+        //: 1 Decode an array of 100000 elements with 'baljsn::Decoder', and
+        //:   with thread pools of 1, 2, 4, and 8 threads, and report the
+        //:   elapsed times.  (C-1)
+        //
+        // Testing:
+        //   PERFORMANCE TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "PERFORMANCE TEST" << endl
+                          << "================" << endl;
+
+        const int N = argc > 2 ? bsl::atoi(argv[2]) : 100000;
+
+        bsl::string input;
+        makeArray(&input, N);
+
+        const baljsn::DecoderOptions options;
+
+        bsl::vector<balb::SimpleRequest> result;
+        bsls::Stopwatch                  timer;
+
+        {
+            baljsn::Decoder            decoder;
+            bdlsb::FixedMemInStreamBuf isb(input.data(), input.length());
+
+            timer.start();
+            ASSERT(0 == decoder.decode(&isb, &result, options));
+            timer.stop();
+
+            cout << "baljsn::Decoder: " << timer.elapsedTime() << "s" << endl;
+        }
+
+        for (int threads = 1; threads <= 8; threads *= 2) {
+            bdlmt::FixedThreadPool pool(threads, 1024);
+            ASSERT(0 == pool.start());
+
+            Obj mX(&pool);
+
+            timer.reset();
+            timer.start();
+            ASSERT(0 == mX.decodeArray(&result,
+                                       input.data(),
+                                       input.length(),
+                                       options));
+            timer.stop();
+
+            ASSERT(N == (int)result.size());
+
+            cout << threads << " thread(s): " << timer.elapsedTime() << "s"
+                 << endl;
+
+            pool.stop();
+        }
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      } break;
+    }
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
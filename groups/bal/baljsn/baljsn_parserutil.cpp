@@ -10,6 +10,7 @@ BSLS_IDENT_RCSID(baljsn_parserutil_cpp,"$Id$ $CSID$")
 #include <bdlde_charconvertutf32.h>
 
 #include <bdlb_chartype.h>
+#include <bdlb_numericparseutil.h>
 #include <bdlb_string.h>
 
 #include <bdldfp_decimalutil.h>
@@ -21,7 +22,6 @@ BSLS_IDENT_RCSID(baljsn_parserutil_cpp,"$Id$ $CSID$")
 #include <bsl_algorithm.h>
 #include <bsl_cmath.h>
 #include <bsl_cctype.h>
-#include <bsl_cerrno.h>
 #include <bsl_cstdlib.h>
 #include <bsl_cstring.h>
 #include <bsl_iosfwd.h>
@@ -124,6 +124,22 @@ int loadInfOrNan(TYPE *value, bslstl::StringRef data)
     return rc;
 }
 
+bool hasNonZeroSignificand(bslstl::StringRef data)
+    // Return 'true' if the significand of the specified numeric 'data' (i.e.,
+    // the part before any exponent) contains a non-zero digit, and 'false'
+    // otherwise.
+{
+    for (const char *p = data.begin(); p != data.end(); ++p) {
+        if ('e' == *p || 'E' == *p) {
+            break;
+        }
+        if ('1' <= *p && *p <= '9') {
+            return true;                                              // RETURN
+        }
+    }
+    return false;
+}
+
 static const bsls::Types::Uint64 UINT64_MAX_VALUE =
                                bsl::numeric_limits<bsls::Types::Uint64>::max();
 static const bsls::Types::Uint64 UINT64_MAX_DIVIDED_BY_10 =
@@ -366,24 +382,18 @@ int ParserUtil::getValue(double *value, bslstl::StringRef data)
         return loadInfOrNan(value, data);                             // RETURN
     }
 
-    const int k_MAX_STRING_LENGTH = 63;
-    char      buffer[k_MAX_STRING_LENGTH + 1];
+    // Reject text that is not entirely consumed, does not end with a digit
+    // (e.g., "1." or "1e"), overflows to infinity, or underflows to zero.
 
-    bdlma::BufferedSequentialAllocator allocator(buffer,
-                                                 k_MAX_STRING_LENGTH + 1);
-    bsl::string                        dataString(data.data(),
-                                                  data.length(),
-                                                  &allocator);
-
-    char   *endPtr = 0;
-    errno          = 0;
-    double  tmp    = bsl::strtod(dataString.c_str(), &endPtr);
-
-    if (endPtr    != dataString.end()
-     || (0        == tmp && 0 != errno)
-     ||  HUGE_VAL == tmp
-     || -HUGE_VAL == tmp
-     || !bsl::isdigit(*(dataString.end() - 1))) {
+    double            tmp;
+    bslstl::StringRef remainder;
+
+    if (0 != bdlb::NumericParseUtil::parseDouble(&tmp, &remainder, data)
+     || !remainder.isEmpty()
+     || !bsl::isdigit(static_cast<unsigned char>(data[data.length() - 1]))
+     ||  bsl::numeric_limits<double>::infinity() == tmp
+     || -bsl::numeric_limits<double>::infinity() == tmp
+     || (0 == tmp && hasNonZeroSignificand(data))) {
         return -1;                                                    // RETURN
     }
 
@@ -394,6 +404,20 @@ int ParserUtil::getValue(double *value, bslstl::StringRef data)
 int ParserUtil::getUint64(bsls::Types::Uint64 *value,
                           bslstl::StringRef    data)
 {
+    // Parse the common case, a sequence of digits without a fraction or an
+    // exponent, directly.
+
+    if (!data.isEmpty() && bdlb::CharType::isDigit(data[0])) {
+        bsls::Types::Uint64 tmp;
+        bslstl::StringRef   remainder;
+
+        if (0 == bdlb::NumericParseUtil::parseUint64(&tmp, &remainder, data)
+         && remainder.isEmpty()) {
+            *value = tmp;
+            return 0;                                                 // RETURN
+        }
+    }
+
     const char *iter  = data.begin();
     const char *end   = data.end();
 
@@ -21,6 +21,20 @@ BSLS_IDENT("$Id: $")
 // Refer to the details of the JSON encoding format supported by this utility
 // in the package documentation file (doc/baljsn.txt).
 //
+///Floating-Point Precision
+///------------------------
+// 'float' and 'double' values are written with at most the number of
+// significant digits given by the 'maxFloatPrecision' and 'maxDoublePrecision'
+// encoder options (or 'bsl::numeric_limits<TYPE>::digits10' if no options are
+// supplied), using the notation of the 'printf' '%g' conversion.  If that
+// precision is at least the number of digits needed to round-trip any value
+// of the type (9 for 'float' and 17 for 'double'), the *shortest* text that
+// converts back to exactly the encoded value is written instead, using
+// 'bdlb::NumericFormatUtil'.  For example, with a 'maxDoublePrecision' of 17
+// the 'double' value nearest to 0.1 is encoded as "0.1" (and not as
+// "0.10000000000000001"), with no loss of information.  Shortest round-trip
+// formatting is also considerably faster than 'snprintf'.
+//
 ///Usage
 ///-----
 // This section illustrates intended use of this component.
@@ -82,6 +96,7 @@ BSLS_IDENT("$Id: $")
 #include <baljsn_encoderoptions.h>
 
 #include <bdlb_float.h>
+#include <bdlb_numericformatutil.h>
 
 #include <bdldfp_decimal.h>
 #include <bdldfp_decimalconvertutil.h>
@@ -120,6 +135,12 @@ struct PrintUtil {
         // template parameter 'TYPE' using the specified 'options' to decide.
         // The behavior is undefined unless 'TYPE' is 'float' or 'double'.
 
+    template <class TYPE>
+    static int printInteger(bsl::ostream& stream, TYPE value);
+        // Encode the specified integral 'value' into JSON and output the
+        // result to the specified 'stream'.  Return 0 on success and a
+        // non-zero value otherwise.
+
   public:
     // CLASS METHODS
     template <class TYPE>
@@ -245,6 +266,18 @@ int PrintUtil::maxStreamPrecision<double>(
            : bsl::numeric_limits<double>::digits10;
 }
 
+template <class TYPE>
+inline
+int PrintUtil::printInteger(bsl::ostream& stream, TYPE value)
+{
+    char        buffer[bdlb::NumericFormatUtil::k_INT64_MAX_STRLEN];
+    const char *end = bdlb::NumericFormatUtil::toChars(buffer,
+                                                       buffer + sizeof buffer,
+                                                       value);
+    stream.write(buffer, end - buffer);
+    return 0;
+}
+
 // CLASS METHODS
 template <class TYPE>
 inline
@@ -299,9 +332,27 @@ int PrintUtil::printFloatingPoint(bsl::ostream&                 stream,
         }
       } break;
       default: {
+        enum {
+            // number of significant digits needed to round-trip any 'TYPE'
+            // value (i.e., 'max_digits10')
+
+            k_ROUND_TRIP_PRECISION =
+                         bsl::numeric_limits<TYPE>::digits * 30103 / 100000 + 2
+        };
+
         const int k_SIZE = 32;
         char      buffer[k_SIZE];
 
+        const int precision = maxStreamPrecision<TYPE>(options);
+
+        if (precision >= k_ROUND_TRIP_PRECISION) {
+            const char *end = bdlb::NumericFormatUtil::toChars(buffer,
+                                                               buffer + k_SIZE,
+                                                               value);
+            stream.write(buffer, end - buffer);
+            return 0;                                                 // RETURN
+        }
+
 #if defined(BSLS_PLATFORM_CMP_MSVC)
 #define snprintf _snprintf
 #endif
@@ -309,7 +360,7 @@ int PrintUtil::printFloatingPoint(bsl::ostream&                 stream,
         const int len = snprintf(buffer,
                                  k_SIZE,
                                  "%-1.*g",
-                                 maxStreamPrecision<TYPE>(options),
+                                 precision,
                                  value);
 
 #if defined(BSLS_PLATFORM_CMP_MSVC)
@@ -335,8 +386,7 @@ int PrintUtil::printValue(bsl::ostream& stream,
                           short         value,
                           const EncoderOptions *)
 {
-    stream << value;
-    return 0;
+    return printInteger(stream, value);
 }
 
 inline
@@ -344,8 +394,7 @@ int PrintUtil::printValue(bsl::ostream& stream,
                           int           value,
                           const EncoderOptions *)
 {
-    stream << value;
-    return 0;
+    return printInteger(stream, value);
 }
 
 inline
@@ -353,8 +402,7 @@ int PrintUtil::printValue(bsl::ostream&      stream,
                           bsls::Types::Int64 value,
                           const EncoderOptions *)
 {
-    stream << value;
-    return 0;
+    return printInteger(stream, value);
 }
 
 inline
@@ -362,8 +410,7 @@ int PrintUtil::printValue(bsl::ostream& stream,
                           unsigned char value,
                           const EncoderOptions *)
 {
-    stream << static_cast<int>(value);
-    return 0;
+    return printInteger(stream, value);
 }
 
 inline
@@ -371,8 +418,7 @@ int PrintUtil::printValue(bsl::ostream&  stream,
                           unsigned short value,
                           const EncoderOptions *)
 {
-    stream << value;
-    return 0;
+    return printInteger(stream, value);
 }
 
 inline
@@ -380,8 +426,7 @@ int PrintUtil::printValue(bsl::ostream& stream,
                           unsigned int  value,
                           const EncoderOptions *)
 {
-    stream << value;
-    return 0;
+    return printInteger(stream, value);
 }
 
 inline
@@ -389,8 +434,7 @@ int PrintUtil::printValue(bsl::ostream&       stream,
                           bsls::Types::Uint64 value,
                           const EncoderOptions *)
 {
-    stream << value;
-    return 0;
+    return printInteger(stream, value);
 }
 
 inline
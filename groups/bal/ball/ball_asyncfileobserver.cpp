@@ -272,7 +272,11 @@ void AsyncFileObserver::publish(const bsl::shared_ptr<const Record>& record,
     asyncRecord.d_record  = record;
     asyncRecord.d_context = context;
 
-    if (record->fixedFields().severity() > d_dropRecordsOnFullQueueThreshold) {
+    // Note that 'severity' is used, rather than 'fixedFields', so that the
+    // deferred message of the record (if any) is formatted by the publication
+    // thread.
+
+    if (record->severity() > d_dropRecordsOnFullQueueThreshold) {
         if (0 != d_recordQueue.tryPushBack(asyncRecord)) {
             d_dropCount.addRelaxed(1);
         }
@@ -128,7 +128,8 @@ using bsl::flush;
 // [ 7] CONCERN: LOGGING TO A FAILING STREAM
 // [ 5] CONCERN: LOG MESSAGE DROP
 // [ 9] CONCERN: ROTATION
-// [12] USAGE EXAMPLE
+// [12] CONCERN: DEFERRED MESSAGE FORMATTING
+// [13] USAGE EXAMPLE
 
 // Note assert and debug macros all output to 'cerr' instead of cout, unlike
 // most other test drivers.  This is necessary because test case 2 plays tricks
@@ -623,7 +624,7 @@ int main(int argc, char *argv[])
     bslma::TestAllocator *Z = &allocator;
 
     switch (test) { case 0:
-      case 12: {
+      case 13: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //
@@ -775,6 +776,96 @@ int main(int argc, char *argv[])
 //..
 
       } break;
+      case 12: {
+        // --------------------------------------------------------------------
+        // CONCERN: DEFERRED MESSAGE FORMATTING
+        //
+        // Concerns:
+        //: 1 'publish' does not format the deferred message of a record.
+        //:
+        //: 2 The deferred message of a record is formatted by the publication
+        //:   thread, and written to the log file.
+        //
+        // Plan:
+        //: 1 Publish a record having a pending deferred message to an
+        //:   observer whose publication thread is not running, and verify
+        //:   that the message is still pending.  Neither the test thread, nor
+        //:   'publish', accesses the fixed fields of the record through the
+        //:   non-modifiable 'fixedFields' accessor.  (C-1)
+        //:
+        //: 2 Start the publication thread, wait until it has written the
+        //:   record, and verify that the message has been formatted, and
+        //:   that the log file has the formatted message.  (C-2)
+        //
+        // Testing:
+        //   CONCERN: DEFERRED MESSAGE FORMATTING
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nCONCERN: DEFERRED MESSAGE FORMATTING"
+                          << "\n====================================" << endl;
+
+        TempDirectoryGuard tempDirGuard;
+
+        bslma::TestAllocator ta(veryVeryVeryVerbose);
+
+        for (int drop = 0; drop < 2; ++drop) {
+            // Records of severity higher than the drop threshold are published
+            // by 'tryPushBack', and the others by 'pushBack'.
+
+            bsl::string logName(tempDirGuard.getTempDirName());
+            bdls::PathUtil::appendRaw(&logName, drop ? "testLog1"
+                                                     : "testLog0");
+
+            Obj        mX(ball::Severity::e_FATAL,
+                          false,
+                          8,
+                          drop ? ball::Severity::e_TRACE
+                               : ball::Severity::e_FATAL,
+                          &ta);
+            const Obj& X = mX;
+
+            bsl::shared_ptr<ball::Record> record;
+            record.createInplace(&ta);
+            record->fixedFields().setSeverity(ball::Severity::e_ERROR);
+            record->fixedFields().setCategory("DEFERRED");
+            record->deferredMessage().setFormat("%s has %d items");
+            record->deferredMessage().appendArgument("basket");
+            record->deferredMessage().appendArgument(3 + drop);
+
+            mX.publish(record, ball::Context());
+
+            ASSERTV(drop, 1    == X.recordQueueLength());
+            ASSERTV(drop, true == record->isDeferredMessagePending());
+            ASSERTV(drop, 0    ==
+                            record->fixedFields().messageStreamBuf().length());
+
+            ASSERT(0 == mX.enableFileLogging(logName.c_str()));
+            ASSERT(0 == mX.startPublicationThread());
+
+            bsls::Stopwatch timer;
+            timer.start();
+            while (X.recordQueueLength() > 0 && timer.elapsedTime() < 20) {
+                bslmt::ThreadUtil::microSleep(1000, 0);
+            }
+
+            // Stopping the publication thread joins it, so that it has
+            // finished writing the record.
+
+            ASSERT(0 == mX.stopPublicationThread());
+            mX.disableFileLogging();
+
+            bsl::ostringstream expected;
+            expected << "basket has " << 3 + drop << " items";
+
+            ASSERTV(drop, false == record->isDeferredMessagePending());
+            ASSERTV(drop, record->fixedFields().messageRef(),
+                    expected.str() == record->fixedFields().messageRef());
+
+            const bsl::string content = readPartialFile(logName, 0);
+            ASSERTV(drop, content,
+                    bsl::string::npos != content.find(expected.str()));
+        }
+      } break;
       case 11: {
         // --------------------------------------------------------------------
         // TESTING 'recordQueueLength'
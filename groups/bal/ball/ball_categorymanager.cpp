@@ -8,17 +8,21 @@ BSLS_IDENT_RCSID(ball_categorymanager_cpp,"$Id$ $CSID$")
 #include <ball_thresholdaggregate.h>
 
 #include <bdlb_bitutil.h>
+#include <bdlb_hashutil.h>
 
 #include <bslmt_lockguard.h>
 #include <bslmt_readlockguard.h>
 #include <bslmt_writelockguard.h>
 
+#include <bsls_alignmentutil.h>
 #include <bsls_assert.h>
 #include <bsls_atomicoperations.h>
 #include <bsls_platform.h>
 
 #include <bsl_algorithm.h>
+#include <bsl_cstring.h>
 #include <bsl_map.h>
+#include <bsl_string.h>
 #include <bsl_utility.h>
 #include <bsl_vector.h>
 
@@ -27,11 +31,267 @@ BSLS_IDENT_RCSID(ball_categorymanager_cpp,"$Id$ $CSID$")
 #undef max
 #endif
 
+///Implementation Notes
+///--------------------
+// Lookup by name is served by 'CategoryManager_Table', an open-addressing hash
+// table of category addresses.  Categories are never removed from a category
+// manager, so the table is insert-only: a slot, once published (with release
+// semantics), never changes, and a reader probing the table (with acquire
+// semantics) either finds a category or reaches an empty slot.  Insertions
+// are serialized by the write lock on the registry.  When the table would
+// become more than half full, a table of twice the capacity is populated and
+// then published in place of the current table.  A reader may still be
+// probing the replaced table, which is therefore retained (owned by the new
+// table) until the category manager is destroyed.
+//
+// The registry map ('d_registry') orders the categories by name, so the
+// categories that can match a rule pattern ending with '*' are a contiguous
+// range of the map, starting at the first name not less than the literal
+// prefix of the pattern.
+
 namespace BloombergLP {
 namespace ball {
 
+                        // ===========================
+                        // class CategoryManager_Table
+                        // ===========================
+
+class CategoryManager_Table {
+    // This component-private class provides an insert-only hash table of
+    // category addresses, keyed by category name, whose lookups may run
+    // concurrently with one insertion.
+
+    // PRIVATE TYPES
+    typedef bsls::AtomicOperations                       AtomicOps;
+    typedef bsls::AtomicOperations::AtomicTypes::Pointer AtomicPointer;
+
+    // DATA
+    int                    d_capacity;     // number of slots (power of 2)
+
+    int                    d_size;         // number of occupied slots
+
+    AtomicPointer         *d_slots_p;      // slots, following this object in
+                                           // the same memory block
+
+    CategoryManager_Table *d_previous_p;   // replaced table (owned)
+
+    bslma::Allocator      *d_allocator_p;  // memory allocator (held, not
+                                           // owned)
+
+    // PRIVATE CLASS METHODS
+    static unsigned int hash(const char *categoryName);
+        // Return the hash value of the specified 'categoryName'.
+
+    // PRIVATE CREATORS
+    CategoryManager_Table(int                    capacity,
+                          AtomicPointer         *slots,
+                          CategoryManager_Table *previous,
+                          bslma::Allocator      *allocator);
+        // Create an empty table having the specified 'capacity' number of
+        // specified 'slots', taking ownership of the specified 'previous'
+        // table (if not 0), and using the specified 'allocator' to supply
+        // memory.
+
+    ~CategoryManager_Table();
+        // Destroy this table and any table it owns.
+
+    // NOT IMPLEMENTED
+    CategoryManager_Table(const CategoryManager_Table&);
+    CategoryManager_Table& operator=(const CategoryManager_Table&);
+
+  public:
+    // CLASS METHODS
+    static CategoryManager_Table *create(int                    capacity,
+                                         CategoryManager_Table *previous,
+                                         bslma::Allocator      *allocator);
+        // Return the address of a new, empty table having the specified
+        // 'capacity', that takes ownership of the specified 'previous' table
+        // (if not 0), and that uses the specified 'allocator' to supply
+        // memory.  The behavior is undefined unless 'capacity' is a positive
+        // power of 2.
+
+    static void destroy(CategoryManager_Table *table);
+        // Destroy the specified 'table', and any table it owns, and
+        // deallocate their memory.
+
+    // MANIPULATORS
+    void insert(Category *category);
+        // Insert the specified 'category' into this table.  The behavior is
+        // undefined unless 'category' is not already in this table,
+        // '!isFull()', and insertions are serialized.
+
+    // ACCESSORS
+    int capacity() const;
+        // Return the number of slots of this table.
+
+    Category *find(const char *categoryName) const;
+        // Return the address of the category having the specified
+        // 'categoryName' in this table, or 0 if no such category exists.
+
+    bool isFull() const;
+        // Return 'true' if inserting another category would make this table
+        // more than half full, and 'false' otherwise.
+
+    void insertAllInto(CategoryManager_Table *table) const;
+        // Insert each category in this table into the specified 'table'.
+};
+
+                        // ---------------------------
+                        // class CategoryManager_Table
+                        // ---------------------------
+
+// PRIVATE CLASS METHODS
+inline
+unsigned int CategoryManager_Table::hash(const char *categoryName)
+{
+    return bdlb::HashUtil::hash1(categoryName,
+                                 static_cast<int>(bsl::strlen(categoryName)));
+}
+
+// PRIVATE CREATORS
+CategoryManager_Table::CategoryManager_Table(
+                                        int                    capacity,
+                                        AtomicPointer         *slots,
+                                        CategoryManager_Table *previous,
+                                        bslma::Allocator      *allocator)
+: d_capacity(capacity)
+, d_size(0)
+, d_slots_p(slots)
+, d_previous_p(previous)
+, d_allocator_p(allocator)
+{
+    for (int i = 0; i < d_capacity; ++i) {
+        AtomicOps::initPointer(&d_slots_p[i], 0);
+    }
+}
+
+CategoryManager_Table::~CategoryManager_Table()
+{
+    if (d_previous_p) {
+        destroy(d_previous_p);
+    }
+}
+
+// CLASS METHODS
+CategoryManager_Table *CategoryManager_Table::create(
+                                          int                    capacity,
+                                          CategoryManager_Table *previous,
+                                          bslma::Allocator      *allocator)
+{
+    BSLS_ASSERT(0 < capacity);
+    BSLS_ASSERT(0 == (capacity & (capacity - 1)));
+    BSLS_ASSERT(allocator);
+
+    const int headerSize = bsls::AlignmentUtil::roundUpToMaximalAlignment(
+                                               sizeof(CategoryManager_Table));
+
+    char *block = static_cast<char *>(
+           allocator->allocate(headerSize + capacity * sizeof(AtomicPointer)));
+
+    AtomicPointer *slots = reinterpret_cast<AtomicPointer *>(block +
+                                                             headerSize);
+
+    return new (block) CategoryManager_Table(capacity,
+                                             slots,
+                                             previous,
+                                             allocator);
+}
+
+void CategoryManager_Table::destroy(CategoryManager_Table *table)
+{
+    BSLS_ASSERT(table);
+
+    bslma::Allocator *allocator = table->d_allocator_p;
+
+    table->~CategoryManager_Table();
+    allocator->deallocate(table);
+}
+
+// MANIPULATORS
+void CategoryManager_Table::insert(Category *category)
+{
+    BSLS_ASSERT(category);
+    BSLS_ASSERT(!isFull());
+
+    const unsigned int mask  = d_capacity - 1;
+    unsigned int       index = hash(category->categoryName()) & mask;
+
+    while (AtomicOps::getPtrRelaxed(&d_slots_p[index])) {
+        index = (index + 1) & mask;
+    }
+    AtomicOps::setPtrRelease(&d_slots_p[index], category);
+    ++d_size;
+}
+
+// ACCESSORS
+inline
+int CategoryManager_Table::capacity() const
+{
+    return d_capacity;
+}
+
+Category *CategoryManager_Table::find(const char *categoryName) const
+{
+    const unsigned int mask  = d_capacity - 1;
+    unsigned int       index = hash(categoryName) & mask;
+
+    while (Category *category = static_cast<Category *>(
+                              AtomicOps::getPtrAcquire(&d_slots_p[index]))) {
+        if (0 == bsl::strcmp(category->categoryName(), categoryName)) {
+            return category;                                          // RETURN
+        }
+        index = (index + 1) & mask;
+    }
+    return 0;
+}
+
+inline
+bool CategoryManager_Table::isFull() const
+{
+    return 2 * (d_size + 1) > d_capacity;
+}
+
+void CategoryManager_Table::insertAllInto(CategoryManager_Table *table) const
+{
+    BSLS_ASSERT(table);
+
+    for (int i = 0; i < d_capacity; ++i) {
+        Category *category = static_cast<Category *>(
+                                     AtomicOps::getPtrRelaxed(&d_slots_p[i]));
+        if (category) {
+            table->insert(category);
+        }
+    }
+}
+
 namespace {
 
+enum {
+    k_INITIAL_TABLE_CAPACITY = 64  // number of slots of the initial lookup
+                                   // table
+};
+
+bool loadPatternPrefix(bsl::string *prefix, const char *pattern)
+    // Load into the specified 'prefix' the literal text of the specified
+    // 'pattern' (after escape sequence processing) up to, but not including,
+    // its first unescaped '*'.  Return 'true' if 'pattern' contains an
+    // unescaped '*', and 'false' otherwise.  Note that 'pattern' need not be
+    // valid; each category found using 'prefix' must still be matched
+    // against 'pattern'.
+{
+    prefix->clear();
+    for (; *pattern; ++pattern) {
+        if ('\\' == *pattern && pattern[1]) {
+            ++pattern;
+        }
+        else if ('*' == *pattern) {
+            return true;                                              // RETURN
+        }
+        prefix->push_back(*pattern);
+    }
+    return false;
+}
+
 typedef bsls::AtomicOperations AtomicOps;
 
 static
@@ -48,7 +308,8 @@ class CategoryProctor {
     // management for 'Category' objects.
 
     // PRIVATE TYPES
-    typedef bsl::vector<ball::Category *> CategoryVector;
+    typedef bsl::vector<ball::Category *>                  CategoryVector;
+    typedef bsl::map<const char *, int, bdlb::CStringLess> CategoryMap;
 
     // DATA
     Category         *d_category_p;    // category object to delete on failure
@@ -56,6 +317,9 @@ class CategoryProctor {
     CategoryVector   *d_categories_p;  // category collection to rollback on
                                        // failure
 
+    CategoryMap      *d_registry_p;    // registry from which to erase the
+                                       // category on failure
+
     bslma::Allocator *d_allocator_p;   // allocator for the category object
 
   private:
@@ -79,6 +343,10 @@ class CategoryProctor {
         // Take ownership of the 'categories' object to roll it back on
         // failure.
 
+    void setRegistry(CategoryMap *registry);
+        // Take ownership of the 'registry' object to erase the entry of the
+        // managed category from it on failure.
+
     void release();
         // Release the ownership of all objects currently managed by this
         // proctor.
@@ -94,6 +362,7 @@ CategoryProctor::CategoryProctor(Category         *category,
                                  bslma::Allocator *allocator)
 : d_category_p(category)
 , d_categories_p(0)
+, d_registry_p(0)
 , d_allocator_p(allocator)
 {
 }
@@ -101,6 +370,13 @@ CategoryProctor::CategoryProctor(Category         *category,
 inline
 CategoryProctor::~CategoryProctor()
 {
+    // Erase the registry entry first, as its key refers to the name of the
+    // category.
+
+    if (d_registry_p) {
+        d_registry_p->erase(d_category_p->categoryName());
+    }
+
     if (d_category_p) {
         d_category_p->~Category();
         d_allocator_p->deallocate(d_category_p);
@@ -118,20 +394,22 @@ void CategoryProctor::setCategories(CategoryVector *categories)
     d_categories_p = categories;
 }
 
+inline
+void CategoryProctor::setRegistry(CategoryMap *registry)
+{
+    d_registry_p = registry;
+}
+
 inline
 void CategoryProctor::release()
 {
     d_category_p   = 0;
     d_categories_p = 0;
+    d_registry_p   = 0;
 }
 
 }  // close unnamed namespace
 
-// For convenience, 'CategoryMap' defines the type of a 'CategoryManager' data
-// member.
-
-typedef bsl::map<const char *, int> CategoryMap;
-
                     // ---------------------
                     // class CategoryManager
                     // ---------------------
@@ -158,20 +436,87 @@ Category *CategoryManager::addNewCategory(const char *categoryName,
 
     d_registry[category->categoryName()] =
                                      static_cast<int>(d_categories.size() - 1);
+    proctor.setRegistry(&d_registry);
+
+    CategoryManager_Table *table = d_table_p.loadRelaxed();
+    if (table->isFull()) {
+        // Populate a larger table before publishing it, so that concurrent
+        // lookups always observe a complete table.
+
+        CategoryManager_Table *newTable = CategoryManager_Table::create(
+                                                       2 * table->capacity(),
+                                                       table,
+                                                       d_allocator_p);
+        table->insertAllInto(newTable);
+        newTable->insert(category);
+
+        d_table_p.storeRelease(newTable);
+    }
+    else {
+        table->insert(category);
+    }
     proctor.release();
 
+    d_numCategories.storeRelease(static_cast<int>(d_categories.size()));
+
     return category;
 }
 
+// PRIVATE ACCESSORS
+Category *CategoryManager::findCategory(const char *categoryName) const
+{
+    BSLS_ASSERT(categoryName);
+
+    return d_table_p.loadAcquire()->find(categoryName);
+}
+
+void CategoryManager::matchingCategories(bsl::vector<Category *> *result,
+                                         const Rule&              rule) const
+{
+    BSLS_ASSERT(result);
+
+    result->clear();
+
+    bsl::string prefix(d_allocator_p);
+    const bool  isPrefixPattern = loadPatternPrefix(&prefix, rule.pattern());
+
+    bslmt::ReadLockGuard<bslmt::ReaderWriterLock> registryGuard(
+                                                              &d_registryLock);
+
+    if (!isPrefixPattern) {
+        CategoryMap::const_iterator iter = d_registry.find(prefix.c_str());
+        if (iter != d_registry.end() && rule.isMatch(iter->first)) {
+            result->push_back(d_categories[iter->second]);
+        }
+        return;                                                       // RETURN
+    }
+
+    for (CategoryMap::const_iterator iter =
+                                        d_registry.lower_bound(prefix.c_str());
+         iter != d_registry.end()
+      && 0 == bsl::strncmp(iter->first, prefix.c_str(), prefix.length());
+         ++iter) {
+        if (rule.isMatch(iter->first)) {
+            result->push_back(d_categories[iter->second]);
+        }
+    }
+}
+
 // CREATORS
 CategoryManager::CategoryManager(bslma::Allocator *basicAllocator)
 : d_registry(bdlb::CStringLess(), basicAllocator)
+, d_table_p(0)
+, d_numCategories(0)
 , d_ruleSetSequenceNumber(
              AtomicOps::incrementInt64Nv(&categoryManagerSequenceNumber) << 48)
 , d_ruleSet(bslma::Default::allocator(basicAllocator))
 , d_categories(basicAllocator)
 , d_allocator_p(bslma::Default::allocator(basicAllocator))
 {
+    d_table_p.storeRelaxed(CategoryManager_Table::create(
+                                                     k_INITIAL_TABLE_CAPACITY,
+                                                     0,
+                                                     d_allocator_p));
 }
 
 CategoryManager::~CategoryManager()
@@ -182,6 +527,8 @@ CategoryManager::~CategoryManager()
         d_categories[i]->~Category();
         d_allocator_p->deallocate(d_categories[i]);
     }
+
+    CategoryManager_Table::destroy(d_table_p.loadRelaxed());
 }
 
 // MANIPULATORS
@@ -215,6 +562,10 @@ Category *CategoryManager::addCategory(CategoryHolder *categoryHolder,
         return 0;                                                     // RETURN
     }
 
+    if (findCategory(categoryName)) {
+        return 0;                                                     // RETURN
+    }
+
     bslmt::WriteLockGuard<bslmt::ReaderWriterLock> registryGuard(
                                                               &d_registryLock);
 
@@ -269,30 +620,22 @@ Category *CategoryManager::addCategory(CategoryHolder *categoryHolder,
 
 Category *CategoryManager::lookupCategory(const char *categoryName)
 {
-    bslmt::ReadLockGuard<bslmt::ReaderWriterLock> registryGuard(
-                                                              &d_registryLock);
-
-    CategoryMap::const_iterator iter = d_registry.find(categoryName);
-    return iter != d_registry.end() ? d_categories[iter->second] : 0;
+    return findCategory(categoryName);
 }
 
 Category *CategoryManager::lookupCategory(CategoryHolder *categoryHolder,
                                           const char     *categoryName)
 {
-    d_registryLock.lockReadReserveWrite();
+    Category *category = findCategory(categoryName);
 
-    bslmt::WriteLockGuard<bslmt::ReaderWriterLock> registryGuard(
-                                                           &d_registryLock, 1);
+    if (category && categoryHolder && !categoryHolder->category()) {
+        bslmt::WriteLockGuard<bslmt::ReaderWriterLock> registryGuard(
+                                                              &d_registryLock);
 
-    Category *category = 0;
-    CategoryMap::const_iterator iter = d_registry.find(categoryName);
-    if (iter != d_registry.end()) {
-        category = d_categories[iter->second];
-        if (categoryHolder && !categoryHolder->category()) {
-            d_registryLock.upgradeToWriteLock();
-            CategoryManagerImpUtil::linkCategoryHolder(category,
-                                                       categoryHolder);
-        }
+        // 'linkCategoryHolder' has no effect if 'categoryHolder' was linked
+        // by another thread since it was tested above.
+
+        CategoryManagerImpUtil::linkCategoryHolder(category, categoryHolder);
     }
 
     return category;
@@ -385,19 +728,22 @@ int CategoryManager::addRule(const Rule& value)
 
     const Rule *rule = d_ruleSet.getRuleById(ruleId);
 
-    for (int i = 0; i < length(); ++i) {
-        Category *category = d_categories[i];
-        if (rule->isMatch(category->categoryName())) {
-            CategoryManagerImpUtil::enableRule(category, ruleId);
-            int threshold = ThresholdAggregate::maxLevel(
+    bsl::vector<Category *> categories(d_allocator_p);
+    matchingCategories(&categories, *rule);
+
+    const int threshold = ThresholdAggregate::maxLevel(
                                                       rule->recordLevel(),
                                                       rule->passLevel(),
                                                       rule->triggerLevel(),
                                                       rule->triggerAllLevel());
-            if (threshold > category->ruleThreshold()) {
-                CategoryManagerImpUtil::setRuleThreshold(category, threshold);
-                CategoryManagerImpUtil::updateThresholdForHolders(category);
-            }
+
+    for (bsl::size_t i = 0; i < categories.size(); ++i) {
+        Category *category = categories[i];
+
+        CategoryManagerImpUtil::enableRule(category, ruleId);
+        if (threshold > category->ruleThreshold()) {
+            CategoryManagerImpUtil::setRuleThreshold(category, threshold);
+            CategoryManagerImpUtil::updateThresholdForHolders(category);
         }
     }
     return 1;
@@ -428,34 +774,34 @@ int CategoryManager::removeRule(const Rule& value)
 
     const Rule *rule = d_ruleSet.getRuleById(ruleId);
 
-    for (int i = 0; i < length(); ++i) {
-        Category *category = d_categories[i];
-        if (rule->isMatch(category->categoryName())) {
-            CategoryManagerImpUtil::disableRule(category, ruleId);
-            CategoryManagerImpUtil::setRuleThreshold(category, 0);
+    bsl::vector<Category *> categories(d_allocator_p);
+    matchingCategories(&categories, *rule);
+
+    for (bsl::size_t i = 0; i < categories.size(); ++i) {
+        Category *category = categories[i];
 
-            RuleSet::MaskType relevantRuleMask = category->relevantRuleMask();
+        CategoryManagerImpUtil::disableRule(category, ruleId);
+        CategoryManagerImpUtil::setRuleThreshold(category, 0);
 
-            int j;
+        RuleSet::MaskType relevantRuleMask = category->relevantRuleMask();
 
-            while ((j = bdlb::BitUtil::numTrailingUnsetBits(relevantRuleMask))
+        int j;
+
+        while ((j = bdlb::BitUtil::numTrailingUnsetBits(relevantRuleMask))
                                                  != RuleSet::e_MAX_NUM_RULES) {
-                relevantRuleMask =
-                    bdlb::BitUtil::withBitCleared(relevantRuleMask, j);
+            relevantRuleMask = bdlb::BitUtil::withBitCleared(relevantRuleMask,
+                                                             j);
 
-                const Rule *r = d_ruleSet.getRuleById(j);
-                int threshold = ThresholdAggregate::maxLevel(
-                                                         r->recordLevel(),
+            const Rule *r = d_ruleSet.getRuleById(j);
+            int threshold = ThresholdAggregate::maxLevel(r->recordLevel(),
                                                          r->passLevel(),
                                                          r->triggerLevel(),
                                                          r->triggerAllLevel());
-                if (threshold > category->ruleThreshold()) {
-                    CategoryManagerImpUtil::setRuleThreshold(category,
-                                                             threshold);
-                }
+            if (threshold > category->ruleThreshold()) {
+                CategoryManagerImpUtil::setRuleThreshold(category, threshold);
             }
-            CategoryManagerImpUtil::updateThresholdForHolders(category);
         }
+        CategoryManagerImpUtil::updateThresholdForHolders(category);
     }
 
     d_ruleSet.removeRuleById(ruleId);
@@ -480,11 +826,26 @@ void CategoryManager::removeAllRules()
 
     ++d_ruleSetSequenceNumber;
 
-    for (int i = 0; i < length(); ++i) {
-        if (d_categories[i]->relevantRuleMask()) {
-            CategoryManagerImpUtil::setRelevantRuleMask(d_categories[i], 0);
-            CategoryManagerImpUtil::setRuleThreshold(d_categories[i], 0);
-            CategoryManagerImpUtil::updateThresholdForHolders(d_categories[i]);
+    // Only the categories matching a rule can have a non-zero rule mask.
+
+    bsl::vector<Category *> categories(d_allocator_p);
+
+    for (int ruleId = 0; ruleId < RuleSet::maxNumRules(); ++ruleId) {
+        const Rule *rule = d_ruleSet.getRuleById(ruleId);
+        if (!rule) {
+            continue;
+        }
+
+        matchingCategories(&categories, *rule);
+
+        for (bsl::size_t i = 0; i < categories.size(); ++i) {
+            Category *category = categories[i];
+
+            if (category->relevantRuleMask()) {
+                CategoryManagerImpUtil::setRelevantRuleMask(category, 0);
+                CategoryManagerImpUtil::setRuleThreshold(category, 0);
+                CategoryManagerImpUtil::updateThresholdForHolders(category);
+            }
         }
     }
     d_ruleSet.removeAllRules();
@@ -493,11 +854,7 @@ void CategoryManager::removeAllRules()
 // ACCESSORS
 const Category *CategoryManager::lookupCategory(const char *categoryName) const
 {
-    bslmt::ReadLockGuard<bslmt::ReaderWriterLock> registryGuard(
-                                                              &d_registryLock);
-
-    CategoryMap::const_iterator iter = d_registry.find(categoryName);
-    return iter != d_registry.end() ? d_categories[iter->second] : 0;
+    return findCategory(categoryName);
 }
 
 }  // close package namespace
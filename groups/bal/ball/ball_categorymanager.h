@@ -48,6 +48,24 @@ BSLS_IDENT("$Id: $")
 // same instance can be safely invoked from any thread concurrently with any
 // other operation.
 //
+///Performance
+///-----------
+// Looking up a category by name ('lookupCategory') does not acquire a lock,
+// and so does not contend with other lookups, nor with the addition of
+// categories, in other threads.  The categories are indexed by an
+// insert-only hash table that is replaced, when it must grow, by a larger
+// copy; readers that are still using a replaced table continue to see a
+// consistent (if possibly stale) set of categories, and replaced tables are
+// reclaimed only when the category manager is destroyed.  Note that the
+// memory retained by replaced tables is less than that of the current table.
+//
+// Adding or removing a rule ('addRule', 'removeRule', etc.) only visits the
+// categories whose names can match the pattern of the rule: a rule whose
+// pattern ends with '*' visits the categories having the corresponding
+// prefix, and any other rule visits at most one category.  Therefore, the
+// cost of changing the rule set does not grow with the number of categories
+// that are unaffected by the change.
+//
 ///Usage
 ///-----
 // The code fragments in the following example illustrate some basic operations
@@ -169,6 +187,7 @@ BSLS_IDENT("$Id: $")
 #include <bslmt_readlockguard.h>
 #include <bslmt_readerwriterlock.h>
 
+#include <bsls_atomic.h>
 #include <bsls_types.h>
 
 #include <bsl_map.h>
@@ -179,6 +198,8 @@ BSLS_IDENT("$Id: $")
 namespace BloombergLP {
 namespace ball {
 
+class CategoryManager_Table;
+
                         // =====================
                         // class CategoryManager
                         // =====================
@@ -189,11 +210,23 @@ class CategoryManager {
     // threshold levels of existing categories may be accessed and modified
     // directly.
 
+    // PRIVATE TYPES
+    typedef bsl::map<const char *, int, bdlb::CStringLess> CategoryMap;
+
     // DATA
-    bsl::map<const char *, int, bdlb::CStringLess>
-                                     d_registry;      // mapping names to
+    CategoryMap                      d_registry;      // mapping names to
                                                       // indices in
-                                                      // 'd_categories'
+                                                      // 'd_categories', in
+                                                      // name order
+
+    bsls::AtomicPointer<CategoryManager_Table>
+                                     d_table_p;       // hash table providing
+                                                      // lock-free lookup of
+                                                      // categories by name
+                                                      // (owned)
+
+    bsls::AtomicInt                  d_numCategories; // number of categories
+                                                      // in 'd_categories'
 
     volatile bsls::Types::Int64      d_ruleSetSequenceNumber;
                                                       // sequence number that
@@ -237,6 +270,20 @@ class CategoryManager {
         // that the category registry should be properly synchronized before
         // calling this method.
 
+    // PRIVATE ACCESSORS
+    Category *findCategory(const char *categoryName) const;
+        // Return the address of the modifiable category having the specified
+        // 'categoryName' in the registry of this category manager, or 0 if no
+        // such category exists.  Note that this method does not acquire a
+        // lock.
+
+    void matchingCategories(bsl::vector<Category *> *result,
+                            const Rule&              rule) const;
+        // Load into the specified 'result' the addresses of the categories in
+        // the registry of this category manager whose names match the pattern
+        // of the specified 'rule'.  Only the categories whose names can match
+        // the pattern are visited (see {Performance}).
+
   public:
     // CREATORS
     explicit CategoryManager(bslma::Allocator *basicAllocator = 0);
@@ -561,8 +608,7 @@ void CategoryManager::visitCategories(const CATEGORY_VISITOR& visitor)
 inline
 int CategoryManager::length() const
 {
-    bslmt::ReadLockGuard<bslmt::ReaderWriterLock> guard(&d_registryLock);
-    return static_cast<int>(d_categories.size());
+    return d_numCategories.loadAcquire();
 }
 
 inline
@@ -131,6 +131,7 @@ using namespace bsl;
 // [12] TESTING IMPACT OF RULES ON CATEGORY HOLDERS
 // [13] CONCURRENCY TEST: RULES
 // [14] UNIQUENESS OF INITIAL RULE SET SEQUENCE NUMBER
+// [18] LOCK-FREE LOOKUP AND PREFIX-BASED RULE MATCHING
 // [15] USAGE EXAMPLE
 
 // ============================================================================
@@ -596,6 +597,116 @@ extern "C" void *seqNumUniquenessThread(void *args)
 
 }  // close namespace BALL_CATEGORYMANAGER_UNIQUENESS_OF_SEQUENCE_NUMBERS
 
+// ============================================================================
+//                         CASE 18 RELATED ENTITIES
+// ----------------------------------------------------------------------------
+
+namespace BALL_CATEGORYMANAGER_LOOKUP_AND_RULE_MATCHING {
+
+enum {
+    k_NUM_PRESET     = 1000,  // categories added before threads start
+    k_NUM_PER_WRITER = 2000,  // categories added by each writer thread
+    k_NUM_WRITERS    = 3,
+    k_NUM_READERS    = 3,
+    k_NUM_THREADS    = k_NUM_WRITERS + k_NUM_READERS
+};
+
+void makeName(char *buffer, bsl::size_t size, const char *prefix, int index)
+    // Load into the specified 'buffer' of the specified 'size' a category
+    // name formed from the specified 'prefix' and 'index'.
+{
+    bsl::snprintf(buffer, size, "%s.%d", prefix, index);
+}
+
+void verifyRuleState(const Obj& X, int line)
+    // Verify that the relevant rule mask and the rule threshold of each
+    // category in the specified 'X' are those obtained by matching the
+    // category against every rule of 'X', and report any discrepancy using
+    // the specified 'line'.
+{
+    const ball::RuleSet& ruleSet = X.ruleSet();
+
+    for (int i = 0; i < X.length(); ++i) {
+        const Entry& category = X[i];
+
+        MaskType mask      = 0;
+        int      threshold = 0;
+
+        for (int j = 0; j < ball::RuleSet::maxNumRules(); ++j) {
+            const ball::Rule *rule = ruleSet.getRuleById(j);
+            if (rule && rule->isMatch(category.categoryName())) {
+                mask     |= static_cast<MaskType>(1) << j;
+                threshold = bsl::max(threshold,
+                                     Thresholds::maxLevel(
+                                                     rule->recordLevel(),
+                                                     rule->passLevel(),
+                                                     rule->triggerLevel(),
+                                                     rule->triggerAllLevel()));
+            }
+        }
+
+        ASSERTV(line, category.categoryName(),
+                mask == category.relevantRuleMask());
+        ASSERTV(line, category.categoryName(), threshold,
+                threshold == category.ruleThreshold());
+    }
+}
+
+struct ThreadArgs {
+    Obj            *d_manager_p;  // category manager under test
+    bslmt::Barrier *d_barrier_p;  // start barrier
+    int             d_index;      // index of writer, or -1 for reader
+};
+
+extern "C" void *lookupThread(void *args)
+    // Add categories to, or look up categories in, the category manager
+    // described by the specified 'args', and verify that each preset
+    // category, and each category added by the calling thread, is always
+    // found.
+{
+    ThreadArgs *threadArgs = reinterpret_cast<ThreadArgs *>(args);
+    Obj        *manager    = threadArgs->d_manager_p;
+
+    char name[32];
+
+    threadArgs->d_barrier_p->wait();
+
+    if (0 <= threadArgs->d_index) {
+        char prefix[16];
+        bsl::snprintf(prefix, sizeof prefix, "W%d", threadArgs->d_index);
+
+        for (int i = 0; i < k_NUM_PER_WRITER; ++i) {
+            makeName(name, sizeof name, prefix, i);
+
+            Entry *category = manager->addCategory(name, 1, 2, 3, 4);
+            MTLOOP_ASSERT(name, category);
+            MTLOOP_ASSERT(name, category == manager->lookupCategory(name));
+
+            makeName(name, sizeof name, "P", i % k_NUM_PRESET);
+            MTLOOP_ASSERT(name, manager->lookupCategory(name));
+        }
+    }
+    else {
+        for (int j = 0; j < 20; ++j) {
+            for (int i = 0; i < k_NUM_PRESET; ++i) {
+                makeName(name, sizeof name, "P", i);
+
+                const Entry *category = manager->lookupCategory(name);
+                MTLOOP_ASSERT(name, category);
+                MTLOOP_ASSERT(name,
+                    category && 0 == bsl::strcmp(name,
+                                                 category->categoryName()));
+            }
+            makeName(name, sizeof name, "missing", j);
+            MTLOOP_ASSERT(name, 0 == manager->lookupCategory(name));
+        }
+    }
+
+    return 0;
+}
+
+}  // close namespace BALL_CATEGORYMANAGER_LOOKUP_AND_RULE_MATCHING
+
 //=============================================================================
 //                                 MAIN PROGRAM
 //-----------------------------------------------------------------------------
@@ -613,6 +724,228 @@ int main(int argc, char *argv[])
     bslma::TestAllocator testAllocator(veryVeryVerbose);
 
     switch (test) { case 0:  // Zero is always the leading case.
+      case 18: {
+        // --------------------------------------------------------------------
+        // LOCK-FREE LOOKUP AND PREFIX-BASED RULE MATCHING
+        //
+        // Concerns:
+        //: 1 Every category remains accessible by name as the number of
+        //:   categories grows, and lookup of a name that is not registered
+        //:   returns 0.
+        //:
+        //: 2 Categories can be looked up by some threads while others add
+        //:   categories.
+        //:
+        //: 3 Adding and removing rules whose patterns are exact names,
+        //:   prefixes (including the empty prefix), or contain escape
+        //:   sequences update the relevant rule mask and rule threshold of
+        //:   exactly the categories that match, and 'removeAllRules' resets
+        //:   every category.
+        //:
+        //: 4 'addCategory' is exception neutral, in particular when the
+        //:   lookup table grows: a category whose addition fails is neither
+        //:   found, nor matched by rules, and can be added again.
+        //
+        // Plan:
+        //: 1 Add a large number of categories, verifying after each addition
+        //:   that each category added so far is found, and that an
+        //:   unregistered name is not.  (C-1)
+        //:
+        //: 2 Start writer threads that add categories, and reader threads
+        //:   that look up categories added before the threads were started.
+        //:   Verify that each category is found.  (C-2)
+        //:
+        //: 3 Using an oracle that matches every category against every rule,
+        //:   verify the state of every category after each rule is added or
+        //:   removed, and after 'removeAllRules'.  (C-3)
+        //:
+        //: 4 Add enough categories to grow the lookup table several times,
+        //:   each in an exception test loop, verifying that a failed addition
+        //:   leaves the manager unchanged.  Then add a rule matching every
+        //:   category, and verify the state of every category.  (C-4)
+        //
+        // Testing:
+        //   LOCK-FREE LOOKUP AND PREFIX-BASED RULE MATCHING
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "LOCK-FREE LOOKUP AND PREFIX-BASED RULE MATCHING"
+                          << endl
+                          << "==============================================="
+                          << endl;
+
+        using namespace BALL_CATEGORYMANAGER_LOOKUP_AND_RULE_MATCHING;
+
+        if (verbose) cout << "\tGrowing the registry." << endl;
+
+        bslma::TestAllocator ta(veryVeryVerbose);
+        {
+            Obj mX(&ta);  const Obj& X = mX;
+
+            enum { k_NUM_CATEGORIES = 600 };
+
+            char name[32];
+
+            for (int i = 0; i < k_NUM_CATEGORIES; ++i) {
+                makeName(name, sizeof name, "GROW", i);
+                Entry *category = mX.addCategory(name, 1, 2, 3, 4);
+                ASSERTV(i, category);
+                ASSERTV(i, 0 == mX.addCategory(name, 1, 2, 3, 4));
+                ASSERTV(i, i + 1 == X.length());
+
+                for (int j = 0; j <= i; ++j) {
+                    makeName(name, sizeof name, "GROW", j);
+                    const Entry *found = X.lookupCategory(name);
+                    ASSERTV(i, j, found);
+                    ASSERTV(i, j, found && &X[j] == found);
+                }
+                makeName(name, sizeof name, "GROW", i + 1);
+                ASSERTV(i, 0 == X.lookupCategory(name));
+            }
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+
+        if (verbose) cout << "\tConcurrent lookup." << endl;
+        {
+            Obj mX(&ta);  const Obj& X = mX;
+
+            char name[32];
+
+            for (int i = 0; i < k_NUM_PRESET; ++i) {
+                makeName(name, sizeof name, "P", i);
+                ASSERTV(i, mX.addCategory(name, 1, 2, 3, 4));
+            }
+
+            bslmt::Barrier            barrier(k_NUM_THREADS);
+            ThreadArgs                args[k_NUM_THREADS];
+            bslmt::ThreadUtil::Handle handles[k_NUM_THREADS];
+
+            for (int i = 0; i < k_NUM_THREADS; ++i) {
+                args[i].d_manager_p = &mX;
+                args[i].d_barrier_p = &barrier;
+                args[i].d_index     = i < k_NUM_WRITERS ? i : -1;
+
+                ASSERT(0 == bslmt::ThreadUtil::create(&handles[i],
+                                                      &lookupThread,
+                                                      &args[i]));
+            }
+            for (int i = 0; i < k_NUM_THREADS; ++i) {
+                ASSERT(0 == bslmt::ThreadUtil::join(handles[i]));
+            }
+
+            ASSERT(k_NUM_PRESET + k_NUM_WRITERS * k_NUM_PER_WRITER
+                                                               == X.length());
+        }
+
+        if (verbose) cout << "\tRule matching." << endl;
+        {
+            Obj mX(&ta);  const Obj& X = mX;
+
+            static const char *const SPECIAL[] = {
+                "", "A", "A.", "AB", "X*Y", "X*", "X\\Y", "X", "*", "B.A.1"
+            };
+            const int NUM_SPECIAL = sizeof SPECIAL / sizeof *SPECIAL;
+
+            char name[32];
+
+            for (int i = 0; i < 200; ++i) {
+                makeName(name, sizeof name, 0 == i % 2 ? "A.B" : "A.C", i);
+                ASSERTV(i, mX.addCategory(name, 1, 2, 3, 4));
+            }
+            for (int i = 0; i < NUM_SPECIAL; ++i) {
+                ASSERTV(i, mX.addCategory(SPECIAL[i], 1, 2, 3, 4));
+            }
+
+            static const struct {
+                int         d_line;
+                const char *d_pattern;
+                int         d_level;
+            } DATA[] = {
+                //LINE  PATTERN     LEVEL
+                //----  ----------  -----
+                { L_,   "A.B*",        10 },
+                { L_,   "A.B.10",      20 },
+                { L_,   "A*",           5 },
+                { L_,   "*",            3 },
+                { L_,   "",            40 },
+                { L_,   "X\\*Y",       50 },
+                { L_,   "X\\**",       60 },
+                { L_,   "X\\\\Y",      70 },
+                { L_,   "\\*",         80 },
+                { L_,   "A.C.1*",      90 },
+                { L_,   "NOMATCH*",   100 },
+                { L_,   "A.B.11",     110 },
+                { L_,   "X*Y",        120 },  // invalid: matches nothing
+            };
+            const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+            for (int ti = 0; ti < NUM_DATA; ++ti) {
+                const int   LINE    = DATA[ti].d_line;
+                const char *PATTERN = DATA[ti].d_pattern;
+                const int   LEVEL   = DATA[ti].d_level;
+
+                ball::Rule rule(PATTERN, LEVEL, LEVEL, LEVEL, LEVEL);
+                ASSERTV(LINE, 1 == mX.addRule(rule));
+                verifyRuleState(X, LINE);
+            }
+
+            // Remove every other rule, then the remaining rules.
+
+            for (int ti = 0; ti < NUM_DATA; ti += 2) {
+                const int   LINE    = DATA[ti].d_line;
+                const char *PATTERN = DATA[ti].d_pattern;
+                const int   LEVEL   = DATA[ti].d_level;
+
+                ball::Rule rule(PATTERN, LEVEL, LEVEL, LEVEL, LEVEL);
+                ASSERTV(LINE, 1 == mX.removeRule(rule));
+                verifyRuleState(X, LINE);
+            }
+
+            // Categories added after the rules are matched on addition.
+
+            mX.addCategory("A.B.new", 1, 2, 3, 4);
+            mX.addCategory("X*Ynew", 1, 2, 3, 4);
+            verifyRuleState(X, L_);
+
+            mX.removeAllRules();
+            for (int i = 0; i < X.length(); ++i) {
+                ASSERTV(i, 0 == X[i].relevantRuleMask());
+                ASSERTV(i, 0 == X[i].ruleThreshold());
+            }
+            verifyRuleState(X, L_);
+        }
+
+        if (verbose) cout << "\tException neutrality." << endl;
+        {
+            Obj mX(&ta);  const Obj& X = mX;
+
+            // The initial lookup table of 64 slots grows when it becomes
+            // half full, so 200 categories grow it twice.
+
+            enum { k_NUM_CATEGORIES = 200 };
+
+            char name[32];
+
+            for (int i = 0; i < k_NUM_CATEGORIES; ++i) {
+                makeName(name, sizeof name, "EXC", i);
+
+                BSLMA_TESTALLOCATOR_EXCEPTION_TEST_BEGIN(ta) {
+                    ASSERTV(i, i == X.length());
+                    ASSERTV(i, 0 == X.lookupCategory(name));
+
+                    ASSERTV(i, mX.addCategory(name, 1, 2, 3, 4));
+                } BSLMA_TESTALLOCATOR_EXCEPTION_TEST_END
+
+                ASSERTV(i, i + 1 == X.length());
+                ASSERTV(i, &X[i] == X.lookupCategory(name));
+            }
+
+            ball::Rule rule("EXC*", 10, 10, 10, 10);
+            ASSERT(1 == mX.addRule(rule));
+            verifyRuleState(X, L_);
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+      } break;
 #ifndef BDE_OMIT_INTERNAL_DEPRECATED
       case 17: {
         // --------------------------------------------------------------------
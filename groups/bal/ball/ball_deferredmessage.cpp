@@ -0,0 +1,375 @@
+// ball_deferredmessage.cpp                                           -*-C++-*-
+#include <ball_deferredmessage.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(ball_deferredmessage_cpp,"$Id$ $CSID$")
+
+#include <bsls_platform.h>
+
+#include <bsl_cstring.h>
+#include <bsl_vector.h>
+
+#include <stdio.h>  // *NOT* <bsl_cstdio.h>, which does not declare 'snprintf'
+
+#if defined(BSLS_PLATFORM_CMP_MSVC)
+#define snprintf _snprintf
+#endif
+
+///Implementation Notes
+///--------------------
+// Each conversion specification is rewritten into a specification for the
+// type in which the corresponding argument was captured (e.g., "%5lu" is
+// rewritten as "%5llu", and "%-*d" with a captured width of 7 as "%-7lld"),
+// and the value is then formatted with 'snprintf'.  Rewriting the
+// specification in terms of the captured type keeps the call to 'snprintf'
+// well-defined regardless of the length modifiers used by the client.
+
+namespace BloombergLP {
+namespace ball {
+
+namespace {
+
+enum {
+    k_MAX_SPEC_LENGTH = 64,   // longest rewritten conversion specification
+
+    k_LOCAL_BUFFER_SIZE = 128 // size of on-stack formatting buffer
+};
+
+template <class TYPE>
+void writeFormatted(bsl::streambuf *buffer, const char *spec, TYPE value)
+    // Format the specified 'value' according to the specified 'printf'-style
+    // conversion 'spec', and write the result to the specified 'buffer'.
+{
+    char      local[k_LOCAL_BUFFER_SIZE];
+    const int length = snprintf(local, sizeof local, spec, value);
+
+    if (length < 0) {
+        return;                                                       // RETURN
+    }
+
+    if (length < static_cast<int>(sizeof local)) {
+        buffer->sputn(local, length);
+        return;                                                       // RETURN
+    }
+
+    // The result did not fit (e.g., a wide field width was requested).
+
+    bsl::vector<char> heap(length + 1);
+    snprintf(heap.data(), heap.size(), spec, value);
+    buffer->sputn(heap.data(), length);
+}
+
+bool appendToSpec(char *spec, int *specLength, const char *text, int length)
+    // Append the specified 'length' characters of the specified 'text' to the
+    // specified 'spec' having the specified 'specLength', and update
+    // 'specLength'.  Return 'true' on success, and 'false' (with no effect)
+    // if the resulting specification would be too long.
+{
+    if (*specLength + length >= k_MAX_SPEC_LENGTH) {
+        return false;                                                 // RETURN
+    }
+    bsl::memcpy(spec + *specLength, text, length);
+    *specLength += length;
+    spec[*specLength] = '\0';
+    return true;
+}
+
+}  // close unnamed namespace
+
+                           // ---------------------
+                           // class DeferredMessage
+                           // ---------------------
+
+// PRIVATE CONSTANTS
+const bsl::size_t DeferredMessage::k_NULL_STRING =
+                                                 ~static_cast<bsl::size_t>(0);
+
+// PRIVATE ACCESSORS
+const char *DeferredMessage::stringArgument(const Argument& argument) const
+{
+    BSLS_ASSERT(e_STRING == argument.d_type);
+
+    return k_NULL_STRING == argument.d_value.d_offset
+           ? 0
+           : d_strings.data() + argument.d_value.d_offset;
+}
+
+// MANIPULATORS
+void DeferredMessage::appendArgument(const char *value)
+{
+    if (0 == value) {
+        d_arguments.resize(d_arguments.size() + 1);
+        Argument& argument        = d_arguments.back();
+        argument.d_type           = e_STRING;
+        argument.d_value.d_offset = k_NULL_STRING;
+        return;                                                       // RETURN
+    }
+    appendArgument(bslstl::StringRef(value));
+}
+
+void DeferredMessage::appendArgument(const bslstl::StringRef& value)
+{
+    const bsl::size_t offset = d_strings.length();
+
+    d_strings.append(value.data(), value.length());
+    d_strings.push_back('\0');
+
+    d_arguments.resize(d_arguments.size() + 1);
+    Argument& argument        = d_arguments.back();
+    argument.d_type           = e_STRING;
+    argument.d_value.d_offset = offset;
+}
+
+// ACCESSORS
+int DeferredMessage::formatMessage(bsl::streambuf *buffer) const
+{
+    BSLS_ASSERT(buffer);
+
+    if (!d_format_p) {
+        return 0;                                                     // RETURN
+    }
+
+    const bsl::size_t numArgs  = d_arguments.size();
+    bsl::size_t       argIndex = 0;
+    int               rc       = 0;
+
+    const char *p = d_format_p;
+
+    while (*p) {
+        const char *literal = p;
+        while (*p && '%' != *p) {
+            ++p;
+        }
+        if (p != literal) {
+            buffer->sputn(literal, p - literal);
+        }
+        if (!*p) {
+            break;
+        }
+
+        const char *specBegin = p++;  // skip '%'
+
+        if ('%' == *p) {
+            buffer->sputc('%');
+            ++p;
+            continue;
+        }
+
+        // Rebuild the specification, resolving any '*' width or precision
+        // from the captured arguments.
+
+        char spec[k_MAX_SPEC_LENGTH];
+        int  specLength = 0;
+        bool valid      = appendToSpec(spec, &specLength, "%", 1);
+
+        while (*p && bsl::strchr("-+ #0", *p)) {
+            valid = valid && appendToSpec(spec, &specLength, p, 1);
+            ++p;
+        }
+
+        for (int part = 0; part < 2; ++part) {
+            if (1 == part) {
+                if ('.' != *p) {
+                    break;
+                }
+                valid = valid && appendToSpec(spec, &specLength, p, 1);
+                ++p;
+            }
+            if ('*' == *p) {
+                ++p;
+                if (argIndex < numArgs
+                 && (e_INT64  == d_arguments[argIndex].d_type
+                  || e_UINT64 == d_arguments[argIndex].d_type)) {
+                    char digits[32];
+                    const int length = snprintf(
+                           digits,
+                           sizeof digits,
+                           "%d",
+                           static_cast<int>(
+                                     d_arguments[argIndex].d_value.d_int64));
+                    valid = valid
+                         && appendToSpec(spec, &specLength, digits, length);
+                    ++argIndex;
+                }
+                else {
+                    valid = false;
+                }
+            }
+            else {
+                const char *digits = p;
+                while ('0' <= *p && *p <= '9') {
+                    ++p;
+                }
+                valid = valid && appendToSpec(spec,
+                                              &specLength,
+                                              digits,
+                                              static_cast<int>(p - digits));
+            }
+        }
+
+        // Length modifiers are ignored: the captured type determines the
+        // modifier used.
+
+        while (*p && bsl::strchr("hlLqjzt", *p)) {
+            ++p;
+        }
+
+        const char conversion = *p;
+        if (conversion) {
+            ++p;
+        }
+
+        if (!valid || !conversion || argIndex >= numArgs
+         || !bsl::strchr("diuoxXcfFeEgGaAsp", conversion)) {
+            buffer->sputn(specBegin, p - specBegin);
+            rc = 1;
+            continue;
+        }
+
+        const Argument& argument = d_arguments[argIndex++];
+
+        switch (conversion) {
+          case 'd':
+          case 'i': {
+            appendToSpec(spec, &specLength, "lld", 3);
+
+            long long value = argument.d_value.d_int64;
+            if (e_DOUBLE == argument.d_type) {
+                value = static_cast<long long>(argument.d_value.d_double);
+            }
+            else if (e_STRING == argument.d_type) {
+                rc    = 1;
+                value = 0;
+            }
+            writeFormatted(buffer, spec, value);
+          } break;
+          case 'u':
+          case 'o':
+          case 'x':
+          case 'X': {
+            const char suffix[] = { 'l', 'l', conversion };
+            appendToSpec(spec, &specLength, suffix, 3);
+
+            unsigned long long value = argument.d_value.d_uint64;
+            if (e_DOUBLE == argument.d_type) {
+                value = static_cast<unsigned long long>(
+                                                  argument.d_value.d_double);
+            }
+            else if (e_STRING == argument.d_type) {
+                rc    = 1;
+                value = 0;
+            }
+            writeFormatted(buffer, spec, value);
+          } break;
+          case 'c': {
+            appendToSpec(spec, &specLength, "c", 1);
+
+            int value = static_cast<int>(argument.d_value.d_int64);
+            if (e_DOUBLE == argument.d_type) {
+                value = static_cast<int>(argument.d_value.d_double);
+            }
+            else if (e_STRING == argument.d_type) {
+                const char *string = stringArgument(argument);
+                value = string ? *string : 0;
+            }
+            writeFormatted(buffer, spec, value);
+          } break;
+          case 's': {
+            appendToSpec(spec, &specLength, "s", 1);
+
+            if (e_STRING == argument.d_type) {
+                const char *string = stringArgument(argument);
+                writeFormatted(buffer, spec, string ? string : "(null)");
+            }
+            else {
+                // Format the numeric value in its default representation, and
+                // then apply the width and precision of the specification.
+
+                char        text[64];
+                const char *defaultSpec = e_DOUBLE  == argument.d_type
+                                          ? "%g"
+                                          : e_UINT64 == argument.d_type
+                                          ? "%llu"
+                                          : e_POINTER == argument.d_type
+                                          ? "%p"
+                                          : "%lld";
+                if (e_DOUBLE == argument.d_type) {
+                    snprintf(text,
+                             sizeof text,
+                             defaultSpec,
+                             argument.d_value.d_double);
+                }
+                else if (e_POINTER == argument.d_type) {
+                    snprintf(text,
+                             sizeof text,
+                             defaultSpec,
+                             argument.d_value.d_pointer);
+                }
+                else {
+                    snprintf(text,
+                             sizeof text,
+                             defaultSpec,
+                             argument.d_value.d_int64);
+                }
+                writeFormatted(buffer, spec, static_cast<const char *>(text));
+            }
+          } break;
+          case 'p': {
+            appendToSpec(spec, &specLength, "p", 1);
+
+            const void *value = argument.d_value.d_pointer;
+            if (e_STRING == argument.d_type) {
+                value = stringArgument(argument);
+            }
+            else if (e_DOUBLE == argument.d_type) {
+                rc    = 1;
+                value = 0;
+            }
+            writeFormatted(buffer, spec, value);
+          } break;
+          default: {
+            // Floating-point conversions.
+
+            appendToSpec(spec, &specLength, &conversion, 1);
+
+            double value = argument.d_value.d_double;
+            if (e_INT64 == argument.d_type) {
+                value = static_cast<double>(argument.d_value.d_int64);
+            }
+            else if (e_UINT64 == argument.d_type) {
+                value = static_cast<double>(argument.d_value.d_uint64);
+            }
+            else if (e_DOUBLE != argument.d_type) {
+                rc    = 1;
+                value = 0;
+            }
+            writeFormatted(buffer, spec, value);
+          }
+        }
+    }
+
+    if (argIndex != numArgs) {
+        rc = 1;
+    }
+
+    return rc;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,466 @@
+// ball_deferredmessage.h                                             -*-C++-*-
+#ifndef INCLUDED_BALL_DEFERREDMESSAGE
+#define INCLUDED_BALL_DEFERREDMESSAGE
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide a captured 'printf'-style format and its argument values.
+//
+//@CLASSES:
+//  ball::DeferredMessage: 'printf'-style format with captured argument values
+//
+//@SEE_ALSO: ball_record, ball_log
+//
+//@DESCRIPTION: This component provides a class, 'ball::DeferredMessage', that
+// holds the address of a 'printf'-style format specification together with
+// copies of the values of the arguments to be formatted according to that
+// specification.  Capturing the argument values is considerably cheaper than
+// formatting them, so a 'ball::DeferredMessage' allows the (relatively
+// expensive) formatting of a log message to be moved from the thread that
+// generates a log record to the thread that publishes it (e.g., the
+// publication thread of a 'ball::AsyncFileObserver').  The formatting is
+// performed by the 'formatMessage' accessor.
+//
+// The format specification is *held*, not copied, and therefore must remain
+// valid until the message is formatted; in practice the format specification
+// should have static storage duration (e.g., be a string literal).  Argument
+// values, on the other hand, are copied into the 'ball::DeferredMessage'
+// object, including the characters of string arguments, so the arguments need
+// not outlive the call that captures them.
+//
+///Supported Conversions
+///---------------------
+// Captured arguments are stored as one of the types enumerated by
+// 'ball::DeferredMessage::ArgumentType': a signed 64-bit integer, an unsigned
+// 64-bit integer, a 'double', a string, or a pointer.  When formatting, any
+// length modifier in a conversion specification (e.g., 'l', 'll', 'h', 'z')
+// is ignored, and the captured value is converted to the type implied by the
+// conversion character:
+//..
+//  Conversion           Formatted As
+//  -------------------  ---------------------------------------------------
+//  d i                  signed 64-bit integer
+//  u o x X              unsigned 64-bit integer
+//  c                    character
+//  f F e E g G a A      'double'
+//  s                    string (numeric values use their default format)
+//  p                    pointer
+//..
+// Flags, field width, and precision (including '*' for either) are honored as
+// by 'printf'.  The '%n' conversion is not supported, and is written to the
+// output verbatim.  Note that, unlike 'printf', formatting a
+// 'ball::DeferredMessage' whose captured arguments do not match its format
+// specification is well-defined: surplus arguments are ignored, conversion
+// specifications for which there is no argument are written verbatim, and
+// 'formatMessage' returns a non-zero value to report the mismatch.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Capturing and Later Formatting a Message
+///- - - - - - - - - - - - - - - - - - - - - - - - - -
+// Users of the 'ball' logging subsystem are not expected to use
+// 'ball::DeferredMessage' directly; rather, the 'BALL_LOGVA_FAST' family of
+// macros in 'ball_log' capture their arguments into the
+// 'ball::DeferredMessage' held by a log record.  In this example we show what
+// happens underneath those macros.
+//
+// First, we create a 'ball::DeferredMessage' and capture a format
+// specification and three arguments.  Note that the string argument is copied
+// into 'message', so 'symbol' can safely go out of scope:
+//..
+//  ball::DeferredMessage message;
+//  {
+//      bsl::string symbol("IBM");
+//
+//      message.setFormat("%d shares of %s sold at %.2f");
+//      message.appendArgument(400);
+//      message.appendArgument(symbol);
+//      message.appendArgument(141.5);
+//  }
+//  assert(3 == message.numArguments());
+//..
+// Then, possibly much later and on another thread, we format the message into
+// a stream buffer:
+//..
+//  bdlsb::MemOutStreamBuf buffer;
+//  int rc = message.formatMessage(&buffer);
+//  assert(0 == rc);
+//
+//  assert(bsl::string(buffer.data(), buffer.length()) ==
+//                                        "400 shares of IBM sold at 141.50");
+//..
+
+#include <balscm_version.h>
+
+#include <bslma_allocator.h>
+#include <bslma_usesbslmaallocator.h>
+
+#include <bslmf_nestedtraitdeclaration.h>
+
+#include <bsls_assert.h>
+#include <bsls_review.h>
+#include <bsls_types.h>
+
+#include <bslstl_stringref.h>
+
+#include <bsl_cstddef.h>
+#include <bsl_streambuf.h>
+#include <bsl_string.h>
+#include <bsl_vector.h>
+
+namespace BloombergLP {
+namespace ball {
+
+                           // =====================
+                           // class DeferredMessage
+                           // =====================
+
+class DeferredMessage {
+    // This class holds the address of a 'printf'-style format specification
+    // and a sequence of captured argument values, and can format those values
+    // according to the specification on demand.  This class is not
+    // value-semantic, but supports copy construction and assignment.
+
+  public:
+    // TYPES
+    enum ArgumentType {
+        // Enumeration of the types in which argument values are captured.
+
+        e_INT64,    // signed 64-bit integer
+        e_UINT64,   // unsigned 64-bit integer
+        e_DOUBLE,   // 'double'
+        e_STRING,   // (copied) string
+        e_POINTER   // address
+    };
+
+  private:
+    // PRIVATE TYPES
+    struct Argument {
+        // This 'struct' describes one captured argument.  String arguments are
+        // stored (null-terminated) in 'd_strings', at the offset held in
+        // 'd_value.d_offset'.
+
+        int                          d_type;    // 'ArgumentType' value
+
+        union {
+            bsls::Types::Int64       d_int64;
+            bsls::Types::Uint64      d_uint64;
+            double                   d_double;
+            const void              *d_pointer;
+            bsl::size_t              d_offset;
+        }                            d_value;   // captured value
+    };
+
+    // PRIVATE CONSTANTS
+    static const bsl::size_t k_NULL_STRING;  // offset denoting a null string
+
+    // DATA
+    const char            *d_format_p;   // format specification (held, not
+                                         // owned)
+
+    bsl::vector<Argument>  d_arguments;  // captured arguments
+
+    bsl::string            d_strings;    // characters of string arguments
+
+    // PRIVATE MANIPULATORS
+    void appendInteger(bsls::Types::Int64 value);
+    void appendUnsigned(bsls::Types::Uint64 value);
+        // Append the specified integral 'value' to the sequence of captured
+        // arguments.
+
+    // PRIVATE ACCESSORS
+    const char *stringArgument(const Argument& argument) const;
+        // Return the address of the null-terminated string captured by the
+        // specified 'argument', or 0 if a null string was captured.  The
+        // behavior is undefined unless 'e_STRING == argument.d_type'.
+
+  public:
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(DeferredMessage,
+                                   bslma::UsesBslmaAllocator);
+
+    // CREATORS
+    explicit DeferredMessage(bslma::Allocator *basicAllocator = 0);
+        // Create a deferred message having no format specification and no
+        // arguments.  Optionally specify a 'basicAllocator' used to supply
+        // memory.  If 'basicAllocator' is 0, the currently installed default
+        // allocator is used.
+
+    DeferredMessage(const DeferredMessage&  original,
+                    bslma::Allocator       *basicAllocator = 0);
+        // Create a deferred message having the same format specification and
+        // arguments as the specified 'original' object.  Optionally specify a
+        // 'basicAllocator' used to supply memory.  If 'basicAllocator' is 0,
+        // the currently installed default allocator is used.
+
+    //! ~DeferredMessage() = default;
+        // Destroy this object.
+
+    // MANIPULATORS
+    DeferredMessage& operator=(const DeferredMessage& rhs);
+        // Assign to this object the format specification and arguments of the
+        // specified 'rhs' object, and return a reference providing modifiable
+        // access to this object.
+
+    void appendArgument(int                      value);
+    void appendArgument(unsigned int             value);
+    void appendArgument(long                     value);
+    void appendArgument(unsigned long            value);
+    void appendArgument(long long                value);
+    void appendArgument(unsigned long long       value);
+    void appendArgument(double                   value);
+    void appendArgument(long double              value);
+    void appendArgument(const char              *value);
+    void appendArgument(const bsl::string&       value);
+    void appendArgument(const bslstl::StringRef& value);
+    void appendArgument(const void              *value);
+        // Append the specified 'value' to the sequence of arguments captured
+        // by this object.  Integral values are captured as a signed or
+        // unsigned 64-bit integer, floating-point values as a 'double', and
+        // pointers (other than pointers to 'char') as an address.  The
+        // characters of string values, including those addressed by a
+        // 'const char *' 'value', are copied; a null 'const char *' 'value' is
+        // captured as a null string, and is formatted as "(null)".  Note that
+        // types that promote to 'int' (e.g., 'bool', 'char', 'short', and
+        // unscoped enumerations) and 'float' are also accepted.
+
+    void clear();
+        // Reset this object to have no format specification and no arguments.
+        // Note that the memory used to capture arguments is retained for
+        // subsequent use.
+
+    void setFormat(const char *format);
+        // Set the format specification of this object to the specified
+        // 'printf'-style 'format'.  The behavior is undefined unless 'format'
+        // remains valid until the last time this object is formatted (e.g.,
+        // 'format' is a string literal).
+
+    // ACCESSORS
+    ArgumentType argumentType(int index) const;
+        // Return the type in which the argument at the specified 'index' was
+        // captured.  The behavior is undefined unless
+        // '0 <= index < numArguments()'.
+
+    const char *format() const;
+        // Return the address of the format specification of this object, or 0
+        // if no format specification has been set.
+
+    int formatMessage(bsl::streambuf *buffer) const;
+        // Write to the specified 'buffer' the result of formatting the
+        // arguments captured by this object according to its format
+        // specification (see {Supported Conversions}).  Return 0 if each
+        // conversion specification consumed exactly one argument (or two or
+        // three, if '*' was used for the width or precision) and no arguments
+        // were left over, and a non-zero value otherwise.  Note that a
+        // best-effort message is written to 'buffer' in either case, and that
+        // nothing is written if no format specification has been set.
+
+    bool isSet() const;
+        // Return 'true' if a format specification has been set for this
+        // object, and 'false' otherwise.
+
+    int numArguments() const;
+        // Return the number of arguments captured by this object.
+
+                                  // Aspects
+
+    bslma::Allocator *allocator() const;
+        // Return the allocator used by this object to supply memory.
+};
+
+// ============================================================================
+//                              INLINE DEFINITIONS
+// ============================================================================
+
+                           // ---------------------
+                           // class DeferredMessage
+                           // ---------------------
+
+// PRIVATE MANIPULATORS
+inline
+void DeferredMessage::appendInteger(bsls::Types::Int64 value)
+{
+    d_arguments.resize(d_arguments.size() + 1);
+    Argument& argument       = d_arguments.back();
+    argument.d_type          = e_INT64;
+    argument.d_value.d_int64 = value;
+}
+
+inline
+void DeferredMessage::appendUnsigned(bsls::Types::Uint64 value)
+{
+    d_arguments.resize(d_arguments.size() + 1);
+    Argument& argument        = d_arguments.back();
+    argument.d_type           = e_UINT64;
+    argument.d_value.d_uint64 = value;
+}
+
+// CREATORS
+inline
+DeferredMessage::DeferredMessage(bslma::Allocator *basicAllocator)
+: d_format_p(0)
+, d_arguments(basicAllocator)
+, d_strings(basicAllocator)
+{
+}
+
+inline
+DeferredMessage::DeferredMessage(const DeferredMessage&  original,
+                                 bslma::Allocator       *basicAllocator)
+: d_format_p(original.d_format_p)
+, d_arguments(original.d_arguments, basicAllocator)
+, d_strings(original.d_strings, basicAllocator)
+{
+}
+
+// MANIPULATORS
+inline
+DeferredMessage& DeferredMessage::operator=(const DeferredMessage& rhs)
+{
+    d_format_p  = rhs.d_format_p;
+    d_arguments = rhs.d_arguments;
+    d_strings   = rhs.d_strings;
+    return *this;
+}
+
+inline
+void DeferredMessage::appendArgument(int value)
+{
+    appendInteger(value);
+}
+
+inline
+void DeferredMessage::appendArgument(unsigned int value)
+{
+    appendUnsigned(value);
+}
+
+inline
+void DeferredMessage::appendArgument(long value)
+{
+    appendInteger(value);
+}
+
+inline
+void DeferredMessage::appendArgument(unsigned long value)
+{
+    appendUnsigned(value);
+}
+
+inline
+void DeferredMessage::appendArgument(long long value)
+{
+    appendInteger(value);
+}
+
+inline
+void DeferredMessage::appendArgument(unsigned long long value)
+{
+    appendUnsigned(value);
+}
+
+inline
+void DeferredMessage::appendArgument(double value)
+{
+    d_arguments.resize(d_arguments.size() + 1);
+    Argument& argument        = d_arguments.back();
+    argument.d_type           = e_DOUBLE;
+    argument.d_value.d_double = value;
+}
+
+inline
+void DeferredMessage::appendArgument(long double value)
+{
+    appendArgument(static_cast<double>(value));
+}
+
+inline
+void DeferredMessage::appendArgument(const bsl::string& value)
+{
+    appendArgument(bslstl::StringRef(value));
+}
+
+inline
+void DeferredMessage::appendArgument(const void *value)
+{
+    d_arguments.resize(d_arguments.size() + 1);
+    Argument& argument         = d_arguments.back();
+    argument.d_type            = e_POINTER;
+    argument.d_value.d_pointer = value;
+}
+
+inline
+void DeferredMessage::clear()
+{
+    d_format_p = 0;
+    d_arguments.clear();
+    d_strings.clear();
+}
+
+inline
+void DeferredMessage::setFormat(const char *format)
+{
+    BSLS_ASSERT_SAFE(format);
+
+    d_format_p = format;
+}
+
+// ACCESSORS
+inline
+DeferredMessage::ArgumentType DeferredMessage::argumentType(int index) const
+{
+    BSLS_ASSERT_SAFE(0 <= index);
+    BSLS_ASSERT_SAFE(index < numArguments());
+
+    return static_cast<ArgumentType>(d_arguments[index].d_type);
+}
+
+inline
+const char *DeferredMessage::format() const
+{
+    return d_format_p;
+}
+
+inline
+bool DeferredMessage::isSet() const
+{
+    return 0 != d_format_p;
+}
+
+inline
+int DeferredMessage::numArguments() const
+{
+    return static_cast<int>(d_arguments.size());
+}
+
+                                  // Aspects
+
+inline
+bslma::Allocator *DeferredMessage::allocator() const
+{
+    return d_arguments.get_allocator().mechanism();
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
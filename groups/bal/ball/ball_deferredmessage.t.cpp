@@ -0,0 +1,783 @@
+// ball_deferredmessage.t.cpp                                         -*-C++-*-
+#include <ball_deferredmessage.h>
+
+#include <bdlsb_memoutstreambuf.h>
+
+#include <bslim_testutil.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+
+#include <bslmf_assert.h>
+
+#include <bsls_assert.h>
+#include <bsls_asserttest.h>
+#include <bsls_review.h>
+#include <bsls_types.h>
+
+#include <bsl_cstdlib.h>
+#include <bsl_cstring.h>
+#include <bsl_iostream.h>
+#include <bsl_string.h>
+
+#include <stdio.h>  // *NOT* <bsl_cstdio.h>, which does not declare 'snprintf'
+
+using namespace BloombergLP;
+using namespace bsl;
+
+// ============================================================================
+//                                   TEST PLAN
+// ----------------------------------------------------------------------------
+//                                   Overview
+//                                   --------
+// The component under test holds a 'printf'-style format specification and a
+// sequence of captured argument values, and formats them on demand.  We first
+// verify that arguments of each supported type are captured in the expected
+// representation, then verify, in a table-driven test, that 'formatMessage'
+// produces the same text as 'snprintf' for well-formed input, and finally
+// that mismatched input is handled as documented.
+// ----------------------------------------------------------------------------
+// CREATORS
+// [ 2] DeferredMessage(Allocator *ba = 0);
+// [ 4] DeferredMessage(const DeferredMessage& original, Allocator *ba = 0);
+//
+// MANIPULATORS
+// [ 4] DeferredMessage& operator=(const DeferredMessage& rhs);
+// [ 2] void appendArgument(<each supported type> value);
+// [ 4] void clear();
+// [ 2] void setFormat(const char *format);
+//
+// ACCESSORS
+// [ 2] ArgumentType argumentType(int index) const;
+// [ 2] const char *format() const;
+// [ 3] int formatMessage(bsl::streambuf *buffer) const;
+// [ 2] bool isSet() const;
+// [ 2] int numArguments() const;
+// [ 2] bslma::Allocator *allocator() const;
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 5] USAGE EXAMPLE
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLIM_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLIM_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLIM_TESTUTIL_LOOP6_ASSERT
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_SAFE_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_PASS(EXPR)
+#define ASSERT_SAFE_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_FAIL(EXPR)
+#define ASSERT_PASS(EXPR)      BSLS_ASSERTTEST_ASSERT_PASS(EXPR)
+#define ASSERT_FAIL(EXPR)      BSLS_ASSERTTEST_ASSERT_FAIL(EXPR)
+#define ASSERT_OPT_PASS(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_PASS(EXPR)
+#define ASSERT_OPT_FAIL(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_FAIL(EXPR)
+
+//=============================================================================
+//                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+//-----------------------------------------------------------------------------
+
+typedef ball::DeferredMessage Obj;
+
+typedef bsls::Types::Int64    Int64;
+typedef bsls::Types::Uint64   Uint64;
+
+// ============================================================================
+//                                 TYPE TRAITS
+// ----------------------------------------------------------------------------
+
+BSLMF_ASSERT(true == bslma::UsesBslmaAllocator<Obj>::value);
+
+//=============================================================================
+//                      HELPER FUNCTIONS FOR TESTING
+//-----------------------------------------------------------------------------
+
+static bsl::string formatted(const Obj& object, int *status = 0)
+    // Return the result of formatting the specified 'object', and load the
+    // status returned by 'formatMessage' into the optionally specified
+    // 'status'.
+{
+    bdlsb::MemOutStreamBuf buffer;
+    const int              rc = object.formatMessage(&buffer);
+    if (status) {
+        *status = rc;
+    }
+    return bsl::string(buffer.data(), buffer.length());
+}
+
+//=============================================================================
+//                              MAIN PROGRAM
+//-----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    const int                 test = argc > 1 ? atoi(argv[1]) : 0;
+    const bool             verbose = argc > 2;
+    const bool         veryVerbose = argc > 3;
+    const bool     veryVeryVerbose = argc > 4;
+    const bool veryVeryVeryVerbose = argc > 5;
+
+    (void)veryVeryVerbose;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    // CONCERN: 'BSLS_REVIEW' failures should lead to test failures.
+    bsls::ReviewFailureHandlerGuard reviewGuard(&bsls::Review::failByAbort);
+
+    // CONCERN: In no case does memory come from the global allocator.
+
+    bslma::TestAllocator globalAllocator("global", veryVeryVeryVerbose);
+    bslma::Default::setGlobalAllocator(&globalAllocator);
+
+    // CONCERN: In no case does memory come from the default allocator.
+
+    bslma::TestAllocator defaultAllocator("default", veryVeryVeryVerbose);
+    bslma::DefaultAllocatorGuard defaultAllocatorGuard(&defaultAllocator);
+
+    switch (test) { case 0:
+      case 5: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "USAGE EXAMPLE" << endl
+                          << "=============" << endl;
+
+        // This test intentionally uses the default allocator.
+
+        bslma::TestAllocator testAllocator("usage", veryVeryVeryVerbose);
+        bslma::DefaultAllocatorGuard guard(&testAllocator);
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Capturing and Later Formatting a Message
+///- - - - - - - - - - - - - - - - - - - - - - - - - -
+// Users of the 'ball' logging subsystem are not expected to use
+// 'ball::DeferredMessage' directly; rather, the 'BALL_LOGVA_FAST' family of
+// macros in 'ball_log' capture their arguments into the
+// 'ball::DeferredMessage' held by a log record.  In this example we show what
+// happens underneath those macros.
+//
+// First, we create a 'ball::DeferredMessage' and capture a format
+// specification and three arguments.  Note that the string argument is copied
+// into 'message', so 'symbol' can safely go out of scope:
+//..
+    ball::DeferredMessage message;
+    {
+        bsl::string symbol("IBM");
+
+        message.setFormat("%d shares of %s sold at %.2f");
+        message.appendArgument(400);
+        message.appendArgument(symbol);
+        message.appendArgument(141.5);
+    }
+    ASSERT(3 == message.numArguments());
+//..
+// Then, possibly much later and on another thread, we format the message into
+// a stream buffer:
+//..
+    bdlsb::MemOutStreamBuf buffer;
+    int rc = message.formatMessage(&buffer);
+    ASSERT(0 == rc);
+
+    ASSERT(bsl::string(buffer.data(), buffer.length()) ==
+                                          "400 shares of IBM sold at 141.50");
+//..
+
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // COPY CONSTRUCTOR, ASSIGNMENT, AND 'clear'
+        //
+        // Concerns:
+        //: 1 A copy (constructed or assigned) formats to the same text as the
+        //:   original, and does not depend on the original's lifetime.
+        //:
+        //: 2 The copy constructor uses the supplied allocator.
+        //:
+        //: 3 'clear' removes the format and all arguments, and the object is
+        //:   reusable afterwards.
+        //
+        // Plan:
+        //: 1 Create an object holding string and numeric arguments, copy it
+        //:   into objects that outlive it, and compare the formatted text.
+        //:   (C-1..2)
+        //:
+        //: 2 Call 'clear', verify the accessors, then capture a new message.
+        //:   (C-3)
+        //
+        // Testing:
+        //   DeferredMessage(const DeferredMessage& original, Allocator *ba);
+        //   DeferredMessage& operator=(const DeferredMessage& rhs);
+        //   void clear();
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "COPY CONSTRUCTOR, ASSIGNMENT, AND 'clear'"
+                          << endl
+                          << "========================================="
+                          << endl;
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+        Obj mY(&oa);  const Obj& Y = mY;
+        Obj mZ(&oa);  const Obj& Z = mZ;
+        {
+            Obj mX(&oa);  const Obj& X = mX;
+
+            mX.setFormat("%s=%d (%s)");
+            mX.appendArgument("alpha");
+            mX.appendArgument(1);
+            mX.appendArgument(bsl::string("a string that is long enough to "
+                                          "require allocated storage"));
+
+            Obj mC(X, &oa);  const Obj& C = mC;
+            ASSERT(&oa == C.allocator());
+            ASSERT(formatted(X) == formatted(C));
+
+            mY = X;
+            mZ = C;
+        }
+
+        const bsl::string EXP("alpha=1 (a string that is long enough to "
+                              "require allocated storage)");
+        ASSERTV(formatted(Y), EXP == formatted(Y));
+        ASSERTV(formatted(Z), EXP == formatted(Z));
+
+        mY.clear();
+        ASSERT(false == Y.isSet());
+        ASSERT(0     == Y.format());
+        ASSERT(0     == Y.numArguments());
+        ASSERT(""    == formatted(Y));
+
+        mY.setFormat("%s");
+        mY.appendArgument("again");
+        ASSERT("again" == formatted(Y));
+
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // 'formatMessage'
+        //
+        // Concerns:
+        //: 1 For well-formed input, the output is identical to that of
+        //:   'snprintf', including flags, width, precision, '*' width and
+        //:   precision, length modifiers, and "%%".
+        //:
+        //: 2 Arguments are converted to the type implied by the conversion
+        //:   character.
+        //:
+        //: 3 Missing arguments and unsupported conversions are written
+        //:   verbatim, and a non-zero status is returned; surplus arguments
+        //:   are ignored, and a non-zero status is returned.
+        //:
+        //: 4 A null string is formatted as "(null)".
+        //:
+        //: 5 Output longer than the internal formatting buffer is written in
+        //:   full.
+        //:
+        //: 6 Nothing is written if no format has been set.
+        //
+        // Plan:
+        //: 1 For a table of format specifications and values, compare the
+        //:   output with that of 'snprintf'.  (C-1)
+        //:
+        //: 2 Format mismatched and degenerate input, and verify the output
+        //:   and status against expected values.  (C-2..6)
+        //
+        // Testing:
+        //   int formatMessage(bsl::streambuf *buffer) const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "'formatMessage'" << endl
+                          << "===============" << endl;
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+        char expected[512];
+
+        if (verbose) cout << "\nCompare integral output with 'snprintf'."
+                          << endl;
+        {
+            static const struct {
+                int         d_line;
+                const char *d_format;
+                Int64       d_value;
+            } DATA[] = {
+                //LINE  FORMAT           VALUE
+                //----  ---------------  --------------------------
+                { L_,   "%d",                                    0 },
+                { L_,   "%d",                                  -17 },
+                { L_,   "%i",                               123456 },
+                { L_,   "<%5d>",                                42 },
+                { L_,   "<%-5d>",                               42 },
+                { L_,   "<%05d>",                              -42 },
+                { L_,   "<%+d>",                                42 },
+                { L_,   "<% d>",                                42 },
+                { L_,   "%ld",                      -1234567890123LL },
+                { L_,   "%lld",          -9223372036854775807LL - 1 },
+                { L_,   "%hd",                                   7 },
+                { L_,   "%zd",                                   7 },
+                { L_,   "%.3d",                                  7 },
+            };
+            const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+            for (int ti = 0; ti < NUM_DATA; ++ti) {
+                const int    LINE   = DATA[ti].d_line;
+                const char  *FORMAT = DATA[ti].d_format;
+                const Int64  VALUE  = DATA[ti].d_value;
+
+                // Build the expected value with the length modifier that
+                // matches the type of 'VALUE'.
+
+                bsl::string spec(FORMAT);
+                const bsl::size_t conv = spec.find_last_of("di");
+                const bsl::size_t mods = spec.find_first_of("hlz");
+                spec.replace(bsl::string::npos == mods ? conv : mods,
+                             bsl::string::npos == mods ? 0 : conv - mods,
+                             "ll");
+                snprintf(expected, sizeof expected, spec.c_str(), VALUE);
+
+                Obj mX(&oa);  const Obj& X = mX;
+                mX.setFormat(FORMAT);
+                mX.appendArgument(VALUE);
+
+                int status = -1;
+                ASSERTV(LINE, formatted(X), expected,
+                        expected == formatted(X, &status));
+                ASSERTV(LINE, status, 0 == status);
+            }
+        }
+
+        if (verbose) cout << "\nCompare other output with 'snprintf'."
+                          << endl;
+        {
+            Obj mX(&oa);  const Obj& X = mX;
+
+            mX.setFormat("%u|%#x|%X|%o|%c|%%|%f|%.2e|%G|%s|%-6s|%.2s|");
+            mX.appendArgument(4000000000u);
+            mX.appendArgument(255u);
+            mX.appendArgument(0xABCDEFul);
+            mX.appendArgument(8);
+            mX.appendArgument('q');
+            mX.appendArgument(3.25);
+            mX.appendArgument(12345.678f);
+            mX.appendArgument(0.000001L);
+            mX.appendArgument("abc");
+            mX.appendArgument(bsl::string("xy"));
+            mX.appendArgument(bslstl::StringRef("truncated"));
+
+            snprintf(expected,
+                     sizeof expected,
+                     "%u|%#x|%X|%o|%c|%%|%f|%.2e|%G|%s|%-6s|%.2s|",
+                     4000000000u,
+                     255u,
+                     0xABCDEFu,
+                     8,
+                     'q',
+                     3.25,
+                     static_cast<double>(12345.678f),
+                     0.000001,
+                     "abc",
+                     "xy",
+                     "truncated");
+
+            int status = -1;
+            ASSERTV(formatted(X), expected,
+                    expected == formatted(X, &status));
+            ASSERTV(status, 0 == status);
+        }
+
+        if (verbose) cout << "\n'*' width and precision." << endl;
+        {
+            Obj mX(&oa);  const Obj& X = mX;
+
+            mX.setFormat("<%*d><%-*.*f>");
+            mX.appendArgument(6);
+            mX.appendArgument(-12);
+            mX.appendArgument(9);
+            mX.appendArgument(3);
+            mX.appendArgument(2.5);
+
+            snprintf(expected,
+                     sizeof expected,
+                     "<%*d><%-*.*f>",
+                     6,
+                     -12,
+                     9,
+                     3,
+                     2.5);
+
+            int status = -1;
+            ASSERTV(formatted(X), expected,
+                    expected == formatted(X, &status));
+            ASSERTV(status, 0 == status);
+        }
+
+        if (verbose) cout << "\nPointers." << endl;
+        {
+            int value = 0;
+
+            Obj mX(&oa);  const Obj& X = mX;
+            mX.setFormat("%p");
+            mX.appendArgument(&value);
+
+            snprintf(expected,
+                     sizeof expected,
+                     "%p",
+                     static_cast<const void *>(&value));
+
+            ASSERTV(formatted(X), expected, expected == formatted(X));
+            ASSERT(Obj::e_POINTER == X.argumentType(0));
+        }
+
+        if (verbose) cout << "\nConversions between captured types." << endl;
+        {
+            Obj mX(&oa);  const Obj& X = mX;
+            mX.setFormat("%d %f %s %s %u");
+            mX.appendArgument(2.75);
+            mX.appendArgument(3);
+            mX.appendArgument(-4);
+            mX.appendArgument(1.5);
+            mX.appendArgument(-1);
+
+            int status = -1;
+            const bsl::string RESULT = formatted(X, &status);
+            ASSERTV(RESULT,
+                    "2 3.000000 -4 1.5 18446744073709551615" == RESULT);
+            ASSERTV(status, 0 == status);
+        }
+
+        if (verbose) cout << "\nNull string." << endl;
+        {
+            Obj mX(&oa);  const Obj& X = mX;
+            mX.setFormat("[%s]");
+            mX.appendArgument(static_cast<const char *>(0));
+
+            ASSERT("[(null)]" == formatted(X));
+        }
+
+        if (verbose) cout << "\nMismatched arguments." << endl;
+        {
+            int status;
+
+            Obj mX(&oa);  const Obj& X = mX;
+            mX.setFormat("a=%d b=%s");
+            mX.appendArgument(1);
+
+            status = 0;
+            ASSERTV(formatted(X), "a=1 b=%s" == formatted(X, &status));
+            ASSERT(0 != status);
+
+            mX.clear();
+            mX.setFormat("a=%d");
+            mX.appendArgument(1);
+            mX.appendArgument(2);
+
+            status = 0;
+            ASSERTV(formatted(X), "a=1" == formatted(X, &status));
+            ASSERT(0 != status);
+
+            mX.clear();
+            mX.setFormat("a=%n%d");
+            mX.appendArgument(1);
+
+            status = 0;
+            ASSERTV(formatted(X), "a=%n1" == formatted(X, &status));
+            ASSERT(0 != status);
+
+            mX.clear();
+            mX.setFormat("trailing %");
+
+            status = 0;
+            ASSERTV(formatted(X), "trailing %" == formatted(X, &status));
+            ASSERT(0 != status);
+        }
+
+        if (verbose) cout << "\nLong output." << endl;
+        {
+            const bsl::string LONG(1000, 'z');
+
+            Obj mX(&oa);  const Obj& X = mX;
+            mX.setFormat("<%s><%300d>");
+            mX.appendArgument(LONG);
+            mX.appendArgument(5);
+
+            const bsl::string RESULT = formatted(X);
+            ASSERTV(RESULT.length(), 1304 == RESULT.length());
+            ASSERT('<' + LONG + '>' == RESULT.substr(0, 1002));
+            ASSERT("5>" == RESULT.substr(RESULT.length() - 2));
+        }
+
+        if (verbose) cout << "\nNo format." << endl;
+        {
+            Obj mX(&oa);  const Obj& X = mX;
+            mX.appendArgument(1);
+
+            int status = -1;
+            ASSERT("" == formatted(X, &status));
+            ASSERT(0  == status);
+        }
+
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // PRIMARY MANIPULATORS AND BASIC ACCESSORS
+        //
+        // Concerns:
+        //: 1 A default-constructed object has no format and no arguments, and
+        //:   uses the supplied (or default) allocator.
+        //:
+        //: 2 'setFormat' holds, and does not copy, the format specification.
+        //:
+        //: 3 Each 'appendArgument' overload captures the value in the
+        //:   documented representation, including types that promote to
+        //:   'int' and 'float'.
+        //:
+        //: 4 String arguments are copied, and are not affected by later
+        //:   modification of the source.
+        //:
+        //: 5 Precondition violations are detected in appropriate build modes.
+        //
+        // Plan:
+        //: 1 Create objects with and without an allocator, and verify the
+        //:   accessors.  (C-1..2)
+        //:
+        //: 2 Append one argument of each type and verify 'argumentType'.
+        //:   (C-3)
+        //:
+        //: 3 Modify a source string after capturing it and verify the
+        //:   formatted text.  (C-4)
+        //:
+        //: 4 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for invalid values.  (C-5)
+        //
+        // Testing:
+        //   DeferredMessage(Allocator *ba = 0);
+        //   void appendArgument(<each supported type> value);
+        //   void setFormat(const char *format);
+        //   ArgumentType argumentType(int index) const;
+        //   const char *format() const;
+        //   bool isSet() const;
+        //   int numArguments() const;
+        //   bslma::Allocator *allocator() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "PRIMARY MANIPULATORS AND BASIC ACCESSORS"
+                          << endl
+                          << "========================================"
+                          << endl;
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+        {
+            Obj mD;  const Obj& D = mD;
+            ASSERT(&defaultAllocator == D.allocator());
+        }
+
+        Obj mX(&oa);  const Obj& X = mX;
+
+        ASSERT(&oa   == X.allocator());
+        ASSERT(false == X.isSet());
+        ASSERT(0     == X.format());
+        ASSERT(0     == X.numArguments());
+
+        const char *FORMAT = "%d";
+        mX.setFormat(FORMAT);
+        ASSERT(true   == X.isSet());
+        ASSERT(FORMAT == X.format());
+
+        enum Enum { e_VALUE = 5 };
+        int         i = 0;
+        bsl::string s("abc");
+
+        mX.appendArgument(true);
+        mX.appendArgument('c');
+        mX.appendArgument(static_cast<short>(-2));
+        mX.appendArgument(e_VALUE);
+        mX.appendArgument(-3);
+        mX.appendArgument(3u);
+        mX.appendArgument(-4l);
+        mX.appendArgument(4ul);
+        mX.appendArgument(static_cast<Int64>(-5));
+        mX.appendArgument(static_cast<Uint64>(5));
+        mX.appendArgument(1.5f);
+        mX.appendArgument(2.5);
+        mX.appendArgument(3.5L);
+        mX.appendArgument("literal");
+        mX.appendArgument(s);
+        mX.appendArgument(bslstl::StringRef(s));
+        mX.appendArgument(&i);
+
+        static const Obj::ArgumentType EXP[] = {
+            Obj::e_INT64,  Obj::e_INT64,  Obj::e_INT64,   Obj::e_INT64,
+            Obj::e_INT64,  Obj::e_UINT64, Obj::e_INT64,   Obj::e_UINT64,
+            Obj::e_INT64,  Obj::e_UINT64, Obj::e_DOUBLE,  Obj::e_DOUBLE,
+            Obj::e_DOUBLE, Obj::e_STRING, Obj::e_STRING,  Obj::e_STRING,
+            Obj::e_POINTER
+        };
+        const int NUM_EXP = sizeof EXP / sizeof *EXP;
+
+        ASSERTV(X.numArguments(), NUM_EXP == X.numArguments());
+        for (int ti = 0; ti < NUM_EXP; ++ti) {
+            ASSERTV(ti, X.argumentType(ti), EXP[ti] == X.argumentType(ti));
+        }
+
+        if (verbose) cout << "\nString arguments are copied." << endl;
+        {
+            Obj mY(&oa);  const Obj& Y = mY;
+
+            char source[] = "before";
+            mY.setFormat("%s:%s");
+            mY.appendArgument(source);
+            mY.appendArgument(bslstl::StringRef(source, 3));
+            bsl::strcpy(source, "after!");
+
+            ASSERTV(formatted(Y), "before:bef" == formatted(Y));
+        }
+
+        if (verbose) cout << "\nNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            Obj mY(&oa);  const Obj& Y = mY;
+            mY.appendArgument(1);
+
+            ASSERT_SAFE_FAIL(mY.setFormat(0));
+            ASSERT_SAFE_PASS(mY.setFormat("%d"));
+
+            ASSERT_SAFE_FAIL(Y.argumentType(-1));
+            ASSERT_SAFE_PASS(Y.argumentType( 0));
+            ASSERT_SAFE_FAIL(Y.argumentType( 1));
+
+            bdlsb::MemOutStreamBuf buffer(&oa);
+            ASSERT_FAIL(Y.formatMessage(0));
+            ASSERT_PASS(Y.formatMessage(&buffer));
+        }
+
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Capture a format and a few arguments, and format them.
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+        Obj mX(&oa);  const Obj& X = mX;
+
+        mX.setFormat("%s %d %.1f");
+        mX.appendArgument("one");
+        mX.appendArgument(2);
+        mX.appendArgument(3.0);
+
+        if (veryVerbose) { P(formatted(X)); }
+
+        ASSERT("one 2 3.0" == formatted(X));
+
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    // CONCERN: In no case does memory come from the global allocator.
+
+    LOOP_ASSERT(globalAllocator.numBlocksTotal(),
+                0 == globalAllocator.numBlocksTotal());
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -16,6 +16,8 @@ BSLS_IDENT_RCSID(ball_fileobserver2_cpp,"$Id$ $CSID$")
 #include <ball_recordstringformatter.h>       // for testing only
 #include <ball_streamobserver.h>              // for testing only
 
+#include <bdlb_numericformatutil.h>
+
 #include <bdlf_memfn.h>
 
 #include <bdls_filesystemutil.h>
@@ -392,16 +394,34 @@ void FileObserver2::logRecordDefault(bsl::ostream& stream,
 
     ptr += length;
 
-    snprintf(ptr,
-             sizeof(buffer) - length - 1,
-             " %d:%llu %s %s:%d ",
-             fixedFields.processID(),
-             fixedFields.threadID(),
-             Severity::toAscii((Severity::Level)fixedFields.severity()),
-             fixedFields.fileName(),
-             fixedFields.lineNumber());
+    // Format the integral fields directly, rather than through 'snprintf',
+    // which parses its format string on every call.  Note that 'buffer' has
+    // ample room for the timestamp and the two numbers.
+
+    char *const end = buffer + sizeof buffer;
+
+    *ptr++ = ' ';
+    ptr    = bdlb::NumericFormatUtil::toChars(ptr,
+                                              end,
+                                              fixedFields.processID());
+    *ptr++ = ':';
+    ptr    = bdlb::NumericFormatUtil::toChars(ptr,
+                                              end,
+                                              fixedFields.threadID());
+    *ptr++ = ' ';
+
+    stream.write(buffer, ptr - buffer);
+    stream << Severity::toAscii((Severity::Level)fixedFields.severity())
+           << ' '
+           << fixedFields.fileName()
+           << ':';
+
+    ptr = bdlb::NumericFormatUtil::toChars(buffer,
+                                           end,
+                                           fixedFields.lineNumber());
+    stream.write(buffer, ptr - buffer);
+    stream << ' ';
 
-    stream << buffer;
     stream << fixedFields.category();
     stream << ' ';
     bslstl::StringRef message = fixedFields.messageRef();
@@ -49,12 +49,15 @@ void FixedSizeRecordBuffer::popFront()
 
 int FixedSizeRecordBuffer::pushBack(const bsl::shared_ptr<Record>& handle)
 {
-    bslmt::LockGuard<bslmt::RecursiveMutex> guard(&d_mutex);
+    // The size of the record is computed before acquiring the lock, to keep
+    // the critical section (which serializes all logging threads) short.
 
-    int size = handle->numAllocatedBytes() +
+    const int size = handle->numAllocatedBytes() +
            static_cast<int>(
                bsls::AlignmentUtil::roundUpToMaximalAlignment(sizeof(Record)));
 
+    bslmt::LockGuard<bslmt::RecursiveMutex> guard(&d_mutex);
+
     if (size + static_cast<int>(d_allocator.numBytesTotal()) >
                                                               d_maxTotalSize) {
         // Impossible to accommodate this record.
@@ -89,11 +92,15 @@ int FixedSizeRecordBuffer::pushBack(const bsl::shared_ptr<Record>& handle)
 
 int FixedSizeRecordBuffer::pushFront(const bsl::shared_ptr<Record>& handle)
 {
-    bslmt::LockGuard<bslmt::RecursiveMutex> guard(&d_mutex);
+    // The size of the record is computed before acquiring the lock, to keep
+    // the critical section (which serializes all logging threads) short.
 
-    int size = handle->numAllocatedBytes() +
+    const int size = handle->numAllocatedBytes() +
            static_cast<int>(
                bsls::AlignmentUtil::roundUpToMaximalAlignment(sizeof(Record)));
+
+    bslmt::LockGuard<bslmt::RecursiveMutex> guard(&d_mutex);
+
     if (size + static_cast<int>(d_allocator.numBytesTotal()) >
                                                               d_maxTotalSize) {
         // Impossible to accommodate this record.
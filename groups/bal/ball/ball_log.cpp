@@ -258,6 +258,33 @@ Log_Formatter::~Log_Formatter()
     Log::logMessage(d_category_p, d_severity, d_record_p);
 }
 
+                     // ---------------------------
+                     // class Log_DeferredFormatter
+                     // ---------------------------
+
+// CREATORS
+Log_DeferredFormatter::Log_DeferredFormatter(const Category *category,
+                                             const char     *fileName,
+                                             int             lineNumber,
+                                             int             severity)
+: d_category_p(category)
+, d_record_p(Log::getRecord(category, fileName, lineNumber))
+, d_severity(severity)
+{
+}
+
+Log_DeferredFormatter::~Log_DeferredFormatter()
+{
+    if (!d_category_p) {
+        // Without a logger manager singleton the record is written directly
+        // to 'stderr' through its modifiable fixed fields, which does not
+        // format a deferred message.
+
+        d_record_p->formatDeferredMessage();
+    }
+    Log::logMessage(d_category_p, d_severity, d_record_p);
+}
+
 }  // close package namespace
 }  // close enterprise namespace
 
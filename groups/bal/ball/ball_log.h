@@ -283,6 +283,48 @@ BSLS_IDENT("$Id: $")
 //      compatible with the format specification in 'MSG'.  Note that each use
 //      of this macro must be terminated by a ';'.
 //..
+// A final set of 'printf'-style macros *defers* formatting: rather than
+// formatting the message on the calling thread, they capture the address of
+// the format specification and copies of the argument values in the log
+// record (see 'ball::DeferredMessage'), and the message is formatted only
+// when the record is first read by an observer.  When the record is published
+// by a 'ball::AsyncFileObserver', that happens on the observer's publication
+// thread, taking the cost of building the message string off the (typically
+// latency-sensitive) logging thread.  Category thresholds and rules are
+// evaluated exactly as for the other logging macros:
+//..
+//  BALL_LOGVA_FAST_TRACE(MSG, ...);
+//  BALL_LOGVA_FAST_DEBUG(MSG, ...);
+//  BALL_LOGVA_FAST_INFO( MSG, ...);
+//  BALL_LOGVA_FAST_WARN( MSG, ...);
+//  BALL_LOGVA_FAST_ERROR(MSG, ...);
+//  BALL_LOGVA_FAST_FATAL(MSG, ...);
+//      Capture the specified '...' optional arguments, if any, for deferred
+//      formatting according to the 'printf'-style format specification in the
+//      specified 'MSG', and log the resulting record with the severity
+//      indicated by the name of the macro (e.g., 'BALL_LOGVA_FAST_INFO' logs
+//      with severity 'ball::Severity::e_INFO').  The behavior is undefined
+//      unless 'MSG' (assumed to be of type convertible to 'const char *')
+//      remains valid until the record is published (e.g., 'MSG' is a string
+//      literal).  Arguments of integral, floating-point, pointer, and string
+//      ('const char *', 'bsl::string', and 'bslstl::StringRef') types are
+//      supported; the characters of string arguments are copied.  Unlike
+//      'BALL_LOGVA_*', mismatches between the arguments and the format
+//      specification do not result in undefined behavior (see
+//      {'ball_deferredmessage'|Supported Conversions}).  Note that each use of
+//      these macros must be terminated by a ';'.
+//..
+// A closely-related deferred-formatting macro, 'BALL_LOGVA_FAST', requires
+// that the severity be explicitly supplied as an argument:
+//..
+//  BALL_LOGVA_FAST(SEVERITY, MSG, ...);
+//      Capture the specified '...' optional arguments, if any, for deferred
+//      formatting according to the 'printf'-style format specification in the
+//      specified 'MSG', and log the resulting record with the specified
+//      'SEVERITY'.  The behavior is undefined unless 'MSG' remains valid
+//      until the record is published.  Note that each use of this macro must
+//      be terminated by a ';'.
+//..
 //
 ///Macros for Logging Code Blocks
 /// - - - - - - - - - - - - - - -
@@ -593,6 +635,20 @@ BSLS_IDENT("$Id: $")
 //  <ts> <pid> <tid> INFO x.cpp 1294 EQUITY.NASD [6] 400 shares of SUNW sold
 //  at 5.650000 settlement date 17FEB2017
 //..
+// Where the cost of formatting matters, as on a latency-critical thread whose
+// records are published by a 'ball::AsyncFileObserver', the same message can
+// be logged with 'BALL_LOGVA_FAST_INFO'.  Only the argument values (and the
+// address of the format specification, which must therefore be a string
+// literal) are captured by the calling thread; the message is formatted when
+// the record is published.  Note that, unlike 'BALL_LOGVA_INFO', a
+// 'bsl::string' may be supplied directly as an argument for a '%s'
+// conversion:
+//..
+//  BALL_LOGVA_FAST_INFO("[7] %d shares of %s sold at %f settlement date %s",
+//                       lotSize, ticker, price, settleStr);
+//..
+// The above results in the same message as '[6]', except for its leading
+// "[7]".
 //
 ///Example 5: Dynamic Categories
 ///- - - - - - - - - - - - - - -
@@ -881,12 +937,15 @@ BSLS_IDENT("$Id: $")
 
 #include <ball_category.h>
 #include <ball_categorymanager.h>
+#include <ball_deferredmessage.h>
 #include <ball_loggermanager.h>
+#include <ball_record.h>
 #include <ball_severity.h>
 
 #include <bslma_managedptr.h>
 
 #include <bsls_annotation.h>
+#include <bsls_assert.h>
 #include <bsls_keyword.h>
 #include <bsls_performancehint.h>
 #include <bsls_platform.h>
@@ -1311,6 +1370,70 @@ do {                                                                          \
 #define BALL_LOGVA_FATAL(...)                                                 \
     BALL_LOGVA_CONST_IMP(BloombergLP::ball::Severity::e_FATAL, __VA_ARGS__)
 
+                 // ====================================
+                 // Implementation Details: Do *NOT* Use
+                 // ====================================
+
+// BALL_LOGVA_FAST_CONST_IMP requires its first argument to be a compile-time
+// constant, while all the others may be variables.  Note that the format
+// specification and arguments are captured by a chain of overloaded comma
+// operators (see 'ball::Log_DeferredFormat').
+
+#define BALL_LOGVA_FAST_CONST_IMP(SEVERITY, ...)                              \
+do {                                                                          \
+    if (const BloombergLP::ball::CategoryHolder *ball_log_cAtEgOrYhOlDeR =    \
+               BloombergLP::ball::Log::categoryHolderIfEnabled<(SEVERITY)>(   \
+                      ball_log_getCategoryHolder(BALL_LOG_CATEGORYHOLDER))) { \
+        BloombergLP::ball::Log_DeferredFormatter ball_log_fOrMaTtEr(          \
+                                       ball_log_cAtEgOrYhOlDeR->category(),   \
+                                       __FILE__,                              \
+                                       __LINE__,                              \
+                                       (SEVERITY));                           \
+        ball_log_fOrMaTtEr.capture(), __VA_ARGS__;                            \
+    }                                                                         \
+} while(0)
+
+                    // ==============================
+                    // Deferred 'printf'-style macros
+                    // ==============================
+
+// BALL_LOGVA_FAST allows all its arguments to be calculated at run-time, at a
+// cost in performance.
+
+#define BALL_LOGVA_FAST(SEVERITY, ...)                                        \
+do {                                                                          \
+    const BloombergLP::ball::CategoryHolder *ball_log_cAtEgOrYhOlDeR =        \
+                         ball_log_getCategoryHolder(BALL_LOG_CATEGORYHOLDER); \
+    if (ball_log_cAtEgOrYhOlDeR->threshold() >= (SEVERITY) &&                 \
+           BloombergLP::ball::Log::isCategoryEnabled(ball_log_cAtEgOrYhOlDeR, \
+                                                     (SEVERITY))) {           \
+        BloombergLP::ball::Log_DeferredFormatter ball_log_fOrMaTtEr(          \
+                                       ball_log_cAtEgOrYhOlDeR->category(),   \
+                                       __FILE__,                              \
+                                       __LINE__,                              \
+                                       (SEVERITY));                           \
+        ball_log_fOrMaTtEr.capture(), __VA_ARGS__;                            \
+    }                                                                         \
+} while(0)
+
+#define BALL_LOGVA_FAST_TRACE(...)                                            \
+  BALL_LOGVA_FAST_CONST_IMP(BloombergLP::ball::Severity::e_TRACE, __VA_ARGS__)
+
+#define BALL_LOGVA_FAST_DEBUG(...)                                            \
+  BALL_LOGVA_FAST_CONST_IMP(BloombergLP::ball::Severity::e_DEBUG, __VA_ARGS__)
+
+#define BALL_LOGVA_FAST_INFO( ...)                                            \
+  BALL_LOGVA_FAST_CONST_IMP(BloombergLP::ball::Severity::e_INFO,  __VA_ARGS__)
+
+#define BALL_LOGVA_FAST_WARN( ...)                                            \
+  BALL_LOGVA_FAST_CONST_IMP(BloombergLP::ball::Severity::e_WARN,  __VA_ARGS__)
+
+#define BALL_LOGVA_FAST_ERROR(...)                                            \
+  BALL_LOGVA_FAST_CONST_IMP(BloombergLP::ball::Severity::e_ERROR, __VA_ARGS__)
+
+#define BALL_LOGVA_FAST_FATAL(...)                                            \
+  BALL_LOGVA_FAST_CONST_IMP(BloombergLP::ball::Severity::e_FATAL, __VA_ARGS__)
+
                        // ==============
                        // Utility Macros
                        // ==============
@@ -1352,8 +1475,6 @@ const BloombergLP::ball::CategoryHolder* ball_log_getCategoryHolder(
 
 // BDE_VERIFY pragma: pop
 
-class Record;
-
                          // ==========
                          // struct Log
                          // ==========
@@ -1701,6 +1822,141 @@ class Log_Formatter {
         // Return the severity held by this logging formatter.
 };
 
+                     // ===========================
+                     // class Log_DeferredArguments
+                     // ===========================
+
+class Log_DeferredArguments {
+    // This class provides an overloaded comma operator that appends its
+    // right-hand operand to the arguments of a held deferred message.
+    //
+    // This class should *not* be used directly by client code.  It is an
+    // implementation detail of the macros provided by this component.
+
+    // DATA
+    DeferredMessage *d_message_p;  // message to which arguments are appended
+                                   // (held, not owned)
+
+  public:
+    // CREATORS
+    explicit Log_DeferredArguments(DeferredMessage *message);
+        // Create an object that appends arguments to the specified 'message'.
+
+    // MANIPULATORS
+    template <class TYPE>
+    Log_DeferredArguments& operator,(const TYPE& argument);
+        // Append the specified 'argument' to the arguments of the held
+        // deferred message, and return a reference providing modifiable
+        // access to this object.  The behavior is undefined unless
+        // 'DeferredMessage::appendArgument' accepts 'argument'.
+};
+
+                       // ========================
+                       // class Log_DeferredFormat
+                       // ========================
+
+class Log_DeferredFormat {
+    // This class provides an overloaded comma operator that sets its
+    // right-hand operand as the format specification of a held deferred
+    // message, and returns an object that captures subsequent comma-separated
+    // operands as the arguments of that message.  For example, the expression:
+    //..
+    //  Log_DeferredFormat(&message), "%d:%s", 5, "five";
+    //..
+    // sets the format specification of 'message' to "%d:%s", then appends the
+    // arguments 5 and "five" to it.
+    //
+    // This class should *not* be used directly by client code.  It is an
+    // implementation detail of the macros provided by this component.
+
+    // DATA
+    DeferredMessage *d_message_p;  // message whose format is set (held, not
+                                   // owned)
+
+  public:
+    // CREATORS
+    explicit Log_DeferredFormat(DeferredMessage *message);
+        // Create an object that sets the format specification of the
+        // specified 'message'.
+
+    // MANIPULATORS
+    Log_DeferredArguments operator,(const char *format);
+        // Set the format specification of the held deferred message to the
+        // specified 'format', and return an object that appends subsequent
+        // comma-separated operands to the arguments of that message.
+};
+
+                     // ===========================
+                     // class Log_DeferredFormatter
+                     // ===========================
+
+class Log_DeferredFormatter {
+    // This class provides an aggregate of several objects relevant to the
+    // logging of a message via the deferred 'printf'-style macros:
+    //..
+    //  - record to be logged (holding the deferred message)
+    //  - category to which to log the record
+    //  - severity at which to log the record
+    //..
+    // As a side-effect of creating an object of this class, the record is
+    // obtained.  As a side-effect of destroying the object, the record is
+    // logged; its deferred message is formatted later, when the record is
+    // first read by an observer.
+    //
+    // This class should *not* be used directly by client code.  It is an
+    // implementation detail of the macros provided by this component.
+
+    // DATA
+    const Category *d_category_p;  // category to which record is logged
+                                   // (held, not owned)
+
+    Record         *d_record_p;    // logged record (held, not owned)
+
+    const int       d_severity;    // severity at which record is logged
+
+  private:
+    // NOT IMPLEMENTED
+    Log_DeferredFormatter(const Log_DeferredFormatter&);
+    Log_DeferredFormatter& operator=(const Log_DeferredFormatter&);
+
+  public:
+    // CREATORS
+    Log_DeferredFormatter(const Category *category,
+                          const char     *fileName,
+                          int             lineNumber,
+                          int             severity);
+        // Create a deferred logging formatter that holds (1) the specified
+        // 'category' and 'severity', and (2) a record that is created from
+        // the specified 'fileName' and 'lineNumber'.
+
+    ~Log_DeferredFormatter();
+        // Log the record held by this deferred logging formatter to the held
+        // category (as returned by 'category') at the held severity (as
+        // returned by 'severity'), and destroy this formatter.  If the held
+        // category is 0 (i.e., the logger manager singleton is not
+        // initialized), the deferred message is formatted before the record
+        // is logged.
+
+    // MANIPULATORS
+    Log_DeferredFormat capture();
+        // Return an object that, when followed by a comma-separated format
+        // specification and arguments, captures them in the deferred message
+        // of the held record.
+
+    Record *record();
+        // Return the address of the modifiable log record held by this
+        // deferred logging formatter.  The address is valid until this
+        // formatter is destroyed.
+
+    // ACCESSORS
+    const Category *category() const;
+        // Return the address of the non-modifiable category held by this
+        // deferred logging formatter.
+
+    int severity() const;
+        // Return the severity held by this deferred logging formatter.
+};
+
 // ============================================================================
 //                              INLINE DEFINITIONS
 // ============================================================================
@@ -1831,6 +2087,77 @@ const Record *Log_Formatter::record() const
 
 inline
 int Log_Formatter::severity() const
+{
+    return d_severity;
+}
+
+                     // ---------------------------
+                     // class Log_DeferredArguments
+                     // ---------------------------
+
+// CREATORS
+inline
+Log_DeferredArguments::Log_DeferredArguments(DeferredMessage *message)
+: d_message_p(message)
+{
+    BSLS_ASSERT_SAFE(message);
+}
+
+// MANIPULATORS
+template <class TYPE>
+inline
+Log_DeferredArguments& Log_DeferredArguments::operator,(const TYPE& argument)
+{
+    d_message_p->appendArgument(argument);
+    return *this;
+}
+
+                       // ------------------------
+                       // class Log_DeferredFormat
+                       // ------------------------
+
+// CREATORS
+inline
+Log_DeferredFormat::Log_DeferredFormat(DeferredMessage *message)
+: d_message_p(message)
+{
+    BSLS_ASSERT_SAFE(message);
+}
+
+// MANIPULATORS
+inline
+Log_DeferredArguments Log_DeferredFormat::operator,(const char *format)
+{
+    d_message_p->setFormat(format);
+    return Log_DeferredArguments(d_message_p);
+}
+
+                     // ---------------------------
+                     // class Log_DeferredFormatter
+                     // ---------------------------
+
+// MANIPULATORS
+inline
+Log_DeferredFormat Log_DeferredFormatter::capture()
+{
+    return Log_DeferredFormat(&d_record_p->deferredMessage());
+}
+
+inline
+Record *Log_DeferredFormatter::record()
+{
+    return d_record_p;
+}
+
+// ACCESSORS
+inline
+const Category *Log_DeferredFormatter::category() const
+{
+    return d_category_p;
+}
+
+inline
+int Log_DeferredFormatter::severity() const
 {
     return d_severity;
 }
@@ -164,6 +164,7 @@ using bsl::flush;
 // [38] RULE-BASED LOGGING USAGE EXAMPLE
 // [39] CLASS-SCOPE LOGGING USAGE EXAMPLE
 // [40] BASIC LOGGING USAGE EXAMPLE
+// [41] DEFERRED PRINTF-STYLE MACROS
 
 // ============================================================================
 //                     STANDARD BDE ASSERT TEST FUNCTION
@@ -2917,6 +2918,23 @@ void *workerThreadPerformance(void *)
 
 }  // close namespace BALL_LOG_TEST_CASE_MINUS_2
 
+//=============================================================================
+//                         CASE 41 RELATED ENTITIES
+//-----------------------------------------------------------------------------
+
+namespace BALL_LOG_TEST_CASE_41 {
+
+int numEvaluations = 0;
+
+int countedValue(int value)
+    // Increment 'numEvaluations', and return the specified 'value'.
+{
+    ++numEvaluations;
+    return value;
+}
+
+}  // close namespace BALL_LOG_TEST_CASE_41
+
 // ============================================================================
 //                              MAIN PROGRAM
 // ----------------------------------------------------------------------------
@@ -2934,6 +2952,211 @@ int main(int argc, char *argv[])
     TestAllocator ta("test", veryVeryVeryVerbose);
 
     switch (test) { case 0:  // Zero is always the leading case.
+      case 41: {
+        // --------------------------------------------------------------------
+        // DEFERRED PRINTF-STYLE MACROS
+        //
+        // Concerns:
+        //: 1 Each 'BALL_LOGVA_FAST_*' macro, and 'BALL_LOGVA_FAST', publishes
+        //:   a record having the expected category, severity, file name, line
+        //:   number, and (formatted) message.
+        //:
+        //: 2 The arguments of the macros are evaluated only if a record is to
+        //:   be logged, and exactly once in that case.
+        //:
+        //: 3 String arguments are captured by value, so a record may be
+        //:   formatted after the source string is modified.
+        //:
+        //: 4 Formatting errors do not prevent a record from being logged.
+        //:
+        //: 5 The macros can be used in the absence of a logger manager.
+        //
+        // Plan:
+        //: 1 Register a 'ball::TestObserver', log with each macro, and verify
+        //:   the attributes of the last published record.  (C-1)
+        //:
+        //: 2 Log, at enabled and disabled severities, using arguments whose
+        //:   evaluation is counted.  (C-2)
+        //:
+        //: 3 Log a temporary string argument, and verify the message.  (C-3)
+        //:
+        //: 4 Log with a missing argument, and verify the message.  (C-4)
+        //:
+        //: 5 Log using the macros before a logger manager is created.  (C-5)
+        //
+        // Testing:
+        //   BALL_LOGVA_FAST
+        //   BALL_LOGVA_FAST_TRACE
+        //   BALL_LOGVA_FAST_DEBUG
+        //   BALL_LOGVA_FAST_INFO
+        //   BALL_LOGVA_FAST_WARN
+        //   BALL_LOGVA_FAST_ERROR
+        //   BALL_LOGVA_FAST_FATAL
+        // --------------------------------------------------------------------
+
+        if (verbose) bsl::cout << bsl::endl
+                               << "DEFERRED PRINTF-STYLE MACROS" << bsl::endl
+                               << "============================" << bsl::endl;
+
+        using namespace BALL_LOG_TEST_CASE_41;
+
+        if (verbose) bsl::cout << "\tNo logger manager." << bsl::endl;
+        {
+            BALL_LOG_SET_CATEGORY("NoLoggerManager");
+
+            numEvaluations = 0;
+            BALL_LOGVA_FAST_TRACE("not logged: %d", countedValue(1));
+            ASSERTV(numEvaluations, 0 == numEvaluations);
+
+            // A message at 'e_FATAL' severity is written to 'stderr'; only
+            // check that the macro is well-behaved.
+
+            if (veryVerbose) {
+                BALL_LOGVA_FAST_FATAL("logged to stderr: %d", 1);
+            }
+        }
+
+        BloombergLP::ball::LoggerManagerConfiguration lmc;
+        ASSERT(0 == lmc.setDefaultThresholdLevelsIfValid(Sev::e_OFF,
+                                                         Sev::e_TRACE,
+                                                         Sev::e_OFF,
+                                                         Sev::e_OFF));
+        BloombergLP::ball::LoggerManagerScopedGuard lmg(lmc, &ta);
+
+        bsl::shared_ptr<BloombergLP::ball::TestObserver> observer(
+               new (ta) BloombergLP::ball::TestObserver(&bsl::cout, &ta), &ta);
+
+        BloombergLP::ball::LoggerManager& manager =
+                                 BloombergLP::ball::LoggerManager::singleton();
+
+        ASSERT(0 == manager.registerObserver(observer, "test"));
+
+        BloombergLP::ball::Administration::addCategory("fast",
+                                                       Sev::e_OFF,
+                                                       Sev::e_TRACE,
+                                                       Sev::e_OFF,
+                                                       Sev::e_OFF);
+        BloombergLP::ball::Administration::addCategory("fastWarn",
+                                                       Sev::e_OFF,
+                                                       Sev::e_WARN,
+                                                       Sev::e_OFF,
+                                                       Sev::e_OFF);
+
+        const char *FILE = __FILE__;
+
+        if (verbose) bsl::cout << "\tPublished records." << bsl::endl;
+        {
+            BALL_LOG_SET_CATEGORY("fast");
+
+            const Cat *CAT = BALL_LOG_CATEGORY;
+            int        LINE;
+
+            LINE = L_ + 1;
+            BALL_LOGVA_FAST_TRACE("trace %d", 1);
+            ASSERT(u::isRecordOkay(observer, CAT, Sev::e_TRACE, FILE, LINE,
+                                "trace 1"));
+
+            LINE = L_ + 1;
+            BALL_LOGVA_FAST_DEBUG("debug %s", "two");
+            ASSERT(u::isRecordOkay(observer, CAT, Sev::e_DEBUG, FILE, LINE,
+                                "debug two"));
+
+            LINE = L_ + 1;
+            BALL_LOGVA_FAST_INFO("info %.1f", 3.0);
+            ASSERT(u::isRecordOkay(observer, CAT, Sev::e_INFO, FILE, LINE,
+                                "info 3.0"));
+
+            LINE = L_ + 1;
+            BALL_LOGVA_FAST_WARN("warn %u %x", 4u, 0x4);
+            ASSERT(u::isRecordOkay(observer, CAT, Sev::e_WARN, FILE, LINE,
+                                "warn 4 4"));
+
+            LINE = L_ + 1;
+            BALL_LOGVA_FAST_ERROR("error %c%c", 'a', 'b');
+            ASSERT(u::isRecordOkay(observer, CAT, Sev::e_ERROR, FILE, LINE,
+                                "error ab"));
+
+            LINE = L_ + 1;
+            BALL_LOGVA_FAST_FATAL("fatal");
+            ASSERT(u::isRecordOkay(observer, CAT, Sev::e_FATAL, FILE, LINE,
+                                "fatal"));
+
+            for (int severity = Sev::e_FATAL;
+                 severity <= Sev::e_TRACE;
+                 severity += Sev::e_FATAL) {
+                LINE = L_ + 1;
+                BALL_LOGVA_FAST(severity, "runtime %d", severity);
+
+                bsl::ostringstream expected;
+                expected << "runtime " << severity;
+                ASSERTV(severity, u::isRecordOkay(observer,
+                                                  CAT,
+                                                  severity,
+                                                  FILE,
+                                                  LINE,
+                                                  expected.str().c_str()));
+            }
+        }
+
+        if (verbose) bsl::cout << "\tArgument evaluation." << bsl::endl;
+        {
+            BALL_LOG_SET_CATEGORY("fastWarn");
+
+            const int numPublished = observer->numPublishedRecords();
+
+            numEvaluations = 0;
+            BALL_LOGVA_FAST_INFO("%d %d", countedValue(1), countedValue(2));
+            BALL_LOGVA_FAST(Sev::e_TRACE, "%d", countedValue(3));
+            ASSERTV(numEvaluations, 0 == numEvaluations);
+            ASSERT(numPublished == observer->numPublishedRecords());
+
+            BALL_LOGVA_FAST_WARN("%d %d", countedValue(1), countedValue(2));
+            ASSERTV(numEvaluations, 2 == numEvaluations);
+            ASSERT(numPublished + 1 == observer->numPublishedRecords());
+
+            BALL_LOGVA_FAST(Sev::e_ERROR, "%d", countedValue(3));
+            ASSERTV(numEvaluations, 3 == numEvaluations);
+            ASSERT(numPublished + 2 == observer->numPublishedRecords());
+            ASSERT(0 == bsl::strcmp(
+                                 "3",
+                                 observer->lastPublishedRecord().fixedFields()
+                                                                .message()));
+        }
+
+        if (verbose) bsl::cout << "\tString arguments are copied."
+                               << bsl::endl;
+        {
+            BALL_LOG_SET_CATEGORY("fast");
+
+            {
+                bsl::string temporary("temporary", &ta);
+                BALL_LOGVA_FAST_INFO("[%s] [%s]",
+                                     temporary,
+                                     temporary.c_str());
+                temporary.assign("overwritten");
+            }
+            ASSERT(0 == bsl::strcmp(
+                                 "[temporary] [temporary]",
+                                 observer->lastPublishedRecord().fixedFields()
+                                                                .message()));
+        }
+
+        if (verbose) bsl::cout << "\tMismatched arguments." << bsl::endl;
+        {
+            BALL_LOG_SET_CATEGORY("fast");
+
+            const int numPublished = observer->numPublishedRecords();
+
+            BALL_LOGVA_FAST_INFO("%d and %s", 1);
+            ASSERT(numPublished + 1 == observer->numPublishedRecords());
+            ASSERT(0 == bsl::strcmp(
+                                 "1 and %s",
+                                 observer->lastPublishedRecord().fixedFields()
+                                                                .message()));
+        }
+
+        ASSERT(0 == manager.deregisterObserver("test"));
+      } break;
       case 40: {
         // --------------------------------------------------------------------
         // BASIC LOGGING USAGE EXAMPLE
@@ -284,7 +284,7 @@ Logger::Logger(const bsl::shared_ptr<Observer>&            observer,
                LoggerManagerConfiguration::LogOrder        logOrder,
                LoggerManagerConfiguration::TriggerMarkers  triggerMarkers,
                bslma::Allocator                           *globalAllocator)
-: d_recordPool(-1, globalAllocator)
+: d_recordPool(globalAllocator)
 , d_observer(observer)
 , d_recordBuffer_p(recordBuffer)
 , d_populator(populator)
@@ -338,9 +338,13 @@ void Logger::logMessage(const Category&            category,
         d_populator(&record->customFields());
     }
 
-    bsl::shared_ptr<Record> handle(record, &d_recordPool, d_allocator_p);
+    bsl::shared_ptr<Record> handle = d_recordPool.makeHandle(record);
 
     if (levels.recordLevel() >= severity) {
+        // A deferred message is formatted before the record is buffered, as
+        // the record buffer accounts for the memory used by each record.
+
+        record->formatDeferredMessage();
         d_recordBuffer_p->pushBack(handle);
     }
 
@@ -366,9 +370,7 @@ void Logger::logMessage(const Category&            category,
             Record *marker = getRecord(record->fixedFields().fileName(),
                                        record->fixedFields().lineNumber());
 
-            bsl::shared_ptr<Record> handle(marker,
-                                           &d_recordPool,
-                                           d_allocator_p);
+            bsl::shared_ptr<Record> handle = d_recordPool.makeHandle(marker);
 
             copyAttributesWithoutMessage(handle.get(), record->fixedFields());
 
@@ -400,9 +402,7 @@ void Logger::logMessage(const Category&            category,
             Record *marker = getRecord(record->fixedFields().fileName(),
                                        record->fixedFields().lineNumber());
 
-            bsl::shared_ptr<Record> handle(marker,
-                                           &d_recordPool,
-                                           d_allocator_p);
+            bsl::shared_ptr<Record> handle = d_recordPool.makeHandle(marker);
 
             copyAttributesWithoutMessage(handle.get(), record->fixedFields());
 
@@ -460,7 +460,7 @@ void Logger::publish(Transmission::Cause cause)
 // MANIPULATORS
 Record *Logger::getRecord(const char *file, int line)
 {
-    Record *record = d_recordPool.getObject();
+    Record *record = d_recordPool.getRecord();
 
     // Note that the records obtained from the record pool are guaranteed to
     // have all custom fields removed and the message stream cleared.  So only
@@ -496,7 +496,7 @@ void Logger::logMessage(const Category&  category,
 {
     ThresholdAggregate thresholds;
     if (!isCategoryEnabled(&thresholds, category, severity)) {
-        d_recordPool.deleteObject(record);
+        d_recordPool.releaseRecord(record);
         return;                                                       // RETURN
     }
     logMessage(category, severity, record, thresholds);
@@ -874,11 +874,10 @@ BSLS_IDENT("$Id: $")
 #include <ball_loggermanagerconfiguration.h>
 #include <ball_record.h>
 #include <ball_recordbuffer.h>
+#include <ball_recordpool.h>
 #include <ball_thresholdaggregate.h>
 #include <ball_transmission.h>
 
-#include <bdlcc_objectpool.h>
-
 #include <bdlma_concurrentpool.h>
 
 #include <bslma_allocator.h>
@@ -926,11 +925,8 @@ class Logger {
 
   private:
     // DATA
-    bdlcc::ObjectPool<Record,
-                      bdlcc::ObjectPoolFunctors::DefaultCreator,
-                      bdlcc::ObjectPoolFunctors::Clear<Record> >
-                  d_recordPool;                 // pool of records with a
-                                                // custom RESETTER
+    RecordPool    d_recordPool;                 // pool of records, having
+                                                // per-thread caches
 
     const bsl::shared_ptr<Observer>
                   d_observer;                   // holds observer
@@ -1037,7 +1033,7 @@ class Logger {
     // MANIPULATORS
     Record *getRecord(const char *file, int line);
         // Return the address of a modifiable record having the specified
-        // 'file' and 'line' attributes, and retrieved from the object pool
+        // 'file' and 'line' attributes, and retrieved from the record pool
         // managed by this logger.
 
     void logMessage(const Category&  category,
@@ -2112,7 +2108,7 @@ int Logger::messageBufferSize() const
 inline
 int Logger::numRecordsInUse() const
 {
-    return d_recordPool.numObjects() - d_recordPool.numAvailableObjects();
+    return d_recordPool.numRecordsInUse();
 }
 
                         // -------------------
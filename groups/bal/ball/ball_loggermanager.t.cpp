@@ -41,6 +41,8 @@
 #include <bslmt_barrier.h>
 #include <bslmt_lockguard.h>
 #include <bslmt_threadutil.h>
+#include <bslmt_throughputbenchmark.h>
+#include <bslmt_throughputbenchmarkresult.h>
 
 #include <bsls_atomic.h>
 #include <bsls_log.h>
@@ -213,6 +215,7 @@ using namespace bdlf::PlaceHolders;
 // [41] USAGE EXAMPLE #4
 // [37] CONCERN: RECORD POOL MEMORY CONSUMPTION
 // [19] CONCERN: PERFORMANCE IMPLICATIONS
+// [-3] CONCERN: MULTI-THREADED LOGGING THROUGHPUT
 // [12] CONCERN: USER FIELDS POPULATOR CALLBACK
 // [11] CONCERN: INTERNAL BROADCAST OBSERVER
 // [ 9] CONCERN: DEFAULT THRESHOLD LEVELS CALLBACK
@@ -1384,6 +1387,50 @@ void doPerformanceTest(ball::LoggerManager& loggerManager,
     if (verbose) cerr << num_logs/timer.elapsedTime() << " (log/sec)" << endl;
 }
 
+class ThroughputObserver : public ball::Observer {
+    // This class is used by the multi-threaded throughput benchmark.  No real
+    // logging is done by this observer, which can be shared by many threads.
+
+    bsls::AtomicInt d_publishCount;
+
+  public:
+    ThroughputObserver()
+    : d_publishCount(0)
+    {
+    }
+
+    using Observer::publish;   // Avoid hiding base class method;
+
+    virtual void publish(const bsl::shared_ptr<const ball::Record>& record,
+                         const ball::Context&                       context)
+    {
+        (void)record;
+        (void)context;
+        d_publishCount.addRelaxed(1);
+    }
+
+    virtual void releaseRecords()
+    {
+    }
+
+    int publishCount() const
+    {
+        return d_publishCount.loadRelaxed();
+    }
+};
+
+void logForThroughput(const ball::Category *category, int)
+    // Log a single message to the specified 'category' through the logger
+    // installed for the calling thread.
+{
+    ball::LoggerManager::singleton().getLogger().logMessage(
+                                                       *category,
+                                                       ball::Severity::e_INFO,
+                                                       __FILE__,
+                                                       __LINE__,
+                                                       "Throughput message");
+}
+
 }  // close unnamed namespace
 
 namespace BALL_LOGGERMANAGER_TEST_LOOKUP_CATEGORY {
@@ -6742,6 +6789,88 @@ int main(int argc, char *argv[])
         doPerformanceTest(mX, num_logs, verbose);
         if (verbose) cout << "-----------------------------\n\n" << endl;
 
+      } break;
+      case -3: {
+        // --------------------------------------------------------------------
+        // CONCERN: MULTI-THREADED LOGGING THROUGHPUT
+        //
+        // Concerns:
+        //: 1 The throughput of 'logMessage' on a shared logger scales with
+        //:   the number of logging threads, i.e., obtaining and releasing
+        //:   log records does not serialize the threads.
+        //
+        // Plan:
+        //: 1 Using 'bslmt::ThroughputBenchmark', log messages that are
+        //:   published (but not stored) from thread groups of 1, 2, 4, 8, 16,
+        //:   32, and 64 threads, and report the median throughput, in
+        //:   messages per second, of each thread group.  Optionally specify
+        //:   the number of milliseconds per sample as the second argument
+        //:   ('argv[2]') to the executable.  (C-1)
+        //
+        // Testing:
+        //   CONCERN: MULTI-THREADED LOGGING THROUGHPUT
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "CONCERN: MULTI-THREADED LOGGING THROUGHPUT"
+                          << endl
+                          << "=========================================="
+                          << endl;
+
+        ball::LoggerManagerConfiguration mXC;
+        ball::LoggerManagerScopedGuard   lmGuard(mXC);
+
+        Obj& mX = Obj::singleton();
+
+        bsl::shared_ptr<ThroughputObserver> observer =
+                                     bsl::make_shared<ThroughputObserver>();
+        ASSERT(0 == mX.registerObserver(observer, "throughput"));
+
+        // Publish, but do not store, 'e_INFO' messages.
+
+        const ball::Category *category = mX.setCategory(
+                                                      "ThroughputTest",
+                                                      ball::Severity::e_OFF,
+                                                      ball::Severity::e_INFO,
+                                                      ball::Severity::e_OFF,
+                                                      ball::Severity::e_OFF);
+        ASSERT(category);
+
+        const int msPerSample = verbose && atoi(argv[2]) > 0
+                              ? atoi(argv[2])
+                              : 500;
+        const int numSamples  = 5;
+
+        static const int NUM_THREADS[] = { 1, 2, 4, 8, 16, 32, 64 };
+        const int        NUM_CONFIGS   = sizeof NUM_THREADS
+                                       / sizeof *NUM_THREADS;
+
+        for (int ti = 0; ti < NUM_CONFIGS; ++ti) {
+            const int NUM_THREAD = NUM_THREADS[ti];
+
+            bslmt::ThroughputBenchmark       benchmark;
+            bslmt::ThroughputBenchmarkResult result;
+
+            const int groupIdx = benchmark.addThreadGroup(
+                                     bdlf::BindUtil::bind(
+                                                      &logForThroughput,
+                                                      category,
+                                                      bdlf::PlaceHolders::_1),
+                                     NUM_THREAD,
+                                     0);
+
+            benchmark.execute(&result, msPerSample, numSamples);
+
+            double median;
+            result.getMedian(&median, groupIdx);
+
+            cout << "threads: " << NUM_THREAD
+                 << "\tmessages/sec: " << median << endl;
+        }
+
+        ASSERT(0 < observer->publishCount());
+        ASSERT(0 == mX.getLogger().numRecordsInUse());
+
       } break;
       default: {
         cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
@@ -0,0 +1,619 @@
+// ball_ratelimitingobserver.cpp                                      -*-C++-*-
+#include <ball_ratelimitingobserver.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(ball_ratelimitingobserver_cpp,"$Id$ $CSID$")
+
+#include <ball_context.h>
+#include <ball_record.h>
+#include <ball_recordattributes.h>
+#include <ball_transmission.h>
+
+#include <bdlb_bitutil.h>
+#include <bdlb_hashutil.h>
+
+#include <bdls_processutil.h>
+
+#include <bdlt_currenttime.h>
+
+#include <bslmt_threadutil.h>
+
+#include <bslma_deallocatorproctor.h>
+#include <bslma_default.h>
+#include <bslma_deleterhelper.h>
+
+#include <bsls_systemtime.h>
+#include <bsls_timeinterval.h>
+
+#include <bsl_cstddef.h>
+#include <bsl_cstdint.h>
+#include <bsl_cstring.h>
+#include <bsl_string.h>
+
+#include <stdio.h>  // *NOT* <bsl_cstdio.h>, which does not declare 'snprintf'
+
+#if defined(BSLS_PLATFORM_CMP_MSVC)
+#define snprintf _snprintf
+#endif
+
+///Implementation Notes
+///--------------------
+// Each token bucket is implemented as a "generic cell rate algorithm" (GCRA):
+// the state of a bucket is the "theoretical arrival time" (TAT) of the next
+// request, and a request at time 'now' is admitted if, after advancing the
+// TAT by one interval (from 'max(TAT, now)'), the TAT is no more than the
+// tolerance ('burstSize * interval') ahead of 'now'.  The TAT is updated with
+// a compare-and-swap, so a bucket is lock-free.  A token is returned to a
+// bucket by moving its TAT back by one interval.
+//
+// The per-category state is kept in a fixed-size, insert-only, open-addressing
+// hash table of 'RateLimitingObserver_CategoryEntry' objects.  A new entry is
+// installed in an empty slot with a compare-and-swap; the thread that loses a
+// race to install an entry in a slot discards its entry, and continues
+// probing unless the winning entry is for the same category.  The table has
+// at least twice as many slots as the maximum number of tracked categories,
+// so probe sequences remain short.
+//
+// The per-category limit is stored once in the observer, along with a
+// generation count.  Each entry records the generation of the limit it was
+// last configured with, and is reconfigured lazily when it is next used.
+//
+// The suppressed records of a category are counted, and the most severe of
+// their severities is kept, in the category entry.  The severity is lowered
+// before the count is incremented, so that a thread that takes the count also
+// sees the severities of the records counted.  A summary record is built from
+// the entry, not from the forwarded record, so that the deferred message of
+// the forwarded record (see 'ball_record') is not formatted by 'publish'.
+//
+// Sampling uses the "SplitMix64" generator, whose state is advanced by an
+// atomic addition, so that concurrent threads draw distinct values without
+// locking.
+
+namespace BloombergLP {
+namespace ball {
+
+                 // ========================================
+                 // class RateLimitingObserver_CategoryEntry
+                 // ========================================
+
+class RateLimitingObserver_CategoryEntry {
+    // This component-private class holds the rate-limiting state of a
+    // category.
+
+  public:
+    // PUBLIC DATA
+    RateLimitingObserver_Bucket d_bucket;         // per-category limit
+
+    bsls::AtomicInt             d_generation;     // generation of the
+                                                  // per-category limit last
+                                                  // applied to 'd_bucket'
+
+    bsls::AtomicInt64           d_numSuppressed;  // number of records
+                                                  // suppressed since the last
+                                                  // summary
+
+    bsls::AtomicInt             d_severity;       // most severe (i.e., least)
+                                                  // severity of the records
+                                                  // suppressed since the last
+                                                  // summary, or
+                                                  // 'k_NO_SEVERITY'
+
+    unsigned int                d_hash;           // hash of 'd_name'
+
+    bsl::string                 d_name;           // category name
+
+  private:
+    // NOT IMPLEMENTED
+    RateLimitingObserver_CategoryEntry(
+                                   const RateLimitingObserver_CategoryEntry&);
+    RateLimitingObserver_CategoryEntry& operator=(
+                                   const RateLimitingObserver_CategoryEntry&);
+
+  public:
+    // CREATORS
+    RateLimitingObserver_CategoryEntry(const char       *name,
+                                       unsigned int      hash,
+                                       bslma::Allocator *basicAllocator);
+        // Create the state of the category having the specified 'name' and
+        // 'hash', using the specified 'basicAllocator' to supply memory.
+};
+
+namespace {
+
+const bsls::Types::Int64 k_MAX_INTERVAL = 1LL << 60;
+    // maximum interval between records, and maximum tolerance, of a bucket
+
+const char k_SUMMARY_FORMAT[] =
+                            "%lld log record(s) suppressed by rate limiting";
+
+const int k_NO_SEVERITY = 256;
+    // severity of a category entry having no suppressed record (greater than
+    // any severity)
+
+bsls::Types::Int64 now()
+    // Return the current time, in nanoseconds, on the monotonic clock.
+{
+    return bsls::SystemTime::nowMonotonicClock().totalNanoseconds();
+}
+
+bsls::Types::Uint64 splitMix64(bsls::Types::Uint64 state)
+    // Return the "SplitMix64" output value for the specified 'state'.
+{
+    state = (state ^ (state >> 30)) * 0xbf58476d1ce4e5b9ULL;
+    state = (state ^ (state >> 27)) * 0x94d049bb133111ebULL;
+    return state ^ (state >> 31);
+}
+
+}  // close unnamed namespace
+
+                 // ----------------------------------------
+                 // class RateLimitingObserver_CategoryEntry
+                 // ----------------------------------------
+
+// CREATORS
+RateLimitingObserver_CategoryEntry::RateLimitingObserver_CategoryEntry(
+                                              const char       *name,
+                                              unsigned int      hash,
+                                              bslma::Allocator *basicAllocator)
+: d_bucket()
+, d_generation(-1)
+, d_numSuppressed(0)
+, d_severity(k_NO_SEVERITY)
+, d_hash(hash)
+, d_name(name, basicAllocator)
+{
+}
+
+                    // ---------------------------------
+                    // class RateLimitingObserver_Bucket
+                    // ---------------------------------
+
+// MANIPULATORS
+bool RateLimitingObserver_Bucket::tryAcquire(bsls::Types::Int64 now)
+{
+    const bsls::Types::Int64 interval = d_interval.loadRelaxed();
+    if (0 == interval) {
+        return true;                                                  // RETURN
+    }
+
+    const bsls::Types::Int64 tolerance   = d_tolerance.loadRelaxed();
+    bsls::Types::Int64       arrivalTime = d_arrivalTime.loadRelaxed();
+
+    for (;;) {
+        const bsls::Types::Int64 next = (arrivalTime > now ? arrivalTime : now)
+                                      + interval;
+        if (next - now > tolerance) {
+            return false;                                             // RETURN
+        }
+
+        const bsls::Types::Int64 previous =
+                                  d_arrivalTime.testAndSwapAcqRel(arrivalTime,
+                                                                  next);
+        if (previous == arrivalTime) {
+            return true;                                              // RETURN
+        }
+        arrivalTime = previous;
+    }
+}
+
+void RateLimitingObserver_Bucket::release()
+{
+    const bsls::Types::Int64 interval = d_interval.loadRelaxed();
+    if (0 != interval) {
+        d_arrivalTime.addAcqRel(-interval);
+    }
+}
+
+void RateLimitingObserver_Bucket::setLimit(bsls::Types::Int64 interval,
+                                           int                burstSize)
+{
+    BSLS_ASSERT(0 <= interval);
+    BSLS_ASSERT(0 <  burstSize);
+
+    d_arrivalTime.storeRelaxed(0);
+    d_tolerance.storeRelaxed(interval > k_MAX_INTERVAL / burstSize
+                             ? k_MAX_INTERVAL
+                             : interval * burstSize);
+    d_interval.storeRelaxed(interval);
+}
+
+                        // --------------------------
+                        // class RateLimitingObserver
+                        // --------------------------
+
+// PRIVATE CLASS METHODS
+bsls::Types::Int64 RateLimitingObserver::toInterval(double recordsPerSecond)
+{
+    BSLS_ASSERT(0 <= recordsPerSecond);
+
+    if (0 == recordsPerSecond) {
+        return 0;                                                     // RETURN
+    }
+
+    const double interval = 1e9 / recordsPerSecond;
+
+    // Clamp to at least 1 nanosecond (0 means "unlimited"), and to at most
+    // 'k_MAX_INTERVAL' (about 36 years), so that times cannot overflow.
+
+    return interval < 1.0
+           ? 1
+           : interval > static_cast<double>(k_MAX_INTERVAL)
+             ? k_MAX_INTERVAL
+             : static_cast<bsls::Types::Int64>(interval);
+}
+
+// PRIVATE MANIPULATORS
+void RateLimitingObserver::initialize()
+{
+    const bsl::uint32_t numCategories =
+                                static_cast<bsl::uint32_t>(d_maxNumCategories);
+
+    d_categoryTableSize = 2 * static_cast<int>(
+                          bdlb::BitUtil::roundUpToBinaryPower(numCategories));
+
+    const bsl::size_t tableBytes = d_categoryTableSize
+                                 * sizeof(bsls::AtomicPointer<CategoryEntry>);
+
+    void *table = d_allocator_p->allocate(tableBytes);
+    bslma::DeallocatorProctor<bslma::Allocator> proctor(table, d_allocator_p);
+
+    d_categoryTable_p = static_cast<bsls::AtomicPointer<CategoryEntry> *>(
+                                                                        table);
+    for (int i = 0; i < d_categoryTableSize; ++i) {
+        new (d_categoryTable_p + i) bsls::AtomicPointer<CategoryEntry>(0);
+    }
+
+    d_overflowEntry_p = new (*d_allocator_p) CategoryEntry("",
+                                                           0,
+                                                           d_allocator_p);
+    proctor.release();
+}
+
+RateLimitingObserver::CategoryEntry *RateLimitingObserver::lookupEntry(
+                                                          const char *category)
+{
+    const int          length = static_cast<int>(bsl::strlen(category));
+    const unsigned int hash   = bdlb::HashUtil::hash1(category, length);
+    const unsigned int mask = d_categoryTableSize - 1;
+
+    unsigned int index = hash & mask;
+    for (int i = 0; i < d_categoryTableSize; ++i) {
+        CategoryEntry *entry = d_categoryTable_p[index].loadAcquire();
+
+        if (!entry) {
+            // Reserve a place for a new category, then try to install it.
+
+            if (d_numCategories.addAcqRel(1) > d_maxNumCategories) {
+                d_numCategories.addAcqRel(-1);
+                return d_overflowEntry_p;                             // RETURN
+            }
+
+            CategoryEntry *newEntry = new (*d_allocator_p) CategoryEntry(
+                                                                category,
+                                                                hash,
+                                                                d_allocator_p);
+
+            entry = d_categoryTable_p[index].testAndSwapAcqRel(0, newEntry);
+            if (!entry) {
+                return newEntry;                                      // RETURN
+            }
+
+            // Another thread installed an entry in this slot first.
+
+            d_numCategories.addAcqRel(-1);
+            bslma::DeleterHelper::deleteObject(newEntry, d_allocator_p);
+        }
+
+        if (entry->d_hash == hash && entry->d_name == category) {
+            return entry;                                             // RETURN
+        }
+
+        index = (index + 1) & mask;
+    }
+
+    return d_overflowEntry_p;
+}
+
+bool RateLimitingObserver::isSampled(int band)
+{
+    const bsls::Types::Uint64 threshold =
+                                  d_samplingThresholds[band].loadRelaxed();
+    if (0 == threshold) {
+        return true;                                                  // RETURN
+    }
+    if (~0ULL == threshold) {
+        return false;                                                 // RETURN
+    }
+
+    const bsls::Types::Uint64 state =
+                     d_samplingCounter.addRelaxed(0x9e3779b97f4a7c15ULL);
+    return splitMix64(state) >= threshold;
+}
+
+void RateLimitingObserver::publishSummary(CategoryEntry  *entry,
+                                          const Context&  context)
+{
+    const bsls::Types::Int64 numSuppressed =
+                                          entry->d_numSuppressed.swapAcqRel(0);
+    if (0 == numSuppressed) {
+        return;                                                       // RETURN
+    }
+    d_numUnreported.addRelaxed(-numSuppressed);
+
+    // The severities of the records counted were stored before the count was
+    // incremented, but a concurrent summary may have taken them already.
+
+    int severity = entry->d_severity.swapAcqRel(k_NO_SEVERITY);
+    if (k_NO_SEVERITY == severity) {
+        severity = Severity::e_WARN;
+    }
+
+    char message[64];
+    snprintf(message,
+             sizeof message,
+             k_SUMMARY_FORMAT,
+             static_cast<long long>(numSuppressed));
+
+    bsl::shared_ptr<Record> summary;
+    summary.createInplace(d_allocator_p, d_allocator_p);
+
+    RecordAttributes& fixedFields = summary->fixedFields();
+    fixedFields.setTimestamp(bdlt::CurrentTime::utc());
+    fixedFields.setProcessID(bdls::ProcessUtil::getProcessId());
+    fixedFields.setThreadID(bslmt::ThreadUtil::selfIdAsUint64());
+    fixedFields.setFileName(__FILE__);
+    fixedFields.setLineNumber(__LINE__);
+    fixedFields.setCategory(entry->d_name.c_str());
+    fixedFields.setSeverity(severity);
+    fixedFields.setMessage(message);
+
+    d_innerObserver->publish(summary, context);
+}
+
+// CREATORS
+RateLimitingObserver::RateLimitingObserver(
+                            const bsl::shared_ptr<Observer>&  observer,
+                            bslma::Allocator                 *basicAllocator)
+: d_innerObserver(observer)
+, d_samplingCounter(0)
+, d_categoryInterval(0)
+, d_categoryBurstSize(1)
+, d_categoryLimitGeneration(0)
+, d_categoryTable_p(0)
+, d_categoryTableSize(0)
+, d_maxNumCategories(k_DEFAULT_MAX_NUM_CATEGORIES)
+, d_numCategories(0)
+, d_overflowEntry_p(0)
+, d_numForwarded(0)
+, d_numSuppressed(0)
+, d_numUnreported(0)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    BSLS_ASSERT(observer);
+
+    initialize();
+}
+
+RateLimitingObserver::RateLimitingObserver(
+                            const bsl::shared_ptr<Observer>&  observer,
+                            int                               maxNumCategories,
+                            bslma::Allocator                 *basicAllocator)
+: d_innerObserver(observer)
+, d_samplingCounter(0)
+, d_categoryInterval(0)
+, d_categoryBurstSize(1)
+, d_categoryLimitGeneration(0)
+, d_categoryTable_p(0)
+, d_categoryTableSize(0)
+, d_maxNumCategories(maxNumCategories)
+, d_numCategories(0)
+, d_overflowEntry_p(0)
+, d_numForwarded(0)
+, d_numSuppressed(0)
+, d_numUnreported(0)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    BSLS_ASSERT(observer);
+    BSLS_ASSERT(0 < maxNumCategories);
+
+    initialize();
+}
+
+RateLimitingObserver::~RateLimitingObserver()
+{
+    for (int i = 0; i < d_categoryTableSize; ++i) {
+        CategoryEntry *entry = d_categoryTable_p[i].loadRelaxed();
+        if (entry) {
+            bslma::DeleterHelper::deleteObject(entry, d_allocator_p);
+        }
+    }
+    d_allocator_p->deallocate(d_categoryTable_p);
+    bslma::DeleterHelper::deleteObject(d_overflowEntry_p, d_allocator_p);
+}
+
+// MANIPULATORS
+void RateLimitingObserver::publish(
+                                  const bsl::shared_ptr<const Record>& record,
+                                  const Context&                       context)
+{
+    BSLS_ASSERT(record);
+
+    if (Transmission::e_PASSTHROUGH != context.transmissionCause()) {
+        d_numForwarded.addRelaxed(1);
+        d_innerObserver->publish(record, context);
+        return;                                                       // RETURN
+    }
+
+    // The severity and category are read through accessors that do not
+    // format the deferred message of 'record'.
+
+    const int band = severityBand(record->severity());
+
+    Bucket&    severityBucket  = d_severityBuckets[band];
+    const bool isCategoryLimited = 0 != d_categoryInterval.loadRelaxed();
+
+    if (!isCategoryLimited
+     && !severityBucket.isLimited()
+     && 0 == d_samplingThresholds[band].loadRelaxed()
+     && 0 == d_numUnreported.loadRelaxed()) {
+        // Nothing is limited, and no suppressed record needs reporting.
+
+        d_numForwarded.addRelaxed(1);
+        d_innerObserver->publish(record, context);
+        return;                                                       // RETURN
+    }
+
+    CategoryEntry *entry = lookupEntry(record->category());
+
+    const int generation = d_categoryLimitGeneration.loadAcquire();
+    if (entry->d_generation.loadRelaxed() != generation) {
+        entry->d_bucket.setLimit(d_categoryInterval.loadRelaxed(),
+                                 d_categoryBurstSize.loadRelaxed());
+        entry->d_generation.storeRelaxed(generation);
+    }
+
+    bool admitted = isSampled(band);
+
+    if (admitted && (entry->d_bucket.isLimited()
+                  || severityBucket.isLimited())) {
+        const bsls::Types::Int64 currentTime = now();
+
+        // A record must be admitted by both buckets.  If the category bucket
+        // admits it but the severity bucket does not, the category token is
+        // returned, so that a storm in a severity band does not consume the
+        // budgets of the categories whose records it suppresses.
+
+        admitted = entry->d_bucket.tryAcquire(currentTime);
+        if (admitted && !severityBucket.tryAcquire(currentTime)) {
+            entry->d_bucket.release();
+            admitted = false;
+        }
+    }
+
+    if (!admitted) {
+        const int severity = record->severity();
+        int       current  = entry->d_severity.loadRelaxed();
+        while (severity < current) {
+            const int previous = entry->d_severity.testAndSwapAcqRel(current,
+                                                                   severity);
+            if (previous == current) {
+                break;
+            }
+            current = previous;
+        }
+
+        entry->d_numSuppressed.addAcqRel(1);
+        d_numSuppressed.addRelaxed(1);
+        d_numUnreported.addRelaxed(1);
+        return;                                                       // RETURN
+    }
+
+    if (0 != entry->d_numSuppressed.loadRelaxed()) {
+        publishSummary(entry, context);
+    }
+
+    d_numForwarded.addRelaxed(1);
+    d_innerObserver->publish(record, context);
+}
+
+void RateLimitingObserver::publishSummaries()
+{
+    if (0 == d_numUnreported.loadRelaxed()) {
+        return;                                                       // RETURN
+    }
+
+    const Context context(Transmission::e_PASSTHROUGH, 0, 1);
+
+    for (int i = 0; i < d_categoryTableSize; ++i) {
+        CategoryEntry *entry = d_categoryTable_p[i].loadAcquire();
+        if (entry) {
+            publishSummary(entry, context);
+        }
+    }
+    publishSummary(d_overflowEntry_p, context);
+}
+
+void RateLimitingObserver::releaseRecords()
+{
+    publishSummaries();
+}
+
+void RateLimitingObserver::setCategoryLimit(double recordsPerSecond,
+                                            int    burstSize)
+{
+    BSLS_ASSERT(0 <= recordsPerSecond);
+    BSLS_ASSERT(0 <  burstSize);
+
+    d_categoryInterval.storeRelaxed(toInterval(recordsPerSecond));
+    d_categoryBurstSize.storeRelaxed(burstSize);
+    d_categoryLimitGeneration.addAcqRel(1);
+}
+
+void RateLimitingObserver::setSamplingProbability(Severity::Level severity,
+                                                  double          probability)
+{
+    BSLS_ASSERT(0.0 <= probability);
+    BSLS_ASSERT(       probability <= 1.0);
+
+    bsls::Types::Uint64 threshold;
+
+    if (1.0 == probability) {
+        threshold = 0;
+    }
+    else if (0.0 == probability) {
+        threshold = ~0ULL;
+    }
+    else {
+        // A value drawn uniformly from '[0 .. 2^64)' is sampled if it is not
+        // less than 'threshold'.  If 'probability' is too small for
+        // '1.0 - probability' to differ from 1.0, the product is exactly 2^64,
+        // which cannot be converted to 'Uint64', and the records of the band
+        // are never forwarded.
+
+        const double k_TWO_TO_64 = 18446744073709551616.0;
+        const double product     = (1.0 - probability) * k_TWO_TO_64;
+
+        if (product >= k_TWO_TO_64) {
+            threshold = ~0ULL;
+        }
+        else {
+            threshold = static_cast<bsls::Types::Uint64>(product);
+            if (0 == threshold) {
+                threshold = 1;
+            }
+        }
+    }
+
+    d_samplingThresholds[severityBand(severity)].storeRelaxed(threshold);
+}
+
+void RateLimitingObserver::setSeverityLimit(Severity::Level severity,
+                                            double          recordsPerSecond,
+                                            int             burstSize)
+{
+    BSLS_ASSERT(0 <= recordsPerSecond);
+    BSLS_ASSERT(0 <  burstSize);
+
+    d_severityBuckets[severityBand(severity)].setLimit(
+                                                  toInterval(recordsPerSecond),
+                                                  burstSize);
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
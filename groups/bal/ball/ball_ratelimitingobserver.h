@@ -0,0 +1,526 @@
+// ball_ratelimitingobserver.h                                        -*-C++-*-
+#ifndef INCLUDED_BALL_RATELIMITINGOBSERVER
+#define INCLUDED_BALL_RATELIMITINGOBSERVER
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide an observer that limits the rate of published log records.
+//
+//@CLASSES:
+//  ball::RateLimitingObserver: observer that rate-limits log records
+//
+//@SEE_ALSO: ball_filteringobserver, ball_logthrottle, ball_observer
+//
+//@DESCRIPTION: This component provides a concrete implementation of the
+// 'ball::Observer' protocol, 'ball::RateLimitingObserver', that forwards the
+// log records it receives to an inner observer supplied at construction,
+// subject to a budget:
+//..
+//             ,--------------------------.
+//            ( ball::RateLimitingObserver )
+//             `--------------------------'
+//                           |              ctor
+//                           V
+//                    ,--------------.
+//                   ( ball::Observer )
+//                    `--------------'
+//                                          publish
+//                                          dtor
+//..
+// Whereas the macros of 'ball_logthrottle' limit the rate at which an
+// individual logging statement publishes records, a rate-limiting observer
+// bounds the rate at which records reach the observer that it wraps (e.g., a
+// 'ball::AsyncFileObserver'), regardless of where they were logged.  Three
+// mechanisms are provided, each of which is disabled by default:
+//
+//: o *Per-severity* *limits*: a token bucket, set by 'setSeverityLimit',
+//:   limits the rate of the records of each severity band.  The severity
+//:   band of a record is the least 'ball::Severity::Level' value numerically
+//:   greater than or equal to its severity (e.g., a record of severity 100 is
+//:   in the 'e_INFO' band).
+//:
+//: o *Per-category* *limits*: a token bucket, set by 'setCategoryLimit',
+//:   limits the rate of the records of *each* category independently.  A
+//:   noisy category therefore cannot consume the budget of other categories.
+//:
+//: o *Sampling*: the records of each severity band may be forwarded with a
+//:   probability, set by 'setSamplingProbability', before the limits are
+//:   applied.
+//
+// A token bucket having a rate of 'R' records per second and a burst size of
+// 'B' admits a record if fewer than 'B' records would have been admitted in
+// any interval of 'B / R' seconds; i.e., it admits bursts of up to 'B'
+// records, and a sustained rate of 'R' records per second.  A record is
+// forwarded only if both the bucket of its severity band and the bucket of
+// its category admit it; a record that is rejected by either bucket does not
+// consume a token of the other.
+//
+// Records that are not forwarded are said to be *suppressed*.  The number of
+// records suppressed for each category is counted and reported by a summary
+// record published to the inner observer.  Summary records are published
+// lazily: the summary of a category is published just before the next record
+// of that category is forwarded, or by 'publishSummaries', which publishes
+// the summaries of all categories.  'releaseRecords' (called, e.g., when the
+// observer is deregistered from a 'ball::BroadcastObserver') calls
+// 'publishSummaries'.  An application in which a category may stop logging
+// after some of its records were suppressed can call 'publishSummaries'
+// periodically (e.g., using a 'bdlmt::EventScheduler') so that those records
+// are reported without waiting for the next record of the category.
+//
+// The summary record has the category of the suppressed records (an empty
+// category for the records of untracked categories, see {Category
+// Tracking}), the most severe of their severities, and the time, process,
+// and thread of its publication.  Its message reads:
+//..
+//  <N> log record(s) suppressed by rate limiting
+//..
+// Note that 'publish' reads the severity and category of a record through
+// accessors that do not format its deferred message (see 'ball_record'), so
+// that deferred formatting is preserved for the inner observer (e.g., a
+// 'ball::AsyncFileObserver'), and suppressed records are never formatted.
+// Records published due to a trigger event (i.e., whose publication context
+// has a transmission cause other than 'ball::Transmission::e_PASSTHROUGH')
+// are always forwarded, as they are typically a small set of records stored
+// to explain an error.
+//
+///Category Tracking
+///- - - - - - - - -
+// Per-category state is kept for at most the 'maxNumCategories' categories
+// (specified at construction) first seen by the observer.  Records of any
+// other category share the state of a single "overflow" category.
+//
+///Thread Safety
+///-------------
+// 'ball::RateLimitingObserver' is *thread-safe*, meaning that any operation on
+// the same instance can be safely invoked from any thread concurrently with
+// any other operation.  Deciding whether to forward a record does not acquire
+// a lock: the token buckets, sampling state, and the per-category table are
+// updated using atomic operations only.  Note that publishing a summary record
+// allocates memory.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Bounding the Rate of Records Reaching an Observer
+/// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+// In this example we bound the number of records that a noisy category can
+// send to an observer.
+//
+// First, we create the observer that will receive the forwarded log records,
+// and a rate-limiting observer that wraps it:
+//..
+//  bsl::shared_ptr<ball::TestObserver> innerObserver(
+//                                         new ball::TestObserver(&bsl::cout));
+//
+//  ball::RateLimitingObserver rateLimitingObserver(innerObserver);
+//..
+// Then, we limit each category to a burst of 3 records, replenished at a
+// rate of 1 record every 1000 seconds (i.e., effectively never, in this
+// example):
+//..
+//  rateLimitingObserver.setCategoryLimit(0.001, 3);
+//..
+// Next, we publish 10 records of the category "NOISY":
+//..
+//  const ball::Context context(ball::Transmission::e_PASSTHROUGH, 0, 1);
+//
+//  ball::RecordAttributes fixedFields;
+//  fixedFields.setCategory("NOISY");
+//  fixedFields.setSeverity(ball::Severity::e_INFO);
+//
+//  bsl::shared_ptr<ball::Record> record;
+//  record.createInplace();
+//  record->setFixedFields(fixedFields);
+//
+//  for (int i = 0; i < 10; ++i) {
+//      rateLimitingObserver.publish(record, context);
+//  }
+//
+//  assert(3 == innerObserver->numPublishedRecords());
+//  assert(7 == rateLimitingObserver.numSuppressed());
+//..
+// Finally, we publish a record of another category, which has a budget of its
+// own:
+//..
+//  fixedFields.setCategory("QUIET");
+//  record->setFixedFields(fixedFields);
+//  rateLimitingObserver.publish(record, context);
+//
+//  assert(4 == innerObserver->numPublishedRecords());
+//..
+
+#include <balscm_version.h>
+
+#include <ball_observer.h>
+#include <ball_severity.h>
+
+#include <bslma_allocator.h>
+#include <bslma_usesbslmaallocator.h>
+
+#include <bslmf_nestedtraitdeclaration.h>
+
+#include <bsls_assert.h>
+#include <bsls_atomic.h>
+#include <bsls_review.h>
+#include <bsls_types.h>
+
+#include <bsl_memory.h>
+
+namespace BloombergLP {
+namespace ball {
+
+class Context;
+class Record;
+class RateLimitingObserver_CategoryEntry;
+
+                    // =================================
+                    // class RateLimitingObserver_Bucket
+                    // =================================
+
+class RateLimitingObserver_Bucket {
+    // This component-private class implements a token bucket, as a "generic
+    // cell rate algorithm" whose state is a single atomic "theoretical arrival
+    // time".  A bucket having a zero interval admits every request.
+
+    // DATA
+    bsls::AtomicInt64 d_interval;      // nanoseconds per token, or 0 if
+                                       // unlimited
+
+    bsls::AtomicInt64 d_tolerance;     // burst size times 'd_interval'
+
+    bsls::AtomicInt64 d_arrivalTime;   // theoretical arrival time of the next
+                                       // request, in nanoseconds
+
+    // NOT IMPLEMENTED
+    RateLimitingObserver_Bucket(const RateLimitingObserver_Bucket&);
+    RateLimitingObserver_Bucket& operator=(
+                                          const RateLimitingObserver_Bucket&);
+
+  public:
+    // CREATORS
+    RateLimitingObserver_Bucket();
+        // Create a bucket that admits every request.
+
+    // MANIPULATORS
+    bool tryAcquire(bsls::Types::Int64 now);
+        // Return 'true' if a request made at the specified 'now' time (in
+        // nanoseconds, on a monotonic clock) is admitted by this bucket, and
+        // 'false' otherwise.
+
+    void release();
+        // Return to this bucket a request admitted by 'tryAcquire', so that
+        // the request does not count against the limit of this bucket.  The
+        // behavior is undefined unless each call to 'release' matches a call
+        // to 'tryAcquire' that returned 'true' since the limit was last set.
+
+    void setLimit(bsls::Types::Int64 interval, int burstSize);
+        // Set this bucket to admit bursts of at most the specified
+        // 'burstSize' requests, at a sustained rate of one request per the
+        // specified 'interval' nanoseconds, and refill this bucket.  If
+        // 'interval' is 0, this bucket admits every request.  The behavior is
+        // undefined unless '0 <= interval' and '0 < burstSize'.
+
+    // ACCESSORS
+    bool isLimited() const;
+        // Return 'true' if this bucket can reject a request, and 'false'
+        // otherwise.
+};
+
+                        // ==========================
+                        // class RateLimitingObserver
+                        // ==========================
+
+class RateLimitingObserver : public Observer {
+    // This class provides a concrete implementation of the 'Observer' protocol
+    // that forwards the records passed to its 'publish' method to an observer
+    // supplied at construction, subject to per-severity and per-category
+    // token buckets, and to per-severity sampling, and that publishes summary
+    // records reporting the number of suppressed records.
+
+  public:
+    // PUBLIC CONSTANTS
+    enum {
+        k_DEFAULT_MAX_NUM_CATEGORIES = 1024  // default number of categories
+                                             // tracked individually
+    };
+
+  private:
+    // PRIVATE CONSTANTS
+    enum {
+        k_NUM_SEVERITY_BANDS = 8  // number of severity bands ('0 .. 255')
+    };
+
+    // PRIVATE TYPES
+    typedef RateLimitingObserver_Bucket        Bucket;
+    typedef RateLimitingObserver_CategoryEntry CategoryEntry;
+
+    // DATA
+    bsl::shared_ptr<Observer>  d_innerObserver;     // inner observer
+
+    Bucket                     d_severityBuckets[k_NUM_SEVERITY_BANDS];
+                                                    // per-severity limits
+
+    bsls::AtomicUint64         d_samplingThresholds[k_NUM_SEVERITY_BANDS];
+                                                    // per-severity sampling
+                                                    // thresholds, where 0
+                                                    // means "always forward"
+
+    bsls::AtomicUint64         d_samplingCounter;   // seed of the sampling
+                                                    // sequence
+
+    bsls::AtomicInt64          d_categoryInterval;  // per-category
+                                                    // nanoseconds per token,
+                                                    // or 0 if unlimited
+
+    bsls::AtomicInt            d_categoryBurstSize; // per-category burst size
+
+    bsls::AtomicInt            d_categoryLimitGeneration;
+                                                    // incremented each time
+                                                    // the per-category limit
+                                                    // is set
+
+    bsls::AtomicPointer<CategoryEntry>
+                              *d_categoryTable_p;   // per-category state
+                                                    // (owned)
+
+    int                        d_categoryTableSize; // number of slots of
+                                                    // 'd_categoryTable_p'
+
+    int                        d_maxNumCategories;  // maximum number of
+                                                    // categories tracked
+
+    bsls::AtomicInt            d_numCategories;     // number of categories
+                                                    // tracked
+
+    CategoryEntry             *d_overflowEntry_p;   // state shared by
+                                                    // untracked categories
+                                                    // (owned)
+
+    bsls::AtomicInt64          d_numForwarded;      // number of records
+                                                    // forwarded
+
+    bsls::AtomicInt64          d_numSuppressed;     // number of records
+                                                    // suppressed
+
+    bsls::AtomicInt64          d_numUnreported;     // number of suppressed
+                                                    // records not yet
+                                                    // reported by a summary
+                                                    // record
+
+    bslma::Allocator          *d_allocator_p;       // memory allocator (held,
+                                                    // not owned)
+
+    // NOT IMPLEMENTED
+    RateLimitingObserver(const RateLimitingObserver&);
+    RateLimitingObserver& operator=(const RateLimitingObserver&);
+
+    // PRIVATE CLASS METHODS
+    static int severityBand(int severity);
+        // Return the index of the severity band of the specified 'severity'.
+
+    static bsls::Types::Int64 toInterval(double recordsPerSecond);
+        // Return the number of nanoseconds per record corresponding to the
+        // specified 'recordsPerSecond', or 0 if 'recordsPerSecond' is 0.
+
+    // PRIVATE MANIPULATORS
+    void initialize();
+        // Allocate the per-category state table and the overflow state of
+        // this observer.  This method is called only by the constructors.
+
+    CategoryEntry *lookupEntry(const char *category);
+        // Return the address of the state of the specified 'category',
+        // creating that state if 'category' is not yet tracked and fewer
+        // than 'maxNumCategories' categories are tracked, and the address of
+        // the overflow state otherwise.
+
+    bool isSampled(int band);
+        // Return 'true' if a record in the specified severity 'band' is
+        // selected by sampling, and 'false' otherwise.
+
+    void publishSummary(CategoryEntry *entry, const Context& context);
+        // Publish to the inner observer, in the specified 'context', a
+        // summary record reporting the records of the specified 'entry'
+        // suppressed since its last summary, if any, and reset the count of
+        // those records.
+
+  public:
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(RateLimitingObserver,
+                                   bslma::UsesBslmaAllocator);
+
+    // CREATORS
+    explicit RateLimitingObserver(
+                         const bsl::shared_ptr<Observer>&  observer,
+                         bslma::Allocator                 *basicAllocator = 0);
+    RateLimitingObserver(const bsl::shared_ptr<Observer>&  observer,
+                         int                               maxNumCategories,
+                         bslma::Allocator                 *basicAllocator = 0);
+        // Create a rate-limiting observer that forwards log records to the
+        // specified 'observer', initially without any limit.  Optionally
+        // specify 'maxNumCategories', the maximum number of categories whose
+        // state is tracked individually (see {Category Tracking}).  If
+        // 'maxNumCategories' is not specified,
+        // 'k_DEFAULT_MAX_NUM_CATEGORIES' is used.  Optionally specify a
+        // 'basicAllocator' used to supply memory.  If 'basicAllocator' is 0,
+        // the currently installed default allocator is used.  The behavior is
+        // undefined unless 'observer' is not 0, '0 < maxNumCategories', and
+        // no cycle is created among observers.
+
+    virtual ~RateLimitingObserver();
+        // Destroy this rate-limiting observer.  Note that summary records
+        // that are pending are not published (see 'releaseRecords').
+
+    // MANIPULATORS
+    using Observer::publish;
+
+    virtual void publish(const bsl::shared_ptr<const Record>& record,
+                         const Context&                       context);
+        // Process the specified log 'record' having the specified publishing
+        // 'context'.  Forward 'record' and 'context' to the 'publish' method
+        // of the observer supplied at construction if 'record' is selected by
+        // sampling and admitted by the applicable limits, or if 'context'
+        // indicates that 'record' is published due to a trigger event, and
+        // suppress 'record' otherwise.  If 'record' is forwarded and records
+        // of its category were suppressed since a record of that category was
+        // last forwarded, first publish a summary record.  The behavior is
+        // undefined if 'record' or 'context' is modified during the execution
+        // of this method.
+
+    void publishSummaries();
+        // Publish to the inner observer a summary record for each category
+        // having records suppressed since its last summary record.
+
+    virtual void releaseRecords();
+        // Discard any shared reference to a 'Record' object that was supplied
+        // to the 'publish' method, and is held by this observer, and publish
+        // the pending summary records (see 'publishSummaries').  Note that
+        // this operation should be called if resources underlying the
+        // previously provided shared-pointers must be released.
+
+    void setCategoryLimit(double recordsPerSecond, int burstSize);
+        // Limit the records of each category to bursts of at most the
+        // specified 'burstSize' records, at a sustained rate of the specified
+        // 'recordsPerSecond' records per second, and refill the token bucket
+        // of each category.  If 'recordsPerSecond' is 0, remove the
+        // per-category limit.  The behavior is undefined unless
+        // '0 <= recordsPerSecond' and '0 < burstSize'.
+
+    void setSamplingProbability(Severity::Level severity, double probability);
+        // Forward the records in the severity band of the specified
+        // 'severity' with the specified 'probability'.  The behavior is
+        // undefined unless '0.0 <= probability <= 1.0'.  Note that a
+        // 'probability' of 1.0 disables sampling for the band, and that a
+        // 'probability' so small that '1.0 - probability == 1.0' (i.e., less
+        // than about 1.1e-16) is treated as 0.0.
+
+    void setSeverityLimit(Severity::Level severity,
+                          double          recordsPerSecond,
+                          int             burstSize);
+        // Limit the records in the severity band of the specified 'severity'
+        // to bursts of at most the specified 'burstSize' records, at a
+        // sustained rate of the specified 'recordsPerSecond' records per
+        // second, and refill the token bucket of that band.  If
+        // 'recordsPerSecond' is 0, remove the limit of the band.  The
+        // behavior is undefined unless '0 <= recordsPerSecond' and
+        // '0 < burstSize'.
+
+    // ACCESSORS
+    int maxNumCategories() const;
+        // Return the maximum number of categories whose state is tracked
+        // individually by this observer.
+
+    int numCategories() const;
+        // Return the number of categories whose state is tracked individually
+        // by this observer.
+
+    bsls::Types::Int64 numForwarded() const;
+        // Return the number of records forwarded to the inner observer by
+        // this observer, not including summary records.
+
+    bsls::Types::Int64 numSuppressed() const;
+        // Return the number of records suppressed by this observer.
+};
+
+// ============================================================================
+//                              INLINE DEFINITIONS
+// ============================================================================
+
+                    // ---------------------------------
+                    // class RateLimitingObserver_Bucket
+                    // ---------------------------------
+
+// CREATORS
+inline
+RateLimitingObserver_Bucket::RateLimitingObserver_Bucket()
+: d_interval(0)
+, d_tolerance(0)
+, d_arrivalTime(0)
+{
+}
+
+// ACCESSORS
+inline
+bool RateLimitingObserver_Bucket::isLimited() const
+{
+    return 0 != d_interval.loadRelaxed();
+}
+
+                        // --------------------------
+                        // class RateLimitingObserver
+                        // --------------------------
+
+// PRIVATE CLASS METHODS
+inline
+int RateLimitingObserver::severityBand(int severity)
+{
+    const int band = (severity + 31) >> 5;
+    return band < k_NUM_SEVERITY_BANDS ? band : k_NUM_SEVERITY_BANDS - 1;
+}
+
+// ACCESSORS
+inline
+int RateLimitingObserver::maxNumCategories() const
+{
+    return d_maxNumCategories;
+}
+
+inline
+int RateLimitingObserver::numCategories() const
+{
+    return d_numCategories.loadRelaxed();
+}
+
+inline
+bsls::Types::Int64 RateLimitingObserver::numForwarded() const
+{
+    return d_numForwarded.loadRelaxed();
+}
+
+inline
+bsls::Types::Int64 RateLimitingObserver::numSuppressed() const
+{
+    return d_numSuppressed.loadRelaxed();
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,1205 @@
+// ball_ratelimitingobserver.t.cpp                                    -*-C++-*-
+#include <ball_ratelimitingobserver.h>
+
+#include <ball_context.h>
+#include <ball_record.h>
+#include <ball_recordattributes.h>
+#include <ball_severity.h>
+#include <ball_testobserver.h>
+#include <ball_transmission.h>
+
+#include <bslim_testutil.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+
+#include <bslmt_barrier.h>
+#include <bslmt_threadutil.h>
+
+#include <bsls_asserttest.h>
+#include <bsls_atomic.h>
+#include <bsls_platform.h>
+#include <bsls_review.h>
+#include <bsls_timeinterval.h>
+#include <bsls_types.h>
+
+#include <bsl_cstdio.h>      // sprintf()
+#include <bsl_cstdlib.h>     // atoi(), strtol()
+#include <bsl_cstring.h>     // strcmp()
+#include <bsl_iostream.h>
+#include <bsl_memory.h>
+#include <bsl_sstream.h>
+#include <bsl_string.h>
+#include <bsl_vector.h>
+
+// Note: on Windows -> WinGDI.h:#define PASSTHROUGH 19
+#if defined(BSLS_PLATFORM_CMP_MSVC) && defined(PASSTHROUGH)
+#undef PASSTHROUGH
+#endif
+
+using namespace BloombergLP;
+using namespace bsl;
+
+//=============================================================================
+//                             TEST PLAN
+//-----------------------------------------------------------------------------
+//                              Overview
+//                              --------
+// The component under test is an observer that forwards log records to an
+// inner observer subject to token buckets and sampling.  We verify each of
+// the three mechanisms in isolation using rates low enough that no token is
+// replenished while a test runs (so that the results are deterministic), and
+// then verify replenishment using a high rate and a short sleep.  We use a
+// counting observer, rather than 'ball::TestObserver', as the inner observer
+// when the content of the forwarded records must be examined.
+//-----------------------------------------------------------------------------
+// CREATORS
+// [ 2] RateLimitingObserver(observer, basicAllocator = 0);
+// [ 3] RateLimitingObserver(observer, maxNumCategories, basicAllocator = 0);
+// [ 2] virtual ~RateLimitingObserver();
+//
+// MANIPULATORS
+// [ 2] virtual void publish(const shared_ptr<const Record>&, Context&);
+// [ 5] void publishSummaries();
+// [ 2] virtual void releaseRecords();
+// [ 3] void setCategoryLimit(double recordsPerSecond, int burstSize);
+// [ 4] void setSamplingProbability(Severity::Level, double probability);
+// [ 2] void setSeverityLimit(Severity::Level, double, int burstSize);
+//
+// ACCESSORS
+// [ 3] int maxNumCategories() const;
+// [ 3] int numCategories() const;
+// [ 2] bsls::Types::Int64 numForwarded() const;
+// [ 2] bsls::Types::Int64 numSuppressed() const;
+//-----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 5] CONCERN: SUPPRESSED RECORDS ARE SUMMARIZED
+// [ 5] CONCERN: TRIGGERED RECORDS ARE ALWAYS FORWARDED
+// [ 6] CONCURRENCY TEST
+// [ 7] USAGE EXAMPLE
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLIM_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLIM_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLIM_TESTUTIL_LOOP6_ASSERT
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_SAFE_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_PASS(EXPR)
+#define ASSERT_SAFE_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_FAIL(EXPR)
+#define ASSERT_PASS(EXPR)      BSLS_ASSERTTEST_ASSERT_PASS(EXPR)
+#define ASSERT_FAIL(EXPR)      BSLS_ASSERTTEST_ASSERT_FAIL(EXPR)
+#define ASSERT_OPT_PASS(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_PASS(EXPR)
+#define ASSERT_OPT_FAIL(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_FAIL(EXPR)
+
+//=============================================================================
+//                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+//-----------------------------------------------------------------------------
+
+typedef ball::RateLimitingObserver Obj;
+typedef bsls::Types::Int64         Int64;
+
+const ball::Context PASSTHROUGH(ball::Transmission::e_PASSTHROUGH, 0, 1);
+const ball::Context TRIGGER(ball::Transmission::e_TRIGGER, 0, 1);
+
+const double NEVER = 1e-6;  // rate at which tokens are (effectively) never
+                            // replenished while a test runs
+
+//=============================================================================
+//                  GLOBAL HELPER FUNCTIONS FOR TESTING
+//-----------------------------------------------------------------------------
+
+namespace {
+
+class CountingObserver : public ball::Observer {
+    // This class provides an observer that counts the records it receives,
+    // distinguishing summary records, and that records the message of the
+    // last summary record received.
+
+    // DATA
+    bsls::AtomicInt64 d_numRecords;    // number of records, excluding
+                                       // summaries
+
+    bsls::AtomicInt64 d_numSummaries;  // number of summary records
+
+    bsls::AtomicInt64 d_numReported;   // sum of the counts reported by
+                                       // summary records
+
+    bsl::string       d_lastSummary;   // message of the last summary record
+                                       // (not thread-safe)
+
+    bsl::string       d_lastCategory;  // category of the last summary record
+                                       // (not thread-safe)
+
+    int               d_lastSeverity;  // severity of the last summary record
+
+  public:
+    // CREATORS
+    CountingObserver()
+    : d_numRecords(0)
+    , d_numSummaries(0)
+    , d_numReported(0)
+    , d_lastSeverity(-1)
+    {
+    }
+
+    // MANIPULATORS
+    using Observer::publish;
+
+    virtual void publish(const bsl::shared_ptr<const ball::Record>& record,
+                         const ball::Context&)
+    {
+        static const char SUFFIX[] =
+                                " log record(s) suppressed by rate limiting";
+
+        const char *message = record->fixedFields().message();
+        char       *end;
+        const long  count   = bsl::strtol(message, &end, 10);
+
+        if (end != message && 0 == bsl::strcmp(end, SUFFIX)) {
+            ++d_numSummaries;
+            d_numReported += count;
+            d_lastSummary  = message;
+            d_lastCategory = record->fixedFields().category();
+            d_lastSeverity = record->fixedFields().severity();
+        }
+        else {
+            ++d_numRecords;
+        }
+    }
+
+    // ACCESSORS
+    const bsl::string& lastSummary() const
+    {
+        return d_lastSummary;
+    }
+
+    const bsl::string& lastSummaryCategory() const
+    {
+        return d_lastCategory;
+    }
+
+    int lastSummarySeverity() const
+    {
+        return d_lastSeverity;
+    }
+
+    Int64 numRecords() const
+    {
+        return d_numRecords;
+    }
+
+    Int64 numReported() const
+    {
+        return d_numReported;
+    }
+
+    Int64 numSummaries() const
+    {
+        return d_numSummaries;
+    }
+};
+
+class RetainingObserver : public ball::Observer {
+    // This class provides an observer that counts the records it receives,
+    // and retains the last of them, without accessing them.
+
+    // DATA
+    int                                 d_numRecords;  // number of records
+    bsl::shared_ptr<const ball::Record> d_last;        // last record
+
+  public:
+    // CREATORS
+    RetainingObserver()
+    : d_numRecords(0)
+    {
+    }
+
+    // MANIPULATORS
+    using Observer::publish;
+
+    virtual void publish(const bsl::shared_ptr<const ball::Record>& record,
+                         const ball::Context&)
+    {
+        ++d_numRecords;
+        d_last = record;
+    }
+
+    // ACCESSORS
+    const bsl::shared_ptr<const ball::Record>& lastRecord() const
+    {
+        return d_last;
+    }
+
+    int numRecords() const
+    {
+        return d_numRecords;
+    }
+};
+
+bsl::shared_ptr<ball::Record> makeDeferredRecord(const char *category,
+                                                 int         severity)
+    // Return a record having the specified 'category' and 'severity', and a
+    // pending deferred message.
+{
+    bsl::shared_ptr<ball::Record> record;
+    record.createInplace();
+
+    record->fixedFields().setCategory(category);
+    record->fixedFields().setSeverity(severity);
+    record->deferredMessage().setFormat("deferred %d");
+    record->deferredMessage().appendArgument(severity);
+
+    return record;
+}
+
+bsl::shared_ptr<ball::Record> makeRecord(const char *category,
+                                         int         severity,
+                                         const char *message = "message")
+    // Return a record having the specified 'category', 'severity', and
+    // optionally specified 'message'.
+{
+    bsl::shared_ptr<ball::Record> record;
+    record.createInplace();
+
+    record->fixedFields().setCategory(category);
+    record->fixedFields().setSeverity(severity);
+    record->fixedFields().setMessage(message);
+
+    return record;
+}
+
+int publishN(Obj                                  *observer,
+             const bsl::shared_ptr<ball::Record>&  record,
+             int                                   n,
+             const ball::Context&                  context = PASSTHROUGH)
+    // Publish the specified 'record' the specified 'n' times to the specified
+    // 'observer' in the optionally specified 'context', and return the number
+    // of those records forwarded by 'observer'.
+{
+    const Int64 before = observer->numForwarded();
+    for (int i = 0; i < n; ++i) {
+        observer->publish(record, context);
+    }
+    return static_cast<int>(observer->numForwarded() - before);
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                         CASE 6 RELATED ENTITIES
+// ----------------------------------------------------------------------------
+
+namespace BALL_RATELIMITINGOBSERVER_CONCURRENCY {
+
+enum {
+    k_NUM_THREADS         = 8,
+    k_NUM_CATEGORIES      = 16,
+    k_RECORDS_PER_THREAD  = 20000
+};
+
+struct ThreadArgs {
+    Obj            *d_observer_p;  // observer under test
+    int             d_id;          // thread index
+    bslmt::Barrier *d_barrier_p;   // start barrier
+};
+
+extern "C" void *workerThread(void *arg)
+{
+    ThreadArgs *args = static_cast<ThreadArgs *>(arg);
+
+    bsl::vector<bsl::shared_ptr<ball::Record> > records;
+    for (int i = 0; i < k_NUM_CATEGORIES; ++i) {
+        char name[32];
+        bsl::sprintf(name, "CATEGORY.%d", i);
+        records.push_back(makeRecord(name, ball::Severity::e_INFO));
+    }
+
+    args->d_barrier_p->wait();
+
+    for (int i = 0; i < k_RECORDS_PER_THREAD; ++i) {
+        args->d_observer_p->publish(
+                           records[(i + args->d_id) % k_NUM_CATEGORIES],
+                           PASSTHROUGH);
+    }
+    return 0;
+}
+
+}  // close namespace BALL_RATELIMITINGOBSERVER_CONCURRENCY
+
+//=============================================================================
+//                              MAIN PROGRAM
+//-----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    const int  test                = argc > 1 ? atoi(argv[1]) : 0;
+    const bool verbose             = argc > 2;
+    const bool veryVerbose         = argc > 3;
+    const bool veryVeryVerbose     = argc > 4;
+    const bool veryVeryVeryVerbose = argc > 5;
+
+    (void) veryVerbose;      // Suppress compiler warning.
+    (void) veryVeryVerbose;
+    (void) veryVeryVeryVerbose;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;;
+
+    // CONCERN: 'BSLS_REVIEW' failures should lead to test failures.
+    bsls::ReviewFailureHandlerGuard reviewGuard(&bsls::Review::failByAbort);
+
+    switch (test) { case 0:  // Zero is always the leading case.
+      case 7: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nUSAGE EXAMPLE"
+                          << "\n=============" << endl;
+
+        bsl::ostringstream output;
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Bounding the Rate of Records Reaching an Observer
+/// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+// In this example we bound the number of records that a noisy category can
+// send to an observer.
+//
+// First, we create the observer that will receive the forwarded log records,
+// and a rate-limiting observer that wraps it:
+//..
+    bsl::shared_ptr<ball::TestObserver> innerObserver(
+                                             new ball::TestObserver(&output));
+
+    ball::RateLimitingObserver rateLimitingObserver(innerObserver);
+//..
+// Then, we limit each category to a burst of 3 records, replenished at a
+// rate of 1 record every 1000 seconds (i.e., effectively never, in this
+// example):
+//..
+    rateLimitingObserver.setCategoryLimit(0.001, 3);
+//..
+// Next, we publish 10 records of the category "NOISY":
+//..
+    const ball::Context context(ball::Transmission::e_PASSTHROUGH, 0, 1);
+
+    ball::RecordAttributes fixedFields;
+    fixedFields.setCategory("NOISY");
+    fixedFields.setSeverity(ball::Severity::e_INFO);
+
+    bsl::shared_ptr<ball::Record> record;
+    record.createInplace();
+    record->setFixedFields(fixedFields);
+
+    for (int i = 0; i < 10; ++i) {
+        rateLimitingObserver.publish(record, context);
+    }
+
+    ASSERT(3 == innerObserver->numPublishedRecords());
+    ASSERT(7 == rateLimitingObserver.numSuppressed());
+//..
+// Finally, we publish a record of another category, which has a budget of its
+// own:
+//..
+    fixedFields.setCategory("QUIET");
+    record->setFixedFields(fixedFields);
+    rateLimitingObserver.publish(record, context);
+
+    ASSERT(4 == innerObserver->numPublishedRecords());
+//..
+      } break;
+      case 6: {
+        // --------------------------------------------------------------------
+        // CONCURRENCY TEST
+        //
+        // Concerns:
+        //: 1 Records published concurrently from several threads are each
+        //:   either forwarded or suppressed, and every suppressed record is
+        //:   eventually reported by a summary record.
+        //:
+        //: 2 No more records of a category are forwarded than its bucket
+        //:   admits, when published concurrently.
+        //:
+        //: 3 Concurrent first use of categories creates exactly one entry per
+        //:   category.
+        //
+        // Plan:
+        //: 1 Configure a per-category limit that is never replenished, and
+        //:   have several threads publish records of a set of categories
+        //:   concurrently.  Verify that, for each category, exactly the burst
+        //:   size of records is forwarded, that the counts are consistent,
+        //:   and that the number of tracked categories is as expected.
+        //:   (C-1..3)
+        //:
+        //: 2 Remove the limit and publish one more record of each category;
+        //:   verify that summary records report all suppressed records.
+        //:   (C-1)
+        //
+        // Testing:
+        //   CONCURRENCY TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nCONCURRENCY TEST"
+                          << "\n================" << endl;
+
+        using namespace BALL_RATELIMITINGOBSERVER_CONCURRENCY;
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+        const int BURST = 100;
+
+        bsl::shared_ptr<CountingObserver> inner =
+                                        bsl::make_shared<CountingObserver>();
+        Obj mX(inner, &oa);  const Obj& X = mX;
+
+        mX.setCategoryLimit(NEVER, BURST);
+
+        bslmt::Barrier             barrier(k_NUM_THREADS);
+        bslmt::ThreadUtil::Handle  handles[k_NUM_THREADS];
+        ThreadArgs                 args[k_NUM_THREADS];
+
+        for (int i = 0; i < k_NUM_THREADS; ++i) {
+            args[i].d_observer_p = &mX;
+            args[i].d_id         = i;
+            args[i].d_barrier_p  = &barrier;
+            ASSERT(0 == bslmt::ThreadUtil::create(&handles[i],
+                                                  workerThread,
+                                                  &args[i]));
+        }
+        for (int i = 0; i < k_NUM_THREADS; ++i) {
+            ASSERT(0 == bslmt::ThreadUtil::join(handles[i]));
+        }
+
+        const Int64 TOTAL = k_NUM_THREADS * k_RECORDS_PER_THREAD;
+
+        ASSERTV(X.numCategories(), k_NUM_CATEGORIES == X.numCategories());
+        ASSERTV(X.numForwarded(),
+                k_NUM_CATEGORIES * BURST == X.numForwarded());
+        ASSERTV(X.numSuppressed(),
+                TOTAL - k_NUM_CATEGORIES * BURST == X.numSuppressed());
+        ASSERTV(inner->numRecords(), X.numForwarded() == inner->numRecords());
+        ASSERTV(inner->numSummaries(), 0 == inner->numSummaries());
+
+        mX.setCategoryLimit(0, 1);
+
+        for (int i = 0; i < k_NUM_CATEGORIES; ++i) {
+            char name[32];
+            bsl::sprintf(name, "CATEGORY.%d", i);
+            mX.publish(makeRecord(name, ball::Severity::e_INFO), PASSTHROUGH);
+        }
+
+        ASSERTV(inner->numSummaries(),
+                k_NUM_CATEGORIES == inner->numSummaries());
+        ASSERTV(inner->numReported(),
+                X.numSuppressed() == inner->numReported());
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // SUMMARY RECORDS AND TRIGGERED RECORDS
+        //
+        // Concerns:
+        //: 1 When a record of a category having suppressed records is
+        //:   forwarded, it is preceded by exactly one summary record that
+        //:   reports the number of records suppressed, and that has the
+        //:   category, and the most severe severity, of those records.
+        //:
+        //: 2 The suppressed count of a category is reset once reported.
+        //:
+        //: 3 A summary record is published even after all limits are
+        //:   removed.
+        //:
+        //: 4 Records published due to a trigger event are always forwarded,
+        //:   and do not consume tokens.
+        //:
+        //: 5 The summary of a category is not published when records of
+        //:   other categories are forwarded.
+        //:
+        //: 6 'publishSummaries' publishes one summary record for each
+        //:   category having suppressed records, including the categories
+        //:   sharing the overflow state, and no summary record for the other
+        //:   categories.
+        //
+        // Plan:
+        //: 1 Using a per-category limit, suppress records of one category,
+        //:   and then refill the bucket by setting the limit again and
+        //:   publish one more record.  Verify the summary record.  Repeat
+        //:   with suppressed records of several severities.  (C-1..2)
+        //:
+        //: 2 Suppress more records, remove the limit, and publish a record.
+        //:   Verify that the summary record is published.  (C-3)
+        //:
+        //: 3 Publish records in a trigger context with an exhausted bucket;
+        //:   verify that they are all forwarded.  (C-4)
+        //:
+        //: 4 Using an observer tracking two categories, suppress records of
+        //:   a tracked and of an untracked category, and forward records of
+        //:   the other tracked category.  Verify that no summary record is
+        //:   published until 'publishSummaries' is called, that it then
+        //:   publishes the two summary records, and that calling it again
+        //:   publishes nothing.  (C-5..6)
+        //
+        // Testing:
+        //   void publishSummaries();
+        //   CONCERN: SUPPRESSED RECORDS ARE SUMMARIZED
+        //   CONCERN: TRIGGERED RECORDS ARE ALWAYS FORWARDED
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nSUMMARY RECORDS AND TRIGGERED RECORDS"
+                          << "\n=====================================" << endl;
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+        bsl::shared_ptr<CountingObserver> inner =
+                                        bsl::make_shared<CountingObserver>();
+        Obj mX(inner, &oa);  const Obj& X = mX;
+
+        bsl::shared_ptr<ball::Record> a = makeRecord("A", 128);
+        bsl::shared_ptr<ball::Record> b = makeRecord("B", 128);
+
+        if (verbose) cout << "\tSummary of suppressed records." << endl;
+        {
+            mX.setCategoryLimit(NEVER, 2);
+
+            ASSERT(2 == publishN(&mX, a, 7));
+            ASSERT(1 == publishN(&mX, b, 1));
+            ASSERT(0 == inner->numSummaries());
+            ASSERT(5 == X.numSuppressed());
+
+            mX.setCategoryLimit(NEVER, 2);    // refill
+
+            ASSERT(1 == publishN(&mX, b, 1));
+            ASSERT(0 == inner->numSummaries());
+
+            ASSERT(1 == publishN(&mX, a, 1));
+            ASSERT(1 == inner->numSummaries());
+            ASSERT(5 == inner->numReported());
+            ASSERTV(inner->lastSummary(),
+                    "5 log record(s) suppressed by rate limiting" ==
+                                                         inner->lastSummary());
+            ASSERT("A" == inner->lastSummaryCategory());
+            ASSERT(128 == inner->lastSummarySeverity());
+
+            ASSERT(1 == publishN(&mX, a, 1));
+            ASSERT(1 == inner->numSummaries());
+        }
+
+        if (verbose) cout << "\tSeverity of the summary record." << endl;
+        {
+            bsl::shared_ptr<CountingObserver> innerY =
+                                        bsl::make_shared<CountingObserver>();
+            Obj mY(innerY, &oa);
+
+            mY.setCategoryLimit(NEVER, 1);
+
+            ASSERT(1 == publishN(&mY, makeRecord("M", 128), 1));
+            ASSERT(0 == publishN(&mY, makeRecord("M", 160), 1));
+            ASSERT(0 == publishN(&mY, makeRecord("M",  96), 1));
+            ASSERT(0 == publishN(&mY, makeRecord("M", 128), 1));
+
+            mY.setCategoryLimit(NEVER, 1);    // refill
+
+            ASSERT(1 == publishN(&mY, makeRecord("M", 160), 1));
+            ASSERT(1 == innerY->numSummaries());
+            ASSERT(3 == innerY->numReported());
+            ASSERT("M" == innerY->lastSummaryCategory());
+            ASSERTV(innerY->lastSummarySeverity(),
+                    96 == innerY->lastSummarySeverity());
+        }
+
+        if (verbose) cout << "\tSummary after removing limits." << endl;
+        {
+            ASSERT(0 == publishN(&mX, a, 3));
+            ASSERT(8 == X.numSuppressed());
+
+            mX.setCategoryLimit(0, 1);
+
+            ASSERT(1 == publishN(&mX, a, 1));
+            ASSERT(2 == inner->numSummaries());
+            ASSERT(8 == inner->numReported());
+
+            ASSERT(1 == publishN(&mX, a, 1));
+            ASSERT(2 == inner->numSummaries());
+        }
+
+        if (verbose) cout << "\tTriggered records." << endl;
+        {
+            mX.setCategoryLimit(NEVER, 1);
+            mX.setSamplingProbability(ball::Severity::e_INFO, 0.0);
+
+            const Int64 before = inner->numRecords();
+
+            ASSERT(5 == publishN(&mX, a, 5, TRIGGER));
+            ASSERT(before + 5 == inner->numRecords());
+            ASSERT(8 == X.numSuppressed());
+
+            mX.setSamplingProbability(ball::Severity::e_INFO, 1.0);
+
+            ASSERT(1 == publishN(&mX, a, 2));  // token was not consumed
+        }
+
+        if (verbose) cout << "\tLazy summaries and 'publishSummaries'."
+                          << endl;
+        {
+            bsl::shared_ptr<CountingObserver> innerZ =
+                                        bsl::make_shared<CountingObserver>();
+            Obj mZ(innerZ, 2, &oa);  const Obj& Z = mZ;
+
+            mZ.setCategoryLimit(NEVER, 1);
+
+            ASSERT(1 == publishN(&mZ, makeRecord("P", 128), 4));
+            ASSERT(1 == publishN(&mZ, makeRecord("Q", 128), 1));
+            ASSERT(1 == publishN(&mZ, makeRecord("R", 128), 3));  // overflow
+            ASSERT(2 == Z.numCategories());
+            ASSERT(5 == Z.numSuppressed());
+
+            mZ.setCategoryLimit(0, 1);
+
+            ASSERT(5 == publishN(&mZ, makeRecord("Q", 128), 5));
+            ASSERT(0 == innerZ->numSummaries());
+
+            mZ.publishSummaries();
+            ASSERT(2 == innerZ->numSummaries());
+            ASSERT(5 == innerZ->numReported());
+            ASSERT(8 == innerZ->numRecords());
+
+            mZ.publishSummaries();
+            ASSERT(2 == innerZ->numSummaries());
+        }
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // SAMPLING
+        //
+        // Concerns:
+        //: 1 A sampling probability of 0 suppresses every record of the
+        //:   severity band, and a probability of 1 forwards every record.
+        //:
+        //: 2 A probability strictly between 0 and 1 forwards approximately
+        //:   that fraction of the records of the band, and a probability too
+        //:   small to be distinguished from 0 (including a denormal value)
+        //:   forwards none.
+        //:
+        //: 3 Sampling applies only to the band of the specified severity.
+        //:
+        //: 4 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 Set various sampling probabilities and publish many records;
+        //:   verify the number of forwarded records, with a generous
+        //:   tolerance for fractional probabilities.  (C-1..3)
+        //:
+        //: 2 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for invalid probabilities.  (C-4)
+        //
+        // Testing:
+        //   void setSamplingProbability(Severity::Level, double probability);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nSAMPLING"
+                          << "\n========" << endl;
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+        bsl::shared_ptr<CountingObserver> inner =
+                                        bsl::make_shared<CountingObserver>();
+        Obj mX(inner, &oa);
+
+        bsl::shared_ptr<ball::Record> info  = makeRecord("A", 128);
+        bsl::shared_ptr<ball::Record> info2 = makeRecord("A", 100);
+        bsl::shared_ptr<ball::Record> warn  = makeRecord("A", 96);
+
+        const int N = 10000;
+
+        mX.setSamplingProbability(ball::Severity::e_INFO, 0.0);
+        ASSERT(0 == publishN(&mX, info,  N));
+        ASSERT(0 == publishN(&mX, info2, N));
+        ASSERT(N == publishN(&mX, warn,  N));
+
+        mX.setSamplingProbability(ball::Severity::e_INFO, 1.0);
+        ASSERT(N == publishN(&mX, info, N));
+
+        mX.setSamplingProbability(ball::Severity::e_INFO, 1e-17);
+        ASSERT(0 == publishN(&mX, info, N));
+
+        mX.setSamplingProbability(ball::Severity::e_INFO, 4.9e-324);
+        ASSERT(0 == publishN(&mX, info, N));
+
+        mX.setSamplingProbability(ball::Severity::e_INFO, 1e-15);
+        ASSERT(0 == publishN(&mX, info, N));
+
+        static const double PROBABILITIES[] = { 0.01, 0.25, 0.5, 0.9 };
+        const int NUM_PROBABILITIES = sizeof PROBABILITIES
+                                    / sizeof *PROBABILITIES;
+
+        for (int i = 0; i < NUM_PROBABILITIES; ++i) {
+            const double PROB     = PROBABILITIES[i];
+            const int    EXPECTED = static_cast<int>(PROB * N);
+
+            mX.setSamplingProbability(ball::Severity::e_INFO, PROB);
+
+            const int n = publishN(&mX, info, N);
+
+            if (veryVerbose) { T_ P_(PROB) P(n) }
+
+            ASSERTV(PROB, n, EXPECTED / 2 <= n);
+            ASSERTV(PROB, n, n <= EXPECTED + EXPECTED / 2 + 10);
+        }
+
+        if (verbose) cout << "\tNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            ASSERT_PASS(mX.setSamplingProbability(ball::Severity::e_INFO,
+                                                  0.0));
+            ASSERT_PASS(mX.setSamplingProbability(ball::Severity::e_INFO,
+                                                  1.0));
+            ASSERT_FAIL(mX.setSamplingProbability(ball::Severity::e_INFO,
+                                                  -0.1));
+            ASSERT_FAIL(mX.setSamplingProbability(ball::Severity::e_INFO,
+                                                  1.1));
+        }
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // PER-CATEGORY LIMITS
+        //
+        // Concerns:
+        //: 1 Each category has a token bucket of its own.
+        //:
+        //: 2 Setting the per-category limit again refills every bucket, and a
+        //:   rate of 0 removes the limit.
+        //:
+        //: 3 At most 'maxNumCategories' categories are tracked; any other
+        //:   category shares a single overflow bucket.
+        //:
+        //: 4 Memory is supplied by the specified allocator, and is released
+        //:   on destruction.
+        //:
+        //: 5 QoI: Asserted precondition violations are detected when enabled.
+        //:
+        //: 6 A record rejected by the per-severity limit does not consume a
+        //:   token of the bucket of its category.
+        //
+        // Plan:
+        //: 1 Set a per-category limit, publish records of several categories,
+        //:   and verify that each is limited independently.  (C-1..2)
+        //:
+        //: 2 Construct an observer tracking 2 categories, and verify that a
+        //:   third and fourth category share a bucket.  (C-3)
+        //:
+        //: 3 Use a test allocator, and verify that no memory is used from the
+        //:   default allocator.  (C-4)
+        //:
+        //: 4 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for invalid arguments.  (C-5)
+        //:
+        //: 5 Set both limits, exhaust only the per-severity limit, publish
+        //:   more records, then refill only the per-severity bucket, and
+        //:   verify that the category still has its remaining tokens.  (C-6)
+        //
+        // Testing:
+        //   RateLimitingObserver(observer, maxNumCategories, basicAllocator);
+        //   void setCategoryLimit(double recordsPerSecond, int burstSize);
+        //   int maxNumCategories() const;
+        //   int numCategories() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nPER-CATEGORY LIMITS"
+                          << "\n===================" << endl;
+
+        bslma::TestAllocator da("default", veryVeryVeryVerbose);
+        bslma::TestAllocator oa("object",  veryVeryVeryVerbose);
+
+        bsl::shared_ptr<CountingObserver> inner =
+                                        bsl::make_shared<CountingObserver>();
+
+        bsl::shared_ptr<ball::Record> a = makeRecord("A",  128);
+        bsl::shared_ptr<ball::Record> b = makeRecord("B",   32);
+        bsl::shared_ptr<ball::Record> c = makeRecord("C",  160);
+        bsl::shared_ptr<ball::Record> d = makeRecord("D",  224);
+
+        bslma::DefaultAllocatorGuard dag(&da);
+
+        if (verbose) cout << "\tIndependent categories." << endl;
+        {
+            Obj mX(inner, &oa);  const Obj& X = mX;
+
+            ASSERT(Obj::k_DEFAULT_MAX_NUM_CATEGORIES == X.maxNumCategories());
+            ASSERT(0 == X.numCategories());
+
+            ASSERT(5 == publishN(&mX, a, 5));
+            ASSERT(0 == X.numCategories());   // nothing limited
+
+            mX.setCategoryLimit(NEVER, 3);
+
+            ASSERT(3 == publishN(&mX, a, 5));
+            ASSERT(3 == publishN(&mX, b, 5));
+            ASSERT(1 == publishN(&mX, a, 1, TRIGGER));
+            ASSERT(0 == publishN(&mX, a, 1));
+            ASSERT(3 == publishN(&mX, c, 4));
+            ASSERT(3 == X.numCategories());
+            ASSERT(6 == X.numSuppressed());
+
+            mX.setCategoryLimit(NEVER, 1);    // refill with a smaller burst
+
+            ASSERT(1 == publishN(&mX, a, 5));
+            ASSERT(1 == publishN(&mX, b, 5));
+
+            mX.setCategoryLimit(0, 1);        // remove
+
+            ASSERT(100 == publishN(&mX, a, 100));
+            ASSERT(3 == X.numCategories());
+
+            ASSERT(1 <= oa.numBlocksInUse());
+        }
+        ASSERTV(oa.numBlocksInUse(), 0 == oa.numBlocksInUse());
+
+        if (verbose) cout << "\tOverflow category." << endl;
+        {
+            Obj mX(inner, 2, &oa);  const Obj& X = mX;
+
+            ASSERT(2 == X.maxNumCategories());
+
+            mX.setCategoryLimit(NEVER, 2);
+
+            ASSERT(2 == publishN(&mX, a, 3));
+            ASSERT(2 == publishN(&mX, b, 3));
+            ASSERT(2 == X.numCategories());
+
+            ASSERT(2 == publishN(&mX, c, 3));
+            ASSERT(0 == publishN(&mX, d, 3));   // shares the budget of 'c'
+            ASSERT(2 == X.numCategories());
+
+            ASSERT(0 == publishN(&mX, a, 1));
+        }
+        ASSERTV(oa.numBlocksInUse(), 0 == oa.numBlocksInUse());
+
+        if (verbose) cout << "\tOnly the per-severity limit is exhausted."
+                          << endl;
+        {
+            Obj mX(inner, &oa);  const Obj& X = mX;
+
+            mX.setCategoryLimit(NEVER, 3);
+            mX.setSeverityLimit(ball::Severity::e_INFO, NEVER, 1);
+
+            ASSERT(1 == publishN(&mX, a, 1));
+            ASSERT(0 == publishN(&mX, a, 10));  // rejected by severity only
+            ASSERT(10 == X.numSuppressed());
+
+            mX.setSeverityLimit(ball::Severity::e_INFO, NEVER, 100); // refill
+
+            // The category bucket has its 2 remaining tokens.
+
+            ASSERT(2 == publishN(&mX, a, 5));
+        }
+        ASSERTV(oa.numBlocksInUse(), 0 == oa.numBlocksInUse());
+
+        if (verbose) cout << "\tBucket is replenished." << endl;
+        {
+            Obj mX(inner, &oa);
+
+            mX.setCategoryLimit(20, 1);
+
+            ASSERT(1 == publishN(&mX, a, 5));
+
+            bslmt::ThreadUtil::microSleep(0, 1);   // 1 second
+
+            // At 20 records per second, the token has been replenished, but
+            // only a single token is kept.
+
+            ASSERT(1 == publishN(&mX, a, 5));
+        }
+
+        ASSERTV(da.numBlocksTotal(), 0 == da.numBlocksTotal());
+
+        if (verbose) cout << "\tNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            Obj mX(inner, &oa);
+
+            ASSERT_PASS(mX.setCategoryLimit(0, 1));
+            ASSERT_FAIL(mX.setCategoryLimit(-1, 1));
+            ASSERT_FAIL(mX.setCategoryLimit(1, 0));
+
+            ASSERT_FAIL(Obj(inner, 0, &oa));
+            ASSERT_FAIL(Obj(bsl::shared_ptr<ball::Observer>(), &oa));
+        }
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // PUBLISH AND PER-SEVERITY LIMITS
+        //
+        // Concerns:
+        //: 1 Without limits, every record is forwarded unchanged.
+        //:
+        //: 2 A per-severity limit applies to every record in the band of the
+        //:   severity, whatever the category, and to no other band.
+        //:
+        //: 3 Setting a limit again refills the bucket, and a rate of 0 removes
+        //:   the limit.
+        //:
+        //: 4 The forwarded and suppressed counts are maintained.
+        //:
+        //: 5 'releaseRecords' has no effect on the limits, and publishes a
+        //:   summary record for each category having suppressed records.
+        //:
+        //: 6 QoI: Asserted precondition violations are detected when enabled.
+        //:
+        //: 7 'publish' does not format the deferred message of a record,
+        //:   whether the record is forwarded or suppressed, and whether or
+        //:   not a limit applies.
+        //
+        // Plan:
+        //: 1 Publish records of several severities and categories, with and
+        //:   without per-severity limits, and verify the records forwarded
+        //:   to a 'ball::TestObserver'.  (C-1..5)
+        //:
+        //: 2 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for invalid arguments.  (C-6)
+        //:
+        //: 3 Publish records having a pending deferred message to an
+        //:   observer forwarding to an observer that does not access them,
+        //:   without and with a limit, and verify that the messages are still
+        //:   pending, also when a summary record is published.  (C-7)
+        //
+        // Testing:
+        //   RateLimitingObserver(observer, basicAllocator = 0);
+        //   virtual ~RateLimitingObserver();
+        //   virtual void publish(const shared_ptr<const Record>&, Context&);
+        //   virtual void releaseRecords();
+        //   void setSeverityLimit(Severity::Level, double, int burstSize);
+        //   bsls::Types::Int64 numForwarded() const;
+        //   bsls::Types::Int64 numSuppressed() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nPUBLISH AND PER-SEVERITY LIMITS"
+                          << "\n===============================" << endl;
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+        bsl::ostringstream                  output;
+        bsl::shared_ptr<ball::TestObserver> inner =
+                                 bsl::make_shared<ball::TestObserver>(&output);
+
+        Obj mX(inner, &oa);  const Obj& X = mX;
+
+        bsl::shared_ptr<ball::Record> info   = makeRecord("A", 128, "info");
+        bsl::shared_ptr<ball::Record> info2  = makeRecord("B", 100, "info2");
+        bsl::shared_ptr<ball::Record> warn   = makeRecord("C", 96, "warn");
+        bsl::shared_ptr<ball::Record> debug  = makeRecord("C", 160, "debug");
+
+        if (verbose) cout << "\tNo limits." << endl;
+        {
+            ASSERT(10 == publishN(&mX, info, 10));
+            ASSERT(10 == inner->numPublishedRecords());
+            ASSERT(info->fixedFields() ==
+                                   inner->lastPublishedRecord().fixedFields());
+            ASSERT(10 == X.numForwarded());
+            ASSERT(0  == X.numSuppressed());
+        }
+
+        if (verbose) cout << "\tPer-severity limit." << endl;
+        {
+            mX.setSeverityLimit(ball::Severity::e_INFO, NEVER, 4);
+
+            ASSERT(2 == publishN(&mX, info,  2));
+            ASSERT(2 == publishN(&mX, info2, 5));   // same band
+            ASSERT(0 == publishN(&mX, info,  1));
+            ASSERT(5 == publishN(&mX, warn,  5));
+            ASSERT(5 == publishN(&mX, debug, 5));
+
+            ASSERT(24 == X.numForwarded());
+            ASSERT(4  == X.numSuppressed());
+            ASSERT(24 == inner->numPublishedRecords());
+
+            // Categories "A" and "B" have suppressed records.
+
+            mX.releaseRecords();
+            ASSERT(26 == inner->numPublishedRecords());
+            ASSERT(4  == X.numSuppressed());
+
+            mX.releaseRecords();
+            ASSERT(26 == inner->numPublishedRecords());
+
+            ASSERT(0 == publishN(&mX, info, 1));
+
+            mX.setSeverityLimit(ball::Severity::e_INFO, NEVER, 1); // refill
+
+            // The next record forwarded is preceded by a summary record.
+
+            ASSERT(1 == publishN(&mX, info, 3));
+            ASSERT(28 == inner->numPublishedRecords());
+
+            mX.setSeverityLimit(ball::Severity::e_INFO, 0, 1);     // remove
+
+            ASSERT(10 == publishN(&mX, info2, 10));
+        }
+
+        if (verbose) cout << "\tDeferred messages." << endl;
+        {
+            bsl::shared_ptr<RetainingObserver> retaining =
+                                        bsl::make_shared<RetainingObserver>();
+
+            Obj mY(retaining, &oa);
+
+            bsl::shared_ptr<ball::Record> r1 = makeDeferredRecord("D", 128);
+            bsl::shared_ptr<ball::Record> r2 = makeDeferredRecord("D", 128);
+            bsl::shared_ptr<ball::Record> r3 = makeDeferredRecord("D", 128);
+
+            mY.publish(r1, PASSTHROUGH);                 // fast path
+            ASSERT(1    == retaining->numRecords());
+            ASSERT(true == r1->isDeferredMessagePending());
+
+            mY.setSeverityLimit(ball::Severity::e_INFO, NEVER, 1);
+
+            mY.publish(r2, PASSTHROUGH);                 // forwarded
+            mY.publish(r3, PASSTHROUGH);                 // suppressed
+            ASSERT(2    == retaining->numRecords());
+            ASSERT(true == r2->isDeferredMessagePending());
+            ASSERT(true == r3->isDeferredMessagePending());
+
+            mY.setSeverityLimit(ball::Severity::e_INFO, NEVER, 1); // refill
+
+            mY.publish(r3, PASSTHROUGH);                 // with a summary
+            ASSERT(4    == retaining->numRecords());
+            ASSERT(r3   == retaining->lastRecord());
+            ASSERT(true == r3->isDeferredMessagePending());
+
+            const ball::Record& R3 = *r3;
+            ASSERT("deferred 128" == R3.fixedFields().messageRef());
+        }
+
+        if (verbose) cout << "\tNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            ASSERT_PASS(mX.setSeverityLimit(ball::Severity::e_INFO, 0, 1));
+            ASSERT_FAIL(mX.setSeverityLimit(ball::Severity::e_INFO, -1, 1));
+            ASSERT_FAIL(mX.setSeverityLimit(ball::Severity::e_INFO, 1, 0));
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Run each method with arbitrary inputs and verify the behavior is
+        //:   as expected.
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nBREATHING TEST"
+                          << "\n==============" << endl;
+
+        bsl::ostringstream                  output;
+        bsl::shared_ptr<ball::TestObserver> inner =
+                                 bsl::make_shared<ball::TestObserver>(&output);
+
+        Obj mX(inner);  const Obj& X = mX;
+
+        bsl::shared_ptr<ball::Record> record = makeRecord("A", 128);
+
+        mX.publish(record, PASSTHROUGH);
+        ASSERT(1 == inner->numPublishedRecords());
+
+        mX.setCategoryLimit(NEVER, 1);
+        mX.publish(record, PASSTHROUGH);
+        mX.publish(record, PASSTHROUGH);
+        ASSERT(2 == inner->numPublishedRecords());
+        ASSERT(2 == X.numForwarded());
+        ASSERT(1 == X.numSuppressed());
+        ASSERT(1 == X.numCategories());
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -8,6 +8,8 @@ BSLS_IDENT_RCSID(ball_record_cpp,"$Id$ $CSID$")
 
 #include <bdlb_print.h>
 
+#include <bslmt_threadutil.h>
+
 #include <bsl_ostream.h>
 
 namespace BloombergLP {
@@ -17,6 +19,29 @@ namespace ball {
                            // class Record
                            // ------------
 
+// PRIVATE ACCESSORS
+void Record::resolveDeferredMessage() const
+{
+    if (e_PENDING == d_deferredState.testAndSwap(e_PENDING, e_FORMATTING)) {
+        if (d_deferredMessage.isSet()) {
+            // Similar to 'RecordAttributes::message', the message buffer is
+            // modified through a 'const' method.  The state transition above
+            // guarantees that this happens exactly once, and before any
+            // non-modifiable access to the fixed fields returns.
+
+            RecordAttributes& fixedFields =
+                                  const_cast<RecordAttributes&>(d_fixedFields);
+            d_deferredMessage.formatMessage(&fixedFields.messageStreamBuf());
+        }
+        d_deferredState.storeRelease(e_RESOLVED);
+        return;                                                       // RETURN
+    }
+
+    while (e_RESOLVED != d_deferredState.loadAcquire()) {
+        bslmt::ThreadUtil::yield();
+    }
+}
+
 // ACCESSORS
 bsl::ostream& Record::print(bsl::ostream& stream,
                             int           level,
@@ -43,7 +68,7 @@ bsl::ostream& Record::print(bsl::ostream& stream,
     else {
         stream << ' ';
     }
-    d_fixedFields.print(stream, levelPlus1, spacesPerLevel);
+    fixedFields().print(stream, levelPlus1, spacesPerLevel);
 
     if (0 <= spacesPerLevel) {
         stream << '\n';
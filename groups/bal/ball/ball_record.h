@@ -68,10 +68,50 @@ BSLS_IDENT("$Id: $")
 //  bsl::ostringstream output;
 //  output << record << bsl::endl;
 //..
+//
+///Example 2: Deferring the Formatting of the Message
+/// - - - - - - - - - - - - - - - - - - - - - - - - -
+// In addition to its fixed and user-defined fields, a 'ball::Record' holds a
+// 'ball::DeferredMessage': a 'printf'-style format specification and a
+// sequence of captured argument values.  A deferred message is formatted, and
+// the result appended to the message attribute of the fixed fields, the first
+// time the fixed fields are accessed through the *non-modifiable*
+// 'fixedFields' accessor.  This allows the thread that generates a record to
+// capture argument values cheaply, and leaves the cost of formatting them to
+// the thread that publishes the record (e.g., the publication thread of a
+// 'ball::AsyncFileObserver').  An observer that examines a record before
+// passing it to another thread should therefore read its severity and
+// category through the 'severity' and 'category' accessors, which do not
+// format the deferred message.  Note that the 'BALL_LOGVA_FAST' family of
+// macros in 'ball_log' uses this facility.
+//
+// First, we create a record, and capture a format specification and its
+// arguments in the deferred message of the record:
+//..
+//  ball::Record deferredRecord;
+//
+//  deferredRecord.deferredMessage().setFormat("%s has %d items");
+//  deferredRecord.deferredMessage().appendArgument("basket");
+//  deferredRecord.deferredMessage().appendArgument(3);
+//..
+// Then, we observe that the message has not yet been formatted, as the
+// modifiable 'fixedFields' accessor does not format the deferred message:
+//..
+//  assert(0 == deferredRecord.fixedFields().messageStreamBuf().length());
+//..
+// Finally, we access the fixed fields through a non-modifiable reference, and
+// observe that the message has been formatted:
+//..
+//  const ball::Record& constRecord = deferredRecord;
+//
+//  assert(bslstl::StringRef("basket has 3 items") ==
+//                                     constRecord.fixedFields().messageRef());
+//..
 
 #include <balscm_version.h>
 
 #include <ball_countingallocator.h>
+#include <ball_deferredmessage.h>
 #include <ball_recordattributes.h>
 #include <ball_userfields.h>
 
@@ -82,6 +122,8 @@ BSLS_IDENT("$Id: $")
 #include <bslmf_nestedtraitdeclaration.h>
 
 #include <bsls_alignment.h>
+#include <bsls_atomic.h>
+#include <bsls_performancehint.h>
 
 #include <bsl_iosfwd.h>
 
@@ -114,20 +156,49 @@ class Record {
     // a valid state, but its value is undefined.  In no event is memory
     // leaked.  Finally, *aliasing* (e.g., using all or part of an object as
     // both source and destination) is supported in all cases.
+    //
+    // A record may also hold a deferred message (see 'deferredMessage') that
+    // is formatted into the message attribute the first time the fixed fields
+    // are accessed through the non-modifiable 'fixedFields' accessor.  That
+    // formatting is performed at most once, and is safe even if several
+    // threads concurrently access the non-modifiable fixed fields of the same
+    // record.  The deferred message does not otherwise contribute to the
+    // value of a record.
+
+    // PRIVATE TYPES
+    enum DeferredState {
+        // Enumeration of the states of the deferred message of a record.
+
+        e_RESOLVED,    // no deferred message pending
+        e_PENDING,     // deferred message not yet formatted
+        e_FORMATTING   // deferred message being formatted
+    };
 
     // DATA
-    CountingAllocator  d_allocator;     // memory allocator
+    CountingAllocator        d_allocator;        // memory allocator
 
-    RecordAttributes   d_fixedFields;   // bytes used by fixed fields
+    RecordAttributes         d_fixedFields;      // bytes used by fixed fields
 
-    ball::UserFields   d_customFields;  // bytes used by user fields
+    ball::UserFields         d_customFields;     // bytes used by user fields
 
-    bslma::Allocator  *d_allocator_p;   // allocator used to supply memory;
-                                        // held but not own
+    DeferredMessage          d_deferredMessage;  // captured format and
+                                                 // arguments
+
+    mutable bsls::AtomicInt  d_deferredState;    // 'DeferredState' value
+
+    bslma::Allocator        *d_allocator_p;      // allocator used to supply
+                                                 // memory; held but not own
 
     // FRIENDS
     friend bool operator==(const Record&, const Record&);
 
+    // PRIVATE ACCESSORS
+    void resolveDeferredMessage() const;
+        // Format the deferred message of this record, if it is pending, and
+        // append the result to the message attribute of the fixed fields;
+        // if another thread is currently formatting the deferred message,
+        // wait until it has finished.
+
   public:
     // CLASS METHODS
     static void deleteObject(const Record *object);
@@ -169,12 +240,30 @@ class Record {
         // record and return the reference to this modifiable record.
 
     void clear();
-        // Clear this log record by removing the custom fields and clearing the
-        // fixed field's message buffer.  Note that this method is tailored for
-        // efficient memory use within the 'ball' logging system.
+        // Clear this log record by removing the custom fields, clearing the
+        // fixed field's message buffer, and clearing the deferred message.
+        // Note that this method is tailored for efficient memory use within
+        // the 'ball' logging system.
+
+    DeferredMessage& deferredMessage();
+        // Return a reference providing modifiable access to the deferred
+        // message of this log record, and mark the deferred message as
+        // pending.  A pending deferred message that has a format
+        // specification is formatted, and the result appended to the message
+        // attribute, the first time the fixed fields of this record are
+        // accessed through the non-modifiable 'fixedFields' accessor (or
+        // 'formatDeferredMessage' is called).  The behavior is undefined if
+        // the deferred message is modified after it has been formatted, or
+        // concurrently with any access to this record.
+
+    void formatDeferredMessage();
+        // Format the deferred message of this log record if it is pending,
+        // and append the result to the message attribute of the fixed fields.
+        // This method has no effect if no deferred message is pending.
 
     RecordAttributes& fixedFields();
-        // Return the modifiable fixed fields of this log record.
+        // Return the modifiable fixed fields of this log record.  Note that
+        // this accessor does not format a pending deferred message.
 
     void setFixedFields(const RecordAttributes& fixedFields);
         // Set the fixed fields of this log record to the value of the
@@ -189,13 +278,36 @@ class Record {
         // user-defined fields of this log record.
 
     // ACCESSORS
+    const DeferredMessage& deferredMessage() const;
+        // Return a reference providing non-modifiable access to the deferred
+        // message of this log record.
+
     const RecordAttributes& fixedFields() const;
-        // Return the non-modifiable fixed fields of this log record.
+        // Return the non-modifiable fixed fields of this log record.  If the
+        // deferred message of this record is pending, first format it and
+        // append the result to the message attribute (see
+        // 'deferredMessage').
 
     const ball::UserFields& customFields() const;
         // Return a reference providing non-modifiable access to the custom
         // user-defined fields of this log record.
 
+    const char *category() const;
+        // Return the category attribute of the fixed fields of this log
+        // record.  Note that, unlike the non-modifiable 'fixedFields'
+        // accessor, this accessor does not format a pending deferred message,
+        // so that an observer can route or filter a record without formatting
+        // its message.
+
+    bool isDeferredMessagePending() const;
+        // Return 'true' if the deferred message of this log record has not
+        // yet been formatted (see 'deferredMessage'), and 'false' otherwise.
+
+    int severity() const;
+        // Return the severity attribute of the fixed fields of this log
+        // record.  Note that, unlike the non-modifiable 'fixedFields'
+        // accessor, this accessor does not format a pending deferred message.
+
     int numAllocatedBytes() const;
         // Return the total number of bytes of dynamic memory allocated by
         // this log record object.  Note that this value does not include
@@ -254,6 +366,8 @@ Record::Record(bslma::Allocator *basicAllocator)
 : d_allocator(basicAllocator)
 , d_fixedFields(&d_allocator)
 , d_customFields(&d_allocator)
+, d_deferredMessage(&d_allocator)
+, d_deferredState(e_RESOLVED)
 , d_allocator_p(bslma::Default::allocator(basicAllocator))
 {
 }
@@ -265,6 +379,8 @@ Record::Record(const RecordAttributes&  fixedFields,
 : d_allocator(basicAllocator)
 , d_fixedFields(fixedFields, &d_allocator)
 , d_customFields(customFields, &d_allocator)
+, d_deferredMessage(&d_allocator)
+, d_deferredState(e_RESOLVED)
 , d_allocator_p(bslma::Default::allocator(basicAllocator))
 {
 }
@@ -272,8 +388,10 @@ Record::Record(const RecordAttributes&  fixedFields,
 inline
 Record::Record(const Record& original, bslma::Allocator *basicAllocator)
 : d_allocator(basicAllocator)
-, d_fixedFields(original.d_fixedFields, &d_allocator)
+, d_fixedFields(original.fixedFields(), &d_allocator)
 , d_customFields(original.d_customFields, &d_allocator)
+, d_deferredMessage(original.d_deferredMessage, &d_allocator)
+, d_deferredState(e_RESOLVED)
 , d_allocator_p(bslma::Default::allocator(basicAllocator))
 {
 }
@@ -283,8 +401,10 @@ inline
 Record& Record::operator=(const Record& rhs)
 {
     if (this != &rhs) {
-        d_fixedFields  = rhs.d_fixedFields;
-        d_customFields = rhs.d_customFields;
+        d_fixedFields     = rhs.fixedFields();
+        d_customFields    = rhs.d_customFields;
+        d_deferredMessage = rhs.d_deferredMessage;
+        d_deferredState.storeRelaxed(e_RESOLVED);
     }
     return *this;
 }
@@ -294,6 +414,21 @@ void Record::clear()
 {
     customFields().removeAll();
     fixedFields().clearMessage();
+    d_deferredMessage.clear();
+    d_deferredState.storeRelaxed(e_RESOLVED);
+}
+
+inline
+DeferredMessage& Record::deferredMessage()
+{
+    d_deferredState.storeRelaxed(e_PENDING);
+    return d_deferredMessage;
+}
+
+inline
+void Record::formatDeferredMessage()
+{
+    resolveDeferredMessage();
 }
 
 inline
@@ -321,9 +456,21 @@ ball::UserFields& Record::customFields()
 }
 
 // ACCESSORS
+inline
+const DeferredMessage& Record::deferredMessage() const
+{
+    return d_deferredMessage;
+}
+
 inline
 const RecordAttributes& Record::fixedFields() const
 {
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(
+                              e_RESOLVED != d_deferredState.loadAcquire())) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+
+        resolveDeferredMessage();
+    }
     return d_fixedFields;
 }
 
@@ -333,6 +480,24 @@ const ball::UserFields& Record::customFields() const
     return d_customFields;
 }
 
+inline
+const char *Record::category() const
+{
+    return d_fixedFields.category();
+}
+
+inline
+bool Record::isDeferredMessagePending() const
+{
+    return e_RESOLVED != d_deferredState.loadAcquire();
+}
+
+inline
+int Record::severity() const
+{
+    return d_fixedFields.severity();
+}
+
 inline
 int Record::numAllocatedBytes() const
 {
@@ -345,7 +510,7 @@ int Record::numAllocatedBytes() const
 inline
 bool ball::operator==(const Record& lhs, const Record& rhs)
 {
-    return lhs.d_fixedFields  == rhs.d_fixedFields
+    return lhs.fixedFields()  == rhs.fixedFields()
         && lhs.d_customFields == rhs.d_customFields;
 }
 
@@ -70,11 +70,17 @@ using namespace bsl;  // automatically added by script
 // [ 2] ~ball::Record();
 // [ 8] ball::Record& operator=(const ball::Record& rhs);
 // [ 1] ball::RecordAttributes& fixedFields();
+// [10] ball::DeferredMessage& deferredMessage();
+// [10] void formatDeferredMessage();
 // [ 2] void setFixedFields(const ball::RecordAttributes& fixedFields);
 // [ 2] void setCustomFields(const ball::UserFields& customFields);
 // [ 1] ball::UserFields& customFields();
 // [ 4] const ball::RecordAttributes& fixedFields() const;
 // [ 4] const ball::UserFields& customFields() const;
+// [10] const ball::DeferredMessage& deferredMessage() const;
+// [10] const char *category() const;
+// [10] bool isDeferredMessagePending() const;
+// [10] int severity() const;
 // [ 9] int numAllocatedBytes() const;
 // [  ] bsl::ostream& print(bsl::ostream& stream, int level, int spl) const;
 // [ 6] bool operator==(const ball::Record& lhs, const ball::Record& rhs);
@@ -84,7 +90,8 @@ using namespace bsl;  // automatically added by script
 //-----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
 // [ 3] TESTING GENERATOR FUNCTIONS 'GG' AND 'GGG' ('ball::UserFields')
-// [10] USAGE EXAMPLE 1
+// [10] DEFERRED MESSAGE
+// [11] USAGE EXAMPLE 1
 // [11] USAGE EXAMPLE 2
 
 // ============================================================================
@@ -151,6 +158,18 @@ typedef ball::RecordAttributes Record_Attr;
 typedef ball::UserFields  Values;
 typedef bsls::Types::Int64     Int64;
 
+//=============================================================================
+//                      HELPER FUNCTIONS FOR TESTING
+//-----------------------------------------------------------------------------
+
+extern "C" void *touchFixedFields(void *record)
+    // Access the fixed fields of the 'ball::Record' addressed by the specified
+    // 'record' through a non-modifiable reference, and return 0.
+{
+    const Obj& X = *static_cast<const Obj *>(record);
+    (void)X.fixedFields().messageRef();
+    return 0;
+}
 
 //=============================================================================
 //                              MAIN PROGRAM
@@ -254,24 +273,25 @@ int main(int argc, char *argv[])
     cout << "TEST " << __FILE__ << " CASE " << test << endl;;
 
     switch (test) { case 0:  // Zero is always the leading case.
-      case 10: {
+      case 11: {
         // --------------------------------------------------------------------
         // TESTING USAGE EXAMPLE
         //
         // Concerns:
-        //   The usage example-2 provided in the component header file must
+        //   The usage examples provided in the component header file must
         //   compile, link, and run on all platforms as shown.
         //
         // Plan:
-        //   Incorporate usage example-2 from header into driver, remove
+        //   Incorporate usage examples from header into driver, remove
         //   leading comment characters, and replace 'assert' with 'ASSERT'.
         //
         // Testing:
-        //   USAGE EXAMPLE
+        //   USAGE EXAMPLE 1
+        //   USAGE EXAMPLE 2
         // --------------------------------------------------------------------
 
-        if (verbose) cout << endl << "Testing Usage Example-2" << endl
-                                  << "=======================" << endl;
+        if (verbose) cout << endl << "Testing Usage Examples" << endl
+                                  << "======================" << endl;
 
 
 ///Usage
@@ -318,6 +338,226 @@ int main(int argc, char *argv[])
         bsl::cout << output.str() << bsl::endl;
     }
 
+///Example 2: Deferring the Formatting of the Message
+/// - - - - - - - - - - - - - - - - - - - - - - - - -
+// In addition to its fixed and user-defined fields, a 'ball::Record' holds a
+// 'ball::DeferredMessage': a 'printf'-style format specification and a
+// sequence of captured argument values.  A deferred message is formatted, and
+// the result appended to the message attribute of the fixed fields, the first
+// time the fixed fields are accessed through the *non-modifiable*
+// 'fixedFields' accessor.  This allows the thread that generates a record to
+// capture argument values cheaply, and leaves the cost of formatting them to
+// the thread that publishes the record (e.g., the publication thread of a
+// 'ball::AsyncFileObserver').  Note that the 'BALL_LOGVA_FAST' family of
+// macros in 'ball_log' uses this facility.
+//
+// First, we create a record, and capture a format specification and its
+// arguments in the deferred message of the record:
+//..
+    ball::Record deferredRecord;
+
+    deferredRecord.deferredMessage().setFormat("%s has %d items");
+    deferredRecord.deferredMessage().appendArgument("basket");
+    deferredRecord.deferredMessage().appendArgument(3);
+//..
+// Then, we observe that the message has not yet been formatted, as the
+// modifiable 'fixedFields' accessor does not format the deferred message:
+//..
+    ASSERT(0 == deferredRecord.fixedFields().messageStreamBuf().length());
+//..
+// Finally, we access the fixed fields through a non-modifiable reference, and
+// observe that the message has been formatted:
+//..
+    const ball::Record& constRecord = deferredRecord;
+
+    ASSERT(bslstl::StringRef("basket has 3 items") ==
+                                       constRecord.fixedFields().messageRef());
+//..
+
+      } break;
+      case 10: {
+        // --------------------------------------------------------------------
+        // TESTING DEFERRED MESSAGE
+        //
+        // Concerns:
+        //: 1 A deferred message is formatted, and appended to any message
+        //:   already held by the fixed fields, on the first access through
+        //:   the non-modifiable 'fixedFields' accessor, and only once.
+        //:
+        //: 2 The modifiable 'fixedFields' accessor does not format the
+        //:   deferred message.
+        //:
+        //: 3 'formatDeferredMessage' formats a pending deferred message, and
+        //:   has no effect otherwise.
+        //:
+        //: 4 Copy construction, assignment, equality comparison, and
+        //:   printing observe the formatted message.
+        //:
+        //: 5 'clear' discards the deferred message.
+        //:
+        //: 6 Concurrent first accesses through the non-modifiable
+        //:   'fixedFields' accessor format the message exactly once.
+        //:
+        //: 7 'severity', 'category', and 'isDeferredMessagePending' do not
+        //:   format the deferred message, and 'isDeferredMessagePending'
+        //:   reports whether it has been formatted.
+        //
+        // Plan:
+        //: 1 Capture a deferred message, inspect the message through the
+        //:   modifiable and non-modifiable accessors, and verify the
+        //:   formatted text.  (C-1..3)
+        //:
+        //: 2 Copy, assign, compare, and print records having a pending
+        //:   deferred message.  (C-4)
+        //:
+        //: 3 Clear a record and verify that neither the message nor the
+        //:   deferred message survive.  (C-5)
+        //:
+        //: 4 Have several threads access the fixed fields of the same record
+        //:   concurrently, and verify the message.  (C-6)
+        //:
+        //: 5 Read the severity and category of a record having a pending
+        //:   deferred message, and verify that the message is still pending
+        //:   until the fixed fields are accessed.  (C-7)
+        //
+        // Testing:
+        //   ball::DeferredMessage& deferredMessage();
+        //   void formatDeferredMessage();
+        //   const ball::DeferredMessage& deferredMessage() const;
+        //   const char *category() const;
+        //   bool isDeferredMessagePending() const;
+        //   int severity() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nTesting Deferred Message"
+                          << "\n========================" << endl;
+
+        if (verbose) cout << "\nFormatting on first 'const' access." << endl;
+        {
+            Obj mX(Z);  const Obj& X = mX;
+
+            ASSERT(false == X.deferredMessage().isSet());
+
+            mX.fixedFields().setMessage("prefix: ");
+            mX.deferredMessage().setFormat("%s=%d");
+            mX.deferredMessage().appendArgument("value");
+            mX.deferredMessage().appendArgument(42);
+
+            ASSERT(true == X.deferredMessage().isSet());
+            ASSERT("prefix: " == mX.fixedFields().messageRef());
+
+            ASSERT("prefix: value=42" == X.fixedFields().messageRef());
+            ASSERT("prefix: value=42" == X.fixedFields().messageRef());
+
+            mX.formatDeferredMessage();
+            ASSERT("prefix: value=42" == X.fixedFields().messageRef());
+        }
+
+        if (verbose) cout << "\nTesting 'formatDeferredMessage'." << endl;
+        {
+            Obj mX(Z);  const Obj& X = mX;
+
+            mX.deferredMessage().setFormat("%d%%");
+            mX.deferredMessage().appendArgument(99);
+            mX.formatDeferredMessage();
+
+            ASSERT("99%" == mX.fixedFields().messageRef());
+            ASSERT("99%" == X.fixedFields().messageRef());
+        }
+
+        if (verbose) cout << "\nCopy, assignment, equality, and print."
+                          << endl;
+        {
+            Obj mX(Z);  const Obj& X = mX;
+            Obj mY(Z);  const Obj& Y = mY;
+
+            mX.deferredMessage().setFormat("%s");
+            mX.deferredMessage().appendArgument("copied");
+
+            Obj mC(X, Z);  const Obj& C = mC;
+            ASSERT("copied" == mC.fixedFields().messageRef());
+
+            mY.fixedFields().setMessage("copied");
+            ASSERT(Y == X);
+
+            mY = X;
+            ASSERT("copied" == mY.fixedFields().messageRef());
+            ASSERT(C == Y);
+
+            Obj mP(Z);
+            mP.deferredMessage().setFormat("%s");
+            mP.deferredMessage().appendArgument("printed");
+
+            bsl::ostringstream output;
+            output << mP;
+            ASSERTV(output.str(), bsl::string::npos !=
+                                              output.str().find("printed"));
+        }
+
+        if (verbose) cout << "\nTesting 'clear'." << endl;
+        {
+            Obj mX(Z);  const Obj& X = mX;
+
+            mX.deferredMessage().setFormat("%s");
+            mX.deferredMessage().appendArgument("discarded");
+            mX.clear();
+
+            ASSERT(false == X.deferredMessage().isSet());
+            ASSERT(0     == X.fixedFields().messageRef().length());
+        }
+
+        if (verbose) cout << "\nConcurrent first access." << endl;
+        {
+            enum { k_NUM_THREADS = 8, k_NUM_ITERATIONS = 100 };
+
+            for (int i = 0; i < k_NUM_ITERATIONS; ++i) {
+                Obj mX(Z);  const Obj& X = mX;
+
+                mX.deferredMessage().setFormat("%d-%s");
+                mX.deferredMessage().appendArgument(i);
+                mX.deferredMessage().appendArgument("concurrent");
+
+                bslmt::ThreadUtil::Handle handles[k_NUM_THREADS];
+                for (int j = 0; j < k_NUM_THREADS; ++j) {
+                    ASSERT(0 == bslmt::ThreadUtil::create(
+                                                &handles[j],
+                                                &touchFixedFields,
+                                                const_cast<Obj *>(&X)));
+                }
+                for (int j = 0; j < k_NUM_THREADS; ++j) {
+                    bslmt::ThreadUtil::join(handles[j]);
+                }
+
+                bsl::ostringstream expected;
+                expected << i << "-concurrent";
+                ASSERTV(i, X.fixedFields().message(),
+                        expected.str() == X.fixedFields().message());
+            }
+        }
+
+        if (verbose) cout << "\nNon-formatting accessors." << endl;
+        {
+            Obj mX(Z);  const Obj& X = mX;
+
+            ASSERT(false == X.isDeferredMessagePending());
+
+            mX.fixedFields().setSeverity(ball::Severity::e_WARN);
+            mX.fixedFields().setCategory("CATEGORY");
+            mX.deferredMessage().setFormat("%s");
+            mX.deferredMessage().appendArgument("pending");
+
+            ASSERT(true == X.isDeferredMessagePending());
+
+            ASSERT(ball::Severity::e_WARN == X.severity());
+            ASSERT(0 == bsl::strcmp("CATEGORY", X.category()));
+
+            ASSERT(true == X.isDeferredMessagePending());
+            ASSERT(0    == mX.fixedFields().messageRef().length());
+
+            ASSERT("pending" == X.fixedFields().messageRef());
+            ASSERT(false     == X.isDeferredMessagePending());
+        }
+
       } break;
       case 9: {
         // --------------------------------------------------------------------
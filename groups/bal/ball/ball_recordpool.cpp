@@ -0,0 +1,514 @@
+// ball_recordpool.cpp                                                -*-C++-*-
+#include <ball_recordpool.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(ball_recordpool_cpp,"$Id$ $CSID$")
+
+#include <bslma_default.h>
+#include <bslma_deallocatorproctor.h>
+#include <bslma_sharedptrrep.h>
+
+#include <bslmt_lockguard.h>
+
+#include <bsls_alignmentutil.h>
+#include <bsls_assert.h>
+#include <bsls_performancehint.h>
+
+#include <bsl_typeinfo.h>
+
+///Implementation Notes
+///--------------------
+// Each record is allocated together with a 'RecordPool_Node', which serves as
+// both the (intrusive) link of the record in the lists of available and of
+// created records, and as the shared pointer representation of the record.
+// The record is placed at the start of the allocated block, and the node
+// immediately after it, so that the node of a record can be computed from the
+// address of the record.
+//
+// The shared list of available records, 'd_availableNodes', is a stack that
+// supports only two operations: pushing a chain of nodes (a compare-and-swap
+// on the head), and taking the entire stack (a swap of the head with 0).
+// Unlike removing a single node, neither operation is subject to the "ABA"
+// problem.
+//
+// A thread cache holds two lists: 'd_taken_p', the nodes most recently taken
+// from the shared stack (of unknown length), and 'd_released_p', the nodes
+// released by the thread, whose length is tracked.  Records are obtained from
+// 'd_taken_p' first.  When 'd_released_p' reaches 'k_BATCH_SIZE' nodes, it is
+// pushed to the shared stack as a single chain.  The number of records in use
+// is the sum of per-cache counters, each of which is modified only by the
+// thread owning the cache, and 'd_numUncachedInUse'.
+
+namespace BloombergLP {
+namespace ball {
+
+                           // =====================
+                           // class RecordPool_Node
+                           // =====================
+
+class RecordPool_Node : public bslma::SharedPtrRep {
+    // This component-private class holds the links of a pooled record, and
+    // provides the shared pointer representation of the record.
+
+  public:
+    // DATA
+    RecordPool       *d_pool_p;          // owning pool (held, not owned)
+    RecordPool_Node  *d_next_p;          // next available node
+    RecordPool_Node  *d_nextCreated_p;   // next node created by the pool
+
+    // CLASS METHODS
+    static bsl::size_t recordSize();
+        // Return the number of bytes, suitably aligned, occupied by a record
+        // at the start of the block holding a record and its node.
+
+    static RecordPool_Node *fromRecord(Record *record);
+        // Return the address of the node allocated together with the
+        // specified 'record'.
+
+    // CREATORS
+    explicit RecordPool_Node(RecordPool *pool);
+        // Create a node for the record immediately preceding it in memory,
+        // owned by the specified 'pool'.
+
+    // MANIPULATORS
+    virtual void disposeObject();
+        // Do nothing: the record is released by 'disposeRep'.
+
+    virtual void disposeRep();
+        // Return the record to the owning pool.
+
+    virtual void *getDeleter(const std::type_info& type);
+        // Return 0.  Records are returned to their pool, and the pool does not
+        // expose a deleter.
+
+    Record *record();
+        // Return the address of the record held by this node.
+
+    // ACCESSORS
+    virtual void *originalPtr() const;
+        // Return the address of the record held by this node.
+};
+
+                       // =============================
+                       // struct RecordPool_ThreadCache
+                       // =============================
+
+struct RecordPool_ThreadCache {
+    // This component-private 'struct' holds the records cached by one thread.
+    // A cache is owned by its pool, and is reused by another thread after the
+    // thread using it exits.
+
+    // DATA
+    RecordPool              *d_pool_p;       // owning pool (held, not owned)
+
+    RecordPool_Node         *d_taken_p;      // nodes taken from the shared
+                                             // list
+
+    RecordPool_Node         *d_released_p;   // nodes released by this thread
+
+    RecordPool_Node         *d_releasedLast_p;
+                                             // last node in 'd_released_p'
+
+    int                      d_numReleased;  // length of 'd_released_p'
+
+    bsls::AtomicInt          d_numInUse;     // records obtained less records
+                                             // released through this cache
+
+    bsls::AtomicBool         d_isInUse;      // 'true' if the cache belongs to
+                                             // a thread
+
+    RecordPool_ThreadCache  *d_next_p;       // next cache of the pool
+
+    // CLASS METHODS
+    static void threadExit(void *cache);
+        // Return the records held by the specified 'cache' to its pool, and
+        // make 'cache' available for reuse.  This function is invoked when a
+        // thread having a cache exits.
+
+    // MANIPULATORS
+    void flush();
+        // Return the records held by this cache to its pool.
+};
+
+                           // ---------------------
+                           // class RecordPool_Node
+                           // ---------------------
+
+// CLASS METHODS
+inline
+bsl::size_t RecordPool_Node::recordSize()
+{
+    return bsls::AlignmentUtil::roundUpToMaximalAlignment(sizeof(Record));
+}
+
+inline
+RecordPool_Node *RecordPool_Node::fromRecord(Record *record)
+{
+    return reinterpret_cast<RecordPool_Node *>(
+                             reinterpret_cast<char *>(record) + recordSize());
+}
+
+// CREATORS
+RecordPool_Node::RecordPool_Node(RecordPool *pool)
+: d_pool_p(pool)
+, d_next_p(0)
+, d_nextCreated_p(0)
+{
+}
+
+// MANIPULATORS
+void RecordPool_Node::disposeObject()
+{
+}
+
+void RecordPool_Node::disposeRep()
+{
+    d_pool_p->releaseNode(this);
+}
+
+void *RecordPool_Node::getDeleter(const std::type_info&)
+{
+    return 0;
+}
+
+inline
+Record *RecordPool_Node::record()
+{
+    return reinterpret_cast<Record *>(reinterpret_cast<char *>(this)
+                                                               - recordSize());
+}
+
+// ACCESSORS
+void *RecordPool_Node::originalPtr() const
+{
+    return const_cast<RecordPool_Node *>(this)->record();
+}
+
+                       // -----------------------------
+                       // struct RecordPool_ThreadCache
+                       // -----------------------------
+
+// CLASS METHODS
+void RecordPool_ThreadCache::threadExit(void *cache)
+{
+    RecordPool_ThreadCache *threadCache =
+                                 static_cast<RecordPool_ThreadCache *>(cache);
+
+    threadCache->flush();
+    threadCache->d_isInUse.storeRelease(false);
+}
+
+// MANIPULATORS
+void RecordPool_ThreadCache::flush()
+{
+    if (d_released_p) {
+        d_pool_p->pushAvailableNodes(d_released_p, d_releasedLast_p);
+        d_released_p     = 0;
+        d_releasedLast_p = 0;
+        d_numReleased    = 0;
+    }
+
+    if (d_taken_p) {
+        RecordPool_Node *last = d_taken_p;
+        while (last->d_next_p) {
+            last = last->d_next_p;
+        }
+        d_pool_p->pushAvailableNodes(d_taken_p, last);
+        d_taken_p = 0;
+    }
+}
+
+                             // ----------------
+                             // class RecordPool
+                             // ----------------
+
+// PRIVATE MANIPULATORS
+RecordPool_Node *RecordPool::createNode()
+{
+    const bsl::size_t recordSize = RecordPool_Node::recordSize();
+
+    char *block = static_cast<char *>(
+                d_allocator_p->allocate(recordSize + sizeof(RecordPool_Node)));
+
+    bslma::DeallocatorProctor<bslma::Allocator> proctor(block, d_allocator_p);
+
+    new (block) Record(d_allocator_p);
+    proctor.release();
+
+    RecordPool_Node *node = new (block + recordSize) RecordPool_Node(this);
+
+    RecordPool_Node *head = d_createdNodes.loadRelaxed();
+    for (;;) {
+        node->d_nextCreated_p = head;
+
+        RecordPool_Node *previous = d_createdNodes.testAndSwapAcqRel(head,
+                                                                     node);
+        if (previous == head) {
+            break;
+        }
+        head = previous;
+    }
+
+    d_numRecords.addRelaxed(1);
+    return node;
+}
+
+RecordPool_ThreadCache *RecordPool::lookupCache()
+{
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(!d_hasCacheKey)) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        return 0;                                                     // RETURN
+    }
+
+    RecordPool_ThreadCache *cache = static_cast<RecordPool_ThreadCache *>(
+                                  bslmt::ThreadUtil::getSpecific(d_cacheKey));
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(0 != cache)) {
+        return cache;                                                 // RETURN
+    }
+
+    // The calling thread has no cache: reuse the cache of an exited thread, or
+    // create a new one.
+
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_cachesMutex);
+
+    for (cache = d_caches_p; cache; cache = cache->d_next_p) {
+        if (!cache->d_isInUse.loadAcquire()) {
+            break;
+        }
+    }
+
+    if (!cache) {
+        cache = static_cast<RecordPool_ThreadCache *>(
+                      d_allocator_p->allocate(sizeof(RecordPool_ThreadCache)));
+        new (cache) RecordPool_ThreadCache();
+
+        cache->d_pool_p         = this;
+        cache->d_taken_p        = 0;
+        cache->d_released_p     = 0;
+        cache->d_releasedLast_p = 0;
+        cache->d_numReleased    = 0;
+        cache->d_next_p         = d_caches_p;
+        d_caches_p              = cache;
+    }
+
+    if (0 != bslmt::ThreadUtil::setSpecific(d_cacheKey, cache)) {
+        return 0;                                                     // RETURN
+    }
+
+    cache->d_isInUse.storeRelease(true);
+    return cache;
+}
+
+void RecordPool::pushAvailableNodes(RecordPool_Node *first,
+                                    RecordPool_Node *last)
+{
+    BSLS_ASSERT(first);
+    BSLS_ASSERT(last);
+
+    RecordPool_Node *head = d_availableNodes.loadRelaxed();
+    for (;;) {
+        last->d_next_p = head;
+
+        RecordPool_Node *previous = d_availableNodes.testAndSwapAcqRel(head,
+                                                                      first);
+        if (previous == head) {
+            break;
+        }
+        head = previous;
+    }
+}
+
+void RecordPool::releaseNode(RecordPool_Node *node)
+{
+    BSLS_ASSERT(node);
+
+    node->record()->clear();
+
+    RecordPool_ThreadCache *cache = lookupCache();
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(!cache)) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+
+        d_numUncachedInUse.addRelaxed(-1);
+        pushAvailableNodes(node, node);
+        return;                                                       // RETURN
+    }
+
+    cache->d_numInUse.storeRelaxed(cache->d_numInUse.loadRelaxed() - 1);
+
+    node->d_next_p = cache->d_released_p;
+    if (!cache->d_released_p) {
+        cache->d_releasedLast_p = node;
+    }
+    cache->d_released_p = node;
+
+    if (++cache->d_numReleased >= k_BATCH_SIZE) {
+        pushAvailableNodes(cache->d_released_p, cache->d_releasedLast_p);
+        cache->d_released_p     = 0;
+        cache->d_releasedLast_p = 0;
+        cache->d_numReleased    = 0;
+    }
+}
+
+// CREATORS
+RecordPool::RecordPool(bslma::Allocator *basicAllocator)
+: d_availableNodes(0)
+, d_createdNodes(0)
+, d_numRecords(0)
+, d_numUncachedInUse(0)
+, d_hasCacheKey(false)
+, d_caches_p(0)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    d_hasCacheKey = 0 == bslmt::ThreadUtil::createKey(
+                                    &d_cacheKey,
+                                    (bslmt::ThreadUtil::Destructor)
+                                    &RecordPool_ThreadCache::threadExit);
+}
+
+RecordPool::~RecordPool()
+{
+    if (d_hasCacheKey) {
+        // Records cached by the calling thread, and by threads that have not
+        // exited, are reclaimed below through 'd_createdNodes'.
+
+        bslmt::ThreadUtil::setSpecific(d_cacheKey, 0);
+        bslmt::ThreadUtil::deleteKey(d_cacheKey);
+    }
+
+    RecordPool_Node *node = d_createdNodes.loadAcquire();
+    while (node) {
+        RecordPool_Node *next   = node->d_nextCreated_p;
+        Record          *record = node->record();
+
+        node->~RecordPool_Node();
+        record->~Record();
+        d_allocator_p->deallocate(record);
+
+        node = next;
+    }
+
+    RecordPool_ThreadCache *cache = d_caches_p;
+    while (cache) {
+        RecordPool_ThreadCache *next = cache->d_next_p;
+
+        cache->~RecordPool_ThreadCache();
+        d_allocator_p->deallocate(cache);
+
+        cache = next;
+    }
+}
+
+// MANIPULATORS
+Record *RecordPool::getRecord()
+{
+    RecordPool_ThreadCache *cache = lookupCache();
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(!cache)) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+
+        // Without a thread cache, a single node is removed from the shared
+        // list by taking the entire list and returning the remainder.
+        // Serializing such removals makes this safe against concurrent
+        // removals made through thread caches, which take the entire list.
+
+        RecordPool_Node *node;
+        {
+            bslmt::LockGuard<bslmt::Mutex> guard(&d_cachesMutex);
+
+            node = d_availableNodes.swapAcqRel(0);
+            if (node && node->d_next_p) {
+                RecordPool_Node *last = node->d_next_p;
+                while (last->d_next_p) {
+                    last = last->d_next_p;
+                }
+                pushAvailableNodes(node->d_next_p, last);
+            }
+        }
+        if (!node) {
+            node = createNode();
+        }
+
+        d_numUncachedInUse.addRelaxed(1);
+        return node->record();                                        // RETURN
+    }
+
+    RecordPool_Node *node = cache->d_taken_p;
+
+    if (node) {
+        cache->d_taken_p = node->d_next_p;
+    }
+    else if (0 != (node = cache->d_released_p)) {
+        cache->d_released_p = node->d_next_p;
+        if (0 == --cache->d_numReleased) {
+            cache->d_releasedLast_p = 0;
+        }
+    }
+    else if (0 != (node = d_availableNodes.swapAcqRel(0))) {
+        cache->d_taken_p = node->d_next_p;
+    }
+    else {
+        node = createNode();
+    }
+
+    cache->d_numInUse.storeRelaxed(cache->d_numInUse.loadRelaxed() + 1);
+    return node->record();
+}
+
+bsl::shared_ptr<Record> RecordPool::makeHandle(Record *record)
+{
+    BSLS_ASSERT(record);
+
+    RecordPool_Node *node = RecordPool_Node::fromRecord(record);
+
+    BSLS_ASSERT(this == node->d_pool_p);
+
+    node->resetCountsRaw(1, 0);
+    return bsl::shared_ptr<Record>(record, node);
+}
+
+void RecordPool::releaseRecord(Record *record)
+{
+    BSLS_ASSERT(record);
+
+    RecordPool_Node *node = RecordPool_Node::fromRecord(record);
+
+    BSLS_ASSERT(this == node->d_pool_p);
+
+    releaseNode(node);
+}
+
+// ACCESSORS
+int RecordPool::numRecordsInUse() const
+{
+    int result = d_numUncachedInUse.loadRelaxed();
+
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_cachesMutex);
+
+    for (const RecordPool_ThreadCache *cache = d_caches_p;
+         cache;
+         cache = cache->d_next_p) {
+        result += cache->d_numInUse.loadRelaxed();
+    }
+    return result;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
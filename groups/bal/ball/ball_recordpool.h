@@ -0,0 +1,278 @@
+// ball_recordpool.h                                                  -*-C++-*-
+#ifndef INCLUDED_BALL_RECORDPOOL
+#define INCLUDED_BALL_RECORDPOOL
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide a thread-safe pool of log records with per-thread caches.
+//
+//@CLASSES:
+//  ball::RecordPool: pool of reusable 'ball::Record' objects
+//
+//@SEE_ALSO: ball_record, ball_loggermanager
+//
+//@DESCRIPTION: This component provides a mechanism, 'ball::RecordPool', that
+// dispenses reusable 'ball::Record' objects, and that can wrap a dispensed
+// record in a 'bsl::shared_ptr' (a *record* *handle*) without allocating
+// memory.  A record is returned to the pool, and cleared (see
+// 'ball::Record::clear'), either explicitly, by a call to 'releaseRecord', or
+// implicitly, when the last reference to its record handle is released.
+//
+// 'ball::RecordPool' is designed for the logging fast path of
+// 'ball::Logger', where records are obtained by many concurrent logging
+// threads and are frequently released by a different thread (e.g., the
+// publication thread of an asynchronous observer):
+//
+//: o Each thread that obtains or releases records has a private cache of
+//:   available records, so obtaining or releasing a record usually accesses
+//:   no data shared with other threads.
+//:
+//: o Records released by a thread are returned to a shared list of available
+//:   records in batches of 'k_BATCH_SIZE' records, and a thread whose cache is
+//:   empty takes *all* of the records in the shared list.  Both operations are
+//:   a single atomic operation, and neither is subject to the "ABA" problem.
+//:
+//: o The reference count of a record handle is held in memory allocated
+//:   together with the record, so creating a record handle does not allocate.
+//
+// Memory for records is supplied by the allocator specified at construction,
+// and is not released until the pool is destroyed.  The records cached by a
+// thread are returned to the shared list when that thread exits.
+//
+///Thread Safety
+///-------------
+// 'ball::RecordPool' is fully *thread-safe*, meaning that all non-creator
+// methods can be safely invoked concurrently on the same instance.  The
+// behavior is undefined if a pool is destroyed while a record obtained from it
+// is in use, or while a thread that used the pool is exiting.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Obtaining and Sharing Records
+/// - - - - - - - - - - - - - - - - - - - -
+// In this example we show how a logger might obtain a record, populate it, and
+// pass a handle to that record to an observer.
+//
+// First, we create a record pool:
+//..
+//  ball::RecordPool pool;
+//..
+// Then, we obtain a record and populate some of its fields:
+//..
+//  ball::Record *record = pool.getRecord();
+//
+//  record->fixedFields().setFileName(__FILE__);
+//  record->fixedFields().setLineNumber(__LINE__);
+//  record->fixedFields().setMessage("Hello, world!");
+//
+//  assert(1 == pool.numRecordsInUse());
+//..
+// Next, we wrap the record in a record handle.  The pool now owns the record,
+// which is returned to the pool when the last copy of the handle is
+// destroyed:
+//..
+//  {
+//      bsl::shared_ptr<ball::Record> handle = pool.makeHandle(record);
+//
+//      bsl::shared_ptr<ball::Record> copy(handle);  // e.g., held by an
+//                                                   // observer
+//      assert(1 == pool.numRecordsInUse());
+//  }
+//  assert(0 == pool.numRecordsInUse());
+//..
+// Finally, we obtain another record, and observe that the pool has reused, and
+// cleared, the record released above:
+//..
+//  ball::Record *other = pool.getRecord();
+//
+//  assert(record == other);
+//  assert(0      == other->fixedFields().messageRef().length());
+//
+//  pool.releaseRecord(other);
+//..
+
+#include <balscm_version.h>
+
+#include <ball_record.h>
+
+#include <bslma_allocator.h>
+
+#include <bslmt_mutex.h>
+#include <bslmt_threadutil.h>
+
+#include <bsls_atomic.h>
+
+#include <bsl_memory.h>
+
+namespace BloombergLP {
+namespace ball {
+
+class RecordPool_Node;
+struct RecordPool_ThreadCache;
+
+                             // ================
+                             // class RecordPool
+                             // ================
+
+class RecordPool {
+    // This class provides a thread-safe pool of reusable 'ball::Record'
+    // objects, having a cache of available records for each thread that
+    // obtains or releases records.
+
+    // DATA
+    bsls::AtomicPointer<RecordPool_Node>
+                              d_availableNodes;  // shared list of available
+                                                 // records
+
+    bsls::AtomicPointer<RecordPool_Node>
+                              d_createdNodes;    // list of all records created
+                                                 // by this pool
+
+    bsls::AtomicInt           d_numRecords;      // number of records created
+
+    bsls::AtomicInt           d_numUncachedInUse;
+                                                 // records obtained less
+                                                 // records released without
+                                                 // using a thread cache
+
+    bslmt::ThreadUtil::Key    d_cacheKey;        // key of the calling thread's
+                                                 // cache
+
+    bool                      d_hasCacheKey;     // 'true' if 'd_cacheKey' was
+                                                 // created successfully
+
+    mutable bslmt::Mutex      d_cachesMutex;     // guards 'd_caches_p', and
+                                                 // serializes removals from
+                                                 // 'd_availableNodes' made
+                                                 // without a thread cache
+
+    RecordPool_ThreadCache   *d_caches_p;        // list of all thread caches
+
+    bslma::Allocator         *d_allocator_p;     // memory allocator (held,
+                                                 // not owned)
+
+    // FRIENDS
+    friend class RecordPool_Node;
+    friend struct RecordPool_ThreadCache;
+
+    // NOT IMPLEMENTED
+    RecordPool(const RecordPool&);
+    RecordPool& operator=(const RecordPool&);
+
+    // PRIVATE MANIPULATORS
+    RecordPool_Node *createNode();
+        // Create a new record, and return the node holding it.
+
+    RecordPool_ThreadCache *lookupCache();
+        // Return the address of the cache of the calling thread, creating (or
+        // reusing) and registering a cache if the calling thread has none, or
+        // 0 if a thread cache is not available.
+
+    void pushAvailableNodes(RecordPool_Node *first, RecordPool_Node *last);
+        // Add the specified chain of nodes, from 'first' through 'last', to
+        // the shared list of available records.
+
+    void releaseNode(RecordPool_Node *node);
+        // Clear the record held by the specified 'node', and make the record
+        // available for reuse.
+
+  public:
+    // PUBLIC CONSTANTS
+    enum {
+        k_BATCH_SIZE = 32  // number of records released by a thread that are
+                           // returned to the shared list at once
+    };
+
+    // CREATORS
+    explicit RecordPool(bslma::Allocator *basicAllocator = 0);
+        // Create an empty record pool.  Optionally specify a 'basicAllocator'
+        // used to supply memory.  If 'basicAllocator' is 0, the currently
+        // installed default allocator is used.
+
+    ~RecordPool();
+        // Destroy this record pool, and all the records it has created.  The
+        // behavior is undefined unless no record obtained from this pool is in
+        // use, and no thread that used this pool is exiting.
+
+    // MANIPULATORS
+    Record *getRecord();
+        // Return the address of a modifiable record, in the default state,
+        // obtained from this pool.  Ownership of the record is transferred to
+        // the caller, and the record must be returned to this pool, either by
+        // calling 'releaseRecord', or by calling 'makeHandle' and releasing
+        // all references to the returned record handle.
+
+    bsl::shared_ptr<Record> makeHandle(Record *record);
+        // Return a record handle that refers to the specified 'record', and
+        // that returns 'record' to this pool when the last reference to it is
+        // released.  This operation does not allocate memory.  The behavior is
+        // undefined unless 'record' was obtained by a call to 'getRecord' on
+        // this pool, and has not since been released or passed to
+        // 'makeHandle'.
+
+    void releaseRecord(Record *record);
+        // Return the specified 'record' to this pool.  The behavior is
+        // undefined unless 'record' was obtained by a call to 'getRecord' on
+        // this pool, and has not since been released or passed to
+        // 'makeHandle'.
+
+    // ACCESSORS
+    int numRecords() const;
+        // Return a *snapshot* of the number of records created by this pool.
+
+    int numRecordsInUse() const;
+        // Return a *snapshot* of the number of records that have been obtained
+        // from this pool and not yet returned to it.
+
+                                  // Aspects
+
+    bslma::Allocator *allocator() const;
+        // Return the allocator used by this object to supply memory.
+};
+
+// ============================================================================
+//                              INLINE DEFINITIONS
+// ============================================================================
+
+                             // ----------------
+                             // class RecordPool
+                             // ----------------
+
+// ACCESSORS
+inline
+int RecordPool::numRecords() const
+{
+    return d_numRecords.loadRelaxed();
+}
+
+                                  // Aspects
+
+inline
+bslma::Allocator *RecordPool::allocator() const
+{
+    return d_allocator_p;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,808 @@
+// ball_recordpool.t.cpp                                              -*-C++-*-
+#include <ball_recordpool.h>
+
+#include <ball_record.h>
+#include <ball_recordattributes.h>
+
+#include <bslim_testutil.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+
+#include <bslmt_barrier.h>
+#include <bslmt_lockguard.h>
+#include <bslmt_mutex.h>
+#include <bslmt_threadutil.h>
+
+#include <bsls_assert.h>
+#include <bsls_asserttest.h>
+#include <bsls_review.h>
+
+#include <bsl_cstdlib.h>
+#include <bsl_functional.h>
+#include <bsl_iostream.h>
+#include <bsl_memory.h>
+#include <bsl_set.h>
+#include <bsl_vector.h>
+
+using namespace BloombergLP;
+using namespace bsl;
+
+// ============================================================================
+//                                   TEST PLAN
+// ----------------------------------------------------------------------------
+//                                   Overview
+//                                   --------
+// The component under test is a mechanism that dispenses pooled records, and
+// record handles that return their record to the pool.  We first verify the
+// single-threaded behavior of obtaining, sharing, and releasing records,
+// including the reuse and clearing of released records and the absence of
+// allocation when creating a record handle.  We then verify that records can
+// be released by a thread other than the one that obtained them, that the
+// records cached by a thread are returned to the pool when the thread exits,
+// and that the pool behaves correctly when used by many threads concurrently.
+// ----------------------------------------------------------------------------
+// CREATORS
+// [ 2] RecordPool(bslma::Allocator *basicAllocator = 0);
+// [ 2] ~RecordPool();
+//
+// MANIPULATORS
+// [ 2] Record *getRecord();
+// [ 3] bsl::shared_ptr<Record> makeHandle(Record *record);
+// [ 2] void releaseRecord(Record *record);
+//
+// ACCESSORS
+// [ 2] int numRecords() const;
+// [ 2] int numRecordsInUse() const;
+// [ 2] bslma::Allocator *allocator() const;
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 4] CONCERN: RECORDS CAN BE RELEASED BY ANOTHER THREAD
+// [ 4] CONCERN: CACHED RECORDS ARE RETURNED WHEN A THREAD EXITS
+// [ 5] CONCURRENCY TEST
+// [ 6] USAGE EXAMPLE
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLIM_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLIM_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLIM_TESTUTIL_LOOP6_ASSERT
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_SAFE_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_PASS(EXPR)
+#define ASSERT_SAFE_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_FAIL(EXPR)
+#define ASSERT_PASS(EXPR)      BSLS_ASSERTTEST_ASSERT_PASS(EXPR)
+#define ASSERT_FAIL(EXPR)      BSLS_ASSERTTEST_ASSERT_FAIL(EXPR)
+#define ASSERT_OPT_PASS(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_PASS(EXPR)
+#define ASSERT_OPT_FAIL(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_FAIL(EXPR)
+
+//=============================================================================
+//                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+//-----------------------------------------------------------------------------
+
+typedef ball::RecordPool              Obj;
+typedef bsl::shared_ptr<ball::Record> Handle;
+
+//=============================================================================
+//                      HELPER FUNCTIONS FOR TESTING
+//-----------------------------------------------------------------------------
+
+namespace {
+
+void obtainRecords(Obj *pool, bsl::vector<ball::Record *> *records, int n)
+    // Obtain the specified 'n' records from the specified 'pool', and append
+    // their addresses to the specified 'records'.
+{
+    for (int i = 0; i < n; ++i) {
+        ball::Record *record = pool->getRecord();
+        record->fixedFields().setLineNumber(i + 1);
+        records->push_back(record);
+    }
+}
+
+void releaseRecords(Obj *pool, bsl::vector<ball::Record *> *records)
+    // Release the records whose addresses are held by the specified 'records'
+    // to the specified 'pool', and clear 'records'.
+{
+    for (bsl::size_t i = 0; i < records->size(); ++i) {
+        pool->releaseRecord((*records)[i]);
+    }
+    records->clear();
+}
+
+void dropHandles(bsl::vector<Handle> *handles)
+    // Release all of the specified 'handles'.
+{
+    handles->clear();
+}
+
+struct ConcurrentWorker {
+    // This 'struct' provides a thread function that repeatedly obtains
+    // records from a pool, and releases them either directly, through a
+    // record handle, or by passing the handle to a shared list that is
+    // drained by other threads.
+
+    // DATA
+    Obj                 *d_pool_p;
+    bslmt::Barrier      *d_barrier_p;
+    bslmt::Mutex        *d_mutex_p;
+    bsl::vector<Handle> *d_shared_p;
+    int                  d_id;
+    int                  d_numIterations;
+    int                  d_numErrors;
+
+    // MANIPULATORS
+    void operator()()
+    {
+        d_barrier_p->wait();
+
+        for (int i = 0; i < d_numIterations; ++i) {
+            ball::Record *record = d_pool_p->getRecord();
+
+            if (0 != record->fixedFields().lineNumber()
+             || 0 != record->fixedFields().messageRef().length()) {
+                ++d_numErrors;  // record was not cleared
+            }
+            record->fixedFields().setLineNumber(d_id * d_numIterations + i);
+            record->fixedFields().setMessage("message");
+
+            switch (i % 3) {
+              case 0: {
+                d_pool_p->releaseRecord(record);
+              } break;
+              case 1: {
+                Handle handle = d_pool_p->makeHandle(record);
+                Handle copy(handle);
+              } break;
+              default: {
+                Handle handle = d_pool_p->makeHandle(record);
+
+                bsl::vector<Handle> drained;
+                {
+                    bslmt::LockGuard<bslmt::Mutex> guard(d_mutex_p);
+                    d_shared_p->push_back(handle);
+                    if (d_shared_p->size() > 64) {
+                        drained.swap(*d_shared_p);
+                    }
+                }
+              }
+            }
+        }
+    }
+};
+
+}  // close unnamed namespace
+
+//=============================================================================
+//                              MAIN PROGRAM
+//-----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    const int                 test = argc > 1 ? atoi(argv[1]) : 0;
+    const bool             verbose = argc > 2;
+    const bool         veryVerbose = argc > 3;
+    const bool     veryVeryVerbose = argc > 4;
+    const bool veryVeryVeryVerbose = argc > 5;
+
+    (void)veryVerbose;
+    (void)veryVeryVerbose;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    // CONCERN: 'BSLS_REVIEW' failures should lead to test failures.
+    bsls::ReviewFailureHandlerGuard reviewGuard(&bsls::Review::failByAbort);
+
+    // CONCERN: In no case does memory come from the global allocator.
+
+    bslma::TestAllocator globalAllocator("global", veryVeryVeryVerbose);
+    bslma::Default::setGlobalAllocator(&globalAllocator);
+
+    switch (test) { case 0:
+      case 6: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "USAGE EXAMPLE" << endl
+                          << "=============" << endl;
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Obtaining and Sharing Records
+/// - - - - - - - - - - - - - - - - - - - -
+// In this example we show how a logger might obtain a record, populate it, and
+// pass a handle to that record to an observer.
+//
+// First, we create a record pool:
+//..
+    ball::RecordPool pool;
+//..
+// Then, we obtain a record and populate some of its fields:
+//..
+    ball::Record *record = pool.getRecord();
+
+    record->fixedFields().setFileName(__FILE__);
+    record->fixedFields().setLineNumber(__LINE__);
+    record->fixedFields().setMessage("Hello, world!");
+
+    ASSERT(1 == pool.numRecordsInUse());
+//..
+// Next, we wrap the record in a record handle.  The pool now owns the record,
+// which is returned to the pool when the last copy of the handle is
+// destroyed:
+//..
+    {
+        bsl::shared_ptr<ball::Record> handle = pool.makeHandle(record);
+
+        bsl::shared_ptr<ball::Record> copy(handle);  // e.g., held by an
+                                                     // observer
+        ASSERT(1 == pool.numRecordsInUse());
+    }
+    ASSERT(0 == pool.numRecordsInUse());
+//..
+// Finally, we obtain another record, and observe that the pool has reused, and
+// cleared, the record released above:
+//..
+    ball::Record *other = pool.getRecord();
+
+    ASSERT(record == other);
+    ASSERT(0      == other->fixedFields().messageRef().length());
+
+    pool.releaseRecord(other);
+//..
+
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // CONCURRENCY TEST
+        //
+        // Concerns:
+        //: 1 Records can be obtained and released concurrently by many
+        //:   threads, directly, through record handles, and through record
+        //:   handles released by other threads.
+        //:
+        //: 2 A record is never dispensed to two threads at once, and is
+        //:   always cleared when dispensed.
+        //:
+        //: 3 When all records are released, 'numRecordsInUse' is 0.
+        //
+        // Plan:
+        //: 1 Start several threads that concurrently obtain records, verify
+        //:   that each record is in the default state, modify it, and release
+        //:   it in one of three ways, passing some handles to be released by
+        //:   other threads.  (C-1..2)
+        //:
+        //: 2 Join the threads, drop the remaining handles, and verify
+        //:   'numRecordsInUse'.  (C-3)
+        //
+        // Testing:
+        //   CONCURRENCY TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "CONCURRENCY TEST" << endl
+                          << "================" << endl;
+
+        enum { k_NUM_THREADS = 8, k_NUM_ITERATIONS = 20000 };
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+        {
+            Obj mX(&oa);  const Obj& X = mX;
+
+            bslmt::Barrier      barrier(k_NUM_THREADS);
+            bslmt::Mutex        mutex;
+            bsl::vector<Handle> shared(&oa);
+
+            ConcurrentWorker workers[k_NUM_THREADS];
+            bslmt::ThreadUtil::Handle handles[k_NUM_THREADS];
+
+            for (int i = 0; i < k_NUM_THREADS; ++i) {
+                ConcurrentWorker& worker = workers[i];
+
+                worker.d_pool_p        = &mX;
+                worker.d_barrier_p     = &barrier;
+                worker.d_mutex_p       = &mutex;
+                worker.d_shared_p      = &shared;
+                worker.d_id            = i;
+                worker.d_numIterations = k_NUM_ITERATIONS;
+                worker.d_numErrors     = 0;
+            }
+            for (int i = 0; i < k_NUM_THREADS; ++i) {
+                ASSERT(0 == bslmt::ThreadUtil::createWithAllocator(
+                                                                &handles[i],
+                                                                workers[i],
+                                                                &oa));
+            }
+            for (int i = 0; i < k_NUM_THREADS; ++i) {
+                bslmt::ThreadUtil::join(handles[i]);
+                ASSERTV(i, workers[i].d_numErrors,
+                        0 == workers[i].d_numErrors);
+            }
+
+            dropHandles(&shared);
+
+            ASSERTV(X.numRecordsInUse(), 0 == X.numRecordsInUse());
+
+            if (verbose) { P(X.numRecords()); }
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // RELEASE BY ANOTHER THREAD AND THREAD EXIT
+        //
+        // Concerns:
+        //: 1 A record obtained by one thread can be released by another
+        //:   thread, and is then available to the thread that obtained it.
+        //:
+        //: 2 The records cached by a thread are returned to the pool when the
+        //:   thread exits, and are reused by other threads.
+        //:
+        //: 3 'numRecordsInUse' accounts for records released by a thread
+        //:   other than the one that obtained them, and for threads that have
+        //:   exited.
+        //
+        // Plan:
+        //: 1 Obtain records in the main thread, release them in another
+        //:   thread, and verify that obtaining as many records again does not
+        //:   create new records.  (C-1, 3)
+        //:
+        //: 2 Obtain and release records in a thread that then exits, and
+        //:   verify that obtaining as many records in the main thread does not
+        //:   create new records.  (C-2..3)
+        //
+        // Testing:
+        //   CONCERN: RECORDS CAN BE RELEASED BY ANOTHER THREAD
+        //   CONCERN: CACHED RECORDS ARE RETURNED WHEN A THREAD EXITS
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "RELEASE BY ANOTHER THREAD AND THREAD EXIT"
+                          << endl
+                          << "========================================="
+                          << endl;
+
+        enum { k_NUM_RECORDS = 3 * Obj::k_BATCH_SIZE + 5 };
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+        {
+            Obj mX(&oa);  const Obj& X = mX;
+
+            bsl::vector<ball::Record *> records(&oa);
+            bsl::vector<Handle>         handles(&oa);
+
+            if (verbose) cout << "\tRelease by another thread." << endl;
+
+            obtainRecords(&mX, &records, k_NUM_RECORDS);
+            ASSERT(k_NUM_RECORDS == X.numRecords());
+            ASSERT(k_NUM_RECORDS == X.numRecordsInUse());
+
+            for (bsl::size_t i = 0; i < records.size(); ++i) {
+                handles.push_back(mX.makeHandle(records[i]));
+            }
+            records.clear();
+
+            bslmt::ThreadUtil::Handle thread;
+            ASSERT(0 == bslmt::ThreadUtil::createWithAllocator(
+                                  &thread,
+                                  bsl::function<void()>(
+                                      bsl::allocator_arg,
+                                      &oa,
+                                      bsl::bind(&dropHandles, &handles)),
+                                  &oa));
+            bslmt::ThreadUtil::join(thread);
+
+            ASSERTV(X.numRecordsInUse(), 0 == X.numRecordsInUse());
+
+            obtainRecords(&mX, &records, k_NUM_RECORDS);
+            ASSERTV(X.numRecords(), k_NUM_RECORDS == X.numRecords());
+            ASSERT(k_NUM_RECORDS == X.numRecordsInUse());
+
+            bsl::set<ball::Record *> distinct(records.begin(), records.end());
+            ASSERT(records.size() == distinct.size());
+
+            releaseRecords(&mX, &records);
+            ASSERT(0 == X.numRecordsInUse());
+
+            if (verbose) cout << "\tThread exit." << endl;
+
+            Obj mY(&oa);  const Obj& Y = mY;
+
+            ASSERT(0 == bslmt::ThreadUtil::createWithAllocator(
+                                  &thread,
+                                  bsl::function<void()>(
+                                      bsl::allocator_arg,
+                                      &oa,
+                                      bsl::bind(&obtainRecords,
+                                                &mY,
+                                                &records,
+                                                static_cast<int>(
+                                                       k_NUM_RECORDS))),
+                                  &oa));
+            bslmt::ThreadUtil::join(thread);
+            ASSERT(k_NUM_RECORDS == Y.numRecords());
+
+            ASSERT(0 == bslmt::ThreadUtil::createWithAllocator(
+                                  &thread,
+                                  bsl::function<void()>(
+                                      bsl::allocator_arg,
+                                      &oa,
+                                      bsl::bind(&releaseRecords,
+                                                &mY,
+                                                &records)),
+                                  &oa));
+            bslmt::ThreadUtil::join(thread);
+            ASSERT(0 == Y.numRecordsInUse());
+
+            // Fewer than 'k_BATCH_SIZE' of the records released by the
+            // thread were held in its cache when it exited.
+
+            obtainRecords(&mY, &records, k_NUM_RECORDS);
+            ASSERTV(Y.numRecords(), k_NUM_RECORDS == Y.numRecords());
+            ASSERT(k_NUM_RECORDS == Y.numRecordsInUse());
+
+            releaseRecords(&mY, &records);
+            ASSERT(0 == Y.numRecordsInUse());
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // 'makeHandle'
+        //
+        // Concerns:
+        //: 1 The returned handle refers to the supplied record.
+        //:
+        //: 2 Creating a record handle does not allocate memory.
+        //:
+        //: 3 The record is returned to the pool, and cleared, when the last
+        //:   shared reference to it is released, unless weak references
+        //:   remain, in which case it is returned when the last weak
+        //:   reference is released.
+        //:
+        //: 4 A handle does not expose a deleter.
+        //:
+        //: 5 Precondition violations are detected in appropriate build modes.
+        //
+        // Plan:
+        //: 1 Obtain a record, create a handle, and verify the address held by
+        //:   the handle and the number of allocations.  (C-1..2)
+        //:
+        //: 2 Copy and release the handle, with and without an outstanding
+        //:   'bsl::weak_ptr', and verify 'numRecordsInUse'.  (C-3)
+        //:
+        //: 3 Call 'bsl::get_deleter' on a handle.  (C-4)
+        //:
+        //: 4 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for invalid arguments.  (C-5)
+        //
+        // Testing:
+        //   bsl::shared_ptr<Record> makeHandle(Record *record);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "'makeHandle'" << endl
+                          << "============" << endl;
+
+        bslma::TestAllocator         da("default", veryVeryVeryVerbose);
+        bslma::DefaultAllocatorGuard dag(&da);
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+        {
+            Obj mX(&oa);  const Obj& X = mX;
+
+            ball::Record *record = mX.getRecord();
+            record->fixedFields().setMessage("shared");
+
+            const bsls::Types::Int64 NUM_BLOCKS = oa.numBlocksTotal();
+            {
+                Handle handle = mX.makeHandle(record);
+                ASSERT(record     == handle.get());
+                ASSERT(NUM_BLOCKS == oa.numBlocksTotal());
+                ASSERT(0          == da.numBlocksTotal());
+
+                Handle copy(handle);
+                ASSERT(2 == handle.use_count());
+                ASSERT(1 == X.numRecordsInUse());
+
+                ASSERT(0 == bsl::get_deleter<void (*)(ball::Record *)>(
+                                                                     handle));
+            }
+            ASSERT(0 == X.numRecordsInUse());
+
+            if (verbose) cout << "\tWeak references." << endl;
+
+            record = mX.getRecord();
+            ASSERT(0 == record->fixedFields().messageRef().length());
+
+            bsl::weak_ptr<ball::Record> weak;
+            {
+                Handle handle = mX.makeHandle(record);
+                weak = handle;
+            }
+            ASSERT(true == weak.expired());
+            ASSERT(1    == X.numRecordsInUse());
+
+            weak.reset();
+            ASSERT(0 == X.numRecordsInUse());
+
+            if (verbose) cout << "\tNegative Testing." << endl;
+            {
+                bsls::AssertTestHandlerGuard hG;
+
+                Obj mY(&oa);
+
+                ball::Record *recordY = mY.getRecord();
+
+                ASSERT_FAIL(mX.makeHandle(0));
+                ASSERT_FAIL(mX.makeHandle(recordY));
+                ASSERT_FAIL(mX.releaseRecord(0));
+                ASSERT_FAIL(mX.releaseRecord(recordY));
+
+                mY.releaseRecord(recordY);
+            }
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // 'getRecord', 'releaseRecord', AND ACCESSORS
+        //
+        // Concerns:
+        //: 1 A default-constructed pool has no records, and uses the supplied
+        //:   (or default) allocator.
+        //:
+        //: 2 'getRecord' returns a distinct record in the default state, and
+        //:   creates a record only if none is available.
+        //:
+        //: 3 'releaseRecord' clears the record and makes it available for
+        //:   reuse, including when more than 'k_BATCH_SIZE' records are
+        //:   released.
+        //:
+        //: 4 'numRecords' and 'numRecordsInUse' report the number of records
+        //:   created and in use, respectively.
+        //:
+        //: 5 The destructor releases all memory, including the memory of
+        //:   records held in a thread cache.
+        //
+        // Plan:
+        //: 1 Create pools with and without an allocator, and verify the
+        //:   accessors.  (C-1)
+        //:
+        //: 2 Obtain and release sets of records of various sizes, and verify
+        //:   the state of the records and the accessors.  (C-2..4)
+        //:
+        //: 3 Destroy a pool having cached records, and verify that no memory
+        //:   is leaked.  (C-5)
+        //
+        // Testing:
+        //   RecordPool(bslma::Allocator *basicAllocator = 0);
+        //   ~RecordPool();
+        //   Record *getRecord();
+        //   void releaseRecord(Record *record);
+        //   int numRecords() const;
+        //   int numRecordsInUse() const;
+        //   bslma::Allocator *allocator() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "'getRecord', 'releaseRecord', AND ACCESSORS"
+                          << endl
+                          << "==========================================="
+                          << endl;
+
+        bslma::TestAllocator         da("default", veryVeryVeryVerbose);
+        bslma::DefaultAllocatorGuard dag(&da);
+
+        {
+            Obj mD;  const Obj& D = mD;
+            ASSERT(&da == D.allocator());
+        }
+        ASSERT(0 == da.numBlocksInUse());
+
+        const bsls::Types::Int64 NUM_DEFAULT_BLOCKS = da.numBlocksTotal();
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+        {
+            Obj mX(&oa);  const Obj& X = mX;
+
+            ASSERT(&oa == X.allocator());
+            ASSERT(0   == X.numRecords());
+            ASSERT(0   == X.numRecordsInUse());
+
+            static const int SIZES[] = {
+                1, 2, Obj::k_BATCH_SIZE - 1, Obj::k_BATCH_SIZE,
+                Obj::k_BATCH_SIZE + 1, 5 * Obj::k_BATCH_SIZE + 3, 7
+            };
+            const int NUM_SIZES = sizeof SIZES / sizeof *SIZES;
+
+            int maxSize = 0;
+            for (int ti = 0; ti < NUM_SIZES; ++ti) {
+                const int SIZE = SIZES[ti];
+
+                if (maxSize < SIZE) {
+                    maxSize = SIZE;
+                }
+
+                bsl::vector<ball::Record *> records(&oa);
+                obtainRecords(&mX, &records, SIZE);
+
+                ASSERTV(SIZE, X.numRecordsInUse(),
+                        SIZE == X.numRecordsInUse());
+                ASSERTV(SIZE, X.numRecords(), maxSize == X.numRecords());
+
+                bsl::set<ball::Record *> distinct(&oa);
+                distinct.insert(records.begin(), records.end());
+                ASSERTV(SIZE, records.size() == distinct.size());
+
+                for (int i = 0; i < SIZE; ++i) {
+                    ASSERTV(SIZE, i, i + 1 ==
+                                     records[i]->fixedFields().lineNumber());
+                    records[i]->fixedFields().setMessage("text");
+                    records[i]->customFields().appendInt64(i);
+                }
+
+                releaseRecords(&mX, &records);
+                ASSERTV(SIZE, 0 == X.numRecordsInUse());
+
+                obtainRecords(&mX, &records, SIZE);
+                for (int i = 0; i < SIZE; ++i) {
+                    const ball::Record& R = *records[i];
+                    ASSERTV(SIZE, i,
+                            0 == R.fixedFields().messageRef().length());
+                    ASSERTV(SIZE, i, 0 == R.customFields().length());
+                }
+                releaseRecords(&mX, &records);
+            }
+
+            // Leave records cached in this thread when 'mX' is destroyed.
+
+            ball::Record *record = mX.getRecord();
+            mX.releaseRecord(record);
+        }
+        ASSERT(0                  == oa.numBlocksInUse());
+        ASSERT(NUM_DEFAULT_BLOCKS == da.numBlocksTotal());
+
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Obtain, share, and release records.
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+        {
+            Obj mX(&oa);  const Obj& X = mX;
+
+            ball::Record *A = mX.getRecord();
+            ball::Record *B = mX.getRecord();
+
+            ASSERT(A != B);
+            ASSERT(2 == X.numRecords());
+            ASSERT(2 == X.numRecordsInUse());
+
+            mX.releaseRecord(A);
+            ASSERT(1 == X.numRecordsInUse());
+            {
+                Handle handle = mX.makeHandle(B);
+                ASSERT(B == handle.get());
+            }
+            ASSERT(0 == X.numRecordsInUse());
+
+            ball::Record *C = mX.getRecord();
+            ASSERT(A == C || B == C);
+            ASSERT(2 == X.numRecords());
+
+            mX.releaseRecord(C);
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    // CONCERN: In no case does memory come from the global allocator.
+
+    LOOP_ASSERT(globalAllocator.numBlocksTotal(),
+                0 == globalAllocator.numBlocksTotal());
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
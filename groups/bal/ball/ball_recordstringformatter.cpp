@@ -25,6 +25,7 @@ BSLS_IDENT_RCSID(ball_recordstringformatter_cpp,"$Id$ $CSID$")
 #include <ball_userfields.h>
 #include <ball_userfieldvalue.h>
 
+#include <bdlb_numericformatutil.h>
 #include <bdlb_print.h>
 
 #include <bdlma_bufferedsequentialallocator.h>
@@ -63,38 +64,22 @@ static void appendToString(bsl::string *result, int value)
     // Convert the specified 'value' into ASCII characters and append it to the
     // specified 'result.
 {
-    char buffer[16];
-
-#if defined(BSLS_PLATFORM_CMP_MSVC)
-#define snprintf _snprintf
-#endif
-
-    snprintf(buffer, sizeof buffer, "%d", value);
-
-#if defined(BSLS_PLATFORM_CMP_MSVC)
-#undef snprintf
-#endif
-
-    *result += buffer;
+    char  buffer[bdlb::NumericFormatUtil::k_INT_MAX_STRLEN];
+    char *end = bdlb::NumericFormatUtil::toChars(buffer,
+                                                 buffer + sizeof buffer,
+                                                 value);
+    result->append(buffer, end);
 }
 
 static void appendToString(bsl::string *result, bsls::Types::Uint64 value)
     // Convert the specified 'value' into ASCII characters and append it to the
     // specified 'result.
 {
-    char buffer[32];
-
-#if defined(BSLS_PLATFORM_CMP_MSVC)
-#define snprintf _snprintf
-#endif
-
-    snprintf(buffer, sizeof buffer, "%llu", value);
-
-#if defined(BSLS_PLATFORM_CMP_MSVC)
-#undef snprintf
-#endif
-
-    *result += buffer;
+    char  buffer[bdlb::NumericFormatUtil::k_INT64_MAX_STRLEN];
+    char *end = bdlb::NumericFormatUtil::toChars(buffer,
+                                                 buffer + sizeof buffer,
+                                                 value);
+    result->append(buffer, end);
 }
 
 static void appendToStringAsHex(bsl::string *result, bsls::Types::Uint64 value)
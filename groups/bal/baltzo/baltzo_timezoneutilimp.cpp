@@ -220,15 +220,15 @@ int TimeZoneUtilImp::convertUtcToLocalTime(
         return rc;                                                    // RETURN
     }
 
-    Zoneinfo::TransitionConstIterator it;
-    rc = ZoneinfoUtil::convertUtcToLocalTime(result,
-                                             &it,
-                                             utcTime,
-                                             *timeZone);
-    if (0 != rc) {
-        return rc;                                                    // RETURN
-    }
-    return 0;
+    // The transition is obtained from 'cache', which remembers the transition
+    // found last by the calling thread.
+
+    return ZoneinfoUtil::convertUtcToLocalTime(
+                            result,
+                            utcTime,
+                            *timeZone,
+                            cache->findTransitionForUtcTime(*timeZone,
+                                                            utcTime));
 }
 
 int TimeZoneUtilImp::initLocalTime(bdlt::DatetimeTz        *result,
@@ -278,7 +278,8 @@ int TimeZoneUtilImp::loadLocalTimePeriodForUtc(
     bdlt::DatetimeTz                          localTime;
 
     Zoneinfo::TransitionConstIterator iter =
-                                   timeZone->findTransitionForUtcTime(utcTime);
+                                     cache->findTransitionForUtcTime(*timeZone,
+                                                                     utcTime);
 
     createLocalTimePeriod(result, iter, *timeZone);
     return 0;
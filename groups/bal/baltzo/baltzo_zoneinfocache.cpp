@@ -8,8 +8,9 @@ BSLS_IDENT_RCSID(baltzo_zoneinfocache_cpp,"$Id$ $CSID$")
 #include <baltzo_zoneinfocache.h>
 #include <baltzo_zoneinfoutil.h>
 
-#include <bslmt_readlockguard.h>
-#include <bslmt_writelockguard.h>
+#include <bdlt_epochutil.h>
+
+#include <bslmt_lockguard.h>
 
 #include <bslma_allocator.h>
 #include <bslma_rawdeleterproctor.h>
@@ -17,7 +18,12 @@ BSLS_IDENT_RCSID(baltzo_zoneinfocache_cpp,"$Id$ $CSID$")
 #include <bslmf_assert.h>
 
 #include <bsls_log.h>
+#include <bsls_performancehint.h>
+#include <bsls_types.h>
 
+#include <bsl_algorithm.h>
+#include <bsl_cstring.h>
+#include <bsl_limits.h>
 #include <bsl_ostream.h>
 #include <bsl_set.h>
 #include <bsl_string.h>
@@ -25,13 +31,165 @@ BSLS_IDENT_RCSID(baltzo_zoneinfocache_cpp,"$Id$ $CSID$")
 namespace BloombergLP {
 namespace baltzo {
 
+namespace {
+
+                         // =========================
+                         // struct ZoneinfoCache_Less
+                         // =========================
+
+struct ZoneinfoCache_Less {
+    // This component-private 'struct' provides a comparator ordering entries
+    // of a table of cached time zones, and time-zone identifiers, by
+    // identifier.
+
+    // TYPES
+    typedef bsl::pair<const char *, const Zoneinfo *> Entry;
+
+    // ACCESSORS
+    bool operator()(const Entry& entry, const char *timeZoneId) const
+        // Return 'true' if the identifier of the specified 'entry' is ordered
+        // before the specified 'timeZoneId', and 'false' otherwise.
+    {
+        return bsl::strcmp(entry.first, timeZoneId) < 0;
+    }
+};
+
+}  // close unnamed namespace
+
+                      // ================================
+                      // struct ZoneinfoCache_ThreadCache
+                      // ================================
+
+struct ZoneinfoCache_ThreadCache {
+    // This component-private 'struct' holds the transition found last by one
+    // thread.  A cache is owned by its 'ZoneinfoCache', and is reused by
+    // another thread after the thread using it exits.
+
+    // DATA
+    const Zoneinfo                    *d_timeZone_p;  // time zone of
+                                                      // 'd_transition', or 0
+
+    Zoneinfo::TransitionConstIterator  d_transition;  // transition found last
+
+    bsls::Types::Int64                 d_startTime;   // time (since epoch) of
+                                                      // 'd_transition'
+
+    bsls::Types::Int64                 d_endTime;     // time (since epoch) of
+                                                      // the next transition
+
+    bsls::AtomicBool                   d_isInUse;     // 'true' if the cache
+                                                      // belongs to a thread
+
+    ZoneinfoCache_ThreadCache         *d_next_p;      // next cache of the
+                                                      // 'ZoneinfoCache'
+
+    // CLASS METHODS
+    static void threadExit(void *cache);
+        // Make the specified 'cache' available for reuse.  This function is
+        // invoked when a thread having a cache exits.
+};
+
+                      // --------------------------------
+                      // struct ZoneinfoCache_ThreadCache
+                      // --------------------------------
+
+// CLASS METHODS
+void ZoneinfoCache_ThreadCache::threadExit(void *cache)
+{
+    ZoneinfoCache_ThreadCache *threadCache =
+                              static_cast<ZoneinfoCache_ThreadCache *>(cache);
+
+    threadCache->d_timeZone_p = 0;
+    threadCache->d_isInUse.storeRelease(false);
+}
+
                             // -------------------
                             // class ZoneinfoCache
                             // -------------------
 
+// PRIVATE ACCESSORS
+ZoneinfoCache_ThreadCache *ZoneinfoCache::lookupThreadCache() const
+{
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(!d_hasThreadCacheKey)) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        return 0;                                                     // RETURN
+    }
+
+    ZoneinfoCache_ThreadCache *cache =
+                                 static_cast<ZoneinfoCache_ThreadCache *>(
+                            bslmt::ThreadUtil::getSpecific(d_threadCacheKey));
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(0 != cache)) {
+        return cache;                                                 // RETURN
+    }
+
+    // The calling thread has no cache: reuse the cache of an exited thread, or
+    // create a new one.
+
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_threadCachesLock);
+
+    for (cache = d_threadCaches_p; cache; cache = cache->d_next_p) {
+        if (!cache->d_isInUse.loadAcquire()) {
+            break;
+        }
+    }
+
+    if (!cache) {
+        cache = new (*d_allocator_p) ZoneinfoCache_ThreadCache();
+
+        cache->d_timeZone_p = 0;
+        cache->d_startTime  = 0;
+        cache->d_endTime    = 0;
+        cache->d_next_p     = d_threadCaches_p;
+        d_threadCaches_p    = cache;
+    }
+
+    if (0 != bslmt::ThreadUtil::setSpecific(d_threadCacheKey, cache)) {
+        return 0;                                                     // RETURN
+    }
+
+    cache->d_isInUse.storeRelease(true);
+    return cache;
+}
+
 // CREATORS
+ZoneinfoCache::ZoneinfoCache(Loader *loader, bslma::Allocator *basicAllocator)
+: d_cache(basicAllocator)
+, d_table_p(0)
+, d_tables(basicAllocator)
+, d_loader_p(loader)
+, d_hasThreadCacheKey(false)
+, d_threadCaches_p(0)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    BSLS_ASSERT(0 != loader);
+
+    d_hasThreadCacheKey = 0 == bslmt::ThreadUtil::createKey(
+                                    &d_threadCacheKey,
+                                    (bslmt::ThreadUtil::Destructor)
+                                    &ZoneinfoCache_ThreadCache::threadExit);
+}
+
 ZoneinfoCache::~ZoneinfoCache()
 {
+    if (d_hasThreadCacheKey) {
+        bslmt::ThreadUtil::setSpecific(d_threadCacheKey, 0);
+        bslmt::ThreadUtil::deleteKey(d_threadCacheKey);
+    }
+
+    ZoneinfoCache_ThreadCache *threadCache = d_threadCaches_p;
+    while (threadCache) {
+        ZoneinfoCache_ThreadCache *next = threadCache->d_next_p;
+        d_allocator_p->deleteObject(threadCache);
+        threadCache = next;
+    }
+
+    for (bsl::vector<Table *>::iterator it  = d_tables.begin();
+                                        it != d_tables.end();
+                                        ++it) {
+        d_allocator_p->deleteObject(*it);
+    }
+
     for (ZoneinfoMap::iterator it  = d_cache.begin();
                                it != d_cache.end();
                                ++it) {
@@ -61,7 +219,7 @@ const Zoneinfo *ZoneinfoCache::getZoneinfo(int *rc, const char *timeZoneId)
         return result;                                                // RETURN
     }
 
-    bslmt::WriteLockGuard<bslmt::RWMutex> guard(&d_lock);
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_lock);
 
     // We use 'lower_bound' to return the position where the 'timeZoneId'
     // should be (even if it is not in the map), so that it can be used as an
@@ -110,6 +268,18 @@ const Zoneinfo *ZoneinfoCache::getZoneinfo(int *rc, const char *timeZoneId)
             return 0;                                                 // RETURN
         }
 
+        // Allocate the table replacing the published one before modifying
+        // 'd_cache', so that the operations following the insertion cannot
+        // throw.
+
+        Table *newTable = new (*d_allocator_p) Table(d_allocator_p);
+
+        bslma::RawDeleterProctor<Table, bslma::Allocator>
+                                        tableProctor(newTable, d_allocator_p);
+
+        newTable->reserve(d_cache.size() + 1);
+        d_tables.reserve(d_tables.size() + 1);
+
         d_cache.insert(
                   it,
                   ZoneinfoMap::value_type(newTimeZonePtr->identifier().c_str(),
@@ -119,20 +289,74 @@ const Zoneinfo *ZoneinfoCache::getZoneinfo(int *rc, const char *timeZoneId)
         // The pointer has been copied, so the proctor must release ownership.
 
         proctor.release();
+
+        for (ZoneinfoMap::const_iterator cacheIt  = d_cache.begin();
+                                         cacheIt != d_cache.end();
+                                         ++cacheIt) {
+            newTable->push_back(TableEntry(cacheIt->first, cacheIt->second));
+        }
+        d_tables.push_back(newTable);
+        tableProctor.release();
+
+        // Readers may still be searching the table being replaced, which is
+        // therefore kept until this object is destroyed.
+
+        d_table_p.storeRelease(newTable);
     }
 
     return result;
 }
 
 // ACCESSORS
+Zoneinfo::TransitionConstIterator ZoneinfoCache::findTransitionForUtcTime(
+                                           const Zoneinfo&       timeZone,
+                                           const bdlt::Datetime& utcTime) const
+{
+    ZoneinfoCache_ThreadCache *cache = lookupThreadCache();
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(!cache)) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        return timeZone.findTransitionForUtcTime(utcTime);            // RETURN
+    }
+
+    const bsls::Types::Int64 utcTimeT64 =
+                                    bdlt::EpochUtil::convertToTimeT64(utcTime);
+
+    if (&timeZone           == cache->d_timeZone_p
+     && cache->d_startTime  <= utcTimeT64
+     && cache->d_endTime    >  utcTimeT64) {
+        return cache->d_transition;                                   // RETURN
+    }
+
+    Zoneinfo::TransitionConstIterator it =
+                                    timeZone.findTransitionForUtcTime(utcTime);
+    Zoneinfo::TransitionConstIterator next = it;
+    ++next;
+
+    cache->d_timeZone_p = &timeZone;
+    cache->d_transition = it;
+    cache->d_startTime  = it->utcTime();
+    cache->d_endTime    = timeZone.endTransitions() != next
+                        ? next->utcTime()
+                        : bsl::numeric_limits<bsls::Types::Int64>::max();
+
+    return it;
+}
+
 const Zoneinfo *ZoneinfoCache::lookupZoneinfo(const char *timeZoneId) const
 {
     BSLS_ASSERT(0 != timeZoneId);
 
-    bslmt::ReadLockGuard<bslmt::RWMutex> guard(&d_lock);
+    const Table *table = d_table_p.loadAcquire();
+    if (0 == table) {
+        return 0;                                                     // RETURN
+    }
 
-    ZoneinfoMap::const_iterator it = d_cache.find(timeZoneId);
-    if (d_cache.end() != it) {
+    Table::const_iterator it = bsl::lower_bound(table->begin(),
+                                                table->end(),
+                                                timeZoneId,
+                                                ZoneinfoCache_Less());
+    if (table->end() != it && 0 == bsl::strcmp(it->first, timeZoneId)) {
         return it->second;                                            // RETURN
     }
     return 0;
@@ -22,6 +22,23 @@ BSLS_IDENT("$Id: $")
 // 'getZoneinfo' and 'lookupZoneinfo'.  Addresses returned by either of these
 // methods are valid for the lifetime of the cache.
 //
+// In addition, the 'findTransitionForUtcTime' method returns the transition,
+// in a cached time zone, in effect at a UTC time.  The transition found last
+// by each thread is remembered, so that consecutive conversions by a thread,
+// in the same time zone and between the same two transitions, do not search
+// the transitions of the time zone.
+//
+///Performance
+///-----------
+// Retrieving previously cached information does not acquire a lock: the
+// identifiers and addresses of the cached time zones are held in a sorted
+// table that is replaced, rather than modified, when a time zone is added to
+// the cache, and 'getZoneinfo' and 'lookupZoneinfo' search the most recently
+// published table.  Replaced tables are kept until the cache is destroyed, so
+// that the memory used by the tables is quadratic in the number of cached time
+// zones; time zones are added infrequently, and their number is small in
+// practice.  Loading a time zone not yet cached is serialized by a mutex.
+//
 ///Thread Safety
 ///-------------
 // 'baltzo::ZoneinfoCache' is fully *thread-safe*, meaning that all non-creator
@@ -151,19 +168,24 @@ BSLS_IDENT("$Id: $")
 
 #include <bdlb_cstringless.h>
 
+#include <bdlt_datetime.h>
+
 #include <bslma_allocator.h>
 #include <bslma_default.h>
 #include <bslma_usesbslmaallocator.h>
 
 #include <bslmf_nestedtraitdeclaration.h>
 
-#include <bslmt_rwmutex.h>
+#include <bslmt_mutex.h>
+#include <bslmt_threadutil.h>
 
 #include <bsls_assert.h>
 #include <bsls_atomic.h>
 #include <bsls_review.h>
 
 #include <bsl_map.h>
+#include <bsl_utility.h>
+#include <bsl_vector.h>
 
 namespace BloombergLP {
 
@@ -171,6 +193,8 @@ namespace bslma { class Allocator; }
 
 namespace baltzo {
 
+struct ZoneinfoCache_ThreadCache;
+
                             // ===================
                             // class ZoneinfoCache
                             // ===================
@@ -192,18 +216,56 @@ class ZoneinfoCache {
     // PRIVATE TYPES
     typedef bsl::map<const char *, Zoneinfo *, bdlb::CStringLess> ZoneinfoMap;
 
+    typedef bsl::pair<const char *, const Zoneinfo *> TableEntry;
+        // An identifier and the address of the cached time-zone information
+        // it identifies.
+
+    typedef bsl::vector<TableEntry> Table;
+        // A sequence of entries sorted by identifier.
+
     // DATA
     ZoneinfoMap              d_cache;        // cached time-zone info, indexed
-                                             // by time-zone id
+                                             // by time-zone id (owned),
+                                             // guarded by 'd_lock'
+
+    bsls::AtomicPointer<const Table>
+                             d_table_p;      // most recently published copy
+                                             // of 'd_cache', or 0 if the
+                                             // cache is empty
+
+    bsl::vector<Table *>     d_tables;       // all tables published (owned),
+                                             // guarded by 'd_lock'
 
     Loader                  *d_loader_p;     // loader used to obtain time-zone
                                              // information (held, not owned)
 
-    mutable bslmt::RWMutex  d_lock;         // cache access synchronization
+    bslmt::Mutex             d_lock;         // serializes loading
+
+    bslmt::ThreadUtil::Key   d_threadCacheKey;
+                                             // key of the calling thread's
+                                             // cache
+
+    bool                     d_hasThreadCacheKey;
+                                             // 'true' if 'd_threadCacheKey'
+                                             // was created
+
+    mutable bslmt::Mutex     d_threadCachesLock;
+                                             // guards 'd_threadCaches_p'
+
+    mutable ZoneinfoCache_ThreadCache
+                            *d_threadCaches_p;
+                                             // list of all thread caches
+                                             // (owned)
 
     bslma::Allocator        *d_allocator_p;  // allocator (held, not owned)
 
   private:
+    // PRIVATE ACCESSORS
+    ZoneinfoCache_ThreadCache *lookupThreadCache() const;
+        // Return the address of the cache of the calling thread, creating it
+        // if the calling thread has none, or 0 if per-thread caches are not
+        // available.
+
     // NOT IMPLEMENTED
     ZoneinfoCache(const ZoneinfoCache&);
     ZoneinfoCache& operator=(const ZoneinfoCache&);
@@ -248,6 +310,21 @@ class ZoneinfoCache {
         // 'rc' is 0.
 
     // ACCESSORS
+    Zoneinfo::TransitionConstIterator findTransitionForUtcTime(
+                                          const Zoneinfo&       timeZone,
+                                          const bdlt::Datetime& utcTime) const;
+        // Return an iterator providing non-modifiable access to the transition
+        // in the specified 'timeZone' that holds the local-time descriptor
+        // associated with the specified 'utcTime'.  The returned value is the
+        // same as that of 'timeZone.findTransitionForUtcTime(utcTime)', but
+        // the transitions of 'timeZone' are not searched if 'utcTime' falls
+        // between the same two transitions in 'timeZone' as the UTC time
+        // supplied to the previous call to this method by the calling thread.
+        // The behavior is undefined unless 'timeZone' is a time zone returned
+        // by 'getZoneinfo' or 'lookupZoneinfo' on this object, and 'utcTime'
+        // is at or after the transition returned by
+        // 'timeZone.firstTransition()'.
+
     const Zoneinfo *lookupZoneinfo(const char *timeZoneId) const;
         // Return the address of the non-modifiable cached description of the
         // time zone identified by the specified 'timeZoneId', and 0 if
@@ -266,16 +343,6 @@ class ZoneinfoCache {
                             // class ZoneinfoCache
                             // -------------------
 
-// CREATORS
-inline
-ZoneinfoCache::ZoneinfoCache(Loader *loader, bslma::Allocator *basicAllocator)
-: d_cache(basicAllocator)
-, d_loader_p(loader)
-, d_allocator_p(bslma::Default::allocator(basicAllocator))
-{
-    BSLS_ASSERT(0 != loader);
-}
-
 // MANIPULATORS
 inline
 const Zoneinfo *ZoneinfoCache::getZoneinfo(const char *timeZoneId)
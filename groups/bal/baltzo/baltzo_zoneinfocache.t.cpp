@@ -74,10 +74,11 @@ using namespace std;
 // [ 4] const baltzo::Zoneinfo *getZoneinfo(int *rc, const char *timeZoneId);
 //
 // ACCESSORS
+// [ 8] TransitionConstIterator findTransitionForUtcTime(tz, utc) const;
 // [ 6] const baltzo::Zoneinfo *lookupZoneinfo(const char *timeZoneId) const;
 // ----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
-// [ 8] USAGE EXAMPLE
+// [ 9] USAGE EXAMPLE
 // [ 7] CONCERN: All methods are thread-safe
 // [ 6] CONCERN: ACCESSOR methods are declared 'const'.
 // [ 5] CONCERN: CREATOR & MANIPULATOR parameters are declared 'const'.
@@ -488,6 +489,109 @@ extern "C" void *workerThread(void *arg)
 
 }  // close namespace BALTZO_ZONEINFOCACHE_CONCURRENCY
 
+// ============================================================================
+//                   'findTransitionForUtcTime' TEST ENTRIES
+// ----------------------------------------------------------------------------
+
+namespace BALTZO_ZONEINFOCACHE_TRANSITIONS {
+
+enum {
+    k_NUM_TRANSITIONS = 200,          // transitions in each test time zone
+
+    k_TRANSITION_INTERVAL = 1000000,  // seconds between transitions
+
+    k_NUM_LOOKUPS = 2000              // lookups by each thread
+};
+
+void loadTimeZone(Zone *result, const char *timeZoneId, int utcOffsetStep)
+    // Load into the specified 'result' a well-formed time zone having the
+    // specified 'timeZoneId' and 'k_NUM_TRANSITIONS' transitions, the first
+    // at 1/1/1, and the others starting at the epoch and separated by
+    // 'k_TRANSITION_INTERVAL' seconds, the 'i'th transition having a UTC
+    // offset of 'i' times the specified 'utcOffsetStep' minutes.
+{
+    result->setIdentifier(timeZoneId);
+
+    const bsls::Types::Int64 firstTime =
+                   bdlt::EpochUtil::convertToTimeT64(bdlt::Datetime(1, 1, 1));
+
+    for (int i = 0; i < k_NUM_TRANSITIONS; ++i) {
+        const Desc descriptor(i * utcOffsetStep * 60, 1 == i % 2, "X");
+
+        const bsls::Types::Int64 time =
+                0 == i ? firstTime
+                       : static_cast<bsls::Types::Int64>(i - 1) *
+                                                         k_TRANSITION_INTERVAL;
+        result->addTransition(time, descriptor);
+    }
+}
+
+bdlt::Datetime utcTimeFor(unsigned int seed)
+    // Return a UTC time, determined by the specified 'seed', between one
+    // transition interval before the epoch and one after the last transition
+    // of the time zones loaded by 'loadTimeZone'.
+{
+    const bsls::Types::Int64 span =
+                     static_cast<bsls::Types::Int64>(k_NUM_TRANSITIONS + 1) *
+                                                         k_TRANSITION_INTERVAL;
+
+    bdlt::Datetime result;
+    bdlt::EpochUtil::convertFromTimeT64(
+                           &result,
+                           static_cast<bsls::Types::Int64>(seed) % span
+                                                      - k_TRANSITION_INTERVAL);
+    return result;
+}
+
+struct ThreadData {
+    const Obj      *d_cache_p;       // cache under test
+    const Zone     *d_timeZones[2];  // time zones held by 'd_cache_p'
+    bslmt::Barrier *d_barrier_p;     // testing barrier
+};
+
+extern "C" void *lookupThread(void *arg)
+    // Look up, using the cache described by the specified 'arg', transitions
+    // for a sequence of UTC times that mostly increase slowly, alternating
+    // between two time zones at times, and verify the results.
+{
+    ThreadData *p = static_cast<ThreadData *>(arg);
+
+    const Obj& X = *p->d_cache_p;
+
+    // Ensure each thread looks up a transition before any thread exits.
+
+    const Zone&          FIRST_TZ = *p->d_timeZones[0];
+    const bdlt::Datetime FIRST_UTC(1, 1, 1);
+    ASSERT(FIRST_TZ.beginTransitions() ==
+                              X.findTransitionForUtcTime(FIRST_TZ, FIRST_UTC));
+
+    p->d_barrier_p->wait();
+
+    unsigned int seed = static_cast<unsigned int>(
+                        bslmt::ThreadUtil::selfIdAsUint64() % 1000) * 7919;
+
+    bsls::Types::Int64 offset = seed % (k_NUM_TRANSITIONS *
+                               static_cast<bsls::Types::Int64>(
+                                                      k_TRANSITION_INTERVAL));
+
+    for (int i = 0; i < k_NUM_LOOKUPS; ++i) {
+        seed = seed * 1103515245 + 12345;
+
+        const Zone& TZ = *p->d_timeZones[(seed >> 16) % 8 == 0 ? 1 : 0];
+
+        offset += (seed >> 8) % (k_TRANSITION_INTERVAL / 4);
+
+        const bdlt::Datetime UTC = utcTimeFor(
+                                         static_cast<unsigned int>(offset));
+
+        ASSERT(TZ.findTransitionForUtcTime(UTC) ==
+                                          X.findTransitionForUtcTime(TZ, UTC));
+    }
+    return 0;
+}
+
+}  // close namespace BALTZO_ZONEINFOCACHE_TRANSITIONS
+
 // ============================================================================
 //                               USAGE EXAMPLE
 // ----------------------------------------------------------------------------
@@ -619,7 +723,7 @@ int main(int argc, char *argv[])
     }
 
     switch (test) { case 0:
-      case 8: {
+      case 9: {
         // --------------------------------------------------------------------
         // TESTING USAGE EXAMPLE
         //   The usage example provided in the component header file must
@@ -753,6 +857,133 @@ int main(int argc, char *argv[])
 //..
 
       } break;
+      case 8: {
+        // --------------------------------------------------------------------
+        // TESTING 'findTransitionForUtcTime'
+        //
+        // Concerns:
+        //: 1 'findTransitionForUtcTime' returns the same iterator as the
+        //:   'findTransitionForUtcTime' method of the supplied time zone, for
+        //:   UTC times before, at, between, and after transitions.
+        //:
+        //: 2 The transition remembered for one time zone is not returned for
+        //:   another time zone.
+        //:
+        //: 3 The transitions remembered by different threads are independent.
+        //:
+        //: 4 The memory used to remember the transitions found by a thread is
+        //:   reused after the thread exits, and is supplied by the object
+        //:   allocator.
+        //
+        // Plan:
+        //: 1 Create a cache holding two time zones having many transitions,
+        //:   and compare the results of 'findTransitionForUtcTime' with those
+        //:   of the time zones for UTC times at, and one second around, each
+        //:   transition in increasing and decreasing order, and for times in
+        //:   a pseudo-random order.  (C-1)
+        //:
+        //: 2 Repeat P-1, alternating between the two time zones.  (C-2)
+        //:
+        //: 3 Perform lookups, verified as in P-1, concurrently from several
+        //:   threads.  (C-3)
+        //:
+        //: 4 Repeat P-3 and verify that the number of blocks allocated from
+        //:   the object allocator is unchanged, and that no memory is
+        //:   allocated from the default allocator.  (C-4)
+        //
+        // Testing:
+        //   TransitionConstIterator findTransitionForUtcTime(tz, utc) const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl << "TESTING 'findTransitionForUtcTime'"
+                          << endl << "=================================="
+                          << endl;
+
+        using namespace BALTZO_ZONEINFOCACHE_TRANSITIONS;
+
+        // A 'bslma::TestAllocator' is required for thread safe allocations.
+        bslma::TestAllocator oa("object", veryVeryVerbose);
+
+        TestLoader testLoader(&oa);
+        {
+            Zone timeZone(&oa);
+            loadTimeZone(&timeZone, "ID_A", 1);
+            testLoader.setTimeZone(timeZone);
+        }
+        {
+            Zone timeZone(&oa);
+            loadTimeZone(&timeZone, "ID_B", -1);
+            testLoader.setTimeZone(timeZone);
+        }
+
+        Obj mX(&testLoader, &oa); const Obj& X = mX;
+
+        const Zone *TZ_A = mX.getZoneinfo("ID_A");
+        const Zone *TZ_B = mX.getZoneinfo("ID_B");
+        ASSERT(0 != TZ_A);
+        ASSERT(0 != TZ_B);
+
+        if (verbose) cout << "\tTesting times around each transition." << endl;
+        {
+            for (int pass = 0; pass < 3; ++pass) {
+                for (int j = 0; j < 3 * (k_NUM_TRANSITIONS - 1); ++j) {
+                    const int TI     = 0 == pass % 2
+                                     ? j / 3
+                                     : k_NUM_TRANSITIONS - 2 - j / 3;
+                    const int DELTA  = j % 3 - 1;
+                    const Zone& TZ   = 2 == pass && 1 == j % 2 ? *TZ_B
+                                                                : *TZ_A;
+
+                    bdlt::Datetime utc;
+                    bdlt::EpochUtil::convertFromTimeT64(
+                           &utc,
+                           static_cast<bsls::Types::Int64>(TI) *
+                                                   k_TRANSITION_INTERVAL +
+                                                                       DELTA);
+
+                    LOOP3_ASSERT(pass, TI, DELTA,
+                                 TZ.findTransitionForUtcTime(utc) ==
+                                          X.findTransitionForUtcTime(TZ, utc));
+                }
+            }
+
+            const bdlt::Datetime FIRST(1, 1, 1);
+            ASSERT(TZ_A->beginTransitions() ==
+                                     X.findTransitionForUtcTime(*TZ_A, FIRST));
+        }
+
+        if (verbose) cout << "\tTesting pseudo-random times." << endl;
+        {
+            unsigned int seed = 12345;
+            for (int i = 0; i < 10000; ++i) {
+                seed = seed * 1103515245 + 12345;
+
+                const Zone&          TZ  = 0 == (seed >> 20) % 2 ? *TZ_A
+                                                                 : *TZ_B;
+                const bdlt::Datetime UTC = utcTimeFor(seed);
+
+                LOOP_ASSERT(i, TZ.findTransitionForUtcTime(UTC) ==
+                                          X.findTransitionForUtcTime(TZ, UTC));
+            }
+        }
+
+        if (verbose) cout << "\tTesting concurrent lookups." << endl;
+        {
+            enum { NUM_THREADS = 8 };
+
+            bslmt::Barrier barrier(NUM_THREADS);
+            ThreadData     args = { &X, { TZ_A, TZ_B }, &barrier };
+
+            executeInParallel(NUM_THREADS, lookupThread, &args);
+
+            const bsls::Types::Int64 NUM_BLOCKS = oa.numBlocksInUse();
+
+            executeInParallel(NUM_THREADS, lookupThread, &args);
+
+            ASSERT(NUM_BLOCKS == oa.numBlocksInUse());
+            ASSERT(0          == defaultAllocator.numBlocksInUse());
+        }
+      } break;
       case 7: {
         // --------------------------------------------------------------------
         // TESTING CONCURRENT ACCESS
@@ -40,10 +40,24 @@ int ZoneinfoUtil::convertUtcToLocalTime(
 
     Zoneinfo::TransitionConstIterator it =
                                     timeZone.findTransitionForUtcTime(utcTime);
-    BSLS_ASSERT(it != timeZone.endTransitions());
 
     *resultTransition = it;
-    const int offset = it->descriptor().utcOffsetInSeconds();
+    return convertUtcToLocalTime(resultTime, utcTime, timeZone, it);
+}
+
+int ZoneinfoUtil::convertUtcToLocalTime(
+                               bdlt::DatetimeTz                  *resultTime,
+                               const bdlt::Datetime&              utcTime,
+                               const Zoneinfo&                    timeZone,
+                               Zoneinfo::TransitionConstIterator  transition)
+{
+    BSLS_ASSERT(resultTime);
+    BSLS_ASSERT(transition != timeZone.endTransitions());
+    BSLS_ASSERT_SAFE(isWellFormed(timeZone));
+    BSLS_ASSERT_SAFE(transition ==
+                                  timeZone.findTransitionForUtcTime(utcTime));
+
+    const int offset = transition->descriptor().utcOffsetInSeconds();
     const int offsetInMinutes = offset / 60;
 
     bdlt::Datetime temp(utcTime);
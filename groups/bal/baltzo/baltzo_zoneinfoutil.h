@@ -381,6 +381,20 @@ struct ZoneinfoUtil {
         // of the legal range that a 'bdlt::DatetimeTz' can represent.  The
         // behavior is undefined unless 'isWellFormed(timeZone)' is 'true'.
 
+    static int convertUtcToLocalTime(
+                               bdlt::DatetimeTz                  *resultTime,
+                               const bdlt::Datetime&              utcTime,
+                               const Zoneinfo&                    timeZone,
+                               Zoneinfo::TransitionConstIterator  transition);
+        // Load, into the specified 'resultTime', the local date-time value, in
+        // the specified 'timeZone', corresponding to the specified 'utcTime',
+        // using the specified 'transition', already found in 'timeZone' for
+        // 'utcTime' (e.g., by a cache of transitions).  Return 0 on success,
+        // and 'baltzo::ErrorCode::k_OUT_OF_RANGE' if 'resultTime' would be
+        // outside of the legal range that a 'bdlt::DatetimeTz' can represent.
+        // The behavior is undefined unless 'isWellFormed(timeZone)' is 'true'
+        // and 'transition == timeZone.findTransitionForUtcTime(utcTime)'.
+
     static void loadRelevantTransitions(
                      Zoneinfo::TransitionConstIterator *firstResultTransition,
                      Zoneinfo::TransitionConstIterator *secondResultTransition,
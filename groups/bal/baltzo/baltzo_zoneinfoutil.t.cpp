@@ -54,6 +54,7 @@ using namespace std;
 //-----------------------------------------------------------------------------
 // CLASS METHODS
 // [ 3] void convertUtcToLocalTime(DatetimeTz *, Transition *, UTC, Zone);
+// [ 4] int convertUtcToLocalTime(DatetimeTz *, UTC, Zone, Transition);
 // [ 4] void loadRelevantTransitions(TIt *, TIt *, Valid *, localTime, TZ);
 // [ 2] bool isWellFormed(const baltzo::Zoneinfo& timeZone);
 // ----------------------------------------------------------------------------
@@ -1185,6 +1186,9 @@ int main(int argc, char *argv[])
         //:
         //: 5 That the function returns 'ErrorCode::k_OUT_OF_RANGE' when
         //:   'result' would be out of range.
+        //:
+        //: 6 The overload taking a transition already found produces the same
+        //:   results as the overload finding it.
         //
         // Plan:
         //: 1 Using a table-driven approach (C-1):
@@ -1233,9 +1237,14 @@ int main(int argc, char *argv[])
         //:   macros).  (C-4)
         //:
         //: 5 Do a test that provokes a return code of 'k_OUT_OF_RANGE'.  (C-5)
+        //:
+        //: 6 In P-1, P-4, and P-5, also call the overload taking the
+        //:   transition returned by the other overload, and compare the
+        //:   results.  (C-4..6)
         //
         // Testing:
         //   void convertUtcToLocalTime(DatetimeTz *, Transition *, UTC, Zone);
+        //   int convertUtcToLocalTime(DatetimeTz *, UTC, Zone, Transition);
         // --------------------------------------------------------------------
 
         if (verbose) cout << endl
@@ -1302,6 +1311,13 @@ int main(int argc, char *argv[])
                     ASSERT(expLocal    == result.localDatetime());
                     ASSERT(expTzOffset == result.offset());
                     ASSERT(resultIt    == TZ.findTransitionForUtcTime(VALUE));
+
+                    bdlt::DatetimeTz result2;
+                    ASSERT(0 == Obj::convertUtcToLocalTime(&result2,
+                                                           VALUE,
+                                                           TZ,
+                                                           resultIt));
+                    ASSERT(result == result2);
                 }
             }
         }
@@ -1427,6 +1443,33 @@ int main(int argc, char *argv[])
                                                    &resultIt,
                                                    time,
                                                    TZ));
+
+            const TzIt FIRST = TZ.beginTransitions();
+
+            ASSERT_PASS(Obj::convertUtcToLocalTime(&result, time, TZ, FIRST));
+            ASSERT_FAIL(Obj::convertUtcToLocalTime(0, time, TZ, FIRST));
+            ASSERT_FAIL(Obj::convertUtcToLocalTime(&result,
+                                                   time,
+                                                   TZ,
+                                                   TZ.endTransitions()));
+
+            // 'time' follows a second transition.
+
+            tz.addTransition(toTimeT(bdlt::Datetime(2000, 1, 1)),
+                             Desc(60, false, ""));
+
+            TzIt second = TZ.beginTransitions();
+            ++second;
+
+            ASSERT_SAFE_FAIL(Obj::convertUtcToLocalTime(
+                                                     &result,
+                                                     time,
+                                                     TZ,
+                                                     TZ.beginTransitions()));
+            ASSERT_SAFE_PASS(Obj::convertUtcToLocalTime(&result,
+                                                        time,
+                                                        TZ,
+                                                        second));
         }
 
         {
@@ -1446,6 +1489,9 @@ int main(int argc, char *argv[])
                                                     TIME,
                                                     TZ);
                 ASSERTV(rc, baltzo::ErrorCode::k_OUT_OF_RANGE == rc);
+
+                rc = Obj::convertUtcToLocalTime(&result, TIME, TZ, resultIt);
+                ASSERTV(rc, baltzo::ErrorCode::k_OUT_OF_RANGE == rc);
             }
         }
       } break;
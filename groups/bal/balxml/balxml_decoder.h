@@ -51,6 +51,15 @@ BSLS_IDENT("$Id: $")
 // to use a binary encoding (such as BER) if the encoding format is under your
 // control.  (See 'balber_berdecoder'.)
 //
+///Decoding into an Arena
+///----------------------
+// To decode a stream of short-lived documents cheaply, construct each decoded
+// object with a 'bdlma::SequentialAllocator', call 'reserveCapacity' on it
+// with 'arenaSizeHint' of the document length before decoding, and 'rewind'
+// it afterwards.  The 'Decoder' and the 'balxml::MiniReader' it uses keep
+// their buffers between documents, so neither allocates once the largest
+// document has been read.  See {Example 3} below.
+//
 ///Usage
 ///-----
 // This section illustrates intended use of this component.
@@ -253,6 +262,65 @@ BSLS_IDENT("$Id: $")
 //      return 0;
 //  }
 //..
+//
+///Example 3: Decoding Request-Scoped Messages into an Arena
+///- - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose that a service decodes a large number of 'test::Employee' messages
+// (from the 'test_employee' component of the first example), each of which is
+// processed and then discarded.  The following snippets of code illustrate how
+// to reuse one decoder for all the messages, and decode each message into an
+// object whose memory is supplied by an arena that is rewound after each
+// message:
+//..
+//  int main()
+//  {
+//      const char *const MESSAGES[] = {
+//          "<Employee><name>Alice</name><homeAddress><street>Fifth Ave"
+//          "</street><city>New York</city><state>NY</state></homeAddress>"
+//          "<age>34</age></Employee>",
+//
+//          "<Employee><name>Bob</name><homeAddress><street>Some Street"
+//          "</street><city>Some City</city><state>Some State</state>"
+//          "</homeAddress><age>21</age></Employee>"
+//      };
+//      const int NUM_MESSAGES = sizeof MESSAGES / sizeof *MESSAGES;
+//
+//      balxml::MiniReader         reader;
+//      balxml::ErrorInfo          errInfo;
+//      balxml::DecoderOptions     options;
+//      balxml::Decoder            decoder(&options, &reader, &errInfo);
+//      bdlma::SequentialAllocator arena;
+//
+//      for (int i = 0; i < NUM_MESSAGES; ++i) {
+//          const bsl::size_t LENGTH = bsl::strlen(MESSAGES[i]);
+//..
+// For each message, we first reserve in the arena the memory the decoded
+// object is expected to use, estimated from the length of the message:
+//..
+//          arena.reserveCapacity(balxml::Decoder::arenaSizeHint(LENGTH));
+//..
+// Then, we decode the message into an object using the arena, and process it.
+// Destroying the object returns no memory, as an arena does not reuse
+// deallocated memory:
+//..
+//          {
+//              test::Employee employee(&arena);
+//
+//              int rc = decoder.decode(MESSAGES[i], LENGTH, &employee);
+//              assert(0 == rc);
+//
+//              bsl::cout << employee.name() << bsl::endl;
+//          }
+//..
+// Finally, we reclaim all the memory used by the message, keeping it in the
+// arena for the next message:
+//..
+//          arena.rewind();
+//      }
+//
+//      return 0;
+//  }
+//..
 
 #include <balscm_version.h>
 
@@ -265,6 +333,7 @@ BSLS_IDENT("$Id: $")
 #include <balxml_reader.h>
 
 #include <bdlat_arrayfunctions.h>
+#include <bdlat_attributenameindex.h>
 #include <bdlat_choicefunctions.h>
 #include <bdlat_customizedtypefunctions.h>
 #include <bdlat_formattingmode.h>
@@ -293,6 +362,7 @@ BSLS_IDENT("$Id: $")
 #include <bsl_streambuf.h>
 #include <bsl_string.h>
 #include <bsl_vector.h>
+#include <bsl_cstddef.h>
 #include <bsl_cstring.h>
 #include <bsl_cstdlib.h>
 #include <bsl_cerrno.h>
@@ -449,6 +519,16 @@ class Decoder {
     int decodeImp(TYPE *object, ANY_CATEGORY);
 
   public:
+    // CLASS METHODS
+    static bsl::size_t arenaSizeHint(bsl::size_t length);
+        // Return an estimate, in bytes, of the memory allocated from the
+        // allocator of an object of a generated type by decoding into that
+        // object an XML document of the specified 'length'.  The estimate is
+        // intended as the capacity to reserve in a sequential (arena)
+        // allocator supplying the memory of the object (see {Decoding into an
+        // Arena}).  Note that the estimate is sufficient for typical
+        // messages, but is not an upper bound.
+
     // CREATORS
     Decoder(const DecoderOptions *options,
             Reader               *reader,
@@ -1902,6 +1982,19 @@ void Decoder::setNumUnknownElementsSkipped(int value)
                                // class Decoder
                                // -------------
 
+// CLASS METHODS
+inline
+bsl::size_t Decoder::arenaSizeHint(bsl::size_t length)
+{
+    // The constants were measured by decoding 'bsctst::Sequence3' documents
+    // of 0 to 1000 string elements into objects using a
+    // 'bslma::TestAllocator'.  The bytes allocated were between 1.9 and 2.2
+    // times the length of the document for documents longer than 500 bytes,
+    // and at most 260 bytes for the shorter ones.
+
+    return 5 * length / 2 + 512;
+}
+
 inline
 const DecoderOptions *Decoder::options() const
 {
@@ -2424,10 +2517,10 @@ int Decoder_SequenceContext<TYPE>::parseAttribute(const char  *name,
 
     Decoder_ParseAttribute visitor(decoder, name, value, lenValue);
 
-    if (0 != bdlat_SequenceFunctions::manipulateAttribute(d_object_p,
-                                                          visitor,
-                                                          name,
-                                                          lenName)) {
+    if (0 != bdlat_AttributeNameIndex::manipulateAttribute(d_object_p,
+                                                           visitor,
+                                                           name,
+                                                           lenName)) {
         if (visitor.failed()) {
             return k_FAILURE;                                         // RETURN
         }
@@ -2446,9 +2539,9 @@ int Decoder_SequenceContext<TYPE>::parseSubElement(const char *elementName,
     const int lenName = static_cast<int>(bsl::strlen(elementName));
 
     if (decoder->options()->skipUnknownElements()
-     && false == bdlat_SequenceFunctions::hasAttribute(*d_object_p,
-                                                       elementName,
-                                                       lenName)) {
+     && false == bdlat_AttributeNameIndex::hasAttribute(*d_object_p,
+                                                        elementName,
+                                                        lenName)) {
         decoder->setNumUnknownElementsSkipped(
                                      decoder->numUnknownElementsSkipped() + 1);
         Decoder_UnknownElementContext unknownElement;
@@ -2457,10 +2550,10 @@ int Decoder_SequenceContext<TYPE>::parseSubElement(const char *elementName,
 
     Decoder_ParseSequenceSubElement visitor(decoder, elementName, lenName);
 
-    return bdlat_SequenceFunctions::manipulateAttribute(d_object_p,
-                                                        visitor,
-                                                        elementName,
-                                                        lenName);
+    return bdlat_AttributeNameIndex::manipulateAttribute(d_object_p,
+                                                         visitor,
+                                                         elementName,
+                                                         lenName);
 }
 
                      // ---------------------------------
@@ -2979,7 +3072,7 @@ int Decoder_ParseObject::executeImp(
 
     if (formattingMode & bdlat_FormattingMode::e_UNTAGGED) {
         if (d_decoder->options()->skipUnknownElements()
-         && false == bdlat_SequenceFunctions::hasAttribute(
+         && false == bdlat_AttributeNameIndex::hasAttribute(
                                                 *object,
                                                 d_elementName_p,
                                                 static_cast<int>(d_lenName))) {
@@ -2989,7 +3082,7 @@ int Decoder_ParseObject::executeImp(
             return unknownElement.beginParse(d_decoder);              // RETURN
         }
 
-        return bdlat_SequenceFunctions::manipulateAttribute(
+        return bdlat_AttributeNameIndex::manipulateAttribute(
                                                   object,
                                                   *this,
                                                   d_elementName_p,
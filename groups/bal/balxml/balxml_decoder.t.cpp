@@ -57,6 +57,8 @@
 
 #include <bslalg_typetraits.h>
 
+#include <bdlma_sequentialallocator.h>
+
 #include <bslma_allocator.h>
 #include <bslma_default.h>
 #include <bslma_testallocator.h>
@@ -65,6 +67,7 @@
 
 #include <bsls_assert.h>
 #include <bsls_review.h>
+#include <bsls_stopwatch.h>
 
 using namespace BloombergLP;
 using namespace bsl;
@@ -127,6 +130,7 @@ using namespace bsl;
 // [11] int balxml::Decoder::decode(istrm&, TYPE, ostrm&, ostrm&, b_A*);
 // [15] void setNumUnknownElementsSkipped(int value);
 // [15] int numUnknownElementsSkipped() const;
+// [21] static bsl::size_t arenaSizeHint(bsl::size_t length);
 // [ 3] balxml::Decoder_SelectContext
 // [ 2] baexml_Decoder_ParserUtil
 // [ 5] baexml_Decoder_Base64Context
@@ -138,7 +142,8 @@ using namespace bsl;
 // [ 7] baexml_Decoder_PrepareSubContext
 // ----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
-// [16] USAGE EXAMPLES
+// [17] USAGE EXAMPLES
+// [-1] ARENA DECODING PERFORMANCE TEST
 // ----------------------------------------------------------------------------
 
 // ============================================================================
@@ -25827,6 +25832,85 @@ extern const char selection1Name[] = "selection1";
         return 0;
     }
 //..
+//
+///Usage Example 3
+///---------------
+// Suppose that a service decodes a large number of 'test::Employee' messages
+// (from the 'test_employee' component of the first example), each of which is
+// processed and then discarded.  The following snippets of code illustrate how
+// to reuse one decoder for all the messages, and decode each message into an
+// object whose memory is supplied by an arena that is rewound after each
+// message:
+//..
+    int usageExample4()
+    {
+        const char *const MESSAGES[] = {
+            "<Employee><name>Alice</name><homeAddress><street>Fifth Ave"
+            "</street><city>New York</city><state>NY</state></homeAddress>"
+            "<age>34</age></Employee>",
+
+            "<Employee><name>Bob</name><homeAddress><street>Some Street"
+            "</street><city>Some City</city><state>Some State</state>"
+            "</homeAddress><age>21</age></Employee>"
+        };
+        const int NUM_MESSAGES = sizeof MESSAGES / sizeof *MESSAGES;
+
+        balxml::MiniReader         reader;
+        balxml::ErrorInfo          errInfo;
+        balxml::DecoderOptions     options;
+        balxml::Decoder            decoder(&options, &reader, &errInfo);
+        bdlma::SequentialAllocator arena;
+
+        for (int i = 0; i < NUM_MESSAGES; ++i) {
+            const bsl::size_t LENGTH = bsl::strlen(MESSAGES[i]);
+//..
+// For each message, we first reserve in the arena the memory the decoded
+// object is expected to use, estimated from the length of the message:
+//..
+            arena.reserveCapacity(balxml::Decoder::arenaSizeHint(LENGTH));
+//..
+// Then, we decode the message into an object using the arena, and process it.
+// Destroying the object returns no memory, as an arena does not reuse
+// deallocated memory:
+//..
+            {
+                test::Employee employee(&arena);
+
+                int rc = decoder.decode(MESSAGES[i], LENGTH, &employee);
+                ASSERT(0 == rc);
+
+                bsl::cout << employee.name() << bsl::endl;
+            }
+//..
+// Finally, we reclaim all the memory used by the message, keeping it in the
+// arena for the next message:
+//..
+            arena.rewind();
+        }
+
+        return 0;
+    }
+//..
+
+namespace {
+
+bsl::string makeSequence3Document(int numStrings)
+    // Return an XML document representing a 'bsctst::Sequence3' object having
+    // the specified 'numStrings' strings in its 'element2' array.
+{
+    bsl::ostringstream oss;
+    oss << "<?xml version='1.0' encoding='UTF-8'?>\n"
+           "<Sequence3 xmlns='TestNamespace'>\n";
+    for (int i = 0; i < numStrings; ++i) {
+        oss << "  <element2>string number " << i
+            << " of the array, long enough to be allocated</element2>\n";
+    }
+    oss << "  <element4>an optional string</element4>\n"
+           "</Sequence3>\n";
+    return oss.str();
+}
+
+}  // close unnamed namespace
 
 // ============================================================================
 //                               MAIN PROGRAM
@@ -25846,6 +25930,127 @@ int main(int argc, char *argv[])
     bsls::ReviewFailureHandlerGuard reviewGuard(&bsls::Review::failByAbort);
 
     switch (test) { case 0:  // Zero is always the leading case.
+      case 21: {
+        // --------------------------------------------------------------------
+        // TESTING ARENA DECODING
+        //
+        // Concerns:
+        //: 1 'arenaSizeHint' is at least the length of the input, and
+        //:   increases with it.
+        //:
+        //: 2 An object allocated from an arena allocator is decoded to the
+        //:   same value as an object using the default allocator.
+        //:
+        //: 3 For typical messages, reserving 'arenaSizeHint' bytes in a
+        //:   'bdlma::SequentialAllocator' before decoding suffices for the
+        //:   allocations of the decoded object.
+        //:
+        //: 4 A decoder (and its 'balxml::MiniReader') that is reused allocates
+        //:   no memory to decode a message no larger than one it has already
+        //:   decoded.
+        //
+        // Plan:
+        //: 1 Check 'arenaSizeHint' for a set of lengths.  (C-1)
+        //:
+        //: 2 For a set of 'bsctst::Sequence3' documents of increasing size,
+        //:   decode the document into an object using the default allocator,
+        //:   and into an object allocated from a 'bdlma::SequentialAllocator'
+        //:   using a test allocator, after reserving 'arenaSizeHint' bytes.
+        //:   Check that the values are the same, and that the test allocator
+        //:   was used only for the reservation.  (C-2..3)
+        //:
+        //: 3 Decode each document twice with a decoder and a reader using a
+        //:   test allocator, and check that the second call allocates no
+        //:   memory.  (C-4)
+        //
+        // Testing:
+        //   static bsl::size_t arenaSizeHint(bsl::size_t length);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nTESTING ARENA DECODING"
+                          << "\n======================" << endl;
+
+        if (verbose) cout << "\nTesting 'arenaSizeHint'." << endl;
+        {
+            bsl::size_t prevHint = 0;
+            for (bsl::size_t length = 0; length < 100000; length += 997) {
+                const bsl::size_t HINT =
+                                      balxml::Decoder::arenaSizeHint(length);
+
+                ASSERTV(length, HINT, length <= HINT);
+                ASSERTV(length, HINT, prevHint, 0 == length
+                                             || prevHint < HINT);
+                prevHint = HINT;
+            }
+        }
+
+        static const int NUM_STRINGS[] = { 0, 1, 2, 5, 10, 50, 100, 1000 };
+        const int NUM_DATA = sizeof NUM_STRINGS / sizeof *NUM_STRINGS;
+
+        if (verbose) cout << "\nDecoding into an arena." << endl;
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const bsl::string INPUT = makeSequence3Document(NUM_STRINGS[ti]);
+
+            if (veryVerbose) { T_ P_(ti) P(INPUT.length()) }
+
+            balxml::DecoderOptions options;
+            balxml::MiniReader     reader;
+            balxml::ErrorInfo      errInfo;
+            balxml::Decoder        decoder(&options, &reader, &errInfo);
+
+            bsctst::Sequence3 expected;
+            ASSERTV(ti, 0 == decoder.decode(INPUT.data(),
+                                            INPUT.length(),
+                                            &expected));
+            ASSERTV(ti, static_cast<bsl::size_t>(NUM_STRINGS[ti]) ==
+                                                  expected.element2().size());
+
+            bslma::TestAllocator       ta("arena", veryVeryVerbose);
+            bdlma::SequentialAllocator arena(&ta);
+
+            arena.reserveCapacity(
+                             balxml::Decoder::arenaSizeHint(INPUT.length()));
+
+            const bsls::Types::Int64 NUM_BLOCKS = ta.numAllocations();
+            {
+                bsctst::Sequence3 value(&arena);
+
+                ASSERTV(ti, 0 == decoder.decode(INPUT.data(),
+                                                INPUT.length(),
+                                                &value));
+                ASSERTV(ti, expected == value);
+            }
+            ASSERTV(ti, NUM_BLOCKS, ta.numAllocations(),
+                    NUM_BLOCKS == ta.numAllocations());
+        }
+
+        if (verbose) cout << "\nReusing a decoder." << endl;
+        {
+            bslma::TestAllocator   ta("decoder", veryVeryVerbose);
+            balxml::DecoderOptions options;
+            balxml::MiniReader     reader(&ta);
+            balxml::ErrorInfo      errInfo;
+            balxml::Decoder        decoder(&options, &reader, &errInfo, &ta);
+
+            for (int ti = 0; ti < NUM_DATA; ++ti) {
+                const bsl::string INPUT =
+                                        makeSequence3Document(NUM_STRINGS[ti]);
+
+                for (int i = 0; i < 2; ++i) {
+                    const bsls::Types::Int64 NUM_ALLOCS = ta.numAllocations();
+
+                    bsctst::Sequence3 value;
+                    ASSERTV(ti, 0 == decoder.decode(INPUT.data(),
+                                                    INPUT.length(),
+                                                    &value));
+
+                    ASSERTV(ti, i, NUM_ALLOCS, ta.numAllocations(),
+                            0 == i || NUM_ALLOCS == ta.numAllocations());
+                }
+            }
+        }
+      } break;
       case 20: {
         // --------------------------------------------------------------------
         // TESTING ERROR CODE PROPOGATION FOR DYNAMIC TYPES
@@ -26878,6 +27083,13 @@ R(L_,  s(na0,na1,n(i0),n(i1))   , t, t, x(S,x(A0,V0   ),x(A1,V1   )) )  // *
         LOOP_ASSERT(errorStream.str(), errorStream.str().empty());
         if (verbose) bsl::cout << outStream.str() << bsl::endl;
 
+        // Redirect standard output to 'outStream'.
+        outStream.str("");
+        bsl::cout.rdbuf(outStream.rdbuf());
+        usageExample4();
+        bsl::cout.rdbuf(coutBuf);
+        LOOP_ASSERT(outStream.str(), "Alice\nBob\n" == outStream.str());
+
       } break;
       case 16: {
         // --------------------------------------------------------------------
@@ -38551,6 +38763,92 @@ R(L_,  s(na0,na1,n(i0),n(i1))   , t, t, x(S,x(A0,V0   ),x(A1,V1   )) )  // *
 
         if (verbose) cout << "\nEnd of Breathing Test." << endl;
       } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // ARENA DECODING PERFORMANCE TEST
+        //
+        // Concerns:
+        //: 1 Decoding request-scoped messages into objects allocated from an
+        //:   arena, which is rewound after each message, is faster than
+        //:   decoding into objects using the default allocator.
+        //
+        // Plan:
+        //: 1 Decode an 'Employee' message and a 'bsctst::Sequence3' message
+        //:   having 20 strings a number of times (optionally specified on the
+        //:   command line) into a new object using the default allocator, and
+        //:   into a new object using a 'bdlma::SequentialAllocator' sized by
+        //:   'arenaSizeHint' and rewound after each message, and report the
+        //:   best time of several runs of each.  (C-1)
+        //
+        // Testing:
+        //   ARENA DECODING PERFORMANCE TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nARENA DECODING PERFORMANCE TEST"
+                          << "\n===============================" << endl;
+
+        const int NUM_ITERATIONS = argc > 2 ? atoi(argv[2]) : 20000;
+        const int NUM_RUNS       = 5;
+
+        const bsl::string EMPLOYEE =
+                "<Employee><name>Alice</name><homeAddress><street>Fifth Ave"
+                "</street><city>New York City</city><state>New York</state>"
+                "</homeAddress><age>34</age></Employee>";
+        const bsl::string SEQUENCE = makeSequence3Document(20);
+
+        balxml::DecoderOptions options;
+        balxml::MiniReader     reader;
+        balxml::ErrorInfo      errInfo;
+        balxml::Decoder        decoder(&options, &reader, &errInfo);
+
+        for (int useArena = 0; useArena < 2; ++useArena) {
+            bdlma::SequentialAllocator arena;
+            bsls::Stopwatch            timer;
+            double                     bestTime = 0;
+
+            for (int run = 0; run < NUM_RUNS; ++run) {
+                timer.reset();
+                timer.start();
+
+                for (int i = 0; i < NUM_ITERATIONS; ++i) {
+                    const bsl::string& INPUT = i % 2 ? SEQUENCE : EMPLOYEE;
+
+                    if (useArena) {
+                        arena.rewind();
+                        arena.reserveCapacity(
+                               balxml::Decoder::arenaSizeHint(INPUT.length()));
+                    }
+
+                    bslma::Allocator *allocator = useArena ? &arena : 0;
+                    int               rc;
+
+                    if (i % 2) {
+                        bsctst::Sequence3 value(allocator);
+                        rc = decoder.decode(INPUT.data(),
+                                            INPUT.length(),
+                                            &value);
+                    }
+                    else {
+                        test::Employee value(allocator);
+                        rc = decoder.decode(INPUT.data(),
+                                            INPUT.length(),
+                                            &value);
+                    }
+                    ASSERTV(i, 0 == rc);
+                }
+
+                timer.stop();
+
+                if (0 == run || timer.elapsedTime() < bestTime) {
+                    bestTime = timer.elapsedTime();
+                }
+            }
+
+            cout << (useArena ? "arena:             " : "default allocator: ")
+                 << bestTime / NUM_ITERATIONS * 1000000
+                 << " us per message" << endl;
+        }
+      } break;
       default: {
         cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
         testStatus = -1;
@@ -13,6 +13,7 @@
 BSLS_IDENT_RCSID(balxml_minireader_cpp,"$Id$ $CSID$")
 
 #include <balxml_errorinfo.h>
+#include <balxml_scanutil.h>
 
 #include <bsls_assert.h>
 
@@ -561,7 +562,9 @@ void MiniReader::close()
     d_state     = ST_CLOSED;
 }
 
-int MiniReader::doOpen(const char *url, const char *encoding)
+void MiniReader::resetInput(char       *buffer,
+                            const char *url,
+                            const char *encoding)
 {
     // reset active nodes stack
     d_activeNodesCount = 0;
@@ -573,12 +576,10 @@ int MiniReader::doOpen(const char *url, const char *encoding)
     d_ownNamespaces.reset();
 
     // clear input source
-    d_parseBuf.resize(d_readSize);
-    d_parseBuf[0] = '\0';
     d_streamOffset = 0;
     d_flags       = 0;
 
-    d_startPtr   = &d_parseBuf.front();
+    d_startPtr   = buffer;
     d_endPtr     = d_startPtr;
     d_scanPtr    = d_startPtr;
     d_markPtr    = d_startPtr;
@@ -591,6 +592,14 @@ int MiniReader::doOpen(const char *url, const char *encoding)
 
     d_baseURL  = nonNullStr(url);
     d_encoding = nonNullStr(encoding);
+}
+
+int MiniReader::doOpen(const char *url, const char *encoding)
+{
+    d_parseBuf.resize(d_readSize);
+    d_parseBuf[0] = '\0';
+
+    resetInput(&d_parseBuf.front(), url, encoding);
 
     return (readInput() > 0) ? 0 : -1;
 }
@@ -630,6 +639,32 @@ int MiniReader::open(const char *filename, const char *encoding)
     return open(d_stream.rdbuf(), filename, encoding);
 }
 
+int MiniReader::openInPlace(char        *buffer,
+                            bsl::size_t  size,
+                            const char  *url,
+                            const char  *encoding)
+{
+    if (d_state != ST_CLOSED) {
+        return -1;                                                    // RETURN
+    }
+
+    if (buffer == 0 || size == 0) {
+        return -1;                                                    // RETURN
+    }
+
+    // Parse the whole document in 'buffer', which is null-terminated like the
+    // parse buffer, and never refilled: 'readInput' returns 0 as the end of
+    // input is already reached.
+
+    resetInput(buffer, url, encoding);
+
+    d_endPtr  = d_startPtr + size;
+    *d_endPtr = '\0';
+    d_flags  |= FLG_READ_EOF;
+
+    return 0;
+}
+
 int MiniReader::open(bsl::streambuf *stream,
                      const char     *url,
                      const char     *encoding)
@@ -901,8 +936,10 @@ MiniReader::searchCommentCDataOrEndElementName(const bsl::string& name)
     while (1) {
         StringType type = e_STRINGTYPE_NONE;
 
-        size_t len = bsl::strcspn(d_scanPtr, strSet);
-        d_scanPtr += len;
+        d_scanPtr = const_cast<char *>(ScanUtil::findFirstOf(d_scanPtr,
+                                                             d_endPtr,
+                                                             strSet,
+                                                             sizeof strSet));
         if (d_scanPtr == d_endPtr) { // No chars from 'strSet' found.
             if (readInput() == 0) {
                 d_scanPtr = d_endPtr;
@@ -997,8 +1034,10 @@ MiniReader::searchElementName(const bsl::string& name)
     while (1) {
         StringType type = e_STRINGTYPE_NONE;
 
-        size_t len = bsl::strcspn(d_scanPtr, strSet);
-        d_scanPtr += len;
+        d_scanPtr = const_cast<char *>(ScanUtil::findFirstOf(d_scanPtr,
+                                                             d_endPtr,
+                                                             strSet,
+                                                             sizeof strSet));
         if (d_scanPtr == d_endPtr) { // No chars from 'strSet' found.
             if (readInput() == 0) {
                 d_scanPtr = d_endPtr;
@@ -1235,8 +1274,10 @@ MiniReader::skipSpaces()
     while (1) {
 
         // skip SPACE, TAB, CR chars
-        size_t len = bsl::strspn(d_scanPtr, "\r\t ");
-        d_scanPtr +=len;
+        d_scanPtr = const_cast<char *>(ScanUtil::findFirstNotOf(d_scanPtr,
+                                                                d_endPtr,
+                                                                "\r\t ",
+                                                                3));
 
         if (checkForNewLine()) {
             ++d_scanPtr;          //skip NL
@@ -1261,8 +1302,10 @@ MiniReader::scanForSymbol(char symbol)
 
     while (1) {
         // find 'symbol' or NL
-        size_t len = bsl::strcspn(d_scanPtr, strSet);
-        d_scanPtr +=len;
+        d_scanPtr = const_cast<char *>(ScanUtil::findFirstOf(d_scanPtr,
+                                                             d_endPtr,
+                                                             strSet,
+                                                             sizeof strSet));
 
         if (symbol == *d_scanPtr) {
             return symbol;                                            // RETURN
@@ -1292,8 +1335,10 @@ MiniReader::scanForSymbolOrSpace(char symbol)
 
     while (1) {
         // find 'symbol' or space
-        size_t len = bsl::strcspn(d_scanPtr, strSet);
-        d_scanPtr +=len;
+        d_scanPtr = const_cast<char *>(ScanUtil::findFirstOf(d_scanPtr,
+                                                             d_endPtr,
+                                                             strSet,
+                                                             sizeof strSet));
 
         if (d_scanPtr < d_endPtr) {
             break;
@@ -1315,8 +1360,10 @@ MiniReader::scanForSymbolOrSpace(char symbol1, char symbol2)
 
     while (1) {
         // find 'symbol1' or 'symbol2' or space
-        size_t len = bsl::strcspn(d_scanPtr, strSet);
-        d_scanPtr +=len;
+        d_scanPtr = const_cast<char *>(ScanUtil::findFirstOf(d_scanPtr,
+                                                             d_endPtr,
+                                                             strSet,
+                                                             sizeof strSet));
 
         if (d_scanPtr < d_endPtr) {
             break;
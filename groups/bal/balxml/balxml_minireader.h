@@ -41,6 +41,18 @@ BSLS_IDENT("$Id: $")
 // To get stricter data validation, clients should use a concrete
 // implementation of a validating reader (such as 'a_xercesc::Reader') instead.
 //
+// In-Place Parsing
+// - - - - - - - -
+// The 'open' methods read the document, in chunks, into a parse buffer owned
+// by the reader.  A document that is entirely in memory in a writable buffer
+// (e.g., a received message, or a file mapped into memory privately) can
+// instead be parsed in place with 'openInPlace', which neither copies nor
+// refills: the names and values of nodes and attributes refer directly into
+// the caller's buffer.  The reader writes into that buffer (to null-terminate
+// names and values, and to decode character and entity references), so the
+// buffer must have one writable byte past the end of the document, and its
+// contents are not preserved.
+//
 ///Usage
 ///-----
 // For this example, we will use 'balxml::MiniReader' to read each node in an
@@ -483,6 +495,10 @@ class MiniReader :  public Reader {
 
     int   readInput();
     int   doOpen(const char *url, const char *encoding);
+    void  resetInput(char *buffer, const char *url, const char *encoding);
+        // Reset the state of this reader for parsing a new document whose
+        // first character is, or is to be read, at the specified 'buffer',
+        // having the specified 'url' and 'encoding'.
 
     int   peekChar();
         // Return the character at the current position, and zero if the end of
@@ -615,6 +631,26 @@ class MiniReader :  public Reader {
         // Note that the reader will not be on a valid node until
         // 'advanceToNextNode' is called.
 
+    int openInPlace(char        *buffer,
+                    bsl::size_t  size,
+                    const char  *url = 0,
+                    const char  *encoding = 0);
+        // Set up the reader for parsing in place the XML document in the
+        // specified 'buffer' of the specified 'size', set the base URL to the
+        // optionally specified 'url' and set the encoding value to the
+        // optionally specified 'encoding', as for 'open' with a buffer.
+        // Return 0 on success and non-zero otherwise.  Unlike 'open', this
+        // method does not copy the document into the parse buffer of this
+        // reader: the names and values of nodes and attributes refer directly
+        // to 'buffer', which this reader modifies (to null-terminate the names
+        // and values, and to decode the references to characters and entities
+        // they contain).  It is an error to 'open' a reader that is already
+        // open.  The behavior is undefined unless 'buffer' has at least
+        // 'size + 1' writable bytes (this reader sets 'buffer[size]' to 0),
+        // and 'buffer' is valid, and is not otherwise modified, until 'close'
+        // is called.  Note that the reader will not be on a valid node until
+        // 'advanceToNextNode' is called.
+
     virtual int open(bsl::streambuf *stream,
                      const char     *url = 0,
                      const char     *encoding = 0);
@@ -16,6 +16,7 @@
 #include <bslma_testallocator.h>
 #include <bslma_testallocatorexception.h>
 
+#include <bsls_stopwatch.h>
 #include <bsls_types.h>
 
 #include <bsl_cstring.h>     // strlen()
@@ -25,6 +26,7 @@
 #include <bsl_fstream.h>
 #include <bsl_iomanip.h>
 #include <bsl_string.h>
+#include <bsl_vector.h>
 
 using namespace BloombergLP;
 using namespace bsl;
@@ -75,30 +77,33 @@ using namespace bsl;
 //
 // [14] advanceToEndNodeRawBare()
 //
-// [15] MiniReader(basicAllocator)
-// [15] MiniReader(bufSize, basicAllocator)
-// [15] ~MiniReader()
-// [15] setPrefixStack(balxml::PrefixStack *prefixes)
-// [15] prefixStack()
-// [15] open()
-// [15] isOpen()
-// [15] documentEncoding()
-// [15] nodeType()
-// [15] nodeName()
-// [15] nodeHasValue()
-// [15] nodeValue()
-// [15] nodeDepth()
-// [15] numAttributes()
-// [15] isEmptyElement()
-// [15] advanceToNextNode()
-// [15] lookupAttribute(ElemAtt a, int index)
-// [15] lookupAttribute(ElemAtt a, char *qname)
-// [15] lookupAttribute(ElemAtt a, char *localname, char *nsUri)
-// [15] lookupAttribute(ElemAtt a, char *localname, int nsId)
+// [15] openInPlace(char *buffer, size, url, encoding)
+//
+// [16] MiniReader(basicAllocator)
+// [16] MiniReader(bufSize, basicAllocator)
+// [16] ~MiniReader()
+// [16] setPrefixStack(balxml::PrefixStack *prefixes)
+// [16] prefixStack()
+// [16] open()
+// [16] isOpen()
+// [16] documentEncoding()
+// [16] nodeType()
+// [16] nodeName()
+// [16] nodeHasValue()
+// [16] nodeValue()
+// [16] nodeDepth()
+// [16] numAttributes()
+// [16] isEmptyElement()
+// [16] advanceToNextNode()
+// [16] lookupAttribute(ElemAtt a, int index)
+// [16] lookupAttribute(ElemAtt a, char *qname)
+// [16] lookupAttribute(ElemAtt a, char *localname, char *nsUri)
+// [16] lookupAttribute(ElemAtt a, char *localname, int nsId)
 //-----------------------------------------------------------------------------
 // [-1] INTERACTIVE TEST
+// [-2] PERFORMANCE TEST
 // [ 1] BREATHING TEST
-// [15] USAGE EXAMPLE
+// [16] USAGE EXAMPLE
 //-----------------------------------------------------------------------------
 
 // ============================================================================
@@ -796,6 +801,34 @@ void advanceN(Obj& reader, bsl::size_t n)
     }
 }
 
+int describeNodes(bsl::string *result, Obj *reader)
+    // Load into the specified 'result' a description of the type, depth, name,
+    // value, and attributes of each of the remaining nodes of the document
+    // read by the specified 'reader'.  Return the (non-zero) result of the
+    // last call to 'advanceToNextNode'.
+{
+    bsl::ostringstream oss;
+
+    int rc;
+    while (0 == (rc = reader->advanceToNextNode())) {
+        oss << reader->nodeType()                  << ' '
+            << reader->nodeDepth()                 << ' '
+            << CHK(reader->nodeName())             << '='
+            << CHK(reader->nodeValue());
+
+        for (int i = 0; i < reader->numAttributes(); ++i) {
+            ElementAttribute attribute;
+            reader->lookupAttribute(&attribute, i);
+            oss << ' ' << CHK(attribute.qualifiedName())
+                << "='" << CHK(attribute.value()) << '\'';
+        }
+        oss << '\n';
+    }
+
+    *result = oss.str();
+    return rc;
+}
+
 // ============================================================================
 //                               MAIN PROGRAM
 // ----------------------------------------------------------------------------
@@ -812,7 +845,7 @@ int main(int argc, char *argv[])
     bsl::cout << "TEST " << __FILE__ << " CASE " << test << bsl::endl;;
 
     switch (test) { case 0:  // Zero is always the leading case.
-      case 15: {
+      case 16: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //
@@ -855,6 +888,193 @@ int main(int argc, char *argv[])
         usageExample();
 
       } break;
+      case 15: {
+        // --------------------------------------------------------------------
+        // IN-PLACE PARSING
+        //
+        // Concerns:
+        //: 1 A document opened with 'openInPlace' is read as the same
+        //:   sequence of nodes and attributes as when opened with 'open',
+        //:   including for a document much larger than the parse buffer.
+        //:
+        //: 2 The names and values of nodes refer to the buffer supplied to
+        //:   'openInPlace', rather than to a copy of the document.
+        //:
+        //: 3 The reader null-terminates the buffer after the specified size,
+        //:   and does not read past it.
+        //:
+        //: 4 'openInPlace' fails if the reader is already open, or if the
+        //:   buffer is null or empty, and the reader can be reopened after
+        //:   'close'.
+        //
+        // Plan:
+        //: 1 For a set of documents, including entity references, CDATA,
+        //:   comments, and a document of several thousand nodes, read all
+        //:   nodes with a reader opened with 'open' and with a reader opened
+        //:   with 'openInPlace' on a copy of the document, and compare their
+        //:   descriptions.  (C-1)
+        //:
+        //: 2 Check that the names and values of an element node, of its
+        //:   attribute, and of a text node lie within the buffer.  (C-2)
+        //:
+        //: 3 Supply a buffer that is followed by markup that would change the
+        //:   nodes if read, and check that the nodes read end with the
+        //:   specified size.  (C-3)
+        //:
+        //: 4 Call 'openInPlace' on an open reader and with invalid arguments,
+        //:   and check the results.  (C-4)
+        //
+        // Testing:
+        //   openInPlace(char *buffer, size, url, encoding)
+        // --------------------------------------------------------------------
+
+        if (verbose) bsl::cout << "\nIN-PLACE PARSING"
+                               << "\n================" << bsl::endl;
+
+        if (verbose) bsl::cout << "\nCompare with 'open'." << bsl::endl;
+        {
+            bsl::string large;
+            ggg(large, 200, 3);
+
+            static const char *DATA[] = {
+                "<root/>",
+
+                "<?xml version='1.0' encoding='UTF-8'?>\n"
+                "<a x='1' y=\"&lt;2&gt;\">\n"
+                "  <!-- comment -->\n"
+                "  <b>text &amp; more &#65;&#x42;</b>\n"
+                "  <![CDATA[raw <data> &amp;]]>\n"
+                "  <c/><d   z = 'last' ></d>\n"
+                "</a>\n",
+
+                "<unclosed attr='1'>text",
+
+                "<a></b>",
+
+                large.c_str()
+            };
+            const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+            for (int ti = 0; ti < NUM_DATA; ++ti) {
+                const char        *DOC    = DATA[ti];
+                const bsl::size_t  LENGTH = bsl::strlen(DOC);
+
+                if (veryVerbose) { T_ P_(ti) P(LENGTH) }
+
+                balxml::NamespaceRegistry namespaces;
+                balxml::PrefixStack       prefixStack(&namespaces);
+
+                bsl::string expected;
+                int         expectedRc;
+                {
+                    Obj reader(256);
+                    reader.setPrefixStack(&prefixStack);
+
+                    ASSERTV(ti, 0 == reader.open(DOC, LENGTH));
+                    expectedRc = describeNodes(&expected, &reader);
+                }
+
+                bsl::vector<char> buffer(DOC, DOC + LENGTH + 1);
+
+                bsl::string result;
+                int         resultRc;
+                {
+                    Obj reader(256);
+                    reader.setPrefixStack(&prefixStack);
+
+                    ASSERTV(ti, 0 == reader.openInPlace(buffer.data(),
+                                                        LENGTH,
+                                                        "doc.xml"));
+                    ASSERTV(ti, reader.isOpen());
+
+                    resultRc = describeNodes(&result, &reader);
+
+                    reader.close();
+                    ASSERTV(ti, !reader.isOpen());
+                }
+
+                ASSERTV(ti, expectedRc, resultRc, expectedRc == resultRc);
+                ASSERTV(ti, expected, result, expected == result);
+            }
+        }
+
+        if (verbose) bsl::cout << "\nNames refer to the buffer." << bsl::endl;
+        {
+            char buffer[] = "<root><child attr='v'>text</child></root>";
+
+            balxml::NamespaceRegistry namespaces;
+            balxml::PrefixStack       prefixStack(&namespaces);
+            Obj                       reader;
+            reader.setPrefixStack(&prefixStack);
+
+            ASSERT(0 == reader.openInPlace(buffer, sizeof buffer - 1));
+
+            ASSERT(0 == reader.advanceToNextNode());
+            ASSERT(0 == reader.advanceToNextNode());
+            ASSERT(balxml::Reader::e_NODE_TYPE_ELEMENT == reader.nodeType());
+            ASSERT(!bsl::strcmp("child", reader.nodeName()));
+            ASSERT(buffer + 7 == reader.nodeName());
+
+            ElementAttribute attribute;
+            ASSERT(0 == reader.lookupAttribute(&attribute, 0));
+            ASSERT(!bsl::strcmp("v", attribute.value()));
+            ASSERT(buffer <= attribute.value());
+            ASSERT(attribute.value() < buffer + sizeof buffer);
+
+            ASSERT(0 == reader.advanceToNextNode());
+            ASSERT(balxml::Reader::e_NODE_TYPE_TEXT == reader.nodeType());
+            ASSERT(!bsl::strcmp("text", reader.nodeValue()));
+            ASSERT(buffer + 22 == reader.nodeValue());
+        }
+
+        if (verbose) bsl::cout << "\nThe buffer is terminated." << bsl::endl;
+        {
+            char buffer[] = "<a>one</a><b>two</b>";
+
+            balxml::NamespaceRegistry namespaces;
+            balxml::PrefixStack       prefixStack(&namespaces);
+            Obj                       reader;
+            reader.setPrefixStack(&prefixStack);
+
+            ASSERT(0 == reader.openInPlace(buffer, 10));
+            ASSERT(0 == buffer[10]);
+
+            bsl::string result;
+            ASSERT(0 < describeNodes(&result, &reader));
+
+            bsl::string expected;
+            {
+                Obj reader;
+                reader.setPrefixStack(&prefixStack);
+                ASSERT(0 == reader.open("<a>one</a>", 10));
+                ASSERT(0 < describeNodes(&expected, &reader));
+            }
+            ASSERTV(expected, result, expected == result);
+        }
+
+        if (verbose) bsl::cout << "\nInvalid calls." << bsl::endl;
+        {
+            char buffer[] = "<a/>";
+
+            Obj reader;
+
+            ASSERT(0 != reader.openInPlace(0, 4));
+            ASSERT(!reader.isOpen());
+
+            ASSERT(0 != reader.openInPlace(buffer, 0));
+            ASSERT(!reader.isOpen());
+
+            ASSERT(0 == reader.openInPlace(buffer, 4));
+            ASSERT(0 != reader.openInPlace(buffer, 4));
+            ASSERT(0 != reader.open("<b/>", 4));
+
+            reader.close();
+
+            ASSERT(0 == reader.openInPlace(buffer, 4));
+            ASSERT(0 == reader.advanceToNextNode());
+            ASSERT(!bsl::strcmp("a", reader.nodeName()));
+        }
+      } break;
 
       case 14: {
         // --------------------------------------------------------------------
@@ -4121,6 +4341,112 @@ int main(int argc, char *argv[])
         reader.close();
 
       } break;
+      case -2: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE TEST
+        //
+        // Concerns:
+        //: 1 The reader scans large SOAP-style documents, made mostly of
+        //:   indentation, element tags with attributes, and text, quickly.
+        //
+        // Plan:
+        //: 1 Generate a SOAP envelope containing a number of records
+        //:   (optionally specified on the command line), read all its nodes
+        //:   and attributes several times, opened with 'open' and with
+        //:   'openInPlace', and report the throughput.  (C-1)
+        //
+        // Testing:
+        //   PERFORMANCE TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) bsl::cout << "\nPERFORMANCE TEST"
+                               << "\n================" << bsl::endl;
+
+        const int NUM_RECORDS = argc > 2 ? bsl::atoi(argv[2]) : 20000;
+        const int ITERATIONS  = 10;
+
+        bsl::ostringstream oss;
+        oss << "<?xml version='1.0' encoding='UTF-8'?>\n"
+               "<soap:Envelope"
+               " xmlns:soap='http://schemas.xmlsoap.org/soap/envelope/'"
+               " xmlns:m='http://example.com/market'>\n"
+               "  <soap:Body>\n"
+               "    <m:Snapshot source='feed' version='2'>\n";
+        for (int i = 0; i < NUM_RECORDS; ++i) {
+            oss << "      <m:Security id='" << i << "' type=\"EQUITY\">\n"
+                   "        <m:Ticker>TICK" << i << " US Equity</m:Ticker>\n"
+                   "        <m:Description>Common stock of company number "
+                << i << ", listed on the primary exchange &amp; traded"
+                   " in the regular session</m:Description>\n"
+                   "        <m:Price currency='USD'>" << 100 + i % 50
+                << ".25</m:Price>\n"
+                   "      </m:Security>\n";
+        }
+        oss << "    </m:Snapshot>\n"
+               "  </soap:Body>\n"
+               "</soap:Envelope>\n";
+
+        const bsl::string doc = oss.str();
+
+        // Report the fastest iteration, as the least perturbed by other
+        // activity on the host, reading with 'open' and with 'openInPlace'
+        // (on a copy of the document made before timing).
+
+        for (int inPlace = 0; inPlace < 2; ++inPlace) {
+            bsls::Stopwatch timer;
+            double          bestTime = 0;
+            int             numNodes = 0;
+
+            bsl::vector<char> buffer;
+
+            for (int iter = 0; iter < ITERATIONS; ++iter) {
+                balxml::NamespaceRegistry namespaces;
+                balxml::PrefixStack       prefixStack(&namespaces);
+                Obj                       reader;
+
+                reader.setPrefixStack(&prefixStack);
+
+                if (inPlace) {
+                    buffer.assign(doc.begin(), doc.end());
+                    buffer.push_back('\0');
+                }
+
+                timer.reset();
+                timer.start();
+
+                int rc = inPlace
+                       ? reader.openInPlace(buffer.data(),
+                                            doc.length(),
+                                            "soap.xml")
+                       : reader.open(doc.data(), doc.length(), "soap.xml");
+                ASSERT(0 == rc);
+
+                numNodes = 0;
+                while (0 == (rc = reader.advanceToNextNode())) {
+                    ++numNodes;
+                    for (int i = 0; i < reader.numAttributes(); ++i) {
+                        ElementAttribute attribute;
+                        reader.lookupAttribute(&attribute, i);
+                    }
+                }
+                ASSERT(0 < rc);  // end of document
+
+                reader.close();
+
+                timer.stop();
+
+                if (0 == iter || timer.elapsedTime() < bestTime) {
+                    bestTime = timer.elapsedTime();
+                }
+            }
+
+            bsl::cout << (inPlace ? "openInPlace: " : "open:        ")
+                      << "read " << doc.length() << " bytes, "
+                      << numNodes << " nodes, at "
+                      << static_cast<double>(doc.length()) / bestTime / 1000000
+                      << " MB/s" << bsl::endl;
+        }
+      } break;
       default: {
         bsl::cerr << "WARNING: CASE `" << test << "' NOT FOUND." << bsl::endl;
         testStatus = -1;
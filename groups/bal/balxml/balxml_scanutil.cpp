@@ -0,0 +1,376 @@
+// balxml_scanutil.cpp                                                -*-C++-*-
+#include <balxml_scanutil.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(balxml_scanutil_cpp, "$Id$ $CSID$")
+
+#include <bdlb_bitutil.h>
+
+#include <bsls_assert.h>
+#include <bsls_platform.h>
+
+#include <bsl_cstdint.h>
+
+#if defined(BSLS_PLATFORM_CPU_X86_64)                                         \
+ && (defined(BSLS_PLATFORM_CMP_GNU) || defined(BSLS_PLATFORM_CMP_CLANG))
+#define BALXML_SCANUTIL_X86_SIMD 1
+#include <immintrin.h>
+#endif
+
+// IMPLEMENTATION NOTES
+// --------------------
+// The SIMD implementations compare each block of 16 (or 32) characters with
+// each character of the set, combine the comparisons into a bit mask having a
+// bit per character of the block, and return the address of the character
+// corresponding to the lowest set bit, if any.  The last, partial, block of a
+// range is handled by comparing the last full block of the range, which
+// overlaps the previous block: the characters in the overlap were already
+// found not to match, so the result is the same.  Only ranges shorter than a
+// block are searched one character at a time.
+//
+// The AVX2 implementation is compiled with the 'target' function attribute,
+// so that the rest of the translation unit (and the SSE2 implementation) can
+// run on any x86-64 CPU.
+
+namespace BloombergLP {
+namespace balxml {
+
+namespace {
+
+template <bool MATCH>
+inline
+bool isFound(char character, const char *set, bsl::size_t setLength)
+    // Return 'true' if the specified 'character' is one of the specified
+    // 'setLength' characters at the specified 'set' and 'MATCH' is 'true', or
+    // if it is not and 'MATCH' is 'false'; return 'false' otherwise.
+{
+    for (bsl::size_t i = 0; i < setLength; ++i) {
+        if (character == set[i]) {
+            return MATCH;                                             // RETURN
+        }
+    }
+    return !MATCH;
+}
+
+template <bool MATCH>
+const char *scanScalar(const char  *begin,
+                       const char  *end,
+                       const char  *set,
+                       bsl::size_t  setLength)
+    // Return the address of the first character in the specified range
+    // '[begin, end)' that is one of the specified 'setLength' characters at
+    // the specified 'set' if 'MATCH' is 'true', or that is not one of them if
+    // 'MATCH' is 'false', or 'end' if there is no such character.
+{
+    for (; begin != end; ++begin) {
+        if (isFound<MATCH>(*begin, set, setLength)) {
+            return begin;                                             // RETURN
+        }
+    }
+    return end;
+}
+
+#ifdef BALXML_SCANUTIL_X86_SIMD
+
+template <bool MATCH, int SET_LENGTH>
+const char *scanSse2(const char *begin, const char *end, const char *set)
+    // Return the address of the first character in the specified range
+    // '[begin, end)' that is one of the 'SET_LENGTH' characters at the
+    // specified 'set' if 'MATCH' is 'true', or that is not one of them if
+    // 'MATCH' is 'false', or 'end' if there is no such character, using SSE2
+    // instructions.
+{
+    enum { k_BLOCK = 16 };
+
+    if (end - begin < k_BLOCK) {
+        return scanScalar<MATCH>(begin, end, set, SET_LENGTH);        // RETURN
+    }
+
+    __m128i sets[SET_LENGTH];
+    for (int i = 0; i < SET_LENGTH; ++i) {
+        sets[i] = _mm_set1_epi8(set[i]);
+    }
+
+    const char *block = begin;
+    while (true) {
+        if (end - block < k_BLOCK) {
+            if (block == end) {
+                return end;                                           // RETURN
+            }
+            block = end - k_BLOCK;
+        }
+
+        const __m128i chunk = _mm_loadu_si128(
+                                     reinterpret_cast<const __m128i *>(block));
+
+        __m128i found = _mm_cmpeq_epi8(chunk, sets[0]);
+        for (int i = 1; i < SET_LENGTH; ++i) {
+            found = _mm_or_si128(found, _mm_cmpeq_epi8(chunk, sets[i]));
+        }
+
+        bsl::uint32_t mask = static_cast<bsl::uint32_t>(
+                                                   _mm_movemask_epi8(found));
+        if (!MATCH) {
+            mask ^= 0xFFFFu;
+        }
+
+        if (mask) {
+            return block + bdlb::BitUtil::numTrailingUnsetBits(mask); // RETURN
+        }
+
+        block += k_BLOCK;
+    }
+}
+
+template <bool MATCH, int SET_LENGTH>
+__attribute__((target("avx2")))
+const char *scanAvx2(const char *begin, const char *end, const char *set)
+    // Return the address of the first character in the specified range
+    // '[begin, end)' that is one of the 'SET_LENGTH' characters at the
+    // specified 'set' if 'MATCH' is 'true', or that is not one of them if
+    // 'MATCH' is 'false', or 'end' if there is no such character, using AVX2
+    // instructions.  The behavior is undefined unless the CPU supports AVX2.
+{
+    enum { k_BLOCK = 32 };
+
+    if (end - begin < k_BLOCK) {
+        return scanSse2<MATCH, SET_LENGTH>(begin, end, set);          // RETURN
+    }
+
+    // Search the first 16 characters with SSE2 instructions first, as most
+    // searches in markup end within a few characters.
+
+    const char *prefixEnd = begin + k_BLOCK / 2;
+    const char *prefix    = scanSse2<MATCH, SET_LENGTH>(begin, prefixEnd, set);
+    if (prefix != prefixEnd) {
+        return prefix;                                                // RETURN
+    }
+    begin = prefixEnd;
+
+    __m256i sets[SET_LENGTH];
+    for (int i = 0; i < SET_LENGTH; ++i) {
+        sets[i] = _mm256_set1_epi8(set[i]);
+    }
+
+    const char *result = end;
+    const char *block  = begin;
+    while (true) {
+        if (end - block < k_BLOCK) {
+            if (block == end) {
+                break;
+            }
+            block = end - k_BLOCK;
+        }
+
+        const __m256i chunk = _mm256_loadu_si256(
+                                     reinterpret_cast<const __m256i *>(block));
+
+        __m256i found = _mm256_cmpeq_epi8(chunk, sets[0]);
+        for (int i = 1; i < SET_LENGTH; ++i) {
+            found = _mm256_or_si256(found, _mm256_cmpeq_epi8(chunk, sets[i]));
+        }
+
+        bsl::uint32_t mask = static_cast<bsl::uint32_t>(
+                                                _mm256_movemask_epi8(found));
+        if (!MATCH) {
+            mask = ~mask;
+        }
+
+        if (mask) {
+            result = block + bdlb::BitUtil::numTrailingUnsetBits(mask);
+            break;
+        }
+
+        block += k_BLOCK;
+    }
+
+    // Clear the upper halves of the AVX registers explicitly, as compilers do
+    // not always do so (e.g., GCC without '-O2'), to avoid the penalty for
+    // then executing SSE instructions.
+
+    _mm256_zeroupper();
+
+    return result;
+}
+
+template <bool MATCH>
+const char *scanSse2(const char  *begin,
+                     const char  *end,
+                     const char  *set,
+                     bsl::size_t  setLength)
+    // Return the result of 'scanSse2<MATCH, SET_LENGTH>' for the specified
+    // 'begin', 'end', and 'set', where 'SET_LENGTH' is the specified
+    // 'setLength'.
+{
+    switch (setLength) {
+      case 1:  return scanSse2<MATCH, 1>(begin, end, set);            // RETURN
+      case 2:  return scanSse2<MATCH, 2>(begin, end, set);            // RETURN
+      case 3:  return scanSse2<MATCH, 3>(begin, end, set);            // RETURN
+      case 4:  return scanSse2<MATCH, 4>(begin, end, set);            // RETURN
+      case 5:  return scanSse2<MATCH, 5>(begin, end, set);            // RETURN
+      case 6:  return scanSse2<MATCH, 6>(begin, end, set);            // RETURN
+      case 7:  return scanSse2<MATCH, 7>(begin, end, set);            // RETURN
+      default: return scanSse2<MATCH, 8>(begin, end, set);            // RETURN
+    }
+}
+
+template <bool MATCH>
+const char *scanAvx2(const char  *begin,
+                     const char  *end,
+                     const char  *set,
+                     bsl::size_t  setLength)
+    // Return the result of 'scanAvx2<MATCH, SET_LENGTH>' for the specified
+    // 'begin', 'end', and 'set', where 'SET_LENGTH' is the specified
+    // 'setLength'.
+{
+    switch (setLength) {
+      case 1:  return scanAvx2<MATCH, 1>(begin, end, set);            // RETURN
+      case 2:  return scanAvx2<MATCH, 2>(begin, end, set);            // RETURN
+      case 3:  return scanAvx2<MATCH, 3>(begin, end, set);            // RETURN
+      case 4:  return scanAvx2<MATCH, 4>(begin, end, set);            // RETURN
+      case 5:  return scanAvx2<MATCH, 5>(begin, end, set);            // RETURN
+      case 6:  return scanAvx2<MATCH, 6>(begin, end, set);            // RETURN
+      case 7:  return scanAvx2<MATCH, 7>(begin, end, set);            // RETURN
+      default: return scanAvx2<MATCH, 8>(begin, end, set);            // RETURN
+    }
+}
+
+#endif  // BALXML_SCANUTIL_X86_SIMD
+
+ScanUtil::Implementation selectImplementation()
+    // Return the fastest implementation supported by this platform and CPU.
+{
+#ifdef BALXML_SCANUTIL_X86_SIMD
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2")) {
+        return ScanUtil::e_AVX2;                                      // RETURN
+    }
+    return ScanUtil::e_SSE2;
+#else
+    return ScanUtil::e_SCALAR;
+#endif
+}
+
+const ScanUtil::Implementation s_selected = selectImplementation();
+    // The implementation used by the searches not taking an implementation.
+    // Note that, being zero-initialized before it is dynamically initialized,
+    // this is 'e_SCALAR' if used during the initialization of another
+    // translation unit, which is correct, if slower.
+
+template <bool MATCH>
+inline
+const char *scan(ScanUtil::Implementation  implementation,
+                 const char               *begin,
+                 const char               *end,
+                 const char               *set,
+                 bsl::size_t               setLength)
+    // Return the result of searching the specified range '[begin, end)' for
+    // the first character that is (if 'MATCH' is 'true') or is not (if
+    // 'MATCH' is 'false') one of the specified 'setLength' characters at the
+    // specified 'set', using the specified 'implementation'.
+{
+    BSLS_ASSERT(begin <= end);
+    BSLS_ASSERT(set);
+    BSLS_ASSERT(1 <= setLength);
+    BSLS_ASSERT(setLength <= ScanUtil::k_MAX_SET_LENGTH);
+    BSLS_ASSERT(ScanUtil::isSupported(implementation));
+
+    switch (implementation) {
+#ifdef BALXML_SCANUTIL_X86_SIMD
+      case ScanUtil::e_AVX2: {
+        return scanAvx2<MATCH>(begin, end, set, setLength);           // RETURN
+      }
+      case ScanUtil::e_SSE2: {
+        return scanSse2<MATCH>(begin, end, set, setLength);           // RETURN
+      }
+#endif
+      default: {
+        return scanScalar<MATCH>(begin, end, set, setLength);         // RETURN
+      }
+    }
+}
+
+}  // close unnamed namespace
+
+                              // ---------------
+                              // struct ScanUtil
+                              // ---------------
+
+// CLASS METHODS
+const char *ScanUtil::findFirstNotOf(const char  *begin,
+                                     const char  *end,
+                                     const char  *set,
+                                     bsl::size_t  setLength)
+{
+    return scan<false>(s_selected, begin, end, set, setLength);
+}
+
+const char *ScanUtil::findFirstNotOf(Implementation  implementation,
+                                     const char     *begin,
+                                     const char     *end,
+                                     const char     *set,
+                                     bsl::size_t     setLength)
+{
+    return scan<false>(implementation, begin, end, set, setLength);
+}
+
+const char *ScanUtil::findFirstOf(const char  *begin,
+                                  const char  *end,
+                                  const char  *set,
+                                  bsl::size_t  setLength)
+{
+    return scan<true>(s_selected, begin, end, set, setLength);
+}
+
+const char *ScanUtil::findFirstOf(Implementation  implementation,
+                                  const char     *begin,
+                                  const char     *end,
+                                  const char     *set,
+                                  bsl::size_t     setLength)
+{
+    return scan<true>(implementation, begin, end, set, setLength);
+}
+
+bool ScanUtil::isSupported(Implementation implementation)
+{
+    switch (implementation) {
+      case e_SCALAR: {
+        return true;                                                  // RETURN
+      }
+#ifdef BALXML_SCANUTIL_X86_SIMD
+      case e_SSE2: {
+        return true;                                                  // RETURN
+      }
+      case e_AVX2: {
+        return e_AVX2 == s_selected;                                  // RETURN
+      }
+#endif
+      default: {
+        return false;                                                 // RETURN
+      }
+    }
+}
+
+ScanUtil::Implementation ScanUtil::selectedImplementation()
+{
+    return s_selected;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
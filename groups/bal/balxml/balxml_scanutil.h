@@ -0,0 +1,179 @@
+// balxml_scanutil.h                                                  -*-C++-*-
+#ifndef INCLUDED_BALXML_SCANUTIL
+#define INCLUDED_BALXML_SCANUTIL
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide vectorized searches for characters in XML markup.
+//
+//@CLASSES:
+//  balxml::ScanUtil: namespace for vectorized character searches
+//
+//@SEE_ALSO: balxml_minireader
+//
+//@DESCRIPTION: This component provides a utility 'struct', 'balxml::ScanUtil',
+// that provides functions to find, in a range of characters, the first
+// character that is (or is not) one of a small set of characters, such as the
+// markup characters '<', '>', '&', and quotes, or the whitespace characters.
+// These are the searches with which 'balxml::MiniReader' finds the end of text
+// nodes, tag names, and attribute values, and skips whitespace.
+//
+// The searches have the semantics of 'bsl::find_first_of' (and its negation),
+// but, unlike the 'bsl::strcspn' and 'bsl::strspn' functions on which the
+// reader was based, compare 16 or 32 characters at a time using SIMD
+// instructions where available:
+//
+//: o 'e_AVX2': AVX2 instructions, comparing 32 characters at a time, if
+//:   supported by the CPU on which the program runs.
+//:
+//: o 'e_SSE2': SSE2 instructions, comparing 16 characters at a time, on all
+//:   x86-64 CPUs.
+//:
+//: o 'e_SCALAR': a portable implementation comparing one character at a time.
+//
+// The implementation is selected at runtime, once, by querying the CPU, and
+// is the first implementation in the list above that is supported.  SIMD
+// implementations are available only on x86-64 platforms, and only with the
+// GCC and Clang compilers (which support compiling a function for an
+// instruction set that is not enabled for the translation unit).
+//
+// Each function also has an overload taking the implementation to use
+// explicitly, for use in testing and benchmarking.  Note that all
+// implementations return the same result for the same arguments, and never
+// read outside the range being searched.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Finding the End of a Text Node
+///- - - - - - - - - - - - - - - - - - - - -
+// Suppose that we are writing an XML parser, and need to find the end of the
+// text following an element tag, which is terminated by the start of the next
+// tag or by an entity reference.
+//
+// First, we define the text being parsed:
+//..
+//  const char  TEXT[] = "Twenty-five thousand leagues &amp; more</title>";
+//  const char *end    = TEXT + sizeof TEXT - 1;
+//..
+// Then, we find the first markup character:
+//..
+//  const char *markup = balxml::ScanUtil::findFirstOf(TEXT, end, "<&", 2);
+//  assert(TEXT + 29 == markup);
+//  assert('&'       == *markup);
+//..
+// Next, we skip the whitespace at the start of a range of characters:
+//..
+//  const char  INDENTED[] = " \t \r\n  <root/>";
+//  const char *text       = balxml::ScanUtil::findFirstNotOf(
+//                                          INDENTED,
+//                                          INDENTED + sizeof INDENTED - 1,
+//                                          " \t\r\n",
+//                                          4);
+//  assert('<' == *text);
+//..
+// Finally, we observe that the end of the range is returned if there is no
+// such character:
+//..
+//  assert(end == balxml::ScanUtil::findFirstOf(TEXT, end, "\"'", 2));
+//..
+
+#include <balscm_version.h>
+
+#include <bsl_cstddef.h>
+
+namespace BloombergLP {
+namespace balxml {
+
+                              // ===============
+                              // struct ScanUtil
+                              // ===============
+
+struct ScanUtil {
+    // This 'struct' provides a namespace for functions finding characters in
+    // ranges of characters, using SIMD instructions where available.
+
+    // TYPES
+    enum Implementation {
+        // Enumerate the implementations of the searches.
+
+        e_SCALAR = 0,  // one character at a time (all platforms)
+        e_SSE2   = 1,  // 16 characters at a time (x86-64)
+        e_AVX2   = 2   // 32 characters at a time (x86-64 with AVX2)
+    };
+
+    enum {
+        k_MAX_SET_LENGTH = 8  // maximum number of characters in a set
+    };
+
+    // CLASS METHODS
+    static const char *findFirstNotOf(const char  *begin,
+                                      const char  *end,
+                                      const char  *set,
+                                      bsl::size_t  setLength);
+    static const char *findFirstNotOf(Implementation  implementation,
+                                      const char     *begin,
+                                      const char     *end,
+                                      const char     *set,
+                                      bsl::size_t     setLength);
+        // Return the address of the first character in the specified range
+        // '[begin, end)' that is not one of the specified 'setLength'
+        // characters at the specified 'set', or 'end' if there is no such
+        // character.  Optionally specify the 'implementation' to use; if
+        // 'implementation' is not specified, the implementation selected for
+        // this process is used.  The behavior is undefined unless
+        // '[begin, end)' is a valid range, '[set, set + setLength)' is a valid
+        // range, '1 <= setLength <= k_MAX_SET_LENGTH', and 'implementation'
+        // (if specified) is supported.
+
+    static const char *findFirstOf(const char  *begin,
+                                   const char  *end,
+                                   const char  *set,
+                                   bsl::size_t  setLength);
+    static const char *findFirstOf(Implementation  implementation,
+                                   const char     *begin,
+                                   const char     *end,
+                                   const char     *set,
+                                   bsl::size_t     setLength);
+        // Return the address of the first character in the specified range
+        // '[begin, end)' that is one of the specified 'setLength' characters
+        // at the specified 'set', or 'end' if there is no such character.
+        // Optionally specify the 'implementation' to use; if 'implementation'
+        // is not specified, the implementation selected for this process is
+        // used.  The behavior is undefined unless '[begin, end)' is a valid
+        // range, '[set, set + setLength)' is a valid range,
+        // '1 <= setLength <= k_MAX_SET_LENGTH', and 'implementation' (if
+        // specified) is supported.
+
+    static bool isSupported(Implementation implementation);
+        // Return 'true' if the specified 'implementation' is supported by this
+        // platform and by the CPU on which this process runs, and 'false'
+        // otherwise.
+
+    static Implementation selectedImplementation();
+        // Return the implementation used by the searches that do not take an
+        // implementation, which is the fastest supported implementation.
+};
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,560 @@
+// balxml_scanutil.t.cpp                                              -*-C++-*-
+#include <balxml_scanutil.h>
+
+#include <bslim_testutil.h>
+
+#include <bsls_asserttest.h>
+#include <bsls_review.h>
+#include <bsls_stopwatch.h>
+
+#include <bsl_algorithm.h>
+#include <bsl_cstdlib.h>
+#include <bsl_cstring.h>
+#include <bsl_iostream.h>
+#include <bsl_string.h>
+#include <bsl_vector.h>
+
+using namespace BloombergLP;
+using namespace bsl;
+
+// ============================================================================
+//                             TEST PLAN
+// ----------------------------------------------------------------------------
+//                              Overview
+//                              --------
+// The component under test is a utility providing searches for the first
+// character of a range that is, or is not, in a set, with several
+// implementations.  Each supported implementation is compared with
+// 'bsl::find_first_of' (and its negation) for every range length up to
+// several SIMD blocks, at every alignment, with the character found at every
+// position, and for sets of every supported length.
+// ----------------------------------------------------------------------------
+// CLASS METHODS
+// [3] const char *findFirstNotOf(begin, end, set, setLength);
+// [3] const char *findFirstNotOf(impl, begin, end, set, setLength);
+// [3] const char *findFirstOf(begin, end, set, setLength);
+// [3] const char *findFirstOf(impl, begin, end, set, setLength);
+// [2] bool isSupported(Implementation implementation);
+// [2] Implementation selectedImplementation();
+// ----------------------------------------------------------------------------
+// [1] BREATHING TEST
+// [4] USAGE EXAMPLE
+// [-1] PERFORMANCE TEST
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLIM_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLIM_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLIM_TESTUTIL_LOOP6_ASSERT
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_SAFE_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_PASS(EXPR)
+#define ASSERT_SAFE_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_FAIL(EXPR)
+#define ASSERT_PASS(EXPR)      BSLS_ASSERTTEST_ASSERT_PASS(EXPR)
+#define ASSERT_FAIL(EXPR)      BSLS_ASSERTTEST_ASSERT_FAIL(EXPR)
+#define ASSERT_OPT_PASS(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_PASS(EXPR)
+#define ASSERT_OPT_FAIL(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_FAIL(EXPR)
+
+// ============================================================================
+//                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef balxml::ScanUtil Util;
+
+const Util::Implementation IMPLEMENTATIONS[] = {
+    Util::e_SCALAR,
+    Util::e_SSE2,
+    Util::e_AVX2
+};
+const int NUM_IMPLEMENTATIONS = sizeof IMPLEMENTATIONS
+                              / sizeof *IMPLEMENTATIONS;
+
+// ============================================================================
+//                  GLOBAL HELPER FUNCTIONS FOR TESTING
+// ----------------------------------------------------------------------------
+
+static
+const char *oracle(bool        match,
+                   const char *begin,
+                   const char *end,
+                   const char *set,
+                   bsl::size_t setLength)
+    // Return the address of the first character in the specified range
+    // '[begin, end)' that is one of the specified 'setLength' characters at
+    // the specified 'set' if the specified 'match' is 'true', or that is not
+    // one of them if 'match' is 'false', or 'end' if there is no such
+    // character.
+{
+    for (; begin != end; ++begin) {
+        if (match == (set + setLength != bsl::find(set,
+                                                   set + setLength,
+                                                   *begin))) {
+            return begin;                                             // RETURN
+        }
+    }
+    return end;
+}
+
+// ============================================================================
+//                               MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int  test            = argc > 1 ? bsl::atoi(argv[1]) : 0;
+    bool verbose         = argc > 2;
+    bool veryVerbose     = argc > 3;
+
+    // CONCERN: 'BSLS_REVIEW' failures should lead to test failures.
+    bsls::ReviewFailureHandlerGuard reviewGuard(&bsls::Review::failByAbort);
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+    switch (test)  { case 0:
+      case 4: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "USAGE EXAMPLE" << endl
+                          << "=============" << endl;
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Finding the End of a Text Node
+///- - - - - - - - - - - - - - - - - - - - -
+// Suppose that we are writing an XML parser, and need to find the end of the
+// text following an element tag, which is terminated by the start of the next
+// tag or by an entity reference.
+//
+// First, we define the text being parsed:
+//..
+    const char  TEXT[] = "Twenty-five thousand leagues &amp; more</title>";
+    const char *end    = TEXT + sizeof TEXT - 1;
+//..
+// Then, we find the first markup character:
+//..
+    const char *markup = balxml::ScanUtil::findFirstOf(TEXT, end, "<&", 2);
+    ASSERT(TEXT + 29 == markup);
+    ASSERT('&'       == *markup);
+//..
+// Next, we skip the whitespace at the start of a range of characters:
+//..
+    const char  INDENTED[] = " \t \r\n  <root/>";
+    const char *text       = balxml::ScanUtil::findFirstNotOf(
+                                            INDENTED,
+                                            INDENTED + sizeof INDENTED - 1,
+                                            " \t\r\n",
+                                            4);
+    ASSERT('<' == *text);
+//..
+// Finally, we observe that the end of the range is returned if there is no
+// such character:
+//..
+    ASSERT(end == balxml::ScanUtil::findFirstOf(TEXT, end, "\"'", 2));
+//..
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // 'findFirstOf' AND 'findFirstNotOf'
+        //
+        // Concerns:
+        //: 1 Each implementation returns the first character that is (or is
+        //:   not) in the set, or 'end' if there is none.
+        //:
+        //: 2 Ranges of every length, including shorter than a SIMD block and
+        //:   not a multiple of one, at every alignment, are searched
+        //:   correctly, without reading outside the range.
+        //:
+        //: 3 Sets of every length up to 'k_MAX_SET_LENGTH', including the null
+        //:   character and characters having the high bit set, are supported.
+        //:
+        //: 4 The overloads not taking an implementation use the selected one.
+        //:
+        //: 5 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 For each supported implementation, set length, range length up to
+        //:   100, and alignment up to 32, fill the range (in a buffer padded
+        //:   with characters that match) with characters that do not match,
+        //:   and place one or two matching characters at every position;
+        //:   verify the results against an oracle.  (C-1..4)
+        //:
+        //: 2 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for invalid arguments.  (C-5)
+        //
+        // Testing:
+        //   const char *findFirstNotOf(begin, end, set, setLength);
+        //   const char *findFirstNotOf(impl, begin, end, set, setLength);
+        //   const char *findFirstOf(begin, end, set, setLength);
+        //   const char *findFirstOf(impl, begin, end, set, setLength);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "'findFirstOf' AND 'findFirstNotOf'" << endl
+                          << "==================================" << endl;
+
+        const char SET[] = { '<', '\n', '\0', '&', '"', '\'', '\xE2', ' ' };
+
+        const int MAX_LENGTH = 100;
+        const int MAX_OFFSET = 32;
+
+        char buffer[MAX_OFFSET + MAX_LENGTH + MAX_OFFSET];
+
+        for (int ii = 0; ii < NUM_IMPLEMENTATIONS; ++ii) {
+            const Util::Implementation IMPL = IMPLEMENTATIONS[ii];
+
+            if (!Util::isSupported(IMPL)) {
+                if (verbose) { T_ P_(IMPL) Q(not supported) }
+                continue;
+            }
+
+            if (verbose) { T_ P(IMPL) }
+
+            for (bsl::size_t setLength = 1;
+                 setLength <= Util::k_MAX_SET_LENGTH;
+                 ++setLength) {
+                const char *set     = SET;
+                const char  IN_SET  = SET[setLength - 1];
+                const char  OUT_SET = 'x';
+
+                if (veryVerbose) { T_ T_ P(setLength) }
+
+                for (int length = 0; length <= MAX_LENGTH; ++length) {
+                for (int offset = 0; offset < MAX_OFFSET; ++offset) {
+                    // Pad the range with matching characters, so that reading
+                    // outside the range would be detected.
+
+                    bsl::fill(buffer, buffer + sizeof buffer, IN_SET);
+
+                    char       *begin = buffer + MAX_OFFSET + offset;
+                    const char *end   = begin + length;
+
+                    for (int pos = -1; pos < length; ++pos) {
+                        // Place a matching character at 'pos' (none if -1),
+                        // and another one after it.
+
+                        bsl::fill(begin, begin + length, OUT_SET);
+                        if (0 <= pos) {
+                            begin[pos] = IN_SET;
+                            if (pos + 5 < length) {
+                                begin[pos + 5] = SET[0];
+                            }
+                        }
+
+                        const char *EXP = oracle(true,
+                                                 begin,
+                                                 end,
+                                                 set,
+                                                 setLength);
+                        const char *result = Util::findFirstOf(IMPL,
+                                                               begin,
+                                                               end,
+                                                               set,
+                                                               setLength);
+                        ASSERTV(IMPL, setLength, length, offset, pos,
+                                EXP == result);
+
+                        if (IMPL == Util::selectedImplementation()) {
+                            ASSERTV(setLength, length, offset, pos,
+                                    EXP == Util::findFirstOf(begin,
+                                                             end,
+                                                             set,
+                                                             setLength));
+                        }
+
+                        // Invert the range to test 'findFirstNotOf'.
+
+                        for (int i = 0; i < length; ++i) {
+                            begin[i] = OUT_SET == begin[i] ? IN_SET : OUT_SET;
+                        }
+                        bsl::fill(buffer,
+                                  buffer + MAX_OFFSET + offset,
+                                  OUT_SET);
+                        bsl::fill(begin + length,
+                                  buffer + sizeof buffer,
+                                  OUT_SET);
+
+                        const char *NEXP = oracle(false,
+                                                  begin,
+                                                  end,
+                                                  set,
+                                                  setLength);
+                        ASSERTV(IMPL, setLength, length, offset, pos,
+                                NEXP == (0 <= pos ? begin + pos : end));
+
+                        const char *nresult = Util::findFirstNotOf(IMPL,
+                                                                   begin,
+                                                                   end,
+                                                                   set,
+                                                                   setLength);
+                        ASSERTV(IMPL, setLength, length, offset, pos,
+                                NEXP == nresult);
+
+                        if (IMPL == Util::selectedImplementation()) {
+                            ASSERTV(setLength, length, offset, pos,
+                                    NEXP == Util::findFirstNotOf(begin,
+                                                                 end,
+                                                                 set,
+                                                                 setLength));
+                        }
+
+                        bsl::fill(buffer, buffer + sizeof buffer, IN_SET);
+                    }
+                }
+                }
+            }
+        }
+
+        if (verbose) cout << "\tNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            const char TEXT[] = "abc";
+            const char *B = TEXT;
+            const char *E = TEXT + 3;
+
+            ASSERT_PASS(Util::findFirstOf(B, E, "<", 1));
+            ASSERT_PASS(Util::findFirstOf(B, B, "<", 1));
+            ASSERT_PASS(Util::findFirstOf(B, E, "<<<<<<<<", 8));
+            ASSERT_FAIL(Util::findFirstOf(E, B, "<", 1));
+            ASSERT_FAIL(Util::findFirstOf(B, E, 0, 1));
+            ASSERT_FAIL(Util::findFirstOf(B, E, "<", 0));
+            ASSERT_FAIL(Util::findFirstOf(B, E, "<<<<<<<<<", 9));
+
+            ASSERT_PASS(Util::findFirstNotOf(B, E, " ", 1));
+            ASSERT_FAIL(Util::findFirstNotOf(E, B, " ", 1));
+            ASSERT_FAIL(Util::findFirstNotOf(B, E, " ", 0));
+
+            ASSERT_PASS(Util::findFirstOf(Util::e_SCALAR, B, E, "<", 1));
+            if (!Util::isSupported(Util::e_AVX2)) {
+                ASSERT_FAIL(Util::findFirstOf(Util::e_AVX2, B, E, "<", 1));
+            }
+        }
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // 'isSupported' AND 'selectedImplementation'
+        //
+        // Concerns:
+        //: 1 The scalar implementation is always supported.
+        //:
+        //: 2 The selected implementation is the fastest supported one.
+        //
+        // Plan:
+        //: 1 Verify the supported implementations and that the selected one
+        //:   is the last supported one in order of speed.  (C-1..2)
+        //
+        // Testing:
+        //   bool isSupported(Implementation implementation);
+        //   Implementation selectedImplementation();
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "'isSupported' AND 'selectedImplementation'"
+                          << endl
+                          << "=========================================="
+                          << endl;
+
+        ASSERT(Util::isSupported(Util::e_SCALAR));
+
+        Util::Implementation fastest = Util::e_SCALAR;
+        for (int ii = 0; ii < NUM_IMPLEMENTATIONS; ++ii) {
+            if (Util::isSupported(IMPLEMENTATIONS[ii])) {
+                fastest = IMPLEMENTATIONS[ii];
+            }
+        }
+
+        if (verbose) { P_(fastest) P(Util::selectedImplementation()) }
+
+        ASSERT(fastest == Util::selectedImplementation());
+
+        if (Util::isSupported(Util::e_AVX2)) {
+            ASSERT(Util::isSupported(Util::e_SSE2));
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Search a short and a long text for markup and for
+        //:   non-whitespace.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        const char SHORT[] = "ab<c";
+        ASSERT(SHORT + 2 == Util::findFirstOf(SHORT, SHORT + 4, "<>", 2));
+        ASSERT(SHORT + 4 == Util::findFirstOf(SHORT, SHORT + 4, "&", 1));
+        ASSERT(SHORT     == Util::findFirstNotOf(SHORT, SHORT + 4, " ", 1));
+
+        bsl::string text(200, ' ');
+        text += "value</element>";
+
+        const char *B = text.data();
+        const char *E = B + text.length();
+
+        ASSERT(B + 205 == Util::findFirstOf(B, E, "<&", 2));
+        ASSERT(B + 200 == Util::findFirstNotOf(B, E, " \t\r\n", 4));
+        ASSERT(E       == Util::findFirstOf(B, E, "\"", 1));
+      } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE TEST
+        //
+        // Concerns:
+        //: 1 The SIMD implementations are faster than 'bsl::strcspn' and the
+        //:   scalar implementation for long runs of text.
+        //
+        // Plan:
+        //: 1 Search a 1MB text with no markup characters with 'bsl::strcspn'
+        //:   and each supported implementation, and report the throughput.
+        //:   (C-1)
+        //
+        // Testing:
+        //   PERFORMANCE TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "PERFORMANCE TEST" << endl
+                          << "================" << endl;
+
+        const int LENGTH     = 1 << 20;
+        const int ITERATIONS = argc > 2 ? bsl::atoi(argv[2]) : 100;
+
+        bsl::string text(LENGTH, 'a');
+        const char *B = text.c_str();
+        const char *E = B + LENGTH;
+
+        const char SET[] = "<&\n";  // including the null character
+
+        // Vary the start of the text, so that the searches are not hoisted
+        // out of the loops.
+
+        bsls::Stopwatch timer;
+        bsl::size_t     sum = 0;
+
+        timer.start();
+        for (int i = 0; i < ITERATIONS; ++i) {
+            sum += bsl::strcspn(B + (i & 1), SET);
+        }
+        timer.stop();
+
+        cout << "strcspn: "
+             << ITERATIONS / timer.elapsedTime() << " MB/s" << endl;
+
+        for (int ii = 0; ii < NUM_IMPLEMENTATIONS; ++ii) {
+            const Util::Implementation IMPL = IMPLEMENTATIONS[ii];
+
+            if (!Util::isSupported(IMPL)) {
+                continue;
+            }
+
+            timer.reset();
+            timer.start();
+            for (int i = 0; i < ITERATIONS; ++i) {
+                sum += Util::findFirstOf(IMPL, B + (i & 1), E, SET, sizeof SET)
+                     - B;
+            }
+            timer.stop();
+
+            cout << "implementation " << IMPL << ": "
+                 << ITERATIONS / timer.elapsedTime() << " MB/s" << endl;
+        }
+
+        ASSERT(0 < sum);
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      } break;
+    }
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
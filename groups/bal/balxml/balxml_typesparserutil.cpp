@@ -19,6 +19,8 @@ BSLS_IDENT_RCSID(balxml_typesparserutil_cpp,"$Id$ $CSID$")
 
 #include <bdlsb_fixedmeminstreambuf.h>
 
+#include <bdlb_numericparseutil.h>
+
 #include <bdldfp_decimalutil.h>
 
 #include <bsl_climits.h>
@@ -199,7 +201,21 @@ int parseInt(int *result, const char *input, int inputLength)
     if (0 == inputLength) {
         return BAEXML_FAILURE;                                        // RETURN
     }
-    else if (inputLength < BUFLEN) {
+
+    // Parse the common case, an optionally signed sequence of digits that is
+    // in range, without copying the input.  Anything else (e.g., leading
+    // whitespace) is left to 'strtol'.
+
+    bslstl::StringRef remainder;
+    if (0 == bdlb::NumericParseUtil::parseInt(
+                                         result,
+                                         &remainder,
+                                         bslstl::StringRef(input, inputLength))
+     && remainder.isEmpty()) {
+        return BAEXML_SUCCESS;                                        // RETURN
+    }
+
+    if (inputLength < BUFLEN) {
         // Use a fixed-length buffer for efficiency.
         char  buffer[BUFLEN];
         bsl::memcpy(buffer, input, inputLength);
@@ -239,7 +255,20 @@ int parseUnsignedInt(unsigned int *result, const char *input, int inputLength)
     if (0 == inputLength) {
         return BAEXML_FAILURE;                                        // RETURN
     }
-    else if (inputLength < BUFLEN) {
+
+    // Parse the common case, a sequence of digits that is in range, without
+    // copying the input.  Anything else is left to 'strtoul'.
+
+    bslstl::StringRef remainder;
+    if (0 == bdlb::NumericParseUtil::parseUint(
+                                         result,
+                                         &remainder,
+                                         bslstl::StringRef(input, inputLength))
+     && remainder.isEmpty()) {
+        return BAEXML_SUCCESS;                                        // RETURN
+    }
+
+    if (inputLength < BUFLEN) {
         // Use a fixed-length buffer for efficiency.
         char  buffer[BUFLEN];
         bsl::memcpy(buffer, input, inputLength);
@@ -474,6 +503,20 @@ int TypesParserUtil_Imp::parseDecimal(bsls::Types::Uint64        *result,
         return BAEXML_FAILURE;                                        // RETURN
     }
 
+    if ('0' <= input[0] && input[0] <= '9') {
+        // Parse the common case, a sequence of digits that is in range,
+        // eight digits at a time.
+
+        bslstl::StringRef remainder;
+        if (0 == bdlb::NumericParseUtil::parseUint64(
+                                         result,
+                                         &remainder,
+                                         bslstl::StringRef(input, inputLength))
+         && remainder.isEmpty()) {
+            return BAEXML_SUCCESS;                                    // RETURN
+        }
+    }
+
     bsls::Types::Uint64 val = 0;
 
     for (; 0 < inputLength; --inputLength) {
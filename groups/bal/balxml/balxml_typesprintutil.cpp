@@ -12,6 +12,7 @@
 #include <bsls_ident.h>
 BSLS_IDENT_RCSID(balxml_typesprintutil_cpp,"$Id$ $CSID$")
 
+#include <bdlb_numericformatutil.h>
 #include <bdlb_print.h>
 #include <bdlde_base64encoder.h>
 #include <bdldfp_decimalutil.h>
@@ -928,26 +929,17 @@ bsl::ostream& TypesPrintUtil_Imp::printDefault(
       default: {
         // not a NaN and not +/- INFINITY
 
-        // On Sun, formatting a 'double' using 'ostream' is 60% slower than
-        // 'sprintf', even though the former calls the latter.  Also, note that
-        // 'snprintf' is 15% slower than 'sprintf' on Sun.
+        // Write the shortest text that round-trips to 'object', which is also
+        // several times faster than formatting with 'sprintf'.
 
-        char buffer[FLT_DIG + 20];  // buffer with headroom
+        char        buffer[bdlb::NumericFormatUtil::k_FLOAT_MAX_STRLEN];
+        const char *end = bdlb::NumericFormatUtil::toChars(
+                                                        buffer,
+                                                        buffer + sizeof buffer,
+                                                        object);
+        BSLS_ASSERT(end);
 
-#if defined(BSLS_PLATFORM_CMP_MSVC)
-#pragma warning(push)
-#pragma warning(disable:4996)     // suppress 'sprintf' deprecation warning
-#endif
-
-        const int len =
-                    bsl::sprintf(buffer, "%.*g", FLT_DIG + 1, (double) object);
-        BSLS_ASSERT(len < (int) sizeof buffer);
-
-#if defined(BSLS_PLATFORM_CMP_MSVC)
-#pragma warning(pop)
-#endif
-
-        stream.write(buffer, len);
+        stream.write(buffer, end - buffer);
       } break;
     }
 
@@ -974,25 +966,17 @@ bsl::ostream& TypesPrintUtil_Imp::printDefault(
       default: {
         // not a NaN and not +/- INFINITY
 
-        // On Sun, formatting a 'double' using 'ostream' is 60% slower than
-        // 'sprintf', even though the former calls the latter.  Also, note that
-        // 'snprintf' is 15% slower than 'sprintf' on Sun.
+        // Write the shortest text that round-trips to 'object', which is also
+        // several times faster than formatting with 'sprintf'.
 
-        char buffer[DBL_DIG + 20];  // buffer with headroom
-
-#if defined(BSLS_PLATFORM_CMP_MSVC)
-#pragma warning(push)
-#pragma warning(disable:4996)     // suppress 'sprintf' deprecation warning
-#endif
-
-        const int len = bsl::sprintf(buffer, "%.*g", DBL_DIG + 1, object);
-        BSLS_ASSERT(len < (int) sizeof buffer);
-
-#if defined(BSLS_PLATFORM_CMP_MSVC)
-#pragma warning(pop)
-#endif
+        char        buffer[bdlb::NumericFormatUtil::k_DOUBLE_MAX_STRLEN];
+        const char *end = bdlb::NumericFormatUtil::toChars(
+                                                        buffer,
+                                                        buffer + sizeof buffer,
+                                                        object);
+        BSLS_ASSERT(end);
 
-        stream.write(buffer, len);
+        stream.write(buffer, end - buffer);
       } break;
     }
 
@@ -104,6 +104,14 @@ BSLS_IDENT("$Id: $")
 //      Enumeration                         TEXT
 //..
 //
+///Printing 'float' and 'double' Values
+///------------------------------------
+// Finite 'float' and 'double' values printed using the DEFAULT formatting mode
+// are written as the *shortest* decimal text that converts back to exactly
+// the printed value (see 'bdlb_numericformatutil'), so that no information is
+// lost in an encode/decode round trip.  Infinities are printed as "+INF" and
+// "-INF", and NaN values as "NaN".
+//
 ///Behavior of 'printText' on Non-Valid Strings
 ///--------------------------------------------
 // The output of 'printText' will always be valid XML 1.0 with UTF-8 encoding.
@@ -94,16 +94,6 @@ void aSsErT(bool condition, const char *message, int line)
 #define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
 #define L_           BSLIM_TESTUTIL_L_  // current Line number
 
-// ============================================================================
-//                   MACROS FOR TESTING WORKAROUNDS
-// ----------------------------------------------------------------------------
-
-#if defined(BSLS_PLATFORM_CMP_MSVC) && BSLS_PLATFORM_CMP_VERSION < 1900
-    // 'snprintf' on older Windows libraries outputs an additional '0' in the
-    // exponent for scientific notation.
-# define BALXML_TYPESPRINTUTIL_EXTRA_ZERO_PADDING_FOR_EXPONENTS 1
-#endif
-
 // ============================================================================
 //                   GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
 // ----------------------------------------------------------------------------
@@ -1638,12 +1628,6 @@ int main(int argc, char *argv[])
         {
             typedef float Type;
 
-#if defined(BALXML_TYPESPRINTUTIL_EXTRA_ZERO_PADDING_FOR_EXPONENTS)
-#define ZERO   "0"
-#else
-#define ZERO
-#endif
-
             static const struct {
                 int         d_lineNum;
                 Type        d_input;
@@ -1654,12 +1638,12 @@ int main(int argc, char *argv[])
                 { L_,     -1.0f,          "-1"                            },
                 { L_,     -0.1f,          "-0.1"                          },
                 { L_,     -0.1234567f,    "-0.1234567"                    },
-                { L_,     -1.234567e-35f, "-1.234567e-" ZERO "35"         },
+                { L_,     -1.234567e-35f, "-1.234567e-35"                 },
                 { L_,     0.0f,           "0"                             },
                 { L_,     0.1f,           "0.1"                           },
                 { L_,     1.0f,           "1"                             },
                 { L_,     1234567.0f,     "1234567"                       },
-                { L_,     1.234567e35f,   "1.234567e+" ZERO "35"          },
+                { L_,     1.234567e35f,   "1.234567e+35"                  },
                 { L_,     bsl::numeric_limits<float>::infinity(),
                                           "+INF"                          },
                 { L_,    -bsl::numeric_limits<float>::infinity(),
@@ -1667,7 +1651,6 @@ int main(int argc, char *argv[])
                 { L_,     bsl::numeric_limits<float>::signaling_NaN(),
                                           "NaN"                           },
             };
-#undef ZERO
             const int NUM_DATA = sizeof DATA / sizeof *DATA;
 
             for (int i = 0; i < NUM_DATA; ++i) {
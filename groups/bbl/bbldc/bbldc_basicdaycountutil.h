@@ -20,6 +20,12 @@ BSLS_IDENT("$Id: $")
 // 'DayCountConvention::Enum' argument indicating which particular day-count
 // convention to apply.
 //
+// Overloads of 'daysDiff' and 'yearsDiff' taking arrays of begin and end dates
+// are also provided, which compute the results for many pairs of dates at
+// once.  These overloads dispatch on the convention once for all the pairs,
+// and should be preferred when the same convention is applied to many pairs
+// of dates (e.g., the accrual periods of many cashflows).
+//
 ///Usage
 ///-----
 // This section illustrates intended use of this component.
@@ -57,6 +63,8 @@ BSLS_IDENT("$Id: $")
 
 #include <bbldc_daycountconvention.h>
 
+#include <bsl_cstddef.h>
+
 namespace BloombergLP {
 namespace bdlt { class Date; }
 namespace bbldc {
@@ -80,6 +88,20 @@ struct BasicDayCountUtil {
         // 'beginDate <= endDate' then the result is non-negative.  Note that
         // reversing the order of 'beginDate' and 'endDate' negates the result.
 
+    static void daysDiff(int                      *result,
+                         const bdlt::Date         *beginDates,
+                         const bdlt::Date         *endDates,
+                         bsl::size_t               numDates,
+                         DayCountConvention::Enum  convention);
+        // Load into each of the specified 'numDates' elements of the specified
+        // 'result' array the (signed) number of days between the
+        // corresponding elements of the specified 'beginDates' and 'endDates'
+        // arrays according to the specified day-count 'convention' (i.e.,
+        // 'result[i] = daysDiff(beginDates[i], endDates[i], convention)').
+        // The behavior is undefined unless 'isSupported(convention)', and
+        // 'result', 'beginDates', and 'endDates' each refer to an array of at
+        // least 'numDates' elements.
+
     static bool isSupported(DayCountConvention::Enum convention);
         // Return 'true' if the specified 'convention' is valid for use in
         // 'daysDiff' and 'yearsDiff', and 'false' otherwise.
@@ -95,6 +117,20 @@ struct BasicDayCountUtil {
         // 'beginDate' and 'endDate' negates the result; specifically,
         // '|yearsDiff(b, e, c) + yearsDiff(e, b, c)| <= 1.0e-15' for all dates
         // 'b' and 'e', and day-count conventions 'c'.
+
+    static void yearsDiff(double                   *result,
+                          const bdlt::Date         *beginDates,
+                          const bdlt::Date         *endDates,
+                          bsl::size_t               numDates,
+                          DayCountConvention::Enum  convention);
+        // Load into each of the specified 'numDates' elements of the specified
+        // 'result' array the (signed fractional) number of years between the
+        // corresponding elements of the specified 'beginDates' and 'endDates'
+        // arrays according to the specified day-count 'convention' (i.e.,
+        // 'result[i] = yearsDiff(beginDates[i], endDates[i], convention)').
+        // The behavior is undefined unless 'isSupported(convention)', and
+        // 'result', 'beginDates', and 'endDates' each refer to an array of at
+        // least 'numDates' elements.
 };
 
 }  // close package namespace
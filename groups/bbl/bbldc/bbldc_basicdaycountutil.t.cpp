@@ -8,9 +8,11 @@
 
 #include <bsls_assert.h>
 #include <bsls_asserttest.h>
+#include <bsls_stopwatch.h>
 
 #include <bsl_cstdlib.h>     // 'atoi'
 #include <bsl_iostream.h>
+#include <bsl_vector.h>
 
 using namespace BloombergLP;
 using namespace bsl;
@@ -26,10 +28,13 @@ using namespace bsl;
 // functionality of these methods.
 // ----------------------------------------------------------------------------
 // [ 2] int daysDiff(beginDate, endDate, convention);
+// [ 4] void daysDiff(result, beginDates, endDates, numDates, conv);
 // [ 1] bool isSupported(convention);
 // [ 3] double yearsDiff(beginDate, endDate, convention);
+// [ 4] void yearsDiff(result, beginDates, endDates, numDates, conv);
 // ----------------------------------------------------------------------------
-// [ 4] USAGE EXAMPLE
+// [ 5] USAGE EXAMPLE
+// [-1] PERFORMANCE: BATCH VS. SINGLE-PAIR METHODS
 // ----------------------------------------------------------------------------
 
 // ============================================================================
@@ -106,6 +111,53 @@ const Enum PSA_30_360_EOM     = bbldc::DayCountConvention::e_PSA_30_360_EOM;
 const Enum SIA_30_360_EOM     = bbldc::DayCountConvention::e_SIA_30_360_EOM;
 const Enum SIA_30_360_NEOM    = bbldc::DayCountConvention::e_SIA_30_360_NEOM;
 
+const Enum CONVENTIONS[] = { ACTUAL_360,
+                             ACTUAL_365_FIXED,
+                             ISDA_30_360_EOM,
+                             ISDA_ACTUAL_ACTUAL,
+                             ISMA_30_360,
+                             NL_365,
+                             PSA_30_360_EOM,
+                             SIA_30_360_EOM,
+                             SIA_30_360_NEOM };
+const int NUM_CONVENTIONS = sizeof CONVENTIONS / sizeof *CONVENTIONS;
+
+// ============================================================================
+//                  GLOBAL HELPER FUNCTIONS FOR TESTING
+// ----------------------------------------------------------------------------
+
+static void generateDates(bsl::vector<bdlt::Date> *beginDates,
+                          bsl::vector<bdlt::Date> *endDates,
+                          int                      numDates)
+    // Load into the specified 'beginDates' and 'endDates' the specified
+    // 'numDates' pseudo-random pairs of dates, between 1990 and 2050, in
+    // either order, including pairs of month-end dates.
+{
+    beginDates->clear();
+    endDates->clear();
+
+    const bdlt::Date BASE(1990, 1, 1);
+
+    unsigned int seed = 1;
+    for (int i = 0; i < numDates; ++i) {
+        seed = seed * 1103515245 + 12345;
+        bdlt::Date beginDate = BASE + static_cast<int>((seed >> 4) % 21900);
+        seed = seed * 1103515245 + 12345;
+        bdlt::Date endDate   = BASE + static_cast<int>((seed >> 4) % 21900);
+
+        if (0 == i % 5) {
+            beginDate.setYearMonthDay(beginDate.year(), beginDate.month(), 1);
+            beginDate -= 1;
+        }
+        if (0 == i % 7) {
+            endDate.setYearMonthDay(endDate.year(), endDate.month(), 1);
+            endDate -= 1;
+        }
+        beginDates->push_back(beginDate);
+        endDates->push_back(endDate);
+    }
+}
+
 //=============================================================================
 //                              MAIN PROGRAM
 //-----------------------------------------------------------------------------
@@ -119,7 +171,7 @@ int main(int argc, char *argv[])
     cout << "TEST " << __FILE__ << " CASE " << test << endl;
 
     switch (test) { case 0:
-      case 4: {
+      case 5: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //   Extracted from component header file.
@@ -174,6 +226,118 @@ int main(int argc, char *argv[])
     ASSERT(0.1999 < yearsDiff && 0.2001 > yearsDiff);
 //..
       } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // TESTING BATCH 'daysDiff' AND 'yearsDiff'
+        //   Verify the methods compute, for each pair of dates, the same
+        //   values as the single-pair methods.
+        //
+        // Concerns:
+        //: 1 Each element of 'result' is the value returned by the single-pair
+        //:   method for the corresponding pair of dates, for every supported
+        //:   convention.
+        //:
+        //: 2 Only the first 'numDates' elements of 'result' are modified.
+        //:
+        //: 3 Empty arrays (including null pointers) are supported.
+        //:
+        //: 4 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 For each supported convention, apply the methods to a set of
+        //:   pseudo-random pairs of dates, and compare each result with the
+        //:   single-pair method, and the element past the last with its
+        //:   initial value.  (C-1..2)
+        //:
+        //: 2 Apply the methods to 0 pairs of dates with null pointers.  (C-3)
+        //:
+        //: 3 Verify defensive checks are triggered for invalid values.  (C-4)
+        //
+        // Testing:
+        //   void daysDiff(result, beginDates, endDates, numDates, conv);
+        //   void yearsDiff(result, beginDates, endDates, numDates, conv);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING BATCH 'daysDiff' AND 'yearsDiff'"
+                          << endl
+                          << "========================================"
+                          << endl;
+
+        enum { k_NUM_DATES = 500 };
+
+        bsl::vector<bdlt::Date> beginDates;
+        bsl::vector<bdlt::Date> endDates;
+        generateDates(&beginDates, &endDates, k_NUM_DATES);
+
+        for (int ci = 0; ci < NUM_CONVENTIONS; ++ci) {
+            const Enum CONVENTION = CONVENTIONS[ci];
+
+            if (veryVerbose) { T_ P(CONVENTION) }
+
+            for (int n = 0; n <= k_NUM_DATES; n += 1 + n / 3) {
+                bsl::vector<int>    days(k_NUM_DATES + 1, -7);
+                bsl::vector<double> years(k_NUM_DATES + 1, -7.0);
+
+                Util::daysDiff(days.data(),
+                               beginDates.data(),
+                               endDates.data(),
+                               n,
+                               CONVENTION);
+                Util::yearsDiff(years.data(),
+                                beginDates.data(),
+                                endDates.data(),
+                                n,
+                                CONVENTION);
+
+                for (int i = 0; i < n; ++i) {
+                    const int    EXP_DAYS  = Util::daysDiff(beginDates[i],
+                                                            endDates[i],
+                                                            CONVENTION);
+                    const double EXP_YEARS = Util::yearsDiff(beginDates[i],
+                                                             endDates[i],
+                                                             CONVENTION);
+
+                    ASSERTV(CONVENTION, n, i, EXP_DAYS  == days[i]);
+                    ASSERTV(CONVENTION, n, i, EXP_YEARS == years[i]);
+                }
+                ASSERTV(CONVENTION, n, -7   == days[n]);
+                ASSERTV(CONVENTION, n, -7.0 == years[n]);
+            }
+
+            Util::daysDiff(0, 0, 0, 0, CONVENTION);
+            Util::yearsDiff(0, 0, 0, 0, CONVENTION);
+        }
+
+        if (verbose) cout << "\nNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            int              days;
+            double           years;
+            const bdlt::Date DATE(2000, 1, 1);
+
+            ASSERT_PASS(Util::daysDiff(&days, &DATE, &DATE, 1, ACTUAL_360));
+            ASSERT_FAIL(Util::daysDiff(    0, &DATE, &DATE, 1, ACTUAL_360));
+            ASSERT_FAIL(Util::daysDiff(&days,     0, &DATE, 1, ACTUAL_360));
+            ASSERT_FAIL(Util::daysDiff(&days, &DATE,     0, 1, ACTUAL_360));
+            ASSERT_OPT_FAIL(Util::daysDiff(&days,
+                                           &DATE,
+                                           &DATE,
+                                           1,
+                                           INVALID_CONVENTION));
+
+            ASSERT_PASS(Util::yearsDiff(&years, &DATE, &DATE, 1, NL_365));
+            ASSERT_FAIL(Util::yearsDiff(     0, &DATE, &DATE, 1, NL_365));
+            ASSERT_FAIL(Util::yearsDiff(&years,     0, &DATE, 1, NL_365));
+            ASSERT_FAIL(Util::yearsDiff(&years, &DATE,     0, 1, NL_365));
+            ASSERT_OPT_FAIL(Util::yearsDiff(&years,
+                                            &DATE,
+                                            &DATE,
+                                            1,
+                                            INVALID_CONVENTION));
+        }
+      } break;
       case 3: {
         // --------------------------------------------------------------------
         // TESTING 'yearsDiff'
@@ -542,6 +706,90 @@ int main(int argc, char *argv[])
                    == Util::isSupported(convention));
         }
       } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE: BATCH VS. SINGLE-PAIR METHODS
+        //
+        // Concerns:
+        //: 1 The batch methods are faster than calling the single-pair
+        //:   methods for each pair of dates.
+        //
+        // Plan:
+        //: 1 For each supported convention, time computing the day counts and
+        //:   year fractions of a large set of pairs of dates using both the
+        //:   batch and the single-pair methods.  Optionally specify the number
+        //:   of pairs as the second argument.  (C-1)
+        //
+        // Testing:
+        //   PERFORMANCE: BATCH VS. SINGLE-PAIR METHODS
+        // --------------------------------------------------------------------
+
+        cout << endl
+             << "PERFORMANCE: BATCH VS. SINGLE-PAIR METHODS" << endl
+             << "==========================================" << endl;
+
+        const int NUM_DATES = argc > 2 && atoi(argv[2]) > 0
+                            ? atoi(argv[2])
+                            : 1000000;
+
+        bsl::vector<bdlt::Date> beginDates;
+        bsl::vector<bdlt::Date> endDates;
+        generateDates(&beginDates, &endDates, NUM_DATES);
+
+        bsl::vector<int>    days(NUM_DATES);
+        bsl::vector<double> years(NUM_DATES);
+
+        for (int ci = 0; ci < NUM_CONVENTIONS; ++ci) {
+            const Enum CONVENTION = CONVENTIONS[ci];
+
+            bsls::Stopwatch timer;
+
+            timer.start();
+            for (int i = 0; i < NUM_DATES; ++i) {
+                days[i] = Util::daysDiff(beginDates[i],
+                                         endDates[i],
+                                         CONVENTION);
+            }
+            timer.stop();
+            const double singleDaysTime = timer.elapsedTime();
+
+            timer.reset();
+            timer.start();
+            Util::daysDiff(days.data(),
+                           beginDates.data(),
+                           endDates.data(),
+                           NUM_DATES,
+                           CONVENTION);
+            timer.stop();
+            const double batchDaysTime = timer.elapsedTime();
+
+            timer.reset();
+            timer.start();
+            for (int i = 0; i < NUM_DATES; ++i) {
+                years[i] = Util::yearsDiff(beginDates[i],
+                                           endDates[i],
+                                           CONVENTION);
+            }
+            timer.stop();
+            const double singleYearsTime = timer.elapsedTime();
+
+            timer.reset();
+            timer.start();
+            Util::yearsDiff(years.data(),
+                            beginDates.data(),
+                            endDates.data(),
+                            NUM_DATES,
+                            CONVENTION);
+            timer.stop();
+            const double batchYearsTime = timer.elapsedTime();
+
+            cout << bbldc::DayCountConvention::toAscii(CONVENTION) << endl
+                 << "\t'daysDiff'  single: " << singleDaysTime
+                 << "\tbatch: "              << batchDaysTime  << endl
+                 << "\t'yearsDiff' single: " << singleYearsTime
+                 << "\tbatch: "              << batchYearsTime << endl;
+        }
+      } break;
       default: {
         cerr << "WARNING: CASE `" << test << "' NOT == FOUND." << endl;
         testStatus = -1;
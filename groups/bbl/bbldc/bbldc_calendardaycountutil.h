@@ -20,6 +20,10 @@ BSLS_IDENT("$Id: $")
 // 'bbldc::CalendarDayCountUtil' take a trailing 'DayCountConvention::Enum'
 // argument indicating which particular day-count convention to apply.
 //
+// Overloads of 'daysDiff' and 'yearsDiff' taking arrays of begin and end dates
+// compute the results for many pairs of dates with the same calendar and
+// convention at once, dispatching on the convention only once.
+//
 ///Usage
 ///-----
 // This section illustrates intended use of this component.
@@ -67,6 +71,8 @@ BSLS_IDENT("$Id: $")
 
 #include <bbldc_daycountconvention.h>
 
+#include <bsl_cstddef.h>
+
 namespace BloombergLP {
 namespace bdlt { class Calendar; }
 namespace bdlt { class Date; }
@@ -95,6 +101,25 @@ struct CalendarDayCountUtil {
         // Note that reversing the order of 'beginDate' and 'endDate' negates
         // the result and that the result is 0 when 'beginDate == endDate'.
 
+    static void daysDiff(int                      *result,
+                         const bdlt::Date         *beginDates,
+                         const bdlt::Date         *endDates,
+                         bsl::size_t               numDates,
+                         const bdlt::Calendar&     calendar,
+                         DayCountConvention::Enum  convention);
+        // Load into each of the specified 'numDates' elements of the specified
+        // 'result' array the (signed) number of days between the
+        // corresponding elements of the specified 'beginDates' and 'endDates'
+        // arrays according to the specified day-count 'convention' with the
+        // specified 'calendar' providing the definition of business days
+        // (i.e.,
+        // 'result[i] = daysDiff(beginDates[i], endDates[i], calendar, c)').
+        // The behavior is undefined unless 'isSupported(convention)',
+        // 'result', 'beginDates', and 'endDates' each refer to an array of at
+        // least 'numDates' elements, and each of the first 'numDates' elements
+        // of 'beginDates' and 'endDates' is within the valid range of
+        // 'calendar'.
+
     static bool isSupported(DayCountConvention::Enum convention);
         // Return 'true' if the specified 'convention' is valid for use in
         // 'daysDiff' and 'yearsDiff', and 'false' otherwise.
@@ -114,6 +139,25 @@ struct CalendarDayCountUtil {
         // '|yearsDiff(b, e, cal, c) + yearsDiff(e, b, cal, c)| <= 1.0e-15' for
         // all calendars 'cal', valid dates 'b' and 'e', and day-count
         // conventions 'c'.
+
+    static void yearsDiff(double                   *result,
+                          const bdlt::Date         *beginDates,
+                          const bdlt::Date         *endDates,
+                          bsl::size_t               numDates,
+                          const bdlt::Calendar&     calendar,
+                          DayCountConvention::Enum  convention);
+        // Load into each of the specified 'numDates' elements of the specified
+        // 'result' array the (signed fractional) number of years between the
+        // corresponding elements of the specified 'beginDates' and 'endDates'
+        // arrays according to the specified day-count 'convention' with the
+        // specified 'calendar' providing the definition of business days
+        // (i.e.,
+        // 'result[i] = yearsDiff(beginDates[i], endDates[i], calendar, c)').
+        // The behavior is undefined unless 'isSupported(convention)',
+        // 'result', 'beginDates', and 'endDates' each refer to an array of at
+        // least 'numDates' elements, and each of the first 'numDates' elements
+        // of 'beginDates' and 'endDates' is within the valid range of
+        // 'calendar'.
 };
 
 }  // close package namespace
@@ -12,6 +12,7 @@
 
 #include <bsl_cstdlib.h>     // 'atoi'
 #include <bsl_iostream.h>
+#include <bsl_vector.h>
 
 using namespace BloombergLP;
 using namespace bsl;
@@ -27,10 +28,12 @@ using namespace bsl;
 // functionality of these methods.
 // ----------------------------------------------------------------------------
 // [ 2] int daysDiff(beginDate, endDate, calendar, convention);
+// [ 4] void daysDiff(result, begins, ends, numDates, calendar, conv);
 // [ 1] bool isSupported(convention);
 // [ 3] double yearsDiff(beginDate, endDate, calendar, convention);
+// [ 4] void yearsDiff(result, begins, ends, numDates, calendar, conv);
 // ----------------------------------------------------------------------------
-// [ 4] USAGE EXAMPLE
+// [ 5] USAGE EXAMPLE
 // ----------------------------------------------------------------------------
 
 // ============================================================================
@@ -124,7 +127,7 @@ int main(int argc, char *argv[])
     }
 
     switch (test) { case 0:
-      case 4: {
+      case 5: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //   Extracted from component header file.
@@ -189,6 +192,116 @@ int main(int argc, char *argv[])
     ASSERT(0.2063 < yearsDiff && 0.2064 > yearsDiff);
 //..
       } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // TESTING BATCH 'daysDiff' AND 'yearsDiff'
+        //   Verify the methods compute, for each pair of dates, the same
+        //   values as the single-pair methods.
+        //
+        // Concerns:
+        //: 1 Each element of 'result' is the value returned by the single-pair
+        //:   method for the corresponding pair of dates.
+        //:
+        //: 2 Only the first 'numDates' elements of 'result' are modified.
+        //:
+        //: 3 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 For calendars CA and CB, apply the methods to every pair of dates
+        //:   in the valid range, and compare each result with the single-pair
+        //:   method, and the element past the last with its initial value.
+        //:   (C-1..2)
+        //:
+        //: 2 Verify defensive checks are triggered for invalid values.  (C-3)
+        //
+        // Testing:
+        //   void daysDiff(result, begins, ends, numDates, calendar, conv);
+        //   void yearsDiff(result, begins, ends, numDates, calendar, conv);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING BATCH 'daysDiff' AND 'yearsDiff'"
+                          << endl
+                          << "========================================"
+                          << endl;
+
+        const bdlt::Calendar *CALENDARS[] = { &CA, &CB };
+
+        for (int ci = 0; ci < 2; ++ci) {
+            const bdlt::Calendar& CAL = *CALENDARS[ci];
+
+            bsl::vector<bdlt::Date> beginDates;
+            bsl::vector<bdlt::Date> endDates;
+            for (bdlt::Date d1 = CAL.firstDate(); d1 <= CAL.lastDate(); ++d1) {
+                for (bdlt::Date d2 = CAL.firstDate();
+                     d2 <= CAL.lastDate();
+                     ++d2) {
+                    beginDates.push_back(d1);
+                    endDates.push_back(d2);
+                }
+            }
+            const int NUM_DATES = static_cast<int>(beginDates.size());
+
+            bsl::vector<int>    days(NUM_DATES + 1, -7);
+            bsl::vector<double> years(NUM_DATES + 1, -7.0);
+
+            Util::daysDiff(days.data(),
+                           beginDates.data(),
+                           endDates.data(),
+                           NUM_DATES,
+                           CAL,
+                           CALENDAR_BUS_252);
+            Util::yearsDiff(years.data(),
+                            beginDates.data(),
+                            endDates.data(),
+                            NUM_DATES,
+                            CAL,
+                            CALENDAR_BUS_252);
+
+            for (int i = 0; i < NUM_DATES; ++i) {
+                ASSERTV(ci, i, Util::daysDiff(beginDates[i],
+                                              endDates[i],
+                                              CAL,
+                                              CALENDAR_BUS_252) == days[i]);
+                ASSERTV(ci, i, Util::yearsDiff(beginDates[i],
+                                               endDates[i],
+                                               CAL,
+                                               CALENDAR_BUS_252) == years[i]);
+            }
+            ASSERTV(ci, -7   == days[NUM_DATES]);
+            ASSERTV(ci, -7.0 == years[NUM_DATES]);
+        }
+
+        if (verbose) cout << "\nNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            int              days;
+            double           years;
+            const bdlt::Date DATE(2015, 6, 5);
+            const bdlt::Date BAD(2015, 7, 1);
+
+            ASSERT_PASS(Util::daysDiff(&days, &DATE, &DATE, 1, CA,
+                                       CALENDAR_BUS_252));
+            ASSERT_PASS(Util::daysDiff(0, 0, 0, 0, CA, CALENDAR_BUS_252));
+            ASSERT_FAIL(Util::daysDiff(0, &DATE, &DATE, 1, CA,
+                                       CALENDAR_BUS_252));
+            ASSERT_FAIL(Util::daysDiff(&days, &BAD, &DATE, 1, CA,
+                                       CALENDAR_BUS_252));
+            ASSERT_FAIL(Util::daysDiff(&days, &DATE, &BAD, 1, CA,
+                                       CALENDAR_BUS_252));
+
+            ASSERT_PASS(Util::yearsDiff(&years, &DATE, &DATE, 1, CA,
+                                        CALENDAR_BUS_252));
+            ASSERT_PASS(Util::yearsDiff(0, 0, 0, 0, CA, CALENDAR_BUS_252));
+            ASSERT_FAIL(Util::yearsDiff(0, &DATE, &DATE, 1, CA,
+                                        CALENDAR_BUS_252));
+            ASSERT_FAIL(Util::yearsDiff(&years, &BAD, &DATE, 1, CA,
+                                        CALENDAR_BUS_252));
+            ASSERT_FAIL(Util::yearsDiff(&years, &DATE, &BAD, 1, CA,
+                                        CALENDAR_BUS_252));
+        }
+      } break;
       case 3: {
         // --------------------------------------------------------------------
         // TESTING 'yearsDiff'
@@ -62,6 +62,32 @@ int PeriodDayCountUtil::daysDiff(const bdlt::Date&        beginDate,
     return numDays;
 }
 
+void PeriodDayCountUtil::daysDiff(int                      *result,
+                                  const bdlt::Date         *beginDates,
+                                  const bdlt::Date         *endDates,
+                                  bsl::size_t               numDates,
+                                  DayCountConvention::Enum  convention)
+{
+    BSLS_ASSERT(result     || 0 == numDates);
+    BSLS_ASSERT(beginDates || 0 == numDates);
+    BSLS_ASSERT(endDates   || 0 == numDates);
+
+    switch (convention) {
+      case DayCountConvention::e_PERIOD_ICMA_ACTUAL_ACTUAL: {
+        for (bsl::size_t i = 0; i < numDates; ++i) {
+            result[i] = bbldc::PeriodIcmaActualActual::daysDiff(beginDates[i],
+                                                                endDates[i]);
+        }
+      } break;
+      default: {
+        BSLS_ASSERT_OPT(0 && "Unrecognized convention");
+        for (bsl::size_t i = 0; i < numDates; ++i) {
+            result[i] = 0;
+        }
+      } break;
+    }
+}
+
 bool PeriodDayCountUtil::isSupported(DayCountConvention::Enum convention)
 {
     bool rv = true;
@@ -110,6 +136,41 @@ double PeriodDayCountUtil::yearsDiff(
     return numYears;
 }
 
+void PeriodDayCountUtil::yearsDiff(
+                                double                         *result,
+                                const bdlt::Date               *beginDates,
+                                const bdlt::Date               *endDates,
+                                bsl::size_t                     numDates,
+                                const bsl::vector<bdlt::Date>&  periodDate,
+                                double                          periodYearDiff,
+                                DayCountConvention::Enum        convention)
+{
+    BSLS_ASSERT(result     || 0 == numDates);
+    BSLS_ASSERT(beginDates || 0 == numDates);
+    BSLS_ASSERT(endDates   || 0 == numDates);
+    BSLS_ASSERT(periodDate.size() >= 2);
+
+    BSLS_ASSERT_SAFE(isSortedAndUnique(periodDate.begin(), periodDate.end()));
+
+    switch (convention) {
+      case DayCountConvention::e_PERIOD_ICMA_ACTUAL_ACTUAL: {
+        for (bsl::size_t i = 0; i < numDates; ++i) {
+            result[i] = bbldc::PeriodIcmaActualActual::yearsDiff(
+                                                               beginDates[i],
+                                                               endDates[i],
+                                                               periodDate,
+                                                               periodYearDiff);
+        }
+      } break;
+      default: {
+        BSLS_ASSERT_OPT(0 && "Unrecognized convention");
+        for (bsl::size_t i = 0; i < numDates; ++i) {
+            result[i] = 0.0;
+        }
+      } break;
+    }
+}
+
 }  // close package namespace
 }  // close enterprise namespace
 
@@ -20,6 +20,10 @@ BSLS_IDENT("$Id: $")
 // take a trailing 'DayCountConvention::Enum' argument indicating which
 // particular period-based day-count convention to apply.
 //
+// Overloads of 'daysDiff' and 'yearsDiff' taking arrays of begin and end dates
+// compute the results for many pairs of dates with the same periods and
+// convention at once, dispatching on the convention only once.
+//
 ///Usage
 ///-----
 // This section illustrates intended use of this component.
@@ -66,6 +70,7 @@ BSLS_IDENT("$Id: $")
 
 #include <bbldc_daycountconvention.h>
 
+#include <bsl_cstddef.h>
 #include <bsl_vector.h>
 
 namespace BloombergLP {
@@ -91,6 +96,20 @@ struct PeriodDayCountUtil {
         // behavior is undefined unless 'isSupported(convention)'.  Note that
         // reversing the order of 'beginDate' and 'endDate' negates the result.
 
+    static void daysDiff(int                      *result,
+                         const bdlt::Date         *beginDates,
+                         const bdlt::Date         *endDates,
+                         bsl::size_t               numDates,
+                         DayCountConvention::Enum  convention);
+        // Load into each of the specified 'numDates' elements of the specified
+        // 'result' array the (signed) number of days between the
+        // corresponding elements of the specified 'beginDates' and 'endDates'
+        // arrays according to the specified day-count 'convention' (i.e.,
+        // 'result[i] = daysDiff(beginDates[i], endDates[i], convention)').
+        // The behavior is undefined unless 'isSupported(convention)', and
+        // 'result', 'beginDates', and 'endDates' each refer to an array of at
+        // least 'numDates' elements.
+
     static bool isSupported(DayCountConvention::Enum convention);
         // Return 'true' if the specified 'convention' is valid for use in
         // 'daysDiff' and 'yearsDiff', and 'false' otherwise.
@@ -115,6 +134,26 @@ struct PeriodDayCountUtil {
         // '|yearsDiff(b,e,pd,pyd,c) + yearsDiff(e,b,pd,pyd,c)| <= 1.0e-15' for
         // all dates 'b' and 'e', periods 'pd', and year fraction per period
         // 'pyd'.
+
+    static void yearsDiff(double                         *result,
+                          const bdlt::Date               *beginDates,
+                          const bdlt::Date               *endDates,
+                          bsl::size_t                     numDates,
+                          const bsl::vector<bdlt::Date>&  periodDate,
+                          double                          periodYearDiff,
+                          DayCountConvention::Enum        convention);
+        // Load into each of the specified 'numDates' elements of the specified
+        // 'result' array the (signed fractional) number of years between the
+        // corresponding elements of the specified 'beginDates' and 'endDates'
+        // arrays according to the specified day-count 'convention' with
+        // periods starting on the specified 'periodDate' values and each
+        // period having a duration of the specified 'periodYearDiff' years
+        // (i.e., 'result[i] = yearsDiff(beginDates[i], endDates[i],
+        // periodDate, periodYearDiff, convention)').  The behavior is
+        // undefined unless 'result', 'beginDates', and 'endDates' each refer
+        // to an array of at least 'numDates' elements, and each pair of
+        // corresponding dates satisfies the preconditions of the
+        // single-pair 'yearsDiff'.
 };
 
 }  // close package namespace
@@ -26,10 +26,12 @@ using namespace bsl;
 // functionality of these methods.
 // ----------------------------------------------------------------------------
 // [ 2] int daysDiff(beginDate, endDate, convention);
+// [ 4] void daysDiff(result, begins, ends, numDates, convention);
 // [ 1] bool isSupported(convention);
 // [ 3] double yearsDiff(begin, end, periodDate, periodYearDiff, conv);
+// [ 4] void yearsDiff(result, b, e, n, periodDate, periodYearDiff, conv);
 // ----------------------------------------------------------------------------
-// [ 4] USAGE EXAMPLE
+// [ 5] USAGE EXAMPLE
 // ----------------------------------------------------------------------------
 
 // ============================================================================
@@ -110,7 +112,7 @@ int main(int argc, char *argv[])
     cout << "TEST " << __FILE__ << " CASE " << test << endl;
 
     switch (test) { case 0:
-      case 4: {
+      case 5: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //   Extracted from component header file.
@@ -174,6 +176,122 @@ int main(int argc, char *argv[])
     ASSERT(yearsDiff > 0.1983 && yearsDiff < 0.1985);
 //..
       } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // TESTING BATCH 'daysDiff' AND 'yearsDiff'
+        //   Verify the methods compute, for each pair of dates, the same
+        //   values as the single-pair methods.
+        //
+        // Concerns:
+        //: 1 Each element of 'result' is the value returned by the single-pair
+        //:   method for the corresponding pair of dates.
+        //:
+        //: 2 Only the first 'numDates' elements of 'result' are modified.
+        //:
+        //: 3 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 Using a yearly schedule, apply the methods to a set of pairs of
+        //:   dates spanning the schedule, and compare each result with the
+        //:   single-pair method, and the element past the last with its
+        //:   initial value.  (C-1..2)
+        //:
+        //: 2 Verify defensive checks are triggered for invalid values.  (C-3)
+        //
+        // Testing:
+        //   void daysDiff(result, begins, ends, numDates, convention);
+        //   void yearsDiff(result, b, e, n, periodDate, periodYearDiff, conv);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING BATCH 'daysDiff' AND 'yearsDiff'"
+                          << endl
+                          << "========================================"
+                          << endl;
+
+        bsl::vector<bdlt::Date>        mSchedule;
+        const bsl::vector<bdlt::Date>& SCHEDULE = mSchedule;
+        for (int year = 1990; year <= 2006; ++year) {
+            mSchedule.push_back(bdlt::Date(year, 1, 1));
+        }
+
+        bsl::vector<bdlt::Date> beginDates;
+        bsl::vector<bdlt::Date> endDates;
+        for (bdlt::Date d1 = SCHEDULE.front();
+             d1 <= SCHEDULE.back();
+             d1 += 97) {
+            for (bdlt::Date d2 = SCHEDULE.front();
+                 d2 <= SCHEDULE.back();
+                 d2 += 89) {
+                beginDates.push_back(d1);
+                endDates.push_back(d2);
+            }
+        }
+        const int NUM_DATES = static_cast<int>(beginDates.size());
+
+        bsl::vector<int>    days(NUM_DATES + 1, -7);
+        bsl::vector<double> years(NUM_DATES + 1, -7.0);
+
+        Util::daysDiff(days.data(),
+                       beginDates.data(),
+                       endDates.data(),
+                       NUM_DATES,
+                       PERIOD_ICMA_ACTUAL_ACTUAL);
+        Util::yearsDiff(years.data(),
+                        beginDates.data(),
+                        endDates.data(),
+                        NUM_DATES,
+                        SCHEDULE,
+                        1.0,
+                        PERIOD_ICMA_ACTUAL_ACTUAL);
+
+        for (int i = 0; i < NUM_DATES; ++i) {
+            ASSERTV(i, Util::daysDiff(beginDates[i],
+                                      endDates[i],
+                                      PERIOD_ICMA_ACTUAL_ACTUAL) == days[i]);
+            ASSERTV(i, Util::yearsDiff(beginDates[i],
+                                       endDates[i],
+                                       SCHEDULE,
+                                       1.0,
+                                       PERIOD_ICMA_ACTUAL_ACTUAL)
+                                                                 == years[i]);
+        }
+        ASSERT(-7   == days[NUM_DATES]);
+        ASSERT(-7.0 == years[NUM_DATES]);
+
+        if (verbose) cout << "\nNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            int              days;
+            double           years;
+            const bdlt::Date DATE(1995, 6, 5);
+
+            bsl::vector<bdlt::Date> mShort(1, DATE);
+
+            ASSERT_PASS(Util::daysDiff(&days, &DATE, &DATE, 1,
+                                       PERIOD_ICMA_ACTUAL_ACTUAL));
+            ASSERT_PASS(Util::daysDiff(0, 0, 0, 0,
+                                       PERIOD_ICMA_ACTUAL_ACTUAL));
+            ASSERT_FAIL(Util::daysDiff(0, &DATE, &DATE, 1,
+                                       PERIOD_ICMA_ACTUAL_ACTUAL));
+            ASSERT_FAIL(Util::daysDiff(&days, 0, &DATE, 1,
+                                       PERIOD_ICMA_ACTUAL_ACTUAL));
+            ASSERT_FAIL(Util::daysDiff(&days, &DATE, 0, 1,
+                                       PERIOD_ICMA_ACTUAL_ACTUAL));
+
+            ASSERT_PASS(Util::yearsDiff(&years, &DATE, &DATE, 1, SCHEDULE,
+                                        1.0, PERIOD_ICMA_ACTUAL_ACTUAL));
+            ASSERT_PASS(Util::yearsDiff(0, 0, 0, 0, SCHEDULE,
+                                        1.0, PERIOD_ICMA_ACTUAL_ACTUAL));
+            ASSERT_FAIL(Util::yearsDiff(0, &DATE, &DATE, 1, SCHEDULE,
+                                        1.0, PERIOD_ICMA_ACTUAL_ACTUAL));
+            ASSERT_FAIL(Util::yearsDiff(&years, 0, &DATE, 1, SCHEDULE,
+                                        1.0, PERIOD_ICMA_ACTUAL_ACTUAL));
+            ASSERT_FAIL(Util::yearsDiff(&years, &DATE, &DATE, 1, mShort,
+                                        1.0, PERIOD_ICMA_ACTUAL_ACTUAL));
+        }
+      } break;
       case 3: {
         // --------------------------------------------------------------------
         // TESTING 'yearsDiff'
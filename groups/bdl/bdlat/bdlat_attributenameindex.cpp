@@ -0,0 +1,234 @@
+// bdlat_attributenameindex.cpp                                       -*-C++-*-
+#include <bdlat_attributenameindex.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(bdlat_attributenameindex_cpp, "$Id$ $CSID$")
+
+#include <bsl_algorithm.h>
+#include <bsl_utility.h>
+
+namespace BloombergLP {
+
+namespace {
+
+enum {
+    k_MAX_DISPLACEMENTS = 1 << 16  // displacements tried for each bucket
+                                   // before its attributes overflow
+};
+
+}  // close unnamed namespace
+
+                       // ------------------------------
+                       // class bdlat_AttributeNameIndex
+                       // ------------------------------
+
+// PRIVATE MANIPULATORS
+void bdlat_AttributeNameIndex::build(const bdlat_AttributeInfo *attributes,
+                                     int                        numAttributes)
+{
+    BSLS_ASSERT(d_attributes.empty());
+
+    bslma::Allocator *allocator = d_attributes.get_allocator().mechanism();
+
+    // Select the attributes having distinct names, and copy their names and
+    // annotations.
+
+    bsl::vector<bsls::Types::Uint64> hashes(allocator);
+    bsl::vector<int>                 selected(allocator);
+    bsl::size_t                      stringsLength = 0;
+
+    for (int i = 0; i < numAttributes; ++i) {
+        const bdlat_AttributeInfo& info = attributes[i];
+        const bsls::Types::Uint64  h    = hash(info.d_name_p,
+                                               info.d_nameLength);
+
+        bool isDuplicate = false;
+        for (bsl::size_t j = 0; j < selected.size(); ++j) {
+            const bdlat_AttributeInfo& other = attributes[selected[j]];
+
+            if (h == hashes[j]
+             && info.d_nameLength == other.d_nameLength
+             && 0 == bsl::memcmp(info.d_name_p,
+                                 other.d_name_p,
+                                 info.d_nameLength)) {
+                isDuplicate = true;
+                break;
+            }
+        }
+        if (isDuplicate) {
+            continue;
+        }
+
+        hashes.push_back(h);
+        selected.push_back(i);
+
+        stringsLength += info.d_nameLength + 1;
+        if (info.d_annotation_p) {
+            stringsLength += bsl::strlen(info.d_annotation_p) + 1;
+        }
+    }
+
+    const bsl::size_t n = selected.size();
+
+    d_attributes.reserve(n);
+    d_strings.resize(stringsLength);
+
+    char *strings = d_strings.data();
+
+    for (bsl::size_t i = 0; i < n; ++i) {
+        bdlat_AttributeInfo info = attributes[selected[i]];
+
+        bsl::memcpy(strings, info.d_name_p, info.d_nameLength);
+        strings[info.d_nameLength] = '\0';
+        info.d_name_p  = strings;
+        strings       += info.d_nameLength + 1;
+
+        if (info.d_annotation_p) {
+            const bsl::size_t length = bsl::strlen(info.d_annotation_p) + 1;
+
+            bsl::memcpy(strings, info.d_annotation_p, length);
+            info.d_annotation_p  = strings;
+            strings             += length;
+        }
+
+        d_attributes.push_back(info);
+    }
+
+    if (0 == n) {
+        return;                                                       // RETURN
+    }
+
+    // Size the table to have at least twice as many slots as attributes, and
+    // as many buckets as attributes.
+
+    bsl::size_t numSlots = 1;
+    while (numSlots < 2 * n) {
+        numSlots *= 2;
+    }
+
+    const bsl::size_t slotMask = numSlots - 1;
+
+    Slot emptySlot;
+    emptySlot.d_hash  = 0;
+    emptySlot.d_index = -1;
+
+    d_slots.assign(numSlots, emptySlot);
+    d_displacements.assign(n, 0);
+
+    // Order the attributes by decreasing size of their bucket (and by bucket
+    // within a size), so that the largest buckets, which are the hardest to
+    // place, are placed first.
+
+    bsl::vector<int> buckets(allocator);
+    bsl::vector<int> bucketSizes(n, 0, allocator);
+
+    buckets.reserve(n);
+    for (bsl::size_t i = 0; i < n; ++i) {
+        const int bucket = static_cast<int>((hashes[i] >> 32) % n);
+
+        buckets.push_back(bucket);
+        ++bucketSizes[bucket];
+    }
+
+    bsl::vector<bsl::pair<bsl::pair<int, int>, int> > keys(allocator);
+                                      // ((-bucket size, bucket), attribute)
+    keys.reserve(n);
+
+    for (bsl::size_t i = 0; i < n; ++i) {
+        const int bucket = buckets[i];
+
+        keys.push_back(bsl::make_pair(
+                              bsl::make_pair(-bucketSizes[bucket], bucket),
+                              static_cast<int>(i)));
+    }
+
+    bsl::sort(keys.begin(), keys.end());
+
+    // Place the attributes of each bucket.
+
+    bsl::vector<bsl::size_t> trial(allocator);
+
+    for (bsl::size_t first = 0; first < n; ) {
+        const int   bucket = keys[first].first.second;
+        bsl::size_t last   = first;
+
+        while (last < n && keys[last].first.second == bucket) {
+            ++last;
+        }
+
+        bool placed = false;
+
+        for (unsigned int d = 0; !placed && d < k_MAX_DISPLACEMENTS; ++d) {
+            trial.clear();
+
+            placed = true;
+            for (bsl::size_t k = first; k < last; ++k) {
+                const bsl::size_t slot = slotOf(hashes[keys[k].second],
+                                                d,
+                                                slotMask);
+
+                if (0 <= d_slots[slot].d_index
+                 || trial.end() != bsl::find(trial.begin(),
+                                             trial.end(),
+                                             slot)) {
+                    placed = false;
+                    break;
+                }
+                trial.push_back(slot);
+            }
+
+            if (placed) {
+                d_displacements[bucket] = d;
+
+                for (bsl::size_t k = first; k < last; ++k) {
+                    Slot& slot   = d_slots[trial[k - first]];
+                    slot.d_hash  = hashes[keys[k].second];
+                    slot.d_index = keys[k].second;
+                }
+            }
+        }
+
+        if (!placed) {
+            for (bsl::size_t k = first; k < last; ++k) {
+                d_overflow.push_back(keys[k].second);
+            }
+        }
+
+        first = last;
+    }
+}
+
+// CREATORS
+bdlat_AttributeNameIndex::bdlat_AttributeNameIndex(
+                                 const bdlat_AttributeInfo *attributes,
+                                 int                        numAttributes,
+                                 bslma::Allocator          *basicAllocator)
+: d_attributes(basicAllocator)
+, d_strings(basicAllocator)
+, d_slots(basicAllocator)
+, d_displacements(basicAllocator)
+, d_overflow(basicAllocator)
+{
+    BSLS_ASSERT(0 <= numAttributes);
+    BSLS_ASSERT(attributes || 0 == numAttributes);
+
+    build(attributes, numAttributes);
+}
+
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
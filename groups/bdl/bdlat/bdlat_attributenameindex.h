@@ -0,0 +1,532 @@
+// bdlat_attributenameindex.h                                         -*-C++-*-
+#ifndef INCLUDED_BDLAT_ATTRIBUTENAMEINDEX
+#define INCLUDED_BDLAT_ATTRIBUTENAMEINDEX
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide a perfect-hash index from attribute names to attributes.
+//
+//@CLASSES:
+//  bdlat_AttributeNameIndex: perfect-hash index of sequence attribute names
+//
+//@SEE_ALSO: bdlat_sequencefunctions, bdlat_attributeinfo
+//
+//@DESCRIPTION: This component provides a class, 'bdlat_AttributeNameIndex',
+// that maps the names of the attributes of a "sequence" type to their
+// 'bdlat_AttributeInfo' in constant time, using a perfect hash table built
+// once from the attributes of the type.  Decoders of text formats (e.g.,
+// 'baljsn::Decoder' and 'balxml::Decoder') find each attribute of a sequence
+// by the name that appears in the input.  The 'lookupAttributeInfo' function
+// generated for a sequence type compares that name with the name of each
+// attribute in turn, so that decoding a type having hundreds of attributes
+// performs hundreds of comparisons per attribute decoded.  A lookup in a
+// 'bdlat_AttributeNameIndex' hashes the name once, and compares it with the
+// name of at most one attribute.
+//
+///Perfect Hashing
+///---------------
+// The index uses the "hash and displace" scheme: the hash of a name selects a
+// bucket, and the displacement stored for that bucket, combined with the same
+// hash, selects the slot of the attribute having that name.  When the index
+// is built, the displacement of each bucket is chosen so that the attributes
+// in the bucket are assigned to distinct free slots, which guarantees that
+// every attribute has its own slot.  The table has twice as many slots as
+// there are attributes, so suitable displacements are found after very few
+// attempts.  (Should no displacement be found for a bucket, which requires
+// two names of the bucket to have the same 64-bit hash, the attributes of the
+// bucket are kept in a list that is searched linearly when a lookup misses.)
+//
+///Per-Type Indexes
+///----------------
+// The 'indexForType' class method returns an index of the attributes of a
+// sequence type, that is built (in a thread-safe manner) from the attributes
+// visited by 'bdlat_SequenceFunctions::accessAttributes' the first time it is
+// called for that type, and is never destroyed.  The 'hasAttribute' and
+// 'manipulateAttribute' class methods are drop-in replacements for the
+// 'bdlat_SequenceFunctions' functions having the same names that look up
+// attribute names in that index.
+//
+// The index is used only for generated sequence types (i.e., types for which
+// 'bdlat_IsGeneratedSequence' is 'true'), for which manipulating an attribute
+// by name is, by construction, the same as manipulating the attribute having
+// the id found by name.  Other types may customize the manipulation of
+// attributes by name, and may have different attributes for each object (as
+// "dynamic" types do), so their names are always passed to
+// 'bdlat_SequenceFunctions'.
+//
+// Note that a sequence type may recognize names other than the names of its
+// attributes: for example, a sequence generated from a schema having an
+// anonymous choice also recognizes the names of the selections of that choice
+// as the name of the attribute holding the choice.  Names that are not found
+// in the index are therefore passed to 'bdlat_SequenceFunctions', so that
+// these class methods have the same behavior as the functions they replace.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Finding Attributes by Name
+///- - - - - - - - - - - - - - - - - - -
+// Suppose we are writing a decoder for a text format in which the attributes
+// of a sequence are identified by their names.
+//
+// First, we define the attributes of our sequence type, as a type generated
+// from a schema would:
+//..
+//  const bdlat_AttributeInfo ATTRIBUTES[] = {
+//      { 1, "price",    5, "", 0 },
+//      { 2, "quantity", 8, "", 0 },
+//      { 3, "symbol",   6, "", 0 }
+//  };
+//..
+// Then, we build an index of those attributes:
+//..
+//  bdlat_AttributeNameIndex index(ATTRIBUTES, 3);
+//  assert(3 == index.numAttributes());
+//..
+// Now, we look up a name that we read from the input:
+//..
+//  const bdlat_AttributeInfo *info = index.lookupAttributeInfo("quantity",
+//                                                              8);
+//  assert(0 != info);
+//  assert(2 == info->id());
+//..
+// Finally, we observe that an unknown name is not found:
+//..
+//  assert(0 == index.lookupAttributeInfo("volume", 6));
+//..
+// A decoder would typically not build an index itself, and would instead
+// call 'bdlat_AttributeNameIndex::manipulateAttribute' in place of
+// 'bdlat_SequenceFunctions::manipulateAttribute', which looks up the name in
+// the index for the type of the sequence being decoded.
+
+#include <bdlscm_version.h>
+
+#include <bdlat_attributeinfo.h>
+#include <bdlat_sequencefunctions.h>
+#include <bdlat_typetraits.h>
+
+#include <bslma_allocator.h>
+#include <bslma_default.h>
+
+#include <bslmf_integralconstant.h>
+
+#include <bslmt_once.h>
+
+#include <bsls_assert.h>
+#include <bsls_objectbuffer.h>
+#include <bsls_types.h>
+
+#include <bsl_cstring.h>
+#include <bsl_vector.h>
+
+namespace BloombergLP {
+
+                       // ==============================
+                       // class bdlat_AttributeNameIndex
+                       // ==============================
+
+class bdlat_AttributeNameIndex {
+    // This class provides an immutable index that maps the names of a set of
+    // attributes to their 'bdlat_AttributeInfo' in constant time.  The index
+    // holds copies of the attribute information, including the names and
+    // annotations.
+
+    // PRIVATE TYPES
+    struct Slot {
+        // An element of the hash table.
+
+        bsls::Types::Uint64 d_hash;   // hash of the name of the attribute
+        int                 d_index;  // index in 'd_attributes', or -1 if
+                                      // the slot is empty
+    };
+
+    class Collector;
+        // Functor that copies the information of each attribute it is
+        // invoked on into a vector.
+
+    // DATA
+    bsl::vector<bdlat_AttributeInfo> d_attributes;    // copies, referring to
+                                                      // 'd_strings'
+
+    bsl::vector<char>                d_strings;       // names and annotations
+
+    bsl::vector<Slot>                d_slots;         // hash table, having a
+                                                      // power of 2 size
+
+    bsl::vector<unsigned int>        d_displacements; // displacement for each
+                                                      // bucket
+
+    bsl::vector<int>                 d_overflow;      // indices of attributes
+                                                      // having no slot
+
+    // PRIVATE CLASS METHODS
+    static bsls::Types::Uint64 hash(const char *name, int nameLength);
+        // Return the hash of the specified 'name' of the specified
+        // 'nameLength'.
+
+    static bsls::Types::Uint64 mix(bsls::Types::Uint64 value);
+        // Return the specified 'value' with its bits mixed, so that every bit
+        // of the result depends on every bit of 'value'.
+
+    static bsl::size_t slotOf(bsls::Types::Uint64 hash,
+                              unsigned int        displacement,
+                              bsl::size_t         slotMask);
+        // Return the slot, masked with the specified 'slotMask', of a name
+        // having the specified 'hash' in a bucket having the specified
+        // 'displacement'.
+
+    template <class TYPE>
+    static const bdlat_AttributeInfo *lookupForType(
+                                        const TYPE&        object,
+                                        const char        *attributeName,
+                                        int                attributeNameLength,
+                                        bsl::true_type);
+    template <class TYPE>
+    static const bdlat_AttributeInfo *lookupForType(
+                                        const TYPE&        object,
+                                        const char        *attributeName,
+                                        int                attributeNameLength,
+                                        bsl::false_type);
+        // Return the address of the information of the attribute having the
+        // specified 'attributeName' of the specified 'attributeNameLength' in
+        // 'indexForType(object)' for the specified 'object' of a generated
+        // sequence type, and 0 if there is no such attribute or if 'TYPE' is
+        // not a generated sequence type.
+
+    // PRIVATE MANIPULATORS
+    void build(const bdlat_AttributeInfo *attributes, int numAttributes);
+        // Load into this empty index the specified 'numAttributes' attributes
+        // of the specified 'attributes' array, ignoring any attribute having
+        // the same name as a previous one.
+
+    // NOT IMPLEMENTED
+    bdlat_AttributeNameIndex(const bdlat_AttributeNameIndex&);
+    bdlat_AttributeNameIndex& operator=(const bdlat_AttributeNameIndex&);
+
+  public:
+    // CLASS METHODS
+    template <class TYPE>
+    static bool hasAttribute(const TYPE&  object,
+                             const char  *attributeName,
+                             int          attributeNameLength);
+        // Return 'true' if the specified 'object' has an attribute with the
+        // specified 'attributeName' of the specified 'attributeNameLength',
+        // and 'false' otherwise.  This function has the same behavior as
+        // 'bdlat_SequenceFunctions::hasAttribute', but if 'TYPE' is a
+        // generated sequence type, looks up the name in 'indexForType(object)'
+        // first.  The behavior is undefined unless 'TYPE' is a "sequence"
+        // type.
+
+    template <class TYPE>
+    static const bdlat_AttributeNameIndex& indexForType(const TYPE& object);
+        // Return a reference providing non-modifiable access to the index of
+        // the attributes of the specified 'object' (and of every other object
+        // of 'TYPE').  If this is the first call for 'TYPE', the index is
+        // built from the attributes visited by
+        // 'bdlat_SequenceFunctions::accessAttributes(object, ...)'.  The index
+        // is allocated from the global allocator and is never destroyed.  The
+        // behavior is undefined unless 'TYPE' is a "sequence" type.
+
+    template <class TYPE, class MANIPULATOR>
+    static int manipulateAttribute(TYPE         *object,
+                                   MANIPULATOR&  manipulator,
+                                   const char   *attributeName,
+                                   int           attributeNameLength);
+        // Invoke the specified 'manipulator' on the address of the
+        // (modifiable) attribute indicated by the specified 'attributeName'
+        // and 'attributeNameLength' of the specified 'object', supplying
+        // 'manipulator' with the corresponding attribute information
+        // structure.  Return a non-zero value if the attribute is not found,
+        // and the value returned from the invocation of 'manipulator'
+        // otherwise.  This function has the same behavior as
+        // 'bdlat_SequenceFunctions::manipulateAttribute', but if 'TYPE' is a
+        // generated sequence type and the name is found in
+        // 'indexForType(*object)', the attribute is manipulated by its id.
+        // The behavior is undefined unless 'TYPE' is a "sequence" type.
+
+    // CREATORS
+    bdlat_AttributeNameIndex(const bdlat_AttributeInfo *attributes,
+                             int                        numAttributes,
+                             bslma::Allocator          *basicAllocator = 0);
+        // Create an index of the specified 'numAttributes' attributes of the
+        // specified 'attributes' array.  Optionally specify a
+        // 'basicAllocator' used to supply memory.  If 'basicAllocator' is 0,
+        // the currently installed default allocator is used.  If several
+        // attributes have the same name, the first of them is found by that
+        // name.  The behavior is undefined unless '0 <= numAttributes', and
+        // 'attributes' refers to an array of at least 'numAttributes'
+        // elements.  Note that the index does not refer to 'attributes' once
+        // it is created.
+
+    // ACCESSORS
+    const bdlat_AttributeInfo *lookupAttributeInfo(const char *name,
+                                                   int         nameLength)
+                                                                         const;
+        // Return the address of the information of the attribute having the
+        // specified 'name' of the specified 'nameLength' in this index, and 0
+        // if there is no such attribute.  The behavior is undefined unless
+        // '0 <= nameLength'.
+
+    int numAttributes() const;
+        // Return the number of attributes in this index.
+};
+
+                  // ========================================
+                  // class bdlat_AttributeNameIndex::Collector
+                  // ========================================
+
+class bdlat_AttributeNameIndex::Collector {
+    // This class provides a 'bdlat' accessor that appends the information of
+    // each attribute it is invoked on to a vector.
+
+    // DATA
+    bsl::vector<bdlat_AttributeInfo> *d_attributes_p;  // held, not owned
+
+  public:
+    // CREATORS
+    explicit Collector(bsl::vector<bdlat_AttributeInfo> *attributes);
+        // Create a collector that appends to the specified 'attributes'.
+
+    // MANIPULATORS
+    template <class ATTRIBUTE_TYPE>
+    int operator()(const ATTRIBUTE_TYPE&, const bdlat_AttributeInfo& info);
+        // Append the specified 'info' to the vector of this collector.
+        // Return 0.
+};
+
+// ============================================================================
+//                        INLINE FUNCTION DEFINITIONS
+// ============================================================================
+
+                  // ----------------------------------------
+                  // class bdlat_AttributeNameIndex::Collector
+                  // ----------------------------------------
+
+// CREATORS
+inline
+bdlat_AttributeNameIndex::Collector::Collector(
+                                  bsl::vector<bdlat_AttributeInfo> *attributes)
+: d_attributes_p(attributes)
+{
+}
+
+// MANIPULATORS
+template <class ATTRIBUTE_TYPE>
+inline
+int bdlat_AttributeNameIndex::Collector::operator()(
+                                             const ATTRIBUTE_TYPE&,
+                                             const bdlat_AttributeInfo& info)
+{
+    d_attributes_p->push_back(info);
+    return 0;
+}
+
+                       // ------------------------------
+                       // class bdlat_AttributeNameIndex
+                       // ------------------------------
+
+// PRIVATE CLASS METHODS
+inline
+bsls::Types::Uint64 bdlat_AttributeNameIndex::hash(const char *name,
+                                                   int         nameLength)
+{
+    // 64-bit FNV-1a, followed by a mix of the result, as the high bits of
+    // FNV-1a, which select the bucket, are poorly distributed for names
+    // differing only in their last characters.
+
+    bsls::Types::Uint64 result = 14695981039346656037ULL;
+
+    for (int i = 0; i < nameLength; ++i) {
+        result ^= static_cast<unsigned char>(name[i]);
+        result *= 1099511628211ULL;
+    }
+
+    return mix(result);
+}
+
+inline
+bsls::Types::Uint64 bdlat_AttributeNameIndex::mix(bsls::Types::Uint64 value)
+{
+    // finalizer of MurmurHash3
+
+    value ^= value >> 33;
+    value *= 0xFF51AFD7ED558CCDULL;
+    value ^= value >> 33;
+    value *= 0xC4CEB9FE1A85EC53ULL;
+    value ^= value >> 33;
+
+    return value;
+}
+
+inline
+bsl::size_t bdlat_AttributeNameIndex::slotOf(bsls::Types::Uint64 hash,
+                                             unsigned int        displacement,
+                                             bsl::size_t         slotMask)
+{
+    const bsls::Types::Uint64 h = hash + displacement * 0x9E3779B97F4A7C15ULL;
+
+    return static_cast<bsl::size_t>(mix(h)) & slotMask;
+}
+
+template <class TYPE>
+inline
+const bdlat_AttributeInfo *bdlat_AttributeNameIndex::lookupForType(
+                                        const TYPE&        object,
+                                        const char        *attributeName,
+                                        int                attributeNameLength,
+                                        bsl::true_type)
+{
+    return indexForType(object).lookupAttributeInfo(attributeName,
+                                                    attributeNameLength);
+}
+
+template <class TYPE>
+inline
+const bdlat_AttributeInfo *bdlat_AttributeNameIndex::lookupForType(
+                                                             const TYPE&,
+                                                             const char *,
+                                                             int,
+                                                             bsl::false_type)
+{
+    return 0;
+}
+
+// CLASS METHODS
+template <class TYPE>
+inline
+bool bdlat_AttributeNameIndex::hasAttribute(const TYPE&  object,
+                                            const char  *attributeName,
+                                            int          attributeNameLength)
+{
+    typedef typename bdlat_IsGeneratedSequence<TYPE>::type IsGenerated;
+
+    return 0 != lookupForType(object,
+                              attributeName,
+                              attributeNameLength,
+                              IsGenerated())
+        || bdlat_SequenceFunctions::hasAttribute(object,
+                                                 attributeName,
+                                                 attributeNameLength);
+}
+
+template <class TYPE>
+const bdlat_AttributeNameIndex&
+bdlat_AttributeNameIndex::indexForType(const TYPE& object)
+{
+    static bsls::ObjectBuffer<bdlat_AttributeNameIndex> s_index;
+
+    BSLMT_ONCE_DO {
+        bslma::Allocator *allocator = bslma::Default::globalAllocator();
+
+        bsl::vector<bdlat_AttributeInfo> attributes(allocator);
+        Collector                        collector(&attributes);
+
+        bdlat_SequenceFunctions::accessAttributes(object, collector);
+
+        new (s_index.buffer()) bdlat_AttributeNameIndex(
+                                       attributes.data(),
+                                       static_cast<int>(attributes.size()),
+                                       allocator);
+    }
+
+    return s_index.object();
+}
+
+template <class TYPE, class MANIPULATOR>
+inline
+int bdlat_AttributeNameIndex::manipulateAttribute(
+                                        TYPE         *object,
+                                        MANIPULATOR&  manipulator,
+                                        const char   *attributeName,
+                                        int           attributeNameLength)
+{
+    BSLS_ASSERT_SAFE(object);
+
+    typedef typename bdlat_IsGeneratedSequence<TYPE>::type IsGenerated;
+
+    const bdlat_AttributeInfo *info = lookupForType(*object,
+                                                    attributeName,
+                                                    attributeNameLength,
+                                                    IsGenerated());
+
+    if (info) {
+        return bdlat_SequenceFunctions::manipulateAttribute(object,
+                                                            manipulator,
+                                                            info->id());
+                                                                      // RETURN
+    }
+
+    return bdlat_SequenceFunctions::manipulateAttribute(object,
+                                                        manipulator,
+                                                        attributeName,
+                                                        attributeNameLength);
+}
+
+// ACCESSORS
+inline
+const bdlat_AttributeInfo *bdlat_AttributeNameIndex::lookupAttributeInfo(
+                                                  const char *name,
+                                                  int         nameLength) const
+{
+    BSLS_ASSERT_SAFE(0 <= nameLength);
+
+    if (d_attributes.empty()) {
+        return 0;                                                     // RETURN
+    }
+
+    const bsls::Types::Uint64 h = hash(name, nameLength);
+
+    const Slot& slot = d_slots[slotOf(
+                h,
+                d_displacements[static_cast<bsl::size_t>(h >> 32)
+                                                    % d_displacements.size()],
+                d_slots.size() - 1)];
+
+    if (0 <= slot.d_index && h == slot.d_hash) {
+        const bdlat_AttributeInfo& info = d_attributes[slot.d_index];
+
+        if (nameLength == info.d_nameLength
+         && 0 == bsl::memcmp(name, info.d_name_p, nameLength)) {
+            return &info;                                             // RETURN
+        }
+    }
+
+    for (bsl::size_t i = 0; i < d_overflow.size(); ++i) {
+        const bdlat_AttributeInfo& info = d_attributes[d_overflow[i]];
+
+        if (nameLength == info.d_nameLength
+         && 0 == bsl::memcmp(name, info.d_name_p, nameLength)) {
+            return &info;                                             // RETURN
+        }
+    }
+
+    return 0;
+}
+
+inline
+int bdlat_AttributeNameIndex::numAttributes() const
+{
+    return static_cast<int>(d_attributes.size());
+}
+
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,902 @@
+// bdlat_attributenameindex.t.cpp                                     -*-C++-*-
+#include <bdlat_attributenameindex.h>
+
+#include <bdlat_attributeinfo.h>
+#include <bdlat_formattingmode.h>
+#include <bdlat_sequencefunctions.h>
+#include <bdlat_typetraits.h>
+
+#include <bslim_testutil.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+
+#include <bsls_asserttest.h>
+#include <bsls_review.h>
+#include <bsls_stopwatch.h>
+
+#include <bsl_cstdio.h>
+#include <bsl_cstdlib.h>
+#include <bsl_cstring.h>
+#include <bsl_iostream.h>
+#include <bsl_string.h>
+#include <bsl_vector.h>
+
+using namespace BloombergLP;
+using namespace bsl;
+
+// ============================================================================
+//                             TEST PLAN
+// ----------------------------------------------------------------------------
+//                              Overview
+//                              --------
+// The component under test is an immutable index built from an array of
+// attribute information structures.  Lookups are verified for every attribute
+// of arrays of every size up to several hundred attributes, and for names
+// that are not in the array, including names that are prefixes or extensions
+// of names in the array.  The class methods are verified with a sequence type
+// having a few hundred attributes, that also recognizes a name other than the
+// names of its attributes, and that counts the lookups by name it performs.
+// ----------------------------------------------------------------------------
+// CLASS METHODS
+// [3] bool hasAttribute(const TYPE&, const char *name, int length);
+// [3] const bdlat_AttributeNameIndex& indexForType(const TYPE& object);
+// [3] int manipulateAttribute(TYPE *, MANIPULATOR&, const char *, int);
+//
+// CREATORS
+// [2] bdlat_AttributeNameIndex(const AttributeInfo *, int, Allocator *);
+// [2] ~bdlat_AttributeNameIndex();
+//
+// ACCESSORS
+// [2] const AttributeInfo *lookupAttributeInfo(name, length) const;
+// [2] int numAttributes() const;
+// ----------------------------------------------------------------------------
+// [1] BREATHING TEST
+// [4] USAGE EXAMPLE
+// [-1] PERFORMANCE TEST
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLIM_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLIM_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLIM_TESTUTIL_LOOP6_ASSERT
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_SAFE_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_PASS(EXPR)
+#define ASSERT_SAFE_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_FAIL(EXPR)
+#define ASSERT_PASS(EXPR)      BSLS_ASSERTTEST_ASSERT_PASS(EXPR)
+#define ASSERT_FAIL(EXPR)      BSLS_ASSERTTEST_ASSERT_FAIL(EXPR)
+#define ASSERT_OPT_PASS(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_PASS(EXPR)
+#define ASSERT_OPT_FAIL(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_FAIL(EXPR)
+
+// ============================================================================
+//                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef bdlat_AttributeNameIndex Obj;
+
+// ============================================================================
+//                  GLOBAL HELPER FUNCTIONS FOR TESTING
+// ----------------------------------------------------------------------------
+
+static
+void loadAttributes(bsl::vector<bdlat_AttributeInfo> *attributes,
+                    bsl::vector<bsl::string>         *names,
+                    const char                       *prefix,
+                    int                               numAttributes)
+    // Load into the specified 'attributes' the specified 'numAttributes'
+    // attributes having the ids '100', '101', ..., and the names, stored in
+    // the specified 'names', made of the specified 'prefix' followed by the
+    // id.
+{
+    names->clear();
+    for (int i = 0; i < numAttributes; ++i) {
+        char buffer[32];
+        bsl::sprintf(buffer, "%s%d", prefix, 100 + i);
+        names->push_back(buffer);
+    }
+
+    attributes->clear();
+    for (int i = 0; i < numAttributes; ++i) {
+        bdlat_AttributeInfo info = { 100 + i,
+                                     (*names)[i].c_str(),
+                                     static_cast<int>((*names)[i].length()),
+                                     "annotation",
+                                     bdlat_FormattingMode::e_DEFAULT };
+        attributes->push_back(info);
+    }
+}
+
+static
+const bdlat_AttributeInfo *linearLookup(
+                                      const bdlat_AttributeInfo *attributes,
+                                      int                        numAttributes,
+                                      const char                *name,
+                                      int                        nameLength)
+    // Return the address of the first of the specified 'numAttributes'
+    // attributes of the specified 'attributes' array having the specified
+    // 'name' of the specified 'nameLength', and 0 if there is no such
+    // attribute, by comparing 'name' with the name of each attribute in turn,
+    // as the 'lookupAttributeInfo' function of a generated type does.
+{
+    for (int i = 0; i < numAttributes; ++i) {
+        if (nameLength == attributes[i].d_nameLength
+         && 0 == bsl::memcmp(name, attributes[i].d_name_p, nameLength)) {
+            return attributes + i;                                    // RETURN
+        }
+    }
+    return 0;
+}
+
+// ============================================================================
+//                            CLASSES FOR TESTING
+// ----------------------------------------------------------------------------
+
+namespace test {
+
+struct WideSequence {
+    // This 'struct' provides a sequence type, implemented as a type generated
+    // from a schema would be, having 'k_NUM_ATTRIBUTES' 'int' attributes,
+    // having the ids '100', '101', ..., and the names "field100", "field101",
+    // ....  The sequence also recognizes the name "alias" as the name of its
+    // first attribute, and counts the lookups by name that it performs.
+
+    // CONSTANTS
+    enum { k_NUM_ATTRIBUTES = 240, k_FIRST_ID = 100 };
+
+    // CLASS DATA
+    static int s_numLookupsByName;  // lookups by name performed
+
+    // DATA
+    int d_values[k_NUM_ATTRIBUTES];
+
+    // CLASS METHODS
+    static const bdlat_AttributeInfo *attributes();
+        // Return the address of the array of the information of the
+        // attributes of this type.
+
+    static const bdlat_AttributeInfo *lookupAttributeInfo(const char *name,
+                                                          int         length);
+        // Return the address of the information of the attribute having the
+        // specified 'name' of the specified 'length', and 0 if there is no
+        // such attribute.
+
+    // MANIPULATORS
+    template <class MANIPULATOR>
+    int manipulateAttribute(MANIPULATOR& manipulator, int id)
+        // Invoke the specified 'manipulator' on the attribute having the
+        // specified 'id', and return the value it returns, or return -1 if
+        // there is no such attribute.
+    {
+        const int index = id - k_FIRST_ID;
+
+        if (index < 0 || k_NUM_ATTRIBUTES <= index) {
+            return -1;                                                // RETURN
+        }
+        return manipulator(&d_values[index], attributes()[index]);
+    }
+
+    template <class MANIPULATOR>
+    int manipulateAttribute(MANIPULATOR&  manipulator,
+                            const char   *name,
+                            int           nameLength)
+        // Invoke the specified 'manipulator' on the attribute having the
+        // specified 'name' of the specified 'nameLength', and return the
+        // value it returns, or return -1 if there is no such attribute.
+    {
+        const bdlat_AttributeInfo *info = lookupAttributeInfo(name,
+                                                              nameLength);
+        if (!info) {
+            return -1;                                                // RETURN
+        }
+        return manipulateAttribute(manipulator, info->id());
+    }
+
+    // ACCESSORS
+    template <class ACCESSOR>
+    int accessAttributes(ACCESSOR& accessor) const
+        // Invoke the specified 'accessor' on each attribute in turn, and
+        // return the first non-zero value it returns, or 0.
+    {
+        for (int i = 0; i < k_NUM_ATTRIBUTES; ++i) {
+            const int rc = accessor(d_values[i], attributes()[i]);
+            if (rc) {
+                return rc;                                            // RETURN
+            }
+        }
+        return 0;
+    }
+};
+
+int WideSequence::s_numLookupsByName = 0;
+
+const bdlat_AttributeInfo *WideSequence::attributes()
+{
+    static bsl::vector<bdlat_AttributeInfo> *s_attributes_p = 0;
+    static bsl::vector<bsl::string>         *s_names_p      = 0;
+
+    if (!s_attributes_p) {
+        bslma::Allocator *allocator = bslma::Default::globalAllocator();
+
+        s_names_p      = new (*allocator) bsl::vector<bsl::string>(allocator);
+        s_attributes_p = new (*allocator) bsl::vector<bdlat_AttributeInfo>(
+                                                                    allocator);
+
+        loadAttributes(s_attributes_p, s_names_p, "field", k_NUM_ATTRIBUTES);
+    }
+    return s_attributes_p->data();
+}
+
+const bdlat_AttributeInfo *WideSequence::lookupAttributeInfo(
+                                                            const char *name,
+                                                            int         length)
+{
+    ++s_numLookupsByName;
+
+    if (5 == length && 0 == bsl::memcmp(name, "alias", 5)) {
+        return attributes();                                          // RETURN
+    }
+    return linearLookup(attributes(), k_NUM_ATTRIBUTES, name, length);
+}
+
+struct CustomSequence {
+    // This 'struct' provides a sequence type, implementing the 'bdlat'
+    // customization points as free functions, having the attributes of a
+    // 'WideSequence', except that the manipulation of attributes by name
+    // fails for the name "field101".
+
+    // DATA
+    WideSequence d_sequence;
+};
+
+template <class MANIPULATOR>
+int bdlat_sequenceManipulateAttribute(CustomSequence *object,
+                                      MANIPULATOR&    manipulator,
+                                      int             attributeId)
+{
+    return object->d_sequence.manipulateAttribute(manipulator, attributeId);
+}
+
+template <class MANIPULATOR>
+int bdlat_sequenceManipulateAttribute(CustomSequence *object,
+                                      MANIPULATOR&    manipulator,
+                                      const char     *attributeName,
+                                      int             attributeNameLength)
+{
+    if (8 == attributeNameLength
+     && 0 == bsl::memcmp(attributeName, "field101", 8)) {
+        return -1;                                                    // RETURN
+    }
+    return object->d_sequence.manipulateAttribute(manipulator,
+                                                  attributeName,
+                                                  attributeNameLength);
+}
+
+template <class ACCESSOR>
+int bdlat_sequenceAccessAttributes(const CustomSequence& object,
+                                   ACCESSOR&             accessor)
+{
+    return object.d_sequence.accessAttributes(accessor);
+}
+
+bool bdlat_sequenceHasAttribute(const CustomSequence&,
+                                const char            *attributeName,
+                                int                    attributeNameLength)
+{
+    return 0 != WideSequence::lookupAttributeInfo(attributeName,
+                                                  attributeNameLength);
+}
+
+struct SetValue {
+    // This 'struct' provides a manipulator that sets an 'int' attribute to a
+    // value, and records the id of the attribute.
+
+    // DATA
+    int d_value;  // value to set
+    int d_id;     // id of the last attribute set
+
+    // MANIPULATORS
+    int operator()(int *attribute, const bdlat_AttributeInfo& info)
+        // Set the specified 'attribute' to the value of this manipulator,
+        // record the id of the specified 'info', and return 0.
+    {
+        *attribute = d_value;
+        d_id       = info.id();
+        return 0;
+    }
+};
+
+}  // close namespace test
+
+namespace BloombergLP {
+
+template <>
+struct bdlat_IsBasicSequence<test::WideSequence> : bsl::true_type {
+};
+
+template <>
+struct bdlat_IsGeneratedSequence<test::WideSequence> : bsl::true_type {
+};
+
+namespace bdlat_SequenceFunctions {
+
+template <>
+struct IsSequence<test::CustomSequence> {
+    enum { VALUE = 1 };
+};
+
+}  // close namespace bdlat_SequenceFunctions
+}  // close enterprise namespace
+
+// ============================================================================
+//                               MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int  test            = argc > 1 ? bsl::atoi(argv[1]) : 0;
+    bool verbose         = argc > 2;
+    bool veryVerbose     = argc > 3;
+
+    // CONCERN: 'BSLS_REVIEW' failures should lead to test failures.
+    bsls::ReviewFailureHandlerGuard reviewGuard(&bsls::Review::failByAbort);
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    switch (test) { case 0:
+      case 4: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "USAGE EXAMPLE" << endl
+                          << "=============" << endl;
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Finding Attributes by Name
+///- - - - - - - - - - - - - - - - - - -
+// Suppose we are writing a decoder for a text format in which the attributes
+// of a sequence are identified by their names.
+//
+// First, we define the attributes of our sequence type, as a type generated
+// from a schema would:
+//..
+    const bdlat_AttributeInfo ATTRIBUTES[] = {
+        { 1, "price",    5, "", 0 },
+        { 2, "quantity", 8, "", 0 },
+        { 3, "symbol",   6, "", 0 }
+    };
+//..
+// Then, we build an index of those attributes:
+//..
+    bdlat_AttributeNameIndex index(ATTRIBUTES, 3);
+    ASSERT(3 == index.numAttributes());
+//..
+// Now, we look up a name that we read from the input:
+//..
+    const bdlat_AttributeInfo *info = index.lookupAttributeInfo("quantity",
+                                                                8);
+    ASSERT(0 != info);
+    ASSERT(2 == info->id());
+//..
+// Finally, we observe that an unknown name is not found:
+//..
+    ASSERT(0 == index.lookupAttributeInfo("volume", 6));
+//..
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // CLASS METHODS
+        //
+        // Concerns:
+        //: 1 'indexForType' returns the same index for every call with the
+        //:   same type, holding the attributes of that type.
+        //:
+        //: 2 'manipulateAttribute' manipulates the attribute having the
+        //:   supplied name, and finds the names of the attributes without
+        //:   looking them up by name in the sequence.
+        //:
+        //: 3 'manipulateAttribute' and 'hasAttribute' find names that the
+        //:   sequence recognizes in addition to the names of its attributes.
+        //:
+        //: 4 'manipulateAttribute' returns a non-zero value, and
+        //:   'hasAttribute' returns 'false', for unknown names.
+        //:
+        //: 5 The index is not allocated from the default allocator.
+        //:
+        //: 6 The index is not used for sequence types that are not generated,
+        //:   whose manipulation of attributes by name may be customized.
+        //
+        // Plan:
+        //: 1 Using a sequence type that counts its lookups by name, set each
+        //:   attribute by name, and verify the value and id of the attribute
+        //:   set and the number of lookups by name.  (C-1..2, 5)
+        //:
+        //: 2 Manipulate and test an alias name and unknown names.  (C-3..4)
+        //:
+        //: 3 Using a sequence type implementing the 'bdlat' customization
+        //:   points as free functions, and failing to manipulate an attribute
+        //:   by name, verify that the names are looked up by the sequence, and
+        //:   that the failure is reported.  (C-6)
+        //
+        // Testing:
+        //   bool hasAttribute(const TYPE&, const char *name, int length);
+        //   const bdlat_AttributeNameIndex& indexForType(const TYPE& object);
+        //   int manipulateAttribute(TYPE *, MANIPULATOR&, const char *, int);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "CLASS METHODS" << endl
+                          << "=============" << endl;
+
+        typedef test::WideSequence Sequence;
+
+        bslma::TestAllocator         da("default", veryVerbose);
+        bslma::DefaultAllocatorGuard dag(&da);
+
+        Sequence mX;  const Sequence& X = mX;
+        bsl::memset(&mX, 0, sizeof mX);
+
+        const Obj& INDEX = Obj::indexForType(X);
+
+        ASSERT(&INDEX == &Obj::indexForType(X));
+        ASSERT(&INDEX == &Obj::indexForType(Sequence()));
+        ASSERTV(INDEX.numAttributes(),
+                Sequence::k_NUM_ATTRIBUTES == INDEX.numAttributes());
+
+        if (verbose) cout << "\tManipulating attributes by name." << endl;
+
+        Sequence::s_numLookupsByName = 0;
+
+        for (int i = 0; i < Sequence::k_NUM_ATTRIBUTES; ++i) {
+            const bdlat_AttributeInfo& INFO = Sequence::attributes()[i];
+
+            test::SetValue setValue = { i + 1, 0 };
+
+            ASSERTV(i, true == Obj::hasAttribute(X,
+                                                 INFO.name(),
+                                                 INFO.nameLength()));
+
+            const int rc = Obj::manipulateAttribute(&mX,
+                                                    setValue,
+                                                    INFO.name(),
+                                                    INFO.nameLength());
+            ASSERTV(i, rc, 0 == rc);
+            ASSERTV(i, setValue.d_id, INFO.id() == setValue.d_id);
+            ASSERTV(i, X.d_values[i], i + 1 == X.d_values[i]);
+        }
+
+        ASSERTV(Sequence::s_numLookupsByName,
+                0 == Sequence::s_numLookupsByName);
+
+        if (verbose) cout << "\tNames not in the index." << endl;
+
+        {
+            test::SetValue setValue = { -1, 0 };
+
+            ASSERT(true == Obj::hasAttribute(X, "alias", 5));
+            ASSERT(0    == Obj::manipulateAttribute(&mX,
+                                                    setValue,
+                                                    "alias",
+                                                    5));
+            ASSERT(Sequence::k_FIRST_ID == setValue.d_id);
+            ASSERT(-1                   == X.d_values[0]);
+
+            ASSERTV(Sequence::s_numLookupsByName,
+                    2 == Sequence::s_numLookupsByName);
+
+            setValue.d_id = 0;
+
+            ASSERT(false == Obj::hasAttribute(X, "field", 5));
+            ASSERT(false == Obj::hasAttribute(X, "field1000", 9));
+            ASSERT(false == Obj::hasAttribute(X, "", 0));
+            ASSERT(0     != Obj::manipulateAttribute(&mX,
+                                                     setValue,
+                                                     "field99",
+                                                     7));
+            ASSERT(0     == setValue.d_id);
+        }
+
+        if (verbose) cout << "\tSequences that are not generated." << endl;
+        {
+            test::CustomSequence mY;  const test::CustomSequence& Y = mY;
+            bsl::memset(&mY, 0, sizeof mY);
+
+            Sequence::s_numLookupsByName = 0;
+
+            test::SetValue setValue = { 7, 0 };
+
+            ASSERT(true == Obj::hasAttribute(Y, "field100", 8));
+            ASSERT(0    == Obj::manipulateAttribute(&mY,
+                                                    setValue,
+                                                    "field100",
+                                                    8));
+            ASSERT(7    == Y.d_sequence.d_values[0]);
+
+            ASSERT(0    != Obj::manipulateAttribute(&mY,
+                                                    setValue,
+                                                    "field101",
+                                                    8));
+            ASSERT(0    == Y.d_sequence.d_values[1]);
+
+            ASSERTV(Sequence::s_numLookupsByName,
+                    2 == Sequence::s_numLookupsByName);
+        }
+
+        ASSERTV(da.numBlocksInUse(), 0 == da.numBlocksInUse());
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // CONSTRUCTOR AND LOOKUP
+        //
+        // Concerns:
+        //: 1 Every attribute of an index of any size is found by its name,
+        //:   and the information found has the id, name, annotation, and
+        //:   formatting mode of the attribute.
+        //:
+        //: 2 Names that are not the name of an attribute, including prefixes
+        //:   and extensions of the names of attributes, and the empty name,
+        //:   are not found.
+        //:
+        //: 3 If several attributes have the same name, the first of them is
+        //:   found, and 'numAttributes' counts distinct names.
+        //:
+        //: 4 The index holds copies of the names and annotations.
+        //:
+        //: 5 An attribute may have an empty name.
+        //:
+        //: 6 All memory is allocated from the supplied allocator, and is
+        //:   released on destruction.
+        //:
+        //: 7 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 For every number of attributes up to several hundred, build an
+        //:   index from generated names, overwrite the generated names, and
+        //:   look up the name of every attribute and names derived from
+        //:   them.  (C-1..2, 4, 6)
+        //:
+        //: 2 Build indexes from arrays having duplicate and empty names.
+        //:   (C-3, 5)
+        //:
+        //: 3 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for invalid arguments.  (C-7)
+        //
+        // Testing:
+        //   bdlat_AttributeNameIndex(const AttributeInfo *, int, Allocator *);
+        //   ~bdlat_AttributeNameIndex();
+        //   const AttributeInfo *lookupAttributeInfo(name, length) const;
+        //   int numAttributes() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "CONSTRUCTOR AND LOOKUP" << endl
+                          << "======================" << endl;
+
+        bslma::TestAllocator         da("default", veryVerbose);
+        bslma::DefaultAllocatorGuard dag(&da);
+
+        bslma::TestAllocator sa("scratch", veryVerbose);
+
+        bsl::vector<bdlat_AttributeInfo> attributes(&sa);
+        bsl::vector<bsl::string>         names(&sa);
+
+        if (verbose) cout << "\tIndexes of every size." << endl;
+
+        for (int n = 0; n <= 300; ++n) {
+            loadAttributes(&attributes, &names, "name", n);
+
+            bslma::TestAllocator oa("object", veryVerbose);
+
+            {
+                Obj mX(attributes.data(), n, &oa);  const Obj& X = mX;
+
+                // Overwrite the names the index was built from.
+
+                for (int i = 0; i < n; ++i) {
+                    names[i][0] = 'X';
+                }
+                ASSERTV(n, X.numAttributes(), n == X.numAttributes());
+
+                for (int i = 0; i < n; ++i) {
+                    char name[32];
+                    bsl::sprintf(name, "name%d", 100 + i);
+
+                    const int length = static_cast<int>(bsl::strlen(name));
+
+                    const bdlat_AttributeInfo *INFO =
+                                          X.lookupAttributeInfo(name, length);
+
+                    ASSERTV(n, i, 0 != INFO);
+                    if (!INFO) {
+                        continue;
+                    }
+                    ASSERTV(n, i, INFO->id(), 100 + i == INFO->id());
+                    ASSERTV(n, i, length == INFO->nameLength());
+                    ASSERTV(n, i, 0 == bsl::strcmp(name, INFO->name()));
+                    ASSERTV(n, i, 0 == bsl::strcmp("annotation",
+                                                   INFO->annotation()));
+                    ASSERTV(n, i, bdlat_FormattingMode::e_DEFAULT ==
+                                                      INFO->formattingMode());
+
+                    // Prefixes, extensions, and other names.
+
+                    ASSERTV(n, i, 0 == X.lookupAttributeInfo(name,
+                                                             length - 1));
+
+                    name[length]     = '0';
+                    name[length + 1] = '\0';
+                    ASSERTV(n, i, 0 == X.lookupAttributeInfo(name,
+                                                             length + 1));
+
+                    name[0] = 'X';
+                    ASSERTV(n, i, 0 == X.lookupAttributeInfo(name, length));
+                }
+
+                ASSERTV(n, 0 == X.lookupAttributeInfo("", 0));
+                ASSERTV(n, 0 == X.lookupAttributeInfo("name", 4));
+            }
+
+            ASSERTV(n, oa.numBlocksInUse(), 0 == oa.numBlocksInUse());
+        }
+
+        if (verbose) cout << "\tDuplicate and empty names." << endl;
+        {
+            const bdlat_AttributeInfo ATTRIBUTES[] = {
+                { 1, "a",   1, "first",  0 },
+                { 2, "b",   1, "",       0 },
+                { 3, "a",   1, "second", 0 },
+                { 4, "",    0, "empty",  0 },
+                { 5, "abc", 2, "",       0 },  // name is "ab"
+                { 6, "b",   1, "",       0 }
+            };
+            const int NUM_ATTRIBUTES = sizeof ATTRIBUTES / sizeof *ATTRIBUTES;
+
+            bslma::TestAllocator oa("object", veryVerbose);
+
+            Obj mX(ATTRIBUTES, NUM_ATTRIBUTES, &oa);  const Obj& X = mX;
+
+            ASSERTV(X.numAttributes(), 4 == X.numAttributes());
+
+            const bdlat_AttributeInfo *INFO = X.lookupAttributeInfo("a", 1);
+            ASSERT(INFO && 1 == INFO->id());
+            ASSERT(INFO && 0 == bsl::strcmp("first", INFO->annotation()));
+
+            INFO = X.lookupAttributeInfo("b", 1);
+            ASSERT(INFO && 2 == INFO->id());
+
+            INFO = X.lookupAttributeInfo("", 0);
+            ASSERT(INFO && 4 == INFO->id());
+
+            INFO = X.lookupAttributeInfo("ab", 2);
+            ASSERT(INFO && 5 == INFO->id());
+            ASSERT(INFO && 0 == bsl::strcmp("ab", INFO->name()));
+
+            ASSERT(0 == X.lookupAttributeInfo("abc", 3));
+        }
+
+        if (verbose) cout << "\tNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            const bdlat_AttributeInfo ATTRIBUTES[] = {
+                { 1, "a", 1, "", 0 }
+            };
+
+            ASSERT_PASS(Obj(ATTRIBUTES, 1));
+            ASSERT_PASS(Obj(0, 0));
+            ASSERT_FAIL(Obj(ATTRIBUTES, -1));
+            ASSERT_FAIL(Obj(0, 1));
+
+            Obj mX(ATTRIBUTES, 1);  const Obj& X = mX;
+
+            ASSERT_SAFE_PASS(X.lookupAttributeInfo("a", 0));
+            ASSERT_SAFE_FAIL(X.lookupAttributeInfo("a", -1));
+        }
+
+        ASSERTV(da.numBlocksInUse(), 0 == da.numBlocksInUse());
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Build an index of a few attributes, and look up their names and
+        //:   an unknown name.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        const bdlat_AttributeInfo ATTRIBUTES[] = {
+            { 10, "bid",  3, "", 0 },
+            { 20, "ask",  3, "", 0 },
+            { 30, "last", 4, "", 0 }
+        };
+
+        Obj mX(ATTRIBUTES, 3);  const Obj& X = mX;
+
+        ASSERT(3 == X.numAttributes());
+
+        for (int i = 0; i < 3; ++i) {
+            const bdlat_AttributeInfo *INFO = X.lookupAttributeInfo(
+                                                   ATTRIBUTES[i].name(),
+                                                   ATTRIBUTES[i].nameLength());
+            ASSERTV(i, INFO && ATTRIBUTES[i].id() == INFO->id());
+        }
+
+        ASSERT(0 == X.lookupAttributeInfo("open", 4));
+
+        Obj mY(0, 0);  const Obj& Y = mY;
+
+        ASSERT(0 == Y.numAttributes());
+        ASSERT(0 == Y.lookupAttributeInfo("bid", 3));
+      } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE TEST
+        //
+        // Concerns:
+        //: 1 Looking up names in an index is faster than comparing them with
+        //:   the name of each attribute in turn, for sequences having many
+        //:   attributes.
+        //
+        // Plan:
+        //: 1 For sequences of various numbers of attributes, time looking up
+        //:   every name with an index and with a linear search.  (C-1)
+        //
+        // Testing:
+        //   PERFORMANCE TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "PERFORMANCE TEST" << endl
+                          << "================" << endl;
+
+        const int SIZES[]   = { 4, 16, 64, 256, 1024 };
+        const int NUM_SIZES = sizeof SIZES / sizeof *SIZES;
+
+        enum { k_NUM_LOOKUPS = 4 * 1024 * 1024 };
+
+        for (int ti = 0; ti < NUM_SIZES; ++ti) {
+            const int n = SIZES[ti];
+
+            bsl::vector<bdlat_AttributeInfo> attributes;
+            bsl::vector<bsl::string>         names;
+
+            loadAttributes(&attributes, &names, "attribute", n);
+
+            const Obj X(attributes.data(), n);
+
+            int           numFound = 0;
+            bsls::Stopwatch timer;
+
+            timer.start();
+            for (int i = 0; i < k_NUM_LOOKUPS; ++i) {
+                const bsl::string& NAME = names[i % n];
+
+                numFound += 0 != X.lookupAttributeInfo(
+                                          NAME.data(),
+                                          static_cast<int>(NAME.length()));
+            }
+            timer.stop();
+
+            const double indexTime = timer.elapsedTime();
+
+            timer.reset();
+            timer.start();
+            for (int i = 0; i < k_NUM_LOOKUPS; ++i) {
+                const bsl::string& NAME = names[i % n];
+
+                numFound += 0 != linearLookup(attributes.data(),
+                                              n,
+                                              NAME.data(),
+                                              static_cast<int>(NAME.length()));
+            }
+            timer.stop();
+
+            const double linearTime = timer.elapsedTime();
+
+            ASSERTV(numFound, 2 * k_NUM_LOOKUPS == numFound);
+
+            cout << "attributes: "  << n
+                 << "\tindex: "     << indexTime  * 1e9 / k_NUM_LOOKUPS
+                 << " ns\tlinear: " << linearTime * 1e9 / k_NUM_LOOKUPS
+                 << " ns" << endl;
+        }
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      } break;
+    }
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
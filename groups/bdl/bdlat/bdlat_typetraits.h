@@ -21,6 +21,7 @@ BSLS_IDENT("$Id: $")
 //  bdlat_IsBasicEnumeration<TYPE>:      true for generated "enumeration" types
 //  bdlat_BasicEnumerationWrapper<TYPE>: characteristics of enumeration type
 //  bdlat_IsBasicCustomizedType<TYPE>:   true for generated "customized" types
+//  bdlat_IsGeneratedSequence<TYPE>:     true for sequences declared by macro
 //
 //@MACROS:
 //  BDLAT_DECL_CHOICE_TRAITS(ClassName)
@@ -45,6 +46,15 @@ BSLS_IDENT("$Id: $")
 // 'bdlat_IsBasicCustomizedType' are used for generated "choice" types,
 // "sequence" types, "enumeration", and "customized type" types respectively.
 //
+// The 'bdlat_IsGeneratedSequence' trait is declared by the
+// 'BDLAT_DECL_SEQUENCE_*' macros, and indicates that a "sequence" type
+// manipulates and accesses an attribute by name by looking up the id of the
+// attribute with its 'lookupAttributeInfo' class method, as generated types
+// do, so that the lookup may be replaced by a faster one (see
+// 'bdlat_attributenameindex').  Note that 'bdlat_IsBasicSequence' does not
+// imply this trait, as a type having that trait may customize the
+// manipulation of its attributes by name.
+//
 ///Usage
 ///-----
 // This component is intended to be used by components generated using the
@@ -81,6 +91,14 @@ struct bdlat_IsBasicSequence :
     // This trait may be declared for "sequence" types.
 };
 
+template <class TYPE>
+struct bdlat_IsGeneratedSequence :
+        bslmf::DetectNestedTrait<TYPE, bdlat_IsGeneratedSequence>::type
+{
+    // This trait may be declared for "sequence" types that find their
+    // attributes by name only by looking up their ids by name.
+};
+
 template <class TYPE>
 struct bdlat_IsBasicEnumeration :
         bslmf::DetectNestedTrait<TYPE, bdlat_IsBasicEnumeration>::type
@@ -203,6 +221,8 @@ struct bdlat_TypeTraitBasicCustomizedType {
 #define BDLAT_DECL_SEQUENCE_TRAITS(ClassName)                                 \
     template <>                                                               \
     struct bdlat_IsBasicSequence<ClassName> : bsl::true_type { };             \
+    template <>                                                               \
+    struct bdlat_IsGeneratedSequence<ClassName> : bsl::true_type { };         \
     namespace bdlb {                                                          \
         template <>                                                           \
         struct HasPrintMethod<ClassName> : bsl::true_type { };                \
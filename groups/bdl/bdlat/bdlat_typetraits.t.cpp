@@ -238,6 +238,7 @@ int main(int argc, char *argv[])
                                    bdlb::TypeTraitHasPrintMethod>::VALUE));
         ASSERT(! bslmf::IsBitwiseMoveable<my_ClassWithNoTraits>::value);
         ASSERT(! bslma::UsesBslmaAllocator<my_ClassWithNoTraits>::value);
+        ASSERT(! bdlat_IsGeneratedSequence<my_ClassWithNoTraits>::value);
 
         if (verbose) cout << "\tChoice types." << endl;
 
@@ -303,6 +304,17 @@ int main(int argc, char *argv[])
 
         if (verbose) cout << "\tSequence types." << endl;
 
+        ASSERT(  bdlat_IsGeneratedSequence<
+                                      my_ClassWithBasicSequenceTraits>::value);
+        ASSERT(  bdlat_IsGeneratedSequence<
+                                 my_ClassWithBasicSequenceAllocTraits>::value);
+        ASSERT(  bdlat_IsGeneratedSequence<
+                               my_ClassWithBasicSequenceBitwiseTraits>::value);
+        ASSERT(  bdlat_IsGeneratedSequence<
+                          my_ClassWithBasicSequenceAllocBitwiseTraits>::value);
+        ASSERT(! bdlat_IsGeneratedSequence<
+                                        my_ClassWithBasicChoiceTraits>::value);
+
         ASSERT(! (bslalg::HasTrait<my_ClassWithBasicSequenceTraits,
                                    bdlat_TypeTraitBasicChoice>::VALUE));
         ASSERT(! (bslalg::HasTrait<my_ClassWithBasicSequenceTraits,
@@ -0,0 +1,230 @@
+// bdlb_numericformatutil.h                                           -*-C++-*-
+#ifndef INCLUDED_BDLB_NUMERICFORMATUTIL
+#define INCLUDED_BDLB_NUMERICFORMATUTIL
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide conversions from fundamental numeric types into text.
+//
+//@CLASSES:
+//  bdlb::NumericFormatUtil: namespace for formatting functions
+//
+//@SEE_ALSO: bdlb_numericparseutil
+//
+//@DESCRIPTION: This component provides a namespace,
+// 'bdlb::NumericFormatUtil', containing utility functions for writing the
+// text representations of the values of fundamental C++ numeric types into
+// caller-supplied character buffers.  The interface is modeled on the C++17
+// 'std::to_chars' function: each function writes into the range
+// '[first, last)', does not null-terminate its output, and returns a pointer
+// one past the last character written, or 0 if the range is too small.
+//
+///Integer Text
+///------------
+// The 'toChars' overloads for integral types write the decimal text of the
+// value, preceded by '-' if the value is negative, with no leading zeros (so
+// that 0 is written as "0").  Digits are written two at a time from a table of
+// the 100 two-digit strings, which does half as many divisions as writing one
+// digit at a time, and avoids the parsing of a format string and the locale
+// handling that 'sprintf' and 'bsl::ostream' perform.  Types other than those
+// for which an overload is provided (e.g., 'short') are converted to 'int'
+// (or 'unsigned int') by the usual promotion rules.
+//
+///Shortest Round-Trip Floating-Point Text
+///---------------------------------------
+// The 'toChars' overloads for 'double' and 'float' write the *shortest*
+// decimal text that converts back (e.g., using 'strtod', or
+// 'bdlb::NumericParseUtil::parseDouble') to exactly the value that was
+// written.  When several decimal values of that length would round-trip, the
+// one closest to the binary value is written.  For example, the 'double'
+// value nearest to 0.3 is written as "0.3" (and not as "0.29999999999999999",
+// which is what '%.17g' produces), while the 'double' value '0.1 + 0.2' is
+// written as "0.30000000000000004" because no shorter text converts back to
+// that value.
+//
+// Printing with a fixed number of significant digits forces a choice between
+// text that does not round-trip ('%.15g') and text that is needlessly long and
+// shows representation error ('%.17g').  The shortest round-trip text has
+// neither problem, and the digits are computed entirely in integer arithmetic
+// (using the Ryu algorithm of Ulf Adams), which is several times faster than
+// formatting the same value with 'sprintf'.
+//
+// The notation of the written text is the one that 'printf' uses for the
+// '%.17g' (for 'double') or '%.9g' (for 'float') conversion: the value is
+// written in fixed notation unless its decimal exponent is less than -4 or not
+// less than 17 (respectively 9), in which case it is written in scientific
+// notation with an exponent of at least two digits.  Trailing zeros and a
+// trailing decimal point are never written.  For example:
+//..
+//  Value                    Text
+//  ----------------------   ---------------------------
+//  0.0                      "0"
+//  -1.5                     "-1.5"
+//  123456.0                 "123456"
+//  0.0001                   "0.0001"
+//  0.00001                  "1e-05"
+//  1e22                     "1e+22"
+//  DBL_MAX                  "1.7976931348623157e+308"
+//..
+// Infinities are written as "inf" and "-inf", and NaN values as "nan" or
+// "-nan"; callers producing a specific text format typically handle these
+// values before calling 'toChars'.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Writing a 'double' Without Loss of Precision
+///- - - - - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose we are writing numeric data to a text format that is consumed by
+// another process, and we want the other process to recover exactly the
+// values we hold, using as few characters as possible.
+//
+// First, we define a buffer large enough for any 'double':
+//..
+//  char buffer[bdlb::NumericFormatUtil::k_DOUBLE_MAX_STRLEN];
+//..
+// Then, we write a value that is not exactly representable in binary:
+//..
+//  const double value = 0.1;
+//
+//  char *end = bdlb::NumericFormatUtil::toChars(buffer,
+//                                               buffer + sizeof buffer,
+//                                               value);
+//  assert(end);
+//  assert("0.1" == bsl::string(buffer, end));
+//..
+// Finally, we verify that the text converts back to the same value:
+//..
+//  double            parsed;
+//  bslstl::StringRef input(buffer, end - buffer);
+//
+//  assert(0     == bdlb::NumericParseUtil::parseDouble(&parsed, input));
+//  assert(value == parsed);
+//..
+//
+///Example 2: Appending an Integer to a String
+///- - - - - - - - - - - - - - - - - - - - - -
+// Suppose we want to append the decimal text of a 64-bit integer to a string
+// without the overhead of a stream.
+//
+// First, we write the value into a buffer large enough for any 64-bit
+// integer:
+//..
+//  const bsls::Types::Int64 count = -1234567890123LL;
+//
+//  char  digits[bdlb::NumericFormatUtil::k_INT64_MAX_STRLEN];
+//  char *digitsEnd = bdlb::NumericFormatUtil::toChars(digits,
+//                                                     digits + sizeof digits,
+//                                                     count);
+//..
+// Then, we append the text to the string:
+//..
+//  bsl::string message("count=");
+//  message.append(digits, digitsEnd);
+//
+//  assert("count=-1234567890123" == message);
+//..
+
+#include <bdlscm_version.h>
+
+#include <bsls_types.h>
+
+namespace BloombergLP {
+namespace bdlb {
+
+                          // ========================
+                          // struct NumericFormatUtil
+                          // ========================
+
+struct NumericFormatUtil {
+    // This 'struct' provides a namespace for a suite of stateless procedures
+    // that write the text representations of numeric values.
+
+    // TYPES
+    enum {
+        k_DOUBLE_MAX_STRLEN = 24,  // maximum length of the text written for a
+                                   // 'double'
+
+        k_FLOAT_MAX_STRLEN  = 15,  // maximum length of the text written for a
+                                   // 'float'
+
+        k_INT_MAX_STRLEN    = 11,  // maximum length of the text written for an
+                                   // 'int' or 'unsigned int'
+
+        k_INT64_MAX_STRLEN  = 20   // maximum length of the text written for
+                                   // any integral type
+    };
+
+    // CLASS METHODS
+    static char *toChars(char *first, char *last, double value);
+    static char *toChars(char *first, char *last, float  value);
+        // Write the shortest text that round-trips to the specified 'value'
+        // (see {Shortest Round-Trip Floating-Point Text}) into the range
+        // starting at the specified 'first' and ending before the specified
+        // 'last'.  Return a pointer one past the last character written if
+        // the range is large enough to hold the text, and 0 (with the
+        // contents of the range unspecified) otherwise.  The text is not
+        // null-terminated.  The behavior is undefined unless 'first <= last'.
+        // Note that a range of 'k_DOUBLE_MAX_STRLEN' (respectively
+        // 'k_FLOAT_MAX_STRLEN') characters is large enough for any value.
+
+    static char *toChars(char *first, char *last, int                 value);
+    static char *toChars(char *first, char *last, unsigned int        value);
+    static char *toChars(char *first, char *last, long                value);
+    static char *toChars(char *first, char *last, unsigned long       value);
+    static char *toChars(char *first, char *last, bsls::Types::Int64  value);
+    static char *toChars(char *first, char *last, bsls::Types::Uint64 value);
+        // Write the decimal text of the specified 'value' (see {Integer Text})
+        // into the range starting at the specified 'first' and ending before
+        // the specified 'last'.  Return a pointer one past the last character
+        // written if the range is large enough to hold the text, and 0 (with
+        // the contents of the range unspecified) otherwise.  The text is not
+        // null-terminated.  The behavior is undefined unless 'first <= last'.
+        // Note that a range of 'k_INT_MAX_STRLEN' characters is large enough
+        // for any 'int' or 'unsigned int' value, and a range of
+        // 'k_INT64_MAX_STRLEN' characters is large enough for any value.
+};
+
+// ============================================================================
+//                        INLINE FUNCTION DEFINITIONS
+// ============================================================================
+
+                          // ------------------------
+                          // struct NumericFormatUtil
+                          // ------------------------
+
+// CLASS METHODS
+inline
+char *NumericFormatUtil::toChars(char *first, char *last, long value)
+{
+    return toChars(first, last, static_cast<bsls::Types::Int64>(value));
+}
+
+inline
+char *NumericFormatUtil::toChars(char *first, char *last, unsigned long value)
+{
+    return toChars(first, last, static_cast<bsls::Types::Uint64>(value));
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
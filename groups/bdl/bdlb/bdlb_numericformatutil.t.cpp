@@ -0,0 +1,942 @@
+// bdlb_numericformatutil.t.cpp                                       -*-C++-*-
+#include <bdlb_numericformatutil.h>
+
+#include <bdlb_numericparseutil.h>
+
+#include <bslim_testutil.h>
+
+#include <bsls_asserttest.h>
+#include <bsls_review.h>
+#include <bsls_stopwatch.h>
+#include <bsls_types.h>
+
+#include <bsl_cfloat.h>
+#include <bsl_cstdio.h>
+#include <bsl_cstdlib.h>
+#include <bsl_cstring.h>
+#include <bsl_iostream.h>
+#include <bsl_limits.h>
+#include <bsl_string.h>
+#include <bsl_vector.h>
+
+using namespace BloombergLP;
+using namespace bsl;
+
+// ============================================================================
+//                             TEST PLAN
+// ----------------------------------------------------------------------------
+//                              Overview
+//                              --------
+// The component under test provides stateless functions that write the text
+// representations of floating-point values.  The written text is verified
+// against tables of expected text for values chosen to exercise the notation
+// boundaries, the extremes of each type, and values whose shortest
+// representation is difficult to find.  The defining properties of the text
+// (that it converts back to the written value, and that no text with fewer
+// significant digits does) are verified for a large number of pseudo-random
+// values using the (independently tested) 'strtod' and 'sprintf' functions.
+// ----------------------------------------------------------------------------
+// CLASS METHODS
+// [2] char *toChars(char *first, char *last, double value);
+// [3] char *toChars(char *first, char *last, float value);
+// [4] char *toChars(char *first, char *last, int value);
+// [4] char *toChars(char *first, char *last, unsigned int value);
+// [4] char *toChars(char *first, char *last, long value);
+// [4] char *toChars(char *first, char *last, unsigned long value);
+// [4] char *toChars(char *first, char *last, Int64 value);
+// [4] char *toChars(char *first, char *last, Uint64 value);
+// ----------------------------------------------------------------------------
+// [1] BREATHING TEST
+// [5] ROUND-TRIP AND SHORTEST PROPERTIES
+// [6] USAGE EXAMPLE
+// [-1] PERFORMANCE: 'toChars' VS. 'sprintf'
+// [-2] PERFORMANCE: INTEGRAL 'toChars' VS. 'sprintf'
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLIM_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLIM_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLIM_TESTUTIL_LOOP6_ASSERT
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_SAFE_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_PASS(EXPR)
+#define ASSERT_SAFE_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_FAIL(EXPR)
+#define ASSERT_PASS(EXPR)      BSLS_ASSERTTEST_ASSERT_PASS(EXPR)
+#define ASSERT_FAIL(EXPR)      BSLS_ASSERTTEST_ASSERT_FAIL(EXPR)
+#define ASSERT_OPT_PASS(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_PASS(EXPR)
+#define ASSERT_OPT_FAIL(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_FAIL(EXPR)
+
+// ============================================================================
+//                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef bdlb::NumericFormatUtil Util;
+typedef bsls::Types::Int64      Int64;
+typedef bsls::Types::Uint64     Uint64;
+
+// ============================================================================
+//                  GLOBAL HELPER FUNCTIONS FOR TESTING
+// ----------------------------------------------------------------------------
+
+static
+Uint64 nextRandom(Uint64 *state)
+    // Advance the specified 64-bit linear congruential generator 'state' and
+    // return its new value.
+{
+    *state = *state * 6364136223846793005ULL + 1442695040888963407ULL;
+    return *state;
+}
+
+static
+int countSignificantDigits(const char *text)
+    // Return the number of significant decimal digits in the specified
+    // null-terminated floating-point 'text'.
+{
+    int  count     = 0;
+    int  zeros     = 0;
+    bool isLeading = true;
+
+    for (; *text && 'e' != *text; ++text) {
+        if ('0' == *text) {
+            if (!isLeading) {
+                ++zeros;
+            }
+        }
+        else if ('1' <= *text && *text <= '9') {
+            count    += zeros + 1;
+            zeros     = 0;
+            isLeading = false;
+        }
+    }
+    return count;
+}
+
+static
+bsl::string asString(const char *first, const char *end)
+    // Return the characters in the range starting at the specified 'first'
+    // and ending before the specified 'end', or "(null)" if 'end' is 0.
+{
+    return end ? bsl::string(first, end) : bsl::string("(null)");
+}
+
+template <class TYPE>
+TYPE parseValue(const char *text);
+    // Return the value of the parameterized 'TYPE' nearest to the specified
+    // 'text'.
+
+template <>
+double parseValue<double>(const char *text)
+{
+    return strtod(text, 0);
+}
+
+template <>
+float parseValue<float>(const char *text)
+{
+    return strtof(text, 0);
+}
+
+template <class TYPE>
+void verifyProperties(int line, TYPE value)
+    // Verify that the text written by 'toChars' for the specified 'value'
+    // converts back to 'value', and that text having one fewer significant
+    // digit does not.  Use the specified 'line' to report failures.
+{
+    char  buffer[32];
+    char *end = Util::toChars(buffer, buffer + sizeof buffer, value);
+
+    ASSERTV(line, end);
+    if (!end) {
+        return;                                                       // RETURN
+    }
+    *end = '\0';
+
+    const TYPE parsed = parseValue<TYPE>(buffer);
+    ASSERTV(line, buffer, 0 == memcmp(&parsed, &value, sizeof value));
+
+    const int numDigits = countSignificantDigits(buffer);
+
+    if (numDigits > 1) {
+        char shorter[32];
+        sprintf(shorter, "%.*e", numDigits - 2, static_cast<double>(value));
+
+        const TYPE shorterParsed = parseValue<TYPE>(shorter);
+        ASSERTV(line, buffer, shorter, shorterParsed != value);
+    }
+}
+
+// ============================================================================
+//                            MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int  test            = argc > 1 ? bsl::atoi(argv[1]) : 0;
+    bool verbose         = argc > 2;
+    bool veryVerbose     = argc > 3;
+
+    // CONCERN: 'BSLS_REVIEW' failures should lead to test failures.
+    bsls::ReviewFailureHandlerGuard reviewGuard(&bsls::Review::failByAbort);
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+    switch (test)  { case 0:
+      case 6: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "USAGE EXAMPLE" << endl
+                          << "=============" << endl;
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Writing a 'double' Without Loss of Precision
+///- - - - - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose we are writing numeric data to a text format that is consumed by
+// another process, and we want the other process to recover exactly the
+// values we hold, using as few characters as possible.
+//
+// First, we define a buffer large enough for any 'double':
+//..
+    char buffer[bdlb::NumericFormatUtil::k_DOUBLE_MAX_STRLEN];
+//..
+// Then, we write a value that is not exactly representable in binary:
+//..
+    const double value = 0.1;
+
+    char *end = bdlb::NumericFormatUtil::toChars(buffer,
+                                                 buffer + sizeof buffer,
+                                                 value);
+    ASSERT(end);
+    ASSERT("0.1" == bsl::string(buffer, end));
+//..
+// Finally, we verify that the text converts back to the same value:
+//..
+    double            parsed;
+    bslstl::StringRef input(buffer, end - buffer);
+
+    ASSERT(0     == bdlb::NumericParseUtil::parseDouble(&parsed, input));
+    ASSERT(value == parsed);
+//..
+//
+///Example 2: Appending an Integer to a String
+///- - - - - - - - - - - - - - - - - - - - - -
+// Suppose we want to append the decimal text of a 64-bit integer to a string
+// without the overhead of a stream.
+//
+// First, we write the value into a buffer large enough for any 64-bit
+// integer:
+//..
+    const bsls::Types::Int64 count = -1234567890123LL;
+
+    char  digits[bdlb::NumericFormatUtil::k_INT64_MAX_STRLEN];
+    char *digitsEnd = bdlb::NumericFormatUtil::toChars(digits,
+                                                       digits + sizeof digits,
+                                                       count);
+//..
+// Then, we append the text to the string:
+//..
+    bsl::string message("count=");
+    message.append(digits, digitsEnd);
+
+    ASSERT("count=-1234567890123" == message);
+//..
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // ROUND-TRIP AND SHORTEST PROPERTIES
+        //
+        // Concerns:
+        //: 1 The text written for any finite value converts back to exactly
+        //:   that value.
+        //:
+        //: 2 No text with fewer significant digits converts back to the
+        //:   value.
+        //
+        // Plan:
+        //: 1 For a large number of 'double' and 'float' values, obtained from
+        //:   pseudo-random bit patterns, pseudo-random ratios, and
+        //:   pseudo-random decimal fractions, write the value with 'toChars',
+        //:   convert the text back with 'strtod' (or 'strtof'), and verify
+        //:   the result is the original value.  Write the value with one
+        //:   fewer significant digit using 'sprintf', and verify that text
+        //:   does not convert back to the value.  (C-1..2)
+        //
+        // Testing:
+        //   ROUND-TRIP AND SHORTEST PROPERTIES
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "ROUND-TRIP AND SHORTEST PROPERTIES" << endl
+                          << "==================================" << endl;
+
+        const int NUM_VALUES = 200000;
+
+        Uint64 state = 0x2545F4914F6CDD1DULL;
+
+        if (verbose) cout << "\nTesting 'double' values." << endl;
+
+        for (int i = 0; i < NUM_VALUES; ++i) {
+            const Uint64 r = nextRandom(&state);
+            double       value;
+
+            switch (i % 3) {
+              case 0: {
+                memcpy(&value, &r, sizeof value);
+                if (value != value || value - value != 0) {
+                    continue;  // skip NaN and infinity
+                }
+              } break;
+              case 1: {
+                value = static_cast<double>(r >> 20)
+                      / static_cast<double>((r & 0xFFFFF) + 1);
+              } break;
+              default: {
+                value = static_cast<double>(r % 100000000) * 1e-6;
+              } break;
+            }
+
+            verifyProperties(L_, value);
+        }
+
+        if (verbose) cout << "\nTesting 'float' values." << endl;
+
+        for (int i = 0; i < NUM_VALUES; ++i) {
+            const Uint64       r    = nextRandom(&state);
+            const unsigned int bits = static_cast<unsigned int>(r >> 32);
+            float              value;
+
+            memcpy(&value, &bits, sizeof value);
+            if (value != value || value - value != 0) {
+                continue;  // skip NaN and infinity
+            }
+
+            verifyProperties(L_, value);
+        }
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // 'toChars' FOR INTEGRAL TYPES
+        //
+        // Concerns:
+        //: 1 The decimal text of the value is written, with a leading '-' for
+        //:   negative values and no leading zeros.
+        //:
+        //: 2 The minimum and maximum values of each type, and values at every
+        //:   power of 10, are written correctly.
+        //:
+        //: 3 The 'long' and 'unsigned long' overloads forward to the overloads
+        //:   of the same width.
+        //:
+        //: 4 The returned pointer is one past the last character written, and
+        //:   0 is returned if and only if the range is too small.
+        //:
+        //: 5 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 For each value in a set of values including the limits of each
+        //:   type, each power of 10 and its neighbors, and pseudo-random
+        //:   values, compare the text written by every applicable overload
+        //:   with the text written by 'sprintf'.  (C-1..3)
+        //:
+        //: 2 For each value, write the value into ranges of every length from
+        //:   0 to one more than the expected length, and verify the returned
+        //:   pointer.  (C-4)
+        //:
+        //: 3 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for invalid ranges.  (C-5)
+        //
+        // Testing:
+        //   char *toChars(char *first, char *last, int value);
+        //   char *toChars(char *first, char *last, unsigned int value);
+        //   char *toChars(char *first, char *last, long value);
+        //   char *toChars(char *first, char *last, unsigned long value);
+        //   char *toChars(char *first, char *last, Int64 value);
+        //   char *toChars(char *first, char *last, Uint64 value);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "'toChars' FOR INTEGRAL TYPES" << endl
+                          << "============================" << endl;
+
+        bsl::vector<Uint64> values;
+
+        values.push_back(0);
+        values.push_back(0xFFFFFFFFULL);
+        values.push_back(0x7FFFFFFFULL);
+        values.push_back(0x80000000ULL);
+        values.push_back(0x7FFFFFFFFFFFFFFFULL);
+        values.push_back(0x8000000000000000ULL);
+        values.push_back(0xFFFFFFFFFFFFFFFFULL);
+
+        for (Uint64 power = 1; power <= 10000000000000000000ULL; power *= 10) {
+            values.push_back(power - 1);
+            values.push_back(power);
+            values.push_back(power + 1);
+            if (power == 10000000000000000000ULL) {
+                break;
+            }
+        }
+
+        Uint64 state = 0x2545F4914F6CDD1DULL;
+        for (int i = 0; i < 10000; ++i) {
+            const Uint64 r = nextRandom(&state);
+            values.push_back(r >> (r % 64));
+        }
+
+        for (bsl::size_t vi = 0; vi < values.size(); ++vi) {
+            const Uint64 VALUE = values[vi];
+
+            char buffer[Util::k_INT64_MAX_STRLEN + 1];
+            char exp[32];
+
+            if (veryVerbose) { T_ P(VALUE) }
+
+            // 'Uint64' and 'Int64'
+
+            sprintf(exp, "%llu", static_cast<unsigned long long>(VALUE));
+            char *end = Util::toChars(buffer, buffer + sizeof buffer, VALUE);
+            ASSERTV(VALUE, exp, asString(buffer, end) == exp);
+
+            const Int64 SVALUE = static_cast<Int64>(VALUE);
+            sprintf(exp, "%lld", static_cast<long long>(SVALUE));
+            end = Util::toChars(buffer, buffer + sizeof buffer, SVALUE);
+            ASSERTV(VALUE, exp, asString(buffer, end) == exp);
+
+            const int LEN = static_cast<int>(bsl::strlen(exp));
+            for (int length = 0; length <= LEN + 1; ++length) {
+                char *result = Util::toChars(buffer, buffer + length, SVALUE);
+
+                if (length < LEN) {
+                    ASSERTV(VALUE, length, 0 == result);
+                }
+                else {
+                    ASSERTV(VALUE, length, buffer + LEN == result);
+                }
+            }
+
+            // 'long' and 'unsigned long'
+
+            const long LVALUE = static_cast<long>(VALUE);
+            sprintf(exp, "%ld", LVALUE);
+            end = Util::toChars(buffer, buffer + sizeof buffer, LVALUE);
+            ASSERTV(VALUE, exp, asString(buffer, end) == exp);
+
+            const unsigned long ULVALUE = static_cast<unsigned long>(VALUE);
+            sprintf(exp, "%lu", ULVALUE);
+            end = Util::toChars(buffer, buffer + sizeof buffer, ULVALUE);
+            ASSERTV(VALUE, exp, asString(buffer, end) == exp);
+
+            // 'int' and 'unsigned int'
+
+            const int IVALUE = static_cast<int>(VALUE);
+            sprintf(exp, "%d", IVALUE);
+            end = Util::toChars(buffer,
+                                buffer + Util::k_INT_MAX_STRLEN,
+                                IVALUE);
+            ASSERTV(VALUE, exp, asString(buffer, end) == exp);
+
+            const unsigned int UVALUE = static_cast<unsigned int>(VALUE);
+            sprintf(exp, "%u", UVALUE);
+            end = Util::toChars(buffer,
+                                buffer + Util::k_INT_MAX_STRLEN,
+                                UVALUE);
+            ASSERTV(VALUE, exp, asString(buffer, end) == exp);
+        }
+
+        if (verbose) cout << "\nNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            char buffer[Util::k_INT64_MAX_STRLEN];
+
+            ASSERT_PASS(Util::toChars(buffer, buffer,     1));
+            ASSERT_FAIL(Util::toChars(buffer, buffer - 1, 1));
+            ASSERT_PASS(Util::toChars(buffer, buffer,     1u));
+            ASSERT_FAIL(Util::toChars(buffer, buffer - 1, 1u));
+            ASSERT_PASS(Util::toChars(buffer, buffer,     Int64(1)));
+            ASSERT_FAIL(Util::toChars(buffer, buffer - 1, Int64(1)));
+            ASSERT_PASS(Util::toChars(buffer, buffer,     Uint64(1)));
+            ASSERT_FAIL(Util::toChars(buffer, buffer - 1, Uint64(1)));
+        }
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // 'toChars' FOR 'float'
+        //
+        // Concerns:
+        //: 1 The shortest round-trip digits are written, in the notation of
+        //:   the '%.9g' 'printf' conversion.
+        //:
+        //: 2 Zeros, subnormal values, extreme values, infinities, and NaNs
+        //:   are written as documented.
+        //:
+        //: 3 The returned pointer is one past the last character written, and
+        //:   0 is returned if and only if the range is too small.
+        //:
+        //: 4 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 Using the table-driven technique, write each value in a table of
+        //:   values and expected text, and verify the text.  (C-1..2)
+        //:
+        //: 2 For each value in the table, write the value into ranges of every
+        //:   length from 0 to one more than the expected length, and verify
+        //:   the returned pointer.  (C-3)
+        //:
+        //: 3 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for invalid ranges.  (C-4)
+        //
+        // Testing:
+        //   char *toChars(char *first, char *last, float value);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "'toChars' FOR 'float'" << endl
+                          << "=====================" << endl;
+
+        const float INF = bsl::numeric_limits<float>::infinity();
+        const float NaN = bsl::numeric_limits<float>::quiet_NaN();
+
+        static const struct {
+            int         d_line;   // source line number
+            float       d_value;  // value to write
+            const char *d_exp;    // expected text
+        } DATA[] = {
+            //LINE  VALUE               EXPECTED
+            //----  ------------------  ----------------
+            { L_,   0.0f,               "0"              },
+            { L_,   -0.0f,              "-0"             },
+            { L_,   1.0f,               "1"              },
+            { L_,   -1.5f,              "-1.5"           },
+            { L_,   0.1f,               "0.1"            },
+            { L_,   0.3f,               "0.3"            },
+            { L_,   3.1415927f,         "3.1415927"      },
+            { L_,   16777216.0f,        "16777216"       },
+            { L_,   123456789.0f,       "123456790"      },
+            { L_,   1e9f,               "1e+09"          },
+            { L_,   1.5e10f,            "1.5e+10"        },
+            { L_,   0.0001f,            "0.0001"         },
+            { L_,   0.00001f,           "1e-05"          },
+            { L_,   FLT_MAX,            "3.4028235e+38"  },
+            { L_,   -FLT_MAX,           "-3.4028235e+38" },
+            { L_,   FLT_MIN,            "1.1754944e-38"  },
+            { L_,   1.4e-45f,           "1e-45"          },
+            { L_,   INF,                "inf"            },
+            { L_,   -INF,               "-inf"           },
+            { L_,   NaN,                "nan"            },
+        };
+        const int NUM_DATA = static_cast<int>(sizeof DATA / sizeof *DATA);
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int          LINE  = DATA[ti].d_line;
+            const float        VALUE = DATA[ti].d_value;
+            const bsl::string  EXP   = DATA[ti].d_exp;
+            const int          LEN   = static_cast<int>(EXP.length());
+
+            char        buffer[Util::k_FLOAT_MAX_STRLEN + 1];
+            char       *end = Util::toChars(buffer,
+                                            buffer + sizeof buffer,
+                                            VALUE);
+
+            if (veryVerbose) { T_ P_(LINE) P_(VALUE) P(EXP) }
+
+            ASSERTV(LINE, end);
+            if (end) {
+                ASSERTV(LINE, EXP, bsl::string(buffer, end),
+                        EXP == bsl::string(buffer, end));
+            }
+
+            for (int length = 0; length <= LEN + 1; ++length) {
+                char *result = Util::toChars(buffer, buffer + length, VALUE);
+
+                if (length < LEN) {
+                    ASSERTV(LINE, length, 0 == result);
+                }
+                else {
+                    ASSERTV(LINE, length, buffer + LEN == result);
+                }
+            }
+        }
+
+        if (verbose) cout << "\nNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            char buffer[Util::k_FLOAT_MAX_STRLEN];
+
+            ASSERT_PASS(Util::toChars(buffer, buffer,     1.0f));
+            ASSERT_FAIL(Util::toChars(buffer, buffer - 1, 1.0f));
+        }
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // 'toChars' FOR 'double'
+        //
+        // Concerns:
+        //: 1 The shortest round-trip digits are written, in the notation of
+        //:   the '%.17g' 'printf' conversion.
+        //:
+        //: 2 When several shortest candidates round-trip, the one closest to
+        //:   the binary value is written.
+        //:
+        //: 3 Zeros, subnormal values, extreme values, infinities, and NaNs
+        //:   are written as documented.
+        //:
+        //: 4 The returned pointer is one past the last character written, and
+        //:   0 is returned if and only if the range is too small.
+        //:
+        //: 5 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 Using the table-driven technique, write each value in a table of
+        //:   values and expected text, and verify the text.  (C-1..3)
+        //:
+        //: 2 For each value in the table, write the value into ranges of every
+        //:   length from 0 to one more than the expected length, and verify
+        //:   the returned pointer.  (C-4)
+        //:
+        //: 3 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for invalid ranges.  (C-5)
+        //
+        // Testing:
+        //   char *toChars(char *first, char *last, double value);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "'toChars' FOR 'double'" << endl
+                          << "======================" << endl;
+
+        const double INF = bsl::numeric_limits<double>::infinity();
+        const double NaN = bsl::numeric_limits<double>::quiet_NaN();
+
+        static const struct {
+            int         d_line;   // source line number
+            double      d_value;  // value to write
+            const char *d_exp;    // expected text
+        } DATA[] = {
+            //LINE  VALUE                     EXPECTED
+            //----  ------------------------  -------------------------
+            { L_,   0.0,                      "0"                       },
+            { L_,   -0.0,                     "-0"                      },
+            { L_,   1.0,                      "1"                       },
+            { L_,   -1.5,                     "-1.5"                    },
+            { L_,   10.0,                     "10"                      },
+            { L_,   123456.0,                 "123456"                  },
+            { L_,   0.1,                      "0.1"                     },
+            { L_,   0.3,                      "0.3"                     },
+            { L_,   0.1 + 0.2,                "0.30000000000000004"     },
+            { L_,   1.0 / 3,                  "0.3333333333333333"      },
+            { L_,   2.0 / 3,                  "0.6666666666666666"      },
+            { L_,   3.141592653589793,        "3.141592653589793"       },
+            { L_,   9007199254740993.0,       "9007199254740992"        },
+            { L_,   1e16,                     "10000000000000000"       },
+            { L_,   1.2345678901234567e16,    "12345678901234568"       },
+            { L_,   1e17,                     "1e+17"                   },
+            { L_,   1e22,                     "1e+22"                   },
+            { L_,   1e23,                     "1e+23"                   },
+            { L_,   0.0001,                   "0.0001"                  },
+            { L_,   0.000123,                 "0.000123"                },
+            { L_,   0.00001,                  "1e-05"                   },
+            { L_,   1.5e-100,                 "1.5e-100"                },
+            { L_,   1e100,                    "1e+100"                  },
+            { L_,   DBL_MAX,                  "1.7976931348623157e+308" },
+            { L_,   -DBL_MAX,                 "-1.7976931348623157e+308"},
+            { L_,   DBL_MIN,                  "2.2250738585072014e-308" },
+            { L_,   DBL_MIN / 2,              "1.1125369292536007e-308" },
+            { L_,   4.9406564584124654e-324,  "5e-324"                  },
+            { L_,   -4.9406564584124654e-324, "-5e-324"                 },
+            { L_,   INF,                      "inf"                     },
+            { L_,   -INF,                     "-inf"                    },
+            { L_,   NaN,                      "nan"                     },
+        };
+        const int NUM_DATA = static_cast<int>(sizeof DATA / sizeof *DATA);
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int          LINE  = DATA[ti].d_line;
+            const double       VALUE = DATA[ti].d_value;
+            const bsl::string  EXP   = DATA[ti].d_exp;
+            const int          LEN   = static_cast<int>(EXP.length());
+
+            char        buffer[Util::k_DOUBLE_MAX_STRLEN + 1];
+            char       *end = Util::toChars(buffer,
+                                            buffer + sizeof buffer,
+                                            VALUE);
+
+            if (veryVerbose) { T_ P_(LINE) P_(VALUE) P(EXP) }
+
+            ASSERTV(LINE, end);
+            if (end) {
+                ASSERTV(LINE, EXP, bsl::string(buffer, end),
+                        EXP == bsl::string(buffer, end));
+            }
+
+            for (int length = 0; length <= LEN + 1; ++length) {
+                char *result = Util::toChars(buffer, buffer + length, VALUE);
+
+                if (length < LEN) {
+                    ASSERTV(LINE, length, 0 == result);
+                }
+                else {
+                    ASSERTV(LINE, length, buffer + LEN == result);
+                }
+            }
+        }
+
+        if (verbose) cout << "\nNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            char buffer[Util::k_DOUBLE_MAX_STRLEN];
+
+            ASSERT_PASS(Util::toChars(buffer, buffer,     1.0));
+            ASSERT_FAIL(Util::toChars(buffer, buffer - 1, 1.0));
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Write a few values of each type and verify the text.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        char  buffer[Util::k_DOUBLE_MAX_STRLEN];
+        char *end;
+
+        end = Util::toChars(buffer, buffer + sizeof buffer, 2.5);
+        ASSERT(end && "2.5" == bsl::string(buffer, end));
+
+        end = Util::toChars(buffer, buffer + sizeof buffer, -1e-7);
+        ASSERT(end && "-1e-07" == bsl::string(buffer, end));
+
+        end = Util::toChars(buffer, buffer + sizeof buffer, 0.2f);
+        ASSERT(end && "0.2" == bsl::string(buffer, end));
+
+        end = Util::toChars(buffer, buffer + 2, 123.0);
+        ASSERT(0 == end);
+      } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE: 'toChars' VS. 'sprintf'
+        //   Report the time taken, in nanoseconds per value, to write
+        //   'double' values with 'toChars' and with 'sprintf' using the
+        //   '%.17g' (round-trip) and '%.15g' conversions.
+        //
+        // Testing:
+        //   PERFORMANCE: 'toChars' VS. 'sprintf'
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "PERFORMANCE: 'toChars' VS. 'sprintf'" << endl
+                          << "====================================" << endl;
+
+        const int NUM_VALUES     = 1024;
+        const int NUM_ITERATIONS = argc > 2 ? bsl::atoi(argv[2]) : 1000;
+
+        double values[NUM_VALUES];
+        Uint64 state = 0x2545F4914F6CDD1DULL;
+
+        for (int i = 0; i < NUM_VALUES; ++i) {
+            const Uint64 r = nextRandom(&state);
+
+            values[i] = i % 2 ? static_cast<double>(r % 10000000) / 100
+                              : static_cast<double>(r >> 11)
+                                / static_cast<double>((r & 0x7FF) + 1);
+        }
+
+        const double count = static_cast<double>(NUM_VALUES)
+                                                              * NUM_ITERATIONS;
+
+        char            buffer[32];
+        Uint64          checksum = 0;
+        bsls::Stopwatch timer;
+
+        timer.start();
+        for (int iter = 0; iter < NUM_ITERATIONS; ++iter) {
+            for (int i = 0; i < NUM_VALUES; ++i) {
+                checksum += Util::toChars(buffer,
+                                          buffer + sizeof buffer,
+                                          values[i]) - buffer;
+            }
+        }
+        timer.stop();
+        cout << "toChars:      "
+             << timer.accumulatedWallTime() * 1e9 / count << " ns/value\n";
+
+        static const char *const FORMATS[] = { "%.17g", "%.15g" };
+
+        for (int fi = 0; fi < 2; ++fi) {
+            timer.reset();
+            timer.start();
+            for (int iter = 0; iter < NUM_ITERATIONS; ++iter) {
+                for (int i = 0; i < NUM_VALUES; ++i) {
+                    checksum += sprintf(buffer, FORMATS[fi], values[i]);
+                }
+            }
+            timer.stop();
+            cout << "sprintf " << FORMATS[fi] << ": "
+                 << timer.accumulatedWallTime() * 1e9 / count
+                 << " ns/value\n";
+        }
+
+        ASSERT(0 != checksum);
+      } break;
+      case -2: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE: INTEGRAL 'toChars' VS. 'sprintf'
+        //   Report the time taken, in nanoseconds per value, to write 'Int64'
+        //   values of various lengths with 'toChars' and with 'sprintf'.
+        //
+        // Testing:
+        //   PERFORMANCE: INTEGRAL 'toChars' VS. 'sprintf'
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "PERFORMANCE: INTEGRAL 'toChars' VS. 'sprintf'"
+                          << endl
+                          << "============================================="
+                          << endl;
+
+        const int NUM_VALUES     = 1024;
+        const int NUM_ITERATIONS = argc > 2 ? bsl::atoi(argv[2]) : 1000;
+
+        Int64  values[NUM_VALUES];
+        Uint64 state = 0x2545F4914F6CDD1DULL;
+
+        for (int i = 0; i < NUM_VALUES; ++i) {
+            const Uint64 r = nextRandom(&state);
+
+            values[i] = static_cast<Int64>(r >> (r % 60));
+        }
+
+        const double count = static_cast<double>(NUM_VALUES)
+                                                              * NUM_ITERATIONS;
+
+        char            buffer[32];
+        Uint64          checksum = 0;
+        bsls::Stopwatch timer;
+
+        timer.start();
+        for (int iter = 0; iter < NUM_ITERATIONS; ++iter) {
+            for (int i = 0; i < NUM_VALUES; ++i) {
+                checksum += Util::toChars(buffer,
+                                          buffer + sizeof buffer,
+                                          values[i]) - buffer;
+            }
+        }
+        timer.stop();
+        cout << "toChars: "
+             << timer.accumulatedWallTime() * 1e9 / count << " ns/value\n";
+
+        timer.reset();
+        timer.start();
+        for (int iter = 0; iter < NUM_ITERATIONS; ++iter) {
+            for (int i = 0; i < NUM_VALUES; ++i) {
+                checksum += sprintf(buffer,
+                                    "%lld",
+                                    static_cast<long long>(values[i]));
+            }
+        }
+        timer.stop();
+        cout << "sprintf: "
+             << timer.accumulatedWallTime() * 1e9 / count << " ns/value\n";
+
+        ASSERT(0 != checksum);
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      } break;
+    }
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -6,6 +6,7 @@
 #include <bslma_testallocator.h>           // for testing only
 
 #include <bsls_platform.h>
+#include <bsls_stopwatch.h>
 #include <bsls_types.h>
 
 #include <bslim_testutil.h>
@@ -72,8 +73,12 @@ using namespace bdlb;
 // [ 9] parseShort(result, input, base = 10)
 // [10] parseUshort(result, rest, input, base = 10)
 // [10] parseUshort(result, input, base = 10)
+// [11] parseDouble(double *res, StringRef *rest, StringRef in)
+// [12] parseUnsignedInteger(result, rest, in, 10, maxVal)
 //-----------------------------------------------------------------------------
-// [11] USAGE EXAMPLE
+// [13] USAGE EXAMPLE
+// [-1] PERFORMANCE: PARSE DOUBLE
+// [-2] PERFORMANCE: PARSE INTEGER
 
 // ============================================================================
 //                     STANDARD BSL ASSERT TEST FUNCTION
@@ -163,7 +168,7 @@ int main(int argc, char *argv[])
     using bslstl::StringRef;
 
     switch (test) { case 0:  // Zero is always the leading case.
-      case 11: {
+      case 13: {
         // --------------------------------------------------------------------
         // TESTING USAGE EXAMPLE
         //
@@ -209,6 +214,327 @@ int main(int argc, char *argv[])
 //..
 
       } break;
+      case 12: {
+        // --------------------------------------------------------------------
+        // TESTING DECIMAL INTEGER FAST PATH
+        //
+        // Concerns:
+        //: 1 Decimal digits are converted correctly whether they are consumed
+        //:   eight at a time or one at a time, for every alignment of the
+        //:   digits relative to the end of the input and to a non-digit
+        //:   suffix.
+        //:
+        //: 2 Characters adjacent to the digits ('/' and ':', and bytes with
+        //:   the high bit set) are not mistaken for digits.
+        //:
+        //: 3 Values near 'maxValue', values having more than 19 digits
+        //:   (including those with leading zeros), and values that overflow
+        //:   are handled as for any other base.
+        //
+        // Plan:
+        //: 1 For every number of digits from 1 to 24, and for several
+        //:   suffixes, parse pseudo-random digit strings and compare the
+        //:   result and the remainder with a value computed digit by digit.
+        //:   (C-1..2)
+        //:
+        //: 2 Using the table-driven technique, verify the results for values
+        //:   near the limits of several 'maxValue' values.  (C-3)
+        //
+        // Testing:
+        //   parseUnsignedInteger(result, rest, in, 10, maxVal)
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING DECIMAL INTEGER FAST PATH" << endl
+                          << "=================================" << endl;
+
+        if (verbose) cout << "\nTesting pseudo-random digit strings." << endl;
+        {
+            static const char *const SUFFIXES[] = {
+                "", "/", ":", "a", " 1234567", "\xB0", ".5"
+            };
+            const int NUM_SUFFIXES = static_cast<int>(sizeof SUFFIXES
+                                                      / sizeof *SUFFIXES);
+
+            const Uint64 MAX = 0xFFFFFFFFFFFFFFFFULL;
+
+            Uint64 state = 0x0123456789ABCDEFULL;
+
+            for (int numDigits = 1; numDigits <= 24; ++numDigits) {
+                for (int si = 0; si < NUM_SUFFIXES; ++si) {
+                    for (int iter = 0; iter < 200; ++iter) {
+                        state = state * 6364136223846793005ULL
+                              + 1442695040888963407ULL;
+
+                        bsl::string input;
+                        Uint64      r = state;
+                        for (int i = 0; i < numDigits; ++i) {
+                            input.push_back(static_cast<char>('0' + r % 10));
+                            r = r / 10 ? r / 10 : state >> 7;
+                        }
+                        input += SUFFIXES[si];
+
+                        // Compute the expected value and remainder, stopping
+                        // before the first digit that would overflow.
+
+                        Uint64 expValue = 0;
+                        int    expLen   = 0;
+                        while (expLen < numDigits) {
+                            const Uint64 digit = input[expLen] - '0';
+                            if (expValue > (MAX - digit) / 10) {
+                                break;
+                            }
+                            expValue = expValue * 10 + digit;
+                            ++expLen;
+                        }
+
+                        Uint64    result = 37;
+                        StringRef rest;
+                        const int rc = NumericParseUtil::parseUnsignedInteger(
+                                                                     &result,
+                                                                     &rest,
+                                                                     input,
+                                                                     10,
+                                                                     MAX);
+
+                        if (veryVerbose) { T_ P_(input) P(result) }
+
+                        ASSERTV(input, 0 == rc);
+                        ASSERTV(input, result, expValue, expValue == result);
+                        ASSERTV(input, input.data() + expLen == rest.data());
+                        ASSERTV(input,
+                                input.length() - expLen == rest.length());
+                    }
+                }
+            }
+        }
+
+        if (verbose) cout << "\nTesting values near 'maxValue'." << endl;
+        {
+            static const struct {
+                int         d_line;      // source line number
+                const char *d_input_p;   // input text
+                Uint64      d_maxValue;  // maximum value
+                int         d_rc;        // expected return code
+                Uint64      d_value;     // expected value
+                bsl::size_t d_restLen;   // expected remainder length
+            } DATA[] = {
+     //LINE INPUT                      MAX                   RC VALUE    REST
+     //---- -------------------------- --------------------- -- -------- ----
+     { L_,  "99999999",                99999999ULL,          0, 99999999ULL,
+                                                                          0 },
+     { L_,  "100000000",               99999999ULL,          0, 10000000ULL,
+                                                                          1 },
+     { L_,  "4294967295",              4294967295ULL,        0,
+                                                         4294967295ULL,   0 },
+     { L_,  "4294967296",              4294967295ULL,        0,
+                                                          429496729ULL,   1 },
+     { L_,  "9223372036854775807",     9223372036854775807ULL,
+                                                             0,
+                                                9223372036854775807ULL,   0 },
+     { L_,  "9223372036854775808",     9223372036854775807ULL,
+                                                             0,
+                                                 922337203685477580ULL,   1 },
+     { L_,  "18446744073709551615",    0xFFFFFFFFFFFFFFFFULL,
+                                                             0,
+                                                0xFFFFFFFFFFFFFFFFULL,    0 },
+     { L_,  "18446744073709551616",    0xFFFFFFFFFFFFFFFFULL,
+                                                             0,
+                                                1844674407370955161ULL,   1 },
+     { L_,  "000000000000000000000007", 0xFFFFFFFFFFFFFFFFULL,
+                                                             0, 7ULL,     0 },
+     { L_,  "12345678x",               0xFFFFFFFFFFFFFFFFULL,
+                                                             0, 12345678ULL,
+                                                                          1 },
+     { L_,  "x12345678",               0xFFFFFFFFFFFFFFFFULL,
+                                                            -2, 37ULL,    9 },
+     { L_,  "9",                       5ULL,                 0, 0ULL,     1 },
+            };
+            const int NUM_DATA = static_cast<int>(sizeof DATA / sizeof *DATA);
+
+            for (int ti = 0; ti < NUM_DATA; ++ti) {
+                const int          LINE     = DATA[ti].d_line;
+                const char        *INPUT    = DATA[ti].d_input_p;
+                const Uint64       MAX      = DATA[ti].d_maxValue;
+                const int          RC       = DATA[ti].d_rc;
+                const Uint64       VALUE    = DATA[ti].d_value;
+                const bsl::size_t  REST_LEN = DATA[ti].d_restLen;
+
+                Uint64    result = 37;
+                StringRef rest;
+                const int rc = NumericParseUtil::parseUnsignedInteger(&result,
+                                                                      &rest,
+                                                                      INPUT,
+                                                                      10,
+                                                                      MAX);
+
+                if (veryVerbose) { T_ P_(LINE) P_(INPUT) P_(rc) P(result) }
+
+                ASSERTV(LINE, rc, RC == rc);
+                ASSERTV(LINE, result, VALUE == result);
+                ASSERTV(LINE, rest.length(), REST_LEN == rest.length());
+            }
+        }
+      } break;
+      case 11: {
+        // --------------------------------------------------------------------
+        // TESTING PARSE DOUBLE AGAINST 'strtod'
+        //
+        // Concerns:
+        //: 1 Decimal text converted without calling 'strtod' yields exactly
+        //:   the value, and consumes exactly the characters, that 'strtod'
+        //:   yields and consumes.
+        //:
+        //: 2 Values that are exactly half-way between two 'double' values are
+        //:   rounded to even, and subnormal, overflowing, and underflowing
+        //:   values are handled correctly.
+        //:
+        //: 3 Text that is not handled without 'strtod' (hexadecimal text,
+        //:   infinities, NaNs, and significands of more than 19 digits) is
+        //:   still converted correctly.
+        //
+        // Plan:
+        //: 1 Using the table-driven technique, compare the result and the
+        //:   remainder of 'parseDouble' with those of 'strtod' for a set of
+        //:   difficult inputs.  (C-2..3)
+        //:
+        //: 2 Compare the result and the remainder of 'parseDouble' with those
+        //:   of 'strtod' for pseudo-random text of several shapes: '%.17g' of
+        //:   random bit patterns, random significands with 1 to 19 digits and
+        //:   random exponents, and random integers.  (C-1)
+        //
+        // Testing:
+        //   parseDouble(double *res, StringRef *rest, StringRef in)
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING PARSE DOUBLE AGAINST 'strtod'" << endl
+                          << "=====================================" << endl;
+
+        static const struct {
+            int         d_lineNum;  // source line number
+            const char *d_spec_p;   // input text
+        } DATA[] = {
+            //line  spec
+            //----  ---------------------------------------------------------
+            { L_,   "0"                                                     },
+            { L_,   "-0"                                                    },
+            { L_,   "-0.0e-999"                                             },
+            { L_,   "1.e5"                                                  },
+            { L_,   "1e+"                                                   },
+            { L_,   "1ex"                                                   },
+            { L_,   "0x10"                                                  },
+            { L_,   "-0X1.8p1"                                              },
+            { L_,   "0x"                                                    },
+            { L_,   "00x1"                                                  },
+            { L_,   "inf"                                                   },
+            { L_,   "-nan"                                                  },
+            { L_,   "0.1"                                                   },
+            { L_,   "0.3"                                                   },
+            { L_,   "9007199254740992"                                      },
+            { L_,   "9007199254740993"                                      },
+            { L_,   "9007199254740995"                                      },
+            { L_,   "9007199254740992.5"                                    },
+            { L_,   "1e23"                                                  },
+            { L_,   "8.98846567431158e307"                                  },
+            { L_,   "1.7976931348623157e308"                                },
+            { L_,   "1.7976931348623158e308"                                },
+            { L_,   "1.7976931348623159e308"                                },
+            { L_,   "1e309"                                                 },
+            { L_,   "2.2250738585072011e-308"                               },
+            { L_,   "2.2250738585072014e-308"                               },
+            { L_,   "4.9406564584124654e-324"                               },
+            { L_,   "2.4703282292062327e-324"                               },
+            { L_,   "2.4703282292062328e-324"                               },
+            { L_,   "1e-400"                                                },
+            { L_,   "1e99999999999"                                         },
+            { L_,   "1e-99999999999"                                        },
+            { L_,   "1234567890123456789"                                   },
+            { L_,   "12345678901234567890"                                  },
+            { L_,   "0.0000000000000000000000000000001234567890123456789"   },
+            { L_,   "1.00000000000000011102230246251565404236316680908203125"},
+            { L_,   "7.2057594037927933e16"                                 },
+            { L_,   "3.14159abc"                                            },
+        };
+        const int NUM_DATA = static_cast<int>(sizeof DATA / sizeof *DATA);
+
+        const double INITIAL_VALUE = 37.0;
+
+        int numRandom = 0;
+
+        for (int ti = 0; ti < NUM_DATA + 400000; ++ti) {
+            char        buffer[64];
+            const char *SPEC = buffer;
+            int         LINE = L_;
+
+            if (ti < NUM_DATA) {
+                LINE = DATA[ti].d_lineNum;
+                SPEC = DATA[ti].d_spec_p;
+            }
+            else {
+                // Generate pseudo-random text using a 64-bit LCG.
+
+                static Uint64 state = 0x0123456789ABCDEFULL;
+
+                state = state * 6364136223846793005ULL
+                      + 1442695040888963407ULL;
+                const Uint64 r = state;
+
+                switch (ti % 3) {
+                  case 0: {
+                    double value;
+                    memcpy(&value, &r, sizeof value);
+                    if (value != value) {
+                        continue;
+                    }
+                    sprintf(buffer, "%.17g", value);
+                  } break;
+                  case 1: {
+                    const int numDigits = static_cast<int>(r % 19) + 1;
+                    const int point     = static_cast<int>((r >> 8)
+                                                        % (numDigits + 1));
+                    const int exponent  = static_cast<int>((r >> 16) % 700)
+                                                                        - 350;
+                    char     *p         = buffer;
+
+                    for (int i = 0; i < numDigits; ++i) {
+                        if (i == point) {
+                            *p++ = '.';
+                        }
+                        *p++ = static_cast<char>('0' + (r >> (3 * i)) % 10);
+                    }
+                    sprintf(p, "e%d", exponent);
+                  } break;
+                  default: {
+                    sprintf(buffer, "%lld", static_cast<long long>(r >> 1));
+                  } break;
+                }
+                ++numRandom;
+            }
+
+            char         *end;
+            const double  EXP = strtod(SPEC, &end);
+
+            double    result = INITIAL_VALUE;
+            StringRef rest;
+
+            const int rc = NumericParseUtil::parseDouble(&result,
+                                                         &rest,
+                                                         StringRef(SPEC));
+
+            if (veryVerbose) { T_ P_(LINE) P_(SPEC) P(result) }
+
+            ASSERTV(LINE, SPEC, (end == SPEC) == (0 != rc));
+            if (0 == rc) {
+                ASSERTV(LINE, SPEC, end == rest.data());
+                ASSERTV(LINE, SPEC, result, EXP,
+                        0 == memcmp(&EXP, &result, sizeof result)
+                        || (EXP != EXP && result != result));
+            }
+        }
+
+        if (verbose) { P(numRandom) }
+      } break;
       case 10: {
         // --------------------------------------------------------------------
         // TESTING PARSE USHORT
@@ -2878,6 +3204,144 @@ int main(int argc, char *argv[])
             }
         }
       } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE: PARSE DOUBLE
+        //   Report the time taken, in nanoseconds per value, to convert
+        //   typical decimal text to 'double' using 'parseDouble' and using
+        //   'strtod'.
+        //
+        // Testing:
+        //   PERFORMANCE: PARSE DOUBLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "PERFORMANCE: PARSE DOUBLE" << endl
+                          << "=========================" << endl;
+
+        const int NUM_VALUES     = 1024;
+        const int NUM_ITERATIONS = 1000;
+
+        bsl::vector<bsl::string> texts;
+
+        for (int i = 0; i < NUM_VALUES; ++i) {
+            char buffer[32];
+            switch (i % 3) {
+              case 0: {
+                sprintf(buffer, "%d.%02d", i * 37, i % 100);
+              } break;
+              case 1: {
+                sprintf(buffer, "%.17g", 1.0 / (i + 3));
+              } break;
+              default: {
+                sprintf(buffer, "%.6e", (i + 1) * 12345.678);
+              } break;
+            }
+            texts.push_back(buffer);
+        }
+
+        double sum = 0;
+
+        bsls::Stopwatch timer;
+        timer.start();
+        for (int iter = 0; iter < NUM_ITERATIONS; ++iter) {
+            for (int i = 0; i < NUM_VALUES; ++i) {
+                double value;
+                NumericParseUtil::parseDouble(&value, texts[i]);
+                sum += value;
+            }
+        }
+        timer.stop();
+
+        const double parseTime = timer.accumulatedWallTime();
+
+        timer.reset();
+        timer.start();
+        for (int iter = 0; iter < NUM_ITERATIONS; ++iter) {
+            for (int i = 0; i < NUM_VALUES; ++i) {
+                sum += strtod(texts[i].c_str(), 0);
+            }
+        }
+        timer.stop();
+
+        const double strtodTime = timer.accumulatedWallTime();
+        const double count      = static_cast<double>(NUM_VALUES)
+                                                              * NUM_ITERATIONS;
+
+        cout << "parseDouble: " << parseTime  * 1e9 / count << " ns/value\n"
+             << "strtod:      " << strtodTime * 1e9 / count << " ns/value\n";
+
+        ASSERT(0 != sum);
+      } break;
+      case -2: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE: PARSE INTEGER
+        //   Report the time taken, in nanoseconds per value, to convert
+        //   decimal text of various lengths to 'Int64' using 'parseInt64' and
+        //   using 'strtoll'.
+        //
+        // Testing:
+        //   PERFORMANCE: PARSE INTEGER
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "PERFORMANCE: PARSE INTEGER" << endl
+                          << "==========================" << endl;
+
+        const int NUM_VALUES     = 1024;
+        const int NUM_ITERATIONS = 1000;
+
+        bsl::vector<bsl::string> texts;
+
+        Uint64 state = 0x0123456789ABCDEFULL;
+        for (int i = 0; i < NUM_VALUES; ++i) {
+            state = state * 6364136223846793005ULL + 1442695040888963407ULL;
+
+            static const Uint64 MODULI[] = {
+                1000ULL, 1000000ULL, 10000000000ULL, 1000000000000000000ULL
+            };
+
+            char buffer[32];
+            sprintf(buffer,
+                    "%s%lld",
+                    i % 5 ? "" : "-",
+                    static_cast<long long>((state >> 1) % MODULI[i % 4]));
+            texts.push_back(buffer);
+        }
+
+        Int64 sum = 0;
+
+        bsls::Stopwatch timer;
+        timer.start();
+        for (int iter = 0; iter < NUM_ITERATIONS; ++iter) {
+            for (int i = 0; i < NUM_VALUES; ++i) {
+                Int64 value;
+                NumericParseUtil::parseInt64(&value, texts[i]);
+                sum += value;
+            }
+        }
+        timer.stop();
+
+        const double parseTime = timer.accumulatedWallTime();
+
+        timer.reset();
+        timer.start();
+        for (int iter = 0; iter < NUM_ITERATIONS; ++iter) {
+            for (int i = 0; i < NUM_VALUES; ++i) {
+                sum += strtoll(texts[i].c_str(), 0, 10);
+            }
+        }
+        timer.stop();
+
+        const double strtollTime = timer.accumulatedWallTime();
+        const double count       = static_cast<double>(NUM_VALUES)
+                                                              * NUM_ITERATIONS;
+
+        cout << "parseInt64: " << parseTime   * 1e9 / count << " ns/value\n"
+             << "strtoll:    " << strtollTime * 1e9 / count << " ns/value\n";
+
+        ASSERT(0 != sum);
+      } break;
       default: {
         cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
         testStatus = -1;
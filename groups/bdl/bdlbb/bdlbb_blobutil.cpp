@@ -22,6 +22,7 @@ BSLS_IDENT_RCSID(bdlbb_blobutil_cpp, "$Id$ $CSID$")
 #include <bsl_algorithm.h>
 
 #include <bsl_c_ctype.h>
+#include <bsl_cstring.h>
 #include <bsl_iostream.h>
 
 namespace BloombergLP {
@@ -56,6 +57,75 @@ void copyFromPlace(char                *dstBuffer,
     } while (copied < length);
 }
 
+bool isMatchAtPlace(const bdlbb::Blob&  blob,
+                    bsl::pair<int, int>  place,
+                    const char          *pattern,
+                    int                  length)
+    // Return 'true' if the specified 'length' bytes starting at the specified
+    // 'place' in the specified 'blob' are equal to the bytes at the specified
+    // 'pattern' address, and 'false' otherwise.  The behavior is undefined
+    // unless '0 < length', 'place' represents an actual character position
+    // in 'blob', and 'blob' has at least 'length' bytes starting at 'place'.
+{
+    while (true) {
+        const bdlbb::BlobBuffer& buffer = blob.buffer(place.first);
+        const int numBytes = bsl::min(length, buffer.size() - place.second);
+
+        if (0 != bsl::memcmp(buffer.data() + place.second,
+                             pattern,
+                             numBytes)) {
+            return false;                                             // RETURN
+        }
+        length -= numBytes;
+        if (0 == length) {
+            return true;                                              // RETURN
+        }
+        pattern += numBytes;
+        ++place.first;
+        place.second = 0;
+    }
+}
+
+void splitBuffer(bdlbb::Blob *blob, int index, int offset)
+    // Replace the data buffer at the specified 'index' in the specified
+    // 'blob' by two buffers sharing its memory, the first of which holds its
+    // first 'offset' bytes, without changing the data of 'blob'.  The
+    // behavior is undefined unless '0 < offset', and the byte at 'offset' in
+    // that buffer is part of the data of 'blob'.
+{
+    const bdlbb::BlobBuffer& buffer = blob->buffer(index);
+    const int                size   = buffer.size();
+
+    // If 'buffer' is the last data buffer, removing it below removes all of
+    // its bytes from the data of 'blob', including those in its unused
+    // capacity, which must be added back.
+
+    int numBytesToAdjust = 0;
+    if (index == blob->numDataBuffers() - 1) {
+        numBytesToAdjust = size - blob->lastDataBufferLength();
+    }
+
+    bsl::shared_ptr<char> headShptr(buffer.buffer(), buffer.data());
+    bsl::shared_ptr<char> tailShptr(buffer.buffer(), buffer.data() + offset);
+
+    bdlbb::BlobBuffer head;
+    head.setSize(offset);
+    blob->insertBuffer(index, head);
+    head.buffer().swap(headShptr);
+    blob->swapBufferRaw(index, &head);
+
+    bdlbb::BlobBuffer tail;
+    tail.setSize(size - offset);
+    blob->insertBuffer(index + 1, tail);
+    tail.buffer().swap(tailShptr);
+    blob->swapBufferRaw(index + 1, &tail);
+
+    blob->removeBuffer(index + 2);
+    if (numBytesToAdjust) {
+        blob->setLength(blob->length() - numBytesToAdjust);
+    }
+}
+
 }  // close unnamed namespace
 
 namespace bdlbb {
@@ -283,16 +353,95 @@ void BlobUtil::insert(Blob        *dest,
                       int          sourceLength)
 {
     BSLS_ASSERT(0 != dest);
+    BSLS_ASSERT(0 <= destOffset);
+    BSLS_ASSERT(destOffset <= dest->length());
+    BSLS_ASSERT(0 <= sourceOffset);
+    BSLS_ASSERT(0 <= sourceLength);
+    BSLS_ASSERT(sourceOffset <= source.length() - sourceLength);
 
-    // TBD: optimize this also
+    if (0 == sourceLength) {
+        return;                                                       // RETURN
+    }
 
-    Blob result;
+    if (dest == &source) {
+        const Blob copy(source, dest->allocator());
 
-    append(&result, *dest, 0, destOffset);
-    append(&result, source, sourceOffset, sourceLength);
-    append(&result, *dest, destOffset);
+        insert(dest, destOffset, copy, sourceOffset, sourceLength);
+        return;                                                       // RETURN
+    }
+
+    if (destOffset == dest->length()) {
+        append(dest, source, sourceOffset, sourceLength);
+        return;                                                       // RETURN
+    }
+
+    // Split the buffer holding the byte at 'destOffset', if needed, so that
+    // the buffers of 'source' are inserted at a buffer boundary.
+
+    bsl::pair<int, int> destPlace = findBufferIndexAndOffset(*dest,
+                                                             destOffset);
+    int                 destIndex = destPlace.first;
+
+    if (0 < destPlace.second) {
+        splitBuffer(dest, destIndex, destPlace.second);
+        ++destIndex;
+    }
+
+    const bsl::pair<int, int> beginPlace = findBufferIndexAndOffset(
+                                                                source,
+                                                                sourceOffset);
+    const bsl::pair<int, int> endPlace   = findBufferIndexAndOffset(
+                                          source,
+                                          sourceOffset + sourceLength - 1);
 
-    *dest = result;
+    // Inserting each buffer in 'dest' would shift the buffers after it every
+    // time, so build the spliced sequence of buffers once, in a blob using
+    // the allocator of 'dest', then move it into 'dest' (which keeps its
+    // factory).  The buffers are appended as capacity buffers, and the data
+    // length is then set to cover the data of 'dest' and the inserted bytes.
+
+    const int newLength = dest->length() + sourceLength;
+
+    Blob spliced(dest->allocator());
+    spliced.reserveBufferCapacity(dest->numBuffers() +
+                                  endPlace.first - beginPlace.first + 1);
+
+    for (int i = 0; i < destIndex; ++i) {
+        spliced.appendBuffer(dest->buffer(i));
+    }
+
+    int sourceIndex        = beginPlace.first;
+    int offsetInThisBuffer = beginPlace.second;
+    int numBytesRemaining  = sourceLength;
+
+    while (0 < numBytesRemaining) {
+        BlobBuffer src = source.buffer(sourceIndex);
+
+        if (0 < offsetInThisBuffer) {
+            src.buffer().loadAlias(src.buffer(),
+                                   src.data() + offsetInThisBuffer);
+            src.setSize(src.size() - offsetInThisBuffer);
+            offsetInThisBuffer = 0;
+        }
+
+        if (src.size() > numBytesRemaining) {
+            src.setSize(numBytesRemaining);
+        }
+
+        if (0 < src.size()) {
+            spliced.appendBuffer(src);
+        }
+
+        ++sourceIndex;
+        numBytesRemaining -= src.size();
+    }
+
+    for (int i = destIndex; i < dest->numBuffers(); ++i) {
+        spliced.appendBuffer(dest->buffer(i));
+    }
+
+    spliced.setLength(newLength);
+    dest->moveBuffers(&spliced);
 }
 
 bsl::pair<int, int> BlobUtil::findBufferIndexAndOffset(const Blob& blob,
@@ -311,6 +460,95 @@ bsl::pair<int, int> BlobUtil::findBufferIndexAndOffset(const Blob& blob,
     return result;
 }
 
+int BlobUtil::find(const Blob& source, int offset, int length, char value)
+{
+    BSLS_ASSERT(0 <= offset);
+    BSLS_ASSERT(0 <= length);
+    BSLS_ASSERT(offset <= source.length() - length);
+
+    if (0 == length) {
+        return -1;                                                    // RETURN
+    }
+
+    const int endPosition = offset + length;
+
+    bsl::pair<int, int> place          = findBufferIndexAndOffset(source,
+                                                                  offset);
+    int                 bufferPosition = offset - place.second;
+
+    for (; bufferPosition < endPosition; ++place.first, place.second = 0) {
+        const BlobBuffer& buffer = source.buffer(place.first);
+        const int         end    = bsl::min(buffer.size(),
+                                            endPosition - bufferPosition);
+
+        if (place.second < end) {
+            const void *found = bsl::memchr(buffer.data() + place.second,
+                                            value,
+                                            end - place.second);
+            if (found) {
+                return bufferPosition +
+                       static_cast<int>(static_cast<const char *>(found) -
+                                        buffer.data());               // RETURN
+            }
+        }
+        bufferPosition += buffer.size();
+    }
+    return -1;
+}
+
+int BlobUtil::find(const Blob&  source,
+                   int          offset,
+                   int          length,
+                   const char  *pattern,
+                   int          patternLength)
+{
+    BSLS_ASSERT(0 <= offset);
+    BSLS_ASSERT(0 <= length);
+    BSLS_ASSERT(offset <= source.length() - length);
+    BSLS_ASSERT(0 != pattern);
+    BSLS_ASSERT(0 < patternLength);
+
+    if (length < patternLength) {
+        return -1;                                                    // RETURN
+    }
+
+    // Search each buffer for the first byte of 'pattern' using 'memchr', and
+    // compare the remaining bytes, possibly in the following buffers, at each
+    // candidate position.  'endPosition' is the position following the last
+    // position at which an occurrence may begin.
+
+    const int endPosition = offset + length - patternLength + 1;
+
+    bsl::pair<int, int> place          = findBufferIndexAndOffset(source,
+                                                                  offset);
+    int                 bufferPosition = offset - place.second;
+
+    for (; bufferPosition < endPosition; ++place.first, place.second = 0) {
+        const BlobBuffer&  buffer = source.buffer(place.first);
+        const char        *data   = buffer.data();
+        const int          end    = bsl::min(buffer.size(),
+                                             endPosition - bufferPosition);
+
+        while (place.second < end) {
+            const char *found = static_cast<const char *>(
+                                       bsl::memchr(data + place.second,
+                                                   pattern[0],
+                                                   end - place.second));
+            if (!found) {
+                break;
+            }
+
+            place.second = static_cast<int>(found - data);
+            if (isMatchAtPlace(source, place, pattern, patternLength)) {
+                return bufferPosition + place.second;                 // RETURN
+            }
+            ++place.second;
+        }
+        bufferPosition += buffer.size();
+    }
+    return -1;
+}
+
 void BlobUtil::copy(char        *dstBuffer,
                     const Blob&  srcBlob,
                     int          position,
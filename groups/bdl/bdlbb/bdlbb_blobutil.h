@@ -18,6 +18,205 @@ BSLS_IDENT("$Id: $")
 //@DESCRIPTION: This 'struct' provides a variety of utilities for 'bdlbb::Blob'
 // objects, 'bdlbb::BlobUtil', such as I/O functions, comparison functions, and
 // streaming functions.
+//
+///Scatter/Gather I/O
+///------------------
+// 'loadDataIovecs' and 'loadCapacityIovecs' describe, respectively, the data
+// and the unused capacity of a blob as arrays of 'iovec'-like descriptors, as
+// expected by the POSIX 'writev' and 'readv' system calls, so that the data of
+// a blob can be written, and data can be received into a blob, without being
+// copied through a contiguous buffer.  'commitCapacity' then makes the bytes
+// received part of the data of the blob, and 'erase' discards the bytes
+// written.
+//
+///Zero-Copy Operations
+///--------------------
+// 'append' (from a blob), 'insert', and 'erase' never copy the data of a
+// blob: they share, and trim the views of, the buffers of their arguments, so
+// that their cost is linear in the number of buffers involved rather than in
+// the number of bytes.  In particular, a range of bytes of a blob is taken as
+// a new blob by appending it to an empty blob, and a blob is spliced into
+// another at any offset by 'insert'.  'find' searches a blob for a byte or a
+// sequence of bytes, such as a message delimiter, using 'memchr' within each
+// buffer and matching sequences that span buffer boundaries, without copying
+// the blob into a contiguous buffer.  Together, these operations allow
+// messages to be framed and extracted from an input blob without copying.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Transferring Blobs Using a File Descriptor
+///- - - - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose that we need to write blobs to, and read them from, a file
+// descriptor, such as a socket or a pipe, on a POSIX platform.
+//
+// First, we define a function that writes all of the data of a blob, using
+// the blob buffers themselves as the source of 'writev':
+//..
+//  int writeBlob(int fd, bdlbb::Blob *blob)
+//      // Write all of the data of the specified 'blob' to the specified file
+//      // descriptor 'fd', removing the data written from 'blob'.  Return 0 on
+//      // success, and a non-zero value otherwise.
+//  {
+//      enum { k_MAX_IOVECS = 16 };
+//
+//      while (0 < blob->length()) {
+//          struct iovec iovecs[k_MAX_IOVECS];
+//
+//          const int numIovecs = bdlbb::BlobUtil::loadDataIovecs(
+//                                                              iovecs,
+//                                                              k_MAX_IOVECS,
+//                                                              *blob);
+//
+//          const ssize_t rc = ::writev(fd, iovecs, numIovecs);
+//          if (0 > rc) {
+//              return -1;                                            // RETURN
+//          }
+//          bdlbb::BlobUtil::erase(blob, 0, static_cast<int>(rc));
+//      }
+//      return 0;
+//  }
+//..
+// Then, we define a function that reads a number of bytes directly into the
+// unused capacity of a blob, after growing that capacity as needed using the
+// blob buffer factory of the blob:
+//..
+//  int readBlob(bdlbb::Blob *blob, int fd, int numBytes)
+//      // Read the specified 'numBytes' bytes from the specified file
+//      // descriptor 'fd', and append them to the specified 'blob'.  Return 0
+//      // on success, and a non-zero value otherwise.
+//  {
+//      enum { k_MAX_IOVECS = 16 };
+//
+//      const int length = blob->length();
+//      blob->setLength(length + numBytes);
+//      blob->setLength(length);
+//
+//      while (0 < numBytes) {
+//          struct iovec iovecs[k_MAX_IOVECS];
+//
+//          const int numIovecs = bdlbb::BlobUtil::loadCapacityIovecs(
+//                                                              iovecs,
+//                                                              k_MAX_IOVECS,
+//                                                              *blob,
+//                                                              numBytes);
+//
+//          const ssize_t rc = ::readv(fd, iovecs, numIovecs);
+//          if (0 >= rc) {
+//              return -1;                                            // RETURN
+//          }
+//          bdlbb::BlobUtil::commitCapacity(blob, static_cast<int>(rc));
+//          numBytes -= static_cast<int>(rc);
+//      }
+//      return 0;
+//  }
+//..
+// Now, we create a pipe, and a blob holding a message spanning several
+// buffers:
+//..
+//  int fds[2];
+//  int rc = ::pipe(fds);
+//  assert(0 == rc);
+//
+//  bdlbb::SimpleBlobBufferFactory factory(8);
+//
+//  const char MESSAGE[] = "Scatter/gather I/O avoids copying blob data.";
+//  const int  LENGTH    = static_cast<int>(sizeof MESSAGE - 1);
+//
+//  bdlbb::Blob message(&factory);
+//  bdlbb::BlobUtil::append(&message, MESSAGE, LENGTH);
+//  assert(6 == message.numDataBuffers());
+//..
+// Finally, we write the message to the pipe, and read it back into another
+// blob:
+//..
+//  rc = writeBlob(fds[1], &message);
+//  assert(0 == rc);
+//  assert(0 == message.length());
+//
+//  bdlbb::Blob received(&factory);
+//  rc = readBlob(&received, fds[0], LENGTH);
+//  assert(0      == rc);
+//  assert(LENGTH == received.length());
+//
+//  char buffer[sizeof MESSAGE];
+//  bdlbb::BlobUtil::copy(buffer, received, 0, LENGTH);
+//  assert(0 == bsl::memcmp(buffer, MESSAGE, LENGTH));
+//
+//  ::close(fds[0]);
+//  ::close(fds[1]);
+//..
+//
+///Example 2: Framing Messages Without Copying
+///- - - - - - - - - - - - - - - - - - - - - -
+// Suppose that a protocol sends messages terminated by "\r\n", and that the
+// bytes received are appended to an input blob as they arrive, so that a
+// message, and its delimiter, may span several buffers.
+//
+// First, we define a function that extracts the first complete message from
+// the input blob, sharing the buffers of the input rather than copying them:
+//..
+//  int extractMessage(bdlbb::Blob *message, bdlbb::Blob *input)
+//      // Load into the specified 'message' the first message, excluding its
+//      // "\r\n" delimiter, of the specified 'input', and remove that message
+//      // and its delimiter from 'input'.  Return 0 on success, and a non-zero
+//      // value, with no effect, if 'input' does not hold a complete message.
+//  {
+//      const int position = bdlbb::BlobUtil::find(*input,
+//                                                 0,
+//                                                 input->length(),
+//                                                 "\r\n",
+//                                                 2);
+//      if (0 > position) {
+//          return -1;                                                // RETURN
+//      }
+//
+//      message->removeAll();
+//      bdlbb::BlobUtil::append(message, *input, 0, position);
+//      bdlbb::BlobUtil::erase(input, 0, position + 2);
+//      return 0;
+//  }
+//..
+// Then, we create an input blob of 8-byte buffers holding two complete
+// messages, the second of which ends at a buffer boundary so that its
+// delimiter spans two buffers, followed by an incomplete one:
+//..
+//  bdlbb::SimpleBlobBufferFactory smallFactory(8);
+//
+//  const char INPUT[] = "Hello\r\nSpanning buffers\r\nPart";
+//
+//  bdlbb::Blob input(&smallFactory);
+//  bdlbb::BlobUtil::append(&input, INPUT, static_cast<int>(sizeof INPUT - 1));
+//  assert(4 == input.numDataBuffers());
+//
+//  const char *firstByte = input.buffer(0).data();
+//..
+// Next, we extract the first message, and observe that its data is the data
+// of the input blob, and not a copy:
+//..
+//  bdlbb::Blob msg(&smallFactory);
+//
+//  int rc = extractMessage(&msg, &input);
+//  assert(0         == rc);
+//  assert(5         == msg.length());
+//  assert(firstByte == msg.buffer(0).data());
+//..
+// Then, we extract the second message, whose delimiter spans two buffers:
+//..
+//  rc = extractMessage(&msg, &input);
+//  assert(0  == rc);
+//  assert(16 == msg.length());
+//  assert(0  == bdlbb::BlobUtil::find(msg, 'S'));
+//  assert(15 == bdlbb::BlobUtil::find(msg, 's'));
+//..
+// Finally, we observe that the remaining input does not hold a complete
+// message, and is left unchanged:
+//..
+//  rc = extractMessage(&msg, &input);
+//  assert(0 != rc);
+//  assert(4 == input.length());
+//..
 
 #include <bdlscm_version.h>
 
@@ -82,7 +281,12 @@ struct BlobUtil {
                        int          sourceLength);
         // Insert the specified 'sourceLength' bytes from the specified
         // 'sourceOffset' in the specified 'source' to the specified
-        // 'destOffset' in the specified 'dest'.
+        // 'destOffset' in the specified 'dest'.  The buffers of 'source' are
+        // shared by 'dest', not copied, and the buffers and unused capacity
+        // of 'dest' are retained.  The behavior is undefined unless
+        // '0 <= destOffset <= dest->length()', '0 <= sourceOffset',
+        // '0 <= sourceLength', and
+        // 'sourceOffset <= source.length() - sourceLength'.
 
     static void insert(Blob        *dest,
                        int          destOffset,
@@ -106,6 +310,34 @@ struct BlobUtil {
         // that (1) subsequent changes to 'blob' may invalidate the result of
         // this function, and (2) 'p.first' never indicates a zero-size buffer.
 
+    static int find(const Blob& source, char value);
+    static int find(const Blob& source, int offset, int length, char value);
+        // Return the position of the first byte having the specified 'value'
+        // in the specified 'source', or -1 if there is no such byte.
+        // Optionally specify an 'offset' and a 'length' restricting the
+        // search to the bytes in the range '[offset .. offset + length)' of
+        // 'source'.  The behavior is undefined unless '0 <= offset',
+        // '0 <= length', and 'offset <= source.length() - length'.
+
+    static int find(const Blob&  source,
+                    const char  *pattern,
+                    int          patternLength);
+    static int find(const Blob&  source,
+                    int          offset,
+                    int          length,
+                    const char  *pattern,
+                    int          patternLength);
+        // Return the position of the first occurrence of the specified
+        // 'patternLength' bytes at the specified 'pattern' address in the
+        // specified 'source', or -1 if there is no such occurrence.
+        // Optionally specify an 'offset' and a 'length' restricting the
+        // search to occurrences lying entirely in the range
+        // '[offset .. offset + length)' of 'source'.  The behavior is
+        // undefined unless '0 < patternLength', 'pattern' refers to at least
+        // 'patternLength' bytes, '0 <= offset', '0 <= length', and
+        // 'offset <= source.length() - length'.  Note that an occurrence may
+        // span several buffers of 'source'.
+
     static void copy(char        *dstBuffer,
                      const Blob&  srcBlob,
                      int          position,
@@ -170,6 +402,70 @@ struct BlobUtil {
         // 'factory->allocate()', if called, yields a block of memory of a size
         // at least as large as 'addLength'.
 
+    static void commitCapacity(Blob *blob, int numBytes);
+        // Grow the length of the specified 'blob' by the specified 'numBytes',
+        // making the first 'numBytes' bytes of its unused capacity part of
+        // its data, without changing the contents of that capacity.  The
+        // behavior is undefined unless '0 <= numBytes' and
+        // 'numBytes <= blob->totalSize() - blob->length()'.  Note that this
+        // function is meant to be called after receiving 'numBytes' bytes
+        // into the capacity described by 'loadCapacityIovecs'.
+
+    template <class IOVEC>
+    static int loadCapacityIovecs(IOVEC       *iovecs,
+                                  int          maxNumIovecs,
+                                  const Blob&  blob);
+    template <class IOVEC>
+    static int loadCapacityIovecs(IOVEC       *iovecs,
+                                  int          maxNumIovecs,
+                                  const Blob&  blob,
+                                  int          length);
+        // Load into the specified 'iovecs' array, in order, descriptors of at
+        // most the specified 'maxNumIovecs' non-empty ranges of the unused
+        // capacity of the specified 'blob', starting at position
+        // 'blob.length()', and return the number of descriptors loaded.
+        // Optionally specify 'length' to describe only the first 'length'
+        // bytes of the unused capacity; by default, all of the unused
+        // capacity of 'blob' is described.  The descriptors cover all of the
+        // requested capacity unless 'maxNumIovecs' descriptors are loaded.
+        // 'IOVEC' must have the modifiable data members 'iov_base', of a type
+        // to which 'char *' converts, and 'iov_len', of a type to which 'int'
+        // converts, as does the POSIX 'struct iovec' used by 'readv'.  The
+        // behavior is undefined unless '0 <= maxNumIovecs', 'iovecs' has room
+        // for 'maxNumIovecs' elements, '0 <= length', and
+        // 'length <= blob.totalSize() - blob.length()'.  Note that the
+        // descriptors are invalidated by any change to the buffers of 'blob',
+        // and that the capacity of 'blob' may be grown beforehand by setting
+        // its length to a larger value and back.
+
+    template <class IOVEC>
+    static int loadDataIovecs(IOVEC       *iovecs,
+                              int          maxNumIovecs,
+                              const Blob&  source);
+    template <class IOVEC>
+    static int loadDataIovecs(IOVEC       *iovecs,
+                              int          maxNumIovecs,
+                              const Blob&  source,
+                              int          offset,
+                              int          length);
+        // Load into the specified 'iovecs' array, in order, descriptors of at
+        // most the specified 'maxNumIovecs' non-empty ranges of the data of
+        // the specified 'source', and return the number of descriptors
+        // loaded.  Optionally specify 'offset' and 'length' to describe only
+        // the 'length' bytes starting at position 'offset' in 'source'; by
+        // default, all of the data of 'source' is described.  The descriptors
+        // cover all of the requested data unless 'maxNumIovecs' descriptors
+        // are loaded.  'IOVEC' must have the modifiable data members
+        // 'iov_base', of a type to which 'char *' converts, and 'iov_len', of
+        // a type to which 'int' converts, as does the POSIX 'struct iovec'
+        // used by 'writev'.  The behavior is undefined unless
+        // '0 <= maxNumIovecs', 'iovecs' has room for 'maxNumIovecs' elements,
+        // '0 <= offset', '0 <= length', and
+        // 'offset <= source.length() - length'.  Note that the descriptors
+        // are invalidated by any change to the buffers of 'source', and that,
+        // after a partial write of 'n' bytes, 'erase(&source, 0, n)' discards
+        // the data written.
+
     static bsl::ostream& asciiDump(bsl::ostream& stream, const Blob& source);
         // Write to the specified 'stream' an ascii dump of the specified
         // 'source', and return a reference to the modifiable 'stream'.
@@ -369,6 +665,130 @@ void BlobUtil::insert(Blob *dest, int destOffset, const Blob& source)
     insert(dest, destOffset, source, 0, source.length());
 }
 
+inline
+int BlobUtil::find(const Blob& source, char value)
+{
+    return find(source, 0, source.length(), value);
+}
+
+inline
+int BlobUtil::find(const Blob&  source,
+                   const char  *pattern,
+                   int          patternLength)
+{
+    return find(source, 0, source.length(), pattern, patternLength);
+}
+
+inline
+void BlobUtil::commitCapacity(Blob *blob, int numBytes)
+{
+    BSLS_ASSERT(0 != blob);
+    BSLS_ASSERT(0 <= numBytes);
+    BSLS_ASSERT(numBytes <= blob->totalSize() - blob->length());
+
+    blob->setLength(blob->length() + numBytes);
+}
+
+template <class IOVEC>
+inline
+int BlobUtil::loadCapacityIovecs(IOVEC       *iovecs,
+                                 int          maxNumIovecs,
+                                 const Blob&  blob)
+{
+    return loadCapacityIovecs(iovecs,
+                              maxNumIovecs,
+                              blob,
+                              blob.totalSize() - blob.length());
+}
+
+template <class IOVEC>
+int BlobUtil::loadCapacityIovecs(IOVEC       *iovecs,
+                                 int          maxNumIovecs,
+                                 const Blob&  blob,
+                                 int          length)
+{
+    BSLS_ASSERT(0 != iovecs || 0 == maxNumIovecs);
+    BSLS_ASSERT(0 <= maxNumIovecs);
+    BSLS_ASSERT(0 <= length);
+    BSLS_ASSERT(length <= blob.totalSize() - blob.length());
+
+    // The unused capacity begins after the data of the last data buffer, if
+    // any, and continues through all of the following buffers.
+
+    int bufferIndex  = 0;
+    int bufferOffset = 0;
+    if (0 < blob.numDataBuffers()) {
+        bufferIndex  = blob.numDataBuffers() - 1;
+        bufferOffset = blob.lastDataBufferLength();
+    }
+
+    int numIovecs = 0;
+    while (0 < length && numIovecs < maxNumIovecs) {
+        const BlobBuffer& buffer   = blob.buffer(bufferIndex);
+        const int         numBytes = bsl::min(buffer.size() - bufferOffset,
+                                              length);
+
+        if (0 < numBytes) {
+            iovecs[numIovecs].iov_base = buffer.data() + bufferOffset;
+            iovecs[numIovecs].iov_len  = numBytes;
+            ++numIovecs;
+            length -= numBytes;
+        }
+        bufferOffset = 0;
+        ++bufferIndex;
+    }
+    return numIovecs;
+}
+
+template <class IOVEC>
+inline
+int BlobUtil::loadDataIovecs(IOVEC       *iovecs,
+                             int          maxNumIovecs,
+                             const Blob&  source)
+{
+    return loadDataIovecs(iovecs, maxNumIovecs, source, 0, source.length());
+}
+
+template <class IOVEC>
+int BlobUtil::loadDataIovecs(IOVEC       *iovecs,
+                             int          maxNumIovecs,
+                             const Blob&  source,
+                             int          offset,
+                             int          length)
+{
+    BSLS_ASSERT(0 != iovecs || 0 == maxNumIovecs);
+    BSLS_ASSERT(0 <= maxNumIovecs);
+    BSLS_ASSERT(0 <= offset);
+    BSLS_ASSERT(0 <= length);
+    BSLS_ASSERT(offset <= source.length() - length);
+
+    if (0 == length || 0 == maxNumIovecs) {
+        return 0;                                                     // RETURN
+    }
+
+    const bsl::pair<int, int> place = findBufferIndexAndOffset(source,
+                                                               offset);
+
+    int bufferIndex  = place.first;
+    int bufferOffset = place.second;
+    int numIovecs    = 0;
+    while (0 < length && numIovecs < maxNumIovecs) {
+        const BlobBuffer& buffer   = source.buffer(bufferIndex);
+        const int         numBytes = bsl::min(buffer.size() - bufferOffset,
+                                              length);
+
+        if (0 < numBytes) {
+            iovecs[numIovecs].iov_base = buffer.data() + bufferOffset;
+            iovecs[numIovecs].iov_len  = numBytes;
+            ++numIovecs;
+            length -= numBytes;
+        }
+        bufferOffset = 0;
+        ++bufferIndex;
+    }
+    return numIovecs;
+}
+
 inline
 bsl::ostream& BlobUtil::hexDump(bsl::ostream& stream, const Blob& source)
 {
@@ -24,6 +24,7 @@
 
 #include <bsls_assert.h>
 #include <bsls_asserttest.h>
+#include <bsls_platform.h>
 #include <bsls_review.h>
 #include <bsls_types.h>
 
@@ -35,6 +36,11 @@
 #include <bsl_sstream.h>
 #include <bsl_string.h>
 
+#ifdef BSLS_PLATFORM_OS_UNIX
+#include <sys/uio.h>         // 'readv', 'writev'
+#include <unistd.h>          // 'pipe', 'close'
+#endif
+
 using namespace BloombergLP;
 using namespace bsl;  // automatically added by script
 
@@ -51,8 +57,12 @@ using namespace bsl;  // automatically added by script
 // [ 3] Testing HexDump
 // [ 2] Testing compare
 // [ 1] Testing "write special cases"
+// [12] Testing loadDataIovecs, loadCapacityIovecs, and commitCapacity
+// [13] Testing find
+// [14] Testing insert
 //-----------------------------------------------------------------------------
 // [11] CONCERN: append doesn't do excessive 'reserveBufferCapacity'.
+// [15] USAGE EXAMPLE
 //-----------------------------------------------------------------------------
 
 // ============================================================================
@@ -334,6 +344,130 @@ static bool bad_jk(int j, int k, bdlbb::Blob& blob)
     return (j < 0 || k < 0 || j + k > blob.totalSize());
 }
 
+struct Iovec {
+    // This 'struct' has the same members as the POSIX 'struct iovec', and is
+    // used to test the scatter/gather functions on all platforms.
+
+    void        *iov_base;
+    bsl::size_t  iov_len;
+};
+
+static void appendIovecs(bsl::string *result, const Iovec *iovecs, int num)
+    // Append to the specified 'result' the bytes described by the specified
+    // 'num' elements of the specified 'iovecs' array.
+{
+    for (int i = 0; i < num; ++i) {
+        result->append(static_cast<const char *>(iovecs[i].iov_base),
+                       iovecs[i].iov_len);
+    }
+}
+
+#ifdef BSLS_PLATFORM_OS_UNIX
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Transferring Blobs Using a File Descriptor
+///- - - - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose that we need to write blobs to, and read them from, a file
+// descriptor, such as a socket or a pipe, on a POSIX platform.
+//
+// First, we define a function that writes all of the data of a blob, using
+// the blob buffers themselves as the source of 'writev':
+//..
+    int writeBlob(int fd, bdlbb::Blob *blob)
+        // Write all of the data of the specified 'blob' to the specified file
+        // descriptor 'fd', removing the data written from 'blob'.  Return 0 on
+        // success, and a non-zero value otherwise.
+    {
+        enum { k_MAX_IOVECS = 16 };
+
+        while (0 < blob->length()) {
+            struct iovec iovecs[k_MAX_IOVECS];
+
+            const int numIovecs = bdlbb::BlobUtil::loadDataIovecs(
+                                                                iovecs,
+                                                                k_MAX_IOVECS,
+                                                                *blob);
+
+            const ssize_t rc = ::writev(fd, iovecs, numIovecs);
+            if (0 > rc) {
+                return -1;                                            // RETURN
+            }
+            bdlbb::BlobUtil::erase(blob, 0, static_cast<int>(rc));
+        }
+        return 0;
+    }
+//..
+// Then, we define a function that reads a number of bytes directly into the
+// unused capacity of a blob, after growing that capacity as needed using the
+// blob buffer factory of the blob:
+//..
+    int readBlob(bdlbb::Blob *blob, int fd, int numBytes)
+        // Read the specified 'numBytes' bytes from the specified file
+        // descriptor 'fd', and append them to the specified 'blob'.  Return 0
+        // on success, and a non-zero value otherwise.
+    {
+        enum { k_MAX_IOVECS = 16 };
+
+        const int length = blob->length();
+        blob->setLength(length + numBytes);
+        blob->setLength(length);
+
+        while (0 < numBytes) {
+            struct iovec iovecs[k_MAX_IOVECS];
+
+            const int numIovecs = bdlbb::BlobUtil::loadCapacityIovecs(
+                                                                iovecs,
+                                                                k_MAX_IOVECS,
+                                                                *blob,
+                                                                numBytes);
+
+            const ssize_t rc = ::readv(fd, iovecs, numIovecs);
+            if (0 >= rc) {
+                return -1;                                            // RETURN
+            }
+            bdlbb::BlobUtil::commitCapacity(blob, static_cast<int>(rc));
+            numBytes -= static_cast<int>(rc);
+        }
+        return 0;
+    }
+//..
+
+#endif
+
+///Example 2: Framing Messages Without Copying
+///- - - - - - - - - - - - - - - - - - - - - -
+// Suppose that a protocol sends messages terminated by "\r\n", and that the
+// bytes received are appended to an input blob as they arrive, so that a
+// message, and its delimiter, may span several buffers.
+//
+// First, we define a function that extracts the first complete message from
+// the input blob, sharing the buffers of the input rather than copying them:
+//..
+    int extractMessage(bdlbb::Blob *message, bdlbb::Blob *input)
+        // Load into the specified 'message' the first message, excluding its
+        // "\r\n" delimiter, of the specified 'input', and remove that message
+        // and its delimiter from 'input'.  Return 0 on success, and a non-zero
+        // value, with no effect, if 'input' does not hold a complete message.
+    {
+        const int position = bdlbb::BlobUtil::find(*input,
+                                                   0,
+                                                   input->length(),
+                                                   "\r\n",
+                                                   2);
+        if (0 > position) {
+            return -1;                                                // RETURN
+        }
+
+        message->removeAll();
+        bdlbb::BlobUtil::append(message, *input, 0, position);
+        bdlbb::BlobUtil::erase(input, 0, position + 2);
+        return 0;
+    }
+//..
+
 // ============================================================================
 //                               MAIN PROGRAM
 // ----------------------------------------------------------------------------
@@ -351,6 +485,752 @@ int main(int argc, char *argv[])
     bsls::ReviewFailureHandlerGuard reviewGuard(&bsls::Review::failByAbort);
 
     switch (test) { case 0:
+      case 15: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl << "USAGE EXAMPLE" << endl
+                                  << "=============" << endl;
+
+#ifdef BSLS_PLATFORM_OS_UNIX
+// Now, we create a pipe, and a blob holding a message spanning several
+// buffers:
+//..
+    int fds[2];
+    int rc = ::pipe(fds);
+    ASSERT(0 == rc);
+
+    bdlbb::SimpleBlobBufferFactory factory(8);
+
+    const char MESSAGE[] = "Scatter/gather I/O avoids copying blob data.";
+    const int  LENGTH    = static_cast<int>(sizeof MESSAGE - 1);
+
+    bdlbb::Blob message(&factory);
+    bdlbb::BlobUtil::append(&message, MESSAGE, LENGTH);
+    ASSERT(6 == message.numDataBuffers());
+//..
+// Finally, we write the message to the pipe, and read it back into another
+// blob:
+//..
+    rc = writeBlob(fds[1], &message);
+    ASSERT(0 == rc);
+    ASSERT(0 == message.length());
+
+    bdlbb::Blob received(&factory);
+    rc = readBlob(&received, fds[0], LENGTH);
+    ASSERT(0      == rc);
+    ASSERT(LENGTH == received.length());
+
+    char buffer[sizeof MESSAGE];
+    bdlbb::BlobUtil::copy(buffer, received, 0, LENGTH);
+    ASSERT(0 == bsl::memcmp(buffer, MESSAGE, LENGTH));
+
+    ::close(fds[0]);
+    ::close(fds[1]);
+//..
+#else
+        if (verbose) cout << "Skipped: not a POSIX platform." << endl;
+#endif
+
+// Then, we create an input blob of 8-byte buffers holding two complete
+// messages, the second of which ends at a buffer boundary so that its
+// delimiter spans two buffers, followed by an incomplete one:
+//..
+    bdlbb::SimpleBlobBufferFactory smallFactory(8);
+
+    const char INPUT[] = "Hello\r\nSpanning buffers\r\nPart";
+
+    bdlbb::Blob input(&smallFactory);
+    bdlbb::BlobUtil::append(&input, INPUT, static_cast<int>(sizeof INPUT - 1));
+    ASSERT(4 == input.numDataBuffers());
+
+    const char *firstByte = input.buffer(0).data();
+//..
+// Next, we extract the first message, and observe that its data is the data
+// of the input blob, and not a copy:
+//..
+    bdlbb::Blob msg(&smallFactory);
+
+    int rc2 = extractMessage(&msg, &input);
+    ASSERT(0         == rc2);
+    ASSERT(5         == msg.length());
+    ASSERT(firstByte == msg.buffer(0).data());
+//..
+// Then, we extract the second message, whose delimiter spans two buffers:
+//..
+    rc2 = extractMessage(&msg, &input);
+    ASSERT(0  == rc2);
+    ASSERT(16 == msg.length());
+    ASSERT(0  == bdlbb::BlobUtil::find(msg, 'S'));
+    ASSERT(15 == bdlbb::BlobUtil::find(msg, 's'));
+//..
+// Finally, we observe that the remaining input does not hold a complete
+// message, and is left unchanged:
+//..
+    rc2 = extractMessage(&msg, &input);
+    ASSERT(0 != rc2);
+    ASSERT(4 == input.length());
+//..
+      } break;
+      case 14: {
+        // --------------------------------------------------------------------
+        // TESTING 'insert'
+        //
+        // Concerns:
+        //: 1 'insert' inserts exactly the requested range of the source at
+        //:   the requested offset of the destination, for any offsets, in
+        //:   particular offsets in the middle of buffers.
+        //:
+        //: 2 The buffers of the source are shared, not copied, and no buffer
+        //:   is allocated from the factory of either blob.
+        //:
+        //: 3 Inserting before the end of the data of the destination retains
+        //:   its unused capacity.
+        //:
+        //: 4 A blob can be inserted into itself.
+        //:
+        //: 5 No memory is allocated from the default allocator.
+        //:
+        //: 6 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 For several buffer sizes, and all small destination and source
+        //:   lengths, offsets, and lengths, insert a range of a source blob
+        //:   into a destination blob having unused capacity, and compare the
+        //:   data with the expected string.  Verify that the unused capacity
+        //:   is unchanged, and that no memory is allocated by the factories.
+        //:   (C-1..3, 5)
+        //:
+        //: 2 Repeat P-1 inserting a range of the destination into itself.
+        //:   (C-4)
+        //:
+        //: 3 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for invalid arguments.  (C-6)
+        //
+        // Testing:
+        //   void insert(Blob *, int, const Blob&, int, int);
+        //   void insert(Blob *, int, const Blob&, int);
+        //   void insert(Blob *, int, const Blob&);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nTESTING 'insert'"
+                          << "\n================" << endl;
+
+        const int BUFFER_SIZES[] = { 1, 3, 8 };
+        const int NUM_BUFFER_SIZES = static_cast<int>(sizeof BUFFER_SIZES
+                                                      / sizeof *BUFFER_SIZES);
+
+        bslma::TestAllocator         da("default", veryVeryVerbose);
+        bslma::DefaultAllocatorGuard dag(&da);
+
+        bslma::TestAllocator ta("test", veryVeryVerbose);
+        bslma::TestAllocator fa("factory", veryVeryVerbose);
+
+        if (verbose) cout << "\nInserting another blob." << endl;
+
+        for (int ti = 0; ti < NUM_BUFFER_SIZES; ++ti) {
+            const int BUFFER_SIZE = BUFFER_SIZES[ti];
+
+            bdlbb::SimpleBlobBufferFactory factory(BUFFER_SIZE, &fa);
+
+            for (int destLength = 0; destLength <= 10; ++destLength) {
+            for (int srcLength  = 0; srcLength  <= 10; ++srcLength) {
+                bsl::string DEST = g(destLength);
+                bsl::string SRC  = g(srcLength);
+                for (bsl::size_t i = 0; i < SRC.length(); ++i) {
+                    SRC[i] = static_cast<char>(SRC[i] - 'a' + 'A');
+                }
+
+                bdlbb::Blob source(&factory, &ta);
+                copyStringToBlob(&source, SRC);
+
+                for (int destOffset = 0;
+                     destOffset <= destLength;
+                     ++destOffset) {
+                for (int srcOffset = 0; srcOffset <= srcLength; ++srcOffset) {
+                for (int length = 0; srcOffset + length <= srcLength;
+                                                                   ++length) {
+                    bdlbb::Blob mX(&factory, &ta);  const bdlbb::Blob& X = mX;
+                    copyStringToBlob(&mX, DEST);
+                    mX.setLength(destLength + BUFFER_SIZE + 1);
+                    mX.setLength(destLength);
+
+                    const int CAPACITY = X.totalSize() - X.length();
+
+                    const bsl::string EXP = DEST.substr(0, destOffset)
+                                          + SRC.substr(srcOffset, length)
+                                          + DEST.substr(destOffset);
+
+                    const Int64 NUM_FACTORY_ALLOCATIONS = fa.numAllocations();
+
+                    if (srcOffset + length == srcLength) {
+                        if (0 == srcOffset) {
+                            Util::insert(&mX, destOffset, source);
+                        }
+                        else {
+                            Util::insert(&mX, destOffset, source, srcOffset);
+                        }
+                    }
+                    else {
+                        Util::insert(&mX,
+                                     destOffset,
+                                     source,
+                                     srcOffset,
+                                     length);
+                    }
+
+                    bsl::string result;
+                    copyBlobToString(&result, X);
+
+                    ASSERTV(BUFFER_SIZE, DEST, destOffset, SRC, srcOffset,
+                            length, EXP == result);
+                    ASSERTV(BUFFER_SIZE, destOffset, srcOffset, length,
+                            NUM_FACTORY_ALLOCATIONS == fa.numAllocations());
+
+                    if (destOffset < destLength) {
+                        ASSERTV(BUFFER_SIZE, destOffset, srcOffset, length,
+                                CAPACITY == X.totalSize() - X.length());
+                    }
+
+                    for (int i = 0; i < X.numBuffers(); ++i) {
+                        ASSERTV(BUFFER_SIZE, destOffset, srcOffset, length, i,
+                                0 < X.buffer(i).size());
+                    }
+                }
+                }
+                }
+            }
+            }
+        }
+
+        if (verbose) cout << "\nInserting a blob into itself." << endl;
+
+        for (int ti = 0; ti < NUM_BUFFER_SIZES; ++ti) {
+            const int BUFFER_SIZE = BUFFER_SIZES[ti];
+
+            bdlbb::SimpleBlobBufferFactory factory(BUFFER_SIZE, &fa);
+
+            for (int blobLength = 0; blobLength <= 10; ++blobLength) {
+                const bsl::string DATA = g(blobLength);
+
+                for (int destOffset = 0;
+                     destOffset <= blobLength;
+                     ++destOffset) {
+                for (int srcOffset = 0; srcOffset <= blobLength; ++srcOffset) {
+                for (int length = 0; srcOffset + length <= blobLength;
+                                                                   ++length) {
+                    bdlbb::Blob mX(&factory, &ta);  const bdlbb::Blob& X = mX;
+                    copyStringToBlob(&mX, DATA);
+
+                    const bsl::string EXP = DATA.substr(0, destOffset)
+                                          + DATA.substr(srcOffset, length)
+                                          + DATA.substr(destOffset);
+
+                    Util::insert(&mX, destOffset, X, srcOffset, length);
+
+                    bsl::string result;
+                    copyBlobToString(&result, X);
+
+                    ASSERTV(BUFFER_SIZE, DATA, destOffset, srcOffset, length,
+                            result, EXP == result);
+                }
+                }
+                }
+            }
+        }
+        ASSERT(0 == da.numAllocations());
+
+        if (verbose) cout << "\nNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            bdlbb::SimpleBlobBufferFactory factory(8, &fa);
+
+            bdlbb::Blob source(&factory, &ta);
+            source.setLength(10);
+
+            bdlbb::Blob dest(&factory, &ta);
+            dest.setLength(10);
+
+            ASSERT_PASS(Util::insert(&dest, 10, source, 0, 10));
+            ASSERT_PASS(Util::insert(&dest, 0, source, 10, 0));
+            ASSERT_FAIL(Util::insert(0, 0, source, 0, 1));
+            ASSERT_FAIL(Util::insert(&dest, -1, source, 0, 1));
+            ASSERT_FAIL(Util::insert(&dest, 21, source, 0, 1));
+            ASSERT_FAIL(Util::insert(&dest, 0, source, -1, 1));
+            ASSERT_FAIL(Util::insert(&dest, 0, source, 0, -1));
+            ASSERT_FAIL(Util::insert(&dest, 0, source, 5, 6));
+        }
+        ASSERT(0 == ta.numBytesInUse());
+        ASSERT(0 == fa.numBytesInUse());
+      } break;
+      case 13: {
+        // --------------------------------------------------------------------
+        // TESTING 'find'
+        //
+        // Concerns:
+        //: 1 'find' returns the position of the first occurrence of a byte,
+        //:   or of a sequence of bytes, lying entirely in the requested range
+        //:   of the data of a blob, and -1 if there is none.
+        //:
+        //: 2 Occurrences of a sequence spanning several buffers are found.
+        //:
+        //: 3 The bytes in the unused capacity of a blob are never matched.
+        //:
+        //: 4 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 For several buffer sizes, and all offsets and lengths in a blob
+        //:   having unused capacity filled with searched-for bytes, compare
+        //:   the results of 'find' for several bytes and sequences with those
+        //:   of 'bsl::string::find' on the same data.  (C-1..3)
+        //:
+        //: 2 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for invalid arguments.  (C-4)
+        //
+        // Testing:
+        //   int find(const Blob&, char);
+        //   int find(const Blob&, int, int, char);
+        //   int find(const Blob&, const char *, int);
+        //   int find(const Blob&, int, int, const char *, int);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nTESTING 'find'"
+                          << "\n==============" << endl;
+
+        const int BUFFER_SIZES[] = { 1, 2, 3, 5, 8, 64 };
+        const int NUM_BUFFER_SIZES = static_cast<int>(sizeof BUFFER_SIZES
+                                                      / sizeof *BUFFER_SIZES);
+
+        const char *const DATA     = "aabacabcabcdabcdeaabdab";
+        const int         LENGTH   = static_cast<int>(bsl::strlen(DATA));
+        const char *const PATTERNS[] = {
+            "a", "d", "e", "x", "ab", "da", "aab", "abc", "cab", "bca", "abcd",
+            "abcde", "dabcdeaab", "abx", "dab", "daba"
+        };
+        const int NUM_PATTERNS = static_cast<int>(sizeof PATTERNS
+                                                  / sizeof *PATTERNS);
+
+        bslma::TestAllocator ta(veryVeryVerbose);
+
+        for (int ti = 0; ti < NUM_BUFFER_SIZES; ++ti) {
+            const int BUFFER_SIZE = BUFFER_SIZES[ti];
+
+            bdlbb::SimpleBlobBufferFactory factory(BUFFER_SIZE, &ta);
+
+            // Follow the data with bytes completing the patterns "dab" and
+            // "daba", which must not be found in the capacity.
+
+            bdlbb::Blob blob(&factory, &ta);
+            copyStringToBlob(&blob, bsl::string(DATA) + "abaaaaaa");
+            blob.setLength(LENGTH);
+
+            const bsl::string STR(DATA);
+
+            for (int offset = 0; offset <= LENGTH; ++offset) {
+            for (int length = 0; offset + length <= LENGTH; ++length) {
+                const bsl::string RANGE = STR.substr(offset, length);
+
+                for (int pi = 0; pi < NUM_PATTERNS; ++pi) {
+                    const char *const PATTERN = PATTERNS[pi];
+                    const int         PATTERN_LENGTH =
+                                      static_cast<int>(bsl::strlen(PATTERN));
+
+                    const bsl::size_t FOUND = RANGE.find(PATTERN);
+                    const int         EXP   = bsl::string::npos == FOUND
+                                            ? -1
+                                            : offset + static_cast<int>(FOUND);
+
+                    ASSERTV(BUFFER_SIZE, offset, length, PATTERN,
+                            EXP == Util::find(blob,
+                                              offset,
+                                              length,
+                                              PATTERN,
+                                              PATTERN_LENGTH));
+
+                    if (1 == PATTERN_LENGTH) {
+                        ASSERTV(BUFFER_SIZE, offset, length, PATTERN,
+                                EXP == Util::find(blob,
+                                                  offset,
+                                                  length,
+                                                  PATTERN[0]));
+                    }
+
+                    if (0 == offset && LENGTH == length) {
+                        ASSERTV(BUFFER_SIZE, PATTERN,
+                                EXP == Util::find(blob,
+                                                  PATTERN,
+                                                  PATTERN_LENGTH));
+                        if (1 == PATTERN_LENGTH) {
+                            ASSERTV(BUFFER_SIZE, PATTERN,
+                                    EXP == Util::find(blob, PATTERN[0]));
+                        }
+                    }
+                }
+            }
+            }
+        }
+
+        if (verbose) cout << "\nNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            bdlbb::SimpleBlobBufferFactory factory(8, &ta);
+
+            bdlbb::Blob blob(&factory, &ta);
+            blob.setLength(10);
+
+            ASSERT_PASS(Util::find(blob, 0, 10, 'a'));
+            ASSERT_PASS(Util::find(blob, 10, 0, 'a'));
+            ASSERT_FAIL(Util::find(blob, -1, 1, 'a'));
+            ASSERT_FAIL(Util::find(blob, 0, -1, 'a'));
+            ASSERT_FAIL(Util::find(blob, 5, 6, 'a'));
+
+            ASSERT_PASS(Util::find(blob, 0, 10, "ab", 2));
+            ASSERT_PASS(Util::find(blob, 10, 0, "ab", 2));
+            ASSERT_FAIL(Util::find(blob, -1, 1, "ab", 2));
+            ASSERT_FAIL(Util::find(blob, 0, -1, "ab", 2));
+            ASSERT_FAIL(Util::find(blob, 5, 6, "ab", 2));
+            ASSERT_FAIL(Util::find(blob, 0, 10, "ab", 0));
+            ASSERT_FAIL(Util::find(blob, 0, 10, 0, 2));
+        }
+        ASSERT(0 == ta.numBytesInUse());
+      } break;
+      case 12: {
+        // --------------------------------------------------------------------
+        // TESTING SCATTER/GATHER FUNCTIONS
+        //
+        // Concerns:
+        //: 1 'loadDataIovecs' describes, in order, exactly the requested range
+        //:   of the data of a blob, using one descriptor per buffer spanned.
+        //:
+        //: 2 'loadCapacityIovecs' describes, in order, exactly the requested
+        //:   prefix of the unused capacity of a blob, starting in the last
+        //:   data buffer if it is not full.
+        //:
+        //: 3 Both functions load at most the specified number of descriptors,
+        //:   which then describe a prefix of the requested bytes.
+        //:
+        //: 4 'commitCapacity' makes the bytes written into the capacity part
+        //:   of the data of the blob, without allocating buffers.
+        //:
+        //: 5 The descriptors can be used with 'writev' and 'readv' to transfer
+        //:   blobs through a file descriptor, in several calls.
+        //:
+        //: 6 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 For several buffer sizes, and all small blob lengths, offsets,
+        //:   lengths, and limits on the number of descriptors, compare the
+        //:   bytes described by 'loadDataIovecs' with the expected substring
+        //:   of the data.  (C-1, 3)
+        //:
+        //: 2 For several buffer sizes, and all small blob lengths and amounts
+        //:   of capacity, fill the capacity described by 'loadCapacityIovecs',
+        //:   commit it, and verify the data and buffers of the blob.
+        //:   (C-2..4)
+        //:
+        //: 3 On POSIX platforms, transfer blobs of various lengths through a
+        //:   pipe using 'writev' and 'readv' with few descriptors per call.
+        //:   (C-5)
+        //:
+        //: 4 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for invalid arguments.  (C-6)
+        //
+        // Testing:
+        //   void commitCapacity(Blob *, int);
+        //   int loadCapacityIovecs(IOVEC *, int, const Blob&);
+        //   int loadCapacityIovecs(IOVEC *, int, const Blob&, int);
+        //   int loadDataIovecs(IOVEC *, int, const Blob&);
+        //   int loadDataIovecs(IOVEC *, int, const Blob&, int, int);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nTESTING SCATTER/GATHER FUNCTIONS"
+                          << "\n================================" << endl;
+
+        enum { k_MAX_IOVECS = 32 };
+
+        const int BUFFER_SIZES[] = { 1, 3, 8 };
+        const int NUM_BUFFER_SIZES = static_cast<int>(sizeof BUFFER_SIZES
+                                                      / sizeof *BUFFER_SIZES);
+
+        bslma::TestAllocator ta(veryVeryVerbose);
+
+        if (verbose) cout << "\nTesting 'loadDataIovecs'." << endl;
+
+        for (int ti = 0; ti < NUM_BUFFER_SIZES; ++ti) {
+            const int BUFFER_SIZE = BUFFER_SIZES[ti];
+
+            bdlbb::SimpleBlobBufferFactory factory(BUFFER_SIZE, &ta);
+
+            for (int blobLength = 0; blobLength <= 20; ++blobLength) {
+                const bsl::string DATA = g(blobLength);
+
+                bdlbb::Blob blob(&factory, &ta);
+                copyStringToBlob(&blob, DATA);
+
+                Iovec iovecs[k_MAX_IOVECS];
+
+                int num = Util::loadDataIovecs(iovecs, k_MAX_IOVECS, blob);
+
+                bsl::string result;
+                appendIovecs(&result, iovecs, num);
+                ASSERTV(BUFFER_SIZE, blobLength, DATA == result);
+                ASSERTV(BUFFER_SIZE, blobLength, blob.numDataBuffers() == num);
+
+                for (int offset = 0; offset <= blobLength; ++offset) {
+                for (int length = 0; offset + length <= blobLength; ++length) {
+                    const int FIRST = offset / BUFFER_SIZE;
+                    const int LAST  = (offset + length - 1) / BUFFER_SIZE;
+                    const int SPAN  = length ? LAST - FIRST + 1 : 0;
+
+                    for (int maxNum = 0; maxNum <= SPAN + 1; ++maxNum) {
+                        num = Util::loadDataIovecs(iovecs,
+                                                   maxNum,
+                                                   blob,
+                                                   offset,
+                                                   length);
+
+                        ASSERTV(BUFFER_SIZE, blobLength, offset, length,
+                                maxNum, bsl::min(maxNum, SPAN) == num);
+
+                        result.clear();
+                        appendIovecs(&result, iovecs, num);
+
+                        const bsl::string EXPECTED = DATA.substr(
+                                                     offset,
+                                                     result.length());
+                        ASSERTV(BUFFER_SIZE, blobLength, offset, length,
+                                maxNum, EXPECTED == result);
+                        ASSERTV(BUFFER_SIZE, blobLength, offset, length,
+                                maxNum,
+                                (maxNum < SPAN) ==
+                                     (static_cast<int>(result.length())
+                                                                    < length));
+                        for (int i = 0; i < num; ++i) {
+                            ASSERTV(BUFFER_SIZE, blobLength, offset, length,
+                                    maxNum, i, 0 < iovecs[i].iov_len);
+                        }
+                    }
+                }
+                }
+            }
+        }
+
+        if (verbose) cout << "\nTesting 'loadCapacityIovecs' and "
+                             "'commitCapacity'." << endl;
+
+        for (int ti = 0; ti < NUM_BUFFER_SIZES; ++ti) {
+            const int BUFFER_SIZE = BUFFER_SIZES[ti];
+
+            bdlbb::SimpleBlobBufferFactory factory(BUFFER_SIZE, &ta);
+
+            for (int blobLength = 0; blobLength <= 12; ++blobLength) {
+            for (int extra = 0; extra <= 12; ++extra) {
+            for (int length = 0; length <= extra; ++length) {
+                const bsl::string DATA = g(blobLength + length);
+
+                bdlbb::Blob blob(&factory, &ta);
+                copyStringToBlob(&blob, DATA.substr(0, blobLength));
+                blob.setLength(blobLength + extra);
+                blob.setLength(blobLength);
+
+                const int CAPACITY   = blob.totalSize() - blobLength;
+                const int NUM_BUFFERS = blob.numBuffers();
+                ASSERTV(BUFFER_SIZE, blobLength, extra, extra <= CAPACITY);
+
+                Iovec iovecs[k_MAX_IOVECS];
+
+                int num = Util::loadCapacityIovecs(iovecs,
+                                                   k_MAX_IOVECS,
+                                                   blob);
+
+                int total = 0;
+                for (int i = 0; i < num; ++i) {
+                    ASSERTV(BUFFER_SIZE, blobLength, extra, i,
+                            0 < iovecs[i].iov_len);
+                    total += static_cast<int>(iovecs[i].iov_len);
+                }
+                ASSERTV(BUFFER_SIZE, blobLength, extra, CAPACITY == total);
+
+                if (0 < num && 0 < blob.numDataBuffers()) {
+                    const bdlbb::BlobBuffer& LAST = blob.buffer(
+                                                   blob.numDataBuffers() - 1);
+
+                    const char *EXPECTED =
+                                 blob.lastDataBufferLength() < LAST.size()
+                                 ? LAST.data() + blob.lastDataBufferLength()
+                                 : blob.buffer(blob.numDataBuffers()).data();
+                    ASSERTV(BUFFER_SIZE, blobLength, extra,
+                            EXPECTED == iovecs[0].iov_base);
+                }
+
+                num = Util::loadCapacityIovecs(iovecs,
+                                               k_MAX_IOVECS,
+                                               blob,
+                                               length);
+
+                // Fill the described capacity with the rest of the data.
+
+                int filled = 0;
+                for (int i = 0; i < num; ++i) {
+                    bsl::memcpy(iovecs[i].iov_base,
+                                DATA.data() + blobLength + filled,
+                                iovecs[i].iov_len);
+                    filled += static_cast<int>(iovecs[i].iov_len);
+                }
+                ASSERTV(BUFFER_SIZE, blobLength, extra, length,
+                        length == filled);
+
+                Util::commitCapacity(&blob, filled);
+
+                bsl::string result;
+                copyBlobToString(&result, blob);
+                ASSERTV(BUFFER_SIZE, blobLength, extra, length,
+                        DATA == result);
+                ASSERTV(BUFFER_SIZE, blobLength, extra, length,
+                        NUM_BUFFERS == blob.numBuffers());
+
+                // Limit the number of descriptors.
+
+                blob.setLength(blobLength);
+                for (int maxNum = 0; maxNum <= 2; ++maxNum) {
+                    num = Util::loadCapacityIovecs(iovecs,
+                                                   maxNum,
+                                                   blob,
+                                                   length);
+                    ASSERTV(BUFFER_SIZE, blobLength, extra, length, maxNum,
+                            num <= maxNum);
+
+                    total = 0;
+                    for (int i = 0; i < num; ++i) {
+                        total += static_cast<int>(iovecs[i].iov_len);
+                    }
+                    ASSERTV(BUFFER_SIZE, blobLength, extra, length, maxNum,
+                            num < maxNum ? length == total : total <= length);
+                }
+            }
+            }
+            }
+        }
+
+#ifdef BSLS_PLATFORM_OS_UNIX
+        if (verbose) cout << "\nTesting 'writev' and 'readv' with a pipe."
+                          << endl;
+        {
+            int fds[2];
+            ASSERT(0 == ::pipe(fds));
+
+            enum { k_FEW_IOVECS = 3 };
+
+            for (int ti = 0; ti < NUM_BUFFER_SIZES; ++ti) {
+                const int BUFFER_SIZE = BUFFER_SIZES[ti];
+
+                bdlbb::SimpleBlobBufferFactory factory(BUFFER_SIZE, &ta);
+
+                for (int length = 0; length <= 100; length += 7) {
+                    const bsl::string DATA = g(length);
+
+                    bdlbb::Blob source(&factory, &ta);
+                    copyStringToBlob(&source, DATA);
+
+                    while (0 < source.length()) {
+                        struct iovec iovecs[k_FEW_IOVECS];
+
+                        const int num = Util::loadDataIovecs(iovecs,
+                                                             k_FEW_IOVECS,
+                                                             source);
+                        const ssize_t rc = ::writev(fds[1], iovecs, num);
+                        ASSERTV(BUFFER_SIZE, length, 0 < rc);
+                        if (0 >= rc) {
+                            break;
+                        }
+                        Util::erase(&source, 0, static_cast<int>(rc));
+                    }
+
+                    // Receive after a prefix already in the blob.
+
+                    bdlbb::Blob dest(&factory, &ta);
+                    copyStringToBlob(&dest, "xy");
+                    dest.setLength(2 + length);
+                    dest.setLength(2);
+
+                    int remaining = length;
+                    while (0 < remaining) {
+                        struct iovec iovecs[k_FEW_IOVECS];
+
+                        const int num = Util::loadCapacityIovecs(iovecs,
+                                                                 k_FEW_IOVECS,
+                                                                 dest,
+                                                                 remaining);
+                        const ssize_t rc = ::readv(fds[0], iovecs, num);
+                        ASSERTV(BUFFER_SIZE, length, 0 < rc);
+                        if (0 >= rc) {
+                            break;
+                        }
+                        Util::commitCapacity(&dest, static_cast<int>(rc));
+                        remaining -= static_cast<int>(rc);
+                    }
+
+                    bsl::string result;
+                    copyBlobToString(&result, dest);
+                    ASSERTV(BUFFER_SIZE, length, "xy" + DATA == result);
+                }
+            }
+            ::close(fds[0]);
+            ::close(fds[1]);
+        }
+#endif
+
+        if (verbose) cout << "\nNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            bdlbb::SimpleBlobBufferFactory factory(8, &ta);
+
+            bdlbb::Blob blob(&factory, &ta);
+            blob.setLength(20);
+            blob.setLength(10);
+
+            Iovec iovecs[4];
+
+            ASSERT_PASS(Util::loadDataIovecs(iovecs, 4, blob, 0, 10));
+            ASSERT_PASS(Util::loadDataIovecs(iovecs, 0, blob, 0, 10));
+            ASSERT_PASS(Util::loadDataIovecs(iovecs, 4, blob, 10, 0));
+            ASSERT_FAIL(Util::loadDataIovecs(iovecs, -1, blob, 0, 10));
+            ASSERT_FAIL(Util::loadDataIovecs(iovecs, 4, blob, -1, 1));
+            ASSERT_FAIL(Util::loadDataIovecs(iovecs, 4, blob, 0, -1));
+            ASSERT_FAIL(Util::loadDataIovecs(iovecs, 4, blob, 5, 6));
+            ASSERT_FAIL(Util::loadDataIovecs(static_cast<Iovec *>(0),
+                                             4,
+                                             blob));
+
+            ASSERT_PASS(Util::loadCapacityIovecs(iovecs, 4, blob, 14));
+            ASSERT_FAIL(Util::loadCapacityIovecs(iovecs, 4, blob, 15));
+            ASSERT_FAIL(Util::loadCapacityIovecs(iovecs, 4, blob, -1));
+            ASSERT_FAIL(Util::loadCapacityIovecs(iovecs, -1, blob));
+
+            ASSERT_FAIL(Util::commitCapacity(0, 1));
+            ASSERT_FAIL(Util::commitCapacity(&blob, -1));
+            ASSERT_FAIL(Util::commitCapacity(&blob, 15));
+            ASSERT_PASS(Util::commitCapacity(&blob, 14));
+        }
+        ASSERT(0 == ta.numBytesInUse());
+      } break;
       case 11: {
         // --------------------------------------------------------------------
         // TESTING FIX TO DRQS 144543867
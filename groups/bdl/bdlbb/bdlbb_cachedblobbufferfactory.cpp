@@ -0,0 +1,347 @@
+// bdlbb_cachedblobbufferfactory.cpp                                  -*-C++-*-
+#include <bdlbb_cachedblobbufferfactory.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(bdlbb_cachedblobbufferfactory.cpp,"$Id$ $CSID$")
+
+#include <bslma_default.h>
+#include <bslma_sharedptrrep.h>
+#include <bslmf_assert.h>
+
+#include <bslmt_lockguard.h>
+
+#include <bsls_alignmentutil.h>
+#include <bsls_assert.h>
+#include <bsls_performancehint.h>
+
+#include <bsl_algorithm.h>
+#include <bsl_memory.h>
+#include <bsl_typeinfo.h>
+
+namespace BloombergLP {
+namespace bdlbb {
+
+                  // ==========================================
+                  // class CachedBlobBufferFactory::ThreadCache
+                  // ==========================================
+
+struct CachedBlobBufferFactory::ThreadCache {
+    // This 'struct' holds the free blocks of one thread, linked through their
+    // first word, and links the caches of a factory to one another.
+
+    // DATA
+    void                    *d_freeList_p;  // first free block, or 0
+    int                      d_numBlocks;   // number of free blocks
+    CachedBlobBufferFactory *d_factory_p;   // factory owning this cache
+    ThreadCache             *d_next_p;      // next cache of the factory
+    ThreadCache             *d_prev_p;      // previous cache of the factory
+};
+
+                   // ========================================
+                   // class CachedBlobBufferFactory::BufferRep
+                   // ========================================
+
+class CachedBlobBufferFactory::BufferRep : public bslma::SharedPtrRep {
+    // This class is the shared pointer representation of a buffer supplied by
+    // a 'CachedBlobBufferFactory'.  It is created at the beginning of a block,
+    // immediately followed by the bytes of the buffer, and returns its block
+    // to the cache of the releasing thread when disposed of.
+
+    // DATA
+    CachedBlobBufferFactory *d_factory_p;  // factory owning the block
+
+  public:
+    // PUBLIC CONSTANTS
+    enum {
+        k_HEADER_SIZE = (sizeof(bslma::SharedPtrRep)
+                         + sizeof(CachedBlobBufferFactory *)
+                         + bsls::AlignmentUtil::BSLS_MAX_ALIGNMENT - 1)
+                      & ~(bsls::AlignmentUtil::BSLS_MAX_ALIGNMENT - 1)
+            // offset of the buffer from the beginning of the block, which
+            // keeps the buffer maximally aligned; see 'makeBuffer'
+    };
+
+    // CREATORS
+    explicit BufferRep(CachedBlobBufferFactory *factory)
+        // Create a representation of the buffer following this object in its
+        // block, owned by the specified 'factory'.
+    : d_factory_p(factory)
+    {
+    }
+
+    // MANIPULATORS
+    virtual void disposeObject()
+        // Do nothing: the bytes of a buffer need no destruction.
+    {
+    }
+
+    virtual void disposeRep()
+        // Return the block of this object to the cache of the calling thread.
+    {
+        CachedBlobBufferFactory *factory = d_factory_p;
+
+        this->~BufferRep();
+        factory->deallocateBlock(this);
+    }
+
+    virtual void *getDeleter(const std::type_info&)
+        // Return 0: this representation has no deleter.
+    {
+        return 0;
+    }
+
+    // ACCESSORS
+    char *buffer() const
+        // Return the address of the buffer following this object.
+    {
+        return const_cast<char *>(reinterpret_cast<const char *>(this))
+                                                               + k_HEADER_SIZE;
+    }
+
+    virtual void *originalPtr() const
+        // Return the address of the buffer following this object.
+    {
+        return buffer();
+    }
+};
+
+                       // -----------------------------
+                       // class CachedBlobBufferFactory
+                       // -----------------------------
+
+// PRIVATE CLASS METHODS
+void CachedBlobBufferFactory::destroyThreadCache(void *cache)
+{
+    ThreadCache             *theCache = static_cast<ThreadCache *>(cache);
+    CachedBlobBufferFactory *factory  = theCache->d_factory_p;
+
+    factory->flush(theCache, 0);
+
+    {
+        bslmt::LockGuard<bslmt::Mutex> guard(&factory->d_mutex);
+
+        if (theCache->d_prev_p) {
+            theCache->d_prev_p->d_next_p = theCache->d_next_p;
+        }
+        else {
+            factory->d_caches_p = theCache->d_next_p;
+        }
+        if (theCache->d_next_p) {
+            theCache->d_next_p->d_prev_p = theCache->d_prev_p;
+        }
+    }
+    factory->d_allocator_p->deallocate(theCache);
+}
+
+// PRIVATE MANIPULATORS
+void CachedBlobBufferFactory::deallocateBlock(void *block)
+{
+    ThreadCache *cache = threadCache();
+
+    *static_cast<void **>(block) = cache->d_freeList_p;
+    cache->d_freeList_p          = block;
+    ++cache->d_numBlocks;
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(
+                                   cache->d_numBlocks > d_maxCachedBuffers)) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+
+        flush(cache, d_maxCachedBuffers / 2);
+    }
+}
+
+void CachedBlobBufferFactory::flush(ThreadCache *cache, int numBlocks)
+{
+    while (cache->d_numBlocks > numBlocks) {
+        void *block = cache->d_freeList_p;
+
+        cache->d_freeList_p = *static_cast<void **>(block);
+        --cache->d_numBlocks;
+        d_pool.deallocate(block);
+    }
+}
+
+void CachedBlobBufferFactory::makeBuffer(BlobBuffer *buffer, void *block)
+{
+    BSLMF_ASSERT(sizeof(BufferRep) <= BufferRep::k_HEADER_SIZE);
+
+    BufferRep *rep = new (block) BufferRep(this);
+
+    // Swap the new shared pointer into 'buffer', rather than copying it, to
+    // avoid modifying the reference count.
+
+    bsl::shared_ptr<char> sharedBuffer(rep->buffer(), rep);
+    buffer->buffer().swap(sharedBuffer);
+    buffer->setSize(d_bufferSize);
+}
+
+void CachedBlobBufferFactory::refill(ThreadCache *cache, int numBlocks)
+{
+    for (int i = 0; i < numBlocks; ++i) {
+        void *block = d_pool.allocate();
+
+        *static_cast<void **>(block) = cache->d_freeList_p;
+        cache->d_freeList_p          = block;
+    }
+    cache->d_numBlocks += numBlocks;
+}
+
+CachedBlobBufferFactory::ThreadCache *CachedBlobBufferFactory::threadCache()
+{
+    ThreadCache *cache = static_cast<ThreadCache *>(
+                                       bslmt::ThreadUtil::getSpecific(d_key));
+    if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(cache)) {
+        return cache;                                                 // RETURN
+    }
+    BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+
+    cache = static_cast<ThreadCache *>(
+                                 d_allocator_p->allocate(sizeof(ThreadCache)));
+    cache->d_freeList_p = 0;
+    cache->d_numBlocks  = 0;
+    cache->d_factory_p  = this;
+    cache->d_prev_p     = 0;
+
+    {
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+        cache->d_next_p = d_caches_p;
+        if (d_caches_p) {
+            d_caches_p->d_prev_p = cache;
+        }
+        d_caches_p = cache;
+    }
+
+    const int rc = bslmt::ThreadUtil::setSpecific(d_key, cache);
+    (void)rc;
+    BSLS_ASSERT_OPT(0 == rc);
+
+    return cache;
+}
+
+// CREATORS
+CachedBlobBufferFactory::CachedBlobBufferFactory(
+                                              int               bufferSize,
+                                              bslma::Allocator *basicAllocator)
+: d_bufferSize(bufferSize)
+, d_maxCachedBuffers(k_DEFAULT_MAX_CACHED_BUFFERS)
+, d_pool(BufferRep::k_HEADER_SIZE + bufferSize, basicAllocator)
+, d_caches_p(0)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    BSLS_ASSERT(0 < bufferSize);
+
+    const int rc = bslmt::ThreadUtil::createKey(&d_key, &destroyThreadCache);
+    (void)rc;
+    BSLS_ASSERT_OPT(0 == rc);
+}
+
+CachedBlobBufferFactory::CachedBlobBufferFactory(
+                                            int               bufferSize,
+                                            int               maxCachedBuffers,
+                                            bslma::Allocator *basicAllocator)
+: d_bufferSize(bufferSize)
+, d_maxCachedBuffers(maxCachedBuffers)
+, d_pool(BufferRep::k_HEADER_SIZE + bufferSize, basicAllocator)
+, d_caches_p(0)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    BSLS_ASSERT(0 < bufferSize);
+    BSLS_ASSERT(0 <= maxCachedBuffers);
+
+    const int rc = bslmt::ThreadUtil::createKey(&d_key, &destroyThreadCache);
+    (void)rc;
+    BSLS_ASSERT_OPT(0 == rc);
+}
+
+CachedBlobBufferFactory::~CachedBlobBufferFactory()
+{
+    // Deleting the key first ensures that the caches are no longer destroyed
+    // on thread exit.  The blocks of the caches are released with the pool.
+
+    bslmt::ThreadUtil::deleteKey(d_key);
+
+    while (d_caches_p) {
+        ThreadCache *cache = d_caches_p;
+
+        d_caches_p = cache->d_next_p;
+        d_allocator_p->deallocate(cache);
+    }
+}
+
+// MANIPULATORS
+void CachedBlobBufferFactory::allocate(BlobBuffer *buffer)
+{
+    BSLS_ASSERT(buffer);
+
+    ThreadCache *cache = threadCache();
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(0 == cache->d_numBlocks)) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+
+        refill(cache, bsl::max(1, d_maxCachedBuffers / 2));
+    }
+
+    void *block = cache->d_freeList_p;
+
+    cache->d_freeList_p = *static_cast<void **>(block);
+    --cache->d_numBlocks;
+
+    makeBuffer(buffer, block);
+}
+
+void CachedBlobBufferFactory::allocate(BlobBuffer *buffers, int numBuffers)
+{
+    BSLS_ASSERT(buffers || 0 == numBuffers);
+    BSLS_ASSERT(0 <= numBuffers);
+
+    ThreadCache *cache = threadCache();
+
+    if (cache->d_numBlocks < numBuffers) {
+        refill(cache, bsl::max(numBuffers - cache->d_numBlocks,
+                               d_maxCachedBuffers / 2));
+    }
+
+    for (int i = 0; i < numBuffers; ++i) {
+        void *block = cache->d_freeList_p;
+
+        cache->d_freeList_p = *static_cast<void **>(block);
+        makeBuffer(buffers + i, block);
+    }
+    cache->d_numBlocks -= numBuffers;
+}
+
+void CachedBlobBufferFactory::reserveCapacity(int numBuffers)
+{
+    BSLS_ASSERT(0 <= numBuffers);
+
+    d_pool.reserveCapacity(numBuffers);
+}
+
+// ACCESSORS
+int CachedBlobBufferFactory::numCachedBuffers() const
+{
+    const ThreadCache *cache = static_cast<const ThreadCache *>(
+                                       bslmt::ThreadUtil::getSpecific(d_key));
+
+    return cache ? cache->d_numBlocks : 0;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
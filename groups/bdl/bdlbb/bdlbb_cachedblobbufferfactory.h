@@ -0,0 +1,314 @@
+// bdlbb_cachedblobbufferfactory.h                                    -*-C++-*-
+#ifndef INCLUDED_BDLBB_CACHEDBLOBBUFFERFACTORY
+#define INCLUDED_BDLBB_CACHEDBLOBBUFFERFACTORY
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide a blob buffer factory with per-thread buffer caches.
+//
+//@CLASSES:
+//  bdlbb::CachedBlobBufferFactory: factory caching blob buffers per thread
+//
+//@SEE_ALSO: bdlbb_blob, bdlbb_pooledblobbufferfactory, bdlma_concurrentpool
+//
+//@DESCRIPTION: This component provides a mechanism,
+// 'bdlbb::CachedBlobBufferFactory', that implements the
+// 'bdlbb::BlobBufferFactory' protocol and creates 'bdlbb::BlobBuffer' objects
+// of a fixed size specified at construction, for use by many threads
+// concurrently.
+//
+///Buffer Representation
+///---------------------
+// Each buffer supplied by this factory is a single block of memory holding
+// both the reference counts of the shared pointer of the blob buffer and the
+// bytes of the buffer, so that no separate control block is ever allocated.
+// When the last reference to a buffer is released, the block is not returned
+// to an allocator, but kept by the factory for reuse by the next call to
+// 'allocate'.  Blocks are obtained from a 'bdlma::ConcurrentPool', and all of
+// the memory of the factory is returned to the allocator supplied at
+// construction when the factory is destroyed.
+//
+///Thread Caches
+///-------------
+// Each thread that allocates or releases buffers of a factory has its own
+// cache of free blocks, which it accesses without synchronization.  A thread
+// allocating from an empty cache takes a batch of blocks from the shared pool
+// of the factory, and a thread whose cache exceeds the maximum number of
+// cached buffers (optionally specified at construction) returns half of its
+// blocks to that pool, using lock-free operations in both cases.  The cache
+// of a thread is returned to the pool when the thread exits.  Therefore, in a
+// steady state, allocating and releasing buffers involves neither locks nor
+// allocators, and buffers released by a thread are reused, while still in its
+// processor's cache, by the next allocations of that thread.
+//
+// Note that the per-thread caches are found using a thread-specific storage
+// key created by each factory, of which a platform provides a limited number.
+// This factory is intended to be used for the long-lived, heavily used,
+// factories of an application, such as those of its networking layer;
+// applications needing many factories should use
+// 'bdlbb::PooledBlobBufferFactory'.
+//
+///Thread Safety
+///-------------
+// 'bdlbb::CachedBlobBufferFactory' is *fully thread-safe*, meaning that its
+// methods may be called concurrently on the same object, and that the buffers
+// it supplies may be copied and released by any thread.  The buffers supplied
+// by a factory must be released before the factory is destroyed, and a
+// factory must not be destroyed while a thread that has used it is exiting.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Allocating Message Buffers
+///- - - - - - - - - - - - - - - - - - -
+// Suppose that the threads of a server receive messages into blobs, and
+// release those blobs after processing the messages, possibly in other
+// threads.
+//
+// First, we create a factory supplying buffers of 4KB, shared by all of the
+// threads:
+//..
+//  bslma::TestAllocator ta;
+//
+//  bdlbb::CachedBlobBufferFactory factory(4096, &ta);
+//  assert(4096 == factory.bufferSize());
+//..
+// Then, we create a blob using that factory, and grow it to hold a message of
+// 10000 bytes, which takes 3 buffers.  The first allocation takes a batch of
+// 'factory.maxCachedBuffers() / 2' blocks from the pool of the factory into
+// the cache of the calling thread, from which the buffers are taken:
+//..
+//  {
+//      bdlbb::Blob blob(&factory, &ta);
+//      blob.setLength(10000);
+//      assert(3      == blob.numDataBuffers());
+//      assert(32 - 3 == factory.numCachedBuffers());
+//..
+// Next, we destroy the blob, which returns the buffers to the cache of the
+// calling thread:
+//..
+//  }
+//  assert(32 == factory.numCachedBuffers());
+//..
+// Then, we allocate buffers for another message, using the batch 'allocate'
+// method, and append them to a blob; the buffers are taken from the cache
+// without any allocation:
+//..
+//  bsls::Types::Int64 numAllocations = ta.numAllocations();
+//
+//  bdlbb::BlobBuffer buffers[3];
+//  factory.allocate(buffers, 3);
+//
+//  bdlbb::Blob blob(&factory, &ta);
+//  blob.reserveBufferCapacity(3);
+//  for (int i = 0; i < 3; ++i) {
+//      blob.appendDataBuffer(buffers[i]);
+//  }
+//  assert(3 * 4096       == blob.length());
+//  assert(numAllocations == ta.numAllocations() - 1);
+//..
+// Note that the one allocation was made by 'reserveBufferCapacity', for the
+// array of buffers of the blob.
+//
+// Finally, we release the buffers before the factory is destroyed:
+//..
+//  for (int i = 0; i < 3; ++i) {
+//      buffers[i].reset();
+//  }
+//  blob.removeAll();
+//..
+
+#include <bdlscm_version.h>
+
+#include <bdlbb_blob.h>
+
+#include <bdlma_concurrentpool.h>
+
+#include <bslma_allocator.h>
+
+#include <bslmt_mutex.h>
+#include <bslmt_threadutil.h>
+
+namespace BloombergLP {
+namespace bdlbb {
+
+                       // =============================
+                       // class CachedBlobBufferFactory
+                       // =============================
+
+class CachedBlobBufferFactory : public BlobBufferFactory {
+    // This class implements the 'BlobBufferFactory' protocol, and provides a
+    // fully thread-safe mechanism for allocating 'BlobBuffer' objects of a
+    // fixed size passed at construction, from caches specific to each thread.
+
+    // PRIVATE TYPES
+    class BufferRep;
+        // shared pointer representation placed before each buffer
+
+    struct ThreadCache;
+        // free blocks of one thread
+
+    // DATA
+    int                     d_bufferSize;         // size of allocated blob
+                                                  // buffers
+
+    int                     d_maxCachedBuffers;   // maximum number of free
+                                                  // blocks in a thread cache
+
+    bdlma::ConcurrentPool   d_pool;               // shared pool of blocks
+
+    bslmt::ThreadUtil::Key  d_key;                // key of the thread caches
+
+    bslmt::Mutex            d_mutex;              // protects 'd_caches_p'
+
+    ThreadCache            *d_caches_p;           // list of all thread caches
+
+    bslma::Allocator       *d_allocator_p;        // memory allocator (held,
+                                                  // not owned)
+
+  private:
+    // PRIVATE CLASS METHODS
+    static void destroyThreadCache(void *cache);
+        // Return the blocks of the specified 'cache' to the pool of its
+        // factory, and destroy 'cache'.  This method is called on the exit of
+        // the thread owning 'cache'.
+
+    // PRIVATE MANIPULATORS
+    void deallocateBlock(void *block);
+        // Return the specified 'block' to the cache of the calling thread.
+
+    void flush(ThreadCache *cache, int numBlocks);
+        // Return blocks from the specified 'cache' to the pool until at most
+        // the specified 'numBlocks' blocks remain in 'cache'.
+
+    void makeBuffer(BlobBuffer *buffer, void *block);
+        // Create, in the specified 'block', a buffer, and load it into the
+        // specified 'buffer'.
+
+    void refill(ThreadCache *cache, int numBlocks);
+        // Move the specified 'numBlocks' blocks from the pool to the specified
+        // 'cache'.
+
+    ThreadCache *threadCache();
+        // Return the cache of the calling thread, creating it if needed.
+
+  private:
+    // NOT IMPLEMENTED
+    CachedBlobBufferFactory(const CachedBlobBufferFactory&);
+    CachedBlobBufferFactory& operator=(const CachedBlobBufferFactory&);
+
+  public:
+    // PUBLIC CONSTANTS
+    enum { k_DEFAULT_MAX_CACHED_BUFFERS = 64 };
+        // default maximum number of free buffers in the cache of a thread
+
+    // CREATORS
+    explicit CachedBlobBufferFactory(int               bufferSize,
+                                     bslma::Allocator *basicAllocator = 0);
+    CachedBlobBufferFactory(int               bufferSize,
+                            int               maxCachedBuffers,
+                            bslma::Allocator *basicAllocator = 0);
+        // Create a factory for allocating 'BlobBuffer' objects of the
+        // specified 'bufferSize'.  Optionally specify 'maxCachedBuffers', the
+        // maximum number of free buffers kept in the cache of each thread; if
+        // 'maxCachedBuffers' is not specified,
+        // 'k_DEFAULT_MAX_CACHED_BUFFERS' is used, and if it is 0, buffers are
+        // not cached.  Optionally specify a 'basicAllocator' used to supply
+        // memory.  If 'basicAllocator' is 0, the currently installed default
+        // allocator is used.  The behavior is undefined unless
+        // '0 < bufferSize' and '0 <= maxCachedBuffers'.
+
+    ~CachedBlobBufferFactory();
+        // Destroy this factory, releasing all of its memory.  The behavior is
+        // undefined unless all of the buffers allocated by this factory have
+        // been released, and no thread that has used this factory is exiting.
+
+    // MANIPULATORS
+    void allocate(BlobBuffer *buffer);
+        // Allocate a new buffer with the buffer size specified at construction
+        // and load it into the specified 'buffer'.
+
+    void allocate(BlobBuffer *buffers, int numBuffers);
+        // Allocate the specified 'numBuffers' new buffers with the buffer size
+        // specified at construction and load them into the specified
+        // 'buffers' array.  The behavior is undefined unless
+        // '0 <= numBuffers' and 'buffers' has room for 'numBuffers' elements.
+        // Note that this method takes the blocks of all of the buffers from
+        // the pool of this factory at once if the cache of the calling thread
+        // does not have enough blocks.
+
+    void reserveCapacity(int numBuffers);
+        // Reserve memory from the allocator of this factory to satisfy the
+        // allocation of at least the specified 'numBuffers' buffers without
+        // further allocation.  The behavior is undefined unless
+        // '0 <= numBuffers'.
+
+    // ACCESSORS
+    int bufferSize() const;
+        // Return the buffer size specified at construction of this factory.
+
+    int maxCachedBuffers() const;
+        // Return the maximum number of free buffers kept in the cache of each
+        // thread.
+
+    int numCachedBuffers() const;
+        // Return the number of free buffers in the cache of the calling
+        // thread.
+
+                                  // Aspects
+
+    bslma::Allocator *allocator() const;
+        // Return the allocator used by this object to supply memory.
+};
+
+// ============================================================================
+//                             INLINE DEFINITIONS
+// ============================================================================
+
+                       // -----------------------------
+                       // class CachedBlobBufferFactory
+                       // -----------------------------
+
+// ACCESSORS
+inline
+int CachedBlobBufferFactory::bufferSize() const
+{
+    return d_bufferSize;
+}
+
+inline
+int CachedBlobBufferFactory::maxCachedBuffers() const
+{
+    return d_maxCachedBuffers;
+}
+
+                                  // Aspects
+
+inline
+bslma::Allocator *CachedBlobBufferFactory::allocator() const
+{
+    return d_allocator_p;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
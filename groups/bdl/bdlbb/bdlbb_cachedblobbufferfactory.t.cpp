@@ -0,0 +1,926 @@
+// bdlbb_cachedblobbufferfactory.t.cpp                                -*-C++-*-
+#include <bdlbb_cachedblobbufferfactory.h>
+
+#include <bdlbb_blob.h>
+#include <bdlbb_pooledblobbufferfactory.h>
+
+#include <bslim_testutil.h>
+
+#include <bslma_default.h>
+#include <bslma_testallocator.h>
+#include <bslma_testallocatormonitor.h>
+
+#include <bslmt_threadutil.h>
+
+#include <bsls_alignmentutil.h>
+#include <bsls_asserttest.h>
+#include <bsls_atomic.h>
+#include <bsls_stopwatch.h>
+#include <bsls_types.h>
+
+#include <bsl_algorithm.h>
+#include <bsl_cstdlib.h>
+#include <bsl_cstring.h>
+#include <bsl_iostream.h>
+#include <bsl_memory.h>
+
+using namespace BloombergLP;
+using namespace bsl;
+
+//=============================================================================
+//                             TEST PLAN
+//-----------------------------------------------------------------------------
+//                              Overview
+//                              --------
+// The component under test is a thread-safe blob buffer factory that caches
+// free buffers per thread.  Its buffers are tested for size, alignment, and
+// independence; its caching policy is tested by observing the number of
+// cached buffers of the calling thread and the allocations made by the
+// factory; and its thread safety is tested by allocating buffers in some
+// threads and releasing them in others.
+//-----------------------------------------------------------------------------
+// CREATORS
+// [ 2] explicit CachedBlobBufferFactory(int, bslma::Allocator *);
+// [ 2] CachedBlobBufferFactory(int, int, bslma::Allocator *);
+// [ 2] ~CachedBlobBufferFactory();
+//
+// MANIPULATORS
+// [ 3] void allocate(BlobBuffer *);
+// [ 4] void allocate(BlobBuffer *, int);
+// [ 4] void reserveCapacity(int);
+//
+// ACCESSORS
+// [ 2] int bufferSize() const;
+// [ 2] int maxCachedBuffers() const;
+// [ 3] int numCachedBuffers() const;
+// [ 2] bslma::Allocator *allocator() const;
+//-----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 5] CONCURRENCY TEST
+// [ 6] USAGE EXAMPLE
+// [-1] ALLOCATION BENCHMARK
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLIM_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLIM_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLIM_TESTUTIL_LOOP6_ASSERT
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                     NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_SAFE_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_PASS(EXPR)
+#define ASSERT_SAFE_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_FAIL(EXPR)
+#define ASSERT_PASS(EXPR)      BSLS_ASSERTTEST_ASSERT_PASS(EXPR)
+#define ASSERT_FAIL(EXPR)      BSLS_ASSERTTEST_ASSERT_FAIL(EXPR)
+#define ASSERT_OPT_PASS(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_PASS(EXPR)
+#define ASSERT_OPT_FAIL(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_FAIL(EXPR)
+
+// ============================================================================
+//                    GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef bdlbb::CachedBlobBufferFactory Obj;
+typedef bsls::Types::Int64             Int64;
+
+//=============================================================================
+//               GLOBAL HELPER CLASSES AND FUNCTIONS FOR TESTING
+//-----------------------------------------------------------------------------
+
+namespace {
+
+enum { k_NUM_ROUNDS = 200, k_NUM_PER_ROUND = 40 };
+
+struct ExchangeArgs {
+    // This 'struct' holds the arguments of the threads of the concurrency
+    // test: a factory, and slots through which a producer thread passes
+    // buffers to a consumer thread.
+
+    bdlbb::BlobBufferFactory *d_factory_p;
+    bdlbb::BlobBuffer        *d_slots_p;     // 'k_NUM_PER_ROUND' buffers
+    bsls::AtomicInt          *d_round_p;     // round ready to be consumed
+    bsls::AtomicInt          *d_consumed_p;  // rounds consumed
+    bsls::AtomicInt          *d_errors_p;    // number of errors detected
+    int                       d_id;          // value written in buffers
+};
+
+extern "C" void *produce(void *arg)
+    // Allocate 'k_NUM_PER_ROUND' buffers from the factory of the specified
+    // 'arg' in each of 'k_NUM_ROUNDS' rounds, fill them with the identifier
+    // of 'arg', and pass them to the consumer, waiting for the consumer to
+    // release the buffers of the previous round.
+{
+    ExchangeArgs& args = *static_cast<ExchangeArgs *>(arg);
+
+    for (int round = 1; round <= k_NUM_ROUNDS; ++round) {
+        while (args.d_consumed_p->load() < round - 1) {
+            bslmt::ThreadUtil::yield();
+        }
+        for (int i = 0; i < k_NUM_PER_ROUND; ++i) {
+            args.d_factory_p->allocate(args.d_slots_p + i);
+            bsl::memset(args.d_slots_p[i].data(),
+                        args.d_id,
+                        args.d_slots_p[i].size());
+        }
+        args.d_round_p->store(round);
+    }
+    return 0;
+}
+
+extern "C" void *consume(void *arg)
+    // Verify and release the buffers passed by the producer of the specified
+    // 'arg' in each of 'k_NUM_ROUNDS' rounds, and allocate, fill, and release
+    // buffers of its own.
+{
+    ExchangeArgs& args = *static_cast<ExchangeArgs *>(arg);
+
+    for (int round = 1; round <= k_NUM_ROUNDS; ++round) {
+        while (args.d_round_p->load() < round) {
+            bslmt::ThreadUtil::yield();
+        }
+        for (int i = 0; i < k_NUM_PER_ROUND; ++i) {
+            const bdlbb::BlobBuffer& buffer = args.d_slots_p[i];
+            for (int j = 0; j < buffer.size(); ++j) {
+                if (buffer.data()[j] != static_cast<char>(args.d_id)) {
+                    ++*args.d_errors_p;
+                    break;
+                }
+            }
+            args.d_slots_p[i].reset();
+        }
+
+        bdlbb::BlobBuffer own;
+        args.d_factory_p->allocate(&own);
+        bsl::memset(own.data(), ~args.d_id, own.size());
+
+        args.d_consumed_p->store(round);
+    }
+    return 0;
+}
+
+extern "C" void *churn(void *arg)
+    // Allocate and release buffers from the specified 'arg', a factory, in
+    // batches.
+{
+    bdlbb::BlobBufferFactory *factory =
+                                  static_cast<bdlbb::BlobBufferFactory *>(arg);
+
+    enum { k_BATCH = 16, k_NUM_BATCHES = 20000 };
+
+    bdlbb::BlobBuffer buffers[k_BATCH];
+    for (int n = 0; n < k_NUM_BATCHES; ++n) {
+        for (int i = 0; i < k_BATCH; ++i) {
+            factory->allocate(buffers + i);
+        }
+        for (int i = 0; i < k_BATCH; ++i) {
+            buffers[i].reset();
+        }
+    }
+    return 0;
+}
+
+}  // close unnamed namespace
+
+//=============================================================================
+//                                 MAIN PROGRAM
+//-----------------------------------------------------------------------------
+int main(int argc, char *argv[])
+{
+    const int                 test = argc > 1 ? atoi(argv[1]) : 0;
+    const bool             verbose = argc > 2;
+    const bool         veryVerbose = argc > 3;
+    const bool     veryVeryVerbose = argc > 4;
+    const bool veryVeryVeryVerbose = argc > 5;
+
+    (void)veryVerbose;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    // CONCERN: In no case does memory come from the default allocator.
+
+    bslma::TestAllocator defaultAllocator("default", veryVeryVeryVerbose);
+    ASSERT(0 == bslma::Default::setDefaultAllocator(&defaultAllocator));
+    bslma::TestAllocatorMonitor dam(&defaultAllocator);
+
+    switch (test) { case 0:  // Zero is always the leading case.
+      case 6: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl << "USAGE EXAMPLE" << endl
+                                  << "=============" << endl;
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Allocating Message Buffers
+///- - - - - - - - - - - - - - - - - - -
+// Suppose that the threads of a server receive messages into blobs, and
+// release those blobs after processing the messages, possibly in other
+// threads.
+//
+// First, we create a factory supplying buffers of 4KB, shared by all of the
+// threads:
+//..
+    bslma::TestAllocator ta;
+
+    bdlbb::CachedBlobBufferFactory factory(4096, &ta);
+    ASSERT(4096 == factory.bufferSize());
+//..
+// Then, we create a blob using that factory, and grow it to hold a message of
+// 10000 bytes, which takes 3 buffers.  The first allocation takes a batch of
+// 'factory.maxCachedBuffers() / 2' blocks from the pool of the factory into
+// the cache of the calling thread, from which the buffers are taken:
+//..
+    {
+        bdlbb::Blob blob(&factory, &ta);
+        blob.setLength(10000);
+        ASSERT(3      == blob.numDataBuffers());
+        ASSERT(32 - 3 == factory.numCachedBuffers());
+//..
+// Next, we destroy the blob, which returns the buffers to the cache of the
+// calling thread:
+//..
+    }
+    ASSERT(32 == factory.numCachedBuffers());
+//..
+// Then, we allocate buffers for another message, using the batch 'allocate'
+// method, and append them to a blob; the buffers are taken from the cache
+// without any allocation:
+//..
+    bsls::Types::Int64 numAllocations = ta.numAllocations();
+
+    bdlbb::BlobBuffer buffers[3];
+    factory.allocate(buffers, 3);
+
+    bdlbb::Blob blob(&factory, &ta);
+    blob.reserveBufferCapacity(3);
+    for (int i = 0; i < 3; ++i) {
+        blob.appendDataBuffer(buffers[i]);
+    }
+    ASSERT(3 * 4096       == blob.length());
+    ASSERT(numAllocations == ta.numAllocations() - 1);
+//..
+// Note that the one allocation was made by 'reserveBufferCapacity', for the
+// array of buffers of the blob.
+//
+// Finally, we release the buffers before the factory is destroyed:
+//..
+    for (int i = 0; i < 3; ++i) {
+        buffers[i].reset();
+    }
+    blob.removeAll();
+//..
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // CONCURRENCY TEST
+        //
+        // Concerns:
+        //: 1 Buffers allocated in one thread can be used and released in
+        //:   another, concurrently with allocations in other threads, and no
+        //:   buffer is supplied twice.
+        //:
+        //: 2 The caches of exiting threads are returned to the pool, so that
+        //:   the memory used by a factory does not grow with the number of
+        //:   threads that have used it.
+        //
+        // Plan:
+        //: 1 In several rounds, create pairs of threads, in which a producer
+        //:   allocates buffers, fills them with a value specific to the pair,
+        //:   and passes them to a consumer, which verifies and releases them,
+        //:   and allocates buffers of its own.  Join the threads, and verify
+        //:   that no errors were detected.  (C-1)
+        //:
+        //: 2 Create threads allocating and releasing buffers one after
+        //:   another, and verify that the memory in use by the factory does
+        //:   not grow after the first thread has exited.  (C-2)
+        //
+        // Testing:
+        //   CONCURRENCY TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "CONCURRENCY TEST" << endl
+                          << "================" << endl;
+
+        enum { k_NUM_PAIRS = 4, k_NUM_REPETITIONS = 3 };
+
+        bslma::TestAllocator ta("test", veryVeryVerbose);
+        {
+            Obj mX(100, 16, &ta);
+
+            for (int rep = 0; rep < k_NUM_REPETITIONS; ++rep) {
+                bdlbb::BlobBuffer slots[k_NUM_PAIRS][k_NUM_PER_ROUND];
+                bsls::AtomicInt   rounds[k_NUM_PAIRS];
+                bsls::AtomicInt   consumed[k_NUM_PAIRS];
+                bsls::AtomicInt   errors(0);
+                ExchangeArgs      args[k_NUM_PAIRS];
+
+                bslmt::ThreadUtil::Handle handles[2 * k_NUM_PAIRS];
+
+                for (int i = 0; i < k_NUM_PAIRS; ++i) {
+                    args[i].d_factory_p  = &mX;
+                    args[i].d_slots_p    = slots[i];
+                    args[i].d_round_p    = &rounds[i];
+                    args[i].d_consumed_p = &consumed[i];
+                    args[i].d_errors_p   = &errors;
+                    args[i].d_id         = i + 1;
+
+                    ASSERT(0 == bslmt::ThreadUtil::create(&handles[2 * i],
+                                                          &produce,
+                                                          &args[i]));
+                    ASSERT(0 == bslmt::ThreadUtil::create(
+                                                          &handles[2 * i + 1],
+                                                          &consume,
+                                                          &args[i]));
+                }
+                for (int i = 0; i < 2 * k_NUM_PAIRS; ++i) {
+                    ASSERT(0 == bslmt::ThreadUtil::join(handles[i]));
+                }
+
+                ASSERTV(rep, errors, 0 == errors);
+            }
+        }
+        ASSERT(0 == ta.numBytesInUse());
+
+        {
+            Obj mX(100, 16, &ta);
+
+            Int64 bytesAfterFirst = 0;
+
+            for (int rep = 0; rep < k_NUM_REPETITIONS; ++rep) {
+                bslmt::ThreadUtil::Handle handle;
+
+                ASSERT(0 == bslmt::ThreadUtil::create(&handle, &churn, &mX));
+                ASSERT(0 == bslmt::ThreadUtil::join(handle));
+
+                if (0 == rep) {
+                    bytesAfterFirst = ta.numBytesInUse();
+                }
+                ASSERTV(rep, bytesAfterFirst, ta.numBytesInUse(),
+                        bytesAfterFirst == ta.numBytesInUse());
+                if (veryVerbose) { T_ P_(rep) P(ta.numBytesInUse()) }
+            }
+        }
+        ASSERT(0 == ta.numBytesInUse());
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // TESTING BATCH 'allocate' AND 'reserveCapacity'
+        //
+        // Concerns:
+        //: 1 'allocate' loads the specified number of distinct buffers of the
+        //:   buffer size, taking them from the cache of the calling thread.
+        //:
+        //: 2 If the cache does not have enough buffers, 'allocate' refills it
+        //:   with enough buffers at once, leaving at least half of the maximum
+        //:   number of cached buffers minus the number requested.
+        //:
+        //: 3 After 'reserveCapacity', allocating the reserved number of
+        //:   buffers does not allocate memory.
+        //:
+        //: 4 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 For various numbers of buffers, allocate them in a batch, and
+        //:   verify the buffers and the number of cached buffers.  (C-1..2)
+        //:
+        //: 2 Reserve capacity, and verify that no memory is allocated by
+        //:   allocating the reserved buffers.  (C-3)
+        //:
+        //: 3 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for invalid arguments.  (C-4)
+        //
+        // Testing:
+        //   void allocate(BlobBuffer *, int);
+        //   void reserveCapacity(int);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                   << "TESTING BATCH 'allocate' AND 'reserveCapacity'" << endl
+                   << "==============================================" << endl;
+
+        bslma::TestAllocator ta("test", veryVeryVerbose);
+
+        enum { k_MAX_BUFFERS = 100 };
+
+        const int NUM_BUFFERS[] = { 0, 1, 2, 7, 8, 9, 31, 50, 100 };
+        const int NUM_DATA      = static_cast<int>(sizeof NUM_BUFFERS
+                                                   / sizeof *NUM_BUFFERS);
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int NUM = NUM_BUFFERS[ti];
+
+            Obj mX(24, 16, &ta);  const Obj& X = mX;
+
+            bdlbb::BlobBuffer buffers[k_MAX_BUFFERS];
+
+            mX.allocate(buffers, NUM);
+            ASSERTV(NUM, (NUM ? bsl::max(0, 8 - NUM) : 0)
+                                                    == X.numCachedBuffers());
+
+            for (int i = 0; i < NUM; ++i) {
+                ASSERTV(NUM, i, 24 == buffers[i].size());
+                bsl::memset(buffers[i].data(), i, 24);
+            }
+            for (int i = 0; i < NUM; ++i) {
+                for (int j = 0; j < 24; ++j) {
+                    ASSERTV(NUM, i, j, static_cast<char>(i) ==
+                                                      buffers[i].data()[j]);
+                }
+            }
+
+            // Allocate from a non-empty cache.
+
+            const int CACHED = X.numCachedBuffers();
+            bdlbb::BlobBuffer more[4];
+            mX.allocate(more, 4);
+            ASSERTV(NUM, CACHED, X.numCachedBuffers(),
+                    (CACHED >= 4 ? CACHED - 4 : CACHED + 8 - 4)
+                                                   == X.numCachedBuffers());
+            for (int i = 0; i < 4; ++i) {
+                ASSERTV(NUM, i, 24 == more[i].size());
+                more[i].reset();
+            }
+            for (int i = 0; i < NUM; ++i) {
+                buffers[i].reset();
+            }
+            ASSERTV(NUM, X.numCachedBuffers() <= 16);
+        }
+
+        if (verbose) cout << "\nTesting 'reserveCapacity'." << endl;
+        {
+            Obj mX(1000, 0, &ta);
+
+            bdlbb::BlobBuffer buffers[k_MAX_BUFFERS];
+
+            mX.allocate(buffers, 0);   // creates the cache of this thread
+            mX.reserveCapacity(k_MAX_BUFFERS);
+
+            const Int64 NUM_ALLOCATIONS = ta.numAllocations();
+
+            mX.allocate(buffers, k_MAX_BUFFERS / 2);
+            for (int i = k_MAX_BUFFERS / 2; i < k_MAX_BUFFERS; ++i) {
+                mX.allocate(buffers + i);
+            }
+            ASSERT(NUM_ALLOCATIONS == ta.numAllocations());
+
+            for (int i = 0; i < k_MAX_BUFFERS; ++i) {
+                buffers[i].reset();
+            }
+        }
+
+        if (verbose) cout << "\nNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            Obj mX(8, &ta);
+
+            bdlbb::BlobBuffer buffers[2];
+
+            ASSERT_PASS(mX.allocate(buffers, 0));
+            ASSERT_PASS(mX.allocate(static_cast<bdlbb::BlobBuffer *>(0), 0));
+            ASSERT_FAIL(mX.allocate(static_cast<bdlbb::BlobBuffer *>(0), 1));
+            ASSERT_FAIL(mX.allocate(buffers, -1));
+
+            ASSERT_PASS(mX.reserveCapacity(0));
+            ASSERT_FAIL(mX.reserveCapacity(-1));
+        }
+        ASSERT(0 == ta.numBytesInUse());
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // TESTING 'allocate' AND 'numCachedBuffers'
+        //
+        // Concerns:
+        //: 1 'allocate' loads a buffer of the buffer size, maximally aligned,
+        //:   and writable, which is distinct from the other buffers in use.
+        //:
+        //: 2 The buffer remains valid while any copy of it exists, and its
+        //:   block is returned to the cache of the releasing thread when the
+        //:   last copy is released, and reused first.
+        //:
+        //: 3 An empty cache is refilled with half of the maximum number of
+        //:   cached buffers, or one buffer if caching is disabled, and a cache
+        //:   exceeding the maximum is flushed to half of the maximum.
+        //:
+        //: 4 Once buffers have been released, allocating and releasing buffers
+        //:   does not allocate memory.
+        //:
+        //: 5 All memory is released when the factory is destroyed.
+        //:
+        //: 6 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 For several buffer sizes, allocate buffers, verify their size and
+        //:   alignment, fill them, and verify their contents.  (C-1)
+        //:
+        //: 2 Copy and release buffers, verifying the number of cached buffers
+        //:   and the addresses of the buffers reused.  (C-2..3)
+        //:
+        //: 3 Allocate and release buffers repeatedly, and verify that the
+        //:   number of allocations does not change.  (C-4)
+        //:
+        //: 4 Verify that no memory is in use after the factories are
+        //:   destroyed.  (C-5)
+        //:
+        //: 5 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for invalid arguments.  (C-6)
+        //
+        // Testing:
+        //   void allocate(BlobBuffer *);
+        //   int numCachedBuffers() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                        << "TESTING 'allocate' AND 'numCachedBuffers'" << endl
+                        << "=========================================" << endl;
+
+        bslma::TestAllocator ta("test", veryVeryVerbose);
+
+        enum { k_NUM_BUFFERS = 20 };
+
+        for (int bufferSize = 1; bufferSize <= 70; ++bufferSize) {
+            Obj mX(bufferSize, &ta);  const Obj& X = mX;
+
+            ASSERTV(bufferSize, 0 == X.numCachedBuffers());
+
+            bdlbb::BlobBuffer buffers[k_NUM_BUFFERS];
+            for (int i = 0; i < k_NUM_BUFFERS; ++i) {
+                mX.allocate(buffers + i);
+
+                ASSERTV(bufferSize, i, bufferSize == buffers[i].size());
+                ASSERTV(bufferSize, i,
+                        0 == bsls::AlignmentUtil::calculateAlignmentOffset(
+                                   buffers[i].data(),
+                                   bsls::AlignmentUtil::BSLS_MAX_ALIGNMENT));
+                ASSERTV(bufferSize, i, 1 == buffers[i].buffer().use_count());
+                bsl::memset(buffers[i].data(), i, bufferSize);
+            }
+            ASSERTV(bufferSize, 32 - k_NUM_BUFFERS == X.numCachedBuffers());
+
+            for (int i = 0; i < k_NUM_BUFFERS; ++i) {
+                for (int j = 0; j < bufferSize; ++j) {
+                    ASSERTV(bufferSize, i, j,
+                            static_cast<char>(i) == buffers[i].data()[j]);
+                }
+            }
+
+            // A copy keeps the buffer alive; the last release returns it to
+            // the cache, from which it is reused first.
+
+            char *const DATA = buffers[3].data();
+            {
+                bdlbb::BlobBuffer copy(buffers[3]);
+                buffers[3].reset();
+                ASSERTV(bufferSize,
+                        32 - k_NUM_BUFFERS == X.numCachedBuffers());
+                ASSERTV(bufferSize, static_cast<char>(3) == copy.data()[0]);
+            }
+            ASSERTV(bufferSize, 33 - k_NUM_BUFFERS == X.numCachedBuffers());
+
+            mX.allocate(buffers + 3);
+            ASSERTV(bufferSize, DATA == buffers[3].data());
+
+            for (int i = 0; i < k_NUM_BUFFERS; ++i) {
+                buffers[i].reset();
+            }
+            ASSERTV(bufferSize, 32 == X.numCachedBuffers());
+        }
+        ASSERT(0 == ta.numBytesInUse());
+
+        if (verbose) cout << "\nTesting the caching policy." << endl;
+
+        const int MAX_CACHED[] = { 0, 1, 2, 3, 8, 64 };
+        const int NUM_DATA     = static_cast<int>(sizeof MAX_CACHED
+                                                  / sizeof *MAX_CACHED);
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int MAX = MAX_CACHED[ti];
+
+            Obj mX(16, MAX, &ta);  const Obj& X = mX;
+
+            enum { k_MANY = 150 };
+
+            bdlbb::BlobBuffer buffers[k_MANY];
+
+            mX.allocate(buffers);
+            ASSERTV(MAX, bsl::max(1, MAX / 2) - 1 == X.numCachedBuffers());
+            buffers[0].reset();
+            ASSERTV(MAX, (MAX ? bsl::max(1, MAX / 2) : 0)
+                                                    == X.numCachedBuffers());
+
+            for (int i = 0; i < k_MANY; ++i) {
+                mX.allocate(buffers + i);
+                ASSERTV(MAX, i, X.numCachedBuffers() <= MAX);
+            }
+
+            // Releasing the buffers flushes the cache whenever it exceeds its
+            // maximum.
+
+            for (int i = 0; i < k_MANY; ++i) {
+                buffers[i].reset();
+                ASSERTV(MAX, i, X.numCachedBuffers() <= MAX);
+            }
+
+            // Allocating and releasing buffers now uses only the pool.
+
+            const Int64 NUM_ALLOCATIONS = ta.numAllocations();
+            for (int n = 0; n < 3; ++n) {
+                for (int i = 0; i < k_MANY; ++i) {
+                    mX.allocate(buffers + i);
+                }
+                for (int i = 0; i < k_MANY; ++i) {
+                    buffers[i].reset();
+                }
+            }
+            ASSERTV(MAX, NUM_ALLOCATIONS == ta.numAllocations());
+        }
+        ASSERT(0 == ta.numBytesInUse());
+
+        if (verbose) cout << "\nNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            Obj mX(8, &ta);
+
+            bdlbb::BlobBuffer buffer;
+
+            ASSERT_PASS(mX.allocate(&buffer));
+            ASSERT_FAIL(mX.allocate(static_cast<bdlbb::BlobBuffer *>(0)));
+        }
+        ASSERT(0 == ta.numBytesInUse());
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // TESTING CREATORS AND BASIC ACCESSORS
+        //
+        // Concerns:
+        //: 1 The constructors create a factory having the specified buffer
+        //:   size, maximum number of cached buffers (or the default), and
+        //:   allocator (or the default allocator).
+        //:
+        //: 2 Creating and destroying a factory that has not been used does not
+        //:   allocate memory.
+        //:
+        //: 3 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 Create factories using each constructor, and verify their
+        //:   attributes, and that no memory is allocated.  (C-1..2)
+        //:
+        //: 2 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for invalid arguments.  (C-3)
+        //
+        // Testing:
+        //   explicit CachedBlobBufferFactory(int, bslma::Allocator *);
+        //   CachedBlobBufferFactory(int, int, bslma::Allocator *);
+        //   ~CachedBlobBufferFactory();
+        //   int bufferSize() const;
+        //   int maxCachedBuffers() const;
+        //   bslma::Allocator *allocator() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING CREATORS AND BASIC ACCESSORS" << endl
+                          << "====================================" << endl;
+
+        bslma::TestAllocator ta("test", veryVeryVerbose);
+        {
+            Obj mX(100);                 const Obj& X = mX;
+            Obj mY(200, &ta);            const Obj& Y = mY;
+            Obj mZ(300, 5, &ta);         const Obj& Z = mZ;
+            Obj mW(400, 0);              const Obj& W = mW;
+
+            ASSERT(100 == X.bufferSize());
+            ASSERT(200 == Y.bufferSize());
+            ASSERT(300 == Z.bufferSize());
+            ASSERT(400 == W.bufferSize());
+
+            ASSERT(Obj::k_DEFAULT_MAX_CACHED_BUFFERS == X.maxCachedBuffers());
+            ASSERT(Obj::k_DEFAULT_MAX_CACHED_BUFFERS == Y.maxCachedBuffers());
+            ASSERT(5 == Z.maxCachedBuffers());
+            ASSERT(0 == W.maxCachedBuffers());
+
+            ASSERT(&defaultAllocator == X.allocator());
+            ASSERT(&ta               == Y.allocator());
+            ASSERT(&ta               == Z.allocator());
+            ASSERT(&defaultAllocator == W.allocator());
+
+            ASSERT(0 == X.numCachedBuffers());
+            ASSERT(0 == ta.numAllocations());
+            ASSERT(0 == defaultAllocator.numAllocations());
+        }
+
+        if (verbose) cout << "\nNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            ASSERT_FAIL(Obj(0, &ta));
+            ASSERT_PASS(Obj(1, &ta));
+            ASSERT_FAIL(Obj(1, -1, &ta));
+            ASSERT_PASS(Obj(1, 0, &ta));
+        }
+        ASSERT(0 == ta.numBytesInUse());
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Grow and shrink a blob using a factory, and verify the buffers.
+        //:   (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        bslma::TestAllocator ta("test", veryVeryVerbose);
+        {
+            Obj mX(64, &ta);  const Obj& X = mX;
+            ASSERT(64 == X.bufferSize());
+
+            bdlbb::Blob blob(&mX, &ta);
+            blob.setLength(1000);
+            ASSERT(16 == blob.numBuffers());
+            for (int i = 0; i < blob.numBuffers(); ++i) {
+                ASSERTV(i, 64 == blob.buffer(i).size());
+                bsl::memset(blob.buffer(i).data(), i, 64);
+            }
+            for (int i = 0; i < blob.numBuffers(); ++i) {
+                ASSERTV(i, static_cast<char>(i) == blob.buffer(i).data()[63]);
+            }
+
+            blob.removeAll();
+            ASSERT(32 == X.numCachedBuffers());
+
+            blob.setLength(64 * 40);
+            ASSERT(40 == blob.numBuffers());
+            blob.removeAll();
+            ASSERT(X.numCachedBuffers() <= X.maxCachedBuffers());
+        }
+        ASSERT(0 == ta.numBytesInUse());
+      } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // ALLOCATION BENCHMARK
+        //
+        // Concerns:
+        //: 1 Allocating and releasing buffers is faster using a
+        //:   'CachedBlobBufferFactory' than using a 'PooledBlobBufferFactory',
+        //:   in particular in many threads.
+        //
+        // Plan:
+        //: 1 In 1, 2, 4, and 8 threads, allocate and release batches of
+        //:   buffers using each factory.  Report the best of 5 runs.
+        //
+        // Testing:
+        //   ALLOCATION BENCHMARK
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "ALLOCATION BENCHMARK" << endl
+                          << "====================" << endl;
+
+        enum { k_MAX_THREADS = 8, k_NUM_OPERATIONS = 16 * 20000 };
+
+        bslma::TestAllocator ta("test", veryVeryVerbose);
+
+        for (int numThreads = 1; numThreads <= k_MAX_THREADS;
+                                                             numThreads *= 2) {
+            for (int kind = 0; kind < 2; ++kind) {
+                double best = 0;
+
+                for (int run = 0; run < 5; ++run) {
+                    bdlbb::PooledBlobBufferFactory pooled(4096, &ta);
+                    Obj                            cached(4096, &ta);
+
+                    bdlbb::BlobBufferFactory *factory = &pooled;
+                    if (kind) {
+                        factory = &cached;
+                    }
+
+                    bslmt::ThreadUtil::Handle handles[k_MAX_THREADS];
+
+                    bsls::Stopwatch timer;
+                    timer.start();
+                    for (int i = 0; i < numThreads; ++i) {
+                        bslmt::ThreadUtil::create(&handles[i],
+                                                  &churn,
+                                                  factory);
+                    }
+                    for (int i = 0; i < numThreads; ++i) {
+                        bslmt::ThreadUtil::join(handles[i]);
+                    }
+                    timer.stop();
+
+                    const double elapsed = timer.accumulatedWallTime();
+                    if (0 == run || elapsed < best) {
+                        best = elapsed;
+                    }
+                }
+
+                cout << (kind ? "CachedBlobBufferFactory" :
+                                "PooledBlobBufferFactory")
+                     << ", " << numThreads << " thread(s): "
+                     << best * 1e9 / k_NUM_OPERATIONS
+                     << " ns per allocation and release by each thread"
+                     << endl;
+            }
+        }
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    // CONCERN: In no case does memory come from the default allocator.
+
+    ASSERT(dam.isTotalSame());
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
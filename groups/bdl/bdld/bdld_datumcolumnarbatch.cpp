@@ -0,0 +1,733 @@
+// bdld_datumcolumnarbatch.cpp                                        -*-C++-*-
+#include <bdld_datumcolumnarbatch.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(bdld_datumcolumnarbatch.cpp,"$Id$ $CSID$")
+
+#include <bdld_datumarraybuilder.h>
+#include <bdld_datummapowningkeysbuilder.h>
+
+#include <bdlb_bitutil.h>
+
+#include <bslmf_assert.h>
+#include <bsls_assert.h>
+
+#include <bsl_algorithm.h>
+#include <bsl_climits.h>
+#include <bsl_functional.h>
+
+namespace BloombergLP {
+namespace bdld {
+
+namespace {
+
+enum {
+    k_BITS_PER_WORD = 64,  // rows per word of a validity bitmap
+
+    k_NO_TYPE       = -1   // type of a column having only null values
+};
+
+                            // ===================
+                            // struct ArrayElement
+                            // ===================
+
+template <class TYPE>
+struct ArrayElement {
+    // This 'struct' provides a functor returning an element of an array.
+
+    // DATA
+    const TYPE *d_data_p;  // array
+
+    // ACCESSORS
+    TYPE operator()(int index) const
+        // Return the element at the specified 'index'.
+    {
+        return d_data_p[index];
+    }
+};
+
+                           // =====================
+                           // struct IntegerElement
+                           // =====================
+
+struct IntegerElement {
+    // This 'struct' provides a functor returning an element of an array of
+    // 64-bit integers as a 'double'.
+
+    // DATA
+    const bsls::Types::Int64 *d_data_p;  // array
+
+    // ACCESSORS
+    double operator()(int index) const
+        // Return the element at the specified 'index'.
+    {
+        return static_cast<double>(d_data_p[index]);
+    }
+};
+
+                            // ====================
+                            // struct StringElement
+                            // ====================
+
+struct StringElement {
+    // This 'struct' provides a functor returning a string of a string column.
+
+    // DATA
+    const char        *d_characters_p;  // characters of the strings
+    const bsl::size_t *d_offsets_p;     // offset of each string
+    const bsl::size_t *d_lengths_p;     // length of each string
+
+    // ACCESSORS
+    bslstl::StringRef operator()(int index) const
+        // Return the string at the specified 'index'.
+    {
+        return bslstl::StringRef(d_characters_p + d_offsets_p[index],
+                                 d_lengths_p[index]);
+    }
+};
+
+int columnTypeOf(const Datum& value)
+    // Return the type of the column that can hold the specified (non-null)
+    // 'value'.
+{
+    switch (value.type()) {
+      case Datum::e_INTEGER: {
+        return DatumColumnarBatch::e_INTEGER;                         // RETURN
+      }
+      case Datum::e_INTEGER64: {
+        return DatumColumnarBatch::e_INTEGER64;                       // RETURN
+      }
+      case Datum::e_DOUBLE: {
+        return DatumColumnarBatch::e_DOUBLE;                          // RETURN
+      }
+      case Datum::e_BOOLEAN: {
+        return DatumColumnarBatch::e_BOOLEAN;                         // RETURN
+      }
+      case Datum::e_STRING: {
+        return DatumColumnarBatch::e_STRING;                          // RETURN
+      }
+      case Datum::e_DATE: {
+        return DatumColumnarBatch::e_DATE;                            // RETURN
+      }
+      default: {
+        return DatumColumnarBatch::e_DATUM;                           // RETURN
+      }
+    }
+}
+
+int columnOf(const DatumMapIndex& keys, const DatumMapRef& map, int entry)
+    // Return the index, in the specified 'keys', of the key of the specified
+    // 'entry' of the specified 'map', or -1 if 'keys' does not have that key.
+    // The key at the position of 'entry' is checked first, so that records
+    // having the keys in the same order are not hashed.
+{
+    const bslstl::StringRef& key = map[entry].key();
+
+    if (entry < keys.size() && keys.key(entry) == key) {
+        return entry;                                                 // RETURN
+    }
+    return keys.position(key);
+}
+
+template <class COMPARE, class ELEMENT, class VALUE>
+int selectRows(int                  *rows,
+               const bsl::uint64_t  *validity,
+               int                   numRows,
+               const ELEMENT&        element,
+               const VALUE&          value)
+    // Load the specified 'rows' with the indices of the rows, among the
+    // specified 'numRows' rows, whose bit is set in the specified 'validity'
+    // bitmap and whose value, returned by the specified 'element' functor,
+    // compares to the specified 'value' as 'COMPARE' does, and return the
+    // number of such rows.  The behavior is undefined unless 'rows' has room
+    // for 'numRows' indices.
+{
+    const COMPARE compare = COMPARE();
+
+    int count = 0;
+    for (int begin = 0; begin < numRows; begin += k_BITS_PER_WORD) {
+        const int length = bsl::min(static_cast<int>(k_BITS_PER_WORD),
+                                    numRows - begin);
+
+        // Compute the bitmask of the rows of this word that match, without
+        // branches, then visit its set bits.
+
+        bsl::uint64_t matches = 0;
+        for (int i = 0; i < length; ++i) {
+            matches |= static_cast<bsl::uint64_t>(
+                                   compare(element(begin + i), value)) << i;
+        }
+        matches &= validity[begin / k_BITS_PER_WORD];
+
+        while (matches) {
+            rows[count++] = begin + bdlb::BitUtil::numTrailingUnsetBits(
+                                                                      matches);
+            matches &= matches - 1;
+        }
+    }
+    return count;
+}
+
+template <class ELEMENT, class VALUE>
+void select(bsl::vector<int>                      *rows,
+            DatumColumnarBatch::Comparison         comparison,
+            const bsl::vector<bsl::uint64_t>&      validity,
+            int                                    numRows,
+            const ELEMENT&                         element,
+            const VALUE&                           value)
+    // Load the specified 'rows' with the indices of the rows, among the
+    // specified 'numRows' rows, whose bit is set in the specified 'validity'
+    // bitmap and whose value, returned by the specified 'element' functor,
+    // compares to the specified 'value' as indicated by the specified
+    // 'comparison'.
+{
+    rows->resize(numRows);
+
+    int *data  = rows->data();
+    int  count = 0;
+
+    switch (comparison) {
+      case DatumColumnarBatch::e_EQUAL: {
+        count = selectRows<bsl::equal_to<VALUE> >(
+                               data, validity.data(), numRows, element, value);
+      } break;
+      case DatumColumnarBatch::e_NOT_EQUAL: {
+        count = selectRows<bsl::not_equal_to<VALUE> >(
+                               data, validity.data(), numRows, element, value);
+      } break;
+      case DatumColumnarBatch::e_LESS: {
+        count = selectRows<bsl::less<VALUE> >(
+                               data, validity.data(), numRows, element, value);
+      } break;
+      case DatumColumnarBatch::e_LESS_EQUAL: {
+        count = selectRows<bsl::less_equal<VALUE> >(
+                               data, validity.data(), numRows, element, value);
+      } break;
+      case DatumColumnarBatch::e_GREATER: {
+        count = selectRows<bsl::greater<VALUE> >(
+                               data, validity.data(), numRows, element, value);
+      } break;
+      case DatumColumnarBatch::e_GREATER_EQUAL: {
+        count = selectRows<bsl::greater_equal<VALUE> >(
+                               data, validity.data(), numRows, element, value);
+      } break;
+      default: {
+        BSLS_ASSERT_OPT(!"Unknown comparison");
+      }
+    }
+    rows->resize(count);
+}
+
+template <class COMPARE, class ELEMENT>
+int findExtreme(double                            *result,
+                const bsl::vector<bsl::uint64_t>&  validity,
+                int                                numRows,
+                const ELEMENT&                     element)
+    // Load the specified 'result' with the value, returned by the specified
+    // 'element' functor, of a row among the specified 'numRows' rows whose bit
+    // is set in the specified 'validity' bitmap, such that no other such value
+    // compares before it as 'COMPARE' does.  Return 0 on success, and a
+    // non-zero value, with no effect on 'result', if no bit is set.
+{
+    const COMPARE compare = COMPARE();
+
+    bool   found = false;
+    double best  = 0;
+
+    for (int begin = 0; begin < numRows; begin += k_BITS_PER_WORD) {
+        const int           length = bsl::min(
+                                             static_cast<int>(k_BITS_PER_WORD),
+                                             numRows - begin);
+        const bsl::uint64_t all    = length == k_BITS_PER_WORD
+                                   ? ~static_cast<bsl::uint64_t>(0)
+                                   : (static_cast<bsl::uint64_t>(1) << length)
+                                                                          - 1;
+        bsl::uint64_t       word   = validity[begin / k_BITS_PER_WORD];
+
+        if (all == word) {
+            // All rows are valid: scan without consulting the bitmap.
+
+            double extreme = found ? best : element(begin);
+            for (int i = 0; i < length; ++i) {
+                const double value = element(begin + i);
+                extreme = compare(value, extreme) ? value : extreme;
+            }
+            best  = extreme;
+            found = true;
+            continue;
+        }
+
+        while (word) {
+            const double value = element(
+                           begin + bdlb::BitUtil::numTrailingUnsetBits(word));
+            if (!found || compare(value, best)) {
+                best  = value;
+                found = true;
+            }
+            word &= word - 1;
+        }
+    }
+
+    if (!found) {
+        return -1;                                                    // RETURN
+    }
+    *result = best;
+    return 0;
+}
+
+}  // close unnamed namespace
+
+                          // ------------------------
+                          // class DatumColumnarBatch
+                          // ------------------------
+
+// TRAITS
+BSLMF_ASSERT(bslma::UsesBslmaAllocator<DatumColumnarBatch>::value);
+
+                      // --------------------------------
+                      // struct DatumColumnarBatch::Column
+                      // --------------------------------
+
+// CREATORS
+DatumColumnarBatch::Column::Column(bslma::Allocator *basicAllocator)
+: d_type(e_DATUM)
+, d_validity(basicAllocator)
+, d_integers(basicAllocator)
+, d_doubles(basicAllocator)
+, d_dates(basicAllocator)
+, d_offsets(basicAllocator)
+, d_lengths(basicAllocator)
+, d_characters(basicAllocator)
+, d_datums(basicAllocator)
+{
+}
+
+DatumColumnarBatch::Column::Column(const Column&     original,
+                                   bslma::Allocator *basicAllocator)
+: d_type(original.d_type)
+, d_validity(original.d_validity, basicAllocator)
+, d_integers(original.d_integers, basicAllocator)
+, d_doubles(original.d_doubles, basicAllocator)
+, d_dates(original.d_dates, basicAllocator)
+, d_offsets(original.d_offsets, basicAllocator)
+, d_lengths(original.d_lengths, basicAllocator)
+, d_characters(original.d_characters, basicAllocator)
+, d_datums(original.d_datums, basicAllocator)
+{
+}
+
+// PRIVATE MANIPULATORS
+void DatumColumnarBatch::destroyValues()
+{
+    for (bsl::size_t i = 0; i < d_columns.size(); ++i) {
+        bsl::vector<Datum>& datums = d_columns[i].d_datums;
+        for (bsl::size_t j = 0; j < datums.size(); ++j) {
+            Datum::destroy(datums[j], allocator());
+        }
+        datums.clear();
+    }
+}
+
+// PRIVATE ACCESSORS
+Datum DatumColumnarBatch::cloneValue(int               column,
+                                     int               row,
+                                     bslma::Allocator *allocator) const
+{
+    const Column& theColumn = d_columns[column];
+
+    if (!isValid(column, row)) {
+        return Datum::createNull();                                   // RETURN
+    }
+
+    switch (theColumn.d_type) {
+      case e_INTEGER: {
+        return Datum::createInteger(                                  // RETURN
+                              static_cast<int>(theColumn.d_integers[row]));
+      }
+      case e_INTEGER64: {
+        return Datum::createInteger64(theColumn.d_integers[row],      // RETURN
+                                      allocator);
+      }
+      case e_DOUBLE: {
+        return Datum::createDouble(theColumn.d_doubles[row]);         // RETURN
+      }
+      case e_BOOLEAN: {
+        return Datum::createBoolean(0 != theColumn.d_integers[row]);  // RETURN
+      }
+      case e_STRING: {
+        return Datum::copyString(theString(column, row),              // RETURN
+                                 allocator);
+      }
+      case e_DATE: {
+        return Datum::createDate(theColumn.d_dates[row]);             // RETURN
+      }
+      default: {
+        return theColumn.d_datums[row].clone(allocator);              // RETURN
+      }
+    }
+}
+
+const DatumColumnarBatch::Column&
+DatumColumnarBatch::numericColumn(int index) const
+{
+    const Column& result = column(index);
+
+    BSLS_ASSERT(e_INTEGER   == result.d_type
+             || e_INTEGER64 == result.d_type
+             || e_DOUBLE    == result.d_type);
+
+    return result;
+}
+
+// CREATORS
+DatumColumnarBatch::DatumColumnarBatch(bslma::Allocator *basicAllocator)
+: d_keys(basicAllocator)
+, d_columns(basicAllocator)
+, d_numRows(0)
+{
+}
+
+DatumColumnarBatch::~DatumColumnarBatch()
+{
+    destroyValues();
+}
+
+// MANIPULATORS
+int DatumColumnarBatch::load(const DatumArrayRef& records)
+{
+    BSLS_ASSERT(records.length() <= static_cast<Datum::SizeType>(INT_MAX));
+
+    reset();
+
+    for (Datum::SizeType r = 0; r < records.length(); ++r) {
+        if (!records[r].isMap()) {
+            return -1;                                                // RETURN
+        }
+    }
+
+    // First, find the keys of the records, and the type of the values of each
+    // key.
+
+    bsl::vector<int> types(allocator());
+
+    for (Datum::SizeType r = 0; r < records.length(); ++r) {
+        const DatumMapRef map = records[r].theMap();
+
+        for (int i = 0; i < static_cast<int>(map.size()); ++i) {
+            int column = columnOf(d_keys, map, i);
+            if (0 > column) {
+                d_keys.intern(map[i].key());
+                types.push_back(k_NO_TYPE);
+                column = d_keys.size() - 1;
+            }
+
+            const Datum& value = map[i].value();
+            if (value.isNull()) {
+                continue;                                           // CONTINUE
+            }
+
+            const int type = columnTypeOf(value);
+            if (k_NO_TYPE == types[column]) {
+                types[column] = type;
+            }
+            else if (type != types[column]) {
+                types[column] = e_DATUM;
+            }
+        }
+    }
+
+    // Then, create the columns.
+
+    const int         numRows  = static_cast<int>(records.length());
+    const bsl::size_t numWords = (numRows + k_BITS_PER_WORD - 1)
+                                                             / k_BITS_PER_WORD;
+
+    d_columns.resize(types.size());
+    for (bsl::size_t c = 0; c < types.size(); ++c) {
+        Column& column = d_columns[c];
+
+        column.d_type = k_NO_TYPE == types[c]
+                      ? e_DATUM
+                      : static_cast<ColumnType>(types[c]);
+        column.d_validity.resize(numWords);
+
+        switch (column.d_type) {
+          case e_INTEGER:
+          case e_INTEGER64:
+          case e_BOOLEAN: {
+            column.d_integers.resize(numRows);
+          } break;
+          case e_DOUBLE: {
+            column.d_doubles.resize(numRows);
+          } break;
+          case e_STRING: {
+            column.d_offsets.resize(numRows);
+            column.d_lengths.resize(numRows);
+          } break;
+          case e_DATE: {
+            column.d_dates.resize(numRows);
+          } break;
+          default: {
+            column.d_datums.resize(numRows, Datum::createNull());
+          } break;
+        }
+    }
+    d_numRows = numRows;
+
+    // Finally, store the values.
+
+    for (int r = 0; r < numRows; ++r) {
+        const DatumMapRef   map  = records[r].theMap();
+        const bsl::size_t   word = r / k_BITS_PER_WORD;
+        const bsl::uint64_t bit  = static_cast<bsl::uint64_t>(1)
+                                                     << (r % k_BITS_PER_WORD);
+
+        for (int i = 0; i < static_cast<int>(map.size()); ++i) {
+            const Datum& value = map[i].value();
+            if (value.isNull()) {
+                continue;                                           // CONTINUE
+            }
+
+            Column& column = d_columns[columnOf(d_keys, map, i)];
+            if (column.d_validity[word] & bit) {
+                continue;                                           // CONTINUE
+            }
+            column.d_validity[word] |= bit;
+
+            switch (column.d_type) {
+              case e_INTEGER: {
+                column.d_integers[r] = value.theInteger();
+              } break;
+              case e_INTEGER64: {
+                column.d_integers[r] = value.theInteger64();
+              } break;
+              case e_DOUBLE: {
+                column.d_doubles[r] = value.theDouble();
+              } break;
+              case e_BOOLEAN: {
+                column.d_integers[r] = value.theBoolean();
+              } break;
+              case e_STRING: {
+                const bslstl::StringRef string = value.theString();
+
+                column.d_offsets[r] = column.d_characters.size();
+                column.d_lengths[r] = string.length();
+                column.d_characters.append(string.data(), string.length());
+              } break;
+              case e_DATE: {
+                column.d_dates[r] = value.theDate();
+              } break;
+              default: {
+                column.d_datums[r] = value.clone(allocator());
+              } break;
+            }
+        }
+    }
+    return 0;
+}
+
+void DatumColumnarBatch::reset()
+{
+    destroyValues();
+    d_columns.clear();
+    d_keys.reset();
+    d_numRows = 0;
+}
+
+// ACCESSORS
+Datum DatumColumnarBatch::toArray(bslma::Allocator *basicAllocator) const
+{
+    BSLS_ASSERT(basicAllocator);
+
+    const int numColumns = this->numColumns();
+
+    bsl::size_t keysCapacity = 0;
+    for (int c = 0; c < numColumns; ++c) {
+        keysCapacity += d_keys.key(c).length();
+    }
+
+    // Size the builders so that no value is pushed back into a builder that
+    // needs to grow (which could throw, leaking the value).
+
+    DatumArrayBuilder array(d_numRows, basicAllocator);
+    for (int r = 0; r < d_numRows; ++r) {
+        if (0 == numColumns) {
+            DatumMapOwningKeysBuilder map(basicAllocator);
+            array.pushBack(map.commit());
+            continue;                                               // CONTINUE
+        }
+
+        DatumMapOwningKeysBuilder map(numColumns,
+                                      keysCapacity,
+                                      basicAllocator);
+        for (int c = 0; c < numColumns; ++c) {
+            map.pushBack(d_keys.key(c), cloneValue(c, r, basicAllocator));
+        }
+        array.pushBack(map.commit());
+    }
+    return array.commit();
+}
+
+                                  // Scans
+
+int DatumColumnarBatch::count(int column) const
+{
+    const Column& theColumn = this->column(column);
+
+    int result = 0;
+    for (bsl::size_t i = 0; i < theColumn.d_validity.size(); ++i) {
+        result += bdlb::BitUtil::numBitsSet(theColumn.d_validity[i]);
+    }
+    return result;
+}
+
+void DatumColumnarBatch::filter(bsl::vector<int>  *rows,
+                                int                column,
+                                Comparison         comparison,
+                                double             value) const
+{
+    BSLS_ASSERT(rows);
+
+    const Column& theColumn = numericColumn(column);
+
+    if (e_DOUBLE == theColumn.d_type) {
+        const ArrayElement<double> element = { theColumn.d_doubles.data() };
+        select(rows,
+               comparison,
+               theColumn.d_validity,
+               d_numRows,
+               element,
+               value);
+    }
+    else {
+        const IntegerElement element = { theColumn.d_integers.data() };
+        select(rows,
+               comparison,
+               theColumn.d_validity,
+               d_numRows,
+               element,
+               value);
+    }
+}
+
+void DatumColumnarBatch::filter(bsl::vector<int>         *rows,
+                                int                       column,
+                                Comparison                comparison,
+                                const bslstl::StringRef&  value) const
+{
+    BSLS_ASSERT(rows);
+    BSLS_ASSERT(e_STRING == columnType(column));
+
+    const Column&       theColumn = d_columns[column];
+    const StringElement element   = { theColumn.d_characters.data(),
+                                      theColumn.d_offsets.data(),
+                                      theColumn.d_lengths.data() };
+    select(rows, comparison, theColumn.d_validity, d_numRows, element, value);
+}
+
+void DatumColumnarBatch::filter(bsl::vector<int>  *rows,
+                                int                column,
+                                Comparison         comparison,
+                                const bdlt::Date&  value) const
+{
+    BSLS_ASSERT(rows);
+    BSLS_ASSERT(e_DATE == columnType(column));
+
+    const Column&                  theColumn = d_columns[column];
+    const ArrayElement<bdlt::Date> element   = { theColumn.d_dates.data() };
+    select(rows, comparison, theColumn.d_validity, d_numRows, element, value);
+}
+
+int DatumColumnarBatch::maximum(double *result, int column) const
+{
+    BSLS_ASSERT(result);
+
+    const Column& theColumn = numericColumn(column);
+
+    if (e_DOUBLE == theColumn.d_type) {
+        const ArrayElement<double> element = { theColumn.d_doubles.data() };
+        return findExtreme<bsl::greater<double> >(result,             // RETURN
+                                                  theColumn.d_validity,
+                                                  d_numRows,
+                                                  element);
+    }
+    const IntegerElement element = { theColumn.d_integers.data() };
+    return findExtreme<bsl::greater<double> >(result,
+                                              theColumn.d_validity,
+                                              d_numRows,
+                                              element);
+}
+
+int DatumColumnarBatch::minimum(double *result, int column) const
+{
+    BSLS_ASSERT(result);
+
+    const Column& theColumn = numericColumn(column);
+
+    if (e_DOUBLE == theColumn.d_type) {
+        const ArrayElement<double> element = { theColumn.d_doubles.data() };
+        return findExtreme<bsl::less<double> >(result,                // RETURN
+                                               theColumn.d_validity,
+                                               d_numRows,
+                                               element);
+    }
+    const IntegerElement element = { theColumn.d_integers.data() };
+    return findExtreme<bsl::less<double> >(result,
+                                           theColumn.d_validity,
+                                           d_numRows,
+                                           element);
+}
+
+double DatumColumnarBatch::sum(int column) const
+{
+    const Column& theColumn = numericColumn(column);
+
+    // Invalid rows hold 0, so all rows are summed without consulting the
+    // validity bitmap.
+
+    if (e_DOUBLE == theColumn.d_type) {
+        // Use independent partial sums, so that the additions can proceed in
+        // parallel.
+
+        const double *data = theColumn.d_doubles.data();
+        double        sum0 = 0, sum1 = 0, sum2 = 0, sum3 = 0;
+
+        int i = 0;
+        for (; i + 4 <= d_numRows; i += 4) {
+            sum0 += data[i];
+            sum1 += data[i + 1];
+            sum2 += data[i + 2];
+            sum3 += data[i + 3];
+        }
+        for (; i < d_numRows; ++i) {
+            sum0 += data[i];
+        }
+        return (sum0 + sum1) + (sum2 + sum3);                         // RETURN
+    }
+
+    const bsls::Types::Int64 *data   = theColumn.d_integers.data();
+    bsls::Types::Int64        result = 0;
+    for (int i = 0; i < d_numRows; ++i) {
+        result += data[i];
+    }
+    return static_cast<double>(result);
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
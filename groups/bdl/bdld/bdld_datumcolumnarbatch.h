@@ -0,0 +1,596 @@
+// bdld_datumcolumnarbatch.h                                          -*-C++-*-
+#ifndef INCLUDED_BDLD_DATUMCOLUMNARBATCH
+#define INCLUDED_BDLD_DATUMCOLUMNARBATCH
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id$ $CSID$")
+
+//@PURPOSE: Provide a columnar representation of arrays of 'Datum' records.
+//
+//@CLASSES:
+//  bdld::DatumColumnarBatch: typed columns holding an array of 'Datum' maps
+//
+//@SEE_ALSO: bdld_datum, bdld_datummapindex
+//
+//@DESCRIPTION: This component provides a mechanism,
+// 'bdld::DatumColumnarBatch', that holds an array of *records* -- 'Datum'
+// maps, typically having the same keys -- as one *column* per key, each
+// holding the values of its key in every record, in a contiguous array of the
+// type of those values.  Compared to an array of 'Datum' maps, in which each
+// record holds its own keys and the type of each of its values, a batch holds
+// each key and type once, and holds the values of a key in adjacent memory,
+// which is much more compact, and much faster to scan.  In addition to access
+// to each value, a batch provides scans of a column: selecting the rows whose
+// value compares in a specified way to a specified value ('filter'), and
+// computing the 'count', 'sum', 'minimum', and 'maximum' of the values of a
+// column.
+//
+// A batch is loaded from a 'DatumArrayRef' of maps by 'load', and converted
+// back to a 'Datum' array of maps by 'toArray'.
+//
+///Column Types
+///------------
+// The type of a column is determined by the types of the (non-null) values of
+// its key in all records:
+//
+//: o 'e_INTEGER', 'e_INTEGER64', 'e_DOUBLE', 'e_BOOLEAN', 'e_STRING', and
+//:   'e_DATE': all values have the corresponding 'Datum' type.  The values of
+//:   'e_INTEGER', 'e_INTEGER64', and 'e_BOOLEAN' columns are held as 64-bit
+//:   integers, those of 'e_DOUBLE' columns as 'double', those of 'e_DATE'
+//:   columns as 'bdlt::Date', and the characters of the strings of an
+//:   'e_STRING' column in a single buffer.
+//:
+//: o 'e_DATUM': the values have other types (such as 'Datetime', or nested
+//:   arrays and maps), or have different types, or are all null.  The values
+//:   of an 'e_DATUM' column are held as copies of the 'Datum' values.
+//
+// Note that integer values of different sizes are *not* combined in one
+// 'e_INTEGER64' column, so that 'toArray' restores each value with its
+// original type.
+//
+///Validity
+///--------
+// Each column has a validity bitmap, holding one bit per row, which is set if
+// the record in that row has a non-null value for the key of the column.  A
+// record that does not have a key and a record that has a null value for the
+// key are both represented by an unset bit.  Note that 'toArray' creates
+// records having every key of the batch, in the order of the columns, with
+// null values for the unset bits; so records having different keys are not
+// restored exactly.
+//
+// Numeric columns hold 0 in the rows whose bit is unset, so that 'sum' need
+// not consult the bitmap.
+//
+///Scans
+///-----
+// The scans process the rows of a column 64 at a time, a word of the validity
+// bitmap at a time, in loops without branches that compilers can vectorize:
+// 'filter' computes a bitmask of the rows of a word that match the predicate,
+// masks it with the validity word, and converts the set bits to row numbers;
+// 'sum' adds all values (as invalid values are 0); and 'minimum' and
+// 'maximum' skip the bitmap checks for words whose rows are all valid.
+//
+// 'filter', 'sum', 'minimum', and 'maximum' operate on numeric columns (i.e.,
+// of type 'e_INTEGER', 'e_INTEGER64', or 'e_DOUBLE'), on whose values they
+// operate as 'double' values, and 'filter' also has overloads for 'e_STRING'
+// and 'e_DATE' columns.  Note that the sum of an integer column is computed
+// exactly, as a 64-bit integer, before it is converted to 'double'.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Analyzing Trades
+///- - - - - - - - - - - - - -
+// Suppose that we receive trades as 'Datum' maps, and need to analyze them.
+//
+// First, we create an array of trades:
+//..
+//  bslma::TestAllocator ta;
+//
+//  const char  *SYMBOLS[]    = { "IBM", "AAPL", "IBM", "MSFT", "IBM" };
+//  const double PRICES[]     = { 146.5, 189.25, 147.0, 402.75, 145.5 };
+//  const int    QUANTITIES[] = { 100,   50,     200,   10,     300   };
+//
+//  bdld::DatumArrayBuilder arrayBuilder(&ta);
+//  for (int i = 0; i < 5; ++i) {
+//      bdld::DatumMapBuilder builder(&ta);
+//      builder.pushBack("symbol",
+//                       bdld::Datum::createStringRef(SYMBOLS[i], &ta));
+//      builder.pushBack("price", bdld::Datum::createDouble(PRICES[i]));
+//      builder.pushBack("quantity",
+//                       bdld::Datum::createInteger(QUANTITIES[i]));
+//      arrayBuilder.pushBack(builder.commit());
+//  }
+//  bdld::Datum trades = arrayBuilder.commit();
+//..
+// Then, we load a batch with the trades:
+//..
+//  bdld::DatumColumnarBatch batch(&ta);
+//  int rc = batch.load(trades.theArray());
+//  assert(0 == rc);
+//
+//  assert(3 == batch.numColumns());
+//  assert(5 == batch.numRows());
+//
+//  const int SYMBOL   = batch.findColumn("symbol");
+//  const int PRICE    = batch.findColumn("price");
+//  const int QUANTITY = batch.findColumn("quantity");
+//
+//  assert(bdld::DatumColumnarBatch::e_STRING  == batch.columnType(SYMBOL));
+//  assert(bdld::DatumColumnarBatch::e_DOUBLE  == batch.columnType(PRICE));
+//  assert(bdld::DatumColumnarBatch::e_INTEGER == batch.columnType(QUANTITY));
+//..
+// Next, we compute the total quantity traded, and the range of the prices:
+//..
+//  assert(660 == batch.sum(QUANTITY));
+//
+//  double low, high;
+//  rc = batch.minimum(&low, PRICE);
+//  assert(0 == rc);
+//  rc = batch.maximum(&high, PRICE);
+//  assert(0 == rc);
+//  assert(145.5  == low);
+//  assert(402.75 == high);
+//..
+// Then, we select the trades of IBM, and compute their notional value:
+//..
+//  bsl::vector<int> rows(&ta);
+//  batch.filter(&rows, SYMBOL, bdld::DatumColumnarBatch::e_EQUAL, "IBM");
+//  assert(3 == rows.size());
+//
+//  double notional = 0;
+//  for (bsl::size_t i = 0; i < rows.size(); ++i) {
+//      notional += batch.theDouble(PRICE, rows[i])
+//                * batch.theInteger(QUANTITY, rows[i]);
+//  }
+//  assert(146.5 * 100 + 147.0 * 200 + 145.5 * 300 == notional);
+//..
+// Next, we select the trades of more than 100 shares:
+//..
+//  batch.filter(&rows, QUANTITY, bdld::DatumColumnarBatch::e_GREATER, 100);
+//  assert(2 == rows.size());
+//  assert(2 == rows[0]);
+//  assert(4 == rows[1]);
+//..
+// Then, we convert the batch back to an array of maps:
+//..
+//  bdld::Datum copy = batch.toArray(&ta);
+//  assert(copy == trades);
+//..
+// Finally, we destroy the arrays:
+//..
+//  bdld::Datum::destroy(copy, &ta);
+//  bdld::Datum::destroy(trades, &ta);
+//..
+
+#include <bdlscm_version.h>
+
+#include <bdld_datum.h>
+#include <bdld_datummapindex.h>
+
+#include <bdlt_date.h>
+
+#include <bslma_allocator.h>
+#include <bslma_usesbslmaallocator.h>
+
+#include <bslmf_nestedtraitdeclaration.h>
+
+#include <bsls_assert.h>
+#include <bsls_types.h>
+
+#include <bsl_cstddef.h>
+#include <bsl_cstdint.h>
+#include <bsl_string.h>
+#include <bsl_vector.h>
+
+namespace BloombergLP {
+namespace bdld {
+
+                          // ========================
+                          // class DatumColumnarBatch
+                          // ========================
+
+class DatumColumnarBatch {
+    // This class provides a columnar representation of an array of 'Datum'
+    // maps, holding the values of each key in a typed column, with a
+    // validity bitmap, and scans of those columns.
+
+  public:
+    // TYPES
+    enum ColumnType {
+        // Enumerate the types of the columns of a batch.
+
+        e_INTEGER   = 0,  // 'int' values, held as 64-bit integers
+        e_INTEGER64 = 1,  // 64-bit integer values
+        e_DOUBLE    = 2,  // 'double' values
+        e_BOOLEAN   = 3,  // 'bool' values, held as 64-bit integers
+        e_STRING    = 4,  // string values
+        e_DATE      = 5,  // 'bdlt::Date' values
+        e_DATUM     = 6   // values of other or different types, as 'Datum'
+    };
+
+    enum Comparison {
+        // Enumerate the comparisons of the values of a column to a value
+        // supported by 'filter'.
+
+        e_EQUAL         = 0,  // 'columnValue == value'
+        e_NOT_EQUAL     = 1,  // 'columnValue != value'
+        e_LESS          = 2,  // 'columnValue <  value'
+        e_LESS_EQUAL    = 3,  // 'columnValue <= value'
+        e_GREATER       = 4,  // 'columnValue >  value'
+        e_GREATER_EQUAL = 5   // 'columnValue >= value'
+    };
+
+  private:
+    // PRIVATE TYPES
+    struct Column {
+        // This 'struct' holds the values of a column.  Only the members used
+        // by the type of the column are populated.
+
+        // DATA
+        ColumnType                        d_type;        // type of column
+
+        bsl::vector<bsl::uint64_t>        d_validity;    // bit per row, set
+                                                         // if value is valid
+
+        bsl::vector<bsls::Types::Int64>   d_integers;    // 'e_INTEGER',
+                                                         // 'e_INTEGER64', and
+                                                         // 'e_BOOLEAN' values
+
+        bsl::vector<double>               d_doubles;     // 'e_DOUBLE' values
+
+        bsl::vector<bdlt::Date>           d_dates;       // 'e_DATE' values
+
+        bsl::vector<bsl::size_t>          d_offsets;     // offset of the
+                                                         // 'e_STRING' value of
+                                                         // each row in
+                                                         // 'd_characters'
+
+        bsl::vector<bsl::size_t>          d_lengths;     // length of the
+                                                         // 'e_STRING' value of
+                                                         // each row
+
+        bsl::string                       d_characters;  // characters of the
+                                                         // 'e_STRING' values
+
+        bsl::vector<Datum>                d_datums;      // 'e_DATUM' values
+                                                         // (owned)
+
+        // TRAITS
+        BSLMF_NESTED_TRAIT_DECLARATION(Column, bslma::UsesBslmaAllocator);
+
+        // CREATORS
+        explicit Column(bslma::Allocator *basicAllocator = 0);
+            // Create an empty 'e_DATUM' column.  Optionally specify a
+            // 'basicAllocator' used to supply memory.  If 'basicAllocator' is
+            // 0, the currently installed default allocator is used.
+
+        Column(const Column& original, bslma::Allocator *basicAllocator = 0);
+            // Create a column having the value of the specified 'original'
+            // column, sharing (rather than copying) its 'e_DATUM' values.
+            // Optionally specify a 'basicAllocator' used to supply memory.  If
+            // 'basicAllocator' is 0, the currently installed default allocator
+            // is used.
+    };
+
+    // DATA
+    DatumMapIndex       d_keys;      // key of each column, by position
+
+    bsl::vector<Column> d_columns;   // columns
+
+    int                 d_numRows;   // number of rows
+
+    // PRIVATE MANIPULATORS
+    void destroyValues();
+        // Destroy the 'e_DATUM' values held by this batch.
+
+    // PRIVATE ACCESSORS
+    Datum cloneValue(int column, int row, bslma::Allocator *allocator) const;
+        // Return a 'Datum' holding a copy of the value of the specified 'row'
+        // in the specified 'column', or a null 'Datum' if the row has no
+        // value in the column, using the specified 'allocator' to supply
+        // memory.
+
+    const Column& column(int index) const;
+        // Return a reference providing non-modifiable access to the column at
+        // the specified 'index'.  The behavior is undefined unless
+        // '0 <= index < numColumns()'.
+
+    const Column& numericColumn(int index) const;
+        // Return a reference providing non-modifiable access to the column at
+        // the specified 'index'.  The behavior is undefined unless
+        // '0 <= index < numColumns()' and the column has type 'e_INTEGER',
+        // 'e_INTEGER64', or 'e_DOUBLE'.
+
+  private:
+    // NOT IMPLEMENTED
+    DatumColumnarBatch(const DatumColumnarBatch&);
+    DatumColumnarBatch& operator=(const DatumColumnarBatch&);
+
+  public:
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(DatumColumnarBatch,
+                                   bslma::UsesBslmaAllocator);
+
+    // CREATORS
+    explicit DatumColumnarBatch(bslma::Allocator *basicAllocator = 0);
+        // Create an empty batch.  Optionally specify a 'basicAllocator' used
+        // to supply memory.  If 'basicAllocator' is 0, the currently installed
+        // default allocator is used.
+
+    ~DatumColumnarBatch();
+        // Destroy this object.
+
+    // MANIPULATORS
+    int load(const DatumArrayRef& records);
+        // Load this batch with the specified 'records', having one row per
+        // element of 'records', and one column per distinct key of the
+        // elements of 'records', in the order in which the keys first occur.
+        // Return 0 on success, and a non-zero value, leaving this batch
+        // empty, if an element of 'records' is not a map.  If a record has a
+        // key more than once, the first value of the key is used.  If an
+        // exception is thrown, this batch is left in a valid, but
+        // unspecified, state.
+
+    void reset();
+        // Remove all rows and columns from this batch.
+
+    // ACCESSORS
+    const bslstl::StringRef& columnKey(int column) const;
+        // Return the key of the specified 'column'.  The behavior is undefined
+        // unless '0 <= column < numColumns()'.
+
+    ColumnType columnType(int column) const;
+        // Return the type of the specified 'column'.  The behavior is
+        // undefined unless '0 <= column < numColumns()'.
+
+    int findColumn(const bslstl::StringRef& key) const;
+        // Return the index of the column having the specified 'key', or -1 if
+        // this batch has no such column.
+
+    bool isValid(int column, int row) const;
+        // Return 'true' if the specified 'row' has a (non-null) value in the
+        // specified 'column', and 'false' otherwise.  The behavior is
+        // undefined unless '0 <= column < numColumns()' and
+        // '0 <= row < numRows()'.
+
+    int numColumns() const;
+        // Return the number of columns in this batch.
+
+    int numRows() const;
+        // Return the number of rows in this batch.
+
+    bool theBoolean(int column, int row) const;
+    const Datum& theDatum(int column, int row) const;
+    bdlt::Date theDate(int column, int row) const;
+    double theDouble(int column, int row) const;
+    int theInteger(int column, int row) const;
+    bsls::Types::Int64 theInteger64(int column, int row) const;
+    bslstl::StringRef theString(int column, int row) const;
+        // Return the value of the specified 'row' in the specified 'column'.
+        // The behavior is undefined unless '0 <= column < numColumns()',
+        // '0 <= row < numRows()', 'isValid(column, row)' (except for
+        // 'theDatum', which returns a null 'Datum' for invalid rows), and the
+        // column has the type corresponding to the method.  Note that the
+        // string returned by 'theString' refers to the storage of this batch.
+
+    Datum toArray(bslma::Allocator *basicAllocator) const;
+        // Return a 'Datum' array holding one map for each row of this batch,
+        // holding (and owning) every key of this batch, in the order of the
+        // columns, with the value of the row in the column of that key, or a
+        // null value if the row has no value in that column, using the
+        // specified 'basicAllocator' to supply memory.  The caller is
+        // responsible for releasing the resources of the returned 'Datum'
+        // using 'Datum::destroy'.
+
+                                  // Scans
+
+    int count(int column) const;
+        // Return the number of rows having a (non-null) value in the
+        // specified 'column'.  The behavior is undefined unless
+        // '0 <= column < numColumns()'.
+
+    void filter(bsl::vector<int>  *rows,
+                int                column,
+                Comparison         comparison,
+                double             value) const;
+    void filter(bsl::vector<int>         *rows,
+                int                       column,
+                Comparison                comparison,
+                const bslstl::StringRef&  value) const;
+    void filter(bsl::vector<int>  *rows,
+                int                column,
+                Comparison         comparison,
+                const bdlt::Date&  value) const;
+        // Load the specified 'rows', in increasing order, with the rows having
+        // a (non-null) value in the specified 'column' that compares to the
+        // specified 'value' as indicated by the specified 'comparison'.  The
+        // behavior is undefined unless '0 <= column < numColumns()', and the
+        // column has type 'e_INTEGER', 'e_INTEGER64', or 'e_DOUBLE' (compared
+        // as 'double' values) for the first overload, type 'e_STRING'
+        // (compared lexicographically) for the second, and type 'e_DATE' for
+        // the third.
+
+    int maximum(double *result, int column) const;
+    int minimum(double *result, int column) const;
+        // Load the specified 'result' with the greatest (respectively least)
+        // of the (non-null) values in the specified 'column'.  Return 0 on
+        // success, and a non-zero value, with no effect on 'result', if the
+        // column has no (non-null) values.  The behavior is undefined unless
+        // '0 <= column < numColumns()', and the column has type 'e_INTEGER',
+        // 'e_INTEGER64', or 'e_DOUBLE'.
+
+    double sum(int column) const;
+        // Return the sum of the (non-null) values in the specified 'column',
+        // or 0 if it has none.  The behavior is undefined unless
+        // '0 <= column < numColumns()', and the column has type 'e_INTEGER',
+        // 'e_INTEGER64', or 'e_DOUBLE'.  Note that the values of an integer
+        // column are summed as 64-bit integers, and the behavior is undefined
+        // if that sum overflows, and that the values of an 'e_DOUBLE' column
+        // are summed in an unspecified order.
+
+                                  // Aspects
+
+    bslma::Allocator *allocator() const;
+        // Return the allocator used by this object to supply memory.
+};
+
+// ============================================================================
+//                            INLINE DEFINITIONS
+// ============================================================================
+
+                          // ------------------------
+                          // class DatumColumnarBatch
+                          // ------------------------
+
+// PRIVATE ACCESSORS
+inline
+const DatumColumnarBatch::Column& DatumColumnarBatch::column(int index) const
+{
+    BSLS_ASSERT(0 <= index);
+    BSLS_ASSERT(index < numColumns());
+
+    return d_columns[index];
+}
+
+// ACCESSORS
+inline
+const bslstl::StringRef& DatumColumnarBatch::columnKey(int column) const
+{
+    BSLS_ASSERT(0 <= column);
+    BSLS_ASSERT(column < numColumns());
+
+    return d_keys.key(column);
+}
+
+inline
+DatumColumnarBatch::ColumnType DatumColumnarBatch::columnType(int column) const
+{
+    return this->column(column).d_type;
+}
+
+inline
+int DatumColumnarBatch::findColumn(const bslstl::StringRef& key) const
+{
+    return d_keys.position(key);
+}
+
+inline
+bool DatumColumnarBatch::isValid(int column, int row) const
+{
+    BSLS_ASSERT(0 <= row);
+    BSLS_ASSERT(row < d_numRows);
+
+    return (this->column(column).d_validity[row / 64] >> (row % 64)) & 1;
+}
+
+inline
+int DatumColumnarBatch::numColumns() const
+{
+    return static_cast<int>(d_columns.size());
+}
+
+inline
+int DatumColumnarBatch::numRows() const
+{
+    return d_numRows;
+}
+
+inline
+bool DatumColumnarBatch::theBoolean(int column, int row) const
+{
+    BSLS_ASSERT(e_BOOLEAN == columnType(column));
+    BSLS_ASSERT(isValid(column, row));
+
+    return 0 != d_columns[column].d_integers[row];
+}
+
+inline
+const Datum& DatumColumnarBatch::theDatum(int column, int row) const
+{
+    BSLS_ASSERT(e_DATUM == columnType(column));
+    BSLS_ASSERT(0 <= row);
+    BSLS_ASSERT(row < d_numRows);
+
+    return d_columns[column].d_datums[row];
+}
+
+inline
+bdlt::Date DatumColumnarBatch::theDate(int column, int row) const
+{
+    BSLS_ASSERT(e_DATE == columnType(column));
+    BSLS_ASSERT(isValid(column, row));
+
+    return d_columns[column].d_dates[row];
+}
+
+inline
+double DatumColumnarBatch::theDouble(int column, int row) const
+{
+    BSLS_ASSERT(e_DOUBLE == columnType(column));
+    BSLS_ASSERT(isValid(column, row));
+
+    return d_columns[column].d_doubles[row];
+}
+
+inline
+int DatumColumnarBatch::theInteger(int column, int row) const
+{
+    BSLS_ASSERT(e_INTEGER == columnType(column));
+    BSLS_ASSERT(isValid(column, row));
+
+    return static_cast<int>(d_columns[column].d_integers[row]);
+}
+
+inline
+bsls::Types::Int64 DatumColumnarBatch::theInteger64(int column, int row) const
+{
+    BSLS_ASSERT(e_INTEGER64 == columnType(column));
+    BSLS_ASSERT(isValid(column, row));
+
+    return d_columns[column].d_integers[row];
+}
+
+inline
+bslstl::StringRef DatumColumnarBatch::theString(int column, int row) const
+{
+    BSLS_ASSERT(e_STRING == columnType(column));
+    BSLS_ASSERT(isValid(column, row));
+
+    const Column& theColumn = d_columns[column];
+    return bslstl::StringRef(theColumn.d_characters.data()
+                                                  + theColumn.d_offsets[row],
+                             theColumn.d_lengths[row]);
+}
+
+                                  // Scans
+
+                                  // Aspects
+
+inline
+bslma::Allocator *DatumColumnarBatch::allocator() const
+{
+    return d_keys.allocator();
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,1414 @@
+// bdld_datumcolumnarbatch.t.cpp                                      -*-C++-*-
+#include <bdld_datumcolumnarbatch.h>
+
+#include <bdld_datum.h>
+#include <bdld_datumarraybuilder.h>
+#include <bdld_datummapbuilder.h>
+
+#include <bdlt_date.h>
+#include <bdlt_datetime.h>
+
+#include <bslim_testutil.h>
+#include <bslma_testallocator.h>
+#include <bslma_testallocatormonitor.h>
+#include <bslma_default.h>
+
+#include <bsls_assert.h>
+#include <bsls_asserttest.h>
+#include <bsls_stopwatch.h>
+#include <bsls_types.h>
+
+#include <bsl_cstdio.h>
+#include <bsl_cstdlib.h>
+#include <bsl_iostream.h>
+#include <bsl_string.h>
+#include <bsl_vector.h>
+
+using namespace BloombergLP;
+using namespace BloombergLP::bdld;
+using namespace bsl;
+using namespace bslstl;
+
+//=============================================================================
+//                             TEST PLAN
+//-----------------------------------------------------------------------------
+//                              Overview
+//                              --------
+// The component under test is a columnar representation of arrays of 'Datum'
+// maps.  'load' and 'toArray' are tested by round trips, and by checking the
+// types and values of the columns against the records from which they were
+// loaded.  The scans are tested against straightforward loops over the rows,
+// for numbers of rows on both sides of the boundaries of the words of the
+// validity bitmaps.
+//-----------------------------------------------------------------------------
+// CREATORS
+// [ 2] explicit DatumColumnarBatch(bslma::Allocator *);
+// [ 2] ~DatumColumnarBatch();
+//
+// MANIPULATORS
+// [ 2] int load(const DatumArrayRef&);
+// [ 2] void reset();
+//
+// ACCESSORS
+// [ 2] const StringRef& columnKey(int) const;
+// [ 2] ColumnType columnType(int) const;
+// [ 2] int findColumn(const StringRef&) const;
+// [ 2] bool isValid(int, int) const;
+// [ 2] int numColumns() const;
+// [ 2] int numRows() const;
+// [ 2] bool theBoolean(int, int) const;
+// [ 2] const Datum& theDatum(int, int) const;
+// [ 2] bdlt::Date theDate(int, int) const;
+// [ 2] double theDouble(int, int) const;
+// [ 2] int theInteger(int, int) const;
+// [ 2] Int64 theInteger64(int, int) const;
+// [ 2] StringRef theString(int, int) const;
+// [ 3] Datum toArray(bslma::Allocator *) const;
+// [ 4] int count(int) const;
+// [ 5] void filter(vector<int> *, int, Comparison, double) const;
+// [ 5] void filter(vector<int> *, int, Comparison, const StringRef&) const;
+// [ 5] void filter(vector<int> *, int, Comparison, const Date&) const;
+// [ 4] int maximum(double *, int) const;
+// [ 4] int minimum(double *, int) const;
+// [ 4] double sum(int) const;
+// [ 2] bslma::Allocator *allocator() const;
+//
+// TRAITS
+// [ 6] bslma::UsesBslmaAllocator
+//-----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 7] USAGE EXAMPLE
+// [-1] SCAN BENCHMARK
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLIM_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLIM_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLIM_TESTUTIL_LOOP6_ASSERT
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                     NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_SAFE_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_PASS(EXPR)
+#define ASSERT_SAFE_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_FAIL(EXPR)
+#define ASSERT_PASS(EXPR)      BSLS_ASSERTTEST_ASSERT_PASS(EXPR)
+#define ASSERT_FAIL(EXPR)      BSLS_ASSERTTEST_ASSERT_FAIL(EXPR)
+#define ASSERT_OPT_PASS(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_PASS(EXPR)
+#define ASSERT_OPT_FAIL(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_FAIL(EXPR)
+
+// ============================================================================
+//                    GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef DatumColumnarBatch Obj;
+
+// Numbers of rows on both sides of the boundaries of the words of a validity
+// bitmap.
+
+const int ROW_COUNTS[]   = { 0, 1, 2, 63, 64, 65, 127, 128, 129, 200 };
+const int NUM_ROW_COUNTS = static_cast<int>(sizeof ROW_COUNTS
+                                            / sizeof *ROW_COUNTS);
+
+//=============================================================================
+//               GLOBAL HELPER CLASSES AND FUNCTIONS FOR TESTING
+//-----------------------------------------------------------------------------
+
+static unsigned int nextRandom(unsigned int *state)
+    // Advance the specified pseudo-random 'state', and return its new value.
+{
+    *state = *state * 1103515245 + 12345;
+    return (*state >> 8) & 0xFFFF;
+}
+
+static Datum makeRecords(int               numRows,
+                         unsigned int      seed,
+                         bslma::Allocator *allocator)
+    // Return a 'Datum' array of the specified 'numRows' maps, allocated using
+    // the specified 'allocator', having the keys "i", "j", "d", "s", and
+    // "t", whose values are pseudo-randomly generated from the specified
+    // 'seed': an 'int', an 'Int64', a 'double', a string, and a date, or,
+    // for about one value in 5, a null value.
+{
+    static const char *const STRINGS[] = { "", "a", "ab", "b", "ba", "bb" };
+
+    unsigned int state = seed;
+
+    DatumArrayBuilder array(allocator);
+    for (int r = 0; r < numRows; ++r) {
+        DatumMapBuilder map(allocator);
+
+        const unsigned int nulls = nextRandom(&state);
+        const int          value = static_cast<int>(nextRandom(&state) % 21)
+                                                                        - 10;
+
+        map.pushBack("i", nulls & 0x07 ? Datum::createInteger(value)
+                                       : Datum::createNull());
+        map.pushBack("j", nulls & 0x38
+                          ? Datum::createInteger64(
+                                    value * 1000000000000LL, allocator)
+                          : Datum::createNull());
+        map.pushBack("d", nulls & 0x1C0 ? Datum::createDouble(value * 0.5)
+                                        : Datum::createNull());
+        map.pushBack("s", nulls & 0xE00
+                          ? Datum::createStringRef(
+                                      STRINGS[(value + 10) % 6], allocator)
+                          : Datum::createNull());
+        map.pushBack("t", nulls & 0x7000
+                          ? Datum::createDate(bdlt::Date(2026, 1, value + 11))
+                          : Datum::createNull());
+        array.pushBack(map.commit());
+    }
+    return array.commit();
+}
+
+template <class TYPE>
+bool compare(Obj::Comparison comparison, const TYPE& lhs, const TYPE& rhs)
+    // Return 'true' if the specified 'lhs' compares to the specified 'rhs' as
+    // indicated by the specified 'comparison', and 'false' otherwise.
+{
+    switch (comparison) {
+      case Obj::e_EQUAL:         return lhs == rhs;                   // RETURN
+      case Obj::e_NOT_EQUAL:     return lhs != rhs;                   // RETURN
+      case Obj::e_LESS:          return lhs <  rhs;                   // RETURN
+      case Obj::e_LESS_EQUAL:    return lhs <= rhs;                   // RETURN
+      case Obj::e_GREATER:       return lhs >  rhs;                   // RETURN
+      case Obj::e_GREATER_EQUAL: return lhs >= rhs;                   // RETURN
+    }
+    return false;
+}
+
+static double numericValue(const Datum& value)
+    // Return the specified numeric 'value' as a 'double'.
+{
+    switch (value.type()) {
+      case Datum::e_INTEGER: {
+        return value.theInteger();                                    // RETURN
+      }
+      case Datum::e_INTEGER64: {
+        return static_cast<double>(value.theInteger64());             // RETURN
+      }
+      default: {
+        return value.theDouble();                                     // RETURN
+      }
+    }
+}
+
+//=============================================================================
+//                                 MAIN PROGRAM
+//-----------------------------------------------------------------------------
+int main(int argc, char *argv[])
+{
+    const int                 test = argc > 1 ? atoi(argv[1]) : 0;
+    const bool             verbose = argc > 2;
+    const bool         veryVerbose = argc > 3;
+    const bool     veryVeryVerbose = argc > 4;
+    const bool veryVeryVeryVerbose = argc > 5;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    // CONCERN: In no case does memory come from the default allocator.
+
+    bslma::TestAllocator defaultAllocator("default", veryVeryVeryVerbose);
+    ASSERT(0 == bslma::Default::setDefaultAllocator(&defaultAllocator));
+    bslma::TestAllocatorMonitor dam(&defaultAllocator);
+
+    // CONCERN: In no case does memory come from the global allocator.
+
+    bslma::TestAllocator globalAllocator("global", veryVeryVeryVerbose);
+    bslma::Default::setGlobalAllocator(&globalAllocator);
+    bslma::TestAllocatorMonitor gam(&globalAllocator);
+
+    switch (test) { case 0:  // Zero is always the leading case.
+      case 7: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl << "USAGE EXAMPLE" << endl
+                                  << "=============" << endl;
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Analyzing Trades
+///- - - - - - - - - - - - - -
+// Suppose that we receive trades as 'Datum' maps, and need to analyze them.
+//
+// First, we create an array of trades:
+//..
+    bslma::TestAllocator ta;
+
+    const char  *SYMBOLS[]    = { "IBM", "AAPL", "IBM", "MSFT", "IBM" };
+    const double PRICES[]     = { 146.5, 189.25, 147.0, 402.75, 145.5 };
+    const int    QUANTITIES[] = { 100,   50,     200,   10,     300   };
+
+    bdld::DatumArrayBuilder arrayBuilder(&ta);
+    for (int i = 0; i < 5; ++i) {
+        bdld::DatumMapBuilder builder(&ta);
+        builder.pushBack("symbol",
+                         bdld::Datum::createStringRef(SYMBOLS[i], &ta));
+        builder.pushBack("price", bdld::Datum::createDouble(PRICES[i]));
+        builder.pushBack("quantity",
+                         bdld::Datum::createInteger(QUANTITIES[i]));
+        arrayBuilder.pushBack(builder.commit());
+    }
+    bdld::Datum trades = arrayBuilder.commit();
+//..
+// Then, we load a batch with the trades:
+//..
+    bdld::DatumColumnarBatch batch(&ta);
+    int rc = batch.load(trades.theArray());
+    ASSERT(0 == rc);
+
+    ASSERT(3 == batch.numColumns());
+    ASSERT(5 == batch.numRows());
+
+    const int SYMBOL   = batch.findColumn("symbol");
+    const int PRICE    = batch.findColumn("price");
+    const int QUANTITY = batch.findColumn("quantity");
+
+    ASSERT(bdld::DatumColumnarBatch::e_STRING  == batch.columnType(SYMBOL));
+    ASSERT(bdld::DatumColumnarBatch::e_DOUBLE  == batch.columnType(PRICE));
+    ASSERT(bdld::DatumColumnarBatch::e_INTEGER == batch.columnType(QUANTITY));
+//..
+// Next, we compute the total quantity traded, and the range of the prices:
+//..
+    ASSERT(660 == batch.sum(QUANTITY));
+
+    double low, high;
+    rc = batch.minimum(&low, PRICE);
+    ASSERT(0 == rc);
+    rc = batch.maximum(&high, PRICE);
+    ASSERT(0 == rc);
+    ASSERT(145.5  == low);
+    ASSERT(402.75 == high);
+//..
+// Then, we select the trades of IBM, and compute their notional value:
+//..
+    bsl::vector<int> rows(&ta);
+    batch.filter(&rows, SYMBOL, bdld::DatumColumnarBatch::e_EQUAL, "IBM");
+    ASSERT(3 == rows.size());
+
+    double notional = 0;
+    for (bsl::size_t i = 0; i < rows.size(); ++i) {
+        notional += batch.theDouble(PRICE, rows[i])
+                  * batch.theInteger(QUANTITY, rows[i]);
+    }
+    ASSERT(146.5 * 100 + 147.0 * 200 + 145.5 * 300 == notional);
+//..
+// Next, we select the trades of more than 100 shares:
+//..
+    batch.filter(&rows, QUANTITY, bdld::DatumColumnarBatch::e_GREATER, 100);
+    ASSERT(2 == rows.size());
+    ASSERT(2 == rows[0]);
+    ASSERT(4 == rows[1]);
+//..
+// Then, we convert the batch back to an array of maps:
+//..
+    bdld::Datum copy = batch.toArray(&ta);
+    ASSERT(copy == trades);
+//..
+// Finally, we destroy the arrays:
+//..
+    bdld::Datum::destroy(copy, &ta);
+    bdld::Datum::destroy(trades, &ta);
+//..
+      } break;
+      case 6: {
+        // --------------------------------------------------------------------
+        // TESTING TRAITS
+        //
+        // Concerns:
+        //: 1 bslma::UsesBslmaAllocator is true for DatumColumnarBatch.
+        //
+        // Plan:
+        //: 1 Assert trait.  (C-1)
+        //
+        // Testing:
+        //   bslma::UsesBslmaAllocator
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING TRAITS" << endl
+                          << "==============" << endl;
+
+        ASSERT(bslma::UsesBslmaAllocator<Obj>::value);
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // TESTING 'filter'
+        //
+        // Concerns:
+        //: 1 'filter' selects, in increasing order, exactly the valid rows
+        //:   whose value compares to the value as indicated, for every
+        //:   comparison, for numeric, string, and date columns.
+        //:
+        //: 2 Rows in every position of the words of the validity bitmap are
+        //:   selected correctly.
+        //:
+        //: 3 The previous contents of the result are discarded.
+        //:
+        //: 4 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 For numbers of rows on both sides of the word boundaries, load a
+        //:   batch with pseudo-random records, and filter each column with
+        //:   every comparison to several values, comparing the result with a
+        //:   loop over the records.  (C-1..3)
+        //:
+        //: 2 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for columns of the wrong type.  (C-4)
+        //
+        // Testing:
+        //   void filter(vector<int> *, int, Comparison, double) const;
+        //   void filter(vector<int> *, int, Comparison, const StringRef&)...
+        //   void filter(vector<int> *, int, Comparison, const Date&) const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING 'filter'" << endl
+                          << "================" << endl;
+
+        static const char *const NUMERIC_KEYS[] = { "i", "j", "d" };
+        const double             NUMBERS[]      = { -20, -3, -2.5, 0, 4,
+                                                    3e12, 20 };
+        const char *const        STRINGS[]      = { "", "a", "ab", "b", "c" };
+        const bdlt::Date         DATES[]        = { bdlt::Date(2026, 1, 1),
+                                                    bdlt::Date(2026, 1, 11),
+                                                    bdlt::Date(2026, 1, 21),
+                                                    bdlt::Date(2026, 2, 1) };
+
+        bslma::TestAllocator ta("test", veryVeryVerbose);
+
+        for (int ti = 0; ti < NUM_ROW_COUNTS; ++ti) {
+            const int NUM_ROWS = ROW_COUNTS[ti];
+
+            if (veryVerbose) { T_ P(NUM_ROWS) }
+
+            const Datum         D       = makeRecords(NUM_ROWS, ti, &ta);
+            const DatumArrayRef RECORDS = D.theArray();
+
+            Obj mX(&ta);  const Obj& X = mX;
+            ASSERTV(NUM_ROWS, 0 == mX.load(RECORDS));
+
+            bsl::vector<int> rows(&ta);
+            bsl::vector<int> expected(&ta);
+
+            for (int op = Obj::e_EQUAL; op <= Obj::e_GREATER_EQUAL; ++op) {
+                const Obj::Comparison COMPARISON =
+                                             static_cast<Obj::Comparison>(op);
+
+                for (int k = 0; k < 3; ++k) {
+                    const int COLUMN = NUM_ROWS
+                                     ? X.findColumn(NUMERIC_KEYS[k])
+                                     : -1;
+                    if (0 > COLUMN) {
+                        continue;                                   // CONTINUE
+                    }
+                    for (int v = 0; v < 7; ++v) {
+                        rows.assign(3, -1);
+                        X.filter(&rows, COLUMN, COMPARISON, NUMBERS[v]);
+
+                        expected.clear();
+                        for (int r = 0; r < NUM_ROWS; ++r) {
+                            const Datum *value =
+                                  RECORDS[r].theMap().find(NUMERIC_KEYS[k]);
+                            if (!value->isNull()
+                             && compare(COMPARISON,
+                                        numericValue(*value),
+                                        NUMBERS[v])) {
+                                expected.push_back(r);
+                            }
+                        }
+                        ASSERTV(NUM_ROWS, op, k, v, expected == rows);
+                    }
+                }
+
+                if (0 == NUM_ROWS) {
+                    continue;                                       // CONTINUE
+                }
+
+                for (int v = 0; v < 5; ++v) {
+                    X.filter(&rows, X.findColumn("s"), COMPARISON, STRINGS[v]);
+
+                    expected.clear();
+                    for (int r = 0; r < NUM_ROWS; ++r) {
+                        const Datum *value = RECORDS[r].theMap().find("s");
+                        if (!value->isNull()
+                         && compare(COMPARISON,
+                                    value->theString(),
+                                    StringRef(STRINGS[v]))) {
+                            expected.push_back(r);
+                        }
+                    }
+                    ASSERTV(NUM_ROWS, op, v, expected == rows);
+                }
+
+                for (int v = 0; v < 4; ++v) {
+                    X.filter(&rows, X.findColumn("t"), COMPARISON, DATES[v]);
+
+                    expected.clear();
+                    for (int r = 0; r < NUM_ROWS; ++r) {
+                        const Datum *value = RECORDS[r].theMap().find("t");
+                        if (!value->isNull()
+                         && compare(COMPARISON, value->theDate(), DATES[v])) {
+                            expected.push_back(r);
+                        }
+                    }
+                    ASSERTV(NUM_ROWS, op, v, expected == rows);
+                }
+            }
+            Datum::destroy(D, &ta);
+        }
+
+        if (verbose) cout << "\nNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            const Datum D = makeRecords(10, 0, &ta);
+
+            Obj mX(&ta);  const Obj& X = mX;
+            ASSERT(0 == mX.load(D.theArray()));
+
+            const int S = X.findColumn("s");
+            const int T = X.findColumn("t");
+            const int I = X.findColumn("i");
+
+            bsl::vector<int> rows(&ta);
+
+            ASSERT_FAIL(X.filter(0,     I, Obj::e_LESS, 1.0));
+            ASSERT_PASS(X.filter(&rows, I, Obj::e_LESS, 1.0));
+            ASSERT_FAIL(X.filter(&rows, S, Obj::e_LESS, 1.0));
+            ASSERT_FAIL(X.filter(&rows, 5, Obj::e_LESS, 1.0));
+
+            ASSERT_PASS(X.filter(&rows, S, Obj::e_LESS, "a"));
+            ASSERT_FAIL(X.filter(&rows, T, Obj::e_LESS, "a"));
+
+            ASSERT_PASS(X.filter(&rows, T, Obj::e_LESS, bdlt::Date()));
+            ASSERT_FAIL(X.filter(&rows, I, Obj::e_LESS, bdlt::Date()));
+
+            Datum::destroy(D, &ta);
+        }
+        ASSERT(0 == ta.numBytesInUse());
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // TESTING 'count', 'sum', 'minimum', AND 'maximum'
+        //
+        // Concerns:
+        //: 1 'count' returns the number of valid rows of any column.
+        //:
+        //: 2 'sum', 'minimum', and 'maximum' compute the sum, least, and
+        //:   greatest of the valid values of numeric columns, ignoring invalid
+        //:   rows, for any number of rows.
+        //:
+        //: 3 'minimum' and 'maximum' return a non-zero value, and do not
+        //:   modify the result, if a column has no valid values.
+        //:
+        //: 4 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 For numbers of rows on both sides of the word boundaries, load a
+        //:   batch with pseudo-random records, and compare the results of the
+        //:   scans of each column with loops over the records.  (C-1..2)
+        //:
+        //: 2 Load a batch with records whose numeric values are all null, or
+        //:   all valid, and verify the results.  (C-2..3)
+        //:
+        //: 3 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for columns of the wrong type.  (C-4)
+        //
+        // Testing:
+        //   int count(int) const;
+        //   int maximum(double *, int) const;
+        //   int minimum(double *, int) const;
+        //   double sum(int) const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                << "TESTING 'count', 'sum', 'minimum', AND 'maximum'" << endl
+                << "================================================" << endl;
+
+        static const char *const KEYS[] = { "i", "j", "d", "s", "t" };
+
+        bslma::TestAllocator ta("test", veryVeryVerbose);
+
+        for (int ti = 0; ti < NUM_ROW_COUNTS; ++ti) {
+            const int NUM_ROWS = ROW_COUNTS[ti];
+
+            if (veryVerbose) { T_ P(NUM_ROWS) }
+
+            const Datum         D       = makeRecords(NUM_ROWS, ti + 7, &ta);
+            const DatumArrayRef RECORDS = D.theArray();
+
+            Obj mX(&ta);  const Obj& X = mX;
+            ASSERTV(NUM_ROWS, 0 == mX.load(RECORDS));
+
+            for (int k = 0; 0 < NUM_ROWS && k < 5; ++k) {
+                const int COLUMN  = X.findColumn(KEYS[k]);
+                const bool NUMERIC = k < 3;
+
+                int    count = 0;
+                double sum   = 0;
+                double low   = 0;
+                double high  = 0;
+                for (int r = 0; r < NUM_ROWS; ++r) {
+                    const Datum *value = RECORDS[r].theMap().find(KEYS[k]);
+                    if (value->isNull()) {
+                        continue;                                   // CONTINUE
+                    }
+                    if (NUMERIC) {
+                        const double NUMBER = numericValue(*value);
+
+                        sum += NUMBER;
+                        low  = 0 == count || NUMBER < low  ? NUMBER : low;
+                        high = 0 == count || NUMBER > high ? NUMBER : high;
+                    }
+                    ++count;
+                }
+
+                ASSERTV(NUM_ROWS, k, count == X.count(COLUMN));
+
+                if (!NUMERIC) {
+                    continue;                                       // CONTINUE
+                }
+
+                // The values are multiples of 0.5 small enough to be summed
+                // exactly in any order.
+
+                ASSERTV(NUM_ROWS, k, sum == X.sum(COLUMN));
+
+                double result = -99;
+                ASSERTV(NUM_ROWS, k, (0 == count) ==
+                                        (0 != X.minimum(&result, COLUMN)));
+                ASSERTV(NUM_ROWS, k, (count ? low : -99) == result);
+
+                result = -99;
+                ASSERTV(NUM_ROWS, k, (0 == count) ==
+                                        (0 != X.maximum(&result, COLUMN)));
+                ASSERTV(NUM_ROWS, k, (count ? high : -99) == result);
+            }
+            Datum::destroy(D, &ta);
+        }
+
+        if (verbose) cout << "\nTesting all-valid and all-null columns."
+                          << endl;
+        for (int ti = 0; ti < NUM_ROW_COUNTS; ++ti) {
+            const int NUM_ROWS = ROW_COUNTS[ti];
+
+            if (veryVerbose) { T_ P(NUM_ROWS) }
+
+            // The values of "v" are all valid, and decrease, then increase,
+            // so that the extremes are not at the ends.  The values of "n" are
+            // all null, except in the first row, whose value is a double, so
+            // that the column has type 'e_DOUBLE'.
+
+            DatumArrayBuilder array(&ta);
+            for (int r = 0; r < NUM_ROWS; ++r) {
+                DatumMapBuilder map(&ta);
+                map.pushBack("v", Datum::createDouble(
+                                 (r - NUM_ROWS / 3) * (r - NUM_ROWS / 3) + 1));
+                map.pushBack("n", 0 == r ? Datum::createDouble(-5)
+                                         : Datum::createNull());
+                array.pushBack(map.commit());
+            }
+            const Datum D = array.commit();
+
+            Obj mX(&ta);  const Obj& X = mX;
+            ASSERTV(NUM_ROWS, 0 == mX.load(D.theArray()));
+
+            if (0 == NUM_ROWS) {
+                Datum::destroy(D, &ta);
+                continue;                                           // CONTINUE
+            }
+
+            const int V = X.findColumn("v");
+            const int N = X.findColumn("n");
+
+            double low = 0, high = 0, sum = 0;
+            for (int r = 0; r < NUM_ROWS; ++r) {
+                const double VALUE = (r - NUM_ROWS / 3) * (r - NUM_ROWS / 3)
+                                   + 1;
+                low   = 0 == r || VALUE < low  ? VALUE : low;
+                high  = 0 == r || VALUE > high ? VALUE : high;
+                sum  += VALUE;
+            }
+
+            double result = 0;
+            ASSERTV(NUM_ROWS, NUM_ROWS == X.count(V));
+            ASSERTV(NUM_ROWS, sum      == X.sum(V));
+            ASSERTV(NUM_ROWS, 0 == X.minimum(&result, V));
+            ASSERTV(NUM_ROWS, low      == result);
+            ASSERTV(NUM_ROWS, 0 == X.maximum(&result, V));
+            ASSERTV(NUM_ROWS, high     == result);
+
+            ASSERTV(NUM_ROWS, 1  == X.count(N));
+            ASSERTV(NUM_ROWS, -5 == X.sum(N));
+            ASSERTV(NUM_ROWS, 0 == X.minimum(&result, N));
+            ASSERTV(NUM_ROWS, -5 == result);
+            ASSERTV(NUM_ROWS, 0 == X.maximum(&result, N));
+            ASSERTV(NUM_ROWS, -5 == result);
+
+            Datum::destroy(D, &ta);
+        }
+
+        if (verbose) cout << "\nNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            const Datum D = makeRecords(10, 0, &ta);
+
+            Obj mX(&ta);  const Obj& X = mX;
+            ASSERT(0 == mX.load(D.theArray()));
+
+            const int I = X.findColumn("i");
+            const int S = X.findColumn("s");
+
+            double result;
+
+            ASSERT_FAIL(X.count(-1));
+            ASSERT_PASS(X.count(S));
+            ASSERT_FAIL(X.count(5));
+
+            ASSERT_PASS(X.sum(I));
+            ASSERT_FAIL(X.sum(S));
+
+            ASSERT_PASS(X.minimum(&result, I));
+            ASSERT_FAIL(X.minimum(0,       I));
+            ASSERT_FAIL(X.minimum(&result, S));
+
+            ASSERT_PASS(X.maximum(&result, I));
+            ASSERT_FAIL(X.maximum(0,       I));
+            ASSERT_FAIL(X.maximum(&result, S));
+
+            Datum::destroy(D, &ta);
+        }
+        ASSERT(0 == ta.numBytesInUse());
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // TESTING 'toArray'
+        //
+        // Concerns:
+        //: 1 'toArray' returns records equal to the records from which the
+        //:   batch was loaded, if they all have the same keys in the same
+        //:   order, for all types of values, including null values.
+        //:
+        //: 2 Records missing keys are returned with null values for those
+        //:   keys, in the order of the columns.
+        //:
+        //: 3 The returned array is independent of the batch, owns its keys,
+        //:   and all of its memory is supplied by the specified allocator.
+        //
+        // Plan:
+        //: 1 For numbers of rows on both sides of the word boundaries, load a
+        //:   batch with pseudo-random records, convert it back to an array,
+        //:   and compare the arrays, after resetting the batch.  (C-1, 3)
+        //:
+        //: 2 Convert a batch of records having values of every type, and a
+        //:   batch of records missing some keys, and verify the results.
+        //:   (C-1..3)
+        //
+        // Testing:
+        //   Datum toArray(bslma::Allocator *) const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING 'toArray'" << endl
+                          << "=================" << endl;
+
+        bslma::TestAllocator ta("test", veryVeryVerbose);
+        bslma::TestAllocator oa("object", veryVeryVerbose);
+
+        for (int ti = 0; ti < NUM_ROW_COUNTS; ++ti) {
+            const int NUM_ROWS = ROW_COUNTS[ti];
+
+            if (veryVerbose) { T_ P(NUM_ROWS) }
+
+            const Datum D = makeRecords(NUM_ROWS, ti + 13, &ta);
+
+            Obj mX(&ta);  const Obj& X = mX;
+            ASSERTV(NUM_ROWS, 0 == mX.load(D.theArray()));
+
+            const Datum COPY = X.toArray(&oa);
+            mX.reset();
+
+            ASSERTV(NUM_ROWS, D == COPY);
+            ASSERTV(NUM_ROWS, (0 < NUM_ROWS) == (0 < oa.numBytesInUse()));
+
+            for (int r = 0; r < NUM_ROWS; ++r) {
+                ASSERTV(NUM_ROWS, r, COPY.theArray()[r].theMap().ownsKeys());
+            }
+
+            Datum::destroy(COPY, &oa);
+            Datum::destroy(D, &ta);
+            ASSERTV(NUM_ROWS, 0 == oa.numBytesInUse());
+        }
+
+        if (verbose) cout << "\nTesting all types of values." << endl;
+        {
+            const bdlt::Datetime DATETIME(2026, 10, 19, 12, 30);
+
+            DatumArrayBuilder array(&ta);
+            for (int r = 0; r < 3; ++r) {
+                DatumArrayBuilder nested(&ta);
+                nested.pushBack(Datum::createInteger(r));
+
+                DatumMapBuilder map(&ta);
+                map.pushBack("int",     Datum::createInteger(r));
+                map.pushBack("int64",   Datum::createInteger64(r, &ta));
+                map.pushBack("double",  Datum::createDouble(r / 4.0));
+                map.pushBack("bool",    Datum::createBoolean(r % 2));
+                map.pushBack("string",  Datum::copyString(
+                                        "a string longer than a short string",
+                                        r,
+                                        &ta));
+                map.pushBack("date",
+                             Datum::createDate(bdlt::Date(2026, 1, r + 1)));
+                map.pushBack("datetime",
+                             Datum::createDatetime(DATETIME, &ta));
+                map.pushBack("array",   nested.commit());
+                map.pushBack("mixed",   r ? Datum::createInteger(r)
+                                          : Datum::createDouble(0.5));
+                map.pushBack("null",    Datum::createNull());
+                array.pushBack(map.commit());
+            }
+            const Datum D = array.commit();
+
+            Obj mX(&ta);  const Obj& X = mX;
+            ASSERT(0 == mX.load(D.theArray()));
+
+            ASSERT(10 == X.numColumns());
+            ASSERT(Obj::e_INTEGER   == X.columnType(0));
+            ASSERT(Obj::e_INTEGER64 == X.columnType(1));
+            ASSERT(Obj::e_DOUBLE    == X.columnType(2));
+            ASSERT(Obj::e_BOOLEAN   == X.columnType(3));
+            ASSERT(Obj::e_STRING    == X.columnType(4));
+            ASSERT(Obj::e_DATE      == X.columnType(5));
+            ASSERT(Obj::e_DATUM     == X.columnType(6));
+            ASSERT(Obj::e_DATUM     == X.columnType(7));
+            ASSERT(Obj::e_DATUM     == X.columnType(8));
+            ASSERT(Obj::e_DATUM     == X.columnType(9));
+
+            const Datum COPY = X.toArray(&oa);
+            mX.reset();
+
+            ASSERT(D == COPY);
+
+            Datum::destroy(COPY, &oa);
+            Datum::destroy(D, &ta);
+            ASSERT(0 == oa.numBytesInUse());
+        }
+
+        if (verbose) cout << "\nTesting records missing keys." << endl;
+        {
+            // Records having the keys "a" and "b", "b" and "c", and none.
+
+            DatumArrayBuilder array(&ta);
+            {
+                DatumMapBuilder map(&ta);
+                map.pushBack("a", Datum::createInteger(1));
+                map.pushBack("b", Datum::createInteger(2));
+                array.pushBack(map.commit());
+            }
+            {
+                DatumMapBuilder map(&ta);
+                map.pushBack("b", Datum::createInteger(3));
+                map.pushBack("c", Datum::createInteger(4));
+                array.pushBack(map.commit());
+            }
+            {
+                DatumMapBuilder map(&ta);
+                array.pushBack(map.commit());
+            }
+            const Datum D = array.commit();
+
+            Obj mX(&ta);  const Obj& X = mX;
+            ASSERT(0 == mX.load(D.theArray()));
+
+            const Datum         COPY = X.toArray(&oa);
+            const DatumArrayRef ARRAY = COPY.theArray();
+
+            ASSERT(3 == ARRAY.length());
+            for (int r = 0; r < 3; ++r) {
+                const DatumMapRef MAP = ARRAY[r].theMap();
+
+                ASSERTV(r, 3   == MAP.size());
+                ASSERTV(r, "a" == MAP[0].key());
+                ASSERTV(r, "b" == MAP[1].key());
+                ASSERTV(r, "c" == MAP[2].key());
+            }
+            ASSERT(Datum::createInteger(1) == ARRAY[0].theMap()[0].value());
+            ASSERT(Datum::createInteger(2) == ARRAY[0].theMap()[1].value());
+            ASSERT(Datum::createNull()     == ARRAY[0].theMap()[2].value());
+            ASSERT(Datum::createNull()     == ARRAY[1].theMap()[0].value());
+            ASSERT(Datum::createInteger(3) == ARRAY[1].theMap()[1].value());
+            ASSERT(Datum::createInteger(4) == ARRAY[1].theMap()[2].value());
+            for (int c = 0; c < 3; ++c) {
+                ASSERTV(c, ARRAY[2].theMap()[c].value().isNull());
+            }
+
+            Datum::destroy(COPY, &oa);
+            Datum::destroy(D, &ta);
+        }
+
+        if (verbose) cout << "\nTesting an empty batch." << endl;
+        {
+            Obj mX(&ta);  const Obj& X = mX;
+
+            const Datum COPY = X.toArray(&oa);
+
+            ASSERT(COPY.isArray());
+            ASSERT(0 == COPY.theArray().length());
+
+            Datum::destroy(COPY, &oa);
+        }
+        ASSERT(0 == ta.numBytesInUse());
+        ASSERT(0 == oa.numBytesInUse());
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // TESTING 'load' AND BASIC ACCESSORS
+        //
+        // Concerns:
+        //: 1 A default-constructed batch is empty, and uses the specified (or
+        //:   default) allocator.
+        //:
+        //: 2 'load' creates one column per distinct key, in the order in
+        //:   which the keys first occur, and one row per record.
+        //:
+        //: 3 The type of a column is that of its non-null values, or
+        //:   'e_DATUM' if they have different types, other types, or if all
+        //:   values are null.
+        //:
+        //: 4 The validity bit of each row and column is set if and only if
+        //:   the record has a non-null value for the key, and the typed
+        //:   accessors return those values.
+        //:
+        //: 5 If a record has a key more than once, the first value is used.
+        //:
+        //: 6 'load' fails, leaving the batch empty, if an element is not a
+        //:   map.
+        //:
+        //: 7 'load' and 'reset' discard the previous contents of the batch,
+        //:   and all memory is released on destruction.
+        //:
+        //: 8 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 Create a batch, and verify that it is empty.  (C-1)
+        //:
+        //: 2 For numbers of rows on both sides of the word boundaries, load a
+        //:   batch with pseudo-random records, and verify its columns, types,
+        //:   validity bits, and values against the records.  (C-2..4, 7)
+        //:
+        //: 3 Load records having keys in different orders, missing keys, and
+        //:   duplicate keys, and verify the columns.  (C-2, 3, 5)
+        //:
+        //: 4 Load an array holding a non-map element.  (C-6)
+        //:
+        //: 5 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for invalid columns, rows, and types.  (C-8)
+        //
+        // Testing:
+        //   explicit DatumColumnarBatch(bslma::Allocator *);
+        //   ~DatumColumnarBatch();
+        //   int load(const DatumArrayRef&);
+        //   void reset();
+        //   const StringRef& columnKey(int) const;
+        //   ColumnType columnType(int) const;
+        //   int findColumn(const StringRef&) const;
+        //   bool isValid(int, int) const;
+        //   int numColumns() const;
+        //   int numRows() const;
+        //   bool theBoolean(int, int) const;
+        //   const Datum& theDatum(int, int) const;
+        //   bdlt::Date theDate(int, int) const;
+        //   double theDouble(int, int) const;
+        //   int theInteger(int, int) const;
+        //   Int64 theInteger64(int, int) const;
+        //   StringRef theString(int, int) const;
+        //   bslma::Allocator *allocator() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING 'load' AND BASIC ACCESSORS" << endl
+                          << "==================================" << endl;
+
+        bslma::TestAllocator ta("test", veryVeryVerbose);
+
+        if (verbose) cout << "\nTesting the default constructor." << endl;
+        {
+            Obj mX;  const Obj& X = mX;
+            Obj mY(&ta);  const Obj& Y = mY;
+
+            ASSERT(&defaultAllocator == X.allocator());
+            ASSERT(&ta               == Y.allocator());
+            ASSERT(0  == X.numColumns());
+            ASSERT(0  == X.numRows());
+            ASSERT(-1 == X.findColumn("i"));
+        }
+
+        if (verbose) cout << "\nTesting 'load'." << endl;
+        {
+            static const char *const KEYS[] = { "i", "j", "d", "s", "t" };
+            const Obj::ColumnType    TYPES[] = { Obj::e_INTEGER,
+                                                 Obj::e_INTEGER64,
+                                                 Obj::e_DOUBLE,
+                                                 Obj::e_STRING,
+                                                 Obj::e_DATE };
+
+            Obj mX(&ta);  const Obj& X = mX;
+
+            for (int ti = 0; ti < NUM_ROW_COUNTS; ++ti) {
+                const int NUM_ROWS = ROW_COUNTS[ti];
+
+                if (veryVerbose) { T_ P(NUM_ROWS) }
+
+                const Datum         D       = makeRecords(NUM_ROWS, ti, &ta);
+                const DatumArrayRef RECORDS = D.theArray();
+
+                ASSERTV(NUM_ROWS, 0 == mX.load(RECORDS));
+
+                ASSERTV(NUM_ROWS, NUM_ROWS == X.numRows());
+                ASSERTV(NUM_ROWS, (NUM_ROWS ? 5 : 0) == X.numColumns());
+
+                for (int c = 0; c < X.numColumns(); ++c) {
+                    ASSERTV(NUM_ROWS, c, KEYS[c]  == X.columnKey(c));
+                    ASSERTV(NUM_ROWS, c, c        == X.findColumn(KEYS[c]));
+                    ASSERTV(NUM_ROWS, c, TYPES[c] == X.columnType(c));
+
+                    for (int r = 0; r < NUM_ROWS; ++r) {
+                        const Datum& VALUE = *RECORDS[r].theMap().find(
+                                                                     KEYS[c]);
+
+                        ASSERTV(NUM_ROWS, c, r,
+                                VALUE.isNull() == !X.isValid(c, r));
+                        if (VALUE.isNull()) {
+                            continue;                               // CONTINUE
+                        }
+                        switch (TYPES[c]) {
+                          case Obj::e_INTEGER: {
+                            ASSERTV(NUM_ROWS, c, r, VALUE.theInteger() ==
+                                                       X.theInteger(c, r));
+                          } break;
+                          case Obj::e_INTEGER64: {
+                            ASSERTV(NUM_ROWS, c, r, VALUE.theInteger64() ==
+                                                     X.theInteger64(c, r));
+                          } break;
+                          case Obj::e_DOUBLE: {
+                            ASSERTV(NUM_ROWS, c, r, VALUE.theDouble() ==
+                                                        X.theDouble(c, r));
+                          } break;
+                          case Obj::e_STRING: {
+                            ASSERTV(NUM_ROWS, c, r, VALUE.theString() ==
+                                                        X.theString(c, r));
+                          } break;
+                          default: {
+                            ASSERTV(NUM_ROWS, c, r, VALUE.theDate() ==
+                                                          X.theDate(c, r));
+                          } break;
+                        }
+                    }
+                }
+                Datum::destroy(D, &ta);
+            }
+
+            mX.reset();
+            ASSERT(0  == X.numColumns());
+            ASSERT(0  == X.numRows());
+            ASSERT(-1 == X.findColumn("i"));
+        }
+
+        if (verbose) cout << "\nTesting irregular records." << endl;
+        {
+            // Records having the keys "a", "b", and "c" in different orders,
+            // missing keys, duplicate keys, and values of different types.
+
+            const bdlt::Datetime DATETIME(2026, 10, 19);
+
+            DatumArrayBuilder array(&ta);
+            {
+                DatumMapBuilder map(&ta);
+                map.pushBack("b", Datum::createBoolean(true));
+                map.pushBack("a", Datum::createInteger(1));
+                map.pushBack("d", Datum::createNull());
+                array.pushBack(map.commit());
+            }
+            {
+                DatumMapBuilder map(&ta);
+                map.pushBack("c", Datum::createDatetime(DATETIME, &ta));
+                map.pushBack("a", Datum::createInteger(2));
+                map.pushBack("a", Datum::createInteger(3));
+                map.pushBack("b", Datum::createNull());
+                array.pushBack(map.commit());
+            }
+            {
+                DatumMapBuilder map(&ta);
+                map.pushBack("a", Datum::createDouble(2.5));
+                map.pushBack("b", Datum::createBoolean(false));
+                array.pushBack(map.commit());
+            }
+            const Datum D = array.commit();
+
+            Obj mX(&ta);  const Obj& X = mX;
+            ASSERT(0 == mX.load(D.theArray()));
+
+            ASSERT(3 == X.numRows());
+            ASSERT(4 == X.numColumns());
+            ASSERT(0 == X.findColumn("b"));
+            ASSERT(1 == X.findColumn("a"));
+            ASSERT(2 == X.findColumn("d"));
+            ASSERT(3 == X.findColumn("c"));
+
+            ASSERT(Obj::e_BOOLEAN == X.columnType(0));
+            ASSERT(Obj::e_DATUM   == X.columnType(1));
+            ASSERT(Obj::e_DATUM   == X.columnType(2));
+            ASSERT(Obj::e_DATUM   == X.columnType(3));
+
+            ASSERT( X.isValid(0, 0));
+            ASSERT(!X.isValid(0, 1));
+            ASSERT( X.isValid(0, 2));
+            ASSERT(true  == X.theBoolean(0, 0));
+            ASSERT(false == X.theBoolean(0, 2));
+
+            ASSERT(Datum::createInteger(1)   == X.theDatum(1, 0));
+            ASSERT(Datum::createInteger(2)   == X.theDatum(1, 1));
+            ASSERT(Datum::createDouble(2.5)  == X.theDatum(1, 2));
+
+            for (int r = 0; r < 3; ++r) {
+                ASSERTV(r, !X.isValid(2, r));
+                ASSERTV(r, X.theDatum(2, r).isNull());
+                ASSERTV(r, (1 == r) == X.isValid(3, r));
+            }
+            ASSERT(DATETIME == X.theDatum(3, 1).theDatetime());
+
+            Datum::destroy(D, &ta);
+        }
+
+        if (verbose) cout << "\nTesting non-map elements." << endl;
+        {
+            DatumArrayBuilder array(&ta);
+            {
+                DatumMapBuilder map(&ta);
+                map.pushBack("a", Datum::createInteger(1));
+                array.pushBack(map.commit());
+            }
+            array.pushBack(Datum::createInteger(1));
+            const Datum D = array.commit();
+
+            const Datum GOOD = makeRecords(3, 0, &ta);
+
+            Obj mX(&ta);  const Obj& X = mX;
+            ASSERT(0 == mX.load(GOOD.theArray()));
+            ASSERT(3 == X.numRows());
+
+            ASSERT(0 != mX.load(D.theArray()));
+            ASSERT(0 == X.numRows());
+            ASSERT(0 == X.numColumns());
+
+            Datum::destroy(GOOD, &ta);
+            Datum::destroy(D, &ta);
+        }
+
+        if (verbose) cout << "\nNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            const Datum D = makeRecords(100, 3, &ta);
+
+            Obj mX(&ta);  const Obj& X = mX;
+            ASSERT(0 == mX.load(D.theArray()));
+
+            // Find a row whose values are all valid, and one whose "i" value
+            // is not.
+
+            int valid = -1, invalid = -1;
+            for (int r = 0; r < X.numRows(); ++r) {
+                bool all = true;
+                for (int c = 0; c < X.numColumns(); ++c) {
+                    all = all && X.isValid(c, r);
+                }
+                valid   = all && 0 > valid ? r : valid;
+                invalid = !X.isValid(0, r) && 0 > invalid ? r : invalid;
+            }
+            ASSERT(0 <= valid);
+            ASSERT(0 <= invalid);
+
+            ASSERT_FAIL(X.columnKey(-1));
+            ASSERT_PASS(X.columnKey(0));
+            ASSERT_FAIL(X.columnKey(5));
+
+            ASSERT_FAIL(X.columnType(5));
+            ASSERT_FAIL(X.isValid(5, 0));
+            ASSERT_FAIL(X.isValid(0, -1));
+            ASSERT_FAIL(X.isValid(0, 100));
+
+            ASSERT_PASS(X.theInteger(0, valid));
+            ASSERT_FAIL(X.theInteger(0, invalid));
+            ASSERT_FAIL(X.theInteger(1, valid));
+            ASSERT_PASS(X.theInteger64(1, valid));
+            ASSERT_FAIL(X.theInteger64(0, valid));
+            ASSERT_PASS(X.theDouble(2, valid));
+            ASSERT_FAIL(X.theDouble(0, valid));
+            ASSERT_PASS(X.theString(3, valid));
+            ASSERT_FAIL(X.theString(0, valid));
+            ASSERT_PASS(X.theDate(4, valid));
+            ASSERT_FAIL(X.theDate(0, valid));
+            ASSERT_FAIL(X.theBoolean(0, valid));
+            ASSERT_FAIL(X.theDatum(0, valid));
+
+            ASSERT_FAIL(X.toArray(0));
+
+            Datum::destroy(D, &ta);
+        }
+        ASSERT(0 == ta.numBytesInUse());
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Load a batch with a few records, scan its columns, and convert it
+        //:   back to an array.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        bslma::TestAllocator ta("test", veryVeryVerbose);
+        {
+            const Datum D = makeRecords(10, 1, &ta);
+
+            Obj mX(&ta);  const Obj& X = mX;
+
+            ASSERT(0  == mX.load(D.theArray()));
+            ASSERT(10 == X.numRows());
+            ASSERT(5  == X.numColumns());
+
+            const int I = X.findColumn("i");
+
+            bsl::vector<int> rows(&ta);
+            X.filter(&rows, I, Obj::e_GREATER_EQUAL, -100);
+            ASSERT(X.count(I) == static_cast<int>(rows.size()));
+
+            const Datum COPY = X.toArray(&ta);
+            ASSERT(D == COPY);
+
+            Datum::destroy(COPY, &ta);
+            Datum::destroy(D, &ta);
+        }
+        ASSERT(0 == ta.numBytesInUse());
+      } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // SCAN BENCHMARK
+        //
+        // Concerns:
+        //: 1 Scanning a column of a batch is faster than finding the values in
+        //:   an array of maps.
+        //
+        // Plan:
+        //: 1 Create an array of records, each having a dozen fields, and load
+        //:   a batch with it.  Sum a field, and select the records whose field
+        //:   exceeds a value, by finding the field in each record and by
+        //:   scanning the column.  Report the best of 5 runs of each.
+        //
+        // Testing:
+        //   SCAN BENCHMARK
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "SCAN BENCHMARK" << endl
+                          << "==============" << endl;
+
+        const int NUM_RECORDS = 200000;
+        const int NUM_FIELDS  = 12;
+
+        bslma::TestAllocator ta("test", veryVeryVerbose);
+        {
+            char keys[NUM_FIELDS][8];
+            for (int i = 0; i < NUM_FIELDS; ++i) {
+                bsl::snprintf(keys[i], sizeof keys[i], "field%d", i);
+            }
+
+            unsigned int      state = 1;
+            DatumArrayBuilder array(NUM_RECORDS, &ta);
+            for (int r = 0; r < NUM_RECORDS; ++r) {
+                DatumMapBuilder map(NUM_FIELDS, &ta);
+                for (int i = 0; i < NUM_FIELDS; ++i) {
+                    map.pushBack(keys[i], Datum::createDouble(
+                                                      nextRandom(&state)));
+                }
+                array.pushBack(map.commit());
+            }
+            const Datum         D       = array.commit();
+            const DatumArrayRef RECORDS = D.theArray();
+
+            Obj batch(&ta);
+
+            bsls::Stopwatch timer;
+            timer.start();
+            batch.load(RECORDS);
+            timer.stop();
+            cout << "load: "
+                 << timer.accumulatedWallTime() * 1e9 / NUM_RECORDS
+                 << " ns per record" << endl;
+
+            const char *const KEY    = keys[NUM_FIELDS - 2];
+            const int         COLUMN = batch.findColumn(KEY);
+
+            bsl::vector<int> rows(&ta);
+
+            for (int method = 0; method < 4; ++method) {
+                double best   = 0;
+                double result = 0;
+
+                for (int run = 0; run < 5; ++run) {
+                    bsls::Stopwatch timer;
+                    timer.start();
+                    switch (method) {
+                      case 0: {
+                        result = 0;
+                        for (int r = 0; r < NUM_RECORDS; ++r) {
+                            result += RECORDS[r].theMap().find(KEY)
+                                                                ->theDouble();
+                        }
+                      } break;
+                      case 1: {
+                        result = batch.sum(COLUMN);
+                      } break;
+                      case 2: {
+                        rows.clear();
+                        for (int r = 0; r < NUM_RECORDS; ++r) {
+                            if (RECORDS[r].theMap().find(KEY)->theDouble()
+                                                                     > 60000) {
+                                rows.push_back(r);
+                            }
+                        }
+                        result = static_cast<double>(rows.size());
+                      } break;
+                      default: {
+                        batch.filter(&rows, COLUMN, Obj::e_GREATER, 60000);
+                        result = static_cast<double>(rows.size());
+                      } break;
+                    }
+                    timer.stop();
+
+                    const double elapsed = timer.accumulatedWallTime();
+                    if (0 == run || elapsed < best) {
+                        best = elapsed;
+                    }
+                }
+
+                static const char *const NAMES[] = {
+                    "sum, DatumMapRef::find",
+                    "sum, DatumColumnarBatch::sum",
+                    "filter, DatumMapRef::find",
+                    "filter, DatumColumnarBatch::filter",
+                };
+                cout << NAMES[method] << ": "
+                     << best * 1e9 / NUM_RECORDS << " ns per record"
+                     << " (result " << result << ")" << endl;
+            }
+
+            Datum::destroy(D, &ta);
+        }
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    // CONCERN: In no case does memory come from the default allocator.
+
+    ASSERT(dam.isTotalSame());
+
+    // CONCERN: In no case does memory come from the global allocator.
+
+    ASSERT(gam.isTotalSame());
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
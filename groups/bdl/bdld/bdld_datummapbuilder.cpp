@@ -5,6 +5,7 @@
 BSLS_IDENT_RCSID(bdld_datummapbuilder.cpp,"$Id$ $CSID$")
 
 #include <bdld_datum.h>
+#include <bdld_datummapindex.h>
 #include <bslma_default.h>
 #include <bslmf_assert.h>
 #include <bsls_assert.h>
@@ -175,6 +176,22 @@ Datum DatumMapBuilder::commit()
     return result;
 }
 
+Datum DatumMapBuilder::commit(DatumMapIndex *index)
+{
+    BSLS_ASSERT(index);
+
+    if (d_mapping.data()) {
+        index->assign(DatumMapRef(d_mapping.data(),
+                                  *d_mapping.size(),
+                                  *d_mapping.sorted(),
+                                  false));
+    }
+    else {
+        index->reset();
+    }
+    return commit();
+}
+
 void DatumMapBuilder::pushBack(const bslstl::StringRef& key,
                                const Datum&             value)
 {
@@ -203,6 +220,19 @@ Datum DatumMapBuilder::sortAndCommit()
     return commit();
 }
 
+Datum DatumMapBuilder::sortAndCommit(DatumMapIndex *index)
+{
+    BSLS_ASSERT(index);
+
+    if (d_mapping.data()) {
+        bsl::sort(d_mapping.data(),
+                  d_mapping.data() + *d_mapping.size(),
+                  compareLess);
+        setSorted(true);
+    }
+    return commit(index);
+}
+
 }  // close package namespace
 }  // close enterprise namespace
 
@@ -10,7 +10,7 @@ BSLS_IDENT("$Id$ $CSID$")
 //@CLASSES:
 //  bdld::DatumMapBuilder: utility to build a 'Datum' object holding a map
 //
-//@SEE_ALSO: bdld_datum, bdld_datummapowningkeysbuilder
+//@SEE_ALSO: bdld_datum, bdld_datummapowningkeysbuilder, bdld_datummapindex
 //
 //@DESCRIPTION: This component defines a mechanism, 'bdld::DatumMapBuilder',
 // used to populate a 'Datum' map value in an exception-safe manner.  In
@@ -31,6 +31,11 @@ BSLS_IDENT("$Id$ $CSID$")
 // of the map entries keys and the resulting 'Datum' object does not own memory
 // for the map entries keys.
 //
+// 'commit' and 'sortAndCommit' also have overloads taking a
+// 'bdld::DatumMapIndex', which they load with the keys of the committed map,
+// so that values can be found in that map (and in other maps having the same
+// keys in the same order) in constant time.  See 'bdld_datummapindex'.
+//
 ///Usage
 ///-----
 // This section illustrates intended use of this component.
@@ -116,6 +121,8 @@ namespace bslma { class Allocator; }
 
 namespace bdld {
 
+class DatumMapIndex;
+
                            // =====================
                            // class DatumMapBuilder
                            // =====================
@@ -182,6 +189,13 @@ class DatumMapBuilder {
         // any method of this object, other than its destructor, is called
         // after 'commit' invocation.
 
+    Datum commit(DatumMapIndex *index);
+        // Return a 'Datum' map value holding the elements supplied to
+        // 'pushBack' or 'append', as 'commit()' does, and load the specified
+        // 'index' with the keys of the returned map, in the order of its
+        // entries.  The behavior is undefined if any method of this object,
+        // other than its destructor, is called after 'commit' invocation.
+
     void pushBack(const bslstl::StringRef& key, const Datum& value);
         // Append the entry with the specified 'key' and the specified 'value'
         // to the 'Datum' map being build by this object.  The behavior is
@@ -211,6 +225,14 @@ class DatumMapBuilder {
         // The behavior is undefined if any method of this object, other than
         // its destructor, is called after 'sortAndCommit' invocation.
 
+    Datum sortAndCommit(DatumMapIndex *index);
+        // Return a 'Datum' map value holding the elements supplied to
+        // 'pushBack' or 'append' sorted by their keys, as 'sortAndCommit()'
+        // does, and load the specified 'index' with the keys of the returned
+        // map, in the order of its entries.  The behavior is undefined if any
+        // method of this object, other than its destructor, is called after
+        // 'sortAndCommit' invocation.
+
     // ACCESSORS
     SizeType capacity() const;
         // Return the capacity of the held 'Datum' map.  The behavior is
@@ -1,6 +1,8 @@
 // bdld_datummapbuilder.t.cpp                                         -*-C++-*-
 #include <bdld_datummapbuilder.h>
 
+#include <bdld_datummapindex.h>
+
 #include <bslim_testutil.h>
 #include <bslma_testallocator.h>
 #include <bslma_testallocatormonitor.h>
@@ -38,8 +40,10 @@ using namespace bslstl;
 // [ 4] void pushBack(const bslstl::StringRef&, const Datum&);
 // [ 2] void append(const DatumMapEntry *, int);
 // [ 2] Datum commit();
+// [ 8] Datum commit(DatumMapIndex *);
 // [ 5] void setSorted(bool);
 // [ 6] Datum sortAndCommit();
+// [ 8] Datum sortAndCommit(DatumMapIndex *);
 //
 // ACCESSORS
 // [ 3] SizeType capacity() const;
@@ -49,7 +53,7 @@ using namespace bslstl;
 // [ 7] bslma::UsesBslmaAllocator
 //-----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
-// [ 8] USAGE EXAMPLE
+// [ 9] USAGE EXAMPLE
 
 // ============================================================================
 //                     STANDARD BDE ASSERT TEST FUNCTION
@@ -158,7 +162,7 @@ int main(int argc, char *argv[])
     bslma::TestAllocatorMonitor gam(&globalAllocator);
 
     switch (test) { case 0:  // Zero is always the leading case.
-      case 8: {
+      case 9: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //   Extracted from component header file.
@@ -249,6 +253,158 @@ int main(int argc, char *argv[])
     ASSERT(0 == ta.numBytesInUse());
 //..
       } break;
+      case 8: {
+        // --------------------------------------------------------------------
+        // TESTING COMMITTING WITH AN INDEX
+        //
+        // Concerns:
+        //: 1 'commit' and 'sortAndCommit' taking an index return the same map
+        //:   as the overloads not taking an index.
+        //:
+        //: 2 The index is loaded with the keys of the committed map, in the
+        //:   order of its entries (i.e., after sorting, for
+        //:   'sortAndCommit').
+        //:
+        //: 3 Committing an empty map resets the index.
+        //:
+        //: 4 A map built from keys interned in the index can be committed
+        //:   with that index, and its keys, and the keys interned in the
+        //:   index, remain valid.
+        //:
+        //: 5 No memory is leaked.
+        //
+        // Plan:
+        //: 1 Build maps from the 'values' array, and commit them with an index
+        //:   that is initially empty, or holds other keys.  Verify the map,
+        //:   and that each key of the map is at the same position in the
+        //:   index, and is found through the index.  (C-1..2)
+        //:
+        //: 2 Commit an empty map with an index holding keys, and verify that
+        //:   the index is empty.  (C-3)
+        //:
+        //: 3 Build maps from keys interned in an index and from another key,
+        //:   and commit them with the index.  Verify the map and the index.
+        //:   (C-4)
+        //:
+        //: 4 Verify that no memory is in use by the test allocator.  (C-5)
+        //
+        // Testing:
+        //   Datum commit(DatumMapIndex *);
+        //   Datum sortAndCommit(DatumMapIndex *);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING COMMITTING WITH AN INDEX" << endl
+                          << "================================" << endl;
+
+        bslma::TestAllocator ta("test", veryVeryVerbose);
+        {
+            DatumMapIndex index(&ta);
+
+            for (int sort = 0; sort < 2; ++sort) {
+                for (int prior = 0; prior < 2; ++prior) {
+                    if (veryVerbose) { T_ P_(sort) P(prior) }
+
+                    if (prior) {
+                        index.intern("other");
+                    }
+
+                    Obj mB(&ta);
+                    for (size_t i = NUM_ELEMENTS; 0 < i--; ) {
+                        mB.pushBack(values[i].key(), values[i].value());
+                    }
+
+                    Datum        mD = sort ? mB.sortAndCommit(&index)
+                                           : mB.commit(&index);
+                    const Datum& D  = mD;
+
+                    ASSERT(D.isMap());
+
+                    const DatumMapRef ref = D.theMap();
+
+                    ASSERTV(sort, prior, NUM_ELEMENTS == ref.size());
+                    ASSERTV(sort, prior, !!sort       == ref.isSorted());
+                    ASSERTV(sort, prior,
+                            static_cast<int>(NUM_ELEMENTS) == index.size());
+                    ASSERTV(sort, prior, -1 == index.position("other"));
+
+                    for (size_t i = 0; i < NUM_ELEMENTS; ++i) {
+                        const int POSITION = static_cast<int>(i);
+
+                        ASSERTV(sort, prior, i,
+                                ref[i].key() == index.key(POSITION));
+                        ASSERTV(sort, prior, i,
+                                POSITION == index.position(ref[i].key()));
+                        ASSERTV(sort, prior, i,
+                                &ref[i].value() ==
+                                              index.find(ref, ref[i].key()));
+                    }
+                    if (sort) {
+                        const DatumMapEntry *MAP_END = ref.data() + ref.size();
+                        ASSERT(MAP_END == bsl::adjacent_find(
+                                                      ref.data(),
+                                                      ref.data() + ref.size(),
+                                                      compareGreater));
+                    }
+                    Datum::destroy(mD, &ta);
+                }
+            }
+
+            if (verbose) cout << "\nTesting with an empty map." << endl;
+            {
+                Obj   mB(&ta);
+                Datum mD = mB.commit(&index);
+
+                ASSERT(0 == mD.theMap().size());
+                ASSERT(0 == index.size());
+                ASSERT(-1 == index.position(values[0].key()));
+
+                index.intern("other");
+
+                Obj   mB2(&ta);
+                Datum mD2 = mB2.sortAndCommit(&index);
+
+                ASSERT(0 == mD2.theMap().size());
+                ASSERT(0 == index.size());
+                Datum::destroy(mD, &ta);
+                Datum::destroy(mD2, &ta);
+            }
+
+            if (verbose) cout << "\nTesting with keys interned in the index."
+                              << endl;
+            {
+                const StringRef A = index.intern("alpha");
+                const StringRef B = index.intern("beta");
+
+                for (int sort = 0; sort < 2; ++sort) {
+                    Obj mB(&ta);
+                    mB.pushBack(B,       Datum::createInteger(0));
+                    mB.pushBack(A,       Datum::createInteger(1));
+                    mB.pushBack("gamma", Datum::createInteger(2));
+
+                    Datum             mD  = sort ? mB.sortAndCommit(&index)
+                                                 : mB.commit(&index);
+                    const DatumMapRef ref = mD.theMap();
+
+                    ASSERTV(sort, 3 == ref.size());
+                    ASSERTV(sort, 3 == index.size());
+                    ASSERTV(sort, "gamma" == ref[2].key());
+                    ASSERTV(sort, "alpha" == A);
+                    ASSERTV(sort, "beta"  == B);
+                    ASSERTV(sort, A.data() == index.key(sort ? 0 : 1).data());
+                    ASSERTV(sort, A.data() == ref[sort ? 0 : 1].key().data());
+
+                    for (int i = 0; i < 3; ++i) {
+                        ASSERTV(sort, i, ref[i].key() == index.key(i));
+                        ASSERTV(sort, i, &ref[i].value() ==
+                                                index.find(ref, ref[i].key()));
+                    }
+                    Datum::destroy(mD, &ta);
+                }
+            }
+        }
+        ASSERT(0 == ta.numBytesInUse());
+      } break;
       case 7: {
         // --------------------------------------------------------------------
         // TESTING TRAITS
@@ -0,0 +1,243 @@
+// bdld_datummapindex.cpp                                             -*-C++-*-
+#include <bdld_datummapindex.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(bdld_datummapindex.cpp,"$Id$ $CSID$")
+
+#include <bdlb_hashutil.h>
+
+#include <bslma_default.h>
+#include <bslmf_assert.h>
+#include <bsls_assert.h>
+
+#include <bsl_cstring.h>
+
+namespace BloombergLP {
+namespace bdld {
+
+                            // -------------------
+                            // class DatumMapIndex
+                            // -------------------
+
+// TRAITS
+BSLMF_ASSERT(bslma::UsesBslmaAllocator<DatumMapIndex>::value);
+
+// PRIVATE CLASS METHODS
+unsigned int DatumMapIndex::hash(const bslstl::StringRef& key)
+{
+    return bdlb::HashUtil::hash2(key.data(), static_cast<int>(key.length()));
+}
+
+// PRIVATE MANIPULATORS
+int DatumMapIndex::addPosition(const bslstl::StringRef& key,
+                               bool                     isInterned)
+{
+    // Keep the load factor of the hash table at most 1/2, so that probe
+    // sequences remain short.
+
+    if (d_table.size() < 2 * static_cast<bsl::size_t>(d_numUniqueKeys + 1)) {
+        rehash(d_table.empty() ? 16 : 2 * d_table.size());
+    }
+
+    const unsigned int hashValue = hash(key);
+    const bsl::size_t  slot      = findSlot(key, hashValue);
+
+    if (d_table[slot]) {
+        const int               first    = d_table[slot] - 1;
+        const bslstl::StringRef interned = d_keys[first];
+
+        d_keys.push_back(interned);
+        d_hashes.push_back(hashValue);
+        return first;                                                 // RETURN
+    }
+
+    const char *data = isInterned ? key.data() : 0;
+    if (!isInterned && key.length()) {
+        char *copy = static_cast<char *>(d_keyStorage.allocate(key.length()));
+        bsl::memcpy(copy, key.data(), key.length());
+        data = copy;
+    }
+
+    const int position = size();
+
+    d_keys.push_back(bslstl::StringRef(data, key.length()));
+    d_hashes.push_back(hashValue);
+    d_table[slot] = position + 1;
+    ++d_numUniqueKeys;
+    return position;
+}
+
+void DatumMapIndex::rehash(bsl::size_t tableSize)
+{
+    BSLS_ASSERT(0 == (tableSize & (tableSize - 1)));
+    BSLS_ASSERT(static_cast<bsl::size_t>(d_numUniqueKeys) < tableSize);
+
+    bsl::vector<int> table(tableSize, 0, d_table.get_allocator());
+
+    const bsl::size_t mask = tableSize - 1;
+    for (int i = 0; i < size(); ++i) {
+        bsl::size_t slot = d_hashes[i] & mask;
+        while (table[slot]) {
+            if (d_keys[table[slot] - 1].data() == d_keys[i].data()) {
+                break;
+            }
+            slot = (slot + 1) & mask;
+        }
+        if (!table[slot]) {
+            table[slot] = i + 1;
+        }
+    }
+    d_table.swap(table);
+}
+
+// PRIVATE ACCESSORS
+bsl::size_t DatumMapIndex::findSlot(const bslstl::StringRef& key,
+                                    unsigned int             hashValue) const
+{
+    BSLS_ASSERT(!d_table.empty());
+
+    const bsl::size_t mask = d_table.size() - 1;
+    bsl::size_t       slot = hashValue & mask;
+
+    while (d_table[slot]) {
+        const int position = d_table[slot] - 1;
+        if (d_hashes[position] == hashValue && d_keys[position] == key) {
+            break;
+        }
+        slot = (slot + 1) & mask;
+    }
+    return slot;
+}
+
+// CREATORS
+DatumMapIndex::DatumMapIndex(bslma::Allocator *basicAllocator)
+: d_keyStorage(basicAllocator)
+, d_keys(basicAllocator)
+, d_hashes(basicAllocator)
+, d_table(basicAllocator)
+, d_numUniqueKeys(0)
+{
+}
+
+DatumMapIndex::DatumMapIndex(const DatumMapRef&  map,
+                             bslma::Allocator   *basicAllocator)
+: d_keyStorage(basicAllocator)
+, d_keys(basicAllocator)
+, d_hashes(basicAllocator)
+, d_table(basicAllocator)
+, d_numUniqueKeys(0)
+{
+    assign(map);
+}
+
+// MANIPULATORS
+void DatumMapIndex::assign(const DatumMapRef& map)
+{
+    // The keys of 'map' may have been interned in this index, in which case
+    // releasing the key storage would leave 'map' with dangling keys, and
+    // 'addPosition' would read freed memory.  Identify those keys first, and
+    // retain the key storage if there are any.
+
+    bsl::vector<char> isInterned(map.size(), 0, d_keys.get_allocator());
+    bool              hasInternedKeys = false;
+
+    for (Datum::SizeType i = 0; i < map.size(); ++i) {
+        const bslstl::StringRef& key      = map[i].key();
+        const int                position = this->position(key);
+
+        if (0 <= position
+         && key.length()
+         && key.data() == d_keys[position].data()) {
+            isInterned[i]   = 1;
+            hasInternedKeys = true;
+        }
+    }
+
+    if (hasInternedKeys) {
+        d_keys.clear();
+        d_hashes.clear();
+        d_table.clear();
+        d_numUniqueKeys = 0;
+    }
+    else {
+        reset();
+    }
+
+    d_keys.reserve(map.size());
+    d_hashes.reserve(map.size());
+
+    bsl::size_t tableSize = 16;
+    while (tableSize < 2 * (map.size() + 1)) {
+        tableSize *= 2;
+    }
+    d_table.resize(tableSize);
+
+    for (Datum::SizeType i = 0; i < map.size(); ++i) {
+        addPosition(map[i].key(), isInterned[i]);
+    }
+}
+
+bslstl::StringRef DatumMapIndex::intern(const bslstl::StringRef& key)
+{
+    if (!d_table.empty()) {
+        const int entry = d_table[findSlot(key, hash(key))];
+        if (entry) {
+            return d_keys[entry - 1];                                 // RETURN
+        }
+    }
+    return d_keys[addPosition(key, false)];
+}
+
+void DatumMapIndex::reset()
+{
+    d_keys.clear();
+    d_hashes.clear();
+    d_table.clear();
+    d_numUniqueKeys = 0;
+    d_keyStorage.release();
+}
+
+// ACCESSORS
+const Datum *DatumMapIndex::find(const DatumMapRef&       map,
+                                 const bslstl::StringRef& key) const
+{
+    const int position = this->position(key);
+
+    if (0 <= position && static_cast<Datum::SizeType>(position) < map.size()) {
+        const DatumMapEntry&     entry  = map[position];
+        const bslstl::StringRef& actual = entry.key();
+
+        if (actual.length() == key.length()
+         && (actual.data() == d_keys[position].data() || actual == key)) {
+            return &entry.value();                                    // RETURN
+        }
+    }
+    return map.find(key);
+}
+
+int DatumMapIndex::position(const bslstl::StringRef& key) const
+{
+    if (d_table.empty()) {
+        return -1;                                                    // RETURN
+    }
+    return d_table[findSlot(key, hash(key))] - 1;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,365 @@
+// bdld_datummapindex.h                                               -*-C++-*-
+#ifndef INCLUDED_BDLD_DATUMMAPINDEX
+#define INCLUDED_BDLD_DATUMMAPINDEX
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id$ $CSID$")
+
+//@PURPOSE: Provide a hash index of the keys of 'Datum' maps.
+//
+//@CLASSES:
+//  bdld::DatumMapIndex: hash index from keys to positions in 'Datum' maps
+//
+//@SEE_ALSO: bdld_datum, bdld_datummapbuilder, bdld_datummapowningkeysbuilder
+//
+//@DESCRIPTION: This component provides a mechanism, 'bdld::DatumMapIndex',
+// that holds a sequence of keys, and a hash table mapping each key to its
+// (first) position in that sequence, so that the value having a key can be
+// found in a 'Datum' map in constant time.  Note that 'DatumMapRef::find'
+// searches a map linearly, unless the map is sorted, in which case it does a
+// binary search comparing strings.
+//
+// An index is usually loaded with the keys of a map, in the order of the
+// entries of the map, by 'assign' (or by the 'commit' overloads of
+// 'bdld::DatumMapBuilder' and 'bdld::DatumMapOwningKeysBuilder' taking an
+// index, which load the index with the keys of the map being committed).
+//
+///Sharing an Index Between Maps
+///-----------------------------
+// An index holds its own copy of its keys, and is not tied to a particular
+// map: 'find' looks up the position of a key in the index, then checks that
+// the entry at that position in the map being searched has that key, and, if
+// it does not, falls back on 'DatumMapRef::find'.  Therefore, a single index
+// can be used to search any number of maps having the same keys in the same
+// order (such as records decoded from messages having the same schema) in
+// constant time, and still finds the right value in maps having other keys,
+// or keys in another order, albeit without the benefit of the index.
+//
+// When the same key is looked up in many maps, its position can be looked up
+// once, with 'position', and then passed to the 'find' overload taking a
+// position, which does not hash the key at all.
+//
+///Interned Keys
+///-------------
+// The keys of an index are *interned*: 'key' and 'intern' return a reference
+// to the one copy of a key held by the index, which remains valid until the
+// index is reset or destroyed.  Maps built with 'bdld::DatumMapBuilder' using
+// interned keys share the storage for their keys, which is then not copied
+// into each map (as 'bdld::DatumMapOwningKeysBuilder' does).  In addition,
+// when such a map is searched using the index, the key of the entry at the
+// position found in the index is compared to the key by address, rather than
+// character by character.
+//
+// An index can be loaded (by 'assign', or by committing a builder with the
+// index) with a map whose keys were interned in that same index.  In that
+// case, the keys already interned are not copied again, and the storage
+// holding them is retained, so that the keys of the map remain valid.  Note
+// that the storage of the keys is released only by 'reset', by destroying
+// the index, or by loading the index with a map having no key interned in
+// it.
+//
+///Duplicate Keys
+///--------------
+// If an index is loaded with a map having duplicate keys, each key is indexed
+// at the position of its first occurrence.  The results of 'find' are the
+// same as those of 'DatumMapRef::find' only for maps whose keys are unique: if
+// a map has duplicate keys, 'find' returns the value of the entry at the
+// indexed position when that entry has the key, even if an earlier entry of
+// the map has the same key.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Reading Fields from Many Records
+///- - - - - - - - - - - - - - - - - - - - - -
+// Suppose that we have many records, each held by a 'Datum' map having the
+// same keys in the same order, from which we need to read a few fields.
+//
+// First, we create an index, and intern the keys of the records in it:
+//..
+//  bslma::TestAllocator ta;
+//  bdld::DatumMapIndex  index(&ta);
+//
+//  const char *const FIELDS[] = { "id", "symbol", "price", "quantity" };
+//  for (int i = 0; i < 4; ++i) {
+//      index.intern(FIELDS[i]);
+//  }
+//  assert(4 == index.size());
+//..
+// Then, we build the records, using the interned keys, so that the records do
+// not need their own copies of the keys:
+//..
+//  bsl::vector<bdld::Datum> records(&ta);
+//  for (int i = 0; i < 100; ++i) {
+//      bdld::DatumMapBuilder builder(&ta);
+//      builder.pushBack(index.key(0), bdld::Datum::createInteger(i));
+//      builder.pushBack(index.key(1), bdld::Datum::createStringRef("IBM",
+//                                                                  &ta));
+//      builder.pushBack(index.key(2), bdld::Datum::createDouble(146.25));
+//      builder.pushBack(index.key(3), bdld::Datum::createInteger(10 * i));
+//      records.push_back(builder.commit());
+//  }
+//..
+// Next, we look up the position of each field we need once:
+//..
+//  const int PRICE    = index.position("price");
+//  const int QUANTITY = index.position("quantity");
+//  assert(2 == PRICE);
+//  assert(3 == QUANTITY);
+//..
+// Then, we read the fields of each record in constant time:
+//..
+//  double total = 0;
+//  for (bsl::size_t i = 0; i < records.size(); ++i) {
+//      const bdld::DatumMapRef record = records[i].theMap();
+//
+//      total += index.find(record, PRICE)->theDouble()
+//             * index.find(record, QUANTITY)->theInteger();
+//  }
+//  assert(146.25 * 10 * (99 * 100 / 2) == total);
+//..
+// Next, we observe that the index also finds fields in maps having other
+// keys:
+//..
+//  bdld::DatumMapBuilder builder(&ta);
+//  builder.pushBack("quantity", bdld::Datum::createInteger(7));
+//  const bdld::Datum other = builder.commit();
+//
+//  assert(7 == index.find(other.theMap(), "quantity")->theInteger());
+//  assert(0 == index.find(other.theMap(), "price"));
+//..
+// Finally, we destroy the records:
+//..
+//  bdld::Datum::destroy(other, &ta);
+//  for (bsl::size_t i = 0; i < records.size(); ++i) {
+//      bdld::Datum::destroy(records[i], &ta);
+//  }
+//..
+
+#include <bdlscm_version.h>
+
+#include <bdld_datum.h>
+
+#include <bdlma_sequentialallocator.h>
+
+#include <bslma_allocator.h>
+#include <bslma_usesbslmaallocator.h>
+
+#include <bslmf_nestedtraitdeclaration.h>
+
+#include <bsls_assert.h>
+
+#include <bsl_vector.h>
+
+namespace BloombergLP {
+namespace bdld {
+
+                            // ===================
+                            // class DatumMapIndex
+                            // ===================
+
+class DatumMapIndex {
+    // This class provides a hash index from a sequence of (interned) keys to
+    // their positions, used to find values in 'Datum' maps having those keys
+    // at those positions in constant time.
+
+    // DATA
+    bdlma::SequentialAllocator     d_keyStorage;  // storage for the keys
+
+    bsl::vector<bslstl::StringRef> d_keys;        // interned key at each
+                                                  // position
+
+    bsl::vector<unsigned int>      d_hashes;      // hash of the key at each
+                                                  // position
+
+    bsl::vector<int>               d_table;       // hash table of 1 plus the
+                                                  // first position of each
+                                                  // key, or 0 if empty; its
+                                                  // size is a power of 2
+
+    int                            d_numUniqueKeys;
+                                                  // number of distinct keys
+
+    // PRIVATE CLASS METHODS
+    static unsigned int hash(const bslstl::StringRef& key);
+        // Return the hash value of the specified 'key'.
+
+    // PRIVATE MANIPULATORS
+    int addPosition(const bslstl::StringRef& key, bool isInterned);
+        // Append the specified 'key' to the sequence of keys of this index,
+        // interning it if it is not already interned, and return the first
+        // position of 'key'.  If the specified 'isInterned' flag is 'true',
+        // 'key' refers to memory supplied by the key storage of this index,
+        // and is not copied.
+
+    void rehash(bsl::size_t tableSize);
+        // Rebuild the hash table of this index with the specified
+        // 'tableSize', which is a power of 2 greater than the number of
+        // distinct keys.
+
+    // PRIVATE ACCESSORS
+    bsl::size_t findSlot(const bslstl::StringRef& key,
+                         unsigned int             hashValue) const;
+        // Return the index of the slot of the hash table holding the position
+        // of the specified 'key', having the specified 'hashValue', or of the
+        // empty slot where it would be inserted.  The behavior is undefined
+        // unless the hash table is not empty.
+
+  private:
+    // NOT IMPLEMENTED
+    DatumMapIndex(const DatumMapIndex&);
+    DatumMapIndex& operator=(const DatumMapIndex&);
+
+  public:
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(DatumMapIndex, bslma::UsesBslmaAllocator);
+
+    // CREATORS
+    explicit DatumMapIndex(bslma::Allocator *basicAllocator = 0);
+        // Create an empty index.  Optionally specify a 'basicAllocator' used
+        // to supply memory.  If 'basicAllocator' is 0, the currently installed
+        // default allocator is used.
+
+    explicit DatumMapIndex(const DatumMapRef&  map,
+                           bslma::Allocator   *basicAllocator = 0);
+        // Create an index of the keys of the specified 'map', in the order of
+        // its entries.  Optionally specify a 'basicAllocator' used to supply
+        // memory.  If 'basicAllocator' is 0, the currently installed default
+        // allocator is used.
+
+    //! ~DatumMapIndex() = default;
+        // Destroy this object.
+
+    // MANIPULATORS
+    void assign(const DatumMapRef& map);
+        // Reset this index, and load it with the keys of the specified 'map',
+        // in the order of its entries.  If 'map' has keys interned in this
+        // index (e.g., if 'map' was built using keys returned by 'intern'),
+        // these keys are not copied, and references to the keys previously
+        // interned in this index remain valid; otherwise, they are
+        // invalidated.  See {Interned Keys}.
+
+    bslstl::StringRef intern(const bslstl::StringRef& key);
+        // Return a reference to the copy of the specified 'key' held by this
+        // index, first appending 'key' to the keys of this index if it is not
+        // one of them.  The returned reference remains valid until this index
+        // is reset or destroyed, or is assigned a map having no key interned
+        // in this index.
+
+    void reset();
+        // Remove all keys from this index, and release the memory used for
+        // them.
+
+    // ACCESSORS
+    const Datum *find(const DatumMapRef&       map,
+                      const bslstl::StringRef& key) const;
+        // Return the address of the value having the specified 'key' in the
+        // specified 'map', or 0 if 'map' has no such key.  If the entry of
+        // 'map' at the position of 'key' in this index has 'key', return its
+        // value without searching 'map'; otherwise, return
+        // 'map.find(key)'.  Note that the result is the same as that of
+        // 'map.find(key)' only if the keys of 'map' are unique (see
+        // {Duplicate Keys}).
+
+    const Datum *find(const DatumMapRef& map, int position) const;
+        // Return the address of the value having the key at the specified
+        // 'position' in this index in the specified 'map', or 0 if 'map' has
+        // no such key.  If the entry of 'map' at 'position' has that key,
+        // return its value without hashing or searching; otherwise, return
+        // 'map.find(key(position))'.  The behavior is undefined unless
+        // '0 <= position < size()'.  Note that the result is the same as that
+        // of 'map.find(key(position))' only if the keys of 'map' are unique
+        // (see {Duplicate Keys}).
+
+    const bslstl::StringRef& key(int position) const;
+        // Return a reference to the interned key at the specified 'position'
+        // in this index.  The behavior is undefined unless
+        // '0 <= position < size()'.
+
+    int position(const bslstl::StringRef& key) const;
+        // Return the first position of the specified 'key' in this index, or
+        // -1 if 'key' is not one of its keys.
+
+    int size() const;
+        // Return the number of positions (i.e., of keys, including duplicate
+        // keys) in this index.
+
+                                  // Aspects
+
+    bslma::Allocator *allocator() const;
+        // Return the allocator used by this object to supply memory.
+};
+
+// ============================================================================
+//                            INLINE DEFINITIONS
+// ============================================================================
+
+                            // -------------------
+                            // class DatumMapIndex
+                            // -------------------
+
+// ACCESSORS
+inline
+const Datum *DatumMapIndex::find(const DatumMapRef& map, int position) const
+{
+    BSLS_ASSERT(0 <= position);
+    BSLS_ASSERT(position < size());
+
+    const bslstl::StringRef& expected = d_keys[position];
+
+    if (static_cast<Datum::SizeType>(position) < map.size()) {
+        const DatumMapEntry&     entry  = map[position];
+        const bslstl::StringRef& actual = entry.key();
+
+        if (actual.length() == expected.length()
+         && (actual.data() == expected.data() || actual == expected)) {
+            return &entry.value();                                    // RETURN
+        }
+    }
+    return map.find(expected);
+}
+
+inline
+const bslstl::StringRef& DatumMapIndex::key(int position) const
+{
+    BSLS_ASSERT(0 <= position);
+    BSLS_ASSERT(position < size());
+
+    return d_keys[position];
+}
+
+inline
+int DatumMapIndex::size() const
+{
+    return static_cast<int>(d_keys.size());
+}
+
+                                  // Aspects
+
+inline
+bslma::Allocator *DatumMapIndex::allocator() const
+{
+    return d_keys.get_allocator().mechanism();
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,978 @@
+// bdld_datummapindex.t.cpp                                           -*-C++-*-
+#include <bdld_datummapindex.h>
+
+#include <bdld_datum.h>
+#include <bdld_datummapbuilder.h>
+
+#include <bslim_testutil.h>
+#include <bslma_testallocator.h>
+#include <bslma_testallocatormonitor.h>
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+
+#include <bsls_assert.h>
+#include <bsls_asserttest.h>
+#include <bsls_stopwatch.h>
+
+#include <bsl_cstdio.h>
+#include <bsl_cstdlib.h>
+#include <bsl_iostream.h>
+#include <bsl_string.h>
+#include <bsl_vector.h>
+
+using namespace BloombergLP;
+using namespace BloombergLP::bdld;
+using namespace bsl;
+using namespace bslstl;
+
+//=============================================================================
+//                             TEST PLAN
+//-----------------------------------------------------------------------------
+//                              Overview
+//                              --------
+// The component under test is a hash index of the keys of 'Datum' maps.  The
+// index is tested against 'DatumMapRef::find', which is the oracle for
+// 'find', and against a linear search of its keys, which is the oracle for
+// 'position'.
+//-----------------------------------------------------------------------------
+// CREATORS
+// [ 2] explicit DatumMapIndex(bslma::Allocator *);
+// [ 3] explicit DatumMapIndex(const DatumMapRef&, bslma::Allocator *);
+//
+// MANIPULATORS
+// [ 3] void assign(const DatumMapRef&);
+// [ 2] StringRef intern(const StringRef&);
+// [ 2] void reset();
+//
+// ACCESSORS
+// [ 4] const Datum *find(const DatumMapRef&, const StringRef&) const;
+// [ 4] const Datum *find(const DatumMapRef&, int) const;
+// [ 2] const StringRef& key(int) const;
+// [ 2] int position(const StringRef&) const;
+// [ 2] int size() const;
+// [ 2] bslma::Allocator *allocator() const;
+//
+// TRAITS
+// [ 5] bslma::UsesBslmaAllocator
+//-----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 6] USAGE EXAMPLE
+// [-1] LOOKUP BENCHMARK
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLIM_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLIM_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLIM_TESTUTIL_LOOP6_ASSERT
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                     NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_SAFE_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_PASS(EXPR)
+#define ASSERT_SAFE_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_FAIL(EXPR)
+#define ASSERT_PASS(EXPR)      BSLS_ASSERTTEST_ASSERT_PASS(EXPR)
+#define ASSERT_FAIL(EXPR)      BSLS_ASSERTTEST_ASSERT_FAIL(EXPR)
+#define ASSERT_OPT_PASS(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_PASS(EXPR)
+#define ASSERT_OPT_FAIL(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_FAIL(EXPR)
+
+// ============================================================================
+//                    GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef DatumMapIndex Obj;
+
+//=============================================================================
+//               GLOBAL HELPER CLASSES AND FUNCTIONS FOR TESTING
+//-----------------------------------------------------------------------------
+
+static bsl::string makeKey(int i)
+    // Return a distinct key for the specified 'i'.
+{
+    char buffer[32];
+    bsl::snprintf(buffer, sizeof buffer, "key%d", i);
+    return buffer;
+}
+
+static int linearPosition(const Obj& index, const StringRef& key)
+    // Return the first position of the specified 'key' in the specified
+    // 'index', found by a linear search, or -1 if 'index' has no such key.
+{
+    for (int i = 0; i < index.size(); ++i) {
+        if (index.key(i) == key) {
+            return i;                                                 // RETURN
+        }
+    }
+    return -1;
+}
+
+static Datum makeMap(const char       *spec,
+                     bool              sort,
+                     bslma::Allocator *allocator)
+    // Return a 'Datum' map, allocated using the specified 'allocator', having
+    // one entry for each character of the specified 'spec', whose key is that
+    // character and whose value is its position in 'spec', sorted by key if
+    // the specified 'sort' is 'true'.  The keys refer to the characters of
+    // 'spec'.
+{
+    DatumMapBuilder builder(allocator);
+    for (int i = 0; spec[i]; ++i) {
+        builder.pushBack(StringRef(spec + i, 1), Datum::createInteger(i));
+    }
+    return sort ? builder.sortAndCommit() : builder.commit();
+}
+
+//=============================================================================
+//                                 MAIN PROGRAM
+//-----------------------------------------------------------------------------
+int main(int argc, char *argv[])
+{
+    const int                 test = argc > 1 ? atoi(argv[1]) : 0;
+    const bool             verbose = argc > 2;
+    const bool         veryVerbose = argc > 3;
+    const bool     veryVeryVerbose = argc > 4;
+    const bool veryVeryVeryVerbose = argc > 5;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    // CONCERN: In no case does memory come from the default allocator.
+
+    bslma::TestAllocator defaultAllocator("default", veryVeryVeryVerbose);
+    ASSERT(0 == bslma::Default::setDefaultAllocator(&defaultAllocator));
+    bslma::TestAllocatorMonitor dam(&defaultAllocator);
+
+    // CONCERN: In no case does memory come from the global allocator.
+
+    bslma::TestAllocator globalAllocator("global", veryVeryVeryVerbose);
+    bslma::Default::setGlobalAllocator(&globalAllocator);
+    bslma::TestAllocatorMonitor gam(&globalAllocator);
+
+    switch (test) { case 0:  // Zero is always the leading case.
+      case 6: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl << "USAGE EXAMPLE" << endl
+                                  << "=============" << endl;
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Reading Fields from Many Records
+///- - - - - - - - - - - - - - - - - - - - - -
+// Suppose that we have many records, each held by a 'Datum' map having the
+// same keys in the same order, from which we need to read a few fields.
+//
+// First, we create an index, and intern the keys of the records in it:
+//..
+    bslma::TestAllocator ta;
+    bdld::DatumMapIndex  index(&ta);
+
+    const char *const FIELDS[] = { "id", "symbol", "price", "quantity" };
+    for (int i = 0; i < 4; ++i) {
+        index.intern(FIELDS[i]);
+    }
+    ASSERT(4 == index.size());
+//..
+// Then, we build the records, using the interned keys, so that the records do
+// not need their own copies of the keys:
+//..
+    bsl::vector<bdld::Datum> records(&ta);
+    for (int i = 0; i < 100; ++i) {
+        bdld::DatumMapBuilder builder(&ta);
+        builder.pushBack(index.key(0), bdld::Datum::createInteger(i));
+        builder.pushBack(index.key(1), bdld::Datum::createStringRef("IBM",
+                                                                    &ta));
+        builder.pushBack(index.key(2), bdld::Datum::createDouble(146.25));
+        builder.pushBack(index.key(3), bdld::Datum::createInteger(10 * i));
+        records.push_back(builder.commit());
+    }
+//..
+// Next, we look up the position of each field we need once:
+//..
+    const int PRICE    = index.position("price");
+    const int QUANTITY = index.position("quantity");
+    ASSERT(2 == PRICE);
+    ASSERT(3 == QUANTITY);
+//..
+// Then, we read the fields of each record in constant time:
+//..
+    double total = 0;
+    for (bsl::size_t i = 0; i < records.size(); ++i) {
+        const bdld::DatumMapRef record = records[i].theMap();
+
+        total += index.find(record, PRICE)->theDouble()
+               * index.find(record, QUANTITY)->theInteger();
+    }
+    ASSERT(146.25 * 10 * (99 * 100 / 2) == total);
+//..
+// Next, we observe that the index also finds fields in maps having other
+// keys:
+//..
+    bdld::DatumMapBuilder builder(&ta);
+    builder.pushBack("quantity", bdld::Datum::createInteger(7));
+    const bdld::Datum other = builder.commit();
+
+    ASSERT(7 == index.find(other.theMap(), "quantity")->theInteger());
+    ASSERT(0 == index.find(other.theMap(), "price"));
+//..
+// Finally, we destroy the records:
+//..
+    bdld::Datum::destroy(other, &ta);
+    for (bsl::size_t i = 0; i < records.size(); ++i) {
+        bdld::Datum::destroy(records[i], &ta);
+    }
+//..
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // TESTING TRAITS
+        //
+        // Concerns:
+        //: 1 bslma::UsesBslmaAllocator is true for DatumMapIndex.
+        //
+        // Plan:
+        //: 1 Assert trait.  (C-1)
+        //
+        // Testing:
+        //   bslma::UsesBslmaAllocator
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING TRAITS" << endl
+                          << "==============" << endl;
+
+        ASSERT(bslma::UsesBslmaAllocator<Obj>::value);
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // TESTING 'find'
+        //
+        // Concerns:
+        //: 1 'find' returns the same value as 'DatumMapRef::find' for any map
+        //:   whose keys are distinct, whether or not the map has the keys of
+        //:   the index at the same positions, is shorter or longer than the
+        //:   index, or is sorted.
+        //:
+        //: 2 'find' returns 0 for keys that are not in the map, whether or not
+        //:   they are in the index.
+        //:
+        //: 3 The overload taking a position returns the same value as the
+        //:   overload taking the key at that position.
+        //:
+        //: 4 Maps whose keys are interned in the index are searched correctly.
+        //:
+        //: 5 In a map having duplicate keys, 'find' returns the value of the
+        //:   entry at the indexed position if it has the key, and otherwise
+        //:   the value returned by 'DatumMapRef::find'.
+        //
+        // Plan:
+        //: 1 For a table of key layouts, create an index of each layout, and
+        //:   search maps of each layout, both unsorted and sorted, for every
+        //:   single-character key, using both overloads, and compare the
+        //:   results with 'DatumMapRef::find'.  (C-1..3)
+        //:
+        //: 2 Build maps using keys interned in an index, and verify that each
+        //:   key is found at the address of its entry.  (C-4)
+        //:
+        //: 3 Search maps having duplicate keys, and verify that the entry at
+        //:   the indexed position is preferred to an earlier entry having the
+        //:   same key.  (C-5)
+        //
+        // Testing:
+        //   const Datum *find(const DatumMapRef&, const StringRef&) const;
+        //   const Datum *find(const DatumMapRef&, int) const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING 'find'" << endl
+                          << "==============" << endl;
+
+        static const char *const SPECS[] = {
+            "",
+            "a",
+            "ab",
+            "ba",
+            "abc",
+            "abcd",
+            "dcba",
+            "bcd",
+            "abcdefghijklmnopqrstuvwxyz",
+            "zyxwvutsrqponmlkjihgfedcba",
+            "xyz",
+        };
+        const int NUM_SPECS = static_cast<int>(sizeof SPECS / sizeof *SPECS);
+
+        bslma::TestAllocator ta("test", veryVeryVerbose);
+
+        for (int ti = 0; ti < NUM_SPECS; ++ti) {
+            const char *const INDEX_SPEC = SPECS[ti];
+
+            Datum mapD = makeMap(INDEX_SPEC, false, &ta);
+            Obj   mX(mapD.theMap(), &ta);  const Obj& X = mX;
+            Datum::destroy(mapD, &ta);
+
+            for (int tj = 0; tj < NUM_SPECS; ++tj) {
+                for (int sort = 0; sort < 2; ++sort) {
+                    const char *const MAP_SPEC = SPECS[tj];
+
+                    if (veryVerbose) { T_ P_(INDEX_SPEC) P_(MAP_SPEC) P(sort) }
+
+                    const Datum       D   = makeMap(MAP_SPEC, sort, &ta);
+                    const DatumMapRef MAP = D.theMap();
+
+                    for (char c = ' '; c <= '~'; ++c) {
+                        const StringRef KEY(&c, 1);
+
+                        ASSERTV(INDEX_SPEC, MAP_SPEC, sort, c,
+                                MAP.find(KEY) == X.find(MAP, KEY));
+                    }
+                    for (int i = 0; i < X.size(); ++i) {
+                        ASSERTV(INDEX_SPEC, MAP_SPEC, sort, i,
+                                MAP.find(X.key(i)) == X.find(MAP, i));
+                    }
+                    Datum::destroy(D, &ta);
+                }
+            }
+        }
+
+        if (verbose) cout << "\nTesting maps having interned keys." << endl;
+        {
+            Obj mX(&ta);  const Obj& X = mX;
+
+            const int NUM_KEYS = 40;
+            for (int i = 0; i < NUM_KEYS; ++i) {
+                mX.intern(makeKey(i));
+            }
+
+            DatumMapBuilder builder(&ta);
+            for (int i = 0; i < NUM_KEYS; ++i) {
+                builder.pushBack(X.key(i), Datum::createInteger(i));
+            }
+            const Datum       D   = builder.commit();
+            const DatumMapRef MAP = D.theMap();
+
+            for (int i = 0; i < NUM_KEYS; ++i) {
+                const bsl::string KEY = makeKey(i);
+
+                ASSERTV(i, &MAP[i].value() == X.find(MAP, KEY));
+                ASSERTV(i, &MAP[i].value() == X.find(MAP, i));
+                ASSERTV(i, MAP[i].key().data() == X.key(i).data());
+            }
+            ASSERT(0 == X.find(MAP, makeKey(NUM_KEYS)));
+
+            Datum::destroy(D, &ta);
+        }
+
+        if (verbose) cout << "\nTesting maps having duplicate keys." << endl;
+        {
+            Datum mapD = makeMap("xa", false, &ta);
+            Obj   mX(mapD.theMap(), &ta);  const Obj& X = mX;
+            Datum::destroy(mapD, &ta);
+
+            // The entry at the indexed position has the key: it is returned,
+            // although 'DatumMapRef::find' returns the earlier one.
+
+            const Datum       D1   = makeMap("aa", false, &ta);
+            const DatumMapRef MAP1 = D1.theMap();
+
+            ASSERT(&MAP1[0].value() == MAP1.find("a"));
+            ASSERT(&MAP1[1].value() == X.find(MAP1, "a"));
+            ASSERT(&MAP1[1].value() == X.find(MAP1, 1));
+
+            // The entry at the indexed position does not have the key: the
+            // result is that of 'DatumMapRef::find'.
+
+            const Datum       D2   = makeMap("aba", false, &ta);
+            const DatumMapRef MAP2 = D2.theMap();
+
+            ASSERT(&MAP2[0].value() == X.find(MAP2, "a"));
+            ASSERT(&MAP2[0].value() == X.find(MAP2, 1));
+
+            Datum::destroy(D1, &ta);
+            Datum::destroy(D2, &ta);
+        }
+
+        if (verbose) cout << "\nNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            Obj mX(&ta);
+
+            mX.intern("a");
+
+            const Datum       D   = makeMap("a", false, &ta);
+            const DatumMapRef MAP = D.theMap();
+
+            ASSERT_FAIL(mX.find(MAP, -1));
+            ASSERT_PASS(mX.find(MAP,  0));
+            ASSERT_FAIL(mX.find(MAP,  1));
+
+            Datum::destroy(D, &ta);
+        }
+        ASSERT(0 == ta.numBytesInUse());
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // TESTING 'assign'
+        //
+        // Concerns:
+        //: 1 'assign' and the constructor taking a map load the index with
+        //:   the keys of the map, at the positions of their entries.
+        //:
+        //: 2 A key occurring more than once in a map is indexed at its first
+        //:   position, and the keys at the other positions refer to the same
+        //:   interned key.
+        //:
+        //: 3 'assign' discards the keys previously in the index.
+        //:
+        //: 4 The keys are copied, and do not refer to the keys of the map.
+        //:
+        //: 5 The keys of a map that were interned in the index are not
+        //:   copied, and remain valid after 'assign', as do the other keys
+        //:   interned in the index; keys not interned in the index are
+        //:   copied.
+        //:
+        //: 6 No memory is leaked.
+        //
+        // Plan:
+        //: 1 For a table of key layouts, including duplicate keys, load an
+        //:   index, holding other keys, with a map of each layout, and verify
+        //:   its size, keys, and positions against a linear search.
+        //:   (C-1..4)
+        //:
+        //: 2 Build a map from keys interned in an index and from other keys,
+        //:   and load the index with it, twice.  Verify the keys of the map
+        //:   and of the index, and that the keys interned before are at the
+        //:   same addresses.  Then load the index with a map having no key
+        //:   interned in it.  (C-5)
+        //:
+        //: 3 Verify that no memory is in use by the test allocator.  (C-6)
+        //
+        // Testing:
+        //   explicit DatumMapIndex(const DatumMapRef&, bslma::Allocator *);
+        //   void assign(const DatumMapRef&);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING 'assign'" << endl
+                          << "================" << endl;
+
+        static const struct {
+            int         d_line;
+            const char *d_spec;
+        } DATA[] = {
+            { L_, ""           },
+            { L_, "a"          },
+            { L_, "ab"         },
+            { L_, "aa"         },
+            { L_, "aba"        },
+            { L_, "abcabc"     },
+            { L_, "zyxwvuzyxw" },
+            { L_, "abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ" },
+        };
+        const int NUM_DATA = static_cast<int>(sizeof DATA / sizeof *DATA);
+
+        bslma::TestAllocator ta("test", veryVeryVerbose);
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int         LINE = DATA[ti].d_line;
+            const char *const SPEC = DATA[ti].d_spec;
+            const int         LEN  = static_cast<int>(strlen(SPEC));
+
+            if (veryVerbose) { T_ P_(LINE) P(SPEC) }
+
+            const Datum       D   = makeMap(SPEC, false, &ta);
+            const DatumMapRef MAP = D.theMap();
+
+            for (int cfg = 0; cfg < 2; ++cfg) {
+                Obj mZ(&ta);
+
+                if (0 == cfg) {
+                    mZ.intern("other");
+                    mZ.intern("1");
+                    mZ.assign(MAP);
+                }
+                Obj        mY(MAP, &ta);
+                Obj&       mX = cfg ? mY : mZ;
+                const Obj& X  = mX;
+
+                ASSERTV(LINE, cfg, LEN == X.size());
+                ASSERTV(LINE, cfg, -1  == X.position("other"));
+                ASSERTV(LINE, cfg, -1  == X.position("1"));
+
+                for (int i = 0; i < LEN; ++i) {
+                    const StringRef KEY(SPEC + i, 1);
+                    const int       FIRST = static_cast<int>(
+                                           strchr(SPEC, SPEC[i]) - SPEC);
+
+                    ASSERTV(LINE, cfg, i, KEY   == X.key(i));
+                    ASSERTV(LINE, cfg, i, KEY.data() != X.key(i).data());
+                    ASSERTV(LINE, cfg, i, FIRST == X.position(KEY));
+                    ASSERTV(LINE, cfg, i, FIRST == linearPosition(X, KEY));
+                    ASSERTV(LINE, cfg, i,
+                            X.key(FIRST).data() == X.key(i).data());
+                    ASSERTV(LINE, cfg, i,
+                            X.key(FIRST).data() == mX.intern(KEY).data());
+                }
+                ASSERTV(LINE, cfg, LEN == X.size());
+            }
+            Datum::destroy(D, &ta);
+        }
+
+        if (verbose) cout << "\nTesting with keys interned in the index."
+                          << endl;
+        {
+            Obj mX(&ta);  const Obj& X = mX;
+
+            const StringRef A     = mX.intern("alpha");
+            const StringRef B     = mX.intern("beta");
+            const StringRef OTHER = mX.intern("other");
+            const char      GAMMA[] = "gamma";
+
+            DatumMapBuilder builder(&ta);
+            builder.pushBack(B,     Datum::createInteger(0));
+            builder.pushBack(GAMMA, Datum::createInteger(1));
+            builder.pushBack(A,     Datum::createInteger(2));
+            builder.pushBack(B,     Datum::createInteger(3));
+
+            const Datum       D   = builder.commit();
+            const DatumMapRef MAP = D.theMap();
+
+            for (int pass = 0; pass < 2; ++pass) {
+                mX.assign(MAP);
+
+                ASSERTV(pass, 4       == X.size());
+                ASSERTV(pass, "beta"  == MAP[0].key());
+                ASSERTV(pass, "gamma" == MAP[1].key());
+                ASSERTV(pass, "alpha" == MAP[2].key());
+                ASSERTV(pass, "beta"  == MAP[3].key());
+                ASSERTV(pass, "other" == OTHER);
+
+                ASSERTV(pass, B.data() == X.key(0).data());
+                ASSERTV(pass, GAMMA    != X.key(1).data());
+                ASSERTV(pass, "gamma"  == X.key(1));
+                ASSERTV(pass, A.data() == X.key(2).data());
+                ASSERTV(pass, B.data() == X.key(3).data());
+                ASSERTV(pass, -1       == X.position("other"));
+                ASSERTV(pass, 0        == X.position("beta"));
+
+                for (int i = 0; i < 3; ++i) {       // 'MAP[3]' is duplicate
+                    ASSERTV(pass, i, &MAP[i].value() ==
+                                                 X.find(MAP, MAP[i].key()));
+                }
+            }
+            Datum::destroy(D, &ta);
+
+            const Datum D2 = makeMap("xy", false, &ta);
+
+            mX.assign(D2.theMap());
+
+            ASSERT(2  == X.size());
+            ASSERT(-1 == X.position("beta"));
+            ASSERT(1  == X.position("y"));
+
+            Datum::destroy(D2, &ta);
+        }
+        ASSERT(0 == ta.numBytesInUse());
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // TESTING PRIMARY MANIPULATORS AND BASIC ACCESSORS
+        //
+        // Concerns:
+        //: 1 A default-constructed index is empty, and uses the specified (or
+        //:   default) allocator.
+        //:
+        //: 2 'intern' appends a key that is not in the index at the next
+        //:   position, and returns a reference to its copy of the key; it
+        //:   returns the same reference for a key that is in the index, and
+        //:   does not append it.
+        //:
+        //: 3 'position' returns the position of each key in the index, and -1
+        //:   for any other key, for any number of keys (i.e., across the
+        //:   growth of the hash table), including the empty key.
+        //:
+        //: 4 'reset' empties the index, which can then be reused.
+        //:
+        //: 5 All memory is supplied by the specified allocator, and is
+        //:   released on destruction.
+        //:
+        //: 6 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 Create an index, and verify its size and allocator.  (C-1)
+        //:
+        //: 2 Intern an increasing number of distinct keys, and interleave
+        //:   interning keys already in the index, verifying the results of
+        //:   'intern', 'key', 'position', and 'size' at each step.  (C-2..3)
+        //:
+        //: 3 Reset the index, and verify that it is empty and reusable.  (C-4)
+        //:
+        //: 4 Verify that no memory is in use by the test allocator after the
+        //:   index is destroyed, and that the default allocator is not used.
+        //:   (C-5)
+        //:
+        //: 5 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for invalid positions.  (C-6)
+        //
+        // Testing:
+        //   explicit DatumMapIndex(bslma::Allocator *);
+        //   StringRef intern(const StringRef&);
+        //   void reset();
+        //   const StringRef& key(int) const;
+        //   int position(const StringRef&) const;
+        //   int size() const;
+        //   bslma::Allocator *allocator() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                << "TESTING PRIMARY MANIPULATORS AND BASIC ACCESSORS" << endl
+                << "================================================" << endl;
+
+        if (verbose) cout << "\nTesting allocators." << endl;
+        {
+            bslma::TestAllocator ta("test", veryVeryVerbose);
+
+            Obj mX;  const Obj& X = mX;
+            Obj mY(&ta);  const Obj& Y = mY;
+
+            ASSERT(&defaultAllocator == X.allocator());
+            ASSERT(&ta               == Y.allocator());
+            ASSERT(0 == X.size());
+            ASSERT(-1 == X.position(""));
+            ASSERT(-1 == X.position("a"));
+            ASSERT(0 == defaultAllocator.numBlocksTotal());
+        }
+
+        if (verbose) cout << "\nTesting 'intern' and 'position'." << endl;
+        {
+            bslma::TestAllocator ta("test", veryVeryVerbose);
+            {
+                Obj mX(&ta);  const Obj& X = mX;
+
+                const int NUM_KEYS = 1000;
+                for (int i = 0; i < NUM_KEYS; ++i) {
+                    const bsl::string KEY = makeKey(i);
+
+                    if (veryVeryVerbose) { T_ P(KEY) }
+
+                    ASSERTV(i, -1 == X.position(KEY));
+
+                    const StringRef INTERNED = mX.intern(KEY);
+
+                    ASSERTV(i, KEY        == INTERNED);
+                    ASSERTV(i, KEY.data() != INTERNED.data());
+                    ASSERTV(i, i + 1      == X.size());
+                    ASSERTV(i, i          == X.position(KEY));
+                    ASSERTV(i, INTERNED.data() == X.key(i).data());
+
+                    // Interning a key already in the index does not append
+                    // it.
+
+                    const int J = i / 2;
+
+                    ASSERTV(i,
+                            X.key(J).data() == mX.intern(makeKey(J)).data());
+                    ASSERTV(i, i + 1 == X.size());
+                }
+
+                for (int i = 0; i < NUM_KEYS; ++i) {
+                    ASSERTV(i, i == X.position(makeKey(i)));
+                    ASSERTV(i, makeKey(i) == X.key(i));
+                }
+                ASSERT(-1 == X.position(makeKey(NUM_KEYS)));
+                ASSERT(-1 == X.position(""));
+                ASSERT(-1 == X.position("key"));
+
+                if (verbose) cout << "\nTesting the empty key." << endl;
+
+                ASSERT(0 == mX.intern("").length());
+                ASSERT(NUM_KEYS == X.position(""));
+                ASSERT(NUM_KEYS + 1 == X.size());
+
+                if (verbose) cout << "\nTesting 'reset'." << endl;
+
+                ASSERT(0 < ta.numBytesInUse());
+
+                mX.reset();
+
+                ASSERT(0 == X.size());
+                ASSERT(-1 == X.position(makeKey(0)));
+                ASSERT(-1 == X.position(""));
+
+                ASSERT("b" == mX.intern("b"));
+                ASSERT("a" == mX.intern("a"));
+                ASSERT(2 == X.size());
+                ASSERT(0 == X.position("b"));
+                ASSERT(1 == X.position("a"));
+            }
+            ASSERT(0 == ta.numBytesInUse());
+        }
+
+        if (verbose) cout << "\nNegative Testing." << endl;
+        {
+            bslma::TestAllocator ta("test", veryVeryVerbose);
+
+            bsls::AssertTestHandlerGuard hG;
+
+            Obj mX(&ta);  const Obj& X = mX;
+
+            ASSERT_FAIL(X.key(0));
+
+            mX.intern("a");
+
+            ASSERT_FAIL(X.key(-1));
+            ASSERT_PASS(X.key( 0));
+            ASSERT_FAIL(X.key( 1));
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Create an index of a map, and find its values.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        bslma::TestAllocator ta("test", veryVeryVerbose);
+        {
+            const Datum       D   = makeMap("abc", false, &ta);
+            const DatumMapRef MAP = D.theMap();
+
+            Obj mX(MAP, &ta);  const Obj& X = mX;
+
+            ASSERT(3 == X.size());
+            ASSERT(1 == X.position("b"));
+            ASSERT(-1 == X.position("d"));
+
+            ASSERT(&MAP[0].value() == X.find(MAP, "a"));
+            ASSERT(&MAP[2].value() == X.find(MAP, "c"));
+            ASSERT(0               == X.find(MAP, "d"));
+            ASSERT(&MAP[1].value() == X.find(MAP, 1));
+
+            Datum::destroy(D, &ta);
+        }
+        ASSERT(0 == ta.numBytesInUse());
+      } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // LOOKUP BENCHMARK
+        //
+        // Concerns:
+        //: 1 Finding values through an index is faster than
+        //:   'DatumMapRef::find', whether the maps are sorted or not.
+        //
+        // Plan:
+        //: 1 Build many records having the same keys, both unsorted (using
+        //:   keys interned in an index) and sorted, and read a dozen fields
+        //:   from each record using 'DatumMapRef::find', and using an index
+        //:   (by key and by position).  Report the best of 5 runs of each.
+        //
+        // Testing:
+        //   LOOKUP BENCHMARK
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "LOOKUP BENCHMARK" << endl
+                          << "================" << endl;
+
+        const int NUM_RECORDS = 100000;
+        const int NUM_FIELDS  = 40;
+        const int NUM_READS   = 12;
+
+        bslma::TestAllocator ta("test", veryVeryVerbose);
+        {
+            Obj index(&ta);
+
+            bsl::vector<bsl::string> fields(&ta);
+            for (int i = 0; i < NUM_FIELDS; ++i) {
+                fields.push_back(makeKey(i * 7919 % 1000) + "_field");
+                index.intern(fields.back());
+            }
+
+            bsl::vector<Datum> unsorted(&ta);
+            bsl::vector<Datum> sorted(&ta);
+            for (int r = 0; r < NUM_RECORDS; ++r) {
+                DatumMapBuilder builder(NUM_FIELDS, &ta);
+                DatumMapBuilder sortedBuilder(NUM_FIELDS, &ta);
+                for (int i = 0; i < NUM_FIELDS; ++i) {
+                    builder.pushBack(index.key(i), Datum::createInteger(i));
+                    sortedBuilder.pushBack(index.key(i),
+                                           Datum::createInteger(i));
+                }
+                unsorted.push_back(builder.commit());
+                sorted.push_back(sortedBuilder.sortAndCommit());
+            }
+
+            // Read every third field, and the last ones, as a rule engine
+            // reading a dozen fields of each record would.
+
+            bsl::vector<bsl::string> reads(&ta);
+            bsl::vector<int>         positions(&ta);
+            for (int i = 0; i < NUM_READS; ++i) {
+                const int FIELD = (3 * i + 2) % NUM_FIELDS;
+                reads.push_back(fields[FIELD]);
+                positions.push_back(index.position(fields[FIELD]));
+            }
+
+            Obj sortedIndex(sorted[0].theMap(), &ta);
+
+            static const char *const NAMES[] = {
+                "DatumMapRef::find (unsorted)",
+                "DatumMapRef::find (sorted)",
+                "DatumMapIndex::find by key (unsorted)",
+                "DatumMapIndex::find by key (sorted)",
+                "DatumMapIndex::find by position",
+            };
+
+            for (int method = 0; method < 5; ++method) {
+                double    best = 0;
+                long long sum  = 0;
+
+                for (int run = 0; run < 5; ++run) {
+                    bsls::Stopwatch timer;
+                    timer.start();
+                    for (int r = 0; r < NUM_RECORDS; ++r) {
+                        const DatumMapRef MAP = method == 1 || method == 3
+                                              ? sorted[r].theMap()
+                                              : unsorted[r].theMap();
+
+                        for (int i = 0; i < NUM_READS; ++i) {
+                            const Datum *value = 0;
+                            switch (method) {
+                              case 0:
+                              case 1: {
+                                value = MAP.find(reads[i]);
+                              } break;
+                              case 2: {
+                                value = index.find(MAP, reads[i]);
+                              } break;
+                              case 3: {
+                                value = sortedIndex.find(MAP, reads[i]);
+                              } break;
+                              default: {
+                                value = index.find(MAP, positions[i]);
+                              } break;
+                            }
+                            sum += value->theInteger();
+                        }
+                    }
+                    timer.stop();
+
+                    const double elapsed = timer.accumulatedWallTime();
+                    if (0 == run || elapsed < best) {
+                        best = elapsed;
+                    }
+                }
+                cout << NAMES[method] << ": "
+                     << best * 1e9 / (NUM_RECORDS * NUM_READS)
+                     << " ns per lookup (checksum " << sum << ")" << endl;
+            }
+
+            for (int r = 0; r < NUM_RECORDS; ++r) {
+                Datum::destroy(unsorted[r], &ta);
+                Datum::destroy(sorted[r], &ta);
+            }
+        }
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    // CONCERN: In no case does memory come from the default allocator.
+
+    ASSERT(dam.isTotalSame());
+
+    // CONCERN: In no case does memory come from the global allocator.
+
+    ASSERT(gam.isTotalSame());
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -5,6 +5,7 @@
 BSLS_IDENT_RCSID(bdld_datummapowningkeysbuilder.cpp,"$Id$ $CSID$")
 
 #include <bdld_datum.h>
+#include <bdld_datummapindex.h>
 #include <bslmf_assert.h>
 #include <bsls_assert.h>
 #include <bsl_algorithm.h>
@@ -252,6 +253,22 @@ Datum DatumMapOwningKeysBuilder::commit()
     return result;
 }
 
+Datum DatumMapOwningKeysBuilder::commit(DatumMapIndex *index)
+{
+    BSLS_ASSERT(index);
+
+    if (d_mapping.data()) {
+        index->assign(DatumMapRef(d_mapping.data(),
+                                  *d_mapping.size(),
+                                  *d_mapping.sorted(),
+                                  true));
+    }
+    else {
+        index->reset();
+    }
+    return commit();
+}
+
 void DatumMapOwningKeysBuilder::pushBack(const bslstl::StringRef& key,
                                          const Datum&             value)
 {
@@ -280,6 +297,19 @@ Datum DatumMapOwningKeysBuilder::sortAndCommit()
     return commit();
 }
 
+Datum DatumMapOwningKeysBuilder::sortAndCommit(DatumMapIndex *index)
+{
+    BSLS_ASSERT(index);
+
+    if (d_mapping.data()) {
+        bsl::sort(d_mapping.data(),
+                  d_mapping.data() + *d_mapping.size(),
+                  compareLess);
+        setSorted(true);
+    }
+    return commit(index);
+}
+
 }  // close package namespace
 }  // close enterprise namespace
 
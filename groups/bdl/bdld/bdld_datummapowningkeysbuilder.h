@@ -10,7 +10,7 @@ BSLS_IDENT("$Id$ $CSID$")
 //@CLASSES:
 //  bdld::DatumMapOwningKeysBuilder: utility to build a 'Datum' map value
 //
-//@SEE_ALSO: bdld_datum, bdld_datummapbuilder
+//@SEE_ALSO: bdld_datum, bdld_datummapbuilder, bdld_datummapindex
 //
 //@DESCRIPTION: This component defines a mechanism,
 // 'bdld::DatumMapOwningKeysBuilder', used to populate a 'Datum' map value in
@@ -30,6 +30,11 @@ BSLS_IDENT("$Id$ $CSID$")
 // that this component makes a copy of the map entries keys and the resulting
 // 'Datum' object owns memory for the map entries keys.
 //
+// 'commit' and 'sortAndCommit' also have overloads taking a
+// 'bdld::DatumMapIndex', which they load with the keys of the committed map,
+// so that values can be found in that map (and in other maps having the same
+// keys in the same order) in constant time.  See 'bdld_datummapindex'.
+//
 ///Usage
 ///-----
 // This section illustrates intended use of this component.
@@ -122,6 +127,8 @@ namespace bslma { class Allocator; }
 
 namespace bdld {
 
+class DatumMapIndex;
+
                       // ===============================
                       // class DatumMapOwningKeysBuilder
                       // ===============================
@@ -206,6 +213,14 @@ class DatumMapOwningKeysBuilder {
         // The behavior is undefined if any method of this object, other than
         // its destructor, is called after 'commit' invocation.
 
+    Datum commit(DatumMapIndex *index);
+        // Return a 'Datum' map (owning keys) value holding the elements
+        // supplied to 'pushBack' or 'append', as 'commit()' does, and load
+        // the specified 'index' with the keys of the returned map, in the
+        // order of its entries.  The behavior is undefined if any method of
+        // this object, other than its destructor, is called after 'commit'
+        // invocation.
+
     void pushBack(const bslstl::StringRef& key, const Datum& value);
         // Append the entry with the specified 'key' and the specified 'value'
         // to the 'Datum' map being build by this object.  The behavior is
@@ -236,6 +251,14 @@ class DatumMapOwningKeysBuilder {
         // object, other than its destructor, is called after 'sortAndCommit'
         // invocation.
 
+    Datum sortAndCommit(DatumMapIndex *index);
+        // Return a 'Datum' map (owning keys) value holding the elements
+        // supplied to 'pushBack' or 'append' sorted by their keys, as
+        // 'sortAndCommit()' does, and load the specified 'index' with the
+        // keys of the returned map, in the order of its entries.  The
+        // behavior is undefined if any method of this object, other than its
+        // destructor, is called after 'sortAndCommit' invocation.
+
     // ACCESSORS
     bslma::Allocator *allocator() const;
         // Return the allocator associated with this object.
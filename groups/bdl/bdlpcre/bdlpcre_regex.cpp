@@ -17,13 +17,19 @@ BSLS_IDENT_RCSID(bdlpcre2_regex_cpp,"$Id$ $CSID$")
 //: o The match context for the main thread (the thread that calls
 //:   'initialize') is pre-allocated when the pattern is compiled.
 //:
-//: o Match contexts for all other threads are allocated and deallocated within
-//:   each call to 'loadMatchContext' (i.e. when invoked from other thread(s)).
+//: o Match contexts for all other threads are taken from a pool by
+//:   'acquireMatchContext', and returned to the pool by 'releaseMatchContext'.
+//:   A context is allocated only if the pool is empty, so the number of
+//:   contexts allocated is bounded by the number of threads concurrently
+//:   matching, and repeated matches from other threads do not allocate.  The
+//:   pool is protected by a mutex that is held only to pop or push a context.
 
 #include <bslma_allocator.h>
 #include <bslma_deallocatorproctor.h>
 #include <bslma_default.h>
 
+#include <bslmt_lockguard.h>
+#include <bslmt_mutex.h>
 #include <bslmt_threadutil.h>
 
 #include <bsls_assert.h>
@@ -121,7 +127,20 @@ class RegEx_MatchContext {
     ThreadHandle            d_mainThread;           // main thread ID
     RegEx_MatchContextData  d_mainThreadMatchData;  // main thread match ctx
 
+    mutable bsl::vector<RegEx_MatchContextData>
+                            d_pool;                 // match contexts
+                                                    // available to threads
+                                                    // other than the main
+                                                    // thread
+
+    mutable bslmt::Mutex    d_poolMutex;            // protects 'd_pool'
+
   private:
+    // PRIVATE MANIPULATORS
+    void deallocatePool();
+        // Deallocate the PCRE2 match data buffers of the match contexts in
+        // the pool, and empty the pool.
+
     // PRIVATE ACCESSORS
     int allocateMatchContext(RegEx_MatchContextData *matchContextData) const;
         // Allocate PCRE2 match data buffers and load them into the specified
@@ -134,8 +153,9 @@ class RegEx_MatchContext {
 
   public:
     // CREATORS
-    RegEx_MatchContext();
-        // Create a 'RegEx_MatchContext' object.
+    explicit RegEx_MatchContext(bslma::Allocator *basicAllocator);
+        // Create a 'RegEx_MatchContext' object, using the specified
+        // 'basicAllocator' to supply memory for the pool of match contexts.
 
     ~RegEx_MatchContext();
         // Destroy this object.
@@ -172,19 +192,30 @@ class RegEx_MatchContext {
                         // ------------------
 
 // CREATORS
-RegEx_MatchContext::RegEx_MatchContext()
+RegEx_MatchContext::RegEx_MatchContext(bslma::Allocator *basicAllocator)
 : d_pcre2Context_p(0)
 , d_pcre2PatternCode_p(0)
 , d_depthLimit(0)
 , d_jitStackSize(0)
 , d_mainThread(bslmt::ThreadUtil::invalidHandle())
 , d_mainThreadMatchData()
+, d_pool(basicAllocator)
 {
 }
 
 RegEx_MatchContext::~RegEx_MatchContext()
 {
     deallocateMatchContext(&d_mainThreadMatchData);
+    deallocatePool();
+}
+
+// PRIVATE MANIPULATORS
+void RegEx_MatchContext::deallocatePool()
+{
+    for (bsl::size_t i = 0; i < d_pool.size(); ++i) {
+        deallocateMatchContext(&d_pool[i]);
+    }
+    d_pool.clear();
 }
 
 // PRIVATE ACCESSORS
@@ -259,6 +290,7 @@ int RegEx_MatchContext::initialize(pcre2_general_context *pcre2Context,
     BSLS_ASSERT(patternCode);
 
     deallocateMatchContext(&d_mainThreadMatchData);
+    deallocatePool();
 
     d_mainThread         = bslmt::ThreadUtil::self();
     d_pcre2Context_p     = pcre2Context;
@@ -276,6 +308,9 @@ void RegEx_MatchContext::setDepthLimit(int depthLimit)
         pcre2_set_match_limit(d_mainThreadMatchData.d_matchContext_p,
                               d_depthLimit);
     }
+    for (bsl::size_t i = 0; i < d_pool.size(); ++i) {
+        pcre2_set_match_limit(d_pool[i].d_matchContext_p, d_depthLimit);
+    }
 }
 
 // ACCESSORS
@@ -290,6 +325,16 @@ RegEx_MatchContext::acquireMatchContext(
         return k_SUCCESS;                                             // RETURN
     }
 
+    {
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_poolMutex);
+
+        if (!d_pool.empty()) {
+            *matchContextData = d_pool.back();
+            d_pool.pop_back();
+            return k_SUCCESS;                                         // RETURN
+        }
+    }
+
     return allocateMatchContext(matchContextData);
 }
 
@@ -302,6 +347,14 @@ void RegEx_MatchContext::releaseMatchContext(
         return;                                                       // RETURN
     }
 
+    BSLS_TRY {
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_poolMutex);
+
+        d_pool.push_back(*matchContextData);
+        return;                                                       // RETURN
+    } BSLS_CATCH(...) {
+    }
+
     deallocateMatchContext(matchContextData);
 }
 
@@ -474,7 +527,7 @@ RegEx::RegEx(bslma::Allocator *basicAllocator)
 , d_jitStackSize(0)
 , d_allocator_p(bslma::Default::allocator(basicAllocator))
 {
-    d_matchContext.load(new (*d_allocator_p) RegEx_MatchContext(),
+    d_matchContext.load(new (*d_allocator_p) RegEx_MatchContext(d_allocator_p),
                         d_allocator_p);
 
     d_pcre2Context_p = pcre2_general_context_create(
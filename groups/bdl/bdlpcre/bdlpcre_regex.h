@@ -199,7 +199,11 @@ BSLS_IDENT("$Id$ $CSID$")
 // Note that 'bdlpcre::RegEx' incurs some overhead in order to provide
 // thread-safe pattern matching functionality.  To perform the pattern match,
 // the underlaying PCRE2 library requires a set of buffers that cannot be
-// shared between threads.
+// shared between threads.  The buffers used by the thread that called
+// 'prepare' are allocated by 'prepare'; the buffers used by other threads are
+// kept in a pool owned by the regular-expression object, so that a thread
+// matching repeatedly allocates buffers only if more threads than ever before
+// are matching concurrently.
 //
 // The table below demonstrate the difference of invoking the 'match' method
 // from main (thread that invokes 'prepare') and other threads:
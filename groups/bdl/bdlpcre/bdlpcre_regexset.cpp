@@ -0,0 +1,720 @@
+// bdlpcre_regexset.cpp                                               -*-C++-*-
+#include <bdlpcre_regexset.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(bdlpcre_regexset_cpp,"$Id$ $CSID$")
+
+///IMPLEMENTATION NOTES
+///--------------------
+// The automaton is stored as a complete deterministic automaton: each state
+// has a transition for every input class, so that matching takes exactly one
+// table lookup per byte of the subject, and never follows failure links.  To
+// keep the table small, bytes are mapped to input classes: the bytes that do
+// not occur in any literal share class 0, and the upper- and lower-case forms
+// of an ASCII letter share a class (which makes the automaton ignore case).
+//
+// The automaton is built with the usual breadth-first construction: a trie of
+// the literals is built first, and the transitions of each state that are not
+// edges of the trie are then copied from the state reached by its failure
+// link, which (being shallower) is already complete.
+//
+// The outputs of the automaton are the ids of the expressions whose literal
+// ends at a state.  Rather than copying the outputs of the states reachable by
+// failure links into each state, each state records the first state (itself
+// or a state reached by failure links) having outputs, and each state having
+// outputs records the next such state; matching visits only states having
+// outputs.
+//
+// Candidates are accumulated in a bit set indexed by id, so that each
+// candidate is confirmed at most once, and in increasing order of id.
+
+#include <bdlb_bitutil.h>
+
+#include <bslma_default.h>
+#include <bslma_rawdeleterproctor.h>
+
+#include <bsls_exceptionutil.h>
+#include <bsls_types.h>
+
+#include <bsl_algorithm.h>
+#include <bsl_cstring.h>
+#include <bsl_utility.h>
+
+namespace BloombergLP {
+namespace bdlpcre {
+namespace {
+
+enum {
+    k_NUM_LOCAL_WORDS = 16  // number of words of the candidate bit set that
+                            // are allocated on the stack ('16 * 64' ids)
+};
+
+typedef bsls::Types::Uint64 Word;
+
+char toLower(char character)
+    // Return the lower-case form of the specified 'character' if it is an
+    // upper-case ASCII letter, and 'character' otherwise.
+{
+    return 'A' <= character && character <= 'Z'
+           ? static_cast<char>(character - 'A' + 'a')
+           : character;
+}
+
+bool isAlphanumeric(char character)
+    // Return 'true' if the specified 'character' is an ASCII letter or digit,
+    // and 'false' otherwise.
+{
+    return ('a' <= character && character <= 'z')
+        || ('A' <= character && character <= 'Z')
+        || ('0' <= character && character <= '9');
+}
+
+bool isDigit(char character)
+    // Return 'true' if the specified 'character' is an ASCII digit, and
+    // 'false' otherwise.
+{
+    return '0' <= character && character <= '9';
+}
+
+bool isHexDigit(char character)
+    // Return 'true' if the specified 'character' is an ASCII hexadecimal
+    // digit, and 'false' otherwise.
+{
+    return isDigit(character)
+        || ('a' <= character && character <= 'f')
+        || ('A' <= character && character <= 'F');
+}
+
+bsl::size_t skipTo(const char *pattern, bsl::size_t index, char terminator)
+    // Return the index of the character following the first occurrence of
+    // the specified 'terminator' at or after the specified 'index' in the
+    // specified null-terminated 'pattern', or the length of 'pattern' if
+    // there is none.
+{
+    while (pattern[index] && pattern[index] != terminator) {
+        ++index;
+    }
+    return pattern[index] ? index + 1 : index;
+}
+
+bsl::size_t skipCharacterClass(const char *pattern, bsl::size_t index)
+    // Return the index of the character following the character class that
+    // starts (with '[') at the specified 'index' in the specified
+    // null-terminated 'pattern'.
+{
+    ++index;
+    if ('^' == pattern[index]) {
+        ++index;
+    }
+    if (']' == pattern[index]) {
+        ++index;                                  // leading ']' is a literal
+    }
+
+    while (pattern[index] && ']' != pattern[index]) {
+        if ('\\' == pattern[index] && pattern[index + 1]) {
+            index += 2;
+        }
+        else if ('[' == pattern[index] && ':' == pattern[index + 1]) {
+            const char *end = bsl::strstr(pattern + index + 2, ":]");
+            index = end ? end - pattern + 2 : index + 1;
+        }
+        else {
+            ++index;
+        }
+    }
+    return pattern[index] ? index + 1 : index;
+}
+
+bsl::size_t skipEscape(const char *pattern, bsl::size_t index)
+    // Return the index of the character following the escape sequence that
+    // starts (with '\') at the specified 'index' in the specified
+    // null-terminated 'pattern', where the character following the '\' is
+    // alphanumeric.
+{
+    const char code = pattern[index + 1];
+    index += 2;
+
+    switch (code) {
+      case 'c': {                                       // control character
+        return pattern[index] ? index + 1 : index;                    // RETURN
+      }
+      case 'x':
+      case 'o':
+      case 'p':
+      case 'P':
+      case 'N':
+      case 'g':
+      case 'k': {
+        if ('{' == pattern[index]) {
+            return skipTo(pattern, index, '}');                       // RETURN
+        }
+        if ('<' == pattern[index]) {
+            return skipTo(pattern, index, '>');                       // RETURN
+        }
+        if ('\'' == pattern[index]) {
+            return skipTo(pattern, index + 1, '\'');                  // RETURN
+        }
+        if ('p' == code || 'P' == code) {
+            return pattern[index] ? index + 1 : index;                // RETURN
+        }
+        if ('-' == pattern[index] || '+' == pattern[index]) {
+            ++index;
+        }
+      } break;
+      default: {
+      } break;
+    }
+
+    if ('x' == code) {
+        for (int i = 0; i < 2 && isHexDigit(pattern[index]); ++i) {
+            ++index;
+        }
+        return index;                                                 // RETURN
+    }
+
+    while (isDigit(pattern[index])) {
+        ++index;
+    }
+    return index;
+}
+
+bsl::size_t skipGroup(const char *pattern, bsl::size_t index)
+    // Return the index of the character following the group that starts
+    // (with '(') at the specified 'index' in the specified null-terminated
+    // 'pattern'.
+{
+    int depth = 0;
+    do {
+        switch (pattern[index]) {
+          case '\\': {
+            index += pattern[index + 1] ? 2 : 1;
+          } break;
+          case '[': {
+            index = skipCharacterClass(pattern, index);
+          } break;
+          case '(': {
+            ++depth;
+            ++index;
+          } break;
+          case ')': {
+            --depth;
+            ++index;
+          } break;
+          default: {
+            ++index;
+          }
+        }
+    } while (depth > 0 && pattern[index]);
+
+    return index;
+}
+
+bsl::size_t parseQuantifier(int         *minRepeat,
+                            const char  *pattern,
+                            bsl::size_t  index)
+    // Load into the specified 'minRepeat' the minimum number of repetitions
+    // allowed by the quantifier at the specified 'index' in the specified
+    // null-terminated 'pattern', and return the index of the character
+    // following the quantifier (including any lazy or possessive suffix).  If
+    // there is no quantifier at 'index', load 1 and return 'index'.  Note
+    // that a '{' that does not start a quantifier of the form '{n}', '{n,}',
+    // or '{n,m}' is considered a quantifier allowing 0 repetitions (but is not
+    // consumed), as PCRE2 versions differ in their interpretation of '{,m}'.
+{
+    switch (pattern[index]) {
+      case '*':
+      case '?': {
+        *minRepeat = 0;
+        ++index;
+      } break;
+      case '+': {
+        *minRepeat = 1;
+        ++index;
+      } break;
+      case '{': {
+        bsl::size_t end = index + 1;
+        int         min = 0;
+        while (isDigit(pattern[end]) && min < 1000) {
+            min = min * 10 + (pattern[end] - '0');
+            ++end;
+        }
+        const bool hasMin = end > index + 1;
+        if (',' == pattern[end]) {
+            ++end;
+            while (isDigit(pattern[end])) {
+                ++end;
+            }
+        }
+        if (!hasMin || '}' != pattern[end]) {
+            *minRepeat = 0;
+            return index;                                             // RETURN
+        }
+        *minRepeat = min;
+        index      = end + 1;
+      } break;
+      default: {
+        *minRepeat = 1;
+        return index;                                                 // RETURN
+      }
+    }
+
+    if ('?' == pattern[index] || '+' == pattern[index]) {
+        ++index;
+    }
+    return index;
+}
+
+void endRun(bsl::string *best, bsl::string *run)
+    // Make the specified 'best' hold the longer of 'best' and the specified
+    // 'run' (preferring 'best' if they have the same length), and clear
+    // 'run'.
+{
+    if (run->size() > best->size()) {
+        best->swap(*run);
+    }
+    run->clear();
+}
+
+}  // close unnamed namespace
+
+                              // --------------
+                              // class RegExSet
+                              // --------------
+
+// CLASS METHODS
+void RegExSet::extractPrefilterLiteral(bsl::string *result,
+                                       const char  *pattern,
+                                       int          flags)
+{
+    BSLS_ASSERT(result);
+    BSLS_ASSERT(pattern);
+
+    // In UTF-8 mode, caseless matching also matches 'k' with U+212A (KELVIN
+    // SIGN) and 's' with U+017F (LATIN SMALL LETTER LONG S), whose encodings
+    // are not ASCII: such characters cannot be part of the literal.
+
+    const bool isCaselessUtf8 = (flags & RegEx::k_FLAG_UTF8)
+                             && (flags & RegEx::k_FLAG_CASELESS);
+
+    result->clear();
+
+    bsl::string run(result->get_allocator());
+    bsl::size_t index = 0;
+
+    while (pattern[index]) {
+        const char character = pattern[index];
+        bool       isLiteral = false;
+        char       literal   = 0;
+
+        switch (character) {
+          case '|':        // top-level alternation: no literal is required
+          case ')': {      // unbalanced: the pattern is not understood
+            result->clear();
+            return;                                                   // RETURN
+          }
+          case '(': {
+            if ('*' == pattern[index + 1]) {
+                // A verb, such as '(*ACCEPT)', may end a match early.
+
+                result->clear();
+                return;                                               // RETURN
+            }
+            if ('?' == pattern[index + 1]
+             && (!pattern[index + 2]
+              || !bsl::strchr(":|>=!<(PR&+0123456789'",
+                              pattern[index + 2]))) {
+                // An option setting (e.g., '(?i)'), a comment, or a callout.
+
+                result->clear();
+                return;                                               // RETURN
+            }
+            index = skipGroup(pattern, index);
+          } break;
+          case '[': {
+            index = skipCharacterClass(pattern, index);
+          } break;
+          case '\\': {
+            const char next = pattern[index + 1];
+            if (0 == next || 'Q' == next) {
+                result->clear();
+                return;                                               // RETURN
+            }
+            if (isAlphanumeric(next)) {
+                index = skipEscape(pattern, index);
+            }
+            else {
+                isLiteral = true;
+                literal   = next;
+                index    += 2;
+            }
+          } break;
+          case '.':
+          case '^':
+          case '$':
+          case '*':
+          case '+':
+          case '?': {
+            ++index;
+          } break;
+          case '{': {
+            // A '{' that does not start a quantifier of the form '{n}',
+            // '{n,}', or '{n,m}' is a literal, except that PCRE2 versions
+            // differ in their interpretation of '{,m}': skip any such
+            // sequence of digits and commas.
+
+            bsl::size_t end = index + 1;
+            while (isDigit(pattern[end]) || ',' == pattern[end]) {
+                ++end;
+            }
+            index = '}' == pattern[end] ? end + 1 : index + 1;
+          } break;
+          default: {
+            isLiteral = 0 == (character & 0x80);
+            literal   = character;
+            ++index;
+          }
+        }
+
+        if (isLiteral && isCaselessUtf8) {
+            const char lower = toLower(literal);
+            isLiteral = 'k' != lower && 's' != lower;
+        }
+
+        const bsl::size_t atomEnd = index;
+
+        int minRepeat;
+        index = parseQuantifier(&minRepeat, pattern, index);
+
+        const bool isQuantified = atomEnd != index || 0 == minRepeat;
+
+        if (!isLiteral) {
+            endRun(result, &run);
+        }
+        else if (!isQuantified) {
+            run.push_back(toLower(literal));
+        }
+        else if (0 < minRepeat) {
+            // The character occurs at least once, but the repetitions are
+            // not known: the last repetition starts the next run.
+
+            run.push_back(toLower(literal));
+            endRun(result, &run);
+            run.push_back(toLower(literal));
+        }
+        else {
+            endRun(result, &run);
+        }
+    }
+    endRun(result, &run);
+
+    if (result->size() > k_MAX_LITERAL_LENGTH) {
+        result->resize(k_MAX_LITERAL_LENGTH);
+    }
+}
+
+// CREATORS
+RegExSet::RegExSet(bslma::Allocator *basicAllocator)
+: d_regExes(basicAllocator)
+, d_literals(basicAllocator)
+, d_unfilteredIds(basicAllocator)
+, d_numClasses(1)
+, d_transitions(basicAllocator)
+, d_firstOutput(basicAllocator)
+, d_outputLink(basicAllocator)
+, d_outputBegin(basicAllocator)
+, d_outputIds(basicAllocator)
+, d_numPrefiltered(0)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    bsl::memset(d_byteClasses, 0, sizeof d_byteClasses);
+}
+
+RegExSet::~RegExSet()
+{
+    clear();
+}
+
+// MANIPULATORS
+int RegExSet::add(bsl::string *errorMessage,
+                  bsl::size_t *errorOffset,
+                  const char  *pattern,
+                  int          flags,
+                  bsl::size_t  jitStackSize)
+{
+    BSLS_ASSERT(pattern);
+
+    RegEx *regEx = new (*d_allocator_p) RegEx(d_allocator_p);
+    bslma::RawDeleterProctor<RegEx, bslma::Allocator> proctor(regEx,
+                                                              d_allocator_p);
+
+    const int rc = regEx->prepare(errorMessage,
+                                  errorOffset,
+                                  pattern,
+                                  flags,
+                                  jitStackSize);
+    if (0 != rc) {
+        return rc;                                                    // RETURN
+    }
+
+    bsl::string literal(d_allocator_p);
+    extractPrefilterLiteral(&literal, pattern, flags);
+
+    d_regExes.reserve(d_regExes.size() + 1);
+    d_literals.push_back(literal);
+    d_regExes.push_back(regEx);
+    proctor.release();
+
+    return 0;
+}
+
+void RegExSet::buildPrefilter()
+{
+    if (isPrefilterCurrent()) {
+        return;                                                       // RETURN
+    }
+
+    // Assign the input classes.
+
+    unsigned char byteClasses[256];
+    bsl::memset(byteClasses, 0, sizeof byteClasses);
+
+    int numClasses = 1;
+    for (bsl::size_t i = 0; i < d_literals.size(); ++i) {
+        const bsl::string& literal = d_literals[i];
+        for (bsl::size_t j = 0; j < literal.size(); ++j) {
+            const unsigned char lower = static_cast<unsigned char>(literal[j]);
+            if (0 == byteClasses[lower]) {
+                const unsigned char inputClass =
+                                        static_cast<unsigned char>(numClasses);
+
+                byteClasses[lower] = inputClass;
+                if ('a' <= lower && lower <= 'z') {
+                    byteClasses[lower - 'a' + 'A'] = inputClass;
+                }
+                ++numClasses;
+            }
+        }
+    }
+
+    // Build the trie of the literals, and collect the outputs.
+
+    bsl::vector<int>                  trie(numClasses, 0, d_allocator_p);
+    bsl::vector<bsl::pair<int, int> > outputs(d_allocator_p);
+    bsl::vector<int>                  unfilteredIds(d_allocator_p);
+
+    int numStates = 1;
+    for (bsl::size_t i = 0; i < d_literals.size(); ++i) {
+        const bsl::string& literal = d_literals[i];
+        const int          id      = static_cast<int>(i);
+
+        if (literal.empty()) {
+            unfilteredIds.push_back(id);
+            continue;                                               // CONTINUE
+        }
+
+        int state = 0;
+        for (bsl::size_t j = 0; j < literal.size(); ++j) {
+            const int inputClass =
+                       byteClasses[static_cast<unsigned char>(literal[j])];
+            int& next = trie[state * numClasses + inputClass];
+            if (0 == next) {
+                next = numStates++;
+                trie.resize(numStates * numClasses, 0);
+            }
+            state = trie[state * numClasses + inputClass];
+        }
+        outputs.push_back(bsl::make_pair(state, id));
+    }
+
+    bsl::sort(outputs.begin(), outputs.end());
+
+    bsl::vector<int> outputBegin(numStates + 1, 0, d_allocator_p);
+    bsl::vector<int> outputIds(d_allocator_p);
+    outputIds.reserve(outputs.size());
+    for (bsl::size_t i = 0; i < outputs.size(); ++i) {
+        ++outputBegin[outputs[i].first + 1];
+        outputIds.push_back(outputs[i].second);
+    }
+    for (int state = 0; state < numStates; ++state) {
+        outputBegin[state + 1] += outputBegin[state];
+    }
+
+    // Complete the transitions, and link the states having outputs, in
+    // breadth-first order.
+
+    bsl::vector<int> transitions(numStates * numClasses, 0, d_allocator_p);
+    bsl::vector<int> failure(numStates, 0, d_allocator_p);
+    bsl::vector<int> firstOutput(numStates, 0, d_allocator_p);
+    bsl::vector<int> outputLink(numStates, 0, d_allocator_p);
+    bsl::vector<int> queue(d_allocator_p);
+    queue.reserve(numStates);
+
+    for (int inputClass = 0; inputClass < numClasses; ++inputClass) {
+        const int child = trie[inputClass];
+        transitions[inputClass] = child;
+        if (child) {
+            queue.push_back(child);
+        }
+    }
+
+    for (bsl::size_t head = 0; head < queue.size(); ++head) {
+        const int state = queue[head];
+        const int link  = failure[state];
+
+        outputLink[state]  = firstOutput[link];
+        firstOutput[state] = outputBegin[state] < outputBegin[state + 1]
+                             ? state
+                             : outputLink[state];
+
+        for (int inputClass = 0; inputClass < numClasses; ++inputClass) {
+            const int child    = trie[state * numClasses + inputClass];
+            const int fallback = transitions[link * numClasses + inputClass];
+            if (child) {
+                transitions[state * numClasses + inputClass] = child;
+                failure[child] = fallback;
+                queue.push_back(child);
+            }
+            else {
+                transitions[state * numClasses + inputClass] = fallback;
+            }
+        }
+    }
+
+    // Commit.
+
+    bsl::memcpy(d_byteClasses, byteClasses, sizeof byteClasses);
+    d_numClasses = numClasses;
+    d_transitions.swap(transitions);
+    d_firstOutput.swap(firstOutput);
+    d_outputLink.swap(outputLink);
+    d_outputBegin.swap(outputBegin);
+    d_outputIds.swap(outputIds);
+    d_unfilteredIds.swap(unfilteredIds);
+    d_numPrefiltered = static_cast<int>(d_literals.size());
+}
+
+void RegExSet::clear()
+{
+    for (bsl::size_t i = 0; i < d_regExes.size(); ++i) {
+        d_allocator_p->deleteObject(d_regExes[i]);
+    }
+    d_regExes.clear();
+    d_literals.clear();
+    d_unfilteredIds.clear();
+
+    bsl::memset(d_byteClasses, 0, sizeof d_byteClasses);
+    d_numClasses = 1;
+    d_transitions.clear();
+    d_firstOutput.clear();
+    d_outputLink.clear();
+    d_outputBegin.clear();
+    d_outputIds.clear();
+    d_numPrefiltered = 0;
+}
+
+// ACCESSORS
+int RegExSet::match(bsl::vector<int> *result,
+                    const char       *subject,
+                    bsl::size_t       subjectLength) const
+{
+    BSLS_ASSERT(result);
+    BSLS_ASSERT(subject || 0 == subjectLength);
+
+    result->clear();
+
+    const bsl::size_t numIds   = d_regExes.size();
+    const bsl::size_t numWords = (numIds + 63) / 64;
+
+    // Select the candidates.
+
+    Word              localWords[k_NUM_LOCAL_WORDS];
+    bsl::vector<Word> words(d_allocator_p);
+    Word             *candidates = localWords;
+
+    if (numWords > k_NUM_LOCAL_WORDS) {
+        words.resize(numWords, 0);
+        candidates = words.data();
+    }
+    else {
+        bsl::memset(localWords, 0, sizeof localWords);
+    }
+
+    for (bsl::size_t i = 0; i < d_unfilteredIds.size(); ++i) {
+        const int id = d_unfilteredIds[i];
+        candidates[id / 64] |= Word(1) << (id % 64);
+    }
+
+    // The expressions added since the prefilter was built are not covered by
+    // the automaton.
+
+    for (bsl::size_t id = d_numPrefiltered; id < numIds; ++id) {
+        candidates[id / 64] |= Word(1) << (id % 64);
+    }
+
+    if (!d_transitions.empty()) {
+        const int *transitions = d_transitions.data();
+        const int *firstOutput = d_firstOutput.data();
+        const int  numClasses  = d_numClasses;
+
+        int state = 0;
+        for (bsl::size_t i = 0; i < subjectLength; ++i) {
+            const unsigned char byte = static_cast<unsigned char>(subject[i]);
+
+            state = transitions[state * numClasses + d_byteClasses[byte]];
+
+            for (int output = firstOutput[state];
+                 0 != output;
+                 output = d_outputLink[output]) {
+                for (int j = d_outputBegin[output];
+                     j < d_outputBegin[output + 1];
+                     ++j) {
+                    const int id = d_outputIds[j];
+                    candidates[id / 64] |= Word(1) << (id % 64);
+                }
+            }
+        }
+    }
+
+    // Confirm the candidates.
+
+    int status = 0;
+    for (bsl::size_t w = 0; w < numWords; ++w) {
+        Word word = candidates[w];
+        while (word) {
+            const int bit = bdlb::BitUtil::numTrailingUnsetBits(
+                                             static_cast<bsl::uint64_t>(word));
+            word &= word - 1;
+
+            const int id = static_cast<int>(w * 64 + bit);
+            const int rc = d_regExes[id]->match(subject, subjectLength);
+
+            if (0 == rc) {
+                result->push_back(id);
+            }
+            else if (1 == rc || 2 == rc) {
+                status = rc;
+            }
+        }
+    }
+
+    return status;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
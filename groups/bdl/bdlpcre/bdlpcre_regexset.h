@@ -0,0 +1,422 @@
+// bdlpcre_regexset.h                                                 -*-C++-*-
+#ifndef INCLUDED_BDLPCRE_REGEXSET
+#define INCLUDED_BDLPCRE_REGEXSET
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id$ $CSID$")
+
+//@PURPOSE: Provide a mechanism for matching a subject against many patterns.
+//
+//@CLASSES:
+//  bdlpcre::RegExSet: mechanism matching a subject against a set of patterns
+//
+//@SEE_ALSO: bdlpcre_regex
+//
+//@DESCRIPTION: This component provides a mechanism, 'bdlpcre::RegExSet', that
+// holds a set of regular expressions, and that determines, in a single call,
+// which of them match a subject string.  Each regular expression added to a
+// set is compiled by a 'bdlpcre::RegEx' object, with the same flags (see
+// {'bdlpcre_regex'|Prepare-Time Flags}), and is identified by its index in the
+// set, in the order in which the expressions were added.
+//
+// Matching a subject against each of many regular expressions in turn takes
+// time proportional to the number of expressions, even if (as is typical when
+// classifying or routing messages) few of them match.  'bdlpcre::RegExSet'
+// instead first scans the subject once to select the *candidate* expressions,
+// and then confirms each candidate using 'bdlpcre::RegEx::match':
+//
+//: o When an expression is added, a *prefilter* *literal* is extracted from
+//:   it: a string that occurs in every subject matching the expression (e.g.,
+//:   "timeout after " for the expression "timeout after [0-9]+ ms").  The
+//:   literal is the longest run of literal characters that appears outside of
+//:   any group, character class, or optional repetition of the expression.
+//:   No literal is extracted from an expression having a top-level
+//:   alternation, or using constructs that cannot be analyzed simply (e.g.,
+//:   inline option settings such as "(?i)", or '\Q...\E' quoting).
+//:
+//: o The prefilter literals of all the expressions are compiled, by
+//:   'buildPrefilter', into a single Aho-Corasick automaton, which finds all
+//:   the literals occurring in a subject in one pass over the subject,
+//:   regardless of the number of expressions.
+//:
+//: o An expression is a candidate if its literal occurs in the subject, if
+//:   it has no literal, or if it was added after the last call to
+//:   'buildPrefilter'.  Only the candidates are matched by PCRE2.
+//
+// The prefilter only ever excludes expressions that cannot match, so the
+// result of matching a subject against a set is the same as matching it
+// against each expression individually.  The automaton compares characters
+// ignoring ASCII case, so that a single automaton serves expressions prepared
+// with and without 'bdlpcre::RegEx::k_FLAG_CASELESS'; note that the
+// prefilter literals are therefore folded to lower case.
+//
+// Supplying 'bdlpcre::RegEx::k_FLAG_JIT' to 'add' is recommended, as the
+// expressions of a set are typically matched many times.
+//
+///Performance
+///-----------
+// Matching a subject of length 'L' against a set of 'N' expressions takes
+// 'O(L + N / 64)' time to select the candidates, plus the time taken by PCRE2
+// to match each candidate.  Adding an expression does not rebuild the
+// automaton; 'buildPrefilter' does, in time proportional to the total length
+// of the prefilter literals of the set (the literals are limited to
+// 'k_MAX_LITERAL_LENGTH' characters).  Sets are intended to be populated
+// once, by adding all the expressions and then calling 'buildPrefilter', and
+// matched many times.  Note that the expressions added after the last call
+// to 'buildPrefilter' are matched against every subject, so that 'match'
+// returns the correct result whether or not the prefilter is current.
+//
+///Thread Safety
+///-------------
+// 'bdlpcre::RegExSet' is *const* *thread-safe*, meaning that accessors
+// (including 'match') may be invoked concurrently from different threads, but
+// it is not safe to access or modify a 'bdlpcre::RegExSet' in one thread while
+// another thread modifies the same object.  Each thread matching the set uses
+// match contexts of its own (see {'bdlpcre_regex'|Thread Safety}), and 'match'
+// does not allocate memory other than to grow the supplied 'result' vector if
+// the set holds at most 1024 expressions.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Classifying Log Messages
+///- - - - - - - - - - - - - - - - - -
+// Suppose that we route log messages to handlers according to the patterns
+// they match.
+//
+// First, we create a set and add the patterns, whose ids are their indices:
+//..
+//  bdlpcre::RegExSet regExSet;
+//  bsl::string       errorMessage;
+//  bsl::size_t       errorOffset;
+//
+//  const int FLAGS = bdlpcre::RegEx::k_FLAG_JIT;
+//
+//  int rc = regExSet.add(&errorMessage,
+//                        &errorOffset,
+//                        "connection (refused|reset) by [0-9.]+",
+//                        FLAGS);
+//  assert(0 == rc);
+//
+//  rc = regExSet.add(&errorMessage,
+//                    &errorOffset,
+//                    "timeout after [0-9]+ ?ms",
+//                    FLAGS);
+//  assert(0 == rc);
+//
+//  rc = regExSet.add(&errorMessage,
+//                    &errorOffset,
+//                    "out of memory",
+//                    FLAGS | bdlpcre::RegEx::k_FLAG_CASELESS);
+//  assert(0 == rc);
+//
+//  rc = regExSet.add(&errorMessage,
+//                    &errorOffset,
+//                    "^\\[WARN\\]|^\\[ERROR\\]");
+//  assert(0 == rc);
+//
+//  assert(4 == regExSet.numPatterns());
+//..
+// Next, having added all the patterns, we build the prefilter:
+//..
+//  assert(false == regExSet.isPrefilterCurrent());
+//
+//  regExSet.buildPrefilter();
+//
+//  assert(true  == regExSet.isPrefilterCurrent());
+//..
+// Then, we observe the prefilter literals that were extracted from the
+// patterns; the last pattern, having a top-level alternation, has none, so it
+// is matched against every subject:
+//..
+//  assert("connection "    == regExSet.prefilterLiteral(0));
+//  assert("timeout after " == regExSet.prefilterLiteral(1));
+//  assert("out of memory"  == regExSet.prefilterLiteral(2));
+//  assert(""               == regExSet.prefilterLiteral(3));
+//..
+// Now, we match a message against all the patterns at once, and obtain the
+// ids of the matching patterns in increasing order:
+//..
+//  const char MESSAGE[] = "[ERROR] request failed: timeout after 250ms";
+//
+//  bsl::vector<int> ids;
+//  rc = regExSet.match(&ids, MESSAGE, sizeof MESSAGE - 1);
+//  assert(0 == rc);
+//
+//  assert(2 == ids.size());
+//  assert(1 == ids[0]);
+//  assert(3 == ids[1]);
+//..
+// Finally, we match a message that no pattern matches:
+//..
+//  const char OTHER[] = "[INFO] Out of office until Monday";
+//
+//  rc = regExSet.match(&ids, OTHER, sizeof OTHER - 1);
+//  assert(0 == rc);
+//  assert(ids.empty());
+//..
+
+#include <bdlscm_version.h>
+
+#include <bdlpcre_regex.h>
+
+#include <bslma_allocator.h>
+#include <bslma_usesbslmaallocator.h>
+
+#include <bslmf_nestedtraitdeclaration.h>
+
+#include <bsls_assert.h>
+#include <bsls_review.h>
+
+#include <bsl_cstddef.h>
+#include <bsl_string.h>
+#include <bsl_vector.h>
+
+namespace BloombergLP {
+namespace bdlpcre {
+
+                              // ==============
+                              // class RegExSet
+                              // ==============
+
+class RegExSet {
+    // This class provides a mechanism for matching a subject string against a
+    // set of regular expressions in one call, using an Aho-Corasick automaton
+    // of literals extracted from the expressions to select the expressions
+    // that are matched by PCRE2.
+
+  public:
+    // PUBLIC CONSTANTS
+    enum {
+        k_MAX_LITERAL_LENGTH = 32  // maximum length of a prefilter literal
+    };
+
+  private:
+    // DATA
+    bsl::vector<RegEx *>       d_regExes;         // compiled expressions
+                                                  // (owned)
+
+    bsl::vector<bsl::string>   d_literals;        // prefilter literal of each
+                                                  // expression, or "" if none
+
+    bsl::vector<int>           d_unfilteredIds;   // ids of the expressions
+                                                  // having no literal
+
+    unsigned char              d_byteClasses[256];
+                                                  // automaton input class of
+                                                  // each byte (0 for bytes
+                                                  // that occur in no literal)
+
+    int                        d_numClasses;      // number of input classes
+
+    bsl::vector<int>           d_transitions;     // automaton transitions,
+                                                  // indexed by
+                                                  // 'state * d_numClasses +
+                                                  // class'
+
+    bsl::vector<int>           d_firstOutput;     // first state (following
+                                                  // failure links) having
+                                                  // outputs, or 0, by state
+
+    bsl::vector<int>           d_outputLink;      // next state (following
+                                                  // failure links) having
+                                                  // outputs, or 0, by state
+
+    bsl::vector<int>           d_outputBegin;     // index of the first output
+                                                  // of each state in
+                                                  // 'd_outputIds'
+
+    bsl::vector<int>           d_outputIds;       // ids of the expressions
+                                                  // whose literal ends at
+                                                  // each state
+
+    int                        d_numPrefiltered;  // number of expressions
+                                                  // (of the lowest ids)
+                                                  // covered by the automaton
+
+    bslma::Allocator          *d_allocator_p;     // memory allocator (held,
+                                                  // not owned)
+
+    // NOT IMPLEMENTED
+    RegExSet(const RegExSet&);
+    RegExSet& operator=(const RegExSet&);
+
+  public:
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(RegExSet, bslma::UsesBslmaAllocator);
+
+    // CLASS METHODS
+    static void extractPrefilterLiteral(bsl::string *result,
+                                        const char  *pattern,
+                                        int          flags);
+        // Load into the specified 'result' the prefilter literal of the
+        // specified 'pattern' prepared with the specified 'flags', folded to
+        // lower case and truncated to 'k_MAX_LITERAL_LENGTH' characters, or
+        // load the empty string if no literal is extracted from 'pattern'.
+        // Every subject that 'pattern' matches contains 'result', ignoring
+        // ASCII case.  The behavior is undefined unless 'pattern' is a valid
+        // regular expression (see 'RegEx::prepare').  Note that if 'flags'
+        // includes both 'RegEx::k_FLAG_UTF8' and 'RegEx::k_FLAG_CASELESS',
+        // 'result' contains no 'k' or 's', which then also match non-ASCII
+        // characters.
+
+    // CREATORS
+    explicit RegExSet(bslma::Allocator *basicAllocator = 0);
+        // Create an empty regular-expression set.  Optionally specify a
+        // 'basicAllocator' used to supply memory.  If 'basicAllocator' is 0,
+        // the currently installed default allocator is used.
+
+    ~RegExSet();
+        // Destroy this regular-expression set.
+
+    // MANIPULATORS
+    int add(bsl::string *errorMessage,
+            bsl::size_t *errorOffset,
+            const char  *pattern,
+            int          flags = 0,
+            bsl::size_t  jitStackSize = 0);
+        // Compile the specified 'pattern' with the optionally specified
+        // 'flags' and 'jitStackSize' (see 'RegEx::prepare'), and add it to
+        // this set with the id 'numPatterns()'.  On success, return 0 with no
+        // effect on the specified 'errorMessage' and 'errorOffset'; 'pattern'
+        // is not prefiltered until 'buildPrefilter' is called.
+        // Otherwise, load 'errorMessage' and 'errorOffset' (if non-null) as
+        // 'RegEx::prepare' does, and return a non-zero value with no effect on
+        // this set.  The behavior is undefined unless 'flags' is a valid
+        // combination of flags for 'RegEx::prepare'.
+
+    void buildPrefilter();
+        // Build the prefilter automaton from the prefilter literals of all the
+        // regular expressions of this set, if any was added since the last
+        // call to this method.  Note that this method should be called once
+        // all the expressions are added, and before the set is matched.
+
+    void clear();
+        // Remove all the regular expressions from this set.
+
+    // ACCESSORS
+    int match(bsl::vector<int> *result,
+              const char       *subject,
+              bsl::size_t       subjectLength) const;
+        // Load into the specified 'result' the ids, in increasing order, of
+        // the regular expressions of this set that match the specified
+        // 'subject' having the specified 'subjectLength'.  Return 0 on
+        // success, 1 if matching an expression exceeded its depth limit, and
+        // 2 if matching an expression exceeded the memory available for its
+        // JIT stack; in either case of failure, the ids of the expressions
+        // that failed to match are not loaded into 'result', but all the
+        // other expressions are matched.  The behavior is undefined unless
+        // 'subject || 0 == subjectLength', and 'subject' is valid UTF-8 if
+        // any expression was added with 'RegEx::k_FLAG_UTF8'.  Note that
+        // 'subject' need not be null-terminated and may contain embedded null
+        // characters.
+
+    bool isPrefilterCurrent() const;
+        // Return 'true' if the prefilter automaton of this set covers all its
+        // regular expressions (i.e., no expression was added since the last
+        // call to 'buildPrefilter'), and 'false' otherwise.
+
+    int numPatterns() const;
+        // Return the number of regular expressions in this set.
+
+    const bsl::string& pattern(int id) const;
+        // Return a reference providing non-modifiable access to the regular
+        // expression having the specified 'id' in this set.  The behavior is
+        // undefined unless '0 <= id < numPatterns()'.
+
+    const bsl::string& prefilterLiteral(int id) const;
+        // Return a reference providing non-modifiable access to the
+        // prefilter literal of the regular expression having the specified
+        // 'id' in this set, or to the empty string if that expression has
+        // no prefilter literal (and is therefore matched against every
+        // subject).  The behavior is undefined unless
+        // '0 <= id < numPatterns()'.
+
+    const RegEx& regEx(int id) const;
+        // Return a reference providing non-modifiable access to the compiled
+        // regular expression having the specified 'id' in this set.  The
+        // behavior is undefined unless '0 <= id < numPatterns()'.
+
+                                  // Aspects
+
+    bslma::Allocator *allocator() const;
+        // Return the allocator used by this object to supply memory.
+};
+
+// ============================================================================
+//                              INLINE DEFINITIONS
+// ============================================================================
+
+                              // --------------
+                              // class RegExSet
+                              // --------------
+
+// ACCESSORS
+inline
+bool RegExSet::isPrefilterCurrent() const
+{
+    return static_cast<bsl::size_t>(d_numPrefiltered) == d_regExes.size();
+}
+
+inline
+int RegExSet::numPatterns() const
+{
+    return static_cast<int>(d_regExes.size());
+}
+
+inline
+const bsl::string& RegExSet::pattern(int id) const
+{
+    BSLS_ASSERT(0 <= id);
+    BSLS_ASSERT(id < numPatterns());
+
+    return d_regExes[id]->pattern();
+}
+
+inline
+const bsl::string& RegExSet::prefilterLiteral(int id) const
+{
+    BSLS_ASSERT(0 <= id);
+    BSLS_ASSERT(id < numPatterns());
+
+    return d_literals[id];
+}
+
+inline
+const RegEx& RegExSet::regEx(int id) const
+{
+    BSLS_ASSERT(0 <= id);
+    BSLS_ASSERT(id < numPatterns());
+
+    return *d_regExes[id];
+}
+
+                                  // Aspects
+
+inline
+bslma::Allocator *RegExSet::allocator() const
+{
+    return d_allocator_p;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,1098 @@
+// bdlpcre_regexset.t.cpp                                             -*-C++-*-
+#include <bdlpcre_regexset.h>
+
+#include <bdlpcre_regex.h>
+
+#include <bslim_testutil.h>
+
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+#include <bslmt_threadutil.h>
+
+#include <bsls_asserttest.h>
+#include <bsls_stopwatch.h>
+#include <bsls_types.h>
+
+#include <bsl_cstdio.h>
+#include <bsl_cstdlib.h>
+#include <bsl_cstring.h>
+#include <bsl_iostream.h>
+#include <bsl_string.h>
+#include <bsl_vector.h>
+
+using namespace BloombergLP;
+using namespace bsl;
+using namespace bdlpcre;
+
+// ============================================================================
+//                                 TEST PLAN
+// ----------------------------------------------------------------------------
+//                                  Overview
+//                                  --------
+// The component under test is a mechanism that matches a subject against a
+// set of regular expressions, using an Aho-Corasick prefilter of literals
+// extracted from the expressions to select the expressions matched by PCRE2.
+// The essential property of the set is that the result of 'match' is the same
+// as matching each expression individually with 'bdlpcre::RegEx'; we verify
+// this against such an oracle over a table of patterns and subjects, and we
+// separately test the extraction of the prefilter literals, on which the
+// performance (but not the correctness) of the set depends.
+// ----------------------------------------------------------------------------
+// CLASS METHODS
+// [ 3] void extractPrefilterLiteral(string *, const char *, int);
+//
+// CREATORS
+// [ 2] explicit RegExSet(bslma::Allocator *basicAllocator = 0);
+// [ 2] ~RegExSet();
+//
+// MANIPULATORS
+// [ 2] int add(string *, size_t *, const char *, int = 0, size_t = 0);
+// [ 2] void buildPrefilter();
+// [ 2] void clear();
+//
+// ACCESSORS
+// [ 2] bool isPrefilterCurrent() const;
+// [ 4] int match(vector<int> *, const char *, size_t) const;
+// [ 2] int numPatterns() const;
+// [ 2] const string& pattern(int id) const;
+// [ 2] const string& prefilterLiteral(int id) const;
+// [ 2] const RegEx& regEx(int id) const;
+// [ 2] bslma::Allocator *allocator() const;
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 5] CONCERN: 'match' IS THREAD-SAFE
+// [ 6] USAGE EXAMPLE
+// [-1] PERFORMANCE: 'match' VS. MATCHING EACH EXPRESSION
+// ----------------------------------------------------------------------------
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLIM_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLIM_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLIM_TESTUTIL_LOOP6_ASSERT
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_SAFE_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_PASS(EXPR)
+#define ASSERT_SAFE_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_FAIL(EXPR)
+#define ASSERT_PASS(EXPR)      BSLS_ASSERTTEST_ASSERT_PASS(EXPR)
+#define ASSERT_FAIL(EXPR)      BSLS_ASSERTTEST_ASSERT_FAIL(EXPR)
+#define ASSERT_OPT_PASS(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_PASS(EXPR)
+#define ASSERT_OPT_FAIL(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_FAIL(EXPR)
+
+// ============================================================================
+//                       GLOBAL TEST VALUES
+// ----------------------------------------------------------------------------
+
+static bool verbose;
+static bool veryVerbose;
+static bool veryVeryVerbose;
+static bool veryVeryVeryVerbose;
+
+// ============================================================================
+//                     GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef RegExSet Obj;
+
+const int CASELESS = RegEx::k_FLAG_CASELESS;
+const int DOTALL   = RegEx::k_FLAG_DOTMATCHESALL;
+
+static const struct {
+    int         d_lineNum;  // source line number
+    const char *d_pattern;  // pattern string
+    int         d_flags;    // flags supplied to 'add'
+} PATTERNS[] = {
+    //line pattern                                    flags
+    //---- ------------------------------------------ -----------------------
+    { L_,  "connection (refused|reset) by [0-9.]+",   0                      },
+    { L_,  "timeout after [0-9]+ ?ms",                0                      },
+    { L_,  "out of memory",                           CASELESS               },
+    { L_,  "^\\[WARN\\]|^\\[ERROR\\]",                0                      },
+    { L_,  "Out",                                     0                      },
+    { L_,  "ab*c",                                    0                      },
+    { L_,  "abc",                                     0                      },
+    { L_,  "bc",                                      0                      },
+    { L_,  "c",                                       0                      },
+    { L_,  "x{2,}yz",                                 0                      },
+    { L_,  "user=[a-z]+;id=\\d+",                     0                      },
+    { L_,  "(?i)ERROR",                               0                      },
+    { L_,  "end$",                                    0                      },
+    { L_,  "ms",                                      CASELESS               },
+    { L_,  "a.c",                                     DOTALL                 },
+    { L_,  "\\bby\\b",                                0                      },
+};
+
+enum { NUM_PATTERNS = sizeof PATTERNS / sizeof *PATTERNS };
+
+static const char *SUBJECTS[] = {
+    "",
+    "c",
+    "abc",
+    "abbbbc",
+    "AC",
+    "a\nc",
+    "[ERROR] request failed: timeout after 250ms",
+    "[WARN] connection refused by 10.1.2.3",
+    "[INFO] Out of office until Monday",
+    "OUT OF MEMORY",
+    "CONNECTION REFUSED BY 1.2.3.4",
+    "xyz xxyz xxxyz",
+    "user=bob;id=42 the end",
+    "error at the end?",
+    "stood by",
+    "nearby",
+    "timeout after ms",
+};
+
+enum { NUM_SUBJECTS = sizeof SUBJECTS / sizeof *SUBJECTS };
+
+// ============================================================================
+//                      GLOBAL HELPER FUNCTIONS FOR TESTING
+// ----------------------------------------------------------------------------
+
+namespace {
+
+void matchEach(bsl::vector<int> *result,
+               const Obj&        set,
+               const char       *subject,
+               bsl::size_t       subjectLength)
+    // Load into the specified 'result' the ids of the expressions of the
+    // specified 'set' that match the specified 'subject' having the specified
+    // 'subjectLength', by matching each expression in turn.
+{
+    result->clear();
+    for (int i = 0; i < set.numPatterns(); ++i) {
+        if (0 == set.regEx(i).match(subject, subjectLength)) {
+            result->push_back(i);
+        }
+    }
+}
+
+struct ThreadArg {
+    // This 'struct' provides the arguments of 'matchThread'.
+
+    const Obj *d_set_p;       // set under test
+    int        d_iterations;  // number of passes over 'SUBJECTS'
+};
+
+extern "C" void *matchThread(void *argument)
+    // Repeatedly match each of 'SUBJECTS' against the set in the specified
+    // 'argument' (a 'ThreadArg'), and verify each result against matching the
+    // expressions individually.
+{
+    const ThreadArg& arg = *static_cast<ThreadArg *>(argument);
+
+    bsl::vector<int> result;
+    bsl::vector<int> expected;
+
+    for (int n = 0; n < arg.d_iterations; ++n) {
+        for (int si = 0; si < NUM_SUBJECTS; ++si) {
+            const char        *SUBJECT = SUBJECTS[si];
+            const bsl::size_t  LENGTH  = bsl::strlen(SUBJECT);
+
+            ASSERTV(si, 0 == arg.d_set_p->match(&result, SUBJECT, LENGTH));
+            matchEach(&expected, *arg.d_set_p, SUBJECT, LENGTH);
+            ASSERTV(si, expected == result);
+        }
+    }
+    return 0;
+}
+
+}  // close unnamed namespace
+
+//=============================================================================
+//                              MAIN PROGRAM
+//-----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int  test           = argc > 1 ? atoi(argv[1]) : 0;
+
+    verbose             = argc > 2;
+    veryVerbose         = argc > 3;
+    veryVeryVerbose     = argc > 4;
+    veryVeryVeryVerbose = argc > 5;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    bslma::TestAllocator defaultAllocator("default", veryVeryVeryVerbose);
+    bslma::DefaultAllocatorGuard guard(&defaultAllocator);
+
+    switch (test) { case 0:  // Zero is always the leading case.
+      case 6: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "USAGE EXAMPLE" << endl
+                          << "=============" << endl;
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Classifying Log Messages
+///- - - - - - - - - - - - - - - - - -
+// Suppose that we route log messages to handlers according to the patterns
+// they match.
+//
+// First, we create a set and add the patterns, whose ids are their indices:
+//..
+    bdlpcre::RegExSet regExSet;
+    bsl::string       errorMessage;
+    bsl::size_t       errorOffset;
+
+    const int FLAGS = bdlpcre::RegEx::k_FLAG_JIT;
+
+    int rc = regExSet.add(&errorMessage,
+                          &errorOffset,
+                          "connection (refused|reset) by [0-9.]+",
+                          FLAGS);
+    ASSERT(0 == rc);
+
+    rc = regExSet.add(&errorMessage,
+                      &errorOffset,
+                      "timeout after [0-9]+ ?ms",
+                      FLAGS);
+    ASSERT(0 == rc);
+
+    rc = regExSet.add(&errorMessage,
+                      &errorOffset,
+                      "out of memory",
+                      FLAGS | bdlpcre::RegEx::k_FLAG_CASELESS);
+    ASSERT(0 == rc);
+
+    rc = regExSet.add(&errorMessage,
+                      &errorOffset,
+                      "^\\[WARN\\]|^\\[ERROR\\]");
+    ASSERT(0 == rc);
+
+    ASSERT(4 == regExSet.numPatterns());
+//..
+// Next, having added all the patterns, we build the prefilter:
+//..
+    ASSERT(false == regExSet.isPrefilterCurrent());
+
+    regExSet.buildPrefilter();
+
+    ASSERT(true  == regExSet.isPrefilterCurrent());
+//..
+// Then, we observe the prefilter literals that were extracted from the
+// patterns; the last pattern, having a top-level alternation, has none, so it
+// is matched against every subject:
+//..
+    ASSERT("connection "    == regExSet.prefilterLiteral(0));
+    ASSERT("timeout after " == regExSet.prefilterLiteral(1));
+    ASSERT("out of memory"  == regExSet.prefilterLiteral(2));
+    ASSERT(""               == regExSet.prefilterLiteral(3));
+//..
+// Now, we match a message against all the patterns at once, and obtain the
+// ids of the matching patterns in increasing order:
+//..
+    const char MESSAGE[] = "[ERROR] request failed: timeout after 250ms";
+
+    bsl::vector<int> ids;
+    rc = regExSet.match(&ids, MESSAGE, sizeof MESSAGE - 1);
+    ASSERT(0 == rc);
+
+    ASSERT(2 == ids.size());
+    ASSERT(1 == ids[0]);
+    ASSERT(3 == ids[1]);
+//..
+// Finally, we match a message that no pattern matches:
+//..
+    const char OTHER[] = "[INFO] Out of office until Monday";
+
+    rc = regExSet.match(&ids, OTHER, sizeof OTHER - 1);
+    ASSERT(0 == rc);
+    ASSERT(ids.empty());
+//..
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // TESTING 'match' THREAD SAFETY
+        //
+        // Concerns:
+        //: 1 'match' can be called concurrently from multiple threads, each
+        //:   obtaining the same results as a single thread would.
+        //
+        // Plan:
+        //: 1 Populate a set from 'PATTERNS', with and without JIT, and match
+        //:   'SUBJECTS' repeatedly from several threads, verifying each result
+        //:   against matching the expressions individually.  (C-1)
+        //
+        // Testing:
+        //   CONCERN: 'match' IS THREAD-SAFE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING 'match' THREAD SAFETY" << endl
+                          << "=============================" << endl;
+
+        enum { k_NUM_THREADS = 8 };
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+        for (int jit = 0; jit < 2; ++jit) {
+            Obj mX(&oa);  const Obj& X = mX;
+
+            bsl::string errorMessage;
+            bsl::size_t errorOffset;
+
+            for (int i = 0; i < NUM_PATTERNS; ++i) {
+                const int FLAGS = PATTERNS[i].d_flags
+                                | (jit ? RegEx::k_FLAG_JIT : 0);
+
+                ASSERTV(PATTERNS[i].d_lineNum,
+                        0 == mX.add(&errorMessage,
+                                    &errorOffset,
+                                    PATTERNS[i].d_pattern,
+                                    FLAGS));
+            }
+            mX.buildPrefilter();
+
+            ThreadArg arg = { &X, 200 };
+
+            bslmt::ThreadUtil::Handle threads[k_NUM_THREADS];
+
+            for (int i = 0; i < k_NUM_THREADS; ++i) {
+                ASSERT(0 == bslmt::ThreadUtil::create(&threads[i],
+                                                      matchThread,
+                                                      &arg));
+            }
+            for (int i = 0; i < k_NUM_THREADS; ++i) {
+                ASSERT(0 == bslmt::ThreadUtil::join(threads[i]));
+            }
+        }
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // TESTING 'match'
+        //
+        // Concerns:
+        //: 1 'match' loads the ids, in increasing order, of exactly the
+        //:   expressions that match the subject individually, including
+        //:   expressions with no prefilter literal, caseless expressions, and
+        //:   expressions whose literals overlap or are suffixes of one
+        //:   another.
+        //:
+        //: 2 'match' respects 'subjectLength', and handles subjects containing
+        //:   null and non-ASCII bytes.
+        //:
+        //: 3 Any previous contents of 'result' are discarded.
+        //:
+        //: 4 Sets holding more than 1024 expressions are supported.
+        //:
+        //: 5 'match' on an empty set loads an empty 'result'.
+        //:
+        //: 6 Precondition violations are detected in appropriate build modes.
+        //:
+        //: 7 The results are the same whether the prefilter was built after
+        //:   all, some, or none of the expressions were added.
+        //
+        // Plan:
+        //: 1 For each prefix of 'PATTERNS', with and without JIT, populate a
+        //:   set, building the prefilter after all, half, or none of the
+        //:   expressions were added, and compare the result of matching each
+        //:   of 'SUBJECTS' with the result of matching each expression
+        //:   individually.  (C-1, 3, 7)
+        //:
+        //: 2 Match subjects specified with a length shorter than their
+        //:   null-terminated length, and subjects containing '\0' and '\xff'.
+        //:   (C-2)
+        //:
+        //: 3 Populate a set with 1500 distinct literal patterns, and verify
+        //:   the results of matching subjects containing selected literals.
+        //:   (C-4)
+        //:
+        //: 4 Match a subject against an empty set.  (C-5)
+        //:
+        //: 5 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for invalid arguments.  (C-6)
+        //
+        // Testing:
+        //   int match(vector<int> *, const char *, size_t) const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING 'match'" << endl
+                          << "===============" << endl;
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+        bsl::string errorMessage;
+        bsl::size_t errorOffset;
+
+        if (verbose) cout << "\tComparing with individual matching." << endl;
+
+        for (int numPatterns = 0; numPatterns <= NUM_PATTERNS; ++numPatterns) {
+            for (int cfg = 0; cfg < 6; ++cfg) {
+                const int jit   = cfg % 2;
+                const int build = cfg / 2;
+
+                Obj mX(&oa);  const Obj& X = mX;
+
+                // Build the prefilter after all ('0 == build'), half
+                // ('1 == build'), or none ('2 == build') of the expressions
+                // were added.
+
+                const int NUM_PREFILTERED = 0 == build ? numPatterns
+                                          : 1 == build ? numPatterns / 2
+                                          : -1;
+
+                for (int i = 0; i < numPatterns; ++i) {
+                    const int FLAGS = PATTERNS[i].d_flags
+                                    | (jit ? RegEx::k_FLAG_JIT : 0);
+
+                    if (i == NUM_PREFILTERED) {
+                        mX.buildPrefilter();
+                    }
+                    ASSERTV(PATTERNS[i].d_lineNum,
+                            0 == mX.add(&errorMessage,
+                                        &errorOffset,
+                                        PATTERNS[i].d_pattern,
+                                        FLAGS));
+                }
+                if (numPatterns == NUM_PREFILTERED) {
+                    mX.buildPrefilter();
+                }
+                ASSERTV(numPatterns, build,
+                        (0 == build || 0 == numPatterns) ==
+                                                      X.isPrefilterCurrent());
+
+                bsl::vector<int> result(3, -1);
+                bsl::vector<int> expected;
+
+                for (int si = 0; si < NUM_SUBJECTS; ++si) {
+                    const char        *SUBJECT = SUBJECTS[si];
+                    const bsl::size_t  LENGTH  = bsl::strlen(SUBJECT);
+
+                    ASSERTV(numPatterns, si,
+                            0 == X.match(&result, SUBJECT, LENGTH));
+                    matchEach(&expected, X, SUBJECT, LENGTH);
+
+                    if (veryVerbose) {
+                        T_ P_(numPatterns) P_(SUBJECT) P(result.size())
+                    }
+                    ASSERTV(numPatterns, build, jit, si, expected == result);
+
+                    // Every proper prefix of the subject.
+
+                    for (bsl::size_t len = 0; len < LENGTH; ++len) {
+                        ASSERTV(si, len, 0 == X.match(&result, SUBJECT, len));
+                        matchEach(&expected, X, SUBJECT, len);
+                        ASSERTV(numPatterns, build, si, len,
+                                expected == result);
+                    }
+                }
+            }
+        }
+
+        if (verbose) cout << "\tEmbedded null and non-ASCII bytes." << endl;
+        {
+            Obj mX(&oa);  const Obj& X = mX;
+
+            ASSERT(0 == mX.add(&errorMessage, &errorOffset, "abc"));
+            ASSERT(0 == mX.add(&errorMessage, &errorOffset, "b\\x00c"));
+            ASSERT(0 == mX.add(&errorMessage, &errorOffset, "\\xffz"));
+            mX.buildPrefilter();
+
+            const char SUBJECT[] = "b\0c \xff" "z abc";
+
+            bsl::vector<int> result;
+            ASSERT(0 == X.match(&result, SUBJECT, sizeof SUBJECT - 1));
+            ASSERTV(result.size(), 3 == result.size());
+
+            ASSERT(0 == X.match(&result, SUBJECT, 5));
+            ASSERTV(result.size(), 1 == result.size());
+            ASSERT(1 == result[0]);
+
+            ASSERT(0 == X.match(&result, 0, 0));
+            ASSERT(result.empty());
+        }
+
+        if (verbose) cout << "\tCaseless UTF-8 expressions." << endl;
+        {
+            const int CU = RegEx::k_FLAG_CASELESS | RegEx::k_FLAG_UTF8;
+
+            Obj mX(&oa);  const Obj& X = mX;
+
+            ASSERT(0 == mX.add(&errorMessage, &errorOffset, "kelvin", CU));
+            ASSERT(0 == mX.add(&errorMessage,
+                               &errorOffset,
+                               "(?i)kelvin",
+                               RegEx::k_FLAG_UTF8));
+            ASSERT(0 == mX.add(&errorMessage, &errorOffset, "mass", CU));
+            mX.buildPrefilter();
+
+            // U+212A (KELVIN SIGN) and U+017F (LATIN SMALL LETTER LONG S).
+
+            const char SUBJECT[] = "\xE2\x84\xAA" "elvin ma\xC5\xBF" "s";
+
+            bsl::vector<int> result;
+            ASSERT(0 == X.match(&result, SUBJECT, sizeof SUBJECT - 1));
+
+            bsl::vector<int> expected;
+            matchEach(&expected, X, SUBJECT, sizeof SUBJECT - 1);
+            ASSERTV(expected.size(), 3 == expected.size());
+            ASSERT(expected == result);
+        }
+
+        if (verbose) cout << "\tMore than 1024 expressions." << endl;
+        {
+            enum { k_NUM = 1500 };
+
+            Obj mX(&oa);  const Obj& X = mX;
+
+            for (int i = 0; i < k_NUM; ++i) {
+                char pattern[32];
+                bsl::sprintf(pattern, "<%d>", i);
+                ASSERTV(i, 0 == mX.add(&errorMessage, &errorOffset, pattern));
+            }
+            ASSERT(k_NUM == X.numPatterns());
+            mX.buildPrefilter();
+
+            const char SUBJECT[] = "<7> <1030> <1499> <1500>";
+
+            bsl::vector<int> result;
+            ASSERT(0 == X.match(&result, SUBJECT, sizeof SUBJECT - 1));
+            ASSERTV(result.size(), 3 == result.size());
+            if (3 == result.size()) {
+                ASSERT(   7 == result[0]);
+                ASSERT(1030 == result[1]);
+                ASSERT(1499 == result[2]);
+            }
+        }
+
+        if (verbose) cout << "\tEmpty set." << endl;
+        {
+            Obj mX(&oa);  const Obj& X = mX;
+
+            bsl::vector<int> result(2, 0);
+            ASSERT(0 == X.match(&result, "abc", 3));
+            ASSERT(result.empty());
+        }
+
+        if (verbose) cout << "\tNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            Obj mX(&oa);  const Obj& X = mX;
+
+            bsl::vector<int> result;
+
+            ASSERT_PASS(X.match(&result, "abc", 3));
+            ASSERT_PASS(X.match(&result, 0, 0));
+            ASSERT_FAIL(X.match(0, "abc", 3));
+            ASSERT_FAIL(X.match(&result, 0, 3));
+        }
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // TESTING 'extractPrefilterLiteral'
+        //
+        // Concerns:
+        //: 1 The literal is the longest run of literal characters that every
+        //:   match of the pattern contains, ignoring characters inside groups,
+        //:   character classes, and optional repetitions.
+        //:
+        //: 2 Escaped metacharacters are literal; escapes denoting classes,
+        //:   assertions or code points are not.
+        //:
+        //: 3 No literal is extracted from patterns having a top-level
+        //:   alternation, inline options, verbs, or '\Q...\E' quoting.
+        //:
+        //: 4 The literal is folded to lower case and truncated to
+        //:   'k_MAX_LITERAL_LENGTH' characters.
+        //:
+        //: 5 Any previous contents of 'result' are discarded.
+        //:
+        //: 6 With both 'k_FLAG_UTF8' and 'k_FLAG_CASELESS', the literal
+        //:   contains no 'k' or 's', which match non-ASCII characters.
+        //
+        // Plan:
+        //: 1 Using the table-driven technique, verify the literal extracted
+        //:   from a variety of patterns.  (C-1..5)
+        //:
+        //: 2 Using the table-driven technique, verify the literal extracted
+        //:   from patterns with various flags.  (C-6)
+        //
+        // Testing:
+        //   void extractPrefilterLiteral(string *, const char *, int);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING 'extractPrefilterLiteral'" << endl
+                          << "=================================" << endl;
+
+        static const struct {
+            int         d_lineNum;   // source line number
+            const char *d_pattern;   // pattern string
+            const char *d_literal;   // expected literal
+        } DATA[] = {
+            //line pattern                          literal
+            //---- -------------------------------  -------------------------
+            { L_,  "",                              ""                       },
+            { L_,  "abc",                           "abc"                    },
+            { L_,  "ABC",                           "abc"                    },
+            { L_,  "^abc$",                         "abc"                    },
+            { L_,  "a.bcd",                         "bcd"                    },
+            { L_,  "ab[xy]c",                       "ab"                     },
+            { L_,  "ab[]x]cde",                     "cde"                    },
+            { L_,  "ab[^]x]cde",                    "cde"                    },
+            { L_,  "ab[[:alpha:]]cde",              "cde"                    },
+            { L_,  "abc(de|fg)hi",                  "abc"                    },
+            { L_,  "ab(c(d)e)fgh",                  "fgh"                    },
+            { L_,  "ab(?:cd)efg",                   "efg"                    },
+            { L_,  "abc|def",                       ""                       },
+            { L_,  "(abc|def)",                     ""                       },
+            { L_,  "abcd*",                         "abc"                    },
+            { L_,  "abcd?",                         "abc"                    },
+            { L_,  "abcd+e",                        "abcd"                   },
+            { L_,  "ab+cdef",                       "bcdef"                  },
+            { L_,  "ab{2}cdef",                     "bcdef"                  },
+            { L_,  "ab{0,3}cd",                     "cd"                     },
+            { L_,  "abc{,3}d",                      "ab"                     },
+            { L_,  "abc{x}d",                       "x}d"                    },
+            { L_,  "a\\.b\\*c",                     "a.b*c"                  },
+            { L_,  "a\\dbcd",                       "bcd"                    },
+            { L_,  "abc\\bdef",                     "abc"                    },
+            { L_,  "\\x41bc",                       "bc"                     },
+            { L_,  "(?i)abc",                       ""                       },
+            { L_,  "(*UTF)abc",                     ""                       },
+            { L_,  "\\Qabc\\E",                     ""                       },
+            { L_,  "abc(?=d)efgh",                  "efgh"                   },
+            { L_,  "x(?<name>y)zzz",                "zzz"                    },
+            { L_,  "0123456789012345678901234567890123456789",
+                          "01234567890123456789012345678901"                 },
+            { L_,  "a\xc3\xa9" "bc",                "bc"                     },
+        };
+
+        enum { NUM_DATA = sizeof DATA / sizeof *DATA };
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int   LINE    = DATA[ti].d_lineNum;
+            const char *PATTERN = DATA[ti].d_pattern;
+            const char *LITERAL = DATA[ti].d_literal;
+
+            bsl::string literal("garbage");
+            Obj::extractPrefilterLiteral(&literal, PATTERN, 0);
+
+            if (veryVerbose) { T_ P_(LINE) P_(PATTERN) P(literal) }
+
+            ASSERTV(LINE, PATTERN, LITERAL, literal, LITERAL == literal);
+            ASSERTV(LINE, literal.size() <= Obj::k_MAX_LITERAL_LENGTH);
+        }
+
+        if (verbose) cout << "\tFlags." << endl;
+        {
+            const int CU = RegEx::k_FLAG_CASELESS | RegEx::k_FLAG_UTF8;
+
+            static const struct {
+                int         d_lineNum;   // source line number
+                const char *d_pattern;   // pattern string
+                int         d_flags;     // flags
+                const char *d_literal;   // expected literal
+            } FLAG_DATA[] = {
+                //line pattern     flags                    literal
+                //---- ----------  -----------------------  ---------
+                { L_,  "kelvin",   0,                       "kelvin"  },
+                { L_,  "kelvin",   RegEx::k_FLAG_UTF8,      "kelvin"  },
+                { L_,  "kelvin",   RegEx::k_FLAG_CASELESS,  "kelvin"  },
+                { L_,  "kelvin",   CU,                      "elvin"   },
+                { L_,  "KELVIN",   CU,                      "elvin"   },
+                { L_,  "mask",     CU,                      "ma"      },
+                { L_,  "ab\\sde",  CU,                      "ab"      },
+                { L_,  "sk",       CU,                      ""        },
+            };
+
+            enum { NUM_FLAG_DATA = sizeof FLAG_DATA / sizeof *FLAG_DATA };
+
+            for (int ti = 0; ti < NUM_FLAG_DATA; ++ti) {
+                const int   LINE    = FLAG_DATA[ti].d_lineNum;
+                const char *PATTERN = FLAG_DATA[ti].d_pattern;
+                const int   FLAGS   = FLAG_DATA[ti].d_flags;
+                const char *LITERAL = FLAG_DATA[ti].d_literal;
+
+                bsl::string literal("garbage");
+                Obj::extractPrefilterLiteral(&literal, PATTERN, FLAGS);
+
+                if (veryVerbose) { T_ P_(LINE) P_(PATTERN) P(literal) }
+
+                ASSERTV(LINE, PATTERN, LITERAL, literal, LITERAL == literal);
+            }
+        }
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // TESTING 'add', 'clear', AND BASIC ACCESSORS
+        //
+        // Concerns:
+        //: 1 'add' compiles the pattern with the supplied flags, assigns it
+        //:   the next id, and records its pattern and prefilter literal.
+        //:
+        //: 2 A pattern that fails to compile is reported as 'RegEx::prepare'
+        //:   reports it, and leaves the set unchanged.
+        //:
+        //: 3 'clear' removes all the expressions, and the set is usable
+        //:   afterwards.
+        //:
+        //: 4 All memory is supplied by the object allocator, and is released
+        //:   on destruction.
+        //:
+        //: 5 'add' does not build the prefilter; 'buildPrefilter' builds it
+        //:   for all the expressions of the set, and has no effect if the
+        //:   prefilter is current.  'isPrefilterCurrent' reports whether an
+        //:   expression was added since the prefilter was built, and 'clear'
+        //:   leaves the prefilter current.
+        //
+        // Plan:
+        //: 1 Add several patterns, verifying the accessors after each.
+        //:   (C-1)
+        //:
+        //: 2 Add an invalid pattern, and verify the error and the state of
+        //:   the set.  (C-2)
+        //:
+        //: 3 Clear the set and add patterns again.  (C-3)
+        //:
+        //: 4 Use a test allocator, installing another as the default, and
+        //:   verify allocations and leaks.  (C-4)
+        //:
+        //: 5 Verify 'isPrefilterCurrent' after each 'add', 'buildPrefilter',
+        //:   and 'clear', and that building a current prefilter allocates no
+        //:   memory.  (C-5)
+        //
+        // Testing:
+        //   explicit RegExSet(bslma::Allocator *basicAllocator = 0);
+        //   ~RegExSet();
+        //   int add(string *, size_t *, const char *, int = 0, size_t = 0);
+        //   void buildPrefilter();
+        //   void clear();
+        //   bool isPrefilterCurrent() const;
+        //   int numPatterns() const;
+        //   const string& pattern(int id) const;
+        //   const string& prefilterLiteral(int id) const;
+        //   const RegEx& regEx(int id) const;
+        //   bslma::Allocator *allocator() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING 'add', 'clear', AND BASIC ACCESSORS"
+                          << endl
+                          << "==========================================="
+                          << endl;
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+        {
+            Obj mX(&oa);  const Obj& X = mX;
+
+            ASSERT(&oa  == X.allocator());
+            ASSERT(0    == X.numPatterns());
+            ASSERT(true == X.isPrefilterCurrent());
+
+            bsl::string errorMessage(&oa);
+            bsl::size_t errorOffset = 0;
+
+            ASSERT(0 == mX.add(&errorMessage,
+                               &errorOffset,
+                               "Hello, [a-z]+",
+                               RegEx::k_FLAG_CASELESS));
+            ASSERT(1                      == X.numPatterns());
+            ASSERT("Hello, [a-z]+"        == X.pattern(0));
+            ASSERT("hello, "              == X.prefilterLiteral(0));
+            ASSERT(RegEx::k_FLAG_CASELESS == X.regEx(0).flags());
+            ASSERT(X.regEx(0).isPrepared());
+            ASSERT(errorMessage.empty());
+            ASSERT(false == X.isPrefilterCurrent());
+
+            ASSERT(0 == mX.add(0, 0, "(x|y)+", RegEx::k_FLAG_JIT, 8192));
+            ASSERT(2        == X.numPatterns());
+            ASSERT("(x|y)+" == X.pattern(1));
+            ASSERT(""       == X.prefilterLiteral(1));
+            ASSERT(8192     == X.regEx(1).jitStackSize());
+
+            ASSERT(0 < oa.numBlocksInUse());
+
+            if (verbose) cout << "\tBuilding the prefilter." << endl;
+
+            mX.buildPrefilter();
+            ASSERT(true == X.isPrefilterCurrent());
+            {
+                const bsls::Types::Int64 NUM_BLOCKS = oa.numBlocksTotal();
+
+                mX.buildPrefilter();
+                ASSERT(true       == X.isPrefilterCurrent());
+                ASSERT(NUM_BLOCKS == oa.numBlocksTotal());
+            }
+
+            if (verbose) cout << "\tInvalid pattern." << endl;
+
+            ASSERT(0 != mX.add(&errorMessage, &errorOffset, "ab(c"));
+            ASSERT(!errorMessage.empty());
+            ASSERTV(errorOffset, 4 == errorOffset);
+            ASSERT(2 == X.numPatterns());
+
+            ASSERT(0 != mX.add(0, 0, "*"));
+            ASSERT(2    == X.numPatterns());
+            ASSERT(true == X.isPrefilterCurrent());
+
+            bsl::vector<int> result(&oa);
+            ASSERT(0 == X.match(&result, "hello, world xy", 15));
+            ASSERT(2 == result.size());
+
+            if (verbose) cout << "\tClear." << endl;
+
+            mX.clear();
+            ASSERT(0    == X.numPatterns());
+            ASSERT(true == X.isPrefilterCurrent());
+            ASSERT(0 == X.match(&result, "hello, world xy", 15));
+            ASSERT(result.empty());
+
+            ASSERT(0 == mX.add(&errorMessage, &errorOffset, "world"));
+            ASSERT(1       == X.numPatterns());
+            ASSERT("world" == X.prefilterLiteral(0));
+            ASSERT(false   == X.isPrefilterCurrent());
+            ASSERT(0 == X.match(&result, "hello, world xy", 15));
+            ASSERT(1 == result.size());
+            ASSERT(0 == result[0]);
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+        ASSERTV(defaultAllocator.numBlocksTotal(),
+                0 == defaultAllocator.numBlocksTotal());
+
+        if (verbose) cout << "\tDefault allocator." << endl;
+        {
+            Obj mX;  const Obj& X = mX;
+
+            ASSERT(&defaultAllocator == X.allocator());
+        }
+        ASSERT(0 == defaultAllocator.numBlocksInUse());
+
+        if (verbose) cout << "\tNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            Obj mX(&oa);  const Obj& X = mX;
+
+            ASSERT_FAIL(mX.add(0, 0, 0));
+            ASSERT_PASS(mX.add(0, 0, "abc"));
+
+            ASSERT_FAIL(X.pattern(-1));
+            ASSERT_PASS(X.pattern(0));
+            ASSERT_FAIL(X.pattern(1));
+
+            ASSERT_FAIL(X.prefilterLiteral(-1));
+            ASSERT_PASS(X.prefilterLiteral(0));
+            ASSERT_FAIL(X.prefilterLiteral(1));
+
+            ASSERT_FAIL(X.regEx(-1));
+            ASSERT_PASS(X.regEx(0));
+            ASSERT_FAIL(X.regEx(1));
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Add a few patterns to a set, and match a few subjects.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+        Obj mX(&oa);  const Obj& X = mX;
+
+        bsl::string errorMessage;
+        bsl::size_t errorOffset;
+
+        ASSERT(0 == mX.add(&errorMessage, &errorOffset, "abc"));
+        ASSERT(0 == mX.add(&errorMessage, &errorOffset, "b+c"));
+        ASSERT(0 == mX.add(&errorMessage, &errorOffset, "[0-9]+"));
+        ASSERT(3 == X.numPatterns());
+
+        mX.buildPrefilter();
+
+        bsl::vector<int> result;
+
+        ASSERT(0 == X.match(&result, "xabcx", 5));
+        ASSERT(2 == result.size());
+        ASSERT(0 == result[0]);
+        ASSERT(1 == result[1]);
+
+        ASSERT(0 == X.match(&result, "42", 2));
+        ASSERT(1 == result.size());
+        ASSERT(2 == result[0]);
+
+        ASSERT(0 == X.match(&result, "xyz", 3));
+        ASSERT(result.empty());
+      } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE: 'match' VS. MATCHING EACH EXPRESSION
+        //
+        // Concerns:
+        //: 1 Matching a set having many expressions with distinct literals is
+        //:   substantially faster than matching each expression in turn.
+        //
+        // Plan:
+        //: 1 Populate a set with many JIT-compiled patterns of the form
+        //:   "code=NNNN [a-z]+", and time matching a few subjects with 'match'
+        //:   and by matching each expression.  Optionally specify the number
+        //:   of patterns as the second argument.  (C-1)
+        //
+        // Testing:
+        //   PERFORMANCE: 'match' VS. MATCHING EACH EXPRESSION
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "PERFORMANCE: 'match' VS. MATCHING EACH "
+                          << "EXPRESSION" << endl
+                          << "======================================="
+                          << "==========" << endl;
+
+        const int NUM = argc > 2 && atoi(argv[2]) > 0 ? atoi(argv[2]) : 1000;
+        const int ITERATIONS = 2000;
+
+        Obj mX;  const Obj& X = mX;
+
+        for (int i = 0; i < NUM; ++i) {
+            char pattern[64];
+            bsl::sprintf(pattern, "code=%04d [a-z]+", i);
+            ASSERT(0 == mX.add(0, 0, pattern, RegEx::k_FLAG_JIT));
+        }
+        mX.buildPrefilter();
+
+        const char *SUBJECTS[] = {
+            "request rejected: code=0042 denied by policy",
+            "nothing to see here, move along",
+            "code=0999 retry; code=0007 abort",
+        };
+        const int NUM_SUBJECTS = sizeof SUBJECTS / sizeof *SUBJECTS;
+
+        bsl::vector<int> result;
+        bsl::vector<int> expected;
+        bsls::Stopwatch  timer;
+
+        timer.start();
+        for (int n = 0; n < ITERATIONS; ++n) {
+            for (int si = 0; si < NUM_SUBJECTS; ++si) {
+                X.match(&result, SUBJECTS[si], bsl::strlen(SUBJECTS[si]));
+            }
+        }
+        timer.stop();
+        const double setTime = timer.elapsedTime();
+
+        timer.reset();
+        timer.start();
+        for (int n = 0; n < ITERATIONS; ++n) {
+            for (int si = 0; si < NUM_SUBJECTS; ++si) {
+                matchEach(&expected,
+                          X,
+                          SUBJECTS[si],
+                          bsl::strlen(SUBJECTS[si]));
+            }
+        }
+        timer.stop();
+        const double eachTime = timer.elapsedTime();
+
+        ASSERT(expected == result);
+
+        cout << "patterns: " << NUM << endl
+             << "\t'match' time:          " << setTime  << endl
+             << "\tmatching each time:    " << eachTime << endl;
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -7,6 +7,7 @@ BSLS_IDENT_RCSID(bdlt_calendar_cpp,"$Id$ $CSID$")
 #include <bslma_default.h>
 #include <bsls_assert.h>
 
+#include <bsl_algorithm.h>
 #include <bsl_ostream.h>
 
 namespace BloombergLP {
@@ -21,6 +22,58 @@ BSLMF_ASSERT(-1 == static_cast<int>(bdlc::BitArray::k_INVALID_INDEX));
                               // --------------
 
 // PRIVATE MANIPULATORS
+void Calendar::reserveCacheCapacity(int numDays)
+{
+    BSLS_ASSERT(0 <= numDays);
+
+    d_nonBusinessDays.reserveCapacity(numDays);
+    d_businessDayCounts.reserve(numDays / bdlc::BitArray::k_BITS_PER_UINT64
+                                                                         + 2);
+}
+
+void Calendar::synchronizeBusinessDayCounts(int offset)
+{
+    BSLS_ASSERT(0 <= offset);
+
+    enum { k_BITS_PER_BLOCK = bdlc::BitArray::k_BITS_PER_UINT64 };
+
+    const int length = static_cast<int>(d_nonBusinessDays.length());
+
+    if (0 == length) {
+        d_businessDayCounts.clear();
+        return;                                                       // RETURN
+    }
+
+    const int numBlocks = (length + k_BITS_PER_BLOCK - 1) / k_BITS_PER_BLOCK;
+
+    // The count of a block is the number of business days preceding it, so
+    // the counts up to, and including, that of the block holding 'offset' are
+    // unaffected by a change at or after 'offset', unless the number of blocks
+    // has changed.
+
+    int firstBlock = offset / k_BITS_PER_BLOCK;
+    if (d_businessDayCounts.size() !=
+                                   static_cast<bsl::size_t>(numBlocks + 1)
+     || numBlocks <= firstBlock) {
+        d_businessDayCounts.resize(numBlocks + 1);
+        firstBlock = 0;
+    }
+
+    int count = 0 == firstBlock ? 0 : d_businessDayCounts[firstBlock];
+    for (int block = firstBlock; block < numBlocks; ++block) {
+        d_businessDayCounts[block] = count;
+
+        const int begin   = block * k_BITS_PER_BLOCK;
+        const int numBits = length - begin < k_BITS_PER_BLOCK
+                          ? length - begin
+                          : k_BITS_PER_BLOCK;
+
+        count += numBits - bdlb::BitUtil::numBitsSet(
+                                      d_nonBusinessDays.bits(begin, numBits));
+    }
+    d_businessDayCounts[numBlocks] = count;
+}
+
 void Calendar::synchronizeCache()
 {
     const int length = d_packedCalendar.length();
@@ -87,6 +140,7 @@ void Calendar::synchronizeCache()
             }
         }
     }
+    synchronizeBusinessDayCounts(0);
 }
 
 // PRIVATE ACCESSORS
@@ -97,6 +151,33 @@ bool Calendar::isCacheSynchronized() const
         return false;                                                 // RETURN
     }
 
+    enum { k_BITS_PER_BLOCK = bdlc::BitArray::k_BITS_PER_UINT64 };
+
+    const int length    = d_packedCalendar.length();
+    const int numBlocks = (length + k_BITS_PER_BLOCK - 1) / k_BITS_PER_BLOCK;
+
+    if (d_businessDayCounts.size() !=
+                               static_cast<bsl::size_t>(length ? numBlocks + 1
+                                                               : 0)) {
+        return false;                                                 // RETURN
+    }
+
+    int count = 0;
+    for (int block = 0; length && block <= numBlocks; ++block) {
+        if (d_businessDayCounts[block] != count) {
+            return false;                                             // RETURN
+        }
+
+        const int begin = block * k_BITS_PER_BLOCK;
+        const int end   = block + 1 < numBlocks
+                        ? begin + k_BITS_PER_BLOCK
+                        : length;
+
+        if (begin < end) {
+            count += static_cast<int>(d_nonBusinessDays.num0(begin, end));
+        }
+    }
+
     if (0 == d_packedCalendar.length()) {
         return true;                                                  // RETURN
     }
@@ -123,6 +204,7 @@ bool Calendar::isCacheSynchronized() const
 Calendar::Calendar(bslma::Allocator *basicAllocator)
 : d_packedCalendar(basicAllocator)
 , d_nonBusinessDays(basicAllocator)
+, d_businessDayCounts(basicAllocator)
 {
 }
 
@@ -131,14 +213,17 @@ Calendar::Calendar(const Date&       firstDate,
                    bslma::Allocator *basicAllocator)
 : d_packedCalendar(firstDate, lastDate, basicAllocator)
 , d_nonBusinessDays(basicAllocator)
+, d_businessDayCounts(basicAllocator)
 {
     d_nonBusinessDays.setLength(d_packedCalendar.length(), 0);
+    synchronizeBusinessDayCounts(0);
 }
 
 Calendar::Calendar(const PackedCalendar&  packedCalendar,
                    bslma::Allocator      *basicAllocator)
 : d_packedCalendar(packedCalendar, basicAllocator)
 , d_nonBusinessDays(basicAllocator)
+, d_businessDayCounts(basicAllocator)
 {
     synchronizeCache();
 }
@@ -146,6 +231,7 @@ Calendar::Calendar(const PackedCalendar&  packedCalendar,
 Calendar::Calendar(const Calendar& original, bslma::Allocator *basicAllocator)
 : d_packedCalendar(original.d_packedCalendar, basicAllocator)
 , d_nonBusinessDays(original.d_nonBusinessDays, basicAllocator)
+, d_businessDayCounts(original.d_businessDayCounts, basicAllocator)
 {
 }
 
@@ -171,20 +257,20 @@ void Calendar::addDay(const Date& date)
 void Calendar::addHoliday(const Date& date)
 {
     if (0 == length()) {
-        d_nonBusinessDays.reserveCapacity(1);
+        reserveCacheCapacity(1);
         reserveHolidayCapacity(1);
         d_packedCalendar.addHoliday(date);
         synchronizeCache();
     }
     else if (date < d_packedCalendar.firstDate()) {
-        d_nonBusinessDays.reserveCapacity(
+        reserveCacheCapacity(
                                        d_packedCalendar.lastDate() - date + 1);
         reserveHolidayCapacity(numHolidays() + 1);
         d_packedCalendar.addHoliday(date);
         synchronizeCache();
     }
     else if (date > d_packedCalendar.lastDate()) {
-        d_nonBusinessDays.reserveCapacity(
+        reserveCacheCapacity(
                                       date - d_packedCalendar.firstDate() + 1);
         reserveHolidayCapacity(numHolidays() + 1);
         d_packedCalendar.addHoliday(date);
@@ -194,20 +280,21 @@ void Calendar::addHoliday(const Date& date)
         reserveHolidayCapacity(numHolidays() + 1);
         d_packedCalendar.addHoliday(date);
         d_nonBusinessDays.assign1(date - d_packedCalendar.firstDate());
+        synchronizeBusinessDayCounts(date - d_packedCalendar.firstDate());
     }
 }
 
 void Calendar::addHolidayCode(const Date& date, int holidayCode)
 {
     if (0 == length()) {
-        d_nonBusinessDays.reserveCapacity(1);
+        reserveCacheCapacity(1);
         reserveHolidayCapacity(1);
         reserveHolidayCodeCapacity(1);
         d_packedCalendar.addHolidayCode(date, holidayCode);
         synchronizeCache();
     }
     else if (date < d_packedCalendar.firstDate()) {
-        d_nonBusinessDays.reserveCapacity(
+        reserveCacheCapacity(
                                        d_packedCalendar.lastDate() - date + 1);
         reserveHolidayCapacity(numHolidays() + 1);
         reserveHolidayCodeCapacity(numHolidayCodesTotal() + 1);
@@ -215,7 +302,7 @@ void Calendar::addHolidayCode(const Date& date, int holidayCode)
         synchronizeCache();
     }
     else if (date > d_packedCalendar.lastDate()) {
-        d_nonBusinessDays.reserveCapacity(
+        reserveCacheCapacity(
                                       date - d_packedCalendar.firstDate() + 1);
         reserveHolidayCapacity(numHolidays() + 1);
         reserveHolidayCodeCapacity(numHolidayCodesTotal() + 1);
@@ -227,6 +314,7 @@ void Calendar::addHolidayCode(const Date& date, int holidayCode)
         reserveHolidayCodeCapacity(numHolidayCodesTotal() + 1);
         d_packedCalendar.addHolidayCode(date, holidayCode);
         d_nonBusinessDays.assign1(date - d_packedCalendar.firstDate());
+        synchronizeBusinessDayCounts(date - d_packedCalendar.firstDate());
     }
 }
 
@@ -244,6 +332,7 @@ void Calendar::addWeekendDay(DayOfWeek::Enum weekendDay)
             d_nonBusinessDays.assign1(weekendDayIndex);
             weekendDayIndex += 7;
         }
+        synchronizeBusinessDayCounts(0);
     }
 }
 
@@ -277,7 +366,7 @@ void Calendar::unionBusinessDays(const PackedCalendar& other)
         newLength = length() + other.length();
     }
 
-    d_nonBusinessDays.reserveCapacity(newLength);
+    reserveCacheCapacity(newLength);
     d_packedCalendar.unionBusinessDays(other);
     synchronizeCache();
 }
@@ -298,7 +387,7 @@ void Calendar::unionNonBusinessDays(const PackedCalendar& other)
         newLength = length() + other.length();
     }
 
-    d_nonBusinessDays.reserveCapacity(newLength);
+    reserveCacheCapacity(newLength);
     d_packedCalendar.unionNonBusinessDays(other);
     synchronizeCache();
 }
@@ -315,16 +404,42 @@ int Calendar::getNextBusinessDay(Date        *nextBusinessDay,
 
     enum { e_SUCCESS = 0, e_FAILURE = 1 };
 
-    int offset = date - firstDate();
-    while (nth) {
-        offset = static_cast<int>(
-                                d_nonBusinessDays.find0AtMinIndex(offset + 1));
-        if (0 > offset) {
-            return e_FAILURE;                                         // RETURN
-        }
-        --nth;
+    enum { k_BITS_PER_BLOCK = bdlc::BitArray::k_BITS_PER_UINT64 };
+
+    // The result is the business day preceded by 'rank' business days in the
+    // valid range.  Find the last block preceded by at most 'rank' business
+    // days, then the business day within that block.
+
+    const int preceding = numBusinessDaysBefore(date + 1 - firstDate());
+
+    if (nth > numBusinessDays() - preceding) {
+        return e_FAILURE;                                             // RETURN
     }
-    *nextBusinessDay = firstDate() + offset;
+
+    int rank = preceding + nth - 1;
+
+    const int block = static_cast<int>(
+                          bsl::upper_bound(d_businessDayCounts.begin(),
+                                           d_businessDayCounts.end(),
+                                           rank)
+                          - d_businessDayCounts.begin()) - 1;
+    const int begin = block * k_BITS_PER_BLOCK;
+
+    rank -= d_businessDayCounts[block];
+
+    const int numBits = length() - begin < k_BITS_PER_BLOCK
+                      ? length() - begin
+                      : k_BITS_PER_BLOCK;
+
+    bsl::uint64_t businessDays = ~d_nonBusinessDays.bits(begin, numBits);
+    while (rank) {
+        businessDays &= businessDays - 1;  // clear the lowest set bit
+        --rank;
+    }
+
+    *nextBusinessDay = firstDate()
+                     + begin
+                     + bdlb::BitUtil::numTrailingUnsetBits(businessDays);
 
     return e_SUCCESS;
 }
@@ -173,18 +173,21 @@ BSLS_IDENT("$Id: $")
 ///Performance and Exception-Safety Guarantees
 ///-------------------------------------------
 // 'bdlt::Calendar' supports 'O[1]' (i.e., constant-time) determination of
-// whether a given 'bdlt::Date' value is or is not a business day, which is
-// accomplished by augmenting the implementation of a packed calendar with a
-// supplementary cache.  The invariant that this cache and the data represented
-// in the underlying 'bdlt::PackedCalendar' be maintained in a consistent
-// state may add significantly to the cost of performing many manipulator
-// operations, especially those that affect the calendar's valid range and add
-// a new weekend-days transition.  Moreover, the cost of many of these
-// operations will now be proportional to the length(s) of the valid range(s),
-// as well as their respective numbers of holidays and associated holiday codes
-// and weekend-days transitions.  Hence, when populating a calendar, it is
-// recommended that the desired value be captured first as a
-// 'bdlt::PackedCalendar', which can then be used efficiently to
+// whether a given 'bdlt::Date' value is or is not a business day, and of the
+// number of business days in a given range of dates, which is accomplished by
+// augmenting the implementation of a packed calendar with a supplementary
+// cache.  The cache also supports 'O[log(n)]' determination of the 'nth'
+// business day following a given date (see 'getNextBusinessDay'), where 'n' is
+// the length of the valid range of the calendar.  The invariant that this
+// cache and the data represented in the underlying 'bdlt::PackedCalendar' be
+// maintained in a consistent state may add significantly to the cost of
+// performing many manipulator operations, especially those that affect the
+// calendar's valid range and add a new weekend-days transition.  Moreover, the
+// cost of many of these operations will now be proportional to the length(s)
+// of the valid range(s), as well as their respective numbers of holidays and
+// associated holiday codes and weekend-days transitions.  Hence, when
+// populating a calendar, it is recommended that the desired value be captured
+// first as a 'bdlt::PackedCalendar', which can then be used efficiently to
 // *value-construct* the desired 'bdlt::Calendar' object.  See the
 // component-level doc for 'bdlt_packedcalendar' for its performance
 // guarantees.
@@ -465,6 +468,8 @@ BSLS_IDENT("$Id: $")
 #include <bdlt_dayofweekset.h>
 #include <bdlt_packedcalendar.h>
 
+#include <bdlb_bitutil.h>
+
 #include <bdlc_bitarray.h>
 
 #include <bslalg_swaputil.h>
@@ -481,6 +486,7 @@ BSLS_IDENT("$Id: $")
 
 #include <bsl_iosfwd.h>
 #include <bsl_iterator.h>
+#include <bsl_vector.h>
 
 namespace BloombergLP {
 namespace bdlt {
@@ -519,6 +525,14 @@ class Calendar {
                                // of the valid range is defined by
                                // 'd_packedCalendar.firstDate() + length() - 1'
 
+    bsl::vector<int>  d_businessDayCounts;
+                               // cache of the number of business days
+                               // preceding each block of 64 days of the valid
+                               // range (i.e., each word of
+                               // 'd_nonBusinessDays'), followed by the number
+                               // of business days in the valid range (empty
+                               // if the valid range is empty)
+
     // FRIENDS
     friend bool operator==(const Calendar&, const Calendar&);
     friend bool operator!=(const Calendar&, const Calendar&);
@@ -527,6 +541,23 @@ class Calendar {
 
   private:
     // PRIVATE MANIPULATORS
+    void reserveCacheCapacity(int numDays);
+        // Reserve sufficient memory for this calendar's cache to represent a
+        // valid range of at least the specified 'numDays' without further
+        // allocation.
+
+    void synchronizeBusinessDayCounts(int offset);
+        // Synchronize the business-day counts of this calendar's cache with
+        // its non-business days, given that the non-business days preceding
+        // the specified 'offset' (in days from 'firstDate') have not changed
+        // since the counts were last synchronized.  Only the counts of the
+        // blocks from the one holding 'offset' on are recomputed, unless the
+        // length of this calendar has changed.  The behavior is undefined
+        // unless '0 <= offset'.  Note that this method does not allocate
+        // memory if the length of this calendar has not changed since the
+        // counts were last synchronized, or sufficient capacity was reserved
+        // by 'reserveCacheCapacity'.
+
     void synchronizeCache();
         // Synchronize this calendar's cache by first clearing the cache, then
         // repopulating it with the holiday and weekend information from this
@@ -540,6 +571,11 @@ class Calendar {
         // holiday and weekend information stored in this calendar's
         // 'd_packedCalendar', and 'false' otherwise.
 
+    int numBusinessDaysBefore(int offset) const;
+        // Return the number of business days among the specified 'offset'
+        // first days of the valid range of this calendar.  The behavior is
+        // undefined unless '0 <= offset <= length()'.
+
   public:
     // TYPES
     typedef Calendar_BusinessDayConstIter            BusinessDayConstIterator;
@@ -935,7 +971,8 @@ class Calendar {
         // day exists, and a non-zero value (with no effect on
         // 'nextBusinessDay') otherwise.  The behavior is undefined unless
         // 'date + 1' is both a valid 'bdlt::Date' and within the valid range
-        // of this calendar, and '0 < nth'.
+        // of this calendar, and '0 < nth'.  Note that this method takes
+        // 'O[log(length())]' time, independent of 'nth'.
 
     Date holiday(int index) const;
         // Return the holiday at the specified 'index' in this calendar.  For
@@ -1026,7 +1063,8 @@ class Calendar {
         // '[beginDate .. endDate]' of this calendar that are considered
         // business days -- i.e., are neither holidays nor weekend days.  The
         // behavior is undefined unless 'beginDate' and 'endDate' are within
-        // the valid range of this calendar, and 'beginDate <= endDate'.
+        // the valid range of this calendar, and 'beginDate <= endDate'.  Note
+        // that this method takes constant time.
 
     int numHolidayCodes(const Date& date) const;
         // Return the number of (unique) holiday codes associated with the
@@ -1405,6 +1443,27 @@ int Calendar::maxSupportedBdexVersion(int versionSelector)
     return PackedCalendar::maxSupportedBdexVersion(versionSelector);
 }
 
+// PRIVATE ACCESSORS
+inline
+int Calendar::numBusinessDaysBefore(int offset) const
+{
+    BSLS_ASSERT_SAFE(0 <= offset);
+    BSLS_ASSERT_SAFE(offset <= length());
+
+    enum { k_BITS_PER_BLOCK = bdlc::BitArray::k_BITS_PER_UINT64 };
+
+    const int block = offset / k_BITS_PER_BLOCK;
+    const int begin = block * k_BITS_PER_BLOCK;
+
+    int result = d_businessDayCounts[block];
+    if (offset > begin) {
+        result += offset - begin - bdlb::BitUtil::numBitsSet(
+                                   d_nonBusinessDays.bits(begin,
+                                                          offset - begin));
+    }
+    return result;
+}
+
 // MANIPULATORS
 inline
 Calendar& Calendar::operator=(const Calendar& rhs)
@@ -1479,6 +1538,7 @@ void Calendar::removeAll()
 {
     d_packedCalendar.removeAll();
     d_nonBusinessDays.removeAll();
+    d_businessDayCounts.clear();
 }
 
 inline
@@ -1488,6 +1548,7 @@ void Calendar::removeHoliday(const Date& date)
 
     if (true == isInRange(date) && false == isWeekendDay(date)) {
         d_nonBusinessDays.assign0(date - firstDate());
+        synchronizeBusinessDayCounts(date - firstDate());
     }
 }
 
@@ -1518,7 +1579,7 @@ void Calendar::setValidRange(const Date& firstDate, const Date& lastDate)
         // For backwards compatibility, 'firstDate > lastDate' results in an
         // empty calendar (when asserts are not enabled).
 
-        d_nonBusinessDays.reserveCapacity(lastDate - firstDate + 1);
+        reserveCacheCapacity(lastDate - firstDate + 1);
     }
 
     d_packedCalendar.setValidRange(firstDate, lastDate);
@@ -1549,7 +1610,7 @@ STREAM& Calendar::bdexStreamIn(STREAM& stream, int version)
         if (!stream) {
             return stream;                                            // RETURN
         }
-        d_nonBusinessDays.reserveCapacity(inCal.length());
+        reserveCacheCapacity(inCal.length());
         d_packedCalendar.swap(inCal);
         synchronizeCache();
     }
@@ -1566,6 +1627,8 @@ void Calendar::swap(Calendar& other)
 
     bslalg::SwapUtil::swap(&d_packedCalendar,  &other.d_packedCalendar);
     bslalg::SwapUtil::swap(&d_nonBusinessDays, &other.d_nonBusinessDays);
+    bslalg::SwapUtil::swap(&d_businessDayCounts,
+                           &other.d_businessDayCounts);
 }
 
 // ACCESSORS
@@ -1778,7 +1841,7 @@ int Calendar::length() const
 inline
 int Calendar::numBusinessDays() const
 {
-    return static_cast<int>(d_nonBusinessDays.num0());
+    return d_businessDayCounts.empty() ? 0 : d_businessDayCounts.back();
 }
 
 inline
@@ -1788,8 +1851,8 @@ int Calendar::numBusinessDays(const Date& beginDate, const Date& endDate) const
     BSLS_ASSERT_SAFE(isInRange(endDate));
     BSLS_ASSERT_SAFE(beginDate <= endDate);
 
-    return static_cast<int>(d_nonBusinessDays.num0(beginDate - firstDate(),
-                                                   endDate - firstDate() + 1));
+    return numBusinessDaysBefore(endDate - firstDate() + 1)
+         - numBusinessDaysBefore(beginDate - firstDate());
 }
 
 inline
@@ -1813,7 +1876,7 @@ int Calendar::numHolidays() const
 inline
 int Calendar::numNonBusinessDays() const
 {
-    return static_cast<int>(d_nonBusinessDays.num1());
+    return length() - numBusinessDays();
 }
 
 inline
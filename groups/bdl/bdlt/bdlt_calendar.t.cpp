@@ -1290,6 +1290,10 @@ int main(int argc, char *argv[])
         //: 2 The non-basic accessor method is declared 'const'.
         //:
         //: 3 QoI: Asserted precondition violations are detected when enabled.
+        //:
+        //: 4 The accessor returns the expected value for calendars spanning
+        //:   many blocks of 64 days (see the implementation), including after
+        //:   manipulators that update the cache incrementally.
         //
         // Plan:
         //: 1 Directly test that the non-basic accessor, invoked on a set of
@@ -1297,6 +1301,13 @@ int main(int argc, char *argv[])
         //:   expected value using the table-driven technique.  (C-1..2)
         //:
         //: 2 Verify defensive checks are triggered for invalid values.  (C-3)
+        //:
+        //: 3 For a calendar of several years, with weekend-days transitions
+        //:   and pseudo-random holidays, compare the value returned for many
+        //:   ranges, and after each of a sequence of manipulators, with the
+        //:   number of business days counted with 'isBusinessDay'.  Also
+        //:   compare the dates loaded by 'getNextBusinessDay' for many values
+        //:   of 'nth'.  (C-4)
         //
         // Testing:
         //   int numBusinessDays(beginDate, endDate) const;
@@ -1354,6 +1365,86 @@ int main(int argc, char *argv[])
             LOOP2_ASSERT(LINE, X, EXP == rv);
         }
 
+        if (verbose) cout << "\nTesting calendars of many blocks." << endl;
+        {
+            Obj mX(bdlt::Date(2000, 1, 1), bdlt::Date(2003, 12, 31));
+            const Obj& X = mX;
+
+            bdlt::DayOfWeekSet weekend;
+            weekend.add(bdlt::DayOfWeek::e_SAT);
+            weekend.add(bdlt::DayOfWeek::e_SUN);
+            mX.addWeekendDaysTransition(bdlt::Date(1, 1, 1), weekend);
+
+            weekend.removeAll();
+            weekend.add(bdlt::DayOfWeek::e_FRI);
+            mX.addWeekendDaysTransition(bdlt::Date(2002, 3, 7), weekend);
+
+            unsigned int seed = 12345;
+            for (int i = 0; i < 150; ++i) {
+                seed = seed * 1103515245 + 12345;
+                mX.addHoliday(X.firstDate() + (seed >> 8) % X.length());
+            }
+
+            for (int step = 0; step < 6; ++step) {
+                switch (step) {
+                  case 1: {
+                    mX.removeHoliday(*X.beginHolidays());
+                    mX.removeHoliday(*(--X.endHolidays()));
+                  } break;
+                  case 2: {
+                    mX.addHoliday(bdlt::Date(2001, 6, 12));
+                    mX.addHolidayCode(bdlt::Date(2003, 2, 4), 7);
+                  } break;
+                  case 3: {
+                    mX.addHoliday(bdlt::Date(2004, 1, 9));
+                  } break;
+                  case 4: {
+                    mX.addHoliday(bdlt::Date(1999, 12, 20));
+                  } break;
+                  case 5: {
+                    mX.setValidRange(bdlt::Date(2000, 2, 1),
+                                     bdlt::Date(2003, 11, 30));
+                  } break;
+                }
+
+                bsl::vector<int> counts;  // business days before each date
+                counts.push_back(0);
+                for (int d = 0; d < X.length(); ++d) {
+                    counts.push_back(counts.back()
+                                    + X.isBusinessDay(X.firstDate() + d));
+                }
+                ASSERTV(step, counts.back() == X.numBusinessDays());
+                ASSERTV(step, X.length() - counts.back()
+                                                  == X.numNonBusinessDays());
+
+                for (int b = 0; b < X.length(); b += 13) {
+                    for (int e = b; e < X.length(); e += 7) {
+                        const int EXP = counts[e + 1] - counts[b];
+                        const int rv  = X.numBusinessDays(X.firstDate() + b,
+                                                          X.firstDate() + e);
+                        ASSERTV(step, b, e, EXP, rv, EXP == rv);
+                    }
+                }
+
+                for (int b = 0; b + 1 < X.length(); b += 11) {
+                    const bdlt::Date DATE = X.firstDate() + b;
+                    for (int nth = 1; nth < 1200; nth += 37) {
+                        bdlt::Date rv;
+                        const int  rc = X.getNextBusinessDay(&rv, DATE, nth);
+                        if (counts.back() - counts[b + 1] < nth) {
+                            ASSERTV(step, b, nth, 0 != rc);
+                            continue;
+                        }
+                        ASSERTV(step, b, nth, 0 == rc);
+                        ASSERTV(step, b, nth, X.isBusinessDay(rv));
+                        ASSERTV(step, b, nth, rv > DATE);
+                        ASSERTV(step, b, nth,
+                                nth == X.numBusinessDays(DATE + 1, rv));
+                    }
+                }
+            }
+        }
+
         if (verbose) cout << "\nNegative Testing." << endl;
         {
             bsls::AssertTestHandlerGuard hG;
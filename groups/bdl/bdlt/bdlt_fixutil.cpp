@@ -12,6 +12,9 @@ BSLS_IDENT_RCSID(bdlt_fixutil_cpp,"$Id$ $CSID$")
 #include <bdlt_time.h>
 #include <bdlt_timetz.h>
 
+#include <bsls_platform.h>
+#include <bsls_types.h>
+
 #include <bsl_algorithm.h>
 #include <bsl_cctype.h>
 #include <bsl_cstring.h>
@@ -60,6 +63,52 @@ int asciiToInt(const char **nextPos,
     return 0;
 }
 
+#if defined(BSLS_PLATFORM_IS_LITTLE_ENDIAN)
+static inline
+bsls::Types::Uint64 loadWord(const char *begin)
+    // Return a word holding the 8 characters starting at the specified
+    // 'begin', the first character in the least-significant byte.
+{
+    bsls::Types::Uint64 word;
+    bsl::memcpy(&word, begin, sizeof word);
+    return word;
+}
+
+static inline
+bool isDigitWord(bsls::Types::Uint64 word, bsls::Types::Uint64 digitMask)
+    // Return 'true' if each byte of the specified 'word' that is selected by
+    // the specified 'digitMask' is an ASCII decimal digit, and 'false'
+    // otherwise.  The behavior is undefined unless each byte of 'digitMask'
+    // is either 0 or 0xFF.
+{
+    const bsls::Types::Uint64 ones   = 0x0101010101010101ULL & digitMask;
+    const bsls::Types::Uint64 digits = word & digitMask;
+
+    // A byte is not a digit if its high bit is set, if subtracting '0' from
+    // it borrows, or if adding '0x7F - '9'' to it carries into its high bit.
+
+    return 0 == ((digits | (digits - ones * '0') | (digits + ones * 0x46))
+                                                               & ones * 0x80);
+}
+
+static inline
+bsls::Types::Uint64 digitPairs(bsls::Types::Uint64 word,
+                               bsls::Types::Uint64 digitMask)
+    // Return a word in which each byte selected by the specified 'digitMask'
+    // and followed by a selected byte in the specified 'word' holds the value
+    // of the two decimal digits held by those bytes, the digit in the first
+    // byte being the most significant.  The value of the other bytes of the
+    // returned word is unspecified.  The behavior is undefined unless each
+    // byte of 'digitMask' is either 0 or 0xFF, and
+    // 'isDigitWord(word, digitMask)'.
+{
+    const bsls::Types::Uint64 values =
+                    (word & digitMask) - (0x3030303030303030ULL & digitMask);
+
+    return values * 10 + (values >> 8);
+}
+#endif
+
 static
 int parseDate(const char **nextPos,
               Date        *date,
@@ -88,6 +137,26 @@ int parseDate(const char **nextPos,
         return -1;                                                    // RETURN
     }
 
+#if defined(BSLS_PLATFORM_IS_LITTLE_ENDIAN)
+    // Validate and convert "YYYYMMDD" as a single word.
+
+    const bsls::Types::Uint64 k_DIGITS = 0xFFFFFFFFFFFFFFFFULL;
+
+    const bsls::Types::Uint64 word = loadWord(p);
+
+    if (!isDigitWord(word, k_DIGITS)) {
+        return -1;                                                    // RETURN
+    }
+
+    const bsls::Types::Uint64 pairs = digitPairs(word, k_DIGITS);
+
+    const int year  = static_cast<int>(pairs & 0xFF) * 100
+                    + static_cast<int>((pairs >> 16) & 0xFF);
+    const int month = static_cast<int>((pairs >> 32) & 0xFF);
+    const int day   = static_cast<int>((pairs >> 48) & 0xFF);
+
+    p += k_MINIMUM_LENGTH;
+#else
     int year;
     if (0 != asciiToInt(&p, &year, p, p + 4)) {
         return -1;                                                    // RETURN
@@ -102,6 +171,7 @@ int parseDate(const char **nextPos,
     if (0 != asciiToInt(&p, &day, p, p + 2)) {
         return -1;                                                    // RETURN
     }
+#endif
 
     if (0 != date->setYearMonthDayIfValid(year, month, day)) {
         return -1;                                                    // RETURN
@@ -290,34 +360,66 @@ int parseTime(const char **nextPos,
         return -1;                                                    // RETURN
     }
 
-    int hour;
-    if (0 != asciiToInt(&p, &hour, p, p + 2) || ':' != *p) {
-        return -1;                                                    // RETURN
+    int  hour;
+    int  minute;
+    int  second     = 0;
+    bool hasSeconds = false;
+
+#if defined(BSLS_PLATFORM_IS_LITTLE_ENDIAN)
+    // Validate and convert the common "hh:mm:ss" prefix as a single word,
+    // falling back to the character-by-character parse below otherwise.
+
+    const bsls::Types::Uint64 k_DIGITS     = 0xFFFF00FFFF00FFFFULL;
+    const bsls::Types::Uint64 k_SEPARATORS = 0x0000FF0000FF0000ULL;
+    const bsls::Types::Uint64 k_COLONS     = 0x00003A00003A0000ULL;
+
+    const bsls::Types::Uint64 word = end - p >= static_cast<int>(sizeof word)
+                                     ? loadWord(p)
+                                     : 0;
+
+    if (k_COLONS == (word & k_SEPARATORS) && isDigitWord(word, k_DIGITS)) {
+        const bsls::Types::Uint64 pairs = digitPairs(word, k_DIGITS);
+
+        hour       = static_cast<int>(pairs & 0xFF);
+        minute     = static_cast<int>((pairs >> 24) & 0xFF);
+        second     = static_cast<int>((pairs >> 48) & 0xFF);
+        hasSeconds = true;
+
+        p += sizeof word;
     }
-    // "24:00" is not a valid FIX time string according to the protocol.
-    if (24 <= hour) {
-        return -1;                                                    // RETURN
+    else
+#endif
+    {
+        if (0 != asciiToInt(&p, &hour, p, p + 2) || ':' != *p) {
+            return -1;                                                // RETURN
+        }
+        ++p;  // skip ':'
+
+        if (0 != asciiToInt(&p, &minute, p, p + 2)) {
+            return -1;                                                // RETURN
+        }
+
+        if (p < end && ':' == *p) {
+            // We have seconds.
+
+            ++p;  // skip ':'
+
+            if (0 != asciiToInt(&p, &second, p, p + 2)) {
+                return -1;                                            // RETURN
+            }
+            hasSeconds = true;
+        }
     }
-    ++p;  // skip ':'
 
-    int minute;
-    if (0 != asciiToInt(&p, &minute, p, p + 2)) {
+    // "24:00" is not a valid FIX time string according to the protocol.
+    if (24 <= hour) {
         return -1;                                                    // RETURN
     }
 
-    int second = 0;
     int millisecond = 0;
     int microsecond = 0;
     bool hasLeapSecond = false;
-    if (p < end && ':' == *p) {
-        // We have seconds.
-
-        ++p;  // skip ':'
-
-        if (0 != asciiToInt(&p, &second, p, p + 2)) {
-            return -1;                                                // RETURN
-        }
-
+    if (hasSeconds) {
         if (p < end && '.' == *p) {
             // We have a fraction of a second.
 
@@ -373,7 +475,21 @@ int parseTime(const char **nextPos,
     return 0;
 }
 
-static
+static const char k_DIGIT_PAIRS[] =
+    // The two-digit decimal representations of the values 0 to 99.
+
+    "00010203040506070809"
+    "10111213141516171819"
+    "20212223242526272829"
+    "30313233343536373839"
+    "40414243444546474849"
+    "50515253545556575859"
+    "60616263646566676869"
+    "70717273747576777879"
+    "80818283848586878889"
+    "90919293949596979899";
+
+static inline
 int generateInt(char *buffer, int value, int paddedLen)
     // Write, to the specified 'buffer', the decimal string representation of
     // the specified 'value' padded with leading zeros to the specified
@@ -390,9 +506,16 @@ int generateInt(char *buffer, int value, int paddedLen)
 
     char *p = buffer + paddedLen;
 
-    while (p > buffer) {
+    // Generate two digits at a time.
+
+    while (p - buffer >= 2) {
+        p -= 2;
+        bsl::memcpy(p, k_DIGIT_PAIRS + 2 * (value % 100), 2);
+        value /= 100;
+    }
+
+    if (p > buffer) {
         *--p = static_cast<char>('0' + value % 10);
-        value /= 10;
     }
 
     return paddedLen;
@@ -898,11 +1021,14 @@ int FixUtil::generateRaw(char                        *buffer,
 {
     BSLS_ASSERT(buffer);
 
+    int year, month, day;
+    object.getYearMonthDay(&year, &month, &day);
+
     char *p = buffer;
 
-    p += generateInt(p, object.year() , 4);
-    p += generateInt(p, object.month(), 2);
-    p += generateInt(p, object.day()  , 2);
+    p += generateInt(p, year , 4);
+    p += generateInt(p, month, 2);
+    p += generateInt(p, day  , 2);
 
     return static_cast<int>(p - buffer);
 }
@@ -949,15 +1075,18 @@ int FixUtil::generateRaw(char                        *buffer,
 
     char *p = buffer + dateLen + 1;
 
-    p += generateInt(p, 24 > object.hour() ? object.hour() : 0, 2, ':');
-    p += generateInt(p, object.minute(), 2, ':');
+    int hour, minute, second, millisecond, microsecond;
+    object.getTime(&hour, &minute, &second, &millisecond, &microsecond);
+
+    p += generateInt(p, 24 > hour ? hour : 0, 2, ':');
+    p += generateInt(p, minute, 2, ':');
 
     int precision = configuration.fractionalSecondPrecision();
 
     if (precision) {
-        p += generateInt(p, object.second(), 2, '.');
+        p += generateInt(p, second, 2, '.');
 
-        int value = object.millisecond() * 1000 + object.microsecond();
+        int value = millisecond * 1000 + microsecond;
 
         for (int i = 6; i > precision; --i) {
             value /= 10;
@@ -966,7 +1095,7 @@ int FixUtil::generateRaw(char                        *buffer,
         p += generateInt(p, value, precision);
     }
     else {
-        p += generateInt(p, object.second(), 2);
+        p += generateInt(p, second, 2);
     }
 
     return static_cast<int>(p - buffer);
@@ -12,6 +12,9 @@ BSLS_IDENT_RCSID(bdlt_iso8601util_cpp,"$Id$ $CSID$")
 #include <bdlt_time.h>
 #include <bdlt_timetz.h>
 
+#include <bsls_platform.h>
+#include <bsls_types.h>
+
 #include <bsl_algorithm.h>
 #include <bsl_cctype.h>
 #include <bsl_cstring.h>
@@ -95,6 +98,60 @@ int asciiToInt(const char **nextPos,
     return 0;
 }
 
+static inline
+bool isDigit(char character)
+    // Return 'true' if the specified 'character' is an ASCII decimal digit,
+    // and 'false' otherwise.
+{
+    return static_cast<unsigned int>(character - '0') <= 9;
+}
+
+#if defined(BSLS_PLATFORM_IS_LITTLE_ENDIAN)
+static inline
+bsls::Types::Uint64 loadWord(const char *begin)
+    // Return a word holding the 8 characters starting at the specified
+    // 'begin', the first character in the least-significant byte.
+{
+    bsls::Types::Uint64 word;
+    bsl::memcpy(&word, begin, sizeof word);
+    return word;
+}
+
+static inline
+bool isDigitWord(bsls::Types::Uint64 word, bsls::Types::Uint64 digitMask)
+    // Return 'true' if each byte of the specified 'word' that is selected by
+    // the specified 'digitMask' is an ASCII decimal digit, and 'false'
+    // otherwise.  The behavior is undefined unless each byte of 'digitMask'
+    // is either 0 or 0xFF.
+{
+    const bsls::Types::Uint64 ones   = 0x0101010101010101ULL & digitMask;
+    const bsls::Types::Uint64 digits = word & digitMask;
+
+    // A byte is not a digit if its high bit is set, if subtracting '0' from
+    // it borrows, or if adding '0x7F - '9'' to it carries into its high bit.
+
+    return 0 == ((digits | (digits - ones * '0') | (digits + ones * 0x46))
+                                                               & ones * 0x80);
+}
+
+static inline
+bsls::Types::Uint64 digitPairs(bsls::Types::Uint64 word,
+                               bsls::Types::Uint64 digitMask)
+    // Return a word in which each byte selected by the specified 'digitMask'
+    // and followed by a selected byte in the specified 'word' holds the value
+    // of the two decimal digits held by those bytes, the digit in the first
+    // byte being the most significant.  The value of the other bytes of the
+    // returned word is unspecified.  The behavior is undefined unless each
+    // byte of 'digitMask' is either 0 or 0xFF, and
+    // 'isDigitWord(word, digitMask)'.
+{
+    const bsls::Types::Uint64 values =
+                    (word & digitMask) - (0x3030303030303030ULL & digitMask);
+
+    return values * 10 + (values >> 8);
+}
+#endif
+
 static
 int parseDate(const char **nextPos,
               int         *year,
@@ -127,6 +184,32 @@ int parseDate(const char **nextPos,
         return -1;                                                    // RETURN
     }
 
+#if defined(BSLS_PLATFORM_IS_LITTLE_ENDIAN)
+    // Validate and convert "YYYY-MM-" as a single word.
+
+    const bsls::Types::Uint64 k_DIGITS     = 0x00FFFF00FFFFFFFFULL;
+    const bsls::Types::Uint64 k_SEPARATORS = 0xFF0000FF00000000ULL;
+    const bsls::Types::Uint64 k_DASHES     = 0x2D00002D00000000ULL;
+
+    const bsls::Types::Uint64 word = loadWord(p);
+
+    if (k_DASHES != (word & k_SEPARATORS)
+     || !isDigitWord(word, k_DIGITS)
+     || !isDigit(p[8])
+     || !isDigit(p[9])) {
+        return -1;                                                    // RETURN
+    }
+
+    const bsls::Types::Uint64 pairs = digitPairs(word, k_DIGITS);
+
+    *year    = static_cast<int>(pairs & 0xFF) * 100
+             + static_cast<int>((pairs >> 16) & 0xFF);
+    *month   = static_cast<int>((pairs >> 40) & 0xFF);
+    *day     = (p[8] - '0') * 10 + (p[9] - '0');
+    *nextPos = p + k_MINIMUM_LENGTH;
+
+    return 0;
+#else
     // 1. Parse year.
 
     if (0 != asciiToInt(&p, year, p, p + 4) || '-' != *p) {
@@ -150,6 +233,7 @@ int parseDate(const char **nextPos,
     *nextPos = p;
 
     return 0;
+#endif
 }
 
 static
@@ -264,6 +348,27 @@ int parseTime(const char         **nextPos,
         return -1;                                                    // RETURN
     }
 
+#if defined(BSLS_PLATFORM_IS_LITTLE_ENDIAN)
+    // 1-3. Validate and convert "hh:mm:ss" as a single word.
+
+    const bsls::Types::Uint64 k_DIGITS     = 0xFFFF00FFFF00FFFFULL;
+    const bsls::Types::Uint64 k_SEPARATORS = 0x0000FF0000FF0000ULL;
+    const bsls::Types::Uint64 k_COLONS     = 0x00003A00003A0000ULL;
+
+    const bsls::Types::Uint64 word = loadWord(p);
+
+    if (k_COLONS != (word & k_SEPARATORS) || !isDigitWord(word, k_DIGITS)) {
+        return -1;                                                    // RETURN
+    }
+
+    const bsls::Types::Uint64 pairs = digitPairs(word, k_DIGITS);
+
+    *hour   = static_cast<int>(pairs & 0xFF);
+    *minute = static_cast<int>((pairs >> 24) & 0xFF);
+    *second = static_cast<int>((pairs >> 48) & 0xFF);
+
+    p += k_MINIMUM_LENGTH;
+#else
     // 1. Parse hour.
 
     if (0 != asciiToInt(&p, hour, p, p + 2) || ':' != *p) {
@@ -283,6 +388,7 @@ int parseTime(const char         **nextPos,
     if (0 != asciiToInt(&p, second, p, p + 2)) {
         return -1;                                                    // RETURN
     }
+#endif
 
     // 4. Parse (optional) fractional second, in microseconds.
 
@@ -444,7 +550,21 @@ int generateUnpaddedInt(char *buffer, bsls::Types::Int64 value, char separator)
     return separatorOffset;
 }
 
-static
+static const char k_DIGIT_PAIRS[] =
+    // The two-digit decimal representations of the values 0 to 99.
+
+    "00010203040506070809"
+    "10111213141516171819"
+    "20212223242526272829"
+    "30313233343536373839"
+    "40414243444546474849"
+    "50515253545556575859"
+    "60616263646566676869"
+    "70717273747576777879"
+    "80818283848586878889"
+    "90919293949596979899";
+
+static inline
 int generateInt(char *buffer, int value, int paddedLen)
     // Write, to the specified 'buffer', the decimal string representation of
     // the specified 'value' padded with leading zeros to the specified
@@ -461,9 +581,16 @@ int generateInt(char *buffer, int value, int paddedLen)
 
     char *p = buffer + paddedLen;
 
-    while (p > buffer) {
+    // Generate two digits at a time.
+
+    while (p - buffer >= 2) {
+        p -= 2;
+        bsl::memcpy(p, k_DIGIT_PAIRS + 2 * (value % 100), 2);
+        value /= 100;
+    }
+
+    if (p > buffer) {
         *--p = static_cast<char>('0' + value % 10);
-        value /= 10;
     }
 
     return paddedLen;
@@ -662,6 +789,92 @@ int generatedLengthForTimeTzObject(
 }
 #endif
 
+static inline
+int generateDate(char *buffer, const Date& date)
+    // Write, to the specified 'buffer', the ISO 8601 representation of the
+    // specified 'date', and return the number of bytes written.  'buffer' is
+    // NOT null-terminated.  The behavior is undefined unless 'buffer' has
+    // sufficient capacity.
+{
+    int year, month, day;
+    date.getYearMonthDay(&year, &month, &day);
+
+    char *p = buffer;
+
+    p += generateInt(p, year , 4, '-');
+    p += generateInt(p, month, 2, '-');
+    p += generateInt(p, day  , 2     );
+
+    return static_cast<int>(p - buffer);
+}
+
+static inline
+int generateTime(char *buffer,
+                 int   hour,
+                 int   minute,
+                 int   second,
+                 int   fractionalSecond,
+                 int   precision,
+                 char  decimalSign)
+    // Write, to the specified 'buffer', the ISO 8601 representation of the
+    // time having the specified 'hour', 'minute', 'second', and
+    // 'fractionalSecond' (in microseconds), with the fractional second
+    // truncated to the specified 'precision' and preceded by the specified
+    // 'decimalSign', and return the number of bytes written.  'buffer' is NOT
+    // null-terminated.  The behavior is undefined unless 'buffer' has
+    // sufficient capacity and '0 <= precision <= 6'.
+{
+    char *p = buffer;
+
+    p += generateInt(p, hour  , 2, ':');
+    p += generateInt(p, minute, 2, ':');
+
+    if (precision) {
+        p += generateInt(p, second, 2, decimalSign);
+
+        for (int i = 6; i > precision; --i) {
+            fractionalSecond /= 10;
+        }
+
+        p += generateInt(p, fractionalSecond, precision);
+    }
+    else {
+        p += generateInt(p, second, 2);
+    }
+
+    return static_cast<int>(p - buffer);
+}
+
+static inline
+int generateDatetime(char            *buffer,
+                     const Datetime&  datetime,
+                     int              precision,
+                     char             decimalSign)
+    // Write, to the specified 'buffer', the ISO 8601 representation of the
+    // specified 'datetime', with the fractional second truncated to the
+    // specified 'precision' and preceded by the specified 'decimalSign', and
+    // return the number of bytes written.  'buffer' is NOT null-terminated.
+    // The behavior is undefined unless 'buffer' has sufficient capacity and
+    // '0 <= precision <= 6'.
+{
+    int hour, minute, second, millisecond, microsecond;
+    datetime.getTime(&hour, &minute, &second, &millisecond, &microsecond);
+
+    char *p = buffer + generateDate(buffer, datetime.date());
+
+    *p++ = 'T';
+
+    p += generateTime(p,
+                      hour,
+                      minute,
+                      second,
+                      millisecond * 1000 + microsecond,
+                      precision,
+                      decimalSign);
+
+    return static_cast<int>(p - buffer);
+}
+
 static
 void copyBuf(char *dst, int dstLen, const char *src, int srcLen)
     // Copy, to the specified 'dst' buffer having the specified 'dstLen', the
@@ -1109,13 +1322,7 @@ int Iso8601Util::generateRaw(
 {
     BSLS_ASSERT(buffer);
 
-    char *p = buffer;
-
-    p += generateInt(p, object.year() , 4, '-');
-    p += generateInt(p, object.month(), 2, '-');
-    p += generateInt(p, object.day()  , 2     );
-
-    return static_cast<int>(p - buffer);
+    return generateDate(buffer, object);
 }
 
 int Iso8601Util::generateRaw(char                            *buffer,
@@ -1124,33 +1331,20 @@ int Iso8601Util::generateRaw(char                            *buffer,
 {
     BSLS_ASSERT(buffer);
 
-    char *p = buffer;
-
-    p += generateInt(p, object.hour()       , 2, ':');
-    p += generateInt(p, object.minute()     , 2, ':');
+    int hour, minute, second, millisecond, microsecond;
+    object.getTime(&hour, &minute, &second, &millisecond, &microsecond);
 
     const char decimalSign = configuration.useCommaForDecimalSign()
                              ? ','
                              : '.';
 
-    int precision = configuration.fractionalSecondPrecision();
-
-    if (precision) {
-        p += generateInt(p, object.second(), 2, decimalSign);
-
-        int value = object.millisecond() * 1000 + object.microsecond();
-
-        for (int i = 6; i > precision; --i) {
-            value /= 10;
-        }
-
-        p += generateInt(p, value, precision);
-    }
-    else {
-        p += generateInt(p, object.second(), 2);
-    }
-
-    return static_cast<int>(p - buffer);
+    return generateTime(buffer,
+                        hour,
+                        minute,
+                        second,
+                        millisecond * 1000 + microsecond,
+                        configuration.fractionalSecondPrecision(),
+                        decimalSign);
 }
 
 int Iso8601Util::generateRaw(char                            *buffer,
@@ -1159,36 +1353,14 @@ int Iso8601Util::generateRaw(char                            *buffer,
 {
     BSLS_ASSERT(buffer);
 
-    const int dateLen = generateRaw(buffer, object.date(), configuration);
-    *(buffer + dateLen) = 'T';
-
-    char *p = buffer + dateLen + 1;
-
-    p += generateInt(p, object.hour()       , 2, ':');
-    p += generateInt(p, object.minute()     , 2, ':');
-
     const char decimalSign = configuration.useCommaForDecimalSign()
                              ? ','
                              : '.';
 
-    int precision = configuration.fractionalSecondPrecision();
-
-    if (precision) {
-        p += generateInt(p, object.second(), 2, decimalSign);
-
-        int value = object.millisecond() * 1000 + object.microsecond();
-
-        for (int i = 6; i > precision; --i) {
-            value /= 10;
-        }
-
-        p += generateInt(p, value, precision);
-    }
-    else {
-        p += generateInt(p, object.second(), 2);
-    }
-
-    return static_cast<int>(p - buffer);
+    return generateDatetime(buffer,
+                            object,
+                            configuration.fractionalSecondPrecision(),
+                            decimalSign);
 }
 
 int Iso8601Util::generateRaw(char                            *buffer,
@@ -1242,6 +1414,102 @@ int Iso8601Util::generateRaw(char                            *buffer,
     return datetimeLen + zoneLen;
 }
 
+int Iso8601Util::generateRaw(
+                          char                            *buffer,
+                          int                             *lengths,
+                          const Date                      *objects,
+                          int                              numObjects,
+                          const Iso8601UtilConfiguration&  /* configuration */)
+{
+    BSLS_ASSERT(buffer  || 0 == numObjects);
+    BSLS_ASSERT(objects || 0 == numObjects);
+    BSLS_ASSERT(0 <= numObjects);
+
+    char *p = buffer;
+
+    for (int i = 0; i < numObjects; ++i) {
+        const int length = generateDate(p, objects[i]);
+
+        if (lengths) {
+            lengths[i] = length;
+        }
+        p += length;
+    }
+
+    return static_cast<int>(p - buffer);
+}
+
+int Iso8601Util::generateRaw(char                            *buffer,
+                             int                             *lengths,
+                             const Datetime                  *objects,
+                             int                              numObjects,
+                             const Iso8601UtilConfiguration&  configuration)
+{
+    BSLS_ASSERT(buffer  || 0 == numObjects);
+    BSLS_ASSERT(objects || 0 == numObjects);
+    BSLS_ASSERT(0 <= numObjects);
+
+    const int  precision   = configuration.fractionalSecondPrecision();
+    const char decimalSign = configuration.useCommaForDecimalSign()
+                             ? ','
+                             : '.';
+
+    char *p = buffer;
+
+    for (int i = 0; i < numObjects; ++i) {
+        const int length = generateDatetime(p,
+                                            objects[i],
+                                            precision,
+                                            decimalSign);
+
+        if (lengths) {
+            lengths[i] = length;
+        }
+        p += length;
+    }
+
+    return static_cast<int>(p - buffer);
+}
+
+int Iso8601Util::generateRaw(char                            *buffer,
+                             int                             *lengths,
+                             const DatetimeTz                *objects,
+                             int                              numObjects,
+                             const Iso8601UtilConfiguration&  configuration)
+{
+    BSLS_ASSERT(buffer  || 0 == numObjects);
+    BSLS_ASSERT(objects || 0 == numObjects);
+    BSLS_ASSERT(0 <= numObjects);
+
+    const int  precision   = configuration.fractionalSecondPrecision();
+    const char decimalSign = configuration.useCommaForDecimalSign()
+                             ? ','
+                             : '.';
+
+    char *p = buffer;
+
+    for (int i = 0; i < numObjects; ++i) {
+        const DatetimeTz& object = objects[i];
+
+        const int datetimeLen = generateDatetime(p,
+                                                 object.localDatetime(),
+                                                 precision,
+                                                 decimalSign);
+
+        const int length = datetimeLen
+                         + generateZoneDesignator(p + datetimeLen,
+                                                  object.offset(),
+                                                  configuration);
+
+        if (lengths) {
+            lengths[i] = length;
+        }
+        p += length;
+    }
+
+    return static_cast<int>(p - buffer);
+}
+
 static
 int parseIntervalImpl(bsls::Types::Int64 *weeks,
                       bsls::Types::Int64 *days,
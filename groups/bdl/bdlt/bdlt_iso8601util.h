@@ -114,6 +114,14 @@ BSLS_IDENT("$Id: $")
 // [*] Note that the ISO 8601 specification does not have an equivalent to
 // 'bdlt::DateTz'.
 //
+///Generating Sequences of Values
+///- - - - - - - - - - - - - - - -
+// 'generateRaw' is also provided for arrays of 'Date', 'Datetime', and
+// 'DatetimeTz' objects.  These overloads write the representations of the
+// objects consecutively to a single buffer, optionally loading the length of
+// each representation into a caller-supplied array, and consult the
+// configuration once rather than once per object.
+//
 ///Configuration
 ///- - - - - - -
 // The 'generate' and 'generateRaw' functions provide an optional configuration
@@ -839,6 +847,49 @@ struct Iso8601Util {
         // is large enough to hold any string generated by this component
         // (counting a null terminator, if any).
 
+    static int generateRaw(char                            *buffer,
+                           int                             *lengths,
+                           const Date                      *objects,
+                           int                              numObjects);
+    static int generateRaw(char                            *buffer,
+                           int                             *lengths,
+                           const Date                      *objects,
+                           int                              numObjects,
+                           const Iso8601UtilConfiguration&  configuration);
+    static int generateRaw(char                            *buffer,
+                           int                             *lengths,
+                           const Datetime                  *objects,
+                           int                              numObjects);
+    static int generateRaw(char                            *buffer,
+                           int                             *lengths,
+                           const Datetime                  *objects,
+                           int                              numObjects,
+                           const Iso8601UtilConfiguration&  configuration);
+    static int generateRaw(char                            *buffer,
+                           int                             *lengths,
+                           const DatetimeTz                *objects,
+                           int                              numObjects);
+    static int generateRaw(char                            *buffer,
+                           int                             *lengths,
+                           const DatetimeTz                *objects,
+                           int                              numObjects,
+                           const Iso8601UtilConfiguration&  configuration);
+        // Write, consecutively to the specified 'buffer', the ISO 8601
+        // representations of the specified 'numObjects' elements of the
+        // specified 'objects' array, and, if the specified 'lengths' is not
+        // 0, load the number of characters in the representation of each
+        // element into the corresponding element of 'lengths'.  Optionally
+        // specify a 'configuration' to affect the format of the generated
+        // strings.  If 'configuration' is not supplied, the process-wide
+        // default value 'Iso8601UtilConfiguration::defaultConfiguration()' is
+        // used.  Return the total number of characters written.  'buffer' is
+        // not null terminated.  The behavior is undefined unless
+        // '0 <= numObjects', 'buffer' has capacity for 'numObjects' times
+        // 'k_DATE_STRLEN', 'k_DATETIME_STRLEN', or 'k_DATETIMETZ_STRLEN'
+        // (respectively) characters, 'lengths' (if not 0) has at least
+        // 'numObjects' elements, and the total number of characters written
+        // does not exceed 'INT_MAX'.
+
     static int parse(bsls::TimeInterval *result,
                      const char         *string,
                      int                 length);
@@ -1580,6 +1631,45 @@ int Iso8601Util::generateRaw(char *buffer, const DatetimeTz& object)
                        Iso8601UtilConfiguration::defaultConfiguration());
 }
 
+inline
+int Iso8601Util::generateRaw(char       *buffer,
+                             int        *lengths,
+                             const Date *objects,
+                             int         numObjects)
+{
+    return generateRaw(buffer,
+                       lengths,
+                       objects,
+                       numObjects,
+                       Iso8601UtilConfiguration::defaultConfiguration());
+}
+
+inline
+int Iso8601Util::generateRaw(char           *buffer,
+                             int            *lengths,
+                             const Datetime *objects,
+                             int             numObjects)
+{
+    return generateRaw(buffer,
+                       lengths,
+                       objects,
+                       numObjects,
+                       Iso8601UtilConfiguration::defaultConfiguration());
+}
+
+inline
+int Iso8601Util::generateRaw(char             *buffer,
+                             int              *lengths,
+                             const DatetimeTz *objects,
+                             int               numObjects)
+{
+    return generateRaw(buffer,
+                       lengths,
+                       objects,
+                       numObjects,
+                       Iso8601UtilConfiguration::defaultConfiguration());
+}
+
 inline
 int Iso8601Util::parse(bsls::TimeInterval *result,
                        const bslstl::StringRef& string)
@@ -12,13 +12,16 @@
 
 #include <bsls_asserttest.h>
 #include <bsls_review.h>
+#include <bsls_stopwatch.h>
 
 #include <bsl_cctype.h>      // 'isdigit'
 #include <bsl_cstdlib.h>
 #include <bsl_cstring.h>
+#include <bsl_iomanip.h>
 #include <bsl_iostream.h>
 #include <bsl_sstream.h>
 #include <bsl_string.h>
+#include <bsl_vector.h>
 
 #undef SEC
 
@@ -132,9 +135,16 @@ using namespace bsl;
 // [ 5] int generateRaw(char *, const DateTz&, bool useZ);
 // [ 6] int generateRaw(char *, const TimeTz&, bool useZ);
 // [ 7] int generateRaw(char *, const DatetimeTz&, bool useZ);
+// [12] int generateRaw(char *, int *, const Date *, int);
+// [12] int generateRaw(char *, int *, const Date *, int, const Config&);
+// [12] int generateRaw(char *, int *, const Datetime *, int);
+// [12] int generateRaw(char *, int *, const Datetime *, int, const C&);
+// [12] int generateRaw(char *, int *, const DatetimeTz *, int);
+// [12] int generateRaw(char *, int *, const DatetimeTz *, int, const C&);
 #endif // BDE_OMIT_INTERNAL_DEPRECATED
 //-----------------------------------------------------------------------------
-// [12] USAGE EXAMPLE
+// [13] USAGE EXAMPLE
+// [-1] PERFORMANCE: PARSE AND GENERATE
 //-----------------------------------------------------------------------------
 
 // ============================================================================
@@ -794,7 +804,7 @@ int main(int argc, char *argv[])
     bsls::ReviewFailureHandlerGuard reviewGuard(&bsls::Review::failByAbort);
 
     switch (test) { case 0:  // Zero is always the leading case.
-      case 12: {
+      case 13: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //   Extracted from component header file.
@@ -991,6 +1001,272 @@ if (veryVerbose)
 //..
 
       } break;
+      case 12: {
+        // --------------------------------------------------------------------
+        // GENERATE 'Date', 'Datetime', AND 'DatetimeTz' SEQUENCES
+        //
+        // Concerns:
+        //: 1 The representation of each element written by the sequence
+        //:   'generateRaw' overloads is identical to that written by the
+        //:   single-object 'generateRaw' overloads, for every configuration.
+        //:
+        //: 2 The representations are written consecutively, and the returned
+        //:   value is the total number of characters written.
+        //:
+        //: 3 If 'lengths' is supplied, each of its elements is loaded with the
+        //:   length of the corresponding representation; 'lengths' may be 0.
+        //:
+        //: 4 The overloads without a configuration use the process-wide
+        //:   default configuration.
+        //:
+        //: 5 An empty sequence writes nothing and returns 0.
+        //:
+        //: 6 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 Using the table-driven technique, build arrays of 'Date',
+        //:   'Datetime', and 'DatetimeTz' objects from the cross product of
+        //:   the default date, time, and zone data.
+        //:
+        //: 2 For each configuration in the default configuration data,
+        //:   generate each array with and without 'lengths', and verify the
+        //:   output against the concatenated single-object representations.
+        //:   Set the process-wide default configuration to that configuration
+        //:   for the overloads without a configuration.  (C-1..5)
+        //:
+        //: 3 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for invalid arguments.  (C-6)
+        //
+        // Testing:
+        //   int generateRaw(char *, int *, const Date *, int);
+        //   int generateRaw(char *, int *, const Date *, int, const Config&);
+        //   int generateRaw(char *, int *, const Datetime *, int);
+        //   int generateRaw(char *, int *, const Datetime *, int, const C&);
+        //   int generateRaw(char *, int *, const DatetimeTz *, int);
+        //   int generateRaw(char *, int *, const DatetimeTz *, int, const C&);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                 << "GENERATE 'Date', 'Datetime', AND 'DatetimeTz' SEQUENCES"
+                 << endl
+                 << "======================================================="
+                 << endl;
+
+        const int                  NUM_DATE_DATA =       NUM_DEFAULT_DATE_DATA;
+        const DefaultDateDataRow (&DATE_DATA)[NUM_DATE_DATA] =
+                                                             DEFAULT_DATE_DATA;
+
+        const int                  NUM_TIME_DATA =       NUM_DEFAULT_TIME_DATA;
+        const DefaultTimeDataRow (&TIME_DATA)[NUM_TIME_DATA] =
+                                                             DEFAULT_TIME_DATA;
+
+        const int                  NUM_ZONE_DATA =       NUM_DEFAULT_ZONE_DATA;
+        const DefaultZoneDataRow (&ZONE_DATA)[NUM_ZONE_DATA] =
+                                                             DEFAULT_ZONE_DATA;
+
+        const int                  NUM_CNFG_DATA =       NUM_DEFAULT_CNFG_DATA;
+        const DefaultCnfgDataRow (&CNFG_DATA)[NUM_CNFG_DATA] =
+                                                             DEFAULT_CNFG_DATA;
+
+        bsl::vector<bdlt::Date>       dates;
+        bsl::vector<bdlt::Datetime>   datetimes;
+        bsl::vector<bdlt::DatetimeTz> datetimeTzs;
+
+        for (int ti = 0; ti < NUM_DATE_DATA; ++ti) {
+            const bdlt::Date DATE(DATE_DATA[ti].d_year,
+                                  DATE_DATA[ti].d_month,
+                                  DATE_DATA[ti].d_day);
+
+            dates.push_back(DATE);
+
+            for (int tj = 0; tj < NUM_TIME_DATA; ++tj) {
+                const bdlt::Time TIME(TIME_DATA[tj].d_hour,
+                                      TIME_DATA[tj].d_min,
+                                      TIME_DATA[tj].d_sec,
+                                      TIME_DATA[tj].d_msec,
+                                      TIME_DATA[tj].d_usec);
+
+                const bdlt::Datetime DATETIME(DATE, TIME);
+
+                datetimes.push_back(DATETIME);
+
+                for (int tk = 0; tk < NUM_ZONE_DATA; ++tk) {
+                    const int OFFSET = ZONE_DATA[tk].d_offset;
+
+                    if (bdlt::Time() == TIME && 0 != OFFSET) {
+                        continue;  // skip invalid compositions
+                    }
+
+                    datetimeTzs.push_back(bdlt::DatetimeTz(DATETIME, OFFSET));
+                }
+            }
+        }
+
+        const int NUM_DATES       = static_cast<int>(dates.size());
+        const int NUM_DATETIMES   = static_cast<int>(datetimes.size());
+        const int NUM_DATETIMETZS = static_cast<int>(datetimeTzs.size());
+
+        bsl::vector<char> buffer(NUM_DATETIMETZS * Util::k_DATETIMETZ_STRLEN);
+        bsl::vector<int>  lengths(NUM_DATETIMETZS);
+
+        const Config SAVED = Config::defaultConfiguration();
+
+        for (int tc = 0; tc < NUM_CNFG_DATA; ++tc) {
+            const int  CLINE     = CNFG_DATA[tc].d_line;
+            const bool OMITCOLON = CNFG_DATA[tc].d_omitColon;
+            const int  PRECISION = CNFG_DATA[tc].d_precision;
+            const bool USECOMMA  = CNFG_DATA[tc].d_useComma;
+            const bool USEZ      = CNFG_DATA[tc].d_useZ;
+
+            Config mC;  const Config& C = mC;
+            gg(&mC, PRECISION, OMITCOLON, USECOMMA, USEZ);
+
+            if (veryVerbose) { T_ P_(CLINE) P(C) }
+
+            Config::setDefaultConfiguration(C);
+
+            bsl::string EXP_DATE;
+            bsl::string EXP_DATETIME;
+            bsl::string EXP_DATETIMETZ;
+            char        chunk[Util::k_MAX_STRLEN];
+
+            for (int i = 0; i < NUM_DATES; ++i) {
+                EXP_DATE.append(chunk, Util::generateRaw(chunk, dates[i], C));
+            }
+            for (int i = 0; i < NUM_DATETIMES; ++i) {
+                EXP_DATETIME.append(chunk,
+                                    Util::generateRaw(chunk, datetimes[i], C));
+            }
+            for (int i = 0; i < NUM_DATETIMETZS; ++i) {
+                EXP_DATETIMETZ.append(
+                                  chunk,
+                                  Util::generateRaw(chunk, datetimeTzs[i], C));
+            }
+
+            for (int withLengths = 0; withLengths < 2; ++withLengths) {
+                int *LENGTHS = withLengths ? lengths.data() : 0;
+
+                for (int withConfig = 0; withConfig < 2; ++withConfig) {
+                    int len;
+
+                    len = withConfig
+                        ? Util::generateRaw(buffer.data(),
+                                            LENGTHS,
+                                            dates.data(),
+                                            NUM_DATES,
+                                            C)
+                        : Util::generateRaw(buffer.data(),
+                                            LENGTHS,
+                                            dates.data(),
+                                            NUM_DATES);
+
+                    ASSERTV(CLINE, static_cast<int>(EXP_DATE.size()) == len);
+                    ASSERTV(CLINE, EXP_DATE ==
+                                          bsl::string(buffer.data(), len));
+
+                    if (LENGTHS) {
+                        for (int i = 0; i < NUM_DATES; ++i) {
+                            ASSERTV(CLINE, i, Util::k_DATE_STRLEN ==
+                                                                  LENGTHS[i]);
+                        }
+                    }
+
+                    len = withConfig
+                        ? Util::generateRaw(buffer.data(),
+                                            LENGTHS,
+                                            datetimes.data(),
+                                            NUM_DATETIMES,
+                                            C)
+                        : Util::generateRaw(buffer.data(),
+                                            LENGTHS,
+                                            datetimes.data(),
+                                            NUM_DATETIMES);
+
+                    ASSERTV(CLINE, static_cast<int>(EXP_DATETIME.size()) ==
+                                                                          len);
+                    ASSERTV(CLINE, EXP_DATETIME ==
+                                          bsl::string(buffer.data(), len));
+
+                    if (LENGTHS) {
+                        for (int i = 0; i < NUM_DATETIMES; ++i) {
+                            ASSERTV(CLINE, i, LENGTHS[i] ==
+                                   Util::generateRaw(chunk, datetimes[i], C));
+                        }
+                    }
+
+                    len = withConfig
+                        ? Util::generateRaw(buffer.data(),
+                                            LENGTHS,
+                                            datetimeTzs.data(),
+                                            NUM_DATETIMETZS,
+                                            C)
+                        : Util::generateRaw(buffer.data(),
+                                            LENGTHS,
+                                            datetimeTzs.data(),
+                                            NUM_DATETIMETZS);
+
+                    ASSERTV(CLINE, static_cast<int>(EXP_DATETIMETZ.size()) ==
+                                                                          len);
+                    ASSERTV(CLINE, EXP_DATETIMETZ ==
+                                          bsl::string(buffer.data(), len));
+
+                    if (LENGTHS) {
+                        for (int i = 0; i < NUM_DATETIMETZS; ++i) {
+                            ASSERTV(CLINE, i, LENGTHS[i] ==
+                                 Util::generateRaw(chunk, datetimeTzs[i], C));
+                        }
+                    }
+                }
+            }
+        }
+
+        Config::setDefaultConfiguration(SAVED);
+
+        if (verbose) cout << "\nEmpty sequences." << endl;
+        {
+            char mB = 'x';  const char& B = mB;
+
+            ASSERT(0 == Util::generateRaw(&mB, 0, dates.data(), 0));
+            ASSERT(0 == Util::generateRaw(&mB, 0, datetimes.data(), 0));
+            ASSERT(0 == Util::generateRaw(&mB, 0, datetimeTzs.data(), 0));
+            ASSERT('x' == B);
+
+            ASSERT(0 == Util::generateRaw(0,
+                                          0,
+                                          static_cast<bdlt::Date *>(0),
+                                          0));
+        }
+
+        if (verbose) cout << "\nNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            const bdlt::Date       *D  = dates.data();
+            const bdlt::Datetime   *DT = datetimes.data();
+            const bdlt::DatetimeTz *TZ = datetimeTzs.data();
+            char                   *B  = buffer.data();
+
+            ASSERT_PASS(Util::generateRaw(B, 0, D,  1));
+            ASSERT_FAIL(Util::generateRaw(0, 0, D,  1));
+            ASSERT_FAIL(Util::generateRaw(B, 0,
+                                          static_cast<bdlt::Date *>(0), 1));
+            ASSERT_FAIL(Util::generateRaw(B, 0, D, -1));
+
+            ASSERT_PASS(Util::generateRaw(B, 0, DT,  1));
+            ASSERT_FAIL(Util::generateRaw(0, 0, DT,  1));
+            ASSERT_FAIL(Util::generateRaw(B, 0,
+                                          static_cast<bdlt::Datetime *>(0),
+                                          1));
+            ASSERT_FAIL(Util::generateRaw(B, 0, DT, -1));
+
+            ASSERT_PASS(Util::generateRaw(B, 0, TZ,  1));
+            ASSERT_FAIL(Util::generateRaw(0, 0, TZ,  1));
+            ASSERT_FAIL(Util::generateRaw(B, 0,
+                                          static_cast<bdlt::DatetimeTz *>(0),
+                                          1));
+            ASSERT_FAIL(Util::generateRaw(B, 0, TZ, -1));
+        }
+      } break;
       case 11: {
         // --------------------------------------------------------------------
         // PARSE: DATETIME & DATETIMETZ
@@ -5698,6 +5974,103 @@ if (veryVerbose)
         }
 
       } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE: PARSE AND GENERATE
+        //   Report the time taken, in nanoseconds per timestamp, to parse and
+        //   to generate 'Date', 'Datetime', and 'DatetimeTz' values, singly
+        //   and using the sequence 'generateRaw' overloads.
+        //
+        // Testing:
+        //   PERFORMANCE: PARSE AND GENERATE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "PERFORMANCE: PARSE AND GENERATE" << endl
+                          << "===============================" << endl;
+
+        const int NUM_OBJECTS    = 1024;
+        const int NUM_ITERATIONS = argc > 2 ? atoi(argv[2]) : 1000;
+
+        bsl::vector<bdlt::Date>       dates(NUM_OBJECTS);
+        bsl::vector<bdlt::Datetime>   datetimes(NUM_OBJECTS);
+        bsl::vector<bdlt::DatetimeTz> datetimeTzs(NUM_OBJECTS);
+
+        for (int i = 0; i < NUM_OBJECTS; ++i) {
+            const bdlt::Date DATE(1990 + i % 50, 1 + i % 12, 1 + i % 28);
+            const bdlt::Time TIME(i % 24, i % 60, (i * 7) % 60, i % 1000);
+
+            dates[i]       = DATE;
+            datetimes[i]   = bdlt::Datetime(DATE, TIME);
+            datetimeTzs[i] = bdlt::DatetimeTz(datetimes[i], i % 120 - 60);
+        }
+
+        bsl::vector<char> buffer(NUM_OBJECTS * Util::k_DATETIMETZ_STRLEN);
+        bsl::vector<int>  lengths(NUM_OBJECTS);
+
+        const double NUM_TIMESTAMPS =
+                           static_cast<double>(NUM_OBJECTS) * NUM_ITERATIONS;
+
+        bsls::Stopwatch timer;
+        int             checksum = 0;
+
+#define U_REPORT(NAME)                                                        \
+        cout << setw(28) << left << (NAME) << right << setw(10)               \
+             << timer.accumulatedWallTime() * 1e9 / NUM_TIMESTAMPS            \
+             << " ns/timestamp" << endl
+
+#define U_BENCHMARK(TYPE, OBJECTS)                                            \
+        {                                                                     \
+            timer.reset();                                                    \
+            timer.start();                                                    \
+            for (int iter = 0; iter < NUM_ITERATIONS; ++iter) {               \
+                char *p = buffer.data();                                      \
+                for (int i = 0; i < NUM_OBJECTS; ++i) {                       \
+                    p += Util::generateRaw(p, OBJECTS[i]);                    \
+                }                                                             \
+                checksum += static_cast<int>(p - buffer.data());              \
+            }                                                                 \
+            timer.stop();                                                     \
+            U_REPORT("generateRaw(" TYPE ")");                                \
+                                                                              \
+            timer.reset();                                                    \
+            timer.start();                                                    \
+            for (int iter = 0; iter < NUM_ITERATIONS; ++iter) {               \
+                checksum += Util::generateRaw(buffer.data(),                  \
+                                              lengths.data(),                 \
+                                              OBJECTS.data(),                 \
+                                              NUM_OBJECTS);                   \
+            }                                                                 \
+            timer.stop();                                                     \
+            U_REPORT("generateRaw(" TYPE " *)");                              \
+                                                                              \
+            Util::generateRaw(buffer.data(),                                  \
+                              lengths.data(),                                 \
+                              OBJECTS.data(),                                 \
+                              NUM_OBJECTS);                                   \
+                                                                              \
+            timer.reset();                                                    \
+            timer.start();                                                    \
+            for (int iter = 0; iter < NUM_ITERATIONS; ++iter) {               \
+                const char *p = buffer.data();                                \
+                for (int i = 0; i < NUM_OBJECTS; ++i) {                       \
+                    checksum += Util::parse(&OBJECTS[i], p, lengths[i]);      \
+                    p += lengths[i];                                          \
+                }                                                             \
+            }                                                                 \
+            timer.stop();                                                     \
+            U_REPORT("parse(" TYPE ")");                                      \
+        }
+
+        U_BENCHMARK("Date",       dates);
+        U_BENCHMARK("Datetime",   datetimes);
+        U_BENCHMARK("DatetimeTz", datetimeTzs);
+
+#undef U_BENCHMARK
+#undef U_REPORT
+
+        ASSERT(0 != checksum);
+      } break;
       default: {
         cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
         testStatus = -1;